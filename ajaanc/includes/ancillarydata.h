@@ -579,6 +579,15 @@ public:
 	virtual									~AJAAncillaryData ();	///< @brief		My destructor.
 	virtual void							Clear (void);			///< @brief		Frees my allocated memory, if any, and resets my members to their default values.
 	virtual AJAAncillaryData *				Clone (void) const;		///< @return	A clone of myself.
+
+	/**
+		@brief		Re-initializes me from the given "raw" (unparsed) packet, leaving me in the same state as if I'd
+					been newly created from it by AJAAncillaryDataFactory::Create, but without releasing my payload storage.
+		@note		This is how AJAAncillaryList recycles its packets (see AJAAncillaryList::SetPacketRecycling).
+		@param[in]	inRawPacket		Specifies the raw packet to be copied.
+		@return		The result of ParsePayloadData.
+	**/
+	virtual AJAStatus						RecycleFrom (const AJAAncillaryData & inRawPacket);	//	New in SDK 17.1
 	///@}
 
 
@@ -987,6 +996,24 @@ public:
 		@return		AJA_STATUS_SUCCESS if successful.
 	**/
 	virtual AJAStatus						GenerateTransmitData (ULWordSequence & outData);
+
+	/**
+		@return		The number of 32-bit IP packet words I'll produce for my current payload, including my leading
+					anc packet header word, or zero if I'm not digital.
+		@note		This doesn't call GeneratePayloadData, so call that first if my payload needs regenerating.
+	**/
+	virtual uint32_t						GetIPTransmitDataU32Count (void) const;	//	New in SDK 17.1
+
+	/**
+		@brief		Writes my 32-bit IP packet words directly into the given memory, in network byte order, without
+					using any intermediate containers. Unlike GenerateTransmitData, this doesn't call GeneratePayloadData.
+		@param		pOutU32s			Specifies a valid, non-NULL address of the first 32-bit word to be written.
+		@param[in]	inMaxU32s			Specifies the maximum number of 32-bit words that may be written.
+		@param[out]	outU32Count			Receives the number of 32-bit words written (see GetIPTransmitDataU32Count).
+		@return		AJA_STATUS_SUCCESS if successful;  AJA_STATUS_RANGE if my data count exceeds 255;
+					AJA_STATUS_BAD_PARAM if I'm not digital, or if the destination is NULL or too small.
+	**/
+	virtual AJAStatus						WriteIPTransmitData (uint32_t * pOutU32s, const size_t inMaxU32s, uint32_t & outU32Count) const;	//	New in SDK 17.1
 	///@}
 
 
@@ -1079,6 +1106,25 @@ public:
 																		const AncChannelSearchSelect	inChanSelect,
 																		U16Packets &					outRawPackets,
 																		U16Packet &						outWordOffsets);
+
+	/**
+		@brief		Like GetAncPacketsFromVANCLine, but searches an ::NTV2_FBF_10BIT_YCBCR ('v210') VANC line in place,
+					without unpacking it. Ancillary data flags are located with vector compares (see ::AJA_Find10BitYCbCrZeroWord),
+					and only the words of the packets that are found get extracted.
+		@param[in]	pInV210Line			A valid, non-NULL pointer to the start of the VANC line in an ::NTV2_FBF_10BIT_YCBCR video buffer.
+		@param[in]	inNumPixels			Specifies the width of the line, in pixels.
+		@param[in]	inChanSelect		Specifies the ancillary data channel to search. Use AncChannelSearch_Y for luma, AncChannelSearch_C
+										for chroma, or AncChannelSearch_Both for both (SD only).
+		@param[out]	outRawPackets		Receives the packet vector, same as GetAncPacketsFromVANCLine.
+		@param[out]	outWordOffsets		Receives the horizontal offset of each packet, as a component index into the unpacked line.
+		@return		True if successful;  false if failed.
+		@note		Like GetAncPacketsFromVANCLine, this stops parsing the line once a parity, checksum, or overrun error is discovered.
+	**/
+	static bool								GetAncPacketsFromV210VANCLine (const void *					pInV210Line,	//	New in SDK 17.1
+																			const uint32_t					inNumPixels,
+																			const AncChannelSearchSelect	inChanSelect,
+																			U16Packets &					outRawPackets,
+																			U16Packet &						outWordOffsets);
 	/**
 		@brief		Converts a single line of ::NTV2_FBF_8BIT_YCBCR data from the given source buffer into an ordered sequence of uint16_t
 					values that contain the resulting 10-bit even-parity data.
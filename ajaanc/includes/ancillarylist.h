@@ -176,7 +176,8 @@ public:	//	INSTANCE METHODS
 	**/
 	///@{
 											AJAAncillaryList ();			///< @brief	Instantiate and initialize with a default set of values.
-	inline									AJAAncillaryList (const AJAAncillaryList & inRHS)	{*this = inRHS;}	///< @brief	My copy constructor.
+	inline									AJAAncillaryList (const AJAAncillaryList & inRHS)
+													:	m_recyclePkts(false), m_pRawPkt(AJA_NULL)	{*this = inRHS;}	///< @brief	My copy constructor.
 	virtual									~AJAAncillaryList ();			///< @brief	My destructor.
 
 	/**
@@ -432,7 +433,9 @@ public:	//	INSTANCE METHODS
 										Defaults to zero (progressive).
 		@note		This function has the following side-effects:
 					-	Sorts my packets by ascending location before encoding.
-					-	Calls AJAAncillaryData::GenerateTransmitData on each of my packets.
+					-	Calls AJAAncillaryData::GeneratePayloadData on each of my packets, then writes each one
+						directly into the buffer with AJAAncillaryData::WriteIPTransmitData (see WriteRTPField).
+					If it fails, both buffers will be zeroed.
 		@return		AJA_STATUS_SUCCESS if successful.
 	**/
 	virtual AJAStatus						GetIPTransmitData (NTV2Buffer & F1Buffer, NTV2Buffer & F2Buffer,
@@ -553,6 +556,31 @@ public:	//	INSTANCE METHODS
 	**/
 	virtual inline void						SetIgnoreChecksumErrors (const bool inIgnore)		{m_ignoreCS = inIgnore;}
 
+	/**
+		@brief		Answers if I recycle my packets or not.
+					The default behavior is to not recycle them.
+		@return		True if I'm recycling packets;  otherwise false.
+	**/
+	virtual inline bool						IsRecyclingPackets (void) const		{return m_recyclePkts;}	//	New in SDK 17.1
+
+	/**
+		@brief		Determines if Clear deletes my packets, or keeps them for reuse by subsequent captures/ingests
+					(via AddReceivedAncillaryData, SetFromDeviceAncBuffers, etc.). When recycling, a list that's
+					repeatedly cleared and refilled with similar content (e.g. once per frame) reuses the same packet
+					objects and payload storage, and makes no heap allocations once it reaches steady state.
+		@note		Packets returned by my Get... functions still become invalid after Clear is called, as their
+					content will be overwritten by subsequently received packets.
+		@note		This setting is not copied by the assignment operator.
+		@param[in]	inRecycle	Specify true to recycle packets;  otherwise false to delete them (the default).
+					Specifying false also frees any spare packets I've been holding.
+	**/
+	virtual void							SetPacketRecycling (const bool inRecycle);	//	New in SDK 17.1
+
+	/**
+		@return		The number of cleared packets I'm holding for reuse.
+	**/
+	virtual inline uint32_t					CountSparePackets (void) const		{return uint32_t(m_spares.size());}	//	New in SDK 17.1
+
 	/**
 		@brief		Sends a "ParsePayloadData" command to all of my AJAAncillaryData objects.
 		@return		AJA_STATUS_SUCCESS if all items parse successfully;  otherwise the last failure result.
@@ -653,15 +681,112 @@ protected:
 															const bool inIsF2,
 															const bool inIsProgressive);
 
+	/**
+		@brief		Encodes my F1 or F2 SMPTE anc packets as RTP packets directly into the given buffer, in one pass,
+					without intermediate containers. The result is identical to GetRTPPackets followed by WriteRTPPackets.
+					Each anc packet's exact size is known before it's written, so the buffer bound is checked up front.
+		@param		theBuffer		The buffer to be filled. An empty/NULL buffer is permitted, and will copy no data,
+									but instead will return the byte count that otherwise would've been written.
+		@param[out]	outBytesWritten	Receives the total bytes written into the buffer (or that would be written if
+									given a non-NULL buffer). The unused remainder of the buffer is left untouched.
+		@param[in]	inIsF2			Specify false for Field1 (or progressive or Psf);  true for Field2.
+		@param[in]	inIsProgressive	Specify false for interlace;  true for progressive/Psf.
+		@param[in]	inF2StartLine	For interlaced/psf frames, specifies the line number where Field 2 begins;  otherwise ignored.
+		@return		AJA_STATUS_SUCCESS if successful;  AJA_STATUS_FAIL if the buffer is too small.
+	**/
+	virtual AJAStatus						WriteRTPField (NTV2Buffer & theBuffer,		//	New in SDK 17.1
+															uint32_t & outBytesWritten,
+															const bool inIsF2,
+															const bool inIsProgressive,
+															const uint32_t inF2StartLine);
+
+	/**
+		@brief		Creates a new packet of the given type from the given raw packet, reusing a spare one if I'm recycling.
+		@param[in]	inAncType		Specifies the type of packet to create.
+		@param[in]	inRawPacket		Specifies the raw packet to be copied.
+		@return		A pointer to the new packet, or NULL if the type isn't supported by AJAAncillaryDataFactory.
+	**/
+	virtual AJAAncillaryData *				NewPacket (const AJAAncDataType inAncType, const AJAAncillaryData & inRawPacket);
+
+	/**
+		@brief		Disposes of the given packet, which must not be in my packet list.
+					If I'm recycling, I'll hold onto it for reuse;  otherwise it's deleted.
+		@param		pInPacket		Specifies the packet to be disposed of.
+	**/
+	virtual void							DisposePacket (AJAAncillaryData * pInPacket);
+
+	/**
+		@return		The scratch packet to decode raw packets into, or NULL if I'm not recycling.
+	**/
+	virtual inline AJAAncillaryData *		RawPacket (void)		{return m_pRawPkt;}
+
 private:
 	AJAAncillaryDataList	m_ancList;		///< @brief	My packet list
 	bool					m_rcvMultiRTP;	///< @brief	True: Rcv 1 RTP pkt per Anc pkt;  False: Rcv 1 RTP pkt for all Anc pkts
 	bool					m_xmitMultiRTP;	///< @brief	True: Xmit 1 RTP pkt per Anc pkt;  False: Xmit 1 RTP pkt for all Anc pkts
 	bool					m_ignoreCS;		///< @brief	True: ignore checksum errors;  False: don't ignore CS errors
+	bool					m_recyclePkts;	///< @brief	True: Clear() keeps packets for reuse;  False: Clear() deletes them
+	AJAAncillaryDataList	m_spares;		///< @brief	Cleared packets awaiting reuse (only when recycling)
+	AJAAncillaryData *		m_pRawPkt;		///< @brief	Scratch packet for decoding raw packets (only when recycling)
 
 };	//	AJAAncillaryList
 
 
+/**
+	@brief		I extract the ancillary data packets from the VANC lines of successive frames of one capture stream.
+				I find packets directly in the packed ::NTV2_FBF_10BIT_YCBCR rows with vector compares, and skip
+				::NTV2_FBF_8BIT_YCBCR rows that can't hold a packet, so blank VANC lines cost next to nothing.
+				If enabled, I also keep a copy of each VANC line, and for lines that are unchanged from the previous
+				frame, I add the packets I found last time instead of searching the line again.
+				AJAAncillaryList::SetFromVANCData uses a temporary instance of me.
+	@warning	I am not thread-safe. Use one instance per capture stream.
+**/
+class AJAExport AJAAncVANCScanner	//	New in SDK 17.1
+{
+public:
+	AJAAncVANCScanner ();
+
+	/**
+		@brief		Returns all packets found in the VANC lines of the given NTV2 frame buffer.
+		@param[in]	inFrameBuffer		Specifies the NTV2 frame buffer (or at least the portion containing the VANC lines).
+		@param[in]	inFormatDesc		Describes the frame buffer (pixel format, video standard, etc.).
+		@param[out]	outPackets			Receives the packets found.
+		@param[in]	inFrameNum			If non-zero, specifies/sets the frame identifier for the packets.
+		@return		AJA_STATUS_SUCCESS if successful.
+	**/
+	AJAStatus						Scan (const NTV2Buffer & inFrameBuffer,
+										const NTV2FormatDescriptor & inFormatDesc,
+										AJAAncillaryList & outPackets,
+										const uint32_t inFrameNum = 0);
+
+	/**
+		@brief		Determines if VANC lines that are unchanged from the previous frame are searched again.
+		@param[in]	inSkip		Specify true to reuse the previous frame's packets for unchanged lines.
+								Specify false to search every line of every frame (the default).
+	**/
+	void							SetSkipUnchangedLines (const bool inSkip);
+	inline bool						GetSkipUnchangedLines (void) const	{return mSkipUnchanged;}	///< @return	True if unchanged lines are skipped.
+	void							Reset (void);	///< @brief	Forgets the previous frame's lines, and zeroes my tallies.
+	inline uint64_t					GetNumLinesSearched (void) const	{return mNumSearched;}	///< @return	The number of VANC lines searched.
+	inline uint64_t					GetNumLinesSkipped (void) const		{return mNumSkipped;}	///< @return	The number of unchanged VANC lines that weren't searched.
+
+private:
+	struct VANCLine
+	{
+		UByteSequence					mBytes;		///< @brief	The line's contents when it was searched (only when skipping unchanged lines)
+		AJAAncillaryData::U16Packets	mPackets;	///< @brief	The packets found in the line
+		std::vector<AJAAncDataLoc>		mLocs;		///< @brief	Where each packet was found
+	};
+	std::vector<VANCLine>	mLines;			///< @brief	The previous frame's lines (only when skipping unchanged lines)
+	VANCLine				mScratch;		///< @brief	Reused for each line when not skipping unchanged lines
+	NTV2FormatDescriptor	mFormatDesc;	///< @brief	Describes the frame buffer that mLines came from
+	bool					mSkipUnchanged;	///< @brief	True to skip unchanged lines
+	uint64_t				mNumSearched;	///< @brief	Tally of lines searched
+	uint64_t				mNumSkipped;	///< @brief	Tally of lines skipped
+
+};	//	AJAAncVANCScanner
+
+
 /**
 	@brief		Writes a human-readable rendition of the given AJAAncillaryList into the given output stream.
 	@param		inOutStream		Specifies the output stream to be written.
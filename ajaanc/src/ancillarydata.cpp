@@ -9,6 +9,7 @@
 #include "ancillarydata.h"
 #include "ajabase/system/debug.h"	//	This makes 'ajaanc' dependent upon 'ajabase'
 #include "ajabase/system/atomic.h"
+#include "ajabase/common/pixelkernels.h"
 #if defined(AJA_LINUX)
 	#include <string.h>				// For memcpy
 	#include <stdlib.h>				// For realloc
@@ -162,6 +163,30 @@ AJAAncillaryData * AJAAncillaryData::Clone (void) const
 }
 
 
+AJAStatus AJAAncillaryData::RecycleFrom (const AJAAncillaryData & inRawPacket)
+{
+	//	My subclass' Clear/Init stamps its type (and for some, coding, DID, SID & line number) into me...
+	Clear();
+	const AJAAncDataType	ancType	(m_ancType);
+	const AJAAncDataCoding	coding	(m_coding);
+	const uint8_t			did		(m_DID);
+	const uint8_t			sid		(m_SID);
+	const uint16_t			lineNum	(m_location.GetLineNumber());
+
+	//	Copy the raw packet's base members (this reuses my payload vector's capacity)...
+	AJAAncillaryData::operator = (inRawPacket);
+
+	//	...then re-apply whatever my subclass stamped, just as its constructor would've done...
+	if (ancType != AJAAncDataType_Unknown)
+		m_ancType = ancType;
+	if (coding != AJAAncDataCoding_Digital  ||  did  ||  sid)
+		{m_coding = coding;  m_DID = did;  m_SID = sid;}
+	if (!IS_UNKNOWN_AJAAncDataLineNumber(lineNum))
+		m_location.SetLineNumber(lineNum);
+	return ParsePayloadData();
+}
+
+
 AJAStatus AJAAncillaryData::AllocDataMemory(uint32_t numBytes)
 {
 	AJAStatus status;
@@ -919,8 +944,45 @@ AJAStatus AJAAncillaryData::GenerateTransmitData (UWordSequence & outRawComponen
 }
 
 
+//	Even parity table (see AddEvenParity):  the 8-bit data value with even parity in bit 8, and not-bit-8 in bit 9
+static const uint16_t gEvenParityTable[256] =
+{
+	/* 0-7 */		0x200,0x101,0x102,0x203,0x104,0x205,0x206,0x107,
+	/* 8-15 */		0x108,0x209,0x20A,0x10B,0x20C,0x10D,0x10E,0x20F,
+	/* 16-23 */		0x110,0x211,0x212,0x113,0x214,0x115,0x116,0x217,
+	/* 24-31 */		0x218,0x119,0x11A,0x21B,0x11C,0x21D,0x21E,0x11F,
+	/* 32-39 */		0x120,0x221,0x222,0x123,0x224,0x125,0x126,0x227,
+	/* 40-47 */		0x228,0x129,0x12A,0x22B,0x12C,0x22D,0x22E,0x12F,
+	/* 48-55 */		0x230,0x131,0x132,0x233,0x134,0x235,0x236,0x137,
+	/* 56-63 */		0x138,0x239,0x23A,0x13B,0x23C,0x13D,0x13E,0x23F,
+	/* 64-71 */		0x140,0x241,0x242,0x143,0x244,0x145,0x146,0x247,
+	/* 72-79 */		0x248,0x149,0x14A,0x24B,0x14C,0x24D,0x24E,0x14F,
+	/* 80-87 */		0x250,0x151,0x152,0x253,0x154,0x255,0x256,0x157,
+	/* 88-95 */		0x158,0x259,0x25A,0x15B,0x25C,0x15D,0x15E,0x25F,
+	/* 96-103 */	0x260,0x161,0x162,0x263,0x164,0x265,0x266,0x167,
+	/* 104-111 */	0x168,0x269,0x26A,0x16B,0x26C,0x16D,0x16E,0x26F,
+	/* 112-119 */	0x170,0x271,0x272,0x173,0x274,0x175,0x176,0x277,
+	/* 120-127 */	0x278,0x179,0x17A,0x27B,0x17C,0x27D,0x27E,0x17F,
+	/* 128-135 */	0x180,0x281,0x282,0x183,0x284,0x185,0x186,0x287,
+	/* 136-143 */	0x288,0x189,0x18A,0x28B,0x18C,0x28D,0x28E,0x18F,
+	/* 144-151 */	0x290,0x191,0x192,0x293,0x194,0x295,0x296,0x197,
+	/* 152-159 */	0x198,0x299,0x29A,0x19B,0x29C,0x19D,0x19E,0x29F,
+	/* 160-167 */	0x2A0,0x1A1,0x1A2,0x2A3,0x1A4,0x2A5,0x2A6,0x1A7,
+	/* 168-175 */	0x1A8,0x2A9,0x2AA,0x1AB,0x2AC,0x1AD,0x1AE,0x2AF,
+	/* 176-183 */	0x1B0,0x2B1,0x2B2,0x1B3,0x2B4,0x1B5,0x1B6,0x2B7,
+	/* 184-191 */	0x2B8,0x1B9,0x1BA,0x2BB,0x1BC,0x2BD,0x2BE,0x1BF,
+	/* 192-199 */	0x2C0,0x1C1,0x1C2,0x2C3,0x1C4,0x2C5,0x2C6,0x1C7,
+	/* 200-207 */	0x1C8,0x2C9,0x2CA,0x1CB,0x2CC,0x1CD,0x1CE,0x2CF,
+	/* 208-215 */	0x1D0,0x2D1,0x2D2,0x1D3,0x2D4,0x1D5,0x1D6,0x2D7,
+	/* 216-223 */	0x2D8,0x1D9,0x1DA,0x2DB,0x1DC,0x2DD,0x2DE,0x1DF,
+	/* 224-231 */	0x1E0,0x2E1,0x2E2,0x1E3,0x2E4,0x1E5,0x1E6,0x2E7,
+	/* 232-239 */	0x2E8,0x1E9,0x1EA,0x2EB,0x1EC,0x2ED,0x2EE,0x1EF,
+	/* 240-247 */	0x2F0,0x1F1,0x1F2,0x2F3,0x1F4,0x2F5,0x2F6,0x1F7,
+	/* 248-255 */	0x1F8,0x2F9,0x2FA,0x1FB,0x2FC,0x1FD,0x1FE,0x2FF
+};	//	gEvenParityTable
+
+
 //	These tables implement the 16-UDWs-per-20-bytes packing cadence:
-static const size_t		gIndexes[]	=	{	0,1,2,3,	3,4,5,6,	6,7,8,9,	9,10,11,12, 12,13,14,15 };
 static const unsigned	gShifts[]	=	{	22,12,2,8,	24,14,4,6,	26,16,6,4,	28,18,8,2,	30,20,10,0	};
 static const uint32_t	gMasks[]	=	{	0xFFC00000, 0x003FF000, 0x00000FFC, 0x00000003,
 											0xFF000000, 0x00FFC000, 0x00003FF0, 0x0000000F,
@@ -933,99 +995,23 @@ AJAStatus AJAAncillaryData::GenerateTransmitData (ULWordSequence & outData)
 {
 	AJAStatus						status		(GeneratePayloadData());
 	const ULWordSequence::size_type origSize	(outData.size());
-	uint32_t						u32			(0);	//	32-bit value
+	uint32_t						numU32s		(0);
 
 	if (!IsDigital())
 		{XMT2110WARN("Analog/raw packet skipped/ignored: " << AsString(32));	return AJA_STATUS_SUCCESS;}
-	if (GetDC() > 255)
-		{XMT2110ERR("Data count exceeds 255: " << AsString(32));	return AJA_STATUS_RANGE;}
 
-	//////////////////////////////////////////////////
-	//	Prepare an array of 10-bit DID/SID/DC/UDWs/CS values...
-		const uint16_t	did (AddEvenParity(GetDID()));
-		const uint16_t	sid (AddEvenParity(GetSID()));
-		const uint16_t	dc	(AddEvenParity(uint8_t(GetDC())));
-		const uint16_t	cs	(Calculate9BitChecksum());
-
-		UWordSequence	UDW16s;		//	10-bit even-parity words
-		UDW16s.reserve(GetDC()+4);	//	Reserve DID + SID + DC + UDWs + CS
-		UDW16s.push_back(did);
-		UDW16s.push_back(sid);
-		UDW16s.push_back(dc);
-
-		//	Append 8-bit payload data, converting into 10-bit values with even parity added...
-		status = GetPayloadData(UDW16s, true);	//	Append 10-bit even-parity UDWs
-		if (AJA_FAILURE(status))
-			{XMT2110ERR("GetPayloadData failed: " << AsString(32)); return status;}
-		UDW16s.push_back(cs);	//	Checksum is the caboose
-	//	Done -- 10-bit DID/SID/DC/UDWs/CS array is prepared
-	XMT2110DBG("From " << UWordSequence(UDW16s) << " " << AsString(32));
-	//////////////////////////////////////////////////
-
-	//	Begin writing into "outData" array.
-	//	My first 32-bit longword is the Anc packet header, which contains location info...
-	const AJARTPAncPacketHeader pktHdr	(GetDataLocation());
-	const uint32_t				pktHdrWord	(pktHdr.GetULWord());
-	outData.push_back(pktHdrWord);
-//	XMT2110DDBG("outU32s[" << DEC(outData.size()-1) << "]=" << xHEX0N(ENDIAN_32NtoH(pktHdrWord),8) << " (BigEndian)");	//	Byte-Swap it to make BigEndian look right
-
-	//	All subsequent 32-bit longwords come from the array of 10-bit values I built earlier.
-	const size_t	numUDWs (UDW16s.size());
-	size_t			UDWndx	(0);
-	u32 = 0;
-	do
+	try
 	{
-		for (unsigned loopNdx(0);  loopNdx < sizeof(gIndexes) / sizeof(size_t);	 loopNdx++)
-		{
-			const bool		is4th		((loopNdx & 3) == 3);
-			const size_t	ndx			(UDWndx + gIndexes[loopNdx]);
-			const bool		isPastEnd	(ndx >= numUDWs);
-			const uint32_t	UDW			(isPastEnd	?  0  :	 uint32_t(UDW16s[ndx]));
-			const unsigned	shift		(gShifts[loopNdx]);
-			const uint32_t	mask		(gMasks[loopNdx]);
-//			if (!isPastEnd) XMT2110DDBG("u16s[" << DEC(ndx) << "]=" << xHEX0N(UDW,3));
-			if (is4th)
-			{
-				u32 |=	(UDW >> shift) & mask;
-				outData.push_back(ENDIAN_32HtoN(u32));
-//				XMT2110DDBG("outU32s[" << DEC(outData.size()-1) << "]=" << xHEX0N(u32,8) << " (BigEndian)");
-				u32 = 0;	//	Reset, start over
-				if (isPastEnd)
-					break;	//	Done, 32-bit longword aligned
-				continue;
-			}
-			//	Continue building this 32-bit longword...
-			u32 |=	(UDW << shift) & mask;
-		}	//	inner loop
-		UDWndx += 16;
-	} while (UDWndx < numUDWs);
-
-	/*	The Pattern:  (unrolling the above loop):														BitCnt		ShiftLeft	ShiftRight
-	u32 =  (uint32_t(UDW16s.at( 0)) << 22) & 0xFFC00000;	//	0b00000|0x00|00: [ 0] all 10 bits		0+10=10		32-10=22
-	u32 |= (uint32_t(UDW16s.at( 1)) << 12) & 0x003FF000;	//	0b00001|0x01|01: [ 1] all 10 bits		10+10=20	22-10=12
-	u32 |= (uint32_t(UDW16s.at( 2)) <<	2) & 0x00000FFC;	//	0b00010|0x02|02: [ 2] all 10 bits		20+10=30	12-10=2
-	u32 |= (uint32_t(UDW16s.at( 3)) >>	8) & 0x00000003;	//	0b00011|0x03|03: [ 3] first (MS 2 bits) 30+2=32					10-2=8
-	outData.push_back(ENDIAN_32HtoN(u32));
-	u32 =  (uint32_t(UDW16s.at( 3)) << 24) & 0xFF000000;	//	0b00100|0x04|04: [ 3] last (LS 8 bits)	0+8=8		32-8=24
-	u32 |= (uint32_t(UDW16s.at( 4)) << 14) & 0x00FFC000;	//	0b00101|0x05|05: [ 4] all 10 bits		8+10=18		24-10=14
-	u32 |= (uint32_t(UDW16s.at( 5)) <<	4) & 0x00003FF0;	//	0b00110|0x06|06: [ 5] all 10 bits		18+10=28	14-10=4
-	u32 |= (uint32_t(UDW16s.at( 6)) >>	6) & 0x0000000F;	//	0b00111|0x07|07: [ 6] first (MS 4 bits) 28+4=32					10-4=6
-	outData.push_back(ENDIAN_32HtoN(u32));
-	u32 =  (uint32_t(UDW16s.at( 6)) << 26) & 0xFC000000;	//	0b01000|0x08|08: [ 6] last (LS 6 bits)	0+6=6		32-6=26
-	u32 |= (uint32_t(UDW16s.at( 7)) << 16) & 0x03FF0000;	//	0b01001|0x09|09: [ 7] all 10 bits		6+10=16		26-10=16
-	u32 |= (uint32_t(UDW16s.at( 8)) <<	6) & 0x0000FFC0;	//	0b01010|0x0A|10: [ 8] all 10 bits		16+10=26	16-10=6
-	u32 |= (uint32_t(UDW16s.at( 9)) >>	4) & 0x0000003F;	//	0b01011|0x0B|11: [ 9] first (MS 6 bits) 26+6=32					10-6=4
-	outData.push_back(ENDIAN_32HtoN(u32));
-	u32 =  (uint32_t(UDW16s.at( 9)) << 28) & 0xF0000000;	//	0b01100|0x0C|12: [ 9] last (LS 4 bits)	0+4=4		32-4=28
-	u32 |= (uint32_t(UDW16s.at(10)) << 18) & 0x0FFC0000;	//	0b01101|0x0D|13: [10] all 10 bits		4+10=14		28-10=18
-	u32 |= (uint32_t(UDW16s.at(11)) <<	8) & 0x0003FF00;	//	0b01110|0x0E|14: [11] all 10 bits		14+10=24	18-10=8
-	u32 |= (uint32_t(UDW16s.at(12)) >>	2) & 0x000000FF;	//	0b01111|0x0F|15: [12] first (MS 8 bits) 24+8=32					10-8=2
-	outData.push_back(ENDIAN_32HtoN(u32));
-	u32 =  (uint32_t(UDW16s.at(12)) << 30) & 0xC0000000;	//	0b10000|0x10|16: [12] last (LS 2 bits)	0+2=2		32-2=30
-	u32 |= (uint32_t(UDW16s.at(13)) << 20) & 0x3FF00000;	//	0b10001|0x11|17: [13] all 10 bits		2+10=12		30-10=20
-	u32 |= (uint32_t(UDW16s.at(14)) << 10) & 0x000FFC00;	//	0b10010|0x12|18: [14] all 10 bits		12+10=22	20-10=10
-	u32 |= (uint32_t(UDW16s.at(15)) >>	0) & 0x000003FF;	//	0b10011|0x13|19: [15] all 10 bits		22+10=32				10-10=0
-	outData.push_back(ENDIAN_32HtoN(u32));	*/
+		outData.resize(origSize + GetIPTransmitDataU32Count());
+	}
+	catch (...)
+	{
+		outData.resize(origSize);
+		return AJA_STATUS_MEMORY;
+	}
+	status = WriteIPTransmitData(&outData[origSize], outData.size() - origSize, numU32s);
+	if (AJA_FAILURE(status))
+		{outData.resize(origSize);	return status;}
 
 #if defined(_DEBUG)
 {
@@ -1044,6 +1030,68 @@ AJAStatus AJAAncillaryData::GenerateTransmitData (ULWordSequence & outData)
 }	//	GenerateTransmitData
 
 
+uint32_t AJAAncillaryData::GetIPTransmitDataU32Count (void) const
+{
+	if (!IsDigital())
+		return 0;
+	//	Anc packet header, plus DID + SID + DC + UDWs + CS as 10-bit values, zero-padded to a 32-bit boundary...
+	return 1  +	 (10 * (GetDC() + 4) + 31) / 32;
+}
+
+
+AJAStatus AJAAncillaryData::WriteIPTransmitData (uint32_t * pOutU32s, const size_t inMaxU32s, uint32_t & outU32Count) const
+{
+	outU32Count = 0;
+	if (!IsDigital())
+		return AJA_STATUS_BAD_PARAM;
+	if (GetDC() > 255)
+		{XMT2110ERR("Data count exceeds 255: " << AsString(32));	return AJA_STATUS_RANGE;}
+	const uint32_t	numU32s (GetIPTransmitDataU32Count());
+	if (!pOutU32s  ||  inMaxU32s < numU32s)
+		return AJA_STATUS_BAD_PARAM;
+
+	//	My first 32-bit longword is the Anc packet header, which contains location info...
+	uint32_t *	pU32	(pOutU32s);
+	*pU32++ = AJARTPAncPacketHeader(GetDataLocation()).GetULWord();
+
+	//	Gather my 10-bit even-parity DID/SID/DC/UDWs/CS values, zero-padded to a multiple of 16...
+	uint16_t		UDWs[16 * 17];	//	255 UDWs + DID + SID + DC + CS = 259 max, rounded up to a multiple of 16
+	const uint32_t	dc			(GetDC());
+	const uint32_t	numUDWs		(dc + 4);
+	const uint8_t *	pPayload	(GetPayloadData());
+	uint16_t		sum			(0);
+	UDWs[0] = gEvenParityTable[m_DID];	//	Same as AddEvenParity, but inlined
+	UDWs[1] = gEvenParityTable[m_SID];
+	UDWs[2] = gEvenParityTable[uint8_t(dc)];
+	for (uint32_t ndx(0);  ndx < dc;  ndx++)
+		UDWs[3 + ndx] = gEvenParityTable[pPayload[ndx]];
+	for (uint32_t ndx(0);  ndx < numUDWs - 1;  ndx++)
+		sum += UDWs[ndx];
+	//	SMPTE 291-1:2011:	6.7 Checksum Word (same as Calculate9BitChecksum)
+	UDWs[numUDWs - 1] = (sum & 0x1FF) | ((sum & 0x100) ? 0x000 : 0x200);
+	for (uint32_t ndx(numUDWs);  ndx & 0xF;  ndx++)
+		UDWs[ndx] = 0;
+
+	//	All subsequent 32-bit longwords hold those 10-bit values packed MSB-first, 16 values per 5 longwords...
+	const uint32_t * const	pEnd	(pOutU32s + numU32s);
+	for (uint32_t ndx(0);  ndx < numUDWs;  ndx += 16)
+	{
+		const uint16_t *	v		(UDWs + ndx);
+		const uint32_t		u32s[5] = {	(uint32_t(v[ 0]) << 22) | (uint32_t(v[ 1]) << 12) | (uint32_t(v[ 2]) <<  2) | (uint32_t(v[ 3]) >> 8),
+										(uint32_t(v[ 3]) << 24) | (uint32_t(v[ 4]) << 14) | (uint32_t(v[ 5]) <<  4) | (uint32_t(v[ 6]) >> 6),
+										(uint32_t(v[ 6]) << 26) | (uint32_t(v[ 7]) << 16) | (uint32_t(v[ 8]) <<  6) | (uint32_t(v[ 9]) >> 4),
+										(uint32_t(v[ 9]) << 28) | (uint32_t(v[10]) << 18) | (uint32_t(v[11]) <<  8) | (uint32_t(v[12]) >> 2),
+										(uint32_t(v[12]) << 30) | (uint32_t(v[13]) << 20) | (uint32_t(v[14]) << 10) |  uint32_t(v[15])		};
+		for (unsigned n(0);  n < 5	&&	pU32 < pEnd;  n++)	//	The last group's zero-padded tail is dropped
+			*pU32++ = ENDIAN_32HtoN(u32s[n]);
+	}
+
+	outU32Count = uint32_t(pU32 - pOutU32s);
+	NTV2_ASSERT(outU32Count == numU32s);
+	return AJA_STATUS_SUCCESS;
+}	//	WriteIPTransmitData
+
+
 AJAStatus AJAAncillaryData::InitWithReceivedData (const ULWordSequence & inU32s, uint16_t & inOutU32Ndx, const bool inIgnoreChecksum)
 {
 	const size_t	numU32s (inU32s.size());
@@ -1597,42 +1645,6 @@ bool AJAAncillaryData::operator == (const AJAAncillaryData & inRHS) const
 //	Returns the original data byte in bits 7:0, plus even parity in bit 8 and ~bit 8 in bit 9
 uint16_t AJAAncillaryData::AddEvenParity (const uint8_t inDataByte)
 {
-	// Parity Table
-	static const uint16_t gEvenParityTable[256] =
-	{
-		/* 0-7 */		0x200,0x101,0x102,0x203,0x104,0x205,0x206,0x107,
-		/* 8-15 */		0x108,0x209,0x20A,0x10B,0x20C,0x10D,0x10E,0x20F,
-		/* 16-23 */		0x110,0x211,0x212,0x113,0x214,0x115,0x116,0x217,
-		/* 24-31 */		0x218,0x119,0x11A,0x21B,0x11C,0x21D,0x21E,0x11F,
-		/* 32-39 */		0x120,0x221,0x222,0x123,0x224,0x125,0x126,0x227,
-		/* 40-47 */		0x228,0x129,0x12A,0x22B,0x12C,0x22D,0x22E,0x12F,
-		/* 48-55 */		0x230,0x131,0x132,0x233,0x134,0x235,0x236,0x137,
-		/* 56-63 */		0x138,0x239,0x23A,0x13B,0x23C,0x13D,0x13E,0x23F,
-		/* 64-71 */		0x140,0x241,0x242,0x143,0x244,0x145,0x146,0x247,
-		/* 72-79 */		0x248,0x149,0x14A,0x24B,0x14C,0x24D,0x24E,0x14F,
-		/* 80-87 */		0x250,0x151,0x152,0x253,0x154,0x255,0x256,0x157,
-		/* 88-95 */		0x158,0x259,0x25A,0x15B,0x25C,0x15D,0x15E,0x25F,
-		/* 96-103 */	0x260,0x161,0x162,0x263,0x164,0x265,0x266,0x167,
-		/* 104-111 */	0x168,0x269,0x26A,0x16B,0x26C,0x16D,0x16E,0x26F,
-		/* 112-119 */	0x170,0x271,0x272,0x173,0x274,0x175,0x176,0x277,
-		/* 120-127 */	0x278,0x179,0x17A,0x27B,0x17C,0x27D,0x27E,0x17F,
-		/* 128-135 */	0x180,0x281,0x282,0x183,0x284,0x185,0x186,0x287,
-		/* 136-143 */	0x288,0x189,0x18A,0x28B,0x18C,0x28D,0x28E,0x18F,
-		/* 144-151 */	0x290,0x191,0x192,0x293,0x194,0x295,0x296,0x197,
-		/* 152-159 */	0x198,0x299,0x29A,0x19B,0x29C,0x19D,0x19E,0x29F,
-		/* 160-167 */	0x2A0,0x1A1,0x1A2,0x2A3,0x1A4,0x2A5,0x2A6,0x1A7,
-		/* 168-175 */	0x1A8,0x2A9,0x2AA,0x1AB,0x2AC,0x1AD,0x1AE,0x2AF,
-		/* 176-183 */	0x1B0,0x2B1,0x2B2,0x1B3,0x2B4,0x1B5,0x1B6,0x2B7,
-		/* 184-191 */	0x2B8,0x1B9,0x1BA,0x2BB,0x1BC,0x2BD,0x2BE,0x1BF,
-		/* 192-199 */	0x2C0,0x1C1,0x1C2,0x2C3,0x1C4,0x2C5,0x2C6,0x1C7,
-		/* 200-207 */	0x1C8,0x2C9,0x2CA,0x1CB,0x2CC,0x1CD,0x1CE,0x2CF,
-		/* 208-215 */	0x1D0,0x2D1,0x2D2,0x1D3,0x2D4,0x1D5,0x1D6,0x2D7,
-		/* 216-223 */	0x2D8,0x1D9,0x1DA,0x2DB,0x1DC,0x2DD,0x2DE,0x1DF,
-		/* 224-231 */	0x1E0,0x2E1,0x2E2,0x1E3,0x2E4,0x1E5,0x1E6,0x2E7,
-		/* 232-239 */	0x2E8,0x1E9,0x1EA,0x2EB,0x1EC,0x2ED,0x2EE,0x1EF,
-		/* 240-247 */	0x2F0,0x1F1,0x1F2,0x2F3,0x1F4,0x2F5,0x2F6,0x1F7,
-		/* 248-255 */	0x1F8,0x2F9,0x2FA,0x1FB,0x2FC,0x1FD,0x1FE,0x2FF
-	};	//	gEvenParityTable
 	return gEvenParityTable[inDataByte];
 }
 
@@ -1770,6 +1782,71 @@ bool AJAAncillaryData::GetAncPacketsFromVANCLine (const UWordSequence &				inYUV
 }	//	GetAncPacketsFromVANCLine
 
 
+//	Answers with component 'inNdx' of a 'v210' line
+static inline uint16_t V210Component (const uint32_t * pInLine, const uint32_t inNdx)
+{
+	return uint16_t((pInLine[inNdx / 3] >> (10 * (inNdx % 3))) & 0x3FF);
+}
+
+bool AJAAncillaryData::GetAncPacketsFromV210VANCLine (const void *					pInV210Line,
+														const uint32_t					inNumPixels,
+														const AncChannelSearchSelect	inChanSelect,
+														U16Packets &					outRawPackets,
+														UWordSequence &					outWordOffsets)
+{
+	const uint32_t *	pLine		(reinterpret_cast<const uint32_t*>(pInV210Line));
+	const uint32_t		numComps	(inNumPixels * 2);
+	const uint32_t		numWords	((numComps + 2) / 3);
+	const uint32_t		searchIncr	(inChanSelect == AncChannelSearch_Both ? 1 : 2);
+
+	outRawPackets.clear();
+	outWordOffsets.clear();
+
+	if (!pLine)
+		{LOGMYERROR("NULL line pointer"); return false;}
+	if (!IS_VALID_AncChannelSearchSelect(inChanSelect))
+		{LOGMYERROR("Bad search select value " << DEC(inChanSelect)); return false;}	//	bad search select
+	if (numComps < 12)
+		{LOGMYERROR("Line width " << DEC(inNumPixels) << " too small"); return false;}	//	too small
+
+	//	Only words having a 0x000 component can start a packet -- let the vector search skip the rest...
+	U16Packet	packet;
+	for (uint32_t word(::AJA_Find10BitYCbCrZeroWord(pLine, numWords));  word < numWords;  word = ::AJA_Find10BitYCbCrZeroWord(pLine, numWords, word + 1))
+		for (uint32_t comp(word * 3);  comp < (word * 3 + 3)  &&  (comp + 12) < numComps;  comp++)	//	Same limit as GetAncPacketsFromVANCLine
+		{
+			if ((inChanSelect == AncChannelSearch_Y  &&  !(comp & 1))  ||  (inChanSelect == AncChannelSearch_C  &&  (comp & 1)))
+				continue;	//	Wrong channel
+			if (V210Component(pLine, comp) != 0x000  ||  V210Component(pLine, comp + searchIncr) != 0x3FF
+				||  V210Component(pLine, comp + 2 * searchIncr) != 0x3FF)
+					continue;	//	Not an ancillary data flag
+
+			//	Total words in ANC packet: 6 header words + data count + checksum word...
+			const uint32_t	totalCount	(6  +  (V210Component(pLine, comp + 5 * searchIncr) & 0xFF)  +  1);
+			if ((comp + (totalCount - 1) * searchIncr) >= numComps  ||  (comp + totalCount) >= numComps)
+			{
+				LOGMYDEBUG ("past end of line: " << comp << " + " << totalCount << " >= " << numComps);
+				return false;	//	Past end of line buffer
+			}
+			packet.resize(totalCount);
+			for (uint32_t ndx(0);  ndx < totalCount;  ndx++)
+				packet[ndx] = V210Component(pLine, comp + ndx * searchIncr);
+			if (CheckAncParityAndChecksum (packet, 0, uint16_t(totalCount), 1))
+				return false;	//	Parity/Checksum error
+
+			outRawPackets.push_back(packet);
+			outWordOffsets.push_back(UWord(comp));
+			LOGMYINFO ("Found ANC packet in " << ::AncChannelSearchSelectToString(inChanSelect)
+							<< ": DID=" << xHEX0N(packet[3],4)
+							<< " SDID=" << xHEX0N(packet[4],4)
+							<< " word=" << comp
+							<< " DC=" << packet[5]
+							<< " pix=" << (comp / searchIncr));
+		}	//	for each component in the word
+	return true;
+
+}	//	GetAncPacketsFromV210VANCLine
+
+
 bool AJAAncillaryData::Unpack8BitYCbCrToU16sVANCLine (const void * pInYUV8Line,
 														UWordSequence & outU16YUVLine,
 														const uint32_t inNumPixels)
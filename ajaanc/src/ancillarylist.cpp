@@ -7,16 +7,26 @@
 
 #include "ancillarylist.h"
 #include "ancillarydatafactory.h"
+#include "ancillarydata_timecode_atc.h"
+#include "ancillarydata_timecode_vitc.h"
+#include "ancillarydata_cea708.h"
+#include "ancillarydata_cea608_vanc.h"
+#include "ancillarydata_cea608_line21.h"
+#include "ancillarydata_framestatusinfo524D.h"
+#include "ancillarydata_framestatusinfo5251.h"
+#include "ancillarydata_hdmi_aux.h"
 #include "ajabase/system/debug.h"
 #include "ajantv2/includes/ntv2utils.h"
 #include "ajabase/system/atomic.h"
 #include "ajabase/system/lock.h"
+#include "ajabase/common/pixelkernels.h"
 #if defined (AJALinux)
 	#include <string.h>		//	For memcpy
 #endif	//	AJALinux
 #if defined(AJAANCLISTIMPL_VECTOR)
 	#include <algorithm>
 #endif
+#include <typeinfo>
 
 using namespace std;
 
@@ -148,7 +158,10 @@ AJAAncillaryList::AJAAncillaryList ()
 	:	m_ancList		(),
 		m_rcvMultiRTP	(true),		//	By default, handle receiving multiple RTP packets
 		m_xmitMultiRTP	(false),	//	By default, transmit single RTP packet
-		m_ignoreCS		(false)
+		m_ignoreCS		(false),
+		m_recyclePkts	(false),	//	By default, Clear deletes packets
+		m_spares		(),
+		m_pRawPkt		(AJA_NULL)
 {
 	Clear();
 	SetAnalogAncillaryDataTypeForLine (20, AJAAncDataType_Cea608_Line21);
@@ -162,6 +175,7 @@ AJAAncillaryList::AJAAncillaryList ()
 
 AJAAncillaryList::~AJAAncillaryList ()
 {
+	SetPacketRecycling(false);	//	Frees spares
 	Clear();
 }
 
@@ -359,18 +373,90 @@ AJAStatus AJAAncillaryList::Clear (void)
 		AJAAncillaryData * pAncData(*it);
 		if (pAncData)
 		{
-			delete pAncData;
+			DisposePacket(pAncData);
 			numDeleted++;
 		}
 	}
 
 	m_ancList.clear();
 	if (oldSize || numDeleted)
-		LOGMYDEBUG(numDeleted << " packet(s) deleted -- list emptied");
+		LOGMYDEBUG(numDeleted << " packet(s) " << (IsRecyclingPackets() ? "recycled" : "deleted") << " -- list emptied");
 	return AJA_STATUS_SUCCESS;
 }
 
 
+void AJAAncillaryList::SetPacketRecycling (const bool inRecycle)
+{
+	m_recyclePkts = inRecycle;
+	if (inRecycle)
+	{
+		if (!m_pRawPkt)
+			m_pRawPkt = new AJAAncillaryData;
+		return;
+	}
+	for (AJAAncDataListConstIter it (m_spares.begin());  it != m_spares.end();  ++it)
+		delete *it;
+	m_spares.clear();
+	delete m_pRawPkt;
+	m_pRawPkt = AJA_NULL;
+}
+
+
+//	Answers true if the given (cleared) packet's class is the very one that AJAAncillaryDataFactory::Create
+//	instantiates for its type -- i.e. it can stand in for any new packet of that type...
+static bool IsFactoryClass (const AJAAncillaryData & inPacket)
+{
+	const type_info &	pktClass (typeid(inPacket));
+	switch (inPacket.GetAncillaryDataType())
+	{
+		case AJAAncDataType_Unknown:				return pktClass == typeid(AJAAncillaryData);
+		case AJAAncDataType_Timecode_ATC:			return pktClass == typeid(AJAAncillaryData_Timecode_ATC);
+		case AJAAncDataType_Timecode_VITC:			return pktClass == typeid(AJAAncillaryData_Timecode_VITC);
+		case AJAAncDataType_Cea708:					return pktClass == typeid(AJAAncillaryData_Cea708);
+		case AJAAncDataType_Cea608_Vanc:			return pktClass == typeid(AJAAncillaryData_Cea608_Vanc);
+		case AJAAncDataType_Cea608_Line21:			return pktClass == typeid(AJAAncillaryData_Cea608_Line21);
+		case AJAAncDataType_FrameStatusInfo524D:	return pktClass == typeid(AJAAncillaryData_FrameStatusInfo524D);
+		case AJAAncDataType_FrameStatusInfo5251:	return pktClass == typeid(AJAAncillaryData_FrameStatusInfo5251);
+		case AJAAncDataType_HDMI_Aux:				return pktClass == typeid(AJAAncillaryData_HDMI_Aux);
+		default:									break;
+	}
+	return false;
+}
+
+
+AJAAncillaryData * AJAAncillaryList::NewPacket (const AJAAncDataType inAncType, const AJAAncillaryData & inRawPacket)
+{
+	for (AJAAncDataListIter it (m_spares.begin());  it != m_spares.end();  ++it)
+		if ((*it)->GetAncillaryDataType() == inAncType)
+		{
+			AJAAncillaryData * pPacket (*it);
+			m_spares.erase(it);
+			pPacket->RecycleFrom(inRawPacket);
+			return pPacket;
+		}
+	return AJAAncillaryDataFactory::Create (inAncType, inRawPacket);
+}
+
+
+void AJAAncillaryList::DisposePacket (AJAAncillaryData * pInPacket)
+{
+	if (!pInPacket)
+		return;
+	if (IsRecyclingPackets())
+	{
+		pInPacket->Clear();
+		if (IsFactoryClass(*pInPacket))
+			try
+			{
+				m_spares.push_back(pInPacket);
+				return;
+			}
+			catch (...)	{}
+	}
+	delete pInPacket;
+}
+
+
 AJAStatus AJAAncillaryList::RemoveAncillaryData (AJAAncillaryData * pAncData)
 {
 	if (!pAncData)
@@ -572,7 +658,8 @@ AJAStatus AJAAncillaryList::AddReceivedAncillaryData (const uint8_t * pRcvData,
 		return AJA_STATUS_NULL;
 
 	//	Use this as an uninitialized template...
-	AJAAncillaryData	newAncData;
+	AJAAncillaryData	localAncData;
+	AJAAncillaryData &	newAncData		(RawPacket() ? *RawPacket() : localAncData);
 	AJAAncDataLoc		defaultLoc		(AJAAncDataLink_A, AJAAncDataChannel_Y, AJAAncDataSpace_VANC, 9);
 	int32_t				remainingSize	(int32_t(dataSize + 0));
 	const uint8_t *		pInputData		(pRcvData);
@@ -641,18 +728,22 @@ AJAStatus AJAAncillaryList::AddReceivedAncillaryData (const uint8_t * pRcvData,
 		if (bInsertNew)
 		{
 			//	Create an AJAAncillaryData object of the appropriate type, and init it with our raw data...
-			AJAAncillaryData *	pData	(AJAAncillaryDataFactory::Create (newAncType, &newAncData));
+			AJAAncillaryData *	pData	(NewPacket (newAncType, newAncData));
 			if (pData)
 			{
 				pData->SetBufferFormat(AJAAncBufferFormat_SDI);
+				if (inFrameNum	&&	!pData->GetFrameID())
+					pData->SetFrameID(inFrameNum);
 				if (IsIncludingZeroLengthPackets()	||	pData->GetDC())
 				{
 					try {m_ancList.push_back(pData);}	//	Append to my list
-					catch(...)	{status = AJA_STATUS_FAIL;}
+					catch(...)	{DisposePacket(pData);  status = AJA_STATUS_FAIL;}
+				}
+				else
+				{
+					::BumpZeroLengthPacketCount();
+					DisposePacket(pData);	//	Don't leak zero-length packets
 				}
-				else ::BumpZeroLengthPacketCount();
-				if (inFrameNum	&&	!pData->GetFrameID())
-					pData->SetFrameID(inFrameNum);
 			}
 			else
 				status = AJA_STATUS_FAIL;
@@ -681,7 +772,8 @@ AJAStatus AJAAncillaryList::AddReceivedAuxillaryData (const uint8_t * pRcvData,
 		return AJA_STATUS_NULL;
 
 	//	Use this as an uninitialized template...
-	AJAAncillaryData	newAncData;
+	AJAAncillaryData	localAncData;
+	AJAAncillaryData &	newAncData		(RawPacket() ? *RawPacket() : localAncData);
 	//AJAAncDataLoc		defaultLoc		(AJAAncDataLink_A, AJAAncDataChannel_Y, AJAAncDataSpace_VANC, 9);
 	int32_t				remainingSize	(int32_t(dataSize + 0));
 	const uint8_t *		pInputData		(pRcvData);
@@ -703,18 +795,22 @@ AJAStatus AJAAncillaryList::AddReceivedAuxillaryData (const uint8_t * pRcvData,
 			break;		//	Nothing to do
 		
 		//	Create an AJAAncillaryData object of the appropriate type, and init it with our raw data...
-		AJAAncillaryData *	pData	(AJAAncillaryDataFactory::Create (newAncType, &newAncData));
+		AJAAncillaryData *	pData	(NewPacket (newAncType, newAncData));
 		if (pData)
 		{
 			pData->SetBufferFormat(AJAAncBufferFormat_HDMI);
+			if (inFrameNum	&&	!pData->GetFrameID())
+				pData->SetFrameID(inFrameNum);
 			if (IsIncludingZeroLengthPackets()	||	pData->GetDC())
 			{
 				try {m_ancList.push_back(pData);}	//	Append to my list
-				catch(...)	{status = AJA_STATUS_FAIL;}
+				catch(...)	{DisposePacket(pData);  status = AJA_STATUS_FAIL;}
+			}
+			else
+			{
+				::BumpZeroLengthPacketCount();
+				DisposePacket(pData);	//	Don't leak zero-length packets
 			}
-			else ::BumpZeroLengthPacketCount();
-			if (inFrameNum	&&	!pData->GetFrameID())
-				pData->SetFrameID(inFrameNum);
 		}
 		else
 			status = AJA_STATUS_FAIL;
@@ -767,15 +863,16 @@ LOGMYDEBUG(RTPheader);
 	//	Parse each anc pkt in the RTP pkt...
 	uint16_t	u32Ndx	(5);	//	First Anc packet starts at ULWord[5]
 	unsigned	pktNum	(0);
+	AJAAncillaryData	localPkt;
+	AJAAncillaryData &	tempPkt	(RawPacket() ? *RawPacket() : localPkt);
 	for (;	pktNum < numPackets	 &&	 AJA_SUCCESS(status);  pktNum++)
 	{
-		AJAAncillaryData	tempPkt;
 		status = tempPkt.InitWithReceivedData(inReceivedData, u32Ndx, IgnoreChecksumErrors());
 		if (AJA_FAILURE(status))
 			continue;
 
 		const AJAAncDataType newAncType (AJAAncillaryDataFactory::GuessAncillaryDataType(tempPkt));
-		AJAAncillaryData *	pNewPkt (AJAAncillaryDataFactory::Create (newAncType, tempPkt));
+		AJAAncillaryData *	pNewPkt (NewPacket (newAncType, tempPkt));
 		if (!pNewPkt)
 			{status = AJA_STATUS_NULL;	continue;}
 
@@ -784,9 +881,13 @@ LOGMYDEBUG(RTPheader);
 		if (IsIncludingZeroLengthPackets()	||	pNewPkt->GetDC())
 		{
 			try {m_ancList.push_back(pNewPkt);	pktsAdded++;}	//	Append to my list
-			catch(...)	{status = AJA_STATUS_FAIL;}
+			catch(...)	{DisposePacket(pNewPkt);  status = AJA_STATUS_FAIL;}
+		}
+		else
+		{
+			::BumpZeroLengthPacketCount();
+			DisposePacket(pNewPkt);	//	Don't leak zero-length packets
 		}
-		else ::BumpZeroLengthPacketCount();
 	}	//	for each anc packet
 
 	if (AJA_FAILURE(status))
@@ -858,14 +959,15 @@ AJAStatus AJAAncillaryList::AddVANCData (const UWordSequence & inPacketWords, co
 	AJAAncDataType		newAncType	(AJAAncDataType_Unknown);
 	AJAAncillaryData *	pData		(AJA_NULL);
 	{
-		AJAAncillaryData	pkt;
+		AJAAncillaryData	localPkt;
+		AJAAncillaryData &	pkt	(RawPacket() ? *RawPacket() : localPkt);
 		status = pkt.InitWithReceivedData (gumpPacketData, inLocation);
 		if (AJA_FAILURE(status))
 			return status;
 		pkt.SetBufferFormat(AJAAncBufferFormat_FBVANC);
 
 		newAncType = AJAAncillaryDataFactory::GuessAncillaryDataType(pkt);
-		pData = AJAAncillaryDataFactory::Create(newAncType, pkt);
+		pData = NewPacket(newAncType, pkt);
 		if (!pData)
 			return AJA_STATUS_FAIL;
 	}
@@ -873,7 +975,7 @@ AJAStatus AJAAncillaryList::AddVANCData (const UWordSequence & inPacketWords, co
 	if (IsIncludingZeroLengthPackets()	||	pData->GetDC())
 	{
 		try {m_ancList.push_back(pData);}	//	Append to my list, I now own the instance
-		catch(...)	{delete pData;  return AJA_STATUS_FAIL;}
+		catch(...)	{DisposePacket(pData);  return AJA_STATUS_FAIL;}
 
 		if (inFrameNum	&&	pData->GetDID())
 			pData->SetFrameID(inFrameNum);
@@ -881,7 +983,7 @@ AJAStatus AJAAncillaryList::AddVANCData (const UWordSequence & inPacketWords, co
 	else
 	{
 		::BumpZeroLengthPacketCount();
-		delete pData;	//	Don't leak zero-length packets
+		DisposePacket(pData);	//	Don't leak zero-length packets
 	}
 	return AJA_STATUS_SUCCESS;
 
@@ -893,88 +995,8 @@ AJAStatus AJAAncillaryList::SetFromVANCData (const NTV2Buffer &				inFrameBuffer
 											AJAAncillaryList &				outPackets,
 											const uint32_t					inFrameNum)
 {
-	outPackets.Clear();
-
-	if (inFrameBuffer.IsNULL())
-	{
-		LOGMYERROR("AJA_STATUS_NULL: NULL frame buffer pointer");
-		return AJA_STATUS_NULL;
-	}
-	if (!inFormatDesc.IsValid())
-	{
-		LOGMYERROR("AJA_STATUS_BAD_PARAM: bad NTV2FormatDescriptor");
-		return AJA_STATUS_BAD_PARAM;
-	}
-	if (!inFormatDesc.IsVANC())
-	{
-		LOGMYERROR("AJA_STATUS_BAD_PARAM: format descriptor has no VANC lines");
-		return AJA_STATUS_BAD_PARAM;
-	}
-
-	const ULWord			vancBytes	(inFormatDesc.GetTotalRasterBytes() - inFormatDesc.GetVisibleRasterBytes());
-	const NTV2PixelFormat	fbf			(inFormatDesc.GetPixelFormat());
-	const bool				isSD		(NTV2_IS_SD_STANDARD(inFormatDesc.GetVideoStandard()));
-	if (inFrameBuffer.GetByteCount() < vancBytes)
-	{
-		LOGMYERROR("AJA_STATUS_FAIL: " << inFrameBuffer.GetByteCount() << "-byte frame buffer smaller than " << vancBytes << "-byte VANC region");
-		return AJA_STATUS_FAIL;
-	}
-	if (fbf != NTV2_FBF_10BIT_YCBCR	 &&	 fbf != NTV2_FBF_8BIT_YCBCR)
-	{
-		LOGMYERROR("AJA_STATUS_UNSUPPORTED: frame buffer format " << ::NTV2FrameBufferFormatToString(fbf) << " not '2vuy' nor 'v210'");
-		return AJA_STATUS_UNSUPPORTED;	//	Only 'v210' and '2vuy' currently supported
-	}
-
-	for (ULWord lineOffset (0);	 lineOffset < inFormatDesc.GetFirstActiveLine();  lineOffset++)
-	{
-		UWordSequence	uwords;
-		bool			isF2			(false);
-		ULWord			smpteLineNum	(0);
-		unsigned		ndx				(0);
-		const AJAAncDataLink	defaultLink (AJAAncDataLink_A);	//	This is most common
-
-		inFormatDesc.GetSMPTELineNumber (lineOffset, smpteLineNum, isF2);
-		if (fbf == NTV2_FBF_10BIT_YCBCR)
-			::UnpackLine_10BitYUVtoUWordSequence (inFormatDesc.GetRowAddress(inFrameBuffer.GetHostAddress(0), lineOffset),
-													inFormatDesc, uwords);
-		else
-			AJAAncillaryData::Unpack8BitYCbCrToU16sVANCLine (inFormatDesc.GetRowAddress(inFrameBuffer.GetHostAddress(0), lineOffset),
-															uwords,	 inFormatDesc.GetRasterWidth());
-		if (isSD)
-		{
-			AJAAncillaryData::U16Packets	ycPackets;
-			UWordSequence					ycHOffsets;
-			AJAAncDataLoc					loc (defaultLink, AJAAncDataChannel_Both, AJAAncDataSpace_VANC, uint16_t(smpteLineNum));
-
-			AJAAncillaryData::GetAncPacketsFromVANCLine (uwords, AncChannelSearch_Both, ycPackets, ycHOffsets);
-			NTV2_ASSERT(ycPackets.size() == ycHOffsets.size());
-
-			for (AJAAncillaryData::U16Packets::const_iterator it(ycPackets.begin());  it != ycPackets.end();  ++it, ndx++)
-				outPackets.AddVANCData (*it, loc.SetHorizontalOffset(ycHOffsets[ndx]), inFrameNum);
-		}
-		else
-		{
-			AJAAncillaryData::U16Packets	yPackets, cPackets;
-			UWordSequence					yHOffsets, cHOffsets;
-			AJAAncDataLoc					yLoc	(defaultLink, AJAAncDataChannel_Y, AJAAncDataSpace_VANC, uint16_t(smpteLineNum));
-			AJAAncDataLoc					cLoc	(defaultLink, AJAAncDataChannel_C, AJAAncDataSpace_VANC, uint16_t(smpteLineNum));
-			//cerr << endl << "SetFromVANCData: +" << DEC0N(lineOffset,2) << ": ";	inFormatDesc.PrintSMPTELineNumber(cerr, lineOffset);  cerr << ":" << endl << uwords << endl;
-			AJAAncillaryData::GetAncPacketsFromVANCLine (uwords, AncChannelSearch_Y, yPackets, yHOffsets);
-			AJAAncillaryData::GetAncPacketsFromVANCLine (uwords, AncChannelSearch_C, cPackets, cHOffsets);
-			NTV2_ASSERT(yPackets.size() == yHOffsets.size());
-			NTV2_ASSERT(cPackets.size() == cHOffsets.size());
-
-			unsigned	ndxx(0);
-			for (AJAAncillaryData::U16Packets::const_iterator it(yPackets.begin());	 it != yPackets.end();	++it, ndxx++)
-				outPackets.AddVANCData (*it, yLoc.SetHorizontalOffset(yHOffsets[ndxx]), inFrameNum);
-
-			ndxx = 0;
-			for (AJAAncillaryData::U16Packets::const_iterator it(cPackets.begin());	 it != cPackets.end();	++it, ndxx++)
-				outPackets.AddVANCData (*it, cLoc.SetHorizontalOffset(cHOffsets[ndxx]), inFrameNum);
-		}
-	}	//	for each VANC line
-	LOGMYDEBUG("returning " << outPackets);
-	return AJA_STATUS_SUCCESS;
+	AJAAncVANCScanner scanner;
+	return scanner.Scan (inFrameBuffer, inFormatDesc, outPackets, inFrameNum);
 }
 
 //	STATIC
@@ -1602,38 +1624,173 @@ AJAStatus AJAAncillaryList::WriteRTPPackets (NTV2Buffer & theBuffer,	uint32_t &
 }
 
 
+//	Writes one 5 x U32 RTP packet header at the given U32 offset...
+static bool PutRTPHeader (NTV2Buffer & theBuffer,  const ULWord inU32Offset,  const ULWord inContentU32s,  const uint32_t inAncCount,
+							const bool inIsF2,	const bool inIsProgressive,  const bool inIsLastRTPPkt)
+{
+	AJARTPAncPayloadHeader	RTPHeader;
+	if (inIsProgressive)
+		RTPHeader.SetProgressive();
+	else if (inIsF2)
+		RTPHeader.SetField2();
+	else
+		RTPHeader.SetField1();
+	RTPHeader.SetEndOfFieldOrFrame(inIsLastRTPPkt);
+	RTPHeader.SetAncPacketCount(uint8_t(inAncCount));
+	RTPHeader.SetPayloadLength(uint16_t(inContentU32s * sizeof(uint32_t)));
+	//	Playout:  Firmware looks for full RTP pkt bytecount in LS 16 bits of SequenceNumber in RTP header:
+	RTPHeader.SetSequenceNumber(uint32_t(AJARTPAncPayloadHeader::GetHeaderByteCount() + inContentU32s * sizeof(uint32_t)) & 0x0000FFFF);
+	return RTPHeader.WriteToBuffer(theBuffer, inU32Offset);
+}
+
+
+AJAStatus AJAAncillaryList::WriteRTPField (NTV2Buffer & theBuffer,  uint32_t & outBytesWritten,
+											const bool inIsF2,	const bool inIsProgressive,  const uint32_t inF2StartLine)
+{
+	const ULWord	hdrU32s		(ULWord(AJARTPAncPayloadHeader::GetHeaderWordCount()));
+	const ULWord	maxU32s		(theBuffer ? ULWord(theBuffer.GetByteCount() / sizeof(uint32_t)) : 0);
+	uint32_t *		pU32s		(theBuffer ? reinterpret_cast<uint32_t*>(theBuffer.GetHostPointer()) : AJA_NULL);
+	const bool		isMultiRTP	(AllowMultiRTPTransmit());
+	const string	sFld		(inIsF2 ? " F2" : " F1");
+	AJAStatus		result		(AJA_STATUS_SUCCESS);
+	ULWord			u32offset	(0);	//	The "write head"
+	ULWord			hdrOffset	(0);	//	Where the current RTP packet's header goes (written when the packet is closed)
+	ULWord			contentU32s (0);	//	Current RTP packet's content size, in U32s
+	uint32_t		rtpAncCount (0);	//	SMPTE Anc packets in the current RTP packet
+	uint32_t		fldAncCount (0);	//	SMPTE Anc packets in this field
+	ULWord			numRTPPkts	(0);
+	bool			isRTPPktOpen(false);
+	unsigned		pktNum		(0);
+	unsigned		countOverflows	(0);
+	size_t			overflowWords	(0);
+
+	outBytesWritten = 0;
+	if (!isMultiRTP)
+	{	//	SINGLE RTP PKT -- always present, even if empty
+		isRTPPktOpen = true;
+		u32offset = hdrU32s;
+	}
+
+	//	Write each of my SMPTE Anc packets that belong to this field...
+	for (AJAAncDataListConstIter it(m_ancList.begin());	 it != m_ancList.end();	 ++it)
+	{
+		pktNum++;
+		AJAAncillaryData *	pAncData (*it);
+		if (!pAncData)
+			return AJA_STATUS_NULL; //	Fail
+
+		AJAAncillaryData &	pkt (*pAncData);
+		if (!pkt.IsDigital())
+			continue;	//	Skip analog/raw packets
+		if (inIsF2 != (!inIsProgressive	 &&	 pkt.GetLocationLineNumber() >= inF2StartLine))
+			continue;	//	Other field
+		if (fldAncCount >= MAX_ANC_PKTS_PER_RTP_PKT)
+		{
+			countOverflows++;
+			LOGMYDEBUG("Skipped pkt " << DEC(pktNum) << " of " << DEC(CountAncillaryData()) << "," << sFld << " RTP pkt count overflow: " << pkt.AsString(16));
+			continue;
+		}
+
+		pkt.GeneratePayloadData();
+		if (pkt.GetDC() > 255)
+			{result = AJA_STATUS_RANGE;  break;}	//	Bail!
+		const ULWord	pktU32s (pkt.GetIPTransmitDataU32Count());
+		if ((isMultiRTP ? 0 : contentU32s) + pktU32s > MAX_RTP_PKT_LENGTH_WORDS)
+		{
+			overflowWords += pktU32s;
+			LOGMYDEBUG("Skipped pkt " << DEC(pktNum) << " of " << DEC(CountAncillaryData()) << ":" << sFld << " RTP pkt length overflow: " << pkt.AsString(16));
+			continue;
+		}
+
+		if (isMultiRTP)
+		{	//	MULTI RTP PKTS -- close the previous RTP packet (if any), and start a new one
+			if (isRTPPktOpen)
+			{
+				if (pU32s)
+					PutRTPHeader (theBuffer, hdrOffset, contentU32s, rtpAncCount, inIsF2, inIsProgressive, /*isLast*/false);
+				numRTPPkts++;
+				if (u32offset & 1L)		//	Next RTP packet must start on a 64-bit/8-byte boundary
+				{
+					if (pU32s  &&  u32offset < maxU32s)
+						pU32s[u32offset] = 0;
+					u32offset++;
+				}
+			}
+			hdrOffset = u32offset;
+			u32offset += hdrU32s;
+			contentU32s = rtpAncCount = 0;
+			isRTPPktOpen = true;
+		}
+
+		//	Write the SMPTE Anc packet straight into theBuffer...
+		if (pU32s)
+		{
+			uint32_t	numU32s (0);
+			if (u32offset + pktU32s > maxU32s)
+				{LOGMYERROR("Buffer " << theBuffer << " too small for " << DEC(pktU32s) << " U32s at u32offset=" << DEC(u32offset)
+							<< " for pkt " << DEC(pktNum) << " of " << DEC(CountAncillaryData()));	return AJA_STATUS_FAIL;}
+			result = pkt.WriteIPTransmitData (pU32s + u32offset,  maxU32s - u32offset,  numU32s);
+			if (AJA_FAILURE(result))
+				break;	//	Bail!
+		}
+		u32offset += pktU32s;
+		contentU32s += pktU32s;
+		rtpAncCount++;
+		fldAncCount++;
+	}	//	for each SMPTE Anc packet
+
+	if (AJA_FAILURE(result))
+		{LOGMYERROR(::AJAStatusToString(result) << ": Pkt " << DEC(pktNum) << " of " << DEC(CountAncillaryData()) << " failed");  return result;}
+
+	//	Close the last RTP packet...
+	if (isRTPPktOpen)
+	{
+		if (pU32s)
+		{
+			if (!PutRTPHeader (theBuffer, hdrOffset, contentU32s, rtpAncCount, inIsF2, inIsProgressive, /*isLast*/true))
+				{LOGMYERROR("RTP hdr WriteToBuffer failed for buffer " << theBuffer << " at u32offset=" << DEC(hdrOffset));  return AJA_STATUS_FAIL;}
+			if ((u32offset & 1L)  &&  u32offset < maxU32s)
+				pU32s[u32offset] = 0;
+		}
+		numRTPPkts++;
+		if (u32offset & 1L)
+			u32offset++;
+	}
+
+	if (overflowWords && countOverflows)
+		LOGMYWARN("Overflow: " << DEC(countOverflows) << " pkts skipped, " << DEC(overflowWords) << " U32s dropped");
+	else if (overflowWords)
+		LOGMYWARN("Data overflow: " << DEC(overflowWords) << " U32s dropped");
+	else if (countOverflows)
+		LOGMYWARN("Packet overflow: " << DEC(countOverflows) << " pkts skipped");
+	outBytesWritten = u32offset * ULWord(sizeof(uint32_t));
+	if (pU32s)
+		LOGMYDEBUG(DEC(numRTPPkts) << " RTP pkt(s), " << DEC(u32offset) << " U32s (" << DEC(outBytesWritten)
+					<< " bytes) written for" << sFld << (inIsProgressive ? " Prg" : " Int"));
+	return AJA_STATUS_SUCCESS;
+}	//	WriteRTPField
+
+
 AJAStatus AJAAncillaryList::GetIPTransmitData (NTV2Buffer & F1Buffer, NTV2Buffer & F2Buffer,
 												const bool inIsProgressive, const uint32_t inF2StartLine)
 {
-	AJAStatus		result (AJA_STATUS_SUCCESS);
-	AJAU32Pkts		F1U32Pkts, F2U32Pkts;		//	32-bit network-byte-order data
-	AJAAncPktCounts F1AncCounts, F2AncCounts;	//	Per-RTP packet anc packet counts
-	uint32_t		byteCount(0);				//	Not used
+	uint32_t	F1ByteCount(0), F2ByteCount(0);
 
 	//	I need to be in ascending line order...
-	F1Buffer.Fill(uint64_t(0));	 F2Buffer.Fill(uint64_t(0));
 	SortListByLocation();
 
-	//	Get F1 & F2 xmit RTP U32 words (and SMPTE anc packet counts for each RTP packet)...
-	result = GetRTPPackets (F1U32Pkts, F2U32Pkts, F1AncCounts, F2AncCounts, inIsProgressive, inF2StartLine);
-	if (AJA_FAILURE(result))
-		return result;
-
-	/*
-	ostringstream oss;	oss << "Anc Counts: F1=";  for (size_t ndx(0);	ndx < F1AncCounts.size();  ndx++)  oss << (ndx?"|":"[") << DEC(uint16_t(F1AncCounts.at(ndx)));
-	oss << "] F2=";	 for (size_t ndx(0);  ndx < F2AncCounts.size();	 ndx++)	 oss << (ndx?"|":"[") << DEC(uint16_t(F2AncCounts.at(ndx)));  oss << "]";
-	XMTDBG(oss.str());
-	*/
-
-	//	Write the F1 buffer...
-	result = WriteRTPPackets (F1Buffer, byteCount, F1U32Pkts, F1AncCounts, /*isF2*/false, inIsProgressive);
+	//	Write the F1 & F2 buffers...
+	AJAStatus result (WriteRTPField (F1Buffer, F1ByteCount, /*isF2*/false, inIsProgressive, inF2StartLine));
+	if (AJA_SUCCESS(result)	 &&	 !inIsProgressive)
+		result = WriteRTPField (F2Buffer, F2ByteCount, /*isF2*/true, inIsProgressive, inF2StartLine);
 	if (AJA_FAILURE(result))
-		return result;
-
-	//	Write the F2 buffer...
-	if (!inIsProgressive)
-		result = WriteRTPPackets (F2Buffer, byteCount, F2U32Pkts, F2AncCounts, /*isF2*/true, inIsProgressive);
+		{F1Buffer.Fill(uint64_t(0));  F2Buffer.Fill(uint64_t(0));	return result;}
 
+	//	Zero the unused remainders...
+	if (F1Buffer  &&  F1ByteCount < F1Buffer.GetByteCount())
+		::memset(F1Buffer.GetHostAddress(F1ByteCount), 0, F1Buffer.GetByteCount() - F1ByteCount);
+	if (F2Buffer  &&  F2ByteCount < F2Buffer.GetByteCount())
+		::memset(F2Buffer.GetHostAddress(F2ByteCount), 0, F2Buffer.GetByteCount() - F2ByteCount);
 	return result;
 
 }	//	GetIPTransmitData
@@ -1644,18 +1801,10 @@ AJAStatus AJAAncillaryList::GetIPTransmitDataLength (uint32_t & outF1ByteCount,
 {
 	outF1ByteCount = outF2ByteCount = 0;
 
-	//	Get F1 & F2 xmit RTP U32 words...
-	AJAU32Pkts		F1U32Pkts, F2U32Pkts;	//	U32 network-byte-order data
-	AJAAncPktCounts F1AncCounts, F2AncCounts;	//	Per-RTP packet anc packet counts
-	AJAStatus result (GetRTPPackets (F1U32Pkts, F2U32Pkts,	F1AncCounts, F2AncCounts,  inIsProgressive,	 inF2StartLine));
-	if (AJA_FAILURE(result))
-		return result;
-
-	NTV2Buffer	nullBuffer; //	An empty buffer tells WriteRTPPackets to just calculate byteCount...
-	result = WriteRTPPackets (nullBuffer, outF1ByteCount, F1U32Pkts, F1AncCounts, /*isF2*/false, inIsProgressive);
+	NTV2Buffer	nullBuffer; //	An empty buffer tells WriteRTPField to just calculate byteCount...
+	AJAStatus result (WriteRTPField (nullBuffer, outF1ByteCount, /*isF2*/false, inIsProgressive, inF2StartLine));
 	if (AJA_SUCCESS(result)	 &&	 !inIsProgressive)
-		result = WriteRTPPackets (nullBuffer, outF2ByteCount, F2U32Pkts, F2AncCounts, /*isF2*/true, inIsProgressive);
-
+		result = WriteRTPField (nullBuffer, outF2ByteCount, /*isF2*/true, inIsProgressive, inF2StartLine);
 	return result;
 }
 
@@ -1733,3 +1882,152 @@ AJAAncDataType AJAAncillaryList::GetAnalogAncillaryDataTypeForLine (const uint16
 	}
 	return ancType;
 }
+
+
+
+//////////////////////////////////////////////////////
+//	AJAAncVANCScanner
+//////////////////////////////////////////////////////
+
+//	Finds the packets in one VANC line -- for HD, the Y packets, then the C packets...
+static void GetVANCLinePackets (const void * pInRow, const NTV2FormatDescriptor & inFormatDesc, const ULWord inLineOffset,
+								AJAAncillaryData::U16Packets & outPackets, vector<AJAAncDataLoc> & outLocs)
+{
+	const AJAAncDataLink	defaultLink	(AJAAncDataLink_A);	//	This is most common
+	const ULWord			numPixels	(inFormatDesc.GetRasterWidth());
+	const bool				isSD		(NTV2_IS_SD_STANDARD(inFormatDesc.GetVideoStandard()));
+	bool					isF2		(false);
+	ULWord					smpteLineNum(0);
+	outPackets.clear();
+	outLocs.clear();
+	inFormatDesc.GetSMPTELineNumber (inLineOffset, smpteLineNum, isF2);
+
+	if (inFormatDesc.GetPixelFormat() == NTV2_FBF_8BIT_YCBCR)
+	{	//	Every packet starts with a 0x00 byte -- if there are none, the line is blank...
+		if (::AJA_Find8BitYCbCrZeroByte(reinterpret_cast<const uint8_t*>(pInRow), numPixels * 2) >= numPixels * 2)
+			return;
+		UWordSequence uwords;
+		AJAAncillaryData::Unpack8BitYCbCrToU16sVANCLine (pInRow, uwords, numPixels);
+		for (int chan(0);  chan < (isSD ? 1 : 2);  chan++)
+		{
+			AJAAncillaryData::U16Packets	pkts;
+			UWordSequence					hOffsets;
+			const AncChannelSearchSelect	search	(isSD ? AncChannelSearch_Both : (chan ? AncChannelSearch_C : AncChannelSearch_Y));
+			const AJAAncDataChannel			dataChan(isSD ? AJAAncDataChannel_Both : (chan ? AJAAncDataChannel_C : AJAAncDataChannel_Y));
+			AJAAncillaryData::GetAncPacketsFromVANCLine (uwords, search, pkts, hOffsets);
+			NTV2_ASSERT(pkts.size() == hOffsets.size());
+			for (size_t ndx(0);  ndx < pkts.size();  ndx++)
+			{
+				outPackets.push_back(pkts[ndx]);
+				outLocs.push_back(AJAAncDataLoc(defaultLink, dataChan, AJAAncDataSpace_VANC, uint16_t(smpteLineNum), hOffsets[ndx]));
+			}
+		}
+		return;
+	}
+
+	for (int chan(0);  chan < (isSD ? 1 : 2);  chan++)
+	{
+		AJAAncillaryData::U16Packets	pkts;
+		UWordSequence					hOffsets;
+		const AncChannelSearchSelect	search	(isSD ? AncChannelSearch_Both : (chan ? AncChannelSearch_C : AncChannelSearch_Y));
+		const AJAAncDataChannel			dataChan(isSD ? AJAAncDataChannel_Both : (chan ? AJAAncDataChannel_C : AJAAncDataChannel_Y));
+		AJAAncillaryData::GetAncPacketsFromV210VANCLine (pInRow, numPixels, search, pkts, hOffsets);
+		NTV2_ASSERT(pkts.size() == hOffsets.size());
+		for (size_t ndx(0);  ndx < pkts.size();  ndx++)
+		{
+			outPackets.push_back(pkts[ndx]);
+			outLocs.push_back(AJAAncDataLoc(defaultLink, dataChan, AJAAncDataSpace_VANC, uint16_t(smpteLineNum), hOffsets[ndx]));
+		}
+	}
+}
+
+AJAAncVANCScanner::AJAAncVANCScanner ()
+	:	mLines			(),
+		mScratch		(),
+		mFormatDesc		(),
+		mSkipUnchanged	(false),
+		mNumSearched	(0),
+		mNumSkipped		(0)
+{
+}
+
+void AJAAncVANCScanner::SetSkipUnchangedLines (const bool inSkip)
+{
+	mSkipUnchanged = inSkip;
+	if (!inSkip)
+		mLines.clear();
+}
+
+void AJAAncVANCScanner::Reset (void)
+{
+	mLines.clear();
+	mFormatDesc = NTV2FormatDescriptor();
+	mNumSearched = mNumSkipped = 0;
+}
+
+AJAStatus AJAAncVANCScanner::Scan (const NTV2Buffer &				inFrameBuffer,
+									const NTV2FormatDescriptor &	inFormatDesc,
+									AJAAncillaryList &				outPackets,
+									const uint32_t					inFrameNum)
+{
+	outPackets.Clear();
+
+	if (inFrameBuffer.IsNULL())
+	{
+		LOGMYERROR("AJA_STATUS_NULL: NULL frame buffer pointer");
+		return AJA_STATUS_NULL;
+	}
+	if (!inFormatDesc.IsValid())
+	{
+		LOGMYERROR("AJA_STATUS_BAD_PARAM: bad NTV2FormatDescriptor");
+		return AJA_STATUS_BAD_PARAM;
+	}
+	if (!inFormatDesc.IsVANC())
+	{
+		LOGMYERROR("AJA_STATUS_BAD_PARAM: format descriptor has no VANC lines");
+		return AJA_STATUS_BAD_PARAM;
+	}
+
+	const ULWord			vancBytes	(inFormatDesc.GetTotalRasterBytes() - inFormatDesc.GetVisibleRasterBytes());
+	const NTV2PixelFormat	fbf			(inFormatDesc.GetPixelFormat());
+	if (inFrameBuffer.GetByteCount() < vancBytes)
+	{
+		LOGMYERROR("AJA_STATUS_FAIL: " << inFrameBuffer.GetByteCount() << "-byte frame buffer smaller than " << vancBytes << "-byte VANC region");
+		return AJA_STATUS_FAIL;
+	}
+	if (fbf != NTV2_FBF_10BIT_YCBCR	 &&	 fbf != NTV2_FBF_8BIT_YCBCR)
+	{
+		LOGMYERROR("AJA_STATUS_UNSUPPORTED: frame buffer format " << ::NTV2FrameBufferFormatToString(fbf) << " not '2vuy' nor 'v210'");
+		return AJA_STATUS_UNSUPPORTED;	//	Only 'v210' and '2vuy' currently supported
+	}
+
+	const ULWord	rowBytes	(inFormatDesc.GetBytesPerRow());
+	const ULWord	numLines	(inFormatDesc.GetFirstActiveLine());
+	if (mSkipUnchanged  &&  !(mFormatDesc == inFormatDesc))
+	{	//	Different raster -- forget the previous frame's lines...
+		mLines.clear();
+		mFormatDesc = inFormatDesc;
+	}
+	if (mSkipUnchanged)
+		mLines.resize(numLines);
+
+	for (ULWord lineOffset(0);  lineOffset < numLines;  lineOffset++)
+	{
+		const UByte *	pRow	(reinterpret_cast<const UByte*>(inFormatDesc.GetRowAddress(inFrameBuffer.GetHostAddress(0), lineOffset)));
+		VANCLine &		line	(mSkipUnchanged ? mLines[lineOffset] : mScratch);
+		if (mSkipUnchanged  &&  line.mBytes.size() == size_t(rowBytes)  &&  ::memcmp(&line.mBytes[0], pRow, rowBytes) == 0)
+			mNumSkipped++;	//	Unchanged -- reuse its packets
+		else
+		{
+			if (mSkipUnchanged)
+				line.mBytes.assign(pRow, pRow + rowBytes);
+			GetVANCLinePackets (pRow, inFormatDesc, lineOffset, line.mPackets, line.mLocs);
+			mNumSearched++;
+		}
+		for (size_t ndx(0);  ndx < line.mPackets.size();  ndx++)
+			outPackets.AddVANCData (line.mPackets[ndx], line.mLocs[ndx], inFrameNum);
+	}	//	for each VANC line
+	LOGMYDEBUG("returning " << outPackets);
+	return AJA_STATUS_SUCCESS;
+
+}	//	AJAAncVANCScanner::Scan
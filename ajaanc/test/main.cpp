@@ -9,6 +9,7 @@
 #include "ajantv2/includes/ntv2endian.h"
 #include "ajabase/common/options_popt.h"
 #include "ajabase/common/performance.h"
+#include "ajabase/common/pixelkernels.h"
 #include "ancillarydata_cea608_line21.h"
 #include "ancillarydata_cea608_vanc.h"
 #include "ancillarydata_cea708.h"
@@ -1702,6 +1703,77 @@ cerr << ::NTV2VideoFormatToString(vFormat) << ": " << AJAAncillaryData::GetNumAc
 		}	//	TEST_CASE("BFT_GumpToAncListToGump")
 
 
+		TEST_CASE("BFT_AncListRecycling")
+		{
+			AJAAncillaryData::ResetInstanceCounts();
+			{
+				//	Make some transmit packets -- a known type, an HDR packet (received as unknown), and a custom one...
+				AJAAncDataLoc	loc;
+				loc.SetDataLink(AJAAncDataLink_A).SetDataChannel(AJAAncDataChannel_Y).SetHorizontalOffset(AJAAncDataHorizOffset_AnyVanc);
+				AJAAncillaryData_Cea608_Vanc	pkt608;
+				CHECK(AJA_SUCCESS(pkt608.SetLine(false/*isF1*/, 9)));
+				CHECK(AJA_SUCCESS(pkt608.SetCEA608Bytes(AJAAncillaryData_Cea608::AddOddParity('A'), AJAAncillaryData_Cea608::AddOddParity('B'))));
+				CHECK(AJA_SUCCESS(pkt608.SetDataLocation(loc.SetLineNumber(9))));
+				CHECK(AJA_SUCCESS(pkt608.GeneratePayloadData()));
+				AJAAncillaryData_HDR_HLG		pktHDR;
+				CHECK(AJA_SUCCESS(pktHDR.GeneratePayloadData()));
+				AJAAncillaryData				pktCustom;
+				static const uint8_t	pCustomData[]	=	{	0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x09, 0x0A	};
+				CHECK(AJA_SUCCESS(pktCustom.SetDataLocation(loc.SetLineNumber(10))));
+				CHECK(AJA_SUCCESS(pktCustom.SetDID(0x7A)));
+				CHECK(AJA_SUCCESS(pktCustom.SetSID(0x01)));
+				CHECK(AJA_SUCCESS(pktCustom.SetPayloadData(pCustomData, sizeof(pCustomData))));
+				AJAAncillaryList	txPkts;
+				CHECK(AJA_SUCCESS(txPkts.AddAncillaryData(pkt608)));
+				CHECK(AJA_SUCCESS(txPkts.AddAncillaryData(pktHDR)));
+				CHECK(AJA_SUCCESS(txPkts.AddAncillaryData(pktCustom)));
+				NTV2Buffer	gumpF1(4096), gumpF2(4096);
+				CHECK(AJA_SUCCESS(txPkts.GetTransmitData (gumpF1, gumpF2, true/*isProgressive*/, 0)));
+
+				//	Receive them into a normal list, and into a recycling list, frame after frame...
+				AJAAncillaryList	rxRef, rxPkts;
+				CHECK_FALSE(rxPkts.IsRecyclingPackets());
+				rxPkts.SetPacketRecycling(true);
+				CHECK(rxPkts.IsRecyclingPackets());
+				CHECK(AJA_SUCCESS(AJAAncillaryList::SetFromDeviceAncBuffers(gumpF1, gumpF2, rxRef)));
+				CHECK_EQ(rxRef.CountAncillaryData(), 3);
+				vector<AJAAncillaryData*>	firstPkts;
+				for (unsigned frame(0);  frame < 10;  frame++)
+				{
+					CHECK(AJA_SUCCESS(AJAAncillaryList::SetFromDeviceAncBuffers(gumpF1, gumpF2, rxPkts, frame+1)));
+					CHECK_EQ(rxPkts.CountAncillaryData(), 3);
+					CHECK_EQ(rxPkts.CountSparePackets(), 0);
+					CHECK(AJA_SUCCESS(rxRef.Compare(rxPkts, false/*ignoreLocation*/, false/*ignoreChecksum*/)));
+					for (uint32_t ndx(0);  ndx < rxPkts.CountAncillaryData();  ndx++)
+					{
+						AJAAncillaryData * pPkt (rxPkts.GetAncillaryDataAtIndex(ndx));
+						CHECK_EQ(pPkt->GetAncillaryDataType(), rxRef.GetAncillaryDataAtIndex(ndx)->GetAncillaryDataType());
+						CHECK_EQ(pPkt->GetFrameID(), frame+1);
+						if (frame)
+							CHECK_EQ(pPkt, firstPkts.at(ndx));	//	Same packet objects reused every frame
+						else
+							firstPkts.push_back(pPkt);
+					}
+					DBG_CHECK_EQ(AJAAncillaryData::GetNumActiveInstances(), 3 + 3 + 3 + 3 + 1);	//	tx, txPkts, rxRef, rxPkts, rxPkts' scratch pkt
+				}
+				AJAAncillaryData_Cea608_Vanc * p608 (static_cast<AJAAncillaryData_Cea608_Vanc*>(rxPkts.GetAncillaryDataWithType(AJAAncDataType_Cea608_Vanc)));
+				CHECK(p608 != AJA_NULL);
+				if (p608)
+				{	uint8_t char1(0), char2(0);  bool parityOK(false);
+					CHECK(AJA_SUCCESS(p608->GetCEA608Characters(char1, char2, parityOK)));
+					CHECK_EQ(char1, 'A');
+					CHECK_EQ(char2, 'B');
+				}
+				CHECK(AJA_SUCCESS(rxPkts.Clear()));
+				CHECK_EQ(rxPkts.CountSparePackets(), 3);
+				rxPkts.SetPacketRecycling(false);
+				CHECK_EQ(rxPkts.CountSparePackets(), 0);
+				DBG_CHECK_EQ(AJAAncillaryData::GetNumActiveInstances(), 3 + 3 + 3);
+			}
+			DBG_CHECK_EQ(AJAAncillaryData::GetNumActiveInstances(), 0);
+		}	//	TEST_CASE("BFT_AncListRecycling")
+
+
 		TEST_CASE("BFT_AncListToSortToAncList")
 		{
 			AJAAncillaryData::ResetInstanceCounts();
@@ -2120,6 +2192,85 @@ LOGMYDEBUG("BFT_AncListToRTPToAncList: IPF1bytes=" << DEC(IPF1bytes) << ", IPF2b
 		}	//	TEST_CASE("BFT_RTPXmitTooMuchData")
 
 
+//	Exposes the older, container-based GetRTPPackets + WriteRTPPackets transmit path, for comparing with GetIPTransmitData...
+class AJAAncListViaU32Pkts : public AJAAncillaryList
+{
+	public:
+		AJAStatus	GetIPTransmitDataViaU32Pkts (NTV2Buffer & F1Buffer, NTV2Buffer & F2Buffer, const bool inIsProgressive, const uint32_t inF2StartLine)
+		{
+			AJAU32Pkts		F1U32Pkts, F2U32Pkts;
+			AJAAncPktCounts F1AncCounts, F2AncCounts;
+			uint32_t		byteCount(0);
+			F1Buffer.Fill(uint64_t(0));	 F2Buffer.Fill(uint64_t(0));
+			SortListByLocation();
+			AJAStatus result (GetRTPPackets (F1U32Pkts, F2U32Pkts, F1AncCounts, F2AncCounts, inIsProgressive, inF2StartLine));
+			if (AJA_SUCCESS(result))
+				result = WriteRTPPackets (F1Buffer, byteCount, F1U32Pkts, F1AncCounts, /*isF2*/false, inIsProgressive);
+			if (AJA_SUCCESS(result)	 &&	 !inIsProgressive)
+				result = WriteRTPPackets (F2Buffer, byteCount, F2U32Pkts, F2AncCounts, /*isF2*/true, inIsProgressive);
+			return result;
+		}
+};	//	AJAAncListViaU32Pkts
+
+//	Fills the list with the given number of digital packets per field (1080i, up to 300), with assorted payload sizes...
+static void MakeRTPXmitPackets (AJAAncillaryList & outPkts, const unsigned inNumPktsPerField, const unsigned inSeed = 1)
+{
+	std::mt19937	gen(inSeed);
+	outPkts.Clear();
+	for (unsigned fld(0);  fld < 2;	 fld++)
+		for (unsigned pktNum(0);  pktNum < inNumPktsPerField;  pktNum++)
+		{
+			AJAAncDataLoc		loc;
+			AJAAncillaryData	pkt;
+			UByteSequence		payload (1 + gen() % 255);
+			for (size_t ndx(0);	 ndx < payload.size();	ndx++)
+				payload[ndx] = UByte(gen());
+			loc.Reset().SetDataLink(pktNum & 1 ? AJAAncDataLink_A : AJAAncDataLink_B)
+						.SetDataChannel(pktNum & 2 ? AJAAncDataChannel_C : AJAAncDataChannel_Y)
+						.SetDataSpace(AJAAncDataSpace_VANC).SetDataStream(AJAAncDataStream(pktNum & 3))
+						.SetLineNumber(uint16_t((fld ? 569 : 9) + pktNum))	//	Unique locations, since sorting isn't stable
+						.SetHorizontalOffset(AJAAncDataHorizOffset_Anywhere);
+			pkt.SetDataLocation(loc);
+			pkt.SetDataCoding(AJAAncDataCoding_Digital);
+			pkt.SetDID(UByte(0x40 + pktNum % 0x40));
+			pkt.SetSID(UByte(gen()));
+			pkt.SetPayloadData(&payload[0], uint32_t(payload.size()));
+			outPkts.AddAncillaryData(pkt);
+		}
+}
+
+
+		TEST_CASE("BFT_RTPXmitSinglePass")
+		{
+			//	Validates that the single-pass GetIPTransmitData writes exactly what GetRTPPackets + WriteRTPPackets do...
+			AJAAncListViaU32Pkts	pkts;
+			for (unsigned numPerField(0);  numPerField < 300;  numPerField += 30)
+			{
+				MakeRTPXmitPackets (pkts, numPerField, numPerField + 1);
+				for (unsigned mode(0);	mode < 4;  mode++)
+				{
+					const bool	isProgressive (mode & 1);
+					pkts.SetAllowMultiRTPTransmit(mode & 2);
+					uint32_t	F1ByteCount(0), F2ByteCount(0);
+					CHECK(AJA_SUCCESS(pkts.GetIPTransmitDataLength (F1ByteCount, F2ByteCount, isProgressive, 564)));
+					NTV2Buffer	F1Old(F1ByteCount + 256), F2Old(F2ByteCount + 256), F1New(F1ByteCount + 256), F2New(F2ByteCount + 256);
+					F1New.Fill(uint8_t(0xA5));	F2New.Fill(uint8_t(0x5A));	//	Unused remainder must be zeroed
+					CHECK(AJA_SUCCESS(pkts.GetIPTransmitDataViaU32Pkts (F1Old, F2Old, isProgressive, 564)));
+					CHECK(AJA_SUCCESS(pkts.GetIPTransmitData (F1New, F2New, isProgressive, 564)));
+					CHECK(F1New.IsContentEqual(F1Old));
+					CHECK(F2New.IsContentEqual(F2Old));
+
+					//	Too-small buffers must fail...
+					if (F1ByteCount > 8)
+					{
+						NTV2Buffer	F1Small(F1ByteCount - 8);
+						CHECK_FALSE(AJA_SUCCESS(pkts.GetIPTransmitData (F1Small, F2New, isProgressive, 564)));
+					}
+				}	//	for each mode
+			}	//	for each packet count
+		}	//	TEST_CASE("BFT_RTPXmitSinglePass")
+
+
 		TEST_CASE("BFT_AncListToFBYUV8ToAncList")
 		{
 			const NTV2VideoFormat	vFormats[]	=	{/*NTV2_FORMAT_525_5994, NTV2_FORMAT_625_5000,*/ NTV2_FORMAT_720p_5994, NTV2_FORMAT_1080i_5994, NTV2_FORMAT_1080p_3000};
@@ -2349,6 +2500,96 @@ for (unsigned lineOffset(0);  lineOffset < fd.GetFirstActiveLine();  lineOffset+
 		}	//	TEST_CASE("BFT_FBYUV10ToAncListToFBYUV10")
 
 
+		TEST_CASE("BFT_V210VANCScanner")
+		{
+			//	Builds VANC lines with packets at random places, and checks that GetAncPacketsFromV210VANCLine finds
+			//	the same packets as unpacking the line and calling GetAncPacketsFromVANCLine, at every SIMD level...
+			const AJA_SIMDLevel savedLevel (AJA_GetSIMDLevel());
+			std::mt19937 gen(1234);
+			const ULWord widths[] = {720, 1920, 3840};
+			for (unsigned wNdx(0);  wNdx < sizeof(widths)/sizeof(ULWord);  wNdx++)
+			{
+				const ULWord	numPixels	(widths[wNdx]);
+				const bool		isSD		(numPixels == 720);
+				for (unsigned iter(0);  iter < 50;  iter++)
+				{
+					UWordSequence line (numPixels * 2);
+					for (size_t ndx(0);  ndx < line.size();  ndx++)
+						line[ndx] = (ndx & 1) ? 0x040 : 0x200;	//	Blanking
+					for (int pkt(0);  pkt < int(gen() % 4);  pkt++)
+					{
+						AJAAncillaryData	anc;
+						UByteSequence		payload (1 + gen() % 64);
+						for (size_t ndx(0);  ndx < payload.size();  ndx++)
+							payload[ndx] = UByte(gen());
+						CHECK(AJA_SUCCESS(anc.SetDID(UByte(0x40 + gen() % 0x40))));
+						CHECK(AJA_SUCCESS(anc.SetSID(UByte(gen()))));
+						CHECK(AJA_SUCCESS(anc.SetPayloadData(&payload[0], uint32_t(payload.size()))));
+						UWordSequence words;
+						CHECK(AJA_SUCCESS(anc.GenerateTransmitData(words)));
+						const size_t incr (isSD ? 1 : 2),  span (words.size() * incr);
+						const size_t start ((gen() % (line.size() - span)) & (isSD ? ~size_t(0) : ~size_t(1)));
+						for (size_t ndx(0);  ndx < words.size();  ndx++)	//	Packets may overwrite each other -- fine
+							line[start + (isSD ? 0 : (gen() & 1)) + ndx * incr] = words[ndx];
+					}
+					vector<ULWord> packed ((numPixels / 6 + 1) * 4);
+					::PackLine_16BitYUVto10BitYUV (&line[0], &packed[0], numPixels);
+					UWordSequence unpacked;
+					CHECK(::UnpackLine_10BitYUVtoUWordSequence (&packed[0], unpacked, numPixels));
+
+					const AncChannelSearchSelect searches[] = {AncChannelSearch_Y, AncChannelSearch_C, AncChannelSearch_Both};
+					for (unsigned sNdx(isSD ? 2 : 0);  sNdx < (isSD ? 3U : 2U);  sNdx++)
+					{
+						AJAAncillaryData::U16Packets	refPkts;
+						UWordSequence					refOffsets;
+						AJAAncillaryData::GetAncPacketsFromVANCLine (unpacked, searches[sNdx], refPkts, refOffsets);
+						for (int lvl(AJA_SIMD_NONE);  lvl < AJA_SIMD_INVALID;  lvl++)
+						{
+							if (!AJA_SetSIMDLevel(AJA_SIMDLevel(lvl)))
+								continue;
+							INFO("width=" << numPixels << " iter=" << iter << " simd=" << ::AJA_SIMDLevelToString(AJA_SIMDLevel(lvl)));
+							AJAAncillaryData::U16Packets	pkts;
+							UWordSequence					offsets;
+							AJAAncillaryData::GetAncPacketsFromV210VANCLine (&packed[0], numPixels, searches[sNdx], pkts, offsets);
+							CHECK(pkts == refPkts);
+							CHECK(offsets == refOffsets);
+						}
+					}
+				}	//	for each iteration
+			}	//	for each width
+			CHECK(AJA_SetSIMDLevel(savedLevel));
+
+			//	AJAAncVANCScanner:  unchanged lines get skipped, but still yield their packets...
+			//	NOTE:	This test relies on YUV10 buffers generated by BFT_AncListToFBYUV10ToAncList
+			for (NTV2VideoFormat vFormat(NTV2_FORMAT_UNKNOWN);  vFormat < NTV2_MAX_NUM_VIDEO_FORMATS;  vFormat = NTV2VideoFormat(vFormat+1))
+			{
+				if (gVanc10Buffers[vFormat].IsNULL())
+					continue;
+				const NTV2FormatDescriptor	fd		(vFormat, NTV2_FBF_10BIT_YCBCR, NTV2_VANCMODE_TALLER);
+				NTV2Buffer					vanc	(gVanc10Buffers[vFormat]);
+				AJAAncillaryList			refPkts, pkts;
+				AJAAncVANCScanner			scanner;
+				scanner.SetSkipUnchangedLines(true);
+				CHECK(AJA_SUCCESS(AJAAncillaryList::SetFromVANCData(vanc, fd, refPkts)));
+				CHECK(refPkts.CountAncillaryData() > 0);
+				CHECK(AJA_SUCCESS(scanner.Scan(vanc, fd, pkts)));
+				CHECK(AJA_SUCCESS(refPkts.Compare(pkts, false /*ignoreLocation*/, false /*ignoreChecksum*/)));
+				CHECK_EQ(scanner.GetNumLinesSearched(), uint64_t(fd.GetFirstActiveLine()));
+				CHECK_EQ(scanner.GetNumLinesSkipped(), 0);
+				CHECK(AJA_SUCCESS(scanner.Scan(vanc, fd, pkts)));
+				CHECK(AJA_SUCCESS(refPkts.Compare(pkts, false /*ignoreLocation*/, false /*ignoreChecksum*/)));
+				CHECK_EQ(scanner.GetNumLinesSearched(), uint64_t(fd.GetFirstActiveLine()));
+				CHECK_EQ(scanner.GetNumLinesSkipped(), uint64_t(fd.GetFirstActiveLine()));
+
+				//	Change every line -- all must be searched again, and yield nothing...
+				vanc.Fill(uint8_t(0x81));
+				CHECK(AJA_SUCCESS(scanner.Scan(vanc, fd, pkts)));
+				CHECK_EQ(pkts.CountAncillaryData(), 0);
+				CHECK_EQ(scanner.GetNumLinesSearched(), uint64_t(2 * fd.GetFirstActiveLine()));
+			}	//	for each video format
+		}	//	TEST_CASE("BFT_V210VANCScanner")
+
+
 		TEST_CASE("BFT_AddFromDeviceAncBuffer")
 		{	//	This test is intended to elicit crashes (access violations), not to validate outcomes
 			AJAAncillaryList pkts;
@@ -2725,6 +2966,34 @@ for (unsigned lineOffset(0);  lineOffset < fd.GetFirstActiveLine();  lineOffset+
 			perfRx.Report();
 			perfOverall.Report();
 		}	//	TEST_CASE("RTPTimingTest")
+
+		TEST_CASE("RTPXmitTimingTest")	//	Normally Disabled
+		{
+			//	Compares GetIPTransmitData's single-pass packetizer with the GetRTPPackets + WriteRTPPackets path,
+			//	for a 60-packet-per-field 1080i workload...
+			const unsigned			numRoundTrips(10000);
+			AJAAncListViaU32Pkts	pkts;
+			MakeRTPXmitPackets (pkts, 60);
+			for (unsigned mode(0);	mode < 2;  mode++)
+			{
+				pkts.SetAllowMultiRTPTransmit(mode & 1);
+				NTV2Buffer		F1Buffer(64*1024),	F2Buffer(64*1024);
+				AJAPerformance	perfOld("RTPXmitViaU32Pkts", AJATimerPrecisionMicroseconds), perfNew("RTPXmitSinglePass", AJATimerPrecisionMicroseconds);
+				for (unsigned tripNum(0);  tripNum < numRoundTrips;	 tripNum++)
+				{
+					perfOld.Start();
+					pkts.GetIPTransmitDataViaU32Pkts (F1Buffer, F2Buffer, false, 564);
+					perfOld.Stop();
+					perfNew.Start();
+					pkts.GetIPTransmitData (F1Buffer, F2Buffer, false, 564);
+					perfNew.Stop();
+				}	//	for numRoundTrips
+				cerr << (mode & 1 ? "MultiRTP:  " : "SingleRTP: ") << "U32Pkts " << perfOld.Mean() << "us, single-pass " << perfNew.Mean()
+					<< "us per frame (" << (perfOld.Mean() / perfNew.Mean()) << "x)" << endl;
+				perfOld.Report();
+				perfNew.Report();
+			}
+		}	//	TEST_CASE("RTPXmitTimingTest")
 #endif	//	DISABLED FOR NOW
 
 
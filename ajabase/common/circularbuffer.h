@@ -11,6 +11,11 @@
 #include "ajabase/common/public.h"
 #include "ajabase/system/lock.h"
 #include "ajabase/system/event.h"
+#if defined(AJA_USE_CPLUSPLUS11) && !defined(AJA_BAREMETAL)
+	#include <atomic>
+	#include <thread>
+	#define	AJA_CIRCULAR_BUFFER_SPSC	//	Lock-free single-producer/single-consumer mode is available
+#endif
 
 
 
@@ -25,6 +30,9 @@
 					then calls EndProduceNextBuffer when finished.
 				-#	The consumer thread repeatedly calls my StartConsumeNextBuffer, processes data in the frame,
 					then calls EndConsumeNextBuffer when finished.
+			If there is exactly one producer thread and one consumer thread, call SetSingleProducerSingleConsumer
+			before spawning them. I then skip my locks and use atomic head/tail counters instead, only falling back
+			to my events when one side has to wait for the other for longer than a short spin.
 **/
 template <typename FrameDataPtr>
 class AJACircularBuffer
@@ -60,10 +68,35 @@ public:
 	*/
 	inline unsigned int GetCircBufferCount (void) const
 	{
+	#if defined(AJA_CIRCULAR_BUFFER_SPSC)
+		if (mSPSC)
+			return mProduced.mCount.load(std::memory_order_acquire) - mConsumed.mCount.load(std::memory_order_acquire);
+	#endif
 		return mCircBufferCount;
 	}
 
 
+	/**
+		@brief	Enables or disables my lock-free single-producer/single-consumer (SPSC) mode.
+		@note	In this mode, only one thread may call my Start/EndProduceNextBuffer methods, and only one (other)
+				thread may call my Start/EndConsumeNextBuffer methods. This is not thread-safe, so call it before
+				spawning the producer and consumer threads, while I'm empty.
+		@param[in]	inEnable	Specify true to use atomic head/tail counters instead of my locks.
+		@return		AJA_STATUS_SUCCESS if successful;  AJA_STATUS_UNSUPPORTED if this build lacks C++11 atomics;
+					AJA_STATUS_FAIL if I'm not empty.
+	**/
+	AJAStatus SetSingleProducerSingleConsumer (const bool inEnable);
+
+
+	/**
+		@return	True if I'm in lock-free single-producer/single-consumer mode.
+	**/
+	inline bool IsSingleProducerSingleConsumer (void) const
+	{
+		return mSPSC;
+	}
+
+
 	/**
 		@brief	Returns "true" if I'm empty -- i.e., if my tail and head are in the same place.
 		@return True if I contain no frames.
@@ -108,6 +141,10 @@ public:
 	**/
 	FrameDataPtr StartProduceNextBuffer (void)
 	{
+	#if defined(AJA_CIRCULAR_BUFFER_SPSC)
+		if (mSPSC)
+			return SPSCStartProduce();
+	#endif
 		while (1)
 		{
 			if( !WaitForLockOrAbort(&mDataBufferLock) )
@@ -152,6 +189,10 @@ public:
 	**/
 	FrameDataPtr StartConsumeNextBuffer (void)
 	{
+	#if defined(AJA_CIRCULAR_BUFFER_SPSC)
+		if (mSPSC)
+			return SPSCStartConsume();
+	#endif
 		while (1)
 		{
 			if( !WaitForLockOrAbort(&mDataBufferLock) )
@@ -215,6 +256,42 @@ private:
 	unsigned int				mEmptyIndex;		///< @brief Index where frames are removed from me
 
 	const bool *				mAbortFlag;			///< @brief Optional pointer to a boolean that clients can set to break threads waiting on me
+	bool						mSPSC;				///< @brief True if I'm in lock-free single-producer/single-consumer mode
+
+#if defined(AJA_CIRCULAR_BUFFER_SPSC)
+	/**
+		@brief	A free-running frame counter padded out to its own cache line, so that the producer's and
+				consumer's counters never share a line (and never false-share with my other members).
+	**/
+	struct SPSCCounter
+	{
+		SPSCCounter () : mCount (0), mWaiting (false)	{}
+		char					mPadBefore[64];
+		std::atomic<uint32_t>	mCount;			///< @brief Total frames produced (or consumed) -- only its owner writes it
+		std::atomic<bool>		mWaiting;		///< @brief True while its owner is (about to be) blocked on its event
+		char					mPadAfter[64 - sizeof(std::atomic<uint32_t>) - sizeof(std::atomic<bool>)];
+	};
+	SPSCCounter					mProduced;		///< @brief SPSC "head": frames made available by the producer
+	SPSCCounter					mConsumed;		///< @brief SPSC "tail": frames released by the consumer
+
+	FrameDataPtr SPSCStartProduce (void);
+	FrameDataPtr SPSCStartConsume (void);
+
+	/**
+		@brief		Spins, then yields, then blocks on the given event until the given counters are far enough apart.
+		@param[in]	inMine		The waiting side's own counter (only it writes to it).
+		@param[in]	inTheirs	The other side's counter.
+		@param[in]	inLimit		The producer passes my frame count (wait while full); the consumer passes zero (wait while empty).
+		@param[in]	pEvent		The event the other side sets after advancing its counter while I'm waiting.
+		@return		True if the wait was satisfied;  false if aborted.
+	**/
+	bool SPSCWait (SPSCCounter & inMine, SPSCCounter & inTheirs, const uint32_t inLimit, AJAEvent * pEvent);
+
+	/**
+		@brief		Publishes a newly produced/consumed frame, waking the other side only if it's blocked.
+	**/
+	void SPSCAdvance (SPSCCounter & inMine, SPSCCounter & inTheirs, AJAEvent * pEvent);
+#endif	//	AJA_CIRCULAR_BUFFER_SPSC
 	
 	/**
 		@brief		Waits for the given event with a timeout, and abort the wait if mAbortFlag is set.
@@ -242,7 +319,8 @@ AJACircularBuffer <FrameDataPtr>::AJACircularBuffer ()
 		mCircBufferCount (0),
 		mFillIndex (0),
 		mEmptyIndex (0),
-		mAbortFlag (NULL)
+		mAbortFlag (NULL),
+		mSPSC (false)
 {
 }
 
@@ -258,6 +336,10 @@ AJACircularBuffer <FrameDataPtr>::~AJACircularBuffer ()
 template<typename FrameDataPtr>
 void AJACircularBuffer<FrameDataPtr>::EndProduceNextBuffer()
 {
+#if defined(AJA_CIRCULAR_BUFFER_SPSC)
+	if (mSPSC)
+		return SPSCAdvance(mProduced, mConsumed, &mNotEmptyEvent);
+#endif
 	mLocks[mFillIndex]->Unlock();
 	mNotEmptyEvent.SetState(true);
 }
@@ -265,6 +347,10 @@ void AJACircularBuffer<FrameDataPtr>::EndProduceNextBuffer()
 template<typename FrameDataPtr>
 void AJACircularBuffer<FrameDataPtr>::EndConsumeNextBuffer()
 {
+#if defined(AJA_CIRCULAR_BUFFER_SPSC)
+	if (mSPSC)
+		return SPSCAdvance(mConsumed, mProduced, &mNotFullEvent);
+#endif
 	mLocks[mEmptyIndex]->Unlock();
 	mNotFullEvent.SetState(true);
 }
@@ -321,7 +407,98 @@ void AJACircularBuffer<FrameDataPtr>::Clear (void)
 
 	mHead = mTail = mFillIndex = mEmptyIndex = mCircBufferCount = 0;
 	mAbortFlag = NULL;
+#if defined(AJA_CIRCULAR_BUFFER_SPSC)
+	mProduced.mCount = mConsumed.mCount = 0;
+	mProduced.mWaiting = mConsumed.mWaiting = false;
+#endif
+}
+
+
+template<typename FrameDataPtr>
+AJAStatus AJACircularBuffer<FrameDataPtr>::SetSingleProducerSingleConsumer (const bool inEnable)
+{
+#if defined(AJA_CIRCULAR_BUFFER_SPSC)
+	if (!IsEmpty())
+		return AJA_STATUS_FAIL;
+	mSPSC = inEnable;
+	mHead = mTail = mFillIndex = mEmptyIndex = mCircBufferCount = 0;
+	mProduced.mCount = mConsumed.mCount = 0;
+	mProduced.mWaiting = mConsumed.mWaiting = false;
+	mNotFullEvent.SetState(true);
+	mNotEmptyEvent.SetState(false);
+	return AJA_STATUS_SUCCESS;
+#else
+	return inEnable ? AJA_STATUS_UNSUPPORTED : AJA_STATUS_SUCCESS;
+#endif
+}
+
+
+#if defined(AJA_CIRCULAR_BUFFER_SPSC)
+template<typename FrameDataPtr>
+FrameDataPtr AJACircularBuffer<FrameDataPtr>::SPSCStartProduce (void)
+{
+	const uint32_t numFrames (uint32_t(mFrames.size()));
+	if (!numFrames  ||  !SPSCWait(mProduced, mConsumed, numFrames, &mNotFullEvent))
+		return NULL;
+	mFillIndex = mProduced.mCount.load(std::memory_order_relaxed) % numFrames;
+	return mFrames[mFillIndex];
+}
+
+template<typename FrameDataPtr>
+FrameDataPtr AJACircularBuffer<FrameDataPtr>::SPSCStartConsume (void)
+{
+	const uint32_t numFrames (uint32_t(mFrames.size()));
+	if (!numFrames  ||  !SPSCWait(mConsumed, mProduced, 0, &mNotEmptyEvent))
+		return NULL;
+	mEmptyIndex = mConsumed.mCount.load(std::memory_order_relaxed) % numFrames;
+	return mFrames[mEmptyIndex];
+}
+
+template<typename FrameDataPtr>
+bool AJACircularBuffer<FrameDataPtr>::SPSCWait (SPSCCounter & inMine, SPSCCounter & inTheirs, const uint32_t inLimit, AJAEvent * pEvent)
+{
+	//	The producer may proceed while (produced - consumed) < numFrames, the consumer while (produced - consumed) > 0.
+	//	Both reduce to "distance from my counter to theirs != inLimit" -- unsigned wraparound keeps this valid forever.
+	const uint32_t mine (inMine.mCount.load(std::memory_order_relaxed));
+	const auto ready = [&]() -> bool
+	{	const uint32_t theirs (inTheirs.mCount.load(std::memory_order_acquire));
+		return (inLimit ? mine - theirs : theirs - mine) != inLimit;
+	};
+
+	//	Spin briefly, then yield -- a frame period is far longer than the typical hand-off...
+	for (unsigned spin(0);  spin < 1024;  spin++)
+	{
+		if (ready())
+			return true;
+		if (spin >= 64)
+			std::this_thread::yield();
+	}
+
+	//	...then block. Reset the event BEFORE advertising that I'm waiting, and re-check after, so that an
+	//	advance racing with me either is seen by my re-check or sees mWaiting and sets the event...
+	pEvent->SetState(false);
+	inMine.mWaiting.store(true, std::memory_order_seq_cst);
+	bool result (true);
+	while (!ready())
+	{
+		const AJAStatus status (pEvent->WaitForSignal(100));
+		if (status == AJA_STATUS_SUCCESS)
+			pEvent->SetState(false);
+		else if (status == AJA_STATUS_FAIL  ||  (mAbortFlag && *mAbortFlag))
+			{result = false;  break;}
+	}
+	inMine.mWaiting.store(false, std::memory_order_relaxed);
+	return result;
+}
+
+template<typename FrameDataPtr>
+void AJACircularBuffer<FrameDataPtr>::SPSCAdvance (SPSCCounter & inMine, SPSCCounter & inTheirs, AJAEvent * pEvent)
+{
+	inMine.mCount.store(inMine.mCount.load(std::memory_order_relaxed) + 1, std::memory_order_seq_cst);
+	if (inTheirs.mWaiting.load(std::memory_order_seq_cst))
+		pEvent->SetState(true);
 }
+#endif	//	AJA_CIRCULAR_BUFFER_SPSC
 
 
 #endif	//	AJA_CIRCULAR_BUFFER_H
@@ -0,0 +1,425 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		dpxsequencereader.cpp
+	@brief		Implementation of the AJADPXSequenceReader class, for streaming DPX sequence playout.
+	@copyright	(C) 2022 AJA Video Systems, Inc.  All rights reserved.
+**/
+
+#include "dpxsequencereader.h"
+#include "ajabase/system/file_io.h"
+#include "ajabase/system/memory.h"
+#include "ajabase/system/systemtime.h"
+#include "ajabase/system/thread.h"
+#include <string.h>
+
+using std::string;
+using std::vector;
+
+static const size_t		kPayloadAlignment	(4096);
+static const uint32_t	kWorkerIdleMs		(50);
+
+
+struct AJADPXSequenceReader::Slot
+{
+	enum State	{kEmpty, kLoading, kReady, kHeld};
+
+	Slot ()
+		:	state		(kEmpty),
+			pBuffer		(NULL),
+			capacity	(0),
+			size		(0),
+			fileIndex	(0),
+			seq			(0),
+			generation	(0),
+			status		(AJA_STATUS_SUCCESS)
+	{
+	}
+
+	~Slot ()
+	{
+		if (pBuffer)
+			AJAMemory::FreeAligned(pBuffer);
+	}
+
+	State		state;
+	uint8_t *	pBuffer;		/// Page-aligned payload buffer, grown as needed
+	uint32_t	capacity;		/// Size of pBuffer
+	uint32_t	size;			/// Payload bytes in pBuffer
+	uint32_t	fileIndex;		/// Index of the file in the sequence
+	uint64_t	seq;			/// Read-ahead sequence number
+	uint32_t	generation;		/// mGeneration when claimed
+	AJAStatus	status;			/// Result of reading the file
+	DpxHdr		hdr;			/// The file's header
+};	//	Slot
+
+
+AJADPXSequenceReader::AJADPXSequenceReader ()
+	:	mNextClaim		(0),
+		mNextRead		(0),
+		mClaimIndex		(0),
+		mGeneration		(0),
+		mAtEnd			(false),
+		mRepack			(false),
+		mpHeld			(NULL),
+		mNumStalls		(0)
+{
+}	//	constructor
+
+
+AJADPXSequenceReader::~AJADPXSequenceReader ()
+{
+	Stop();
+}	//	destructor
+
+
+AJAStatus AJADPXSequenceReader::Start (const uint32_t numFrames, const uint32_t numThreads, const bool repackToV210)
+{
+	if (IsRunning())
+		return AJA_STATUS_FAIL;
+	if (!mFileIO.GetFileCount())
+		return AJA_STATUS_INITIALIZE;
+	if (numFrames < 2  ||  !numThreads)
+		return AJA_STATUS_BAD_PARAM;
+
+	for (uint32_t num(0);  num < numFrames;  num++)
+		mSlots.push_back(new Slot);
+	mNextClaim = mNextRead = 0;
+	mClaimIndex = mFileIO.GetIndex();
+	mAtEnd = false;
+	mRepack = repackToV210;
+	mpHeld = NULL;
+	mNumStalls = 0;
+	mWorkEvent.SetManualReset(true);
+	mReadyEvent.SetManualReset(true);
+	mWorkEvent.Signal();
+
+	for (uint32_t num(0);  num < numThreads;  num++)
+	{
+		AJAThread * pThread (new AJAThread);
+		pThread->Attach(WorkerThread, this);
+		if (AJA_STATUS_SUCCESS != pThread->Start())
+		{
+			delete pThread;
+			Stop();
+			return AJA_STATUS_FAIL;
+		}
+		mThreads.push_back(pThread);
+	}
+	return AJA_STATUS_SUCCESS;
+}	//	Start
+
+
+void AJADPXSequenceReader::Stop ()
+{
+	for (size_t ndx(0);  ndx < mThreads.size();  ndx++)
+	{
+		mThreads[ndx]->Stop();
+		delete mThreads[ndx];
+	}
+	mThreads.clear();
+
+	for (size_t ndx(0);  ndx < mSlots.size();  ndx++)
+		delete mSlots[ndx];
+	mSlots.clear();
+	mpHeld = NULL;
+}	//	Stop
+
+
+bool AJADPXSequenceReader::IsRunning () const
+{
+	return !mThreads.empty();
+}	//	IsRunning
+
+
+bool AJADPXSequenceReader::ClaimNext (Slot * & outSlot)
+{
+	AJAAutoLock	lock(&mLock);
+	Slot &	slot (*mSlots[mNextClaim % mSlots.size()]);
+	if (mAtEnd  ||  slot.state != Slot::kEmpty)
+	{	//	Nothing to do until ReadNext frees a slot
+		mWorkEvent.Clear();
+		return false;
+	}
+
+	slot.state		= Slot::kLoading;
+	slot.seq		= mNextClaim++;
+	slot.fileIndex	= mClaimIndex;
+	slot.generation	= mGeneration;
+	if (mClaimIndex + 1 < mFileIO.GetFileCount())
+		mClaimIndex++;
+	else if (mFileIO.GetLoopMode())
+		mClaimIndex = 0;
+	else
+		mAtEnd = true;
+	outSlot = &slot;
+	return true;
+}	//	ClaimNext
+
+
+//	DPX packs each 32-bit word with three 10-bit components, the first one in bits 31-22 ("method A").
+//	v210 holds the same Cb Y Cr Y... stream, three components per little-endian word, the first one in bits 9-0.
+static void UnpackDPXToV210 (uint32_t * pWords, const uint32_t inNumWords, const bool inSwapBytes)
+{
+	for (uint32_t ndx(0);  ndx < inNumWords;  ndx++)
+	{
+		const uint32_t dpx ((inSwapBytes ? AJA_ENDIAN_SWAP32(pWords[ndx]) : pWords[ndx]) >> 2);
+		pWords[ndx] = ((dpx >> 20) & 0x3FF)  |  (dpx & 0xFFC00)  |  ((dpx & 0x3FF) << 20);
+	}
+}
+
+
+void AJADPXSequenceReader::LoadSlot (Slot & slot, DpxHdr & hdr)
+{
+	AJAFileIO	file;
+	AJAStatus	status = file.Open (mFileIO.GetFileList().at(slot.fileIndex), eAJAReadOnly, eAJAUnbuffered);
+	uint32_t	imageSize (0);
+
+	//	Read & check the header
+	if (AJA_STATUS_SUCCESS == status)
+	{
+		uint32_t bytesRead = file.Read ((uint8_t*)&hdr.GetHdr(), uint32_t(hdr.GetHdrSize()));
+		if (bytesRead != hdr.GetHdrSize())
+			status = AJA_STATUS_IO;
+		else if (!DPX_VALID( &hdr.GetHdr() ))
+			status = AJA_STATUS_UNSUPPORTED;
+	}
+	if (AJA_STATUS_SUCCESS == status)
+	{
+		imageSize = uint32_t(hdr.get_ii_image_size());
+		if (!imageSize  ||  imageSize == 0xFFFFFFFF)
+			status = AJA_STATUS_UNSUPPORTED;
+	}
+
+	//	Seek to & read the payload
+	if (AJA_STATUS_SUCCESS == status)
+		status = file.Seek (int64_t(hdr.get_fi_image_offset()), eAJASeekSet);
+	if (AJA_STATUS_SUCCESS == status  &&  slot.capacity < imageSize)
+	{
+		if (slot.pBuffer)
+			AJAMemory::FreeAligned(slot.pBuffer);
+		slot.pBuffer = reinterpret_cast<uint8_t*>(AJAMemory::AllocateAligned(imageSize, kPayloadAlignment));
+		slot.capacity = slot.pBuffer ? imageSize : 0;
+		if (!slot.pBuffer)
+			status = AJA_STATUS_MEMORY;
+	}
+	if (AJA_STATUS_SUCCESS == status)
+	{
+		uint32_t bytesRead = file.Read (slot.pBuffer, imageSize);
+		if (bytesRead != imageSize)
+			status = AJA_STATUS_IO;
+	}
+	file.Close ();
+
+	//	Unpack 10-bit YCbCr to v210 in place (get_ii_image_size pads DPX lines to 48 pixels, same as v210)
+	if (AJA_STATUS_SUCCESS == status  &&  mRepack
+		&&  hdr.get_ie_descriptor() == DPX_C_IMAGE_ELEM_DESC_422  &&  hdr.get_ie_bit_size() == 10)
+			UnpackDPXToV210(reinterpret_cast<uint32_t*>(slot.pBuffer), imageSize / 4, hdr.IsBigEndian());
+
+	slot.hdr	= hdr;
+	slot.size	= AJA_STATUS_SUCCESS == status ? imageSize : 0;
+	slot.status	= status;
+}	//	LoadSlot
+
+
+void AJADPXSequenceReader::WorkerThread (AJAThread * pThread, void * pContext)
+{
+	reinterpret_cast<AJADPXSequenceReader*>(pContext)->WorkerLoop(pThread);
+}	//	WorkerThread
+
+
+void AJADPXSequenceReader::WorkerLoop (AJAThread * pThread)
+{
+	DpxHdr	hdr;
+	while (!pThread->Terminate())
+	{
+		Slot * pSlot (NULL);
+		if (!ClaimNext(pSlot))
+		{
+			mWorkEvent.WaitForSignal(kWorkerIdleMs);
+			continue;
+		}
+		LoadSlot(*pSlot, hdr);
+
+		AJAAutoLock	lock(&mLock);
+		if (pSlot->generation == mGeneration)
+		{
+			pSlot->state = Slot::kReady;
+			mReadyEvent.Signal();
+		}
+		else
+		{	//	SetIndex was called while loading
+			pSlot->state = Slot::kEmpty;
+			mWorkEvent.Signal();
+		}
+	}
+}	//	WorkerLoop
+
+
+AJAStatus AJADPXSequenceReader::ReadNext (const uint8_t * &	outPayload,
+										  uint32_t &		outSize,
+										  uint32_t &		outIndex,
+										  const uint32_t	timeoutMs)
+{
+	if (!IsRunning())
+		return AJA_STATUS_INITIALIZE;
+
+	const uint64_t	startMs	(AJATime::GetSystemMilliseconds());
+	bool			stalled	(false);
+	AJAAutoLock		lock(&mLock);
+
+	//	Don't advance if paused
+	if (!mFileIO.GetPauseMode()  ||  !mpHeld)
+	{
+		if (mpHeld)
+		{	//	Done with the previous frame
+			mpHeld->state = Slot::kEmpty;
+			mpHeld = NULL;
+			mWorkEvent.Signal();
+		}
+
+		Slot *	pSlot (mSlots[mNextRead % mSlots.size()]);
+		while (pSlot->state != Slot::kReady  ||  pSlot->seq != mNextRead)
+		{
+			if (mAtEnd  &&  mNextRead == mNextClaim)
+				return AJA_STATUS_RANGE;
+			const uint64_t	elapsedMs (AJATime::GetSystemMilliseconds() - startMs);
+			if (elapsedMs >= timeoutMs)
+				return AJA_STATUS_TIMEOUT;
+			if (!stalled)
+				mNumStalls++;
+			stalled = true;
+			mReadyEvent.Clear();
+			mLock.Unlock();
+			mReadyEvent.WaitForSignal(uint32_t(timeoutMs - elapsedMs));
+			mLock.Lock();
+		}
+		pSlot->state = Slot::kHeld;
+		mpHeld = pSlot;
+		mNextRead++;
+
+		//	Make GetHdr & GetIndex reflect this frame
+		GetHdr() = pSlot->hdr.GetHdr();
+		mFileIO.SetIndex(pSlot->fileIndex + 1 < mFileIO.GetFileCount() ? pSlot->fileIndex + 1 : 0);
+	}
+
+	outPayload	= mpHeld->pBuffer;
+	outSize		= mpHeld->size;
+	outIndex	= mpHeld->fileIndex;
+	return mpHeld->status;
+}	//	ReadNext
+
+
+AJAStatus AJADPXSequenceReader::ReadNext (uint8_t &			buffer,
+										  const uint32_t	bufferSize,
+										  uint32_t &		index,
+										  const uint32_t	timeoutMs)
+{
+	const uint8_t *	pPayload (NULL);
+	uint32_t		payloadSize (0);
+	AJAStatus		status (ReadNext(pPayload, payloadSize, index, timeoutMs));
+	if (AJA_STATUS_SUCCESS != status)
+		return status;
+	if (payloadSize > bufferSize)
+		return AJA_STATUS_BADBUFFERSIZE;
+
+	//	The held frame isn't touched by the workers, so no need to lock
+	::memcpy(&buffer, pPayload, payloadSize);
+	return AJA_STATUS_SUCCESS;
+}	//	ReadNext
+
+
+AJAStatus AJADPXSequenceReader::SetIndex (const uint32_t & index)
+{
+	AJAAutoLock	lock(&mLock);
+	AJAStatus status (mFileIO.SetIndex(index));
+	if (AJA_STATUS_SUCCESS != status  ||  !IsRunning())
+		return status;
+
+	//	Drop everything read ahead -- loads in progress are dropped by the worker
+	for (size_t ndx(0);  ndx < mSlots.size();  ndx++)
+		if (mSlots[ndx]->state == Slot::kReady  ||  mSlots[ndx]->state == Slot::kHeld)
+			mSlots[ndx]->state = Slot::kEmpty;
+	mpHeld = NULL;
+	mGeneration++;
+	mNextRead = mNextClaim;
+	mClaimIndex = index;
+	mAtEnd = false;
+	mWorkEvent.Signal();
+	return AJA_STATUS_SUCCESS;
+}	//	SetIndex
+
+
+uint32_t AJADPXSequenceReader::GetIndex () const
+{
+	AJAAutoLock	lock(&mLock);
+	return mFileIO.GetIndex();
+}	//	GetIndex
+
+
+AJAStatus AJADPXSequenceReader::SetPath (const string & inPath)
+{
+	if (IsRunning())
+		return AJA_STATUS_FAIL;
+	AJAAutoLock	lock(&mLock);
+	return mFileIO.SetPath(inPath);
+}	//	SetPath
+
+
+string AJADPXSequenceReader::GetPath () const
+{
+	AJAAutoLock	lock(&mLock);
+	return mFileIO.GetPath();
+}	//	GetPath
+
+
+uint32_t AJADPXSequenceReader::GetFileCount () const
+{
+	AJAAutoLock	lock(&mLock);
+	return mFileIO.GetFileCount();
+}	//	GetFileCount
+
+
+void AJADPXSequenceReader::SetLoopMode (const bool inLoop)
+{
+	AJAAutoLock	lock(&mLock);
+	mFileIO.SetLoopMode(inLoop);
+}	//	SetLoopMode
+
+
+bool AJADPXSequenceReader::GetLoopMode () const
+{
+	AJAAutoLock	lock(&mLock);
+	return mFileIO.GetLoopMode();
+}	//	GetLoopMode
+
+
+void AJADPXSequenceReader::SetPauseMode (const bool inPause)
+{
+	AJAAutoLock	lock(&mLock);
+	mFileIO.SetPauseMode(inPause);
+}	//	SetPauseMode
+
+
+bool AJADPXSequenceReader::GetPauseMode () const
+{
+	AJAAutoLock	lock(&mLock);
+	return mFileIO.GetPauseMode();
+}	//	GetPauseMode
+
+
+uint32_t AJADPXSequenceReader::GetNumReady () const
+{
+	AJAAutoLock	lock(&mLock);
+	uint32_t	count (0);
+	for (size_t ndx(0);  ndx < mSlots.size();  ndx++)
+		if (mSlots[ndx]->state == Slot::kReady  &&  mSlots[ndx]->generation == mGeneration)
+			count++;
+	return count;
+}	//	GetNumReady
+
+
+uint64_t AJADPXSequenceReader::GetNumStalls () const
+{
+	AJAAutoLock	lock(&mLock);
+	return mNumStalls;
+}	//	GetNumStalls
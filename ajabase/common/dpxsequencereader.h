@@ -0,0 +1,173 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		dpxsequencereader.h
+	@brief		Declaration of the AJADPXSequenceReader class, for streaming DPX sequence playout.
+	@copyright	(C) 2022 AJA Video Systems, Inc.  All rights reserved.
+**/
+
+#ifndef AJA_DPXSEQUENCEREADER_H
+#define AJA_DPXSEQUENCEREADER_H
+
+#include "ajabase/common/dpxfileio.h"
+#include "ajabase/system/event.h"
+#include "ajabase/system/lock.h"
+
+class AJAThread;
+
+/**
+ *	Reads a DPX sequence ahead of the caller on worker threads, for playout.
+ *	Each worker opens the next file, parses its header and reads its image payload into one of a
+ *	ring of page-aligned buffers, so ReadNext only has to wait when the disk can't keep up.
+ *	The sequence, loop and pause controls work like those of AJADPXFileIO. The reader uses an
+ *	AJADPXFileIO internally, but isn't one, so nothing can seek it without discarding the frames
+ *	already read ahead. The inherited DpxHdr is the header of the frame last returned by ReadNext.
+ *	@ingroup AJAFileIO
+ */
+class AJADPXSequenceReader : public DpxHdr	//	New in SDK 17.1
+{
+	//	Public Instance Methods
+	public:
+		AJA_EXPORT AJADPXSequenceReader ();
+
+		AJA_EXPORT virtual ~AJADPXSequenceReader ();
+
+		/**
+			@brief		Starts reading ahead from the current index (see SetIndex).
+			@param[in]	inNumFrames		Specifies how many frames to keep in the ring (at least 2).
+			@param[in]	inNumThreads	Specifies the number of worker threads.
+			@param[in]	inRepackToV210	If true, 10-bit YCbCr (descriptor 100) payloads are unpacked
+										from DPX to v210 on the worker thread.
+		**/
+		AJA_EXPORT AJAStatus					Start (const uint32_t	inNumFrames		= 8,
+													   const uint32_t	inNumThreads	= 4,
+													   const bool		inRepackToV210	= false);
+
+		/**
+			@brief		Stops the worker threads and frees the ring.
+		**/
+		AJA_EXPORT void							Stop ();
+
+		/**
+			@brief		Returns true if the worker threads are running.
+		**/
+		AJA_EXPORT bool							IsRunning () const;
+
+		/**
+			@brief		Returns the next frame of the sequence without copying it.
+						In pause mode, the previous frame is returned again.
+						The header of the returned file is available through GetHdr.
+			@param[out]	outPayload		Receives the address of the image payload, which stays valid
+										until the next ReadNext, SetIndex or Stop call.
+			@param[out]	outSize			Receives the payload size, in bytes.
+			@param[out]	outIndex		Receives the index number of the file read.
+			@param[in]	inTimeoutMs		Specifies how long to wait for the frame, in milliseconds.
+			@return		AJA_STATUS_SUCCESS if a frame was returned, AJA_STATUS_TIMEOUT if it isn't ready,
+						AJA_STATUS_RANGE at the end of a non-looping sequence, or the error from
+						reading the file (the bad file is skipped).
+		**/
+		AJA_EXPORT AJAStatus					ReadNext (const uint8_t * &	outPayload,
+														  uint32_t &		outSize,
+														  uint32_t &		outIndex,
+														  const uint32_t	inTimeoutMs	= 1000);
+
+		/**
+			@brief		Copies the next frame of the sequence, like AJADPXFileIO::Read.
+			@param[out]	outBuffer		Receives the DPX file image payload.
+			@param[in]	inBufferSize	Specifies the maximum number of bytes to store in outBuffer.
+			@param[out]	outIndex		Receives the index number of the file read.
+			@param[in]	inTimeoutMs		Specifies how long to wait for the frame, in milliseconds.
+		**/
+		AJA_EXPORT AJAStatus					ReadNext (uint8_t &			outBuffer,
+														  const uint32_t	inBufferSize,
+														  uint32_t &		outIndex,
+														  const uint32_t	inTimeoutMs	= 1000);
+
+		/**
+			@brief		Specifies the index in the file list of the next file to be read,
+						discarding any frames already read ahead.
+		**/
+		AJA_EXPORT AJAStatus					SetIndex (const uint32_t &	index);
+
+		/**
+			@brief		Returns the index in the file list of the file after the one last returned by ReadNext.
+		**/
+		AJA_EXPORT uint32_t						GetIndex () const;
+
+		/**
+			@brief		Changes the path to the DPX files to be read, like AJADPXFileIO::SetPath.
+			@return		AJA_STATUS_FAIL if the reader is running.
+		**/
+		AJA_EXPORT AJAStatus					SetPath (const std::string &	inPath);
+
+		/**
+			@brief		Returns the current path to the DPX files to be read.
+		**/
+		AJA_EXPORT std::string					GetPath () const;
+
+		/**
+			@brief		Returns the number of DPX files in the sequence.
+		**/
+		AJA_EXPORT uint32_t						GetFileCount () const;
+
+		/**
+			@brief		Specifies the setting of the loop play control, like AJADPXFileIO::SetLoopMode.
+		**/
+		AJA_EXPORT void							SetLoopMode (const bool inLoop);
+
+		/**
+			@brief		Returns the current setting of the loop play control.
+		**/
+		AJA_EXPORT bool							GetLoopMode () const;
+
+		/**
+			@brief		Specifies the setting of the pause control. While paused, ReadNext returns the same frame.
+		**/
+		AJA_EXPORT void							SetPauseMode (const bool inPause);
+
+		/**
+			@brief		Returns the current setting of the pause control.
+		**/
+		AJA_EXPORT bool							GetPauseMode () const;
+
+		/**
+			@brief		Returns the number of frames read ahead and waiting for ReadNext.
+		**/
+		AJA_EXPORT uint32_t						GetNumReady () const;
+
+		/**
+			@brief		Returns the number of times ReadNext had to wait for a worker.
+		**/
+		AJA_EXPORT uint64_t						GetNumStalls () const;
+
+	//	Private Instance Methods
+	private:
+		struct Slot;
+
+		bool									ClaimNext (Slot * & outSlot);
+		void									LoadSlot (Slot & inSlot, DpxHdr & inHdr);
+		static void								WorkerThread (AJAThread * pThread, void * pContext);
+		void									WorkerLoop (AJAThread * pThread);
+
+		AJADPXSequenceReader (const AJADPXSequenceReader &);				//	Not copyable
+		AJADPXSequenceReader & operator = (const AJADPXSequenceReader &);	//	Not assignable
+
+	//	Private Member Data
+	private:
+		mutable AJALock				mLock;			/// Guards everything below
+		AJADPXFileIO				mFileIO;		/// The sequence's file list, index, loop & pause controls
+		std::vector<Slot*>			mSlots;			/// The frame ring
+		std::vector<AJAThread*>		mThreads;		/// The worker threads
+		AJAEvent					mWorkEvent;		/// Signaled when a slot frees up
+		AJAEvent					mReadyEvent;	/// Signaled when a slot is loaded
+		uint64_t					mNextClaim;		/// Sequence number of the next frame to read ahead
+		uint64_t					mNextRead;		/// Sequence number of the next frame for ReadNext
+		uint32_t					mClaimIndex;	/// File index of the next frame to read ahead
+		uint32_t					mGeneration;	/// Bumped by SetIndex, so stale loads are dropped
+		bool						mAtEnd;			/// True when a non-looping sequence has been read ahead to its end
+		bool						mRepack;		/// True to repack 10-bit YCbCr to v210
+		Slot *						mpHeld;			/// The frame last returned by ReadNext
+		uint64_t					mNumStalls;		/// Times ReadNext waited
+
+};	//	AJADPXSequenceReader
+
+#endif	// AJA_DPXSEQUENCEREADER_H
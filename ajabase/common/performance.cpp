@@ -134,6 +134,11 @@ double AJAPerformance::StandardDeviation(void)
 	return sqrt(Variance());
 }
 
+uint64_t AJAPerformance::Percentile(const double percent)
+{
+	return mHistogram.Percentile(percent);
+}
+
 const AJAPerformanceExtraMap AJAPerformance::Extras(void)
 {
 	return mExtras;
@@ -165,6 +170,7 @@ void AJAPerformance::Stop(void)
 
 	mTotalTime += elapsedTime;
 	mEntries++;
+	mHistogram.Record(elapsedTime);
 
 	// calculate the running mean and sum of squares of differences from the current mean (mM2)
 	// mM2 is needed to calculate the variance and the standard deviation
@@ -211,6 +217,9 @@ void AJAPerformance::Report(const std::string& name, const char* pFileName, int3
 			   "min: "	 << std::right << std::setw(4)	<< min	   << ", " <<
 			   "mean: "	 << std::right << std::setw(5)	<< std::fixed << std::setprecision(2) << mean  << ", " <<
 			   "stdev: " << std::right << std::setw(5)	<< std::fixed << std::setprecision(2) << stdev << ", " <<
+			   "p50: "	 << std::right << std::setw(4)	<< Percentile(50.0)	<< ", " <<
+			   "p99: "	 << std::right << std::setw(4)	<< Percentile(99.0)	<< ", " <<
+			   "p99.9: " << std::right << std::setw(4)	<< Percentile(99.9)	<< ", " <<
 			   "max: "	 << std::right << std::setw(4)	<< max;
 
 		AJADebug::Report(AJA_DebugUnit_StatsGeneric,
@@ -221,6 +230,118 @@ void AJAPerformance::Report(const std::string& name, const char* pFileName, int3
 	}
 }
 
+
+//	Buckets 0..63 count values 0..63 exactly. After that, each power of two from 2^6 thru 2^35
+//	gets 32 equal-width sub-buckets, for 64 + 30*32 = 1024 buckets in all.
+static const size_t		kExactBuckets		(64);
+static const unsigned	kSubBucketBits		(5);
+static const unsigned	kFirstMagnitude		(6);	//	log2(kExactBuckets)
+static const unsigned	kLastMagnitude		(35);
+static const size_t		kNumBuckets			(kExactBuckets + (kLastMagnitude - kFirstMagnitude + 1) * (size_t(1) << kSubBucketBits));
+
+AJALatencyHistogram::AJALatencyHistogram()
+	:	mEntries	(0),
+		mMin		(UINT64_MAX),
+		mMax		(0),
+		mTotal		(0)
+{
+}
+
+size_t AJALatencyHistogram::BucketIndex(const uint64_t value)
+{
+	if (value < kExactBuckets)
+		return size_t(value);
+	unsigned magnitude(kFirstMagnitude);
+	while (magnitude < 63  &&  (value >> (magnitude + 1)))
+		magnitude++;
+	if (magnitude > kLastMagnitude)
+		return kNumBuckets - 1;
+	const size_t subBucket((value >> (magnitude - kSubBucketBits)) & ((1 << kSubBucketBits) - 1));
+	return kExactBuckets + ((magnitude - kFirstMagnitude) << kSubBucketBits) + subBucket;
+}
+
+uint64_t AJALatencyHistogram::BucketValue(const size_t index)
+{
+	if (index < kExactBuckets)
+		return uint64_t(index);
+	const size_t	bucket		(index - kExactBuckets);
+	const unsigned	magnitude	(unsigned(bucket >> kSubBucketBits) + kFirstMagnitude);
+	const uint64_t	width		(uint64_t(1) << (magnitude - kSubBucketBits));
+	const uint64_t	lower		(((uint64_t(1) << kSubBucketBits) + (bucket & ((1 << kSubBucketBits) - 1))) * width);
+	return lower + width / 2;	//	Midpoint
+}
+
+void AJALatencyHistogram::Record(const uint64_t value)
+{
+	if (mCounts.empty())
+		mCounts.resize(kNumBuckets, 0);
+	mCounts[BucketIndex(value)]++;
+	mEntries++;
+	mTotal += value;
+	if (value < mMin)
+		mMin = value;
+	if (value > mMax)
+		mMax = value;
+}
+
+void AJALatencyHistogram::Merge(const AJALatencyHistogram& other)
+{
+	if (!other.mEntries)
+		return;
+	if (mCounts.empty())
+		mCounts.resize(kNumBuckets, 0);
+	for (size_t ndx(0);  ndx < kNumBuckets;  ndx++)
+		mCounts[ndx] += other.mCounts[ndx];
+	mEntries += other.mEntries;
+	mTotal += other.mTotal;
+	if (other.mMin < mMin)
+		mMin = other.mMin;
+	if (other.mMax > mMax)
+		mMax = other.mMax;
+}
+
+void AJALatencyHistogram::Reset(void)
+{
+	mCounts.clear();
+	mEntries = mMax = mTotal = 0;
+	mMin = UINT64_MAX;
+}
+
+double AJALatencyHistogram::Mean(void) const
+{
+	return mEntries ? double(mTotal) / double(mEntries) : 0.0;
+}
+
+uint64_t AJALatencyHistogram::Percentile(const double percent) const
+{
+	if (!mEntries)
+		return 0;
+	if (percent >= 100.0)
+		return mMax;
+	uint64_t target(uint64_t(ceil(double(mEntries) * (percent > 0.0 ? percent : 0.0) / 100.0)));
+	if (!target)
+		target = 1;
+	uint64_t seen(0);
+	for (size_t ndx(0);  ndx < kNumBuckets;  ndx++)
+	{
+		seen += mCounts[ndx];
+		if (seen >= target)
+		{
+			const uint64_t value(BucketValue(ndx));
+			return value < mMin ? mMin : (value > mMax ? mMax : value);
+		}
+	}
+	return mMax;
+}
+
+std::ostream& AJALatencyHistogram::Print(std::ostream& oss) const
+{
+	oss << "n=" << Entries() << " min=" << MinValue() << " p50=" << Percentile(50.0)
+		<< " p99=" << Percentile(99.0) << " p99.9=" << Percentile(99.9) << " max=" << MaxValue();
+	return oss;
+}
+
+
 bool AJAPerformanceTracking_start(AJAPerformanceTracking& stats,
 								 std::string key, AJATimerPrecision precision, uint64_t skipEntries)
 {
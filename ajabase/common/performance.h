@@ -14,12 +14,92 @@
 #include "ajabase/common/timer.h"
 #include <string>
 #include <map>
+#include <vector>
+#include <iosfwd>
 
 typedef std::map<std::string, uint64_t> AJAPerformanceExtraMap;
 
 /////////////////////////////
 // Declarations
 /////////////////////////////
+/**
+ *	A compact, HDR-style (log-linear) histogram for tracking latency distributions.
+ *	Values under 64 are counted exactly; larger values fall into one of 32 linear sub-buckets
+ *	per power of two, so reported percentiles are within about 3% of the true value.
+ *	Values of 2^36 and above are counted in the topmost bucket (MaxValue remains exact).
+ *	Bucket storage (8KB) isn't allocated until the first value is recorded.
+ *	@note	Not thread-safe -- serialize access if recording and querying from different threads.
+ */
+class AJAExport AJALatencyHistogram
+{
+	public:
+		AJALatencyHistogram();
+
+		/**
+		 *	Adds a value (e.g. an elapsed time) to the histogram.
+		 *
+		 *	@param[in]	value The value to record.
+		 */
+		void Record(const uint64_t value);
+
+		/**
+		 *	Adds all of the values recorded in another histogram to this one.
+		 *
+		 *	@param[in]	other The histogram to merge into this one.
+		 */
+		void Merge(const AJALatencyHistogram& other);
+
+		/**
+		 *	Discards all recorded values
+		 */
+		void Reset(void);
+
+		/**
+		 *	Returns the number of values recorded
+		 */
+		uint64_t Entries(void) const	{return mEntries;}
+
+		/**
+		 *	Returns the smallest value recorded, or zero if empty
+		 */
+		uint64_t MinValue(void) const	{return mEntries ? mMin : 0;}
+
+		/**
+		 *	Returns the largest value recorded, or zero if empty
+		 */
+		uint64_t MaxValue(void) const	{return mMax;}
+
+		/**
+		 *	Returns the mean (average) of all values recorded
+		 */
+		double Mean(void) const;
+
+		/**
+		 *	Returns the value at or below which the given percentage of recorded values fall.
+		 *
+		 *	@param[in]	percent The percentile of interest, 0.0 thru 100.0 (e.g. 99.9).
+		 *	@return		The (approximate) value at the percentile, or zero if empty.
+		 */
+		uint64_t Percentile(const double percent) const;
+
+		/**
+		 *	Prints a one-line summary (count, min, p50, p99, p99.9 and max) to the given stream
+		 */
+		std::ostream& Print(std::ostream& oss) const;
+
+	private:
+		static size_t	BucketIndex(const uint64_t value);
+		static uint64_t	BucketValue(const size_t index);
+
+		std::vector<uint64_t>	mCounts;
+		uint64_t				mEntries;
+		uint64_t				mMin;
+		uint64_t				mMax;
+		uint64_t				mTotal;
+};
+
+inline std::ostream& operator << (std::ostream& oss, const AJALatencyHistogram& histogram)	{return histogram.Print(oss);}
+
 class AJAExport AJAPerformance
 {
 	public:
@@ -131,6 +211,18 @@ class AJAExport AJAPerformance
 		 */
 		double StandardDeviation(void);
 
+		/**
+		 *	Returns the time at or below which the given percentage of start/stop pairs fall (in Precision units)
+		 *
+		 *	@param[in]	percent The percentile of interest, 0.0 thru 100.0 (e.g. 99.9).
+		 */
+		uint64_t Percentile(const double percent);
+
+		/**
+		 *	Returns the histogram of all start/stop pair times (in Precision units)
+		 */
+		const AJALatencyHistogram& Histogram(void) const	{return mHistogram;}
+
 		/**
 		 *	Returns a map of any extra values stored in the performance object
 		 */
@@ -146,6 +238,7 @@ class AJAExport AJAPerformance
 		double						mMean;
 		double						mM2;
 		uint64_t					mNumEntriesToSkipAtStart;
+		AJALatencyHistogram			mHistogram;
 
 		AJAPerformanceExtraMap		mExtras;
 };
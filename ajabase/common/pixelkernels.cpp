@@ -0,0 +1,559 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		pixelkernels.cpp
+	@brief		Implements the ajabase library's vectorized pixel packing kernels and their runtime CPU dispatcher.
+	@copyright	(C) 2023 AJA Video Systems, Inc.  All rights reserved.
+**/
+
+#include "ajabase/common/pixelkernels.h"
+#if defined(AJA_USE_CPLUSPLUS11)
+	#include <atomic>
+#endif
+
+#if !defined(AJA_NO_SIMD)
+	#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || (defined(_M_IX86) && !defined(_M_ARM))
+		#define AJA_SIMD_X86
+		#include <immintrin.h>
+		#if defined(_MSC_VER)
+			#include <intrin.h>
+			#define AJA_SIMD_TARGET(__t__)
+		#else
+			#define AJA_SIMD_TARGET(__t__)	__attribute__((target(__t__)))
+		#endif
+	#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+		#define AJA_SIMD_ARM
+		#include <arm_neon.h>
+	#endif
+#endif	//	!defined(AJA_NO_SIMD)
+
+
+//	Number of 32-bit words the scalar unpacker consumes:  one per 3 components, rounded up
+static inline uint32_t UnpackWordCount (const uint32_t inNumPixels)		{return (inNumPixels * 2 + 2) / 3;}
+//	Number of 12-component groups the scalar packer produces, each being 4 words
+static inline uint32_t PackGroupCount (const uint32_t inNumPixels)		{return (inNumPixels * 2 + 11) / 12;}
+
+
+//////////////////////////////////////////////////////
+//	Scalar kernels -- the reference implementation
+//////////////////////////////////////////////////////
+
+static void UnPack10BitYCbCr_Scalar (const uint32_t * pIn, uint16_t * pOut, const uint32_t inNumPixels, const uint32_t inStartWord = 0)
+{
+	for (uint32_t sampleCount = inStartWord * 3, dataCount = inStartWord;  sampleCount < (inNumPixels * 2);  sampleCount += 3, dataCount++)
+	{
+		pOut[sampleCount]	= uint16_t( pIn[dataCount]		   & 0x3FF);
+		pOut[sampleCount+1] = uint16_t((pIn[dataCount] >> 10) & 0x3FF);
+		pOut[sampleCount+2] = uint16_t((pIn[dataCount] >> 20) & 0x3FF);
+	}
+}
+
+static void Pack10BitYCbCr_Scalar (const uint16_t * pIn, uint32_t * pOut, const uint32_t inNumPixels, const uint32_t inStartGroup = 0)
+{
+	for (uint32_t inputCount = inStartGroup * 12, outputCount = inStartGroup * 4;  inputCount < (inNumPixels * 2);  outputCount += 4, inputCount += 12)
+	{
+		pOut[outputCount]	= uint32_t(pIn[inputCount+0]) + (uint32_t(pIn[inputCount+1]) << 10) + (uint32_t(pIn[inputCount+2]) << 20);
+		pOut[outputCount+1] = uint32_t(pIn[inputCount+3]) + (uint32_t(pIn[inputCount+4]) << 10) + (uint32_t(pIn[inputCount+5]) << 20);
+		pOut[outputCount+2] = uint32_t(pIn[inputCount+6]) + (uint32_t(pIn[inputCount+7]) << 10) + (uint32_t(pIn[inputCount+8]) << 20);
+		pOut[outputCount+3] = uint32_t(pIn[inputCount+9]) + (uint32_t(pIn[inputCount+10]) << 10) + (uint32_t(pIn[inputCount+11]) << 20);
+	}
+}
+
+static uint32_t Find10BitZeroWord_Scalar (const uint32_t * pIn, const uint32_t inNumWords, uint32_t inWord)
+{
+	for (;  inWord < inNumWords;  inWord++)
+		if (!(pIn[inWord] & 0x000003FF)  ||  !(pIn[inWord] & 0x000FFC00)  ||  !(pIn[inWord] & 0x3FF00000))
+			break;
+	return inWord;
+}
+
+static uint32_t Find8BitZeroByte_Scalar (const uint8_t * pIn, const uint32_t inNumBytes, uint32_t inByte)
+{
+	while (inByte < inNumBytes  &&  pIn[inByte])
+		inByte++;
+	return inByte;
+}
+
+//	Index of the lowest set bit of a non-zero compare mask
+static inline uint32_t LowestSetBit (uint32_t inMask)
+{
+	uint32_t ndx(0);
+	for (;  !(inMask & 1);  inMask >>= 1)
+		ndx++;
+	return ndx;
+}
+
+
+#if defined(AJA_SIMD_X86)
+//////////////////////////////////////////////////////
+//	x86 kernels
+//////////////////////////////////////////////////////
+//	Both directions work on blocks of 8 v210 words (24 components):
+//		A = component 0 of each word, B = component 1, C = component 2 (8 x 16-bit each)
+//		H0, H1, H2 = the 24 interleaved 16-bit components (8 each)
+//	The byte shuffles below move components between the two layouts. AVX2 runs two such blocks,
+//	one per 128-bit lane, since PSHUFB doesn't cross lanes.
+
+//	sUnpackShuffle[h][comp]:  gathers interleaved half 'h' from A, B or C
+static const int8_t sUnpackShuffle[3][3][16] =
+{
+	{	{ 0, 1,-1,-1,-1,-1, 2, 3,-1,-1,-1,-1, 4, 5,-1,-1},
+		{-1,-1, 0, 1,-1,-1,-1,-1, 2, 3,-1,-1,-1,-1, 4, 5},
+		{-1,-1,-1,-1, 0, 1,-1,-1,-1,-1, 2, 3,-1,-1,-1,-1}	},
+	{	{-1,-1, 6, 7,-1,-1,-1,-1, 8, 9,-1,-1,-1,-1,10,11},
+		{-1,-1,-1,-1, 6, 7,-1,-1,-1,-1, 8, 9,-1,-1,-1,-1},
+		{ 4, 5,-1,-1,-1,-1, 6, 7,-1,-1,-1,-1, 8, 9,-1,-1}	},
+	{	{-1,-1,-1,-1,12,13,-1,-1,-1,-1,14,15,-1,-1,-1,-1},
+		{10,11,-1,-1,-1,-1,12,13,-1,-1,-1,-1,14,15,-1,-1},
+		{-1,-1,10,11,-1,-1,-1,-1,12,13,-1,-1,-1,-1,14,15}	}
+};
+
+//	sPackShuffle[comp][h]:  gathers A, B or C from interleaved half 'h'
+static const int8_t sPackShuffle[3][3][16] =
+{
+	{	{ 0, 1, 6, 7,12,13,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+		{-1,-1,-1,-1,-1,-1, 2, 3, 8, 9,14,15,-1,-1,-1,-1},
+		{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1, 4, 5,10,11}	},
+	{	{ 2, 3, 8, 9,14,15,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+		{-1,-1,-1,-1,-1,-1, 4, 5,10,11,-1,-1,-1,-1,-1,-1},
+		{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1, 0, 1, 6, 7,12,13}	},
+	{	{ 4, 5,10,11,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+		{-1,-1,-1,-1, 0, 1, 6, 7,12,13,-1,-1,-1,-1,-1,-1},
+		{-1,-1,-1,-1,-1,-1,-1,-1,-1,-1, 2, 3, 8, 9,14,15}	}
+};
+
+AJA_SIMD_TARGET("sse4.1")
+static void UnPack10BitYCbCr_SSE41 (const uint32_t * pIn, uint16_t * pOut, const uint32_t inNumPixels)
+{
+	const uint32_t	numWords (UnpackWordCount(inNumPixels));
+	const __m128i	mask (_mm_set1_epi32(0x3FF));
+	__m128i			shuf[3][3];
+	for (int h(0);  h < 3;  h++)
+		for (int comp(0);  comp < 3;  comp++)
+			shuf[h][comp] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sUnpackShuffle[h][comp]));
+
+	uint32_t word(0);
+	for (;  word + 8 <= numWords;  word += 8)
+	{
+		const __m128i w0 (_mm_loadu_si128(reinterpret_cast<const __m128i*>(pIn + word)));
+		const __m128i w1 (_mm_loadu_si128(reinterpret_cast<const __m128i*>(pIn + word + 4)));
+		const __m128i a (_mm_packus_epi32(_mm_and_si128(w0, mask), _mm_and_si128(w1, mask)));
+		const __m128i b (_mm_packus_epi32(_mm_and_si128(_mm_srli_epi32(w0, 10), mask), _mm_and_si128(_mm_srli_epi32(w1, 10), mask)));
+		const __m128i c (_mm_packus_epi32(_mm_and_si128(_mm_srli_epi32(w0, 20), mask), _mm_and_si128(_mm_srli_epi32(w1, 20), mask)));
+		__m128i * pDst (reinterpret_cast<__m128i*>(pOut + word * 3));
+		for (int h(0);  h < 3;  h++)
+			_mm_storeu_si128(pDst + h, _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, shuf[h][0]), _mm_shuffle_epi8(b, shuf[h][1])),
+													_mm_shuffle_epi8(c, shuf[h][2])));
+	}
+	UnPack10BitYCbCr_Scalar (pIn, pOut, inNumPixels, word);
+}
+
+AJA_SIMD_TARGET("sse4.1")
+static void Pack10BitYCbCr_SSE41 (const uint16_t * pIn, uint32_t * pOut, const uint32_t inNumPixels)
+{
+	const uint32_t	numGroups (PackGroupCount(inNumPixels));
+	const __m128i	zero (_mm_setzero_si128());
+	__m128i			shuf[3][3];
+	for (int comp(0);  comp < 3;  comp++)
+		for (int h(0);  h < 3;  h++)
+			shuf[comp][h] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sPackShuffle[comp][h]));
+
+	uint32_t group(0);
+	for (;  group + 2 <= numGroups;  group += 2)
+	{
+		const __m128i * pSrc (reinterpret_cast<const __m128i*>(pIn + group * 12));
+		const __m128i h0 (_mm_loadu_si128(pSrc)), h1 (_mm_loadu_si128(pSrc + 1)), h2 (_mm_loadu_si128(pSrc + 2));
+		__m128i abc[3];
+		for (int comp(0);  comp < 3;  comp++)
+			abc[comp] = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(h0, shuf[comp][0]), _mm_shuffle_epi8(h1, shuf[comp][1])),
+									 _mm_shuffle_epi8(h2, shuf[comp][2]));
+		//	Add (rather than OR) the shifted components, exactly like the scalar code does...
+		const __m128i lo (_mm_add_epi32(_mm_add_epi32(_mm_unpacklo_epi16(abc[0], zero), _mm_slli_epi32(_mm_unpacklo_epi16(abc[1], zero), 10)),
+										_mm_slli_epi32(_mm_unpacklo_epi16(abc[2], zero), 20)));
+		const __m128i hi (_mm_add_epi32(_mm_add_epi32(_mm_unpackhi_epi16(abc[0], zero), _mm_slli_epi32(_mm_unpackhi_epi16(abc[1], zero), 10)),
+										_mm_slli_epi32(_mm_unpackhi_epi16(abc[2], zero), 20)));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(pOut + group * 4), lo);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(pOut + group * 4 + 4), hi);
+	}
+	Pack10BitYCbCr_Scalar (pIn, pOut, inNumPixels, group);
+}
+
+AJA_SIMD_TARGET("avx2")
+static void UnPack10BitYCbCr_AVX2 (const uint32_t * pIn, uint16_t * pOut, const uint32_t inNumPixels)
+{
+	const uint32_t	numWords (UnpackWordCount(inNumPixels));
+	const __m256i	mask (_mm256_set1_epi32(0x3FF));
+	__m256i			shuf[3][3];
+	for (int h(0);  h < 3;  h++)
+		for (int comp(0);  comp < 3;  comp++)
+			shuf[h][comp] = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(sUnpackShuffle[h][comp])));
+
+	uint32_t word(0);
+	for (;  word + 16 <= numWords;  word += 16)
+	{
+		const __m256i w0 (_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pIn + word)));
+		const __m256i w1 (_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pIn + word + 8)));
+		//	PACKUSDW interleaves the lanes -- restore word order so that lane 0 holds words 0-7, lane 1 words 8-15...
+		const __m256i a (_mm256_permute4x64_epi64(_mm256_packus_epi32(_mm256_and_si256(w0, mask), _mm256_and_si256(w1, mask)), 0xD8));
+		const __m256i b (_mm256_permute4x64_epi64(_mm256_packus_epi32(_mm256_and_si256(_mm256_srli_epi32(w0, 10), mask),
+																	  _mm256_and_si256(_mm256_srli_epi32(w1, 10), mask)), 0xD8));
+		const __m256i c (_mm256_permute4x64_epi64(_mm256_packus_epi32(_mm256_and_si256(_mm256_srli_epi32(w0, 20), mask),
+																	  _mm256_and_si256(_mm256_srli_epi32(w1, 20), mask)), 0xD8));
+		__m256i v[3];	//	v[h] holds interleaved halves h and h+3
+		for (int h(0);  h < 3;  h++)
+			v[h] = _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(a, shuf[h][0]), _mm256_shuffle_epi8(b, shuf[h][1])),
+								   _mm256_shuffle_epi8(c, shuf[h][2]));
+		__m256i * pDst (reinterpret_cast<__m256i*>(pOut + word * 3));
+		_mm256_storeu_si256(pDst + 0, _mm256_permute2x128_si256(v[0], v[1], 0x20));	//	H0 H1
+		_mm256_storeu_si256(pDst + 1, _mm256_permute2x128_si256(v[2], v[0], 0x30));	//	H2 H3
+		_mm256_storeu_si256(pDst + 2, _mm256_permute2x128_si256(v[1], v[2], 0x31));	//	H4 H5
+	}
+	UnPack10BitYCbCr_Scalar (pIn, pOut, inNumPixels, word);
+}
+
+AJA_SIMD_TARGET("avx2")
+static void Pack10BitYCbCr_AVX2 (const uint16_t * pIn, uint32_t * pOut, const uint32_t inNumPixels)
+{
+	const uint32_t	numGroups (PackGroupCount(inNumPixels));
+	const __m256i	zero (_mm256_setzero_si256());
+	__m256i			shuf[3][3];
+	for (int comp(0);  comp < 3;  comp++)
+		for (int h(0);  h < 3;  h++)
+			shuf[comp][h] = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(sPackShuffle[comp][h])));
+
+	uint32_t group(0);
+	for (;  group + 4 <= numGroups;  group += 4)
+	{
+		const __m256i * pSrc (reinterpret_cast<const __m256i*>(pIn + group * 12));
+		const __m256i s0 (_mm256_loadu_si256(pSrc)), s1 (_mm256_loadu_si256(pSrc + 1)), s2 (_mm256_loadu_si256(pSrc + 2));
+		//	Regroup so that lane 0 holds the first block (H0 H1 H2), lane 1 the second block (H3 H4 H5)...
+		const __m256i v0 (_mm256_permute2x128_si256(s0, s1, 0x30));	//	H0 H3
+		const __m256i v1 (_mm256_permute2x128_si256(s0, s2, 0x21));	//	H1 H4
+		const __m256i v2 (_mm256_permute2x128_si256(s1, s2, 0x30));	//	H2 H5
+		__m256i abc[3];
+		for (int comp(0);  comp < 3;  comp++)
+			abc[comp] = _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(v0, shuf[comp][0]), _mm256_shuffle_epi8(v1, shuf[comp][1])),
+										_mm256_shuffle_epi8(v2, shuf[comp][2]));
+		const __m256i lo (_mm256_add_epi32(_mm256_add_epi32(_mm256_unpacklo_epi16(abc[0], zero), _mm256_slli_epi32(_mm256_unpacklo_epi16(abc[1], zero), 10)),
+										   _mm256_slli_epi32(_mm256_unpacklo_epi16(abc[2], zero), 20)));	//	words 0-3, 8-11
+		const __m256i hi (_mm256_add_epi32(_mm256_add_epi32(_mm256_unpackhi_epi16(abc[0], zero), _mm256_slli_epi32(_mm256_unpackhi_epi16(abc[1], zero), 10)),
+										   _mm256_slli_epi32(_mm256_unpackhi_epi16(abc[2], zero), 20)));	//	words 4-7, 12-15
+		__m256i * pDst (reinterpret_cast<__m256i*>(pOut + group * 4));
+		_mm256_storeu_si256(pDst + 0, _mm256_permute2x128_si256(lo, hi, 0x20));
+		_mm256_storeu_si256(pDst + 1, _mm256_permute2x128_si256(lo, hi, 0x31));
+	}
+	Pack10BitYCbCr_Scalar (pIn, pOut, inNumPixels, group);
+}
+
+//	The zero searches mask each of the three 10-bit fields of a word and compare them to zero...
+AJA_SIMD_TARGET("sse4.1")
+static uint32_t Find10BitZeroWord_SSE41 (const uint32_t * pIn, const uint32_t inNumWords, uint32_t inWord)
+{
+	const __m128i	m0 (_mm_set1_epi32(0x000003FF)),  m1 (_mm_set1_epi32(0x000FFC00)),  m2 (_mm_set1_epi32(0x3FF00000));
+	const __m128i	zero (_mm_setzero_si128());
+	for (;  inWord + 4 <= inNumWords;  inWord += 4)
+	{
+		const __m128i w (_mm_loadu_si128(reinterpret_cast<const __m128i*>(pIn + inWord)));
+		const __m128i hit (_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi32(_mm_and_si128(w, m0), zero), _mm_cmpeq_epi32(_mm_and_si128(w, m1), zero)),
+										_mm_cmpeq_epi32(_mm_and_si128(w, m2), zero)));
+		const int mask (_mm_movemask_ps(_mm_castsi128_ps(hit)));
+		if (mask)
+			return inWord + LowestSetBit(uint32_t(mask));
+	}
+	return Find10BitZeroWord_Scalar (pIn, inNumWords, inWord);
+}
+
+AJA_SIMD_TARGET("sse4.1")
+static uint32_t Find8BitZeroByte_SSE41 (const uint8_t * pIn, const uint32_t inNumBytes, uint32_t inByte)
+{
+	const __m128i zero (_mm_setzero_si128());
+	for (;  inByte + 16 <= inNumBytes;  inByte += 16)
+	{
+		const int mask (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pIn + inByte)), zero)));
+		if (mask)
+			return inByte + LowestSetBit(uint32_t(mask));
+	}
+	return Find8BitZeroByte_Scalar (pIn, inNumBytes, inByte);
+}
+
+AJA_SIMD_TARGET("avx2")
+static uint32_t Find10BitZeroWord_AVX2 (const uint32_t * pIn, const uint32_t inNumWords, uint32_t inWord)
+{
+	const __m256i	m0 (_mm256_set1_epi32(0x000003FF)),  m1 (_mm256_set1_epi32(0x000FFC00)),  m2 (_mm256_set1_epi32(0x3FF00000));
+	const __m256i	zero (_mm256_setzero_si256());
+	for (;  inWord + 8 <= inNumWords;  inWord += 8)
+	{
+		const __m256i w (_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pIn + inWord)));
+		const __m256i hit (_mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi32(_mm256_and_si256(w, m0), zero), _mm256_cmpeq_epi32(_mm256_and_si256(w, m1), zero)),
+										   _mm256_cmpeq_epi32(_mm256_and_si256(w, m2), zero)));
+		const int mask (_mm256_movemask_ps(_mm256_castsi256_ps(hit)));
+		if (mask)
+			return inWord + LowestSetBit(uint32_t(mask));
+	}
+	return Find10BitZeroWord_Scalar (pIn, inNumWords, inWord);
+}
+
+AJA_SIMD_TARGET("avx2")
+static uint32_t Find8BitZeroByte_AVX2 (const uint8_t * pIn, const uint32_t inNumBytes, uint32_t inByte)
+{
+	const __m256i zero (_mm256_setzero_si256());
+	for (;  inByte + 32 <= inNumBytes;  inByte += 32)
+	{
+		const uint32_t mask (uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pIn + inByte)), zero))));
+		if (mask)
+			return inByte + LowestSetBit(mask);
+	}
+	return Find8BitZeroByte_Scalar (pIn, inNumBytes, inByte);
+}
+#endif	//	defined(AJA_SIMD_X86)
+
+
+#if defined(AJA_SIMD_ARM)
+//////////////////////////////////////////////////////
+//	ARM NEON kernels
+//////////////////////////////////////////////////////
+//	VST3/VLD3 (de)interleave the three components directly, so no shuffles are needed.
+
+static void UnPack10BitYCbCr_NEON (const uint32_t * pIn, uint16_t * pOut, const uint32_t inNumPixels)
+{
+	const uint32_t		numWords (UnpackWordCount(inNumPixels));
+	const uint32x4_t	mask (vdupq_n_u32(0x3FF));
+	uint32_t word(0);
+	for (;  word + 8 <= numWords;  word += 8)
+	{
+		const uint32x4_t w0 (vld1q_u32(pIn + word)),  w1 (vld1q_u32(pIn + word + 4));
+		uint16x8x3_t abc;
+		abc.val[0] = vcombine_u16(vmovn_u32(vandq_u32(w0, mask)), vmovn_u32(vandq_u32(w1, mask)));
+		abc.val[1] = vcombine_u16(vmovn_u32(vandq_u32(vshrq_n_u32(w0, 10), mask)), vmovn_u32(vandq_u32(vshrq_n_u32(w1, 10), mask)));
+		abc.val[2] = vcombine_u16(vmovn_u32(vandq_u32(vshrq_n_u32(w0, 20), mask)), vmovn_u32(vandq_u32(vshrq_n_u32(w1, 20), mask)));
+		vst3q_u16(pOut + word * 3, abc);
+	}
+	UnPack10BitYCbCr_Scalar (pIn, pOut, inNumPixels, word);
+}
+
+static void Pack10BitYCbCr_NEON (const uint16_t * pIn, uint32_t * pOut, const uint32_t inNumPixels)
+{
+	const uint32_t numGroups (PackGroupCount(inNumPixels));
+	uint32_t group(0);
+	for (;  group + 2 <= numGroups;  group += 2)
+	{
+		const uint16x8x3_t abc (vld3q_u16(pIn + group * 12));
+		const uint32x4_t lo (vaddq_u32(vaddq_u32(vmovl_u16(vget_low_u16(abc.val[0])), vshlq_n_u32(vmovl_u16(vget_low_u16(abc.val[1])), 10)),
+									   vshlq_n_u32(vmovl_u16(vget_low_u16(abc.val[2])), 20)));
+		const uint32x4_t hi (vaddq_u32(vaddq_u32(vmovl_u16(vget_high_u16(abc.val[0])), vshlq_n_u32(vmovl_u16(vget_high_u16(abc.val[1])), 10)),
+									   vshlq_n_u32(vmovl_u16(vget_high_u16(abc.val[2])), 20)));
+		vst1q_u32(pOut + group * 4, lo);
+		vst1q_u32(pOut + group * 4 + 4, hi);
+	}
+	Pack10BitYCbCr_Scalar (pIn, pOut, inNumPixels, group);
+}
+
+//	NEON has no movemask, so the vector loop only finds the block -- the scalar code finds the element
+static uint32_t Find10BitZeroWord_NEON (const uint32_t * pIn, const uint32_t inNumWords, uint32_t inWord)
+{
+	const uint32x4_t	m0 (vdupq_n_u32(0x000003FF)),  m1 (vdupq_n_u32(0x000FFC00)),  m2 (vdupq_n_u32(0x3FF00000));
+	const uint32x4_t	zero (vdupq_n_u32(0));
+	for (;  inWord + 4 <= inNumWords;  inWord += 4)
+	{
+		const uint32x4_t w (vld1q_u32(pIn + inWord));
+		const uint64x2_t hit (vreinterpretq_u64_u32(vorrq_u32(vorrq_u32(vceqq_u32(vandq_u32(w, m0), zero), vceqq_u32(vandq_u32(w, m1), zero)),
+															  vceqq_u32(vandq_u32(w, m2), zero))));
+		if (vgetq_lane_u64(hit, 0) | vgetq_lane_u64(hit, 1))
+			break;
+	}
+	return Find10BitZeroWord_Scalar (pIn, inNumWords, inWord);
+}
+
+static uint32_t Find8BitZeroByte_NEON (const uint8_t * pIn, const uint32_t inNumBytes, uint32_t inByte)
+{
+	const uint8x16_t zero (vdupq_n_u8(0));
+	for (;  inByte + 16 <= inNumBytes;  inByte += 16)
+	{
+		const uint64x2_t hit (vreinterpretq_u64_u8(vceqq_u8(vld1q_u8(pIn + inByte), zero)));
+		if (vgetq_lane_u64(hit, 0) | vgetq_lane_u64(hit, 1))
+			break;
+	}
+	return Find8BitZeroByte_Scalar (pIn, inNumBytes, inByte);
+}
+#endif	//	defined(AJA_SIMD_ARM)
+
+
+//////////////////////////////////////////////////////
+//	Runtime dispatch
+//////////////////////////////////////////////////////
+
+typedef void (*UnPackFunc) (const uint32_t *, uint16_t *, const uint32_t);
+typedef void (*PackFunc) (const uint16_t *, uint32_t *, const uint32_t);
+typedef uint32_t (*Find10Func) (const uint32_t *, const uint32_t, uint32_t);
+typedef uint32_t (*Find8Func) (const uint8_t *, const uint32_t, uint32_t);
+
+static void UnPack10BitYCbCr_Default (const uint32_t * pIn, uint16_t * pOut, const uint32_t inNumPixels)
+{
+	UnPack10BitYCbCr_Scalar (pIn, pOut, inNumPixels);
+}
+
+static void Pack10BitYCbCr_Default (const uint16_t * pIn, uint32_t * pOut, const uint32_t inNumPixels)
+{
+	Pack10BitYCbCr_Scalar (pIn, pOut, inNumPixels);
+}
+
+static AJA_SIMDLevel DetectSIMDLevel (void)
+{
+#if defined(AJA_SIMD_X86)
+	#if defined(_MSC_VER)
+		int info[4];
+		__cpuid(info, 0);
+		const int maxLeaf (info[0]);
+		if (maxLeaf < 1)
+			return AJA_SIMD_NONE;
+		__cpuid(info, 1);
+		const bool hasSSE41	((info[2] & (1 << 19)) != 0);
+		const bool osAVX	((info[2] & (1 << 27)) != 0  &&  (info[2] & (1 << 28)) != 0  &&  (_xgetbv(0) & 0x6) == 0x6);
+		if (osAVX  &&  maxLeaf >= 7)
+		{
+			__cpuidex(info, 7, 0);
+			if (info[1] & (1 << 5))
+				return AJA_SIMD_AVX2;
+		}
+		return hasSSE41 ? AJA_SIMD_SSE41 : AJA_SIMD_NONE;
+	#else
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2"))
+			return AJA_SIMD_AVX2;
+		if (__builtin_cpu_supports("sse4.1"))
+			return AJA_SIMD_SSE41;
+		return AJA_SIMD_NONE;
+	#endif
+#elif defined(AJA_SIMD_ARM)
+	return AJA_SIMD_NEON;	//	Advanced SIMD is mandatory wherever __ARM_NEON is defined
+#else
+	return AJA_SIMD_NONE;
+#endif
+}
+
+//	Each instruction set's kernels are in a constant table, so switching kernels is one pointer store,
+//	and callers never see the functions of two different levels mixed together.
+struct PixelKernels
+{
+	AJA_SIMDLevel	fLevel;
+	UnPackFunc		fUnPack;
+	PackFunc		fPack;
+	Find10Func		fFind10;
+	Find8Func		fFind8;
+};
+
+static const PixelKernels	sScalarKernels	= {AJA_SIMD_NONE,	UnPack10BitYCbCr_Default,	Pack10BitYCbCr_Default,	Find10BitZeroWord_Scalar,	Find8BitZeroByte_Scalar};
+#if defined(AJA_SIMD_X86)
+static const PixelKernels	sSSE41Kernels	= {AJA_SIMD_SSE41,	UnPack10BitYCbCr_SSE41,		Pack10BitYCbCr_SSE41,	Find10BitZeroWord_SSE41,	Find8BitZeroByte_SSE41};
+static const PixelKernels	sAVX2Kernels	= {AJA_SIMD_AVX2,	UnPack10BitYCbCr_AVX2,		Pack10BitYCbCr_AVX2,	Find10BitZeroWord_AVX2,		Find8BitZeroByte_AVX2};
+#endif
+#if defined(AJA_SIMD_ARM)
+static const PixelKernels	sNEONKernels	= {AJA_SIMD_NEON,	UnPack10BitYCbCr_NEON,		Pack10BitYCbCr_NEON,	Find10BitZeroWord_NEON,		Find8BitZeroByte_NEON};
+#endif
+
+static const PixelKernels * KernelsForLevel (const AJA_SIMDLevel inLevel)
+{
+	switch (inLevel)
+	{
+	#if defined(AJA_SIMD_X86)
+		case AJA_SIMD_SSE41:	return &sSSE41Kernels;
+		case AJA_SIMD_AVX2:		return &sAVX2Kernels;
+	#endif
+	#if defined(AJA_SIMD_ARM)
+		case AJA_SIMD_NEON:		return &sNEONKernels;
+	#endif
+		default:				break;
+	}
+	return &sScalarKernels;
+}
+
+//	NULL until first use or AJA_SetSIMDLevel
+#if defined(AJA_USE_CPLUSPLUS11)
+	static std::atomic<const PixelKernels *>	sCurrentKernels (NULL);
+#else
+	static const PixelKernels * volatile		sCurrentKernels (NULL);	//	Aligned pointer loads & stores don't tear
+#endif
+
+static const PixelKernels & CurrentKernels (void)
+{
+#if defined(AJA_USE_CPLUSPLUS11)
+	const PixelKernels * pKernels (sCurrentKernels.load(std::memory_order_acquire));
+	if (!pKernels)
+	{	//	First use -- an AJA_SetSIMDLevel from another thread meanwhile wins
+		const PixelKernels * pExpected (NULL);
+		pKernels = KernelsForLevel(AJA_GetSupportedSIMDLevel());
+		if (!sCurrentKernels.compare_exchange_strong(pExpected, pKernels, std::memory_order_acq_rel))
+			pKernels = pExpected;
+	}
+#else
+	const PixelKernels * pKernels (sCurrentKernels);
+	if (!pKernels)
+		sCurrentKernels = pKernels = KernelsForLevel(AJA_GetSupportedSIMDLevel());
+#endif
+	return *pKernels;
+}
+
+AJA_SIMDLevel AJA_GetSupportedSIMDLevel (void)
+{
+	static const AJA_SIMDLevel sSupportedLevel (DetectSIMDLevel());	//	Detected once, by the first caller
+	return sSupportedLevel;
+}
+
+AJA_SIMDLevel AJA_GetSIMDLevel (void)
+{
+	return CurrentKernels().fLevel;
+}
+
+bool AJA_SetSIMDLevel (const AJA_SIMDLevel inLevel)
+{
+	const AJA_SIMDLevel supported (AJA_GetSupportedSIMDLevel());
+	switch (inLevel)
+	{
+		case AJA_SIMD_NONE:		break;
+		case AJA_SIMD_SSE41:	if (supported != AJA_SIMD_SSE41  &&  supported != AJA_SIMD_AVX2)	return false;
+								break;
+		case AJA_SIMD_AVX2:		if (supported != AJA_SIMD_AVX2)		return false;
+								break;
+		case AJA_SIMD_NEON:		if (supported != AJA_SIMD_NEON)		return false;
+								break;
+		default:				return false;
+	}
+#if defined(AJA_USE_CPLUSPLUS11)
+	sCurrentKernels.store(KernelsForLevel(inLevel), std::memory_order_release);
+#else
+	sCurrentKernels = KernelsForLevel(inLevel);
+#endif
+	return true;
+}
+
+const char * AJA_SIMDLevelToString (const AJA_SIMDLevel inLevel)
+{
+	switch (inLevel)
+	{
+		case AJA_SIMD_NONE:		return "Scalar";
+		case AJA_SIMD_SSE41:	return "SSE4.1";
+		case AJA_SIMD_AVX2:		return "AVX2";
+		case AJA_SIMD_NEON:		return "NEON";
+		default:				break;
+	}
+	return "";
+}
+
+void AJA_UnPack10BitYCbCrLine (const uint32_t * pInPacked, uint16_t * pOutUnpacked, const uint32_t inNumPixels)
+{
+	CurrentKernels().fUnPack(pInPacked, pOutUnpacked, inNumPixels);
+}
+
+void AJA_Pack10BitYCbCrLine (const uint16_t * pInUnpacked, uint32_t * pOutPacked, const uint32_t inNumPixels)
+{
+	CurrentKernels().fPack(pInUnpacked, pOutPacked, inNumPixels);
+}
+
+uint32_t AJA_Find10BitYCbCrZeroWord (const uint32_t * pInPacked, const uint32_t inNumWords, const uint32_t inStartWord)
+{
+	return CurrentKernels().fFind10(pInPacked, inNumWords, inStartWord);
+}
+
+uint32_t AJA_Find8BitYCbCrZeroByte (const uint8_t * pInPacked, const uint32_t inNumBytes, const uint32_t inStartByte)
+{
+	return CurrentKernels().fFind8(pInPacked, inNumBytes, inStartByte);
+}
@@ -0,0 +1,84 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		pixelkernels.h
+	@brief		Declares the ajabase library's vectorized pixel packing kernels and their runtime CPU dispatcher.
+	@copyright	(C) 2023 AJA Video Systems, Inc.  All rights reserved.
+**/
+
+#ifndef AJA_PIXELKERNELS_H
+#define AJA_PIXELKERNELS_H
+
+#include "ajabase/common/public.h"
+
+/**
+	@brief	Identifies the instruction set used by the pixel kernels.
+**/
+typedef enum
+{
+	AJA_SIMD_NONE,		///< @brief	Portable scalar code
+	AJA_SIMD_SSE41,		///< @brief	x86 SSE4.1
+	AJA_SIMD_AVX2,		///< @brief	x86 AVX2
+	AJA_SIMD_NEON,		///< @brief	ARM NEON (Advanced SIMD)
+	AJA_SIMD_INVALID
+} AJA_SIMDLevel;
+
+/**
+	@return		The best instruction set supported by the host CPU (and compiled into this library).
+**/
+AJA_SIMDLevel AJA_EXPORT AJA_GetSupportedSIMDLevel (void);
+
+/**
+	@return		The instruction set currently used by the pixel kernels. Initially this is AJA_GetSupportedSIMDLevel.
+**/
+AJA_SIMDLevel AJA_EXPORT AJA_GetSIMDLevel (void);
+
+/**
+	@brief		Overrides the instruction set used by the pixel kernels (e.g. to compare against the scalar code).
+	@param[in]	inLevel		Specifies the instruction set to use. AJA_SIMD_NONE always succeeds.
+	@return		True if successful; false if the host CPU doesn't support the requested instruction set.
+**/
+bool AJA_EXPORT AJA_SetSIMDLevel (const AJA_SIMDLevel inLevel);
+
+/**
+	@return		A string containing the name of the given instruction set.
+**/
+const char * AJA_EXPORT AJA_SIMDLevelToString (const AJA_SIMDLevel inLevel);
+
+/**
+	@brief		Unpacks a line of 10-bit YCbCr (v210) into one 16-bit word per component.
+	@param[in]	pInPacked		Specifies the packed source line. Must contain at least ceil(inNumPixels*2/3) words.
+	@param[out]	pOutUnpacked	Specifies the destination buffer. It receives ceil(inNumPixels*2/3)*3 components.
+	@param[in]	inNumPixels		Specifies the line width, in pixels.
+**/
+void AJA_EXPORT AJA_UnPack10BitYCbCrLine (const uint32_t * pInPacked, uint16_t * pOutUnpacked, const uint32_t inNumPixels);
+
+/**
+	@brief		Packs a line of 16-bit-per-component YCbCr into 10-bit YCbCr (v210).
+	@param[in]	pInUnpacked		Specifies the unpacked source line. Must contain at least ceil(inNumPixels/6)*12 components.
+	@param[out]	pOutPacked		Specifies the destination buffer. It receives ceil(inNumPixels/6)*4 words.
+	@param[in]	inNumPixels		Specifies the line width, in pixels.
+	@note		Source components are not masked to 10 bits, matching the behavior of the original scalar code.
+**/
+void AJA_EXPORT AJA_Pack10BitYCbCrLine (const uint16_t * pInUnpacked, uint32_t * pOutPacked, const uint32_t inNumPixels);
+
+/**
+	@brief		Finds the next 32-bit word of a 10-bit YCbCr (v210) line that has a component equal to 0x000.
+				In a VANC line this can only be the start of an ancillary data flag (000 3FF 3FF), since 0x000 is
+				excluded from video samples and from every parity-protected packet word.
+	@param[in]	pInPacked		Specifies the packed line.
+	@param[in]	inNumWords		Specifies the number of 32-bit words in the line.
+	@param[in]	inStartWord		Specifies the index of the first word to search.
+	@return		The index of the word found, or inNumWords if there are none.
+**/
+uint32_t AJA_EXPORT AJA_Find10BitYCbCrZeroWord (const uint32_t * pInPacked, const uint32_t inNumWords, const uint32_t inStartWord = 0);
+
+/**
+	@brief		Finds the next byte of an 8-bit YCbCr ('2vuy') line that equals 0x00.
+	@param[in]	pInPacked		Specifies the line.
+	@param[in]	inNumBytes		Specifies the number of bytes in the line.
+	@param[in]	inStartByte		Specifies the index of the first byte to search.
+	@return		The index of the byte found, or inNumBytes if there are none.
+**/
+uint32_t AJA_EXPORT AJA_Find8BitYCbCrZeroByte (const uint8_t * pInPacked, const uint32_t inNumBytes, const uint32_t inStartByte = 0);
+
+#endif	//	AJA_PIXELKERNELS_H
@@ -18,9 +18,118 @@ const int kTCDigSpace		= 13;			// index of ' ' character
 const int kTCMaxTCChars = 15;				// number of characters we know how to make
 
 
+// how the samples of a plane are packed
+enum
+{
+	kTCLayout8Bit,			// one sample per byte
+	kTCLayout10BitLE,		// three 10-bit samples per little-endian 32-bit word, from bit 0 (v210, 10-bit RGB)
+	kTCLayout10BitDPX,		// three 10-bit samples per big-endian 32-bit word, from bit 2
+	kTCLayout10BitDPXLE,	// three 10-bit samples per little-endian 32-bit word, from bit 2
+	kTCLayout10BitPacked,	// four 10-bit samples per 5 bytes (10-bit packed planar)
+	kTCLayout12BitPacked,	// two 12-bit samples per 3 bytes (36-bit RGB)
+	kTCLayout16Bit			// one little-endian 16-bit sample per 2 bytes
+};
+
+
+static int CharIndex (const char inChar)
+{
+	if ( inChar >= '0' && inChar <= '9' )
+		return inChar - '0';
+	else if ( inChar == ':' )
+		return kTCDigColon;
+	else if ( inChar == ';' )
+		return kTCDigSemicolon;
+	return kTCDigSpace;
+}
+
+
+static inline uint32_t BlendSample (const uint32_t dst, const uint32_t box, const uint32_t weight)
+{
+	return (dst * (256 - weight) + box * weight + 128) >> 8;
+}
+
+// blends 8-bit samples toward the box, leaving the ones masked off (alpha) alone
+static void BlendBox8 (uint8_t * pDst, const uint8_t * pBox, const uint8_t * pMask, const int numBytes, const uint32_t weight)
+{
+	for (int i = 0; i < numBytes; i++)
+		pDst[i] = uint8_t(BlendSample(pDst[i], pBox[i], pMask[i] * weight));
+}
+
+// blends 16-bit samples toward the box
+static void BlendBox16 (uint16_t * pDst, const uint16_t * pBox, const int numSamples, const uint32_t weight)
+{
+	for (int i = 0; i < numSamples; i++)
+		pDst[i] = uint16_t(BlendSample(pDst[i], pBox[i], weight));
+}
+
+// blends three 10-bit samples per 32-bit word toward the box, leaving the other 2 bits alone
+template <int kFirstBit, bool kBigEndian>
+static void BlendBox10In32 (uint32_t * pDst, const uint32_t * pBox, const int numWords, const uint32_t weight)
+{
+	for (int i = 0; i < numWords; i++)
+	{
+		const uint32_t dst = kBigEndian ? AJA_ENDIAN_SWAP32(pDst[i]) : pDst[i];
+		const uint32_t box = kBigEndian ? AJA_ENDIAN_SWAP32(pBox[i]) : pBox[i];
+		uint32_t out = dst & ~(0x3FFFFFFFu << kFirstBit);
+		out |= BlendSample((dst >> (kFirstBit +  0)) & 0x3FF, (box >> (kFirstBit +  0)) & 0x3FF, weight) << (kFirstBit +  0);
+		out |= BlendSample((dst >> (kFirstBit + 10)) & 0x3FF, (box >> (kFirstBit + 10)) & 0x3FF, weight) << (kFirstBit + 10);
+		out |= BlendSample((dst >> (kFirstBit + 20)) & 0x3FF, (box >> (kFirstBit + 20)) & 0x3FF, weight) << (kFirstBit + 20);
+		pDst[i] = kBigEndian ? AJA_ENDIAN_SWAP32(out) : out;
+	}
+}
+
+// blends samples packed in a little-endian bit stream, kSamples to every kChunkBytes, toward the box
+template <int kChunkBytes, int kSamples, int kBits>
+static void BlendBoxPacked (uint8_t * pDst, const uint8_t * pBox, const int numBytes, const uint32_t weight)
+{
+	const uint64_t sampleMask = (uint64_t(1) << kBits) - 1;
+	for (int i = 0; i + kChunkBytes <= numBytes; i += kChunkBytes)
+	{
+		uint64_t dst = 0, box = 0;
+		for (int b = 0; b < kChunkBytes; b++)
+		{
+			dst |= uint64_t(pDst[i + b]) << (8 * b);
+			box |= uint64_t(pBox[i + b]) << (8 * b);
+		}
+
+		uint64_t out = 0;
+		for (int s = 0; s < kSamples; s++)
+			out |= uint64_t(BlendSample(uint32_t(dst >> (s * kBits)) & sampleMask, uint32_t(box >> (s * kBits)) & sampleMask, weight)) << (s * kBits);
+
+		for (int b = 0; b < kChunkBytes; b++)
+			pDst[i + b] = uint8_t(out >> (8 * b));
+	}
+}
+
+static void BlendBox (const int layout, uint8_t * pDst, const uint8_t * pBox, const uint8_t * pMask, const int numBytes, const uint32_t weight)
+{
+	switch (layout)
+	{
+		case kTCLayout8Bit:			BlendBox8 (pDst, pBox, pMask, numBytes, weight);				break;
+		case kTCLayout10BitLE:		BlendBox10In32<0, false> (reinterpret_cast<uint32_t*>(pDst), reinterpret_cast<const uint32_t*>(pBox), numBytes / 4, weight);	break;
+		case kTCLayout10BitDPX:		BlendBox10In32<2, true>	 (reinterpret_cast<uint32_t*>(pDst), reinterpret_cast<const uint32_t*>(pBox), numBytes / 4, weight);	break;
+		case kTCLayout10BitDPXLE:	BlendBox10In32<2, false> (reinterpret_cast<uint32_t*>(pDst), reinterpret_cast<const uint32_t*>(pBox), numBytes / 4, weight);	break;
+		case kTCLayout10BitPacked:	BlendBoxPacked<5, 4, 10> (pDst, pBox, numBytes, weight);	break;
+		case kTCLayout12BitPacked:	BlendBoxPacked<3, 2, 12> (pDst, pBox, numBytes, weight);	break;
+		case kTCLayout16Bit:		BlendBox16 (reinterpret_cast<uint16_t*>(pDst), reinterpret_cast<const uint16_t*>(pBox), numBytes / 2, weight);	break;
+	}
+}
+
+// writes a sample into a little-endian bit stream
+static void PutSample (char * pBytes, const int bitOffset, const int numBits, const int value)
+{
+	for (int bit = 0; bit < numBits; bit++)
+	{
+		char & byte = pBytes[(bitOffset + bit) / 8];
+		const char mask = char(1 << ((bitOffset + bit) % 8));
+		byte = (value & (1 << bit)) ? char(byte | mask) : char(byte & ~mask);
+	}
+}
+
+
 AJATimeCodeBurn::AJATimeCodeBurn(void) :
 	_bRendered(false),
-	_pCharRenderMap(NULL),
+	_boxOpacity(100),
 	_charRenderPixelFormat(AJA_PixelFormat_Unknown),
 	_charRenderHeight(0),
 	_charRenderWidth(0),
@@ -34,11 +143,6 @@ AJATimeCodeBurn::AJATimeCodeBurn(void) :
 
 AJATimeCodeBurn::~AJATimeCodeBurn(void)
 {
-	if (_pCharRenderMap != NULL)
-	{
-		delete []_pCharRenderMap;
-		_pCharRenderMap = NULL;
-	}
 }
 
 
@@ -60,25 +164,54 @@ bool AJATimeCodeBurn::BurnTimeCode (void * pBaseVideoAddress, const std::string
 
 	_charPositionY = (_charRenderHeight * percentY) / 100;
 
-	// 10-bit YUV has to start on a 16-byte boundary in order to match the "cadence"
-	if (_charRenderPixelFormat == AJA_PixelFormat_YCbCr10)
-		_charPositionX &= ~0x0f;
+	// keep the characters inside the raster, and on an even line if the chroma is vertically subsampled
+	if (_charPositionY > _charRenderHeight - _charHeightLines)
+		_charPositionY = _charRenderHeight - _charHeightLines;
+	for (size_t p = 1; p < _planes.size(); p++)
+		if (_planes[p].lineShift)
+			_charPositionY &= ~1;
+
+	for (size_t p = 0; p < _planes.size(); p++)
+		if (_planes[p].positionX + int(timeCodeLength) * _planes[p].charWidthBytes > _planes[p].rowBytes)
+			return false;	//	String too wide
 
-	char *pFrameBuff = reinterpret_cast<char*>(pBaseVideoAddress) + (_charPositionY * _rowBytes) + _charPositionX;
+	// only the characters that changed since the last burn get copied into the strips
+	ComposeString (inTimeCodeStr);
 
-	for (size_t charNdx(0);	 charNdx < timeCodeLength;	charNdx++)
+	const uint32_t weight ((_boxOpacity * 256 + 50) / 100);
+	for (size_t p = 0; p < _planes.size(); p++)
 	{
-		const char currentChar (inTimeCodeStr[charNdx]);
-		uint32_t digitOffset (kTCDigSpace);
-		if ( currentChar >= '0' && currentChar <= '9' )
-			digitOffset = currentChar - '0';
-		else if ( currentChar == ':' )
-			digitOffset = kTCDigColon;
-		else if ( currentChar == ';' )
-			digitOffset = kTCDigSemicolon;
-
-		CopyDigit (digitOffset, pFrameBuff);
-		pFrameBuff += _charWidthBytes;
+		const BurnPlane & plane (_planes[p]);
+		const int stripRowBytes	(kTCMaxTCChars * plane.charWidthBytes);
+		const int numBytes		(int(timeCodeLength) * plane.charWidthBytes);
+		uint8_t * pDst (reinterpret_cast<uint8_t*>(pBaseVideoAddress) + plane.offset
+						+ size_t(_charPositionY >> plane.lineShift) * plane.rowBytes + plane.positionX);
+		const uint8_t * pSrc (reinterpret_cast<const uint8_t*>(&plane.strip[0]));
+
+		for (int y = 0; y < plane.charHeightLines; y++, pDst += plane.rowBytes, pSrc += stripRowBytes)
+		{
+			// opaque box: the whole string is one copy per line
+			if (_boxOpacity >= 100)
+			{
+				memcpy(pDst, pSrc, numBytes);
+				continue;
+			}
+
+			// blended box: blend the box, then copy the runs of each character that hold strokes
+			const uint8_t * pBox (reinterpret_cast<const uint8_t*>(&plane.glyphs[(kTCDigSpace * plane.charHeightLines + y) * plane.charWidthBytes]));
+			const uint8_t * pMask (plane.blendMask.empty() ? NULL : &plane.blendMask[0]);
+			for (size_t charNdx = 0; charNdx < timeCodeLength; charNdx++)
+			{
+				uint8_t * pCharDst (pDst + charNdx * plane.charWidthBytes);
+				const uint8_t * pCharSrc (pSrc + charNdx * plane.charWidthBytes);
+				if (weight)
+					BlendBox (plane.layout, pCharDst, pBox, pMask, plane.charWidthBytes, weight);
+
+				const size_t charRow (size_t(CharIndex(inTimeCodeStr[charNdx])) * plane.charHeightLines + y);
+				for (uint32_t span = plane.spanIndex[charRow]; span < plane.spanIndex[charRow + 1]; span += 2)
+					memcpy(pCharDst + plane.spans[span], pCharSrc + plane.spans[span], plane.spans[span + 1]);
+			}
+		}
 	}
 
 	return true;
@@ -90,13 +223,45 @@ bool AJATimeCodeBurn::BurnTimeCode (char * pBaseVideoAddress, const char * pTime
 	return BurnTimeCode(pBaseVideoAddress, std::string(pTimeCodeString), percentY);
 }
 
+
+bool AJATimeCodeBurn::SetBoxOpacity (const uint32_t inPercent)
+{
+	if (inPercent > 100)
+		return false;
+	_boxOpacity = inPercent;
+	return true;
+}
+
+
+void AJATimeCodeBurn::ComposeString (const std::string & inTimeCodeStr)
+{
+	for (size_t charNdx = 0; charNdx < inTimeCodeStr.length(); charNdx++)
+	{
+		if (charNdx < _stripString.length() && _stripString[charNdx] == inTimeCodeStr[charNdx])
+			continue;	//	already there
+
+		const int digitOffset (CharIndex(inTimeCodeStr[charNdx]));
+		for (size_t p = 0; p < _planes.size(); p++)
+		{
+			BurnPlane & plane (_planes[p]);
+			const int stripRowBytes (kTCMaxTCChars * plane.charWidthBytes);
+			const char * pDigit (&plane.glyphs[digitOffset * plane.charWidthBytes * plane.charHeightLines]);
+			char * pStrip (&plane.strip[charNdx * plane.charWidthBytes]);
+			for (int y = 0; y < plane.charHeightLines; y++)
+				memcpy(pStrip + y * stripRowBytes, pDigit + y * plane.charWidthBytes, plane.charWidthBytes);
+		}
+	}
+	_stripString = inTimeCodeStr;
+}
+
+
 void AJATimeCodeBurn::CopyDigit (int digitOffset,char *pFrameBuff)
 {
-	char *pDigit = (_pCharRenderMap + (digitOffset * _charWidthBytes * _charHeightLines));
+	const char *pDigit = (&_planes[0].glyphs[0] + (digitOffset * _charWidthBytes * _charHeightLines));
 
 	for (int y = 0; y < _charHeightLines; y++)
 	{
-		char *pSrc = (pDigit + (y * _charWidthBytes));
+		const char *pSrc = (pDigit + (y * _charWidthBytes));
 		char *pDst = (pFrameBuff + (y * _rowBytes));
 
 		memcpy(pDst, pSrc, _charWidthBytes);
@@ -444,77 +609,89 @@ static const char CharMap[kTCMaxTCChars][kTCDigitDotHeight][kTCDigitDotWidth] =
 };
 
 
-bool AJATimeCodeBurn::RenderTimeCodeFont( AJA_PixelFormat pixelFormat, uint32_t numPixels, uint32_t numLines )
+// how a plane of a pixel format is laid out
+struct TCPlaneFormat
 {
-	bool bResult = true;
-
-	// see if we've already rendered this format/size
-	if (_bRendered && _pCharRenderMap != NULL && pixelFormat == _charRenderPixelFormat && (int)numLines == _charRenderHeight && (int)numPixels == _charRenderWidth)
-	{
-		return bResult;			// already rendered...
-	}
+	int		layout;			// how the samples are packed
+	int		granulePixels;	// the plane packs this many (luma) pixels...
+	int		granuleBytes;	// ...into this many bytes
+	int		lineShift;		// 1 if the plane has half as many lines as the raster, else 0
+	int		alphaByte;		// 8-bit samples only: the byte of each granule holding alpha, or -1
+};
 
-	else
+// these are the pixel formats we know how to do...
+static int GetPlaneFormats (const AJA_PixelFormat pixelFormat, TCPlaneFormat * pPlanes)
+{
+	const TCPlaneFormat kYCbCr8			= {kTCLayout8Bit,			2,	4,	0,	-1};
+	const TCPlaneFormat kARGB8			= {kTCLayout8Bit,			1,	4,	0,	 3};
+	const TCPlaneFormat kRGBA8			= {kTCLayout8Bit,			1,	4,	0,	 0};
+	const TCPlaneFormat kRGB8			= {kTCLayout8Bit,			1,	3,	0,	-1};
+	const TCPlaneFormat kYCbCr10		= {kTCLayout10BitLE,		6,	16,	0,	-1};
+	const TCPlaneFormat kRGB10			= {kTCLayout10BitLE,		1,	4,	0,	-1};
+	const TCPlaneFormat kRGBDPX			= {kTCLayout10BitDPX,		1,	4,	0,	-1};
+	const TCPlaneFormat kRGBDPXLE		= {kTCLayout10BitDPXLE,		1,	4,	0,	-1};
+	const TCPlaneFormat kRGB12			= {kTCLayout12BitPacked,	2,	9,	0,	-1};
+	const TCPlaneFormat kRGB16			= {kTCLayout16Bit,			1,	6,	0,	-1};
+	const TCPlaneFormat kY8				= {kTCLayout8Bit,			1,	1,	0,	-1};
+	const TCPlaneFormat kCbCr8_422		= {kTCLayout8Bit,			2,	2,	0,	-1};
+	const TCPlaneFormat kCbCr8_420		= {kTCLayout8Bit,			2,	2,	1,	-1};
+	const TCPlaneFormat kC8_422			= {kTCLayout8Bit,			2,	1,	0,	-1};
+	const TCPlaneFormat kC8_420			= {kTCLayout8Bit,			2,	1,	1,	-1};
+	const TCPlaneFormat kY10Packed		= {kTCLayout10BitPacked,	4,	5,	0,	-1};
+	const TCPlaneFormat kCbCr10_422		= {kTCLayout10BitPacked,	4,	5,	0,	-1};
+	const TCPlaneFormat kCbCr10_420		= {kTCLayout10BitPacked,	4,	5,	1,	-1};
+	const TCPlaneFormat kY16			= {kTCLayout16Bit,			1,	2,	0,	-1};
+	const TCPlaneFormat kC16_422		= {kTCLayout16Bit,			2,	2,	0,	-1};
+	const TCPlaneFormat kC16_420		= {kTCLayout16Bit,			2,	2,	1,	-1};
+
+	switch (pixelFormat)
 	{
-		// these are the pixel formats we know how to do...
-		bool bFormatOK = true;
-		_rowBytes = AJA_CalcRowBytesForFormat(pixelFormat,numPixels);
-		int bytesPerPixel;
-		switch (pixelFormat)
-		{
 		case AJA_PixelFormat_YCbCr8:
-			bytesPerPixel = 2;
-			break;
-
-		case AJA_PixelFormat_YUY28:
-			bytesPerPixel = 2;
-			break;
-
+		case AJA_PixelFormat_YUY28:				pPlanes[0] = kYCbCr8;		return 1;
 		case AJA_PixelFormat_ABGR8:
-			bytesPerPixel = 4;
-			break;
-
-		case AJA_PixelFormat_ARGB8:
-			bytesPerPixel = 4;
-			break;
-
-		case AJA_PixelFormat_RGBA8:
-			bytesPerPixel = 4;
-			break;
-
-		case AJA_PixelFormat_YCbCr10:
-			bytesPerPixel = 3;		// not really - we'll have to override this wherever "bytesPerPixel" is used below...
-			break;
+		case AJA_PixelFormat_ARGB8:				pPlanes[0] = kARGB8;		return 1;
+		case AJA_PixelFormat_RGBA8:				pPlanes[0] = kRGBA8;		return 1;
+		case AJA_PixelFormat_RGB8_PACK:
+		case AJA_PixelFormat_BGR8_PACK:			pPlanes[0] = kRGB8;			return 1;
+		case AJA_PixelFormat_YCbCr10:			pPlanes[0] = kYCbCr10;		return 1;
+		case AJA_PixelFormat_RGB10:				pPlanes[0] = kRGB10;		return 1;
+		case AJA_PixelFormat_RGB_DPX:			pPlanes[0] = kRGBDPX;		return 1;
+		case AJA_PixelFormat_RGB_DPX_LE:		pPlanes[0] = kRGBDPXLE;		return 1;
+		case AJA_PixelFormat_RGB12:				pPlanes[0] = kRGB12;		return 1;
+		case AJA_PixelFormat_RGB16:				pPlanes[0] = kRGB16;		return 1;
+
+		case AJA_PixelFormat_YCBCR8_420PL:		pPlanes[0] = kY8;			pPlanes[1] = kCbCr8_420;	return 2;
+		case AJA_PixelFormat_YCBCR8_422PL:		pPlanes[0] = kY8;			pPlanes[1] = kCbCr8_422;	return 2;
+		case AJA_PixelFormat_YCBCR10_420PL:		pPlanes[0] = kY10Packed;	pPlanes[1] = kCbCr10_420;	return 2;
+		case AJA_PixelFormat_YCBCR10_422PL:		pPlanes[0] = kY10Packed;	pPlanes[1] = kCbCr10_422;	return 2;
+		case AJA_PixelFormat_YCBCR8_420PL3:		pPlanes[0] = kY8;			pPlanes[1] = pPlanes[2] = kC8_420;	return 3;
+		case AJA_PixelFormat_YCBCR8_422PL3:		pPlanes[0] = kY8;			pPlanes[1] = pPlanes[2] = kC8_422;	return 3;
+		case AJA_PixelFormat_YCBCR10_420PL3LE:	pPlanes[0] = kY16;			pPlanes[1] = pPlanes[2] = kC16_420;	return 3;
+		case AJA_PixelFormat_YCBCR10_422PL3LE:	pPlanes[0] = kY16;			pPlanes[1] = pPlanes[2] = kC16_422;	return 3;
 
-		case AJA_PixelFormat_RGB_DPX:
-			bytesPerPixel = 4;
+		default:
 			break;
+	}
+	return 0;
+}
 
-		case AJA_PixelFormat_RGB10:
-			bytesPerPixel = 4;
-			break;
 
-		case AJA_PixelFormat_RGB8_PACK:
-		case AJA_PixelFormat_BGR8_PACK:
-			bytesPerPixel = 3;
-			break;
+bool AJATimeCodeBurn::RenderTimeCodeFont( AJA_PixelFormat pixelFormat, uint32_t numPixels, uint32_t numLines )
+{
+	bool bResult = true;
 
-		case AJA_PixelFormat_YCBCR10_420PL:
-		case AJA_PixelFormat_YCBCR10_422PL:
-			bytesPerPixel = 2;		// not really - we'll have to override this wherever "bytesPerPixel" is used below...
-			break;
+	// see if we've already rendered this format/size
+	if (_bRendered && !_planes.empty() && pixelFormat == _charRenderPixelFormat && (int)numLines == _charRenderHeight && (int)numPixels == _charRenderWidth)
+	{
+		return bResult;			// already rendered...
+	}
 
-		case AJA_PixelFormat_YCBCR8_420PL:
-		case AJA_PixelFormat_YCBCR8_422PL:
-			bytesPerPixel = 1;
-			break;
-		
-		default:
-			bFormatOK = false;
-			break;
-		}
+	else
+	{
+		TCPlaneFormat planeFormats[3];
+		const int numPlanes = GetPlaneFormats(pixelFormat, planeFormats);
 
-		if (bFormatOK)
+		if (numPlanes)
 		{
 			// scale the characters based on the frame size they'll be used in
 			int dotScale = 1;					// SD scale
@@ -533,27 +710,51 @@ bool AJATimeCodeBurn::RenderTimeCodeFont( AJA_PixelFormat pixelFormat, uint32_t
 			//			else if (numLines > 650 && numPixels < 1100)
 			//				dotWidth = 1;			// 960x720
 
-			int charWidthBytes	= kTCDigitDotWidth	* dotWidth * bytesPerPixel;
-			if (pixelFormat == AJA_PixelFormat_YCbCr10)
-				charWidthBytes	= (kTCDigitDotWidth * dotWidth * 16) / 6;		// note: assumes kDigitDotWidth is evenly divisible by 6!
-			if ((pixelFormat == AJA_PixelFormat_YCBCR10_420PL) ||
-				(pixelFormat == AJA_PixelFormat_YCBCR10_422PL))
-				charWidthBytes	= (kTCDigitDotWidth * dotWidth * 5) / 4;		// note: assumes kDigitDotWidth is evenly divisible by 4!
-
+			// note: kDigitDotWidth must be evenly divisible by the pixels in each sample group (up to 6, for 10-bit YUV)
+			int charWidthPixels = kTCDigitDotWidth * dotWidth;
 			int charHeightLines = kTCDigitDotHeight * dotHeight;
 
-			// if we had a previous render map, free it now
-			if (_pCharRenderMap != NULL)
+			// burn-in offset: centered, on a pixel that starts a sample group in every plane
+			int alignPixels = 1;
+			for (int p = 0; p < numPlanes; p++)
+				if (planeFormats[p].granulePixels > alignPixels)
+					alignPixels = planeFormats[p].granulePixels;
+			int positionPixels = ((int)numPixels - (kTCNumBurnInChars * charWidthPixels)) / 2;
+			if (positionPixels < 0 || (int)numLines < charHeightLines)
+				return false;			// raster too small
+			positionPixels -= positionPixels % alignPixels;
+
+			std::vector<BurnPlane> planes(numPlanes);
+			size_t planeOffset = 0;
+			for (int p = 0; p < numPlanes; p++)
 			{
-				delete []_pCharRenderMap;
-				_pCharRenderMap = NULL;
+				const TCPlaneFormat & format = planeFormats[p];
+				BurnPlane & plane = planes[p];
+				plane.offset			= planeOffset;
+				plane.rowBytes			= (numPlanes > 1) ? ((int)numPixels / format.granulePixels * format.granuleBytes)
+														  : (int)AJA_CalcRowBytesForFormat(pixelFormat, numPixels);
+				plane.charWidthBytes	= charWidthPixels / format.granulePixels * format.granuleBytes;
+				plane.charHeightLines	= charHeightLines >> format.lineShift;
+				plane.positionX			= positionPixels / format.granulePixels * format.granuleBytes;
+				plane.lineShift			= format.lineShift;
+				plane.layout			= format.layout;
+				planeOffset += size_t(plane.rowBytes) * (numLines >> format.lineShift);
+
+				const size_t mapSize = size_t(kTCMaxTCChars) * plane.charWidthBytes * plane.charHeightLines;
+				plane.glyphs.assign(mapSize, 0);
+				plane.strip.assign(mapSize, 0);
+				if (format.layout == kTCLayout8Bit)
+				{
+					plane.blendMask.assign(plane.charWidthBytes, 1);
+					if (format.alphaByte >= 0)
+						for (int i = format.alphaByte; i < plane.charWidthBytes; i += format.granuleBytes)
+							plane.blendMask[i] = 0;
+				}
 			}
 
-			// malloc space for a new render map
-			_pCharRenderMap = new char[(kTCMaxTCChars * charWidthBytes * charHeightLines)];
-			if (_pCharRenderMap != NULL)
+			// render the characters into the first plane...
 			{
-				char *pRenderMap = _pCharRenderMap;
+				char *pRenderMap = &planes[0].glyphs[0];
 
 				// for each character...
 				for (int c = 0; c < kTCMaxTCChars; c++)
@@ -748,7 +949,9 @@ bool AJATimeCodeBurn::RenderTimeCodeFont( AJA_PixelFormat pixelFormat, uint32_t
 								}
 
 								else if ((pixelFormat == AJA_PixelFormat_YCBCR8_420PL) ||
-										 (pixelFormat == AJA_PixelFormat_YCBCR8_422PL))
+										 (pixelFormat == AJA_PixelFormat_YCBCR8_422PL) ||
+										 (pixelFormat == AJA_PixelFormat_YCBCR8_420PL3) ||
+										 (pixelFormat == AJA_PixelFormat_YCBCR8_422PL3))
 								{
 									char val = 0;
 									switch (dot)
@@ -766,30 +969,125 @@ bool AJATimeCodeBurn::RenderTimeCodeFont( AJA_PixelFormat pixelFormat, uint32_t
 									}
 								}
 
+								else if ((pixelFormat == AJA_PixelFormat_YCBCR10_420PL3LE) ||
+										 (pixelFormat == AJA_PixelFormat_YCBCR10_422PL3LE))
+								{
+									int val = 0;
+									switch (dot)
+									{
+									case 0:		val =  64;		break;
+									case 1:		val = 356;		break;
+									case 2:		val = 648;		break;
+									case 3:		val = 940;		break;
+									}
+
+									// each rendered pixel is duplicated N times
+									for (int xdup = 0; xdup < dotWidth; xdup++)
+									{
+										*pRenderMap++ = char(val & 0xff);	// Y
+										*pRenderMap++ = char(val >> 8);
+									}
+								}
+
+								else if (pixelFormat == AJA_PixelFormat_RGB_DPX_LE)
+								{
+									uint32_t val = 0;
+									switch (dot)
+									{
+									case 0:		val =  64;		break;	// 0x40
+									case 1:		val = 356;		break;	// 0x164
+									case 2:		val = 648;		break;	// 0x288
+									case 3:		val = 940;		break;	// 0x3ac
+									}
+									const uint32_t word = (val << 22) | (val << 12) | (val << 2);
+
+									// each rendered pixel is duplicated N times
+									for (int xdup = 0; xdup < dotWidth; xdup++)
+									{
+										*pRenderMap++ = char(word);
+										*pRenderMap++ = char(word >> 8);
+										*pRenderMap++ = char(word >> 16);
+										*pRenderMap++ = char(word >> 24);
+									}
+								}
+
+								else if (pixelFormat == AJA_PixelFormat_RGB12)
+								{
+									int val = 0;
+									switch (dot)
+									{
+									case 0:		val = 0x000;		break;
+									case 1:		val = 0x555;		break;
+									case 2:		val = 0xaaa;		break;
+									case 3:		val = 0xfff;		break;
+									}
+
+									// each rendered pixel is duplicated N times -- 2 pixels = 9 bytes
+									for (int xdup = 0; xdup < dotWidth; xdup++)
+									{
+										const int cadence = ((x * dotWidth) + xdup) % 2;
+										for (int component = 0; component < 3; component++)
+											PutSample (pRenderMap, (cadence * 3 + component) * 12, 12, val);	// R, G, B
+										if (cadence)
+											pRenderMap += 9;
+									}
+								}
+
+								else if (pixelFormat == AJA_PixelFormat_RGB16)
+								{
+									int val = 0;
+									switch (dot)
+									{
+									case 0:		val = 0x0000;		break;
+									case 1:		val = 0x5555;		break;
+									case 2:		val = 0xaaaa;		break;
+									case 3:		val = 0xffff;		break;
+									}
+
+									// each rendered pixel is duplicated N times
+									for (int xdup = 0; xdup < dotWidth; xdup++)
+									{
+										for (int component = 0; component < 3; component++)
+										{
+											*pRenderMap++ = char(val & 0xff);	// R, G, B
+											*pRenderMap++ = char(val >> 8);
+										}
+									}
+								}
+
 							}
 						}
 					}
 				}
+			}
 
-				_bRendered = true;
-				_charRenderPixelFormat	  = pixelFormat;
-				_charRenderHeight = numLines;
-				_charRenderWidth  = numPixels;
+			// ...the chroma planes are neutral throughout
+			for (int p = 1; p < numPlanes; p++)
+			{
+				BurnPlane & plane = planes[p];
+				const int bits = (plane.layout == kTCLayout8Bit) ? 8 : (plane.layout == kTCLayout16Bit ? 16 : 10);
+				const int neutral = (bits == 8) ? 0x80 : 0x200;
+				const int numSamples = int(plane.glyphs.size()) * 8 / bits;
+				for (int s = 0; s < numSamples; s++)
+					PutSample (&plane.glyphs[0], s * bits, bits, neutral);
+			}
 
-				// character sizes
-				_charWidthBytes	  = charWidthBytes;
-				_charHeightLines  = charHeightLines;
+			for (int p = 0; p < numPlanes; p++)
+				FindStrokes (planes[p], planeFormats[p].granulePixels, planeFormats[p].granuleBytes, dotWidth, dotHeight);
 
-				// burn-in offset
-				int byteWidth = (numPixels * bytesPerPixel);
-				if (pixelFormat == AJA_PixelFormat_YCbCr10)
-					byteWidth  = (numPixels * 16) / 6;		// in 10-bit YUV, 6 pixels = 16 bytes
-				if ((pixelFormat == AJA_PixelFormat_YCBCR10_420PL) ||
-					(pixelFormat == AJA_PixelFormat_YCBCR10_422PL))
-					byteWidth  = (numPixels * 5) / 4;		// in 10-bit YUV packed planer, 4 pixels = 5 bytes
+			_planes.swap(planes);
+			_stripString.clear();
 
-				_charPositionX = (byteWidth - (kTCNumBurnInChars * charWidthBytes)) / 2;		// assume centered
-			}
+			_bRendered = true;
+			_charRenderPixelFormat	  = pixelFormat;
+			_charRenderHeight = numLines;
+			_charRenderWidth  = numPixels;
+
+			// character sizes (of the first plane)
+			_charWidthBytes	  = _planes[0].charWidthBytes;
+			_charHeightLines  = charHeightLines;
+			_rowBytes		  = _planes[0].rowBytes;
+			_charPositionX	  = _planes[0].positionX;
 		}
 
 		else	// we don't know how to do this pixel format...
@@ -800,6 +1098,41 @@ bool AJATimeCodeBurn::RenderTimeCodeFont( AJA_PixelFormat pixelFormat, uint32_t
 }
 
 
+// finds the runs of sample groups in each character row that hold strokes
+void AJATimeCodeBurn::FindStrokes (BurnPlane & plane, int granulePixels, int granuleBytes, int dotWidth, int dotHeight)
+{
+	const int numGranules = plane.charWidthBytes / granuleBytes;
+	plane.spans.clear();
+	plane.spanIndex.assign(1, 0);
+
+	for (int c = 0; c < kTCMaxTCChars; c++)
+	{
+		for (int y = 0; y < plane.charHeightLines; y++)
+		{
+			int runStart = -1;
+			for (int g = 0; g <= numGranules; g++)
+			{
+				bool bStroke = false;
+				for (int line = (y << plane.lineShift); g < numGranules && line < ((y + 1) << plane.lineShift); line++)
+					for (int x = g * granulePixels; x < (g + 1) * granulePixels; x++)
+						if (CharMap[c][line / dotHeight][x / dotWidth])
+							bStroke = true;
+
+				if (bStroke && runStart < 0)
+					runStart = g;
+				else if (!bStroke && runStart >= 0)
+				{
+					plane.spans.push_back(uint16_t(runStart * granuleBytes));
+					plane.spans.push_back(uint16_t((g - runStart) * granuleBytes));
+					runStart = -1;
+				}
+			}
+			plane.spanIndex.push_back(uint32_t(plane.spans.size()));
+		}
+	}
+}
+
+
 // write a single chroma/luma pair of components
 // note that it's up to the caller to make sure that the chroma is the correct Cb or Cr,
 // and is properly timed with adjacent pixels!
@@ -11,6 +11,7 @@
 #include "ajabase/common/export.h"
 #include "ajabase/common/videotypes.h"
 #include <string>
+#include <vector>
 
 /**
  *	Class to support burning a simple timecode over raster.
@@ -47,15 +48,53 @@ public:
 	 */
 	AJA_EXPORT bool BurnTimeCode (char * pBaseVideoAddress, const char * pTimeCodeString, const uint32_t percentY);
 
+	/**
+	 *	Sets the opacity of the box behind the characters. At 100 (the default) the box is opaque
+	 *	black. Below 100 the box is alpha-blended over the raster, and only the character strokes
+	 *	are drawn opaque. At 0 there's no box at all.
+	 *
+	 *	@param[in]	inPercent			The box opacity, 0 - 100.
+	 *	@returns	True if successful;	 otherwise false.
+	 */
+	AJA_EXPORT bool SetBoxOpacity (const uint32_t inPercent);	//	New in SDK 17.1
+
+	/**
+	 *	@returns	The opacity of the box behind the characters, 0 - 100.
+	 */
+	AJA_EXPORT uint32_t GetBoxOpacity (void) const		{return _boxOpacity;}	//	New in SDK 17.1
+
 protected:
 
 	void CopyDigit (int digitOffset,char *pFrameBuff);
 	void writeV210Pixel (char **pBytePtr, int x, int c, int y);
 	void writeYCbCr10PackedPlanerPixel (char **pBytePtr, int x, int y);
 
+private:
+	// one plane of the raster, with the characters rendered in its sample packing
+	struct BurnPlane
+	{
+		std::vector<char>		glyphs;		// rendered characters, each one charHeightLines rows of charWidthBytes
+		std::vector<char>		strip;		// the last string burned, charHeightLines rows of kTCMaxTCChars characters
+		std::vector<uint32_t>	spanIndex;	// per character row, index of its first span (plus one entry at the end)
+		std::vector<uint16_t>	spans;		// byte offset/length pairs of the runs of each character row holding strokes
+		std::vector<uint8_t>	blendMask;	// 8-bit samples only: 0 for the alpha bytes of a character row, 1 for the rest
+		size_t					offset;		// offset (in bytes) of the plane from the base of the raster
+		int						rowBytes;
+		int						charWidthBytes;
+		int						charHeightLines;
+		int						positionX;	// offset (in bytes) from left side of the plane to first burn-in character
+		int						lineShift;	// 1 if the plane has half as many lines as the raster, else 0
+		int						layout;		// how samples are packed in the plane
+	};
+
+	void ComposeString (const std::string & inTimeCodeStr);
+	void FindStrokes (BurnPlane & plane, int granulePixels, int granuleBytes, int dotWidth, int dotHeight);
+
 private:
 	bool				_bRendered;			// set 'true' when Burn-In character map has been rendered
-	char *				_pCharRenderMap;	// ptr to rendered Burn-In character set
+	std::vector<BurnPlane>	_planes;		// rendered Burn-In character set, per plane
+	std::string			_stripString;		// the string composed in each plane's strip
+	uint32_t			_boxOpacity;		// box opacity, in percent
 	AJA_PixelFormat		_charRenderPixelFormat; // frame buffer format of rendered characters
 	int					_charRenderHeight;	// frame height for which rendered characters were rendered
 	int					_charRenderWidth;	// frame width for which rendered characters were rendered
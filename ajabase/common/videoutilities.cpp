@@ -7,6 +7,7 @@
 
 #include "common.h"
 #include "videoutilities.h"
+#include "pixelkernels.h"
 #include <string.h>
 
 
@@ -261,29 +262,14 @@ uint32_t AJA_CalcRowBytesForFormat(AJA_PixelFormat format, uint32_t width)
 // UnPack 10 Bit YCbCr Data to 16 bit Word per component
 void AJA_UnPack10BitYCbCrBuffer( uint32_t* packedBuffer, uint16_t* ycbcrBuffer, uint32_t numPixels )
 {
-	for (  uint32_t sampleCount = 0, dataCount = 0; 
-		sampleCount < (numPixels*2) ; 
-		sampleCount+=3,dataCount++ )
-	{
-		ycbcrBuffer[sampleCount]   =  packedBuffer[dataCount]&0x3FF;  
-		ycbcrBuffer[sampleCount+1] = (packedBuffer[dataCount]>>10)&0x3FF;  
-		ycbcrBuffer[sampleCount+2] = (packedBuffer[dataCount]>>20)&0x3FF;  
-	}
+	AJA_UnPack10BitYCbCrLine(packedBuffer, ycbcrBuffer, numPixels);
 }
 
 // PackTo10BitYCbCrBuffer
 // Pack 16 bit Word per component to 10 Bit YCbCr Data 
 void AJA_PackTo10BitYCbCrBuffer( uint16_t *ycbcrBuffer, uint32_t *packedBuffer,uint32_t numPixels )
 {
-	for ( uint32_t inputCount=0, outputCount=0; 
-		inputCount < (numPixels*2);
-		outputCount += 4,inputCount += 12 )
-	{
-		packedBuffer[outputCount]	= ycbcrBuffer[inputCount+0] + (ycbcrBuffer[inputCount+1]<<10) + (ycbcrBuffer[inputCount+2]<<20);
-		packedBuffer[outputCount+1] = ycbcrBuffer[inputCount+3] + (ycbcrBuffer[inputCount+4]<<10) + (ycbcrBuffer[inputCount+5]<<20);
-		packedBuffer[outputCount+2] = ycbcrBuffer[inputCount+6] + (ycbcrBuffer[inputCount+7]<<10) + (ycbcrBuffer[inputCount+8]<<20);
-		packedBuffer[outputCount+3] = ycbcrBuffer[inputCount+9] + (ycbcrBuffer[inputCount+10]<<10) + (ycbcrBuffer[inputCount+11]<<20);
-	}
+	AJA_Pack10BitYCbCrLine(ycbcrBuffer, packedBuffer, numPixels);
 }
 
 // AJA_PackTo10BitYCbCrDPXBuffer
@@ -0,0 +1,662 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		asyncfilewriter.cpp
+	@brief		Implements the AJAAsyncFileWriter class.
+	@copyright	(C) 2022 AJA Video Systems, Inc.  All rights reserved.
+**/
+
+#include "ajabase/system/asyncfilewriter.h"
+#include "ajabase/system/debug.h"
+#include "ajabase/system/systemtime.h"
+#include "ajabase/system/thread.h"
+#include <string.h>
+
+#if defined(AJA_LINUX) || defined(AJA_MAC)
+	#include <errno.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <sys/stat.h>
+#endif
+#if defined(AJA_LINUX)
+	#include <poll.h>
+	#include <sys/mman.h>
+	#include <sys/syscall.h>
+	#if defined(__NR_io_uring_setup) && defined(__has_include)
+		#if __has_include(<linux/io_uring.h>)
+			#include <linux/io_uring.h>
+			#if defined(IORING_FEAT_FAST_POLL)	//	5.7 headers, so IORING_OP_WRITE is there
+				#define AJA_ASYNC_IO_URING
+			#endif
+		#endif
+	#endif
+#endif
+
+using namespace std;
+
+#define AFWFAIL(__x__)		AJA_sERROR	(AJA_DebugUnit_App_DiskWrite, __FUNCTION__ << ": " << __x__)
+#define AFWWARN(__x__)		AJA_sWARNING(AJA_DebugUnit_App_DiskWrite, __FUNCTION__ << ": " << __x__)
+#define AFWNOTE(__x__)		AJA_sNOTICE	(AJA_DebugUnit_App_DiskWrite, __FUNCTION__ << ": " << __x__)
+
+static const uint32_t	kDirectAlignment	(4096);		//	Covers 512-byte and 4K logical block devices
+static const uint32_t	kMaxQueueDepth		(1024);
+static const int		kReapPollMs			(100);		//	How often an idle reap thread checks for Stop
+static const uint32_t	kMaxPoolThreads		(8);
+
+
+struct AJAAsyncFileWriter::Request
+{
+	const uint8_t *	pBuffer;
+	uint32_t		length;
+	uint32_t		done;		//	Bytes written so far
+	uint64_t		offset;
+	uint64_t		userTag;
+	uint64_t		startUs;
+	bool			direct;
+};
+
+
+#if defined(AJA_ASYNC_IO_URING)
+	static int io_uring_setup (const unsigned inEntries, struct io_uring_params * pParams)
+	{
+		return int(::syscall(__NR_io_uring_setup, inEntries, pParams));
+	}
+
+	static int io_uring_enter (const int inFd, const unsigned inToSubmit, const unsigned inMinComplete, const unsigned inFlags)
+	{
+		int result;
+		do
+			result = int(::syscall(__NR_io_uring_enter, inFd, inToSubmit, inMinComplete, inFlags, NULL, 0));
+		while (result < 0  &&  errno == EINTR);
+		return result;
+	}
+
+	//	A bare io_uring:  one submitter at a time (mSubmitLock), and only the reap thread consumes completions
+	struct AJAAsyncFileWriter::IOUring
+	{
+		int				mFd;
+		unsigned		mEntries;
+		uint8_t *		mpSQ;
+		size_t			mSQSize;
+		uint8_t *		mpCQ;
+		size_t			mCQSize;
+		io_uring_sqe *	mpSQEs;
+		size_t			mSQEsSize;
+		unsigned *		mpSQHead;
+		unsigned *		mpSQTail;
+		unsigned *		mpSQMask;
+		unsigned *		mpSQArray;
+		unsigned *		mpCQHead;
+		unsigned *		mpCQTail;
+		unsigned *		mpCQMask;
+		io_uring_cqe *	mpCQEs;
+		AJALock			mSubmitLock;
+
+		IOUring()
+			:	mFd(-1), mEntries(0), mpSQ(NULL), mSQSize(0), mpCQ(NULL), mCQSize(0), mpSQEs(NULL), mSQEsSize(0),
+				mpSQHead(NULL), mpSQTail(NULL), mpSQMask(NULL), mpSQArray(NULL), mpCQHead(NULL), mpCQTail(NULL),
+				mpCQMask(NULL), mpCQEs(NULL)
+		{
+		}
+
+		~IOUring()
+		{
+			if (mpSQEs)
+				::munmap(mpSQEs, mSQEsSize);
+			if (mpCQ)
+				::munmap(mpCQ, mCQSize);
+			if (mpSQ)
+				::munmap(mpSQ, mSQSize);
+			if (mFd >= 0)
+				::close(mFd);
+		}
+
+		bool Setup (const unsigned inEntries)
+		{
+			io_uring_params params;
+			::memset(&params, 0, sizeof(params));
+			mFd = io_uring_setup(inEntries, &params);
+			if (mFd < 0)
+				return false;
+			if (!(params.features & IORING_FEAT_FAST_POLL))
+				return false;	//	Kernel older than 5.7 -- no IORING_OP_WRITE
+			mEntries = params.sq_entries;
+			mSQSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+			mCQSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+			mSQEsSize = params.sq_entries * sizeof(io_uring_sqe);
+			void * pSQ (::mmap(NULL, mSQSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mFd, IORING_OFF_SQ_RING));
+			void * pCQ (::mmap(NULL, mCQSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mFd, IORING_OFF_CQ_RING));
+			void * pSQEs (::mmap(NULL, mSQEsSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mFd, IORING_OFF_SQES));
+			mpSQ = pSQ == MAP_FAILED ? NULL : reinterpret_cast<uint8_t*>(pSQ);
+			mpCQ = pCQ == MAP_FAILED ? NULL : reinterpret_cast<uint8_t*>(pCQ);
+			mpSQEs = pSQEs == MAP_FAILED ? NULL : reinterpret_cast<io_uring_sqe*>(pSQEs);
+			if (!mpSQ  ||  !mpCQ  ||  !mpSQEs)
+				return false;
+			mpSQHead	= reinterpret_cast<unsigned*>(mpSQ + params.sq_off.head);
+			mpSQTail	= reinterpret_cast<unsigned*>(mpSQ + params.sq_off.tail);
+			mpSQMask	= reinterpret_cast<unsigned*>(mpSQ + params.sq_off.ring_mask);
+			mpSQArray	= reinterpret_cast<unsigned*>(mpSQ + params.sq_off.array);
+			mpCQHead	= reinterpret_cast<unsigned*>(mpCQ + params.cq_off.head);
+			mpCQTail	= reinterpret_cast<unsigned*>(mpCQ + params.cq_off.tail);
+			mpCQMask	= reinterpret_cast<unsigned*>(mpCQ + params.cq_off.ring_mask);
+			mpCQEs		= reinterpret_cast<io_uring_cqe*>(mpCQ + params.cq_off.cqes);
+			return true;
+		}
+
+		//	Queues & submits one SQE. A NULL request is a NOP, used to wake the reap thread.
+		bool Push (const int inFileFd, Request * pRequest)
+		{
+			AJAAutoLock	lock(&mSubmitLock);
+			const unsigned tail (*mpSQTail);
+			if (tail - __atomic_load_n(mpSQHead, __ATOMIC_ACQUIRE) >= mEntries)
+				return false;	//	Full
+			const unsigned	ndx (tail & *mpSQMask);
+			io_uring_sqe &	sqe (mpSQEs[ndx]);
+			::memset(&sqe, 0, sizeof(sqe));
+			if (pRequest)
+			{
+				sqe.opcode	= IORING_OP_WRITE;
+				sqe.fd		= inFileFd;
+				sqe.addr	= uint64_t(uintptr_t(pRequest->pBuffer + pRequest->done));
+				sqe.len		= pRequest->length - pRequest->done;
+				sqe.off		= pRequest->offset + pRequest->done;
+			}
+			else
+				sqe.opcode	= IORING_OP_NOP;
+			sqe.user_data = uint64_t(uintptr_t(pRequest));
+			mpSQArray[ndx] = ndx;
+			__atomic_store_n(mpSQTail, tail + 1, __ATOMIC_RELEASE);
+			if (io_uring_enter(mFd, 1, 0, 0) >= 0)
+				return true;
+			__atomic_store_n(mpSQTail, tail, __ATOMIC_RELEASE);	//	Not consumed, take it back
+			return false;
+		}
+
+		//	Waits up to inTimeoutMs for completions, then hands each one to the writer.
+		//	Sets outStop when it reaps the NOP from Close. Returns false if the wait failed.
+		bool Reap (AJAAsyncFileWriter & inWriter, const int inTimeoutMs, bool & outStop)
+		{
+			pollfd	pfd;
+			pfd.fd		= mFd;
+			pfd.events	= POLLIN;
+			pfd.revents	= 0;
+			if (::poll(&pfd, 1, inTimeoutMs) < 0)
+				return errno == EINTR;
+			unsigned head (*mpCQHead);
+			const unsigned tail (__atomic_load_n(mpCQTail, __ATOMIC_ACQUIRE));
+			for (;  head != tail;  head++)
+			{
+				const io_uring_cqe & cqe (mpCQEs[head & *mpCQMask]);
+				Request * pRequest (reinterpret_cast<Request*>(uintptr_t(cqe.user_data)));
+				if (pRequest)
+					inWriter.Reaped(pRequest, cqe.res);
+				else
+					outStop = true;
+			}
+			__atomic_store_n(mpCQHead, head, __ATOMIC_RELEASE);
+			return true;
+		}
+	};
+#else	//	!defined(AJA_ASYNC_IO_URING)
+	struct AJAAsyncFileWriter::IOUring
+	{
+	};
+#endif	//	!defined(AJA_ASYNC_IO_URING)
+
+
+AJAAsyncFileWriter::AJAAsyncFileWriter()
+	:	mBackend(eAJAAsyncWriteAuto),
+		mQueueDepth(0),
+		mDirectFd(-1),
+		mBufferedFd(-1),
+		mNextOffset(0),
+		mClosing(false),
+		mInFlight(0),
+		mpRing(NULL)
+{
+	::memset(&mStats, 0, sizeof(mStats));
+	mWorkEvent.SetManualReset(false);
+}
+
+
+AJAAsyncFileWriter::~AJAAsyncFileWriter()
+{
+	Close();
+}
+
+
+uint32_t AJAAsyncFileWriter::GetAlignment()
+{
+	return kDirectAlignment;
+}
+
+
+bool AJAAsyncFileWriter::IsIOUringAvailable()
+{
+#if defined(AJA_ASYNC_IO_URING)
+	IOUring	ring;
+	return ring.Setup(1);
+#else
+	return false;
+#endif
+}
+
+
+AJAStatus AJAAsyncFileWriter::Open(const string & fileName, const uint32_t queueDepth, const int properties, const AJAAsyncWriteBackend backend)
+{
+	if (IsOpen())
+		return AJA_STATUS_FAIL;
+	if (fileName.empty()  ||  !queueDepth)
+		return AJA_STATUS_BAD_PARAM;
+#if !defined(AJA_ASYNC_IO_URING)
+	if (backend == eAJAAsyncWriteIOUring)
+		return AJA_STATUS_FEATURE;
+#endif
+
+	mQueueDepth = queueDepth < kMaxQueueDepth ? queueDepth : kMaxQueueDepth;
+	mNextOffset = 0;
+	mClosing = false;
+	mCompleted.clear();
+	::memset(&mStats, 0, sizeof(mStats));
+
+#if defined(AJA_WINDOWS)
+	AJA_UNUSED(properties);
+	if (mFile.Open(fileName, eAJAWriteOnly | eAJACreateAlways, eAJABuffered) != AJA_STATUS_SUCCESS)
+		return AJA_STATUS_OPEN;
+	mBufferedFd = 0;	//	Open, via mFile
+#elif defined(AJA_LINUX) || defined(AJA_MAC)
+	mBufferedFd = ::open(fileName.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (mBufferedFd < 0)
+	{
+		AFWFAIL("'" << fileName << "': " << ::strerror(errno));
+		return AJA_STATUS_OPEN;
+	}
+	if (properties & eAJANoCaching)
+	{
+	#if defined(AJA_LINUX)
+		mDirectFd = ::open(fileName.c_str(), O_WRONLY | O_DIRECT);
+	#else
+		mDirectFd = ::open(fileName.c_str(), O_WRONLY);
+		if (mDirectFd >= 0  &&  ::fcntl(int(mDirectFd), F_NOCACHE, 1) < 0)
+			{::close(int(mDirectFd));  mDirectFd = -1;}
+	#endif
+		if (mDirectFd < 0)	//	e.g. tmpfs
+			AFWWARN("'" << fileName << "': no direct I/O (" << ::strerror(errno) << "), writing through the page cache");
+	}
+#else
+	AJA_UNUSED(properties);
+	return AJA_STATUS_UNSUPPORTED;
+#endif
+
+	//	Pick the backend
+	mBackend = eAJAAsyncWriteThreadPool;
+#if defined(AJA_ASYNC_IO_URING)
+	if (backend != eAJAAsyncWriteThreadPool)
+	{
+		mpRing = new IOUring;
+		if (mpRing->Setup(mQueueDepth + 1))		//	+1 for the NOP that stops the reap thread
+			mBackend = eAJAAsyncWriteIOUring;
+		else
+		{
+			delete mpRing;
+			mpRing = NULL;
+			if (backend == eAJAAsyncWriteIOUring)
+			{
+				Close();
+				return AJA_STATUS_FEATURE;
+			}
+		}
+	}
+#endif
+
+	const uint32_t numThreads (mBackend == eAJAAsyncWriteIOUring ? 1 : (mQueueDepth < kMaxPoolThreads ? mQueueDepth : kMaxPoolThreads));
+	for (uint32_t num(0);  num < numThreads;  num++)
+	{
+		AJAThread * pThread (new AJAThread);
+		pThread->Attach(mBackend == eAJAAsyncWriteIOUring ? ReapThread : PoolThread, this);
+		if (pThread->Start() != AJA_STATUS_SUCCESS)
+		{
+			delete pThread;
+			Close();
+			return AJA_STATUS_FAIL;
+		}
+		mThreads.push_back(pThread);
+	}
+	AFWNOTE("'" << fileName << "' open, " << (mBackend == eAJAAsyncWriteIOUring ? "io_uring" : "thread pool")
+			<< ", queue depth " << mQueueDepth << (mDirectFd >= 0 ? ", direct" : ", buffered"));
+	return AJA_STATUS_SUCCESS;
+}
+
+
+AJAStatus AJAAsyncFileWriter::Close()
+{
+	if (!IsOpen())
+		return AJA_STATUS_SUCCESS;
+	{
+		AJAAutoLock lock(&mLock);
+		mClosing = true;	//	Refuse new writes, so the flush below can finish
+	}
+	Flush();
+
+	//	Stop the threads
+#if defined(AJA_ASYNC_IO_URING)
+	if (mpRing  &&  !mThreads.empty()  &&  !mpRing->Push(-1, NULL))	//	Wakes the reap thread...
+		AFWWARN("io_uring NOP submit failed, reap thread stops at its next poll");	//	...else Stop below is seen within kReapPollMs
+#endif
+	mWorkEvent.Signal();
+	for (size_t ndx(0);  ndx < mThreads.size();  ndx++)
+	{
+		mThreads[ndx]->Stop();
+		delete mThreads[ndx];
+	}
+	mThreads.clear();
+	delete mpRing;
+	mpRing = NULL;
+
+#if defined(AJA_WINDOWS)
+	mFile.Close();
+#elif defined(AJA_LINUX) || defined(AJA_MAC)
+	if (mDirectFd >= 0)
+		::close(int(mDirectFd));
+	if (mBufferedFd >= 0)
+		::close(int(mBufferedFd));
+#endif
+	mDirectFd = mBufferedFd = -1;
+	mBackend = eAJAAsyncWriteAuto;
+
+	AJAAutoLock lock(&mLock);
+	return mStats.writesFailed ? AJA_STATUS_IO : AJA_STATUS_SUCCESS;
+}
+
+
+bool AJAAsyncFileWriter::IsOpen() const
+{
+	return mBufferedFd >= 0;
+}
+
+
+bool AJAAsyncFileWriter::IsDirectCapable(const void * pBuffer, const uint32_t length, const uint64_t offset) const
+{
+	return mDirectFd >= 0
+			&&  (uintptr_t(pBuffer) % kDirectAlignment) == 0
+			&&  (length % kDirectAlignment) == 0
+			&&  (offset % kDirectAlignment) == 0;
+}
+
+
+AJAStatus AJAAsyncFileWriter::Write(const void * pBuffer, const uint32_t length, const uint64_t userTag)
+{
+	AJAStatus status;
+	{
+		AJAAutoLock lock(&mLock);	//	Claim the offset
+		status = WriteAt(pBuffer, length, mNextOffset, userTag);
+		if (status == AJA_STATUS_SUCCESS)
+			mNextOffset += length;
+	}
+	return status;
+}
+
+
+AJAStatus AJAAsyncFileWriter::WriteAt(const void * pBuffer, const uint32_t length, const uint64_t offset, const uint64_t userTag)
+{
+	if (!IsOpen())
+		return AJA_STATUS_OPEN;
+	if (!pBuffer  ||  !length)
+		return AJA_STATUS_NULL;
+
+	Request	request;
+	request.pBuffer	= reinterpret_cast<const uint8_t*>(pBuffer);
+	request.length	= length;
+	request.done	= 0;
+	request.offset	= offset;
+	request.userTag	= userTag;
+	request.startUs	= AJATime::GetSystemMicroseconds();
+	request.direct	= IsDirectCapable(pBuffer, length, offset);
+	return Submit(request);
+}
+
+
+AJAStatus AJAAsyncFileWriter::Submit(const Request & inRequest)
+{
+	AJAAutoLock lock(&mLock);
+	if (mClosing)
+		return AJA_STATUS_OPEN;
+	if (mInFlight >= mQueueDepth)
+	{
+		mStats.writesRejected++;
+		return AJA_STATUS_BUSY;
+	}
+	Request * pRequest (new Request(inRequest));
+#if defined(AJA_ASYNC_IO_URING)
+	if (mpRing)
+	{
+		if (!mpRing->Push(int(pRequest->direct ? mDirectFd : mBufferedFd), pRequest))
+		{
+			delete pRequest;
+			AFWFAIL("io_uring submit failed: " << ::strerror(errno));
+			return AJA_STATUS_IO;
+		}
+	}
+	else
+#endif
+	{
+		mPending.push_back(pRequest);
+		mWorkEvent.Signal();
+	}
+	mInFlight++;
+	mStats.writesQueued++;
+	if (!pRequest->direct)
+		mStats.writesBuffered++;
+	if (mInFlight > mStats.maxInFlight)
+		mStats.maxInFlight = mInFlight;
+	return AJA_STATUS_SUCCESS;
+}
+
+
+void AJAAsyncFileWriter::Complete(const Request & inRequest, const int64_t inResult)
+{
+	AJAAsyncWriteResult result;
+	result.pBuffer		= inRequest.pBuffer;
+	result.offset		= inRequest.offset;
+	result.length		= inRequest.length;
+	result.written		= inResult < 0 ? inRequest.done : uint32_t(inResult);
+	result.userTag		= inRequest.userTag;
+	result.latencyUs	= AJATime::GetSystemMicroseconds() - inRequest.startUs;
+	result.status		= result.written == inRequest.length ? AJA_STATUS_SUCCESS : AJA_STATUS_IO;
+	if (result.status != AJA_STATUS_SUCCESS)
+		AFWFAIL("Write of " << inRequest.length << " bytes at " << inRequest.offset << " failed: "
+				<< (inResult < 0 ? ::strerror(int(-inResult)) : "short write"));
+
+	AJAAutoLock lock(&mLock);
+	mStats.writesCompleted++;
+	mStats.bytesWritten += result.written;
+	if (result.status != AJA_STATUS_SUCCESS)
+		mStats.writesFailed++;
+	if (mStats.writesCompleted == 1  ||  result.latencyUs < mStats.latencyMinUs)
+		mStats.latencyMinUs = result.latencyUs;
+	if (result.latencyUs > mStats.latencyMaxUs)
+		mStats.latencyMaxUs = result.latencyUs;
+	mStats.latencyTotalUs += result.latencyUs;
+	mCompleted.push_back(result);
+	mInFlight--;
+	mDoneEvent.Signal();
+}
+
+
+bool AJAAsyncFileWriter::WriteNow(const Request & inRequest, int64_t & outResult)
+{
+	outResult = 0;
+#if defined(AJA_WINDOWS)
+	AJAAutoLock lock(&mFileLock);
+	if (mFile.Seek(int64_t(inRequest.offset), eAJASeekSet) != AJA_STATUS_SUCCESS)
+		return false;
+	outResult = mFile.Write(inRequest.pBuffer, inRequest.length);
+	return outResult == int64_t(inRequest.length);
+#elif defined(AJA_LINUX) || defined(AJA_MAC)
+	const int fd (int(inRequest.direct ? mDirectFd : mBufferedFd));
+	while (outResult < int64_t(inRequest.length))
+	{
+		const ssize_t written (::pwrite(fd, inRequest.pBuffer + outResult, size_t(inRequest.length - outResult), off_t(inRequest.offset + uint64_t(outResult))));
+		if (written < 0  &&  errno == EINTR)
+			continue;
+		if (written < 0)
+			{outResult = -errno;  return false;}
+		if (written == 0)
+			return false;
+		outResult += written;
+	}
+	return true;
+#else
+	AJA_UNUSED(inRequest);
+	return false;
+#endif
+}
+
+
+void AJAAsyncFileWriter::PoolThread(AJAThread * pThread, void * pContext)
+{
+	reinterpret_cast<AJAAsyncFileWriter*>(pContext)->PoolLoop(pThread);
+}
+
+
+void AJAAsyncFileWriter::PoolLoop(AJAThread * pThread)
+{
+	while (!pThread->Terminate())
+	{
+		Request * pRequest (NULL);
+		bool closing (false);
+		{
+			AJAAutoLock lock(&mLock);
+			closing = mClosing;
+			if (!mPending.empty())
+			{
+				pRequest = mPending.front();
+				mPending.pop_front();
+				if (!mPending.empty())
+					mWorkEvent.Signal();	//	Wake another thread for the next one
+			}
+		}
+		if (!pRequest)
+		{
+			if (closing)
+				break;	//	Nothing left to write
+			mWorkEvent.WaitForSignal(100);
+			continue;
+		}
+		int64_t result(0);
+		WriteNow(*pRequest, result);
+		Complete(*pRequest, result);
+		delete pRequest;
+	}
+	mWorkEvent.Signal();	//	Pass the stop along to the next thread
+}
+
+
+void AJAAsyncFileWriter::ReapThread(AJAThread * pThread, void * pContext)
+{
+	reinterpret_cast<AJAAsyncFileWriter*>(pContext)->ReapLoop(pThread);
+}
+
+
+void AJAAsyncFileWriter::ReapLoop(AJAThread * pThread)
+{
+#if defined(AJA_ASYNC_IO_URING)
+	bool	stop (false);
+	while (!stop  &&  !pThread->Terminate())
+		if (!mpRing->Reap(*this, kReapPollMs, stop))
+		{
+			AFWFAIL("io_uring wait failed: " << ::strerror(errno));
+			AJATime::Sleep(1);
+		}
+#else
+	AJA_UNUSED(pThread);
+#endif
+}
+
+
+void AJAAsyncFileWriter::Reaped(Request * pRequest, const int inResult)
+{
+#if defined(AJA_ASYNC_IO_URING)
+	if (inResult > 0  &&  pRequest->done + uint32_t(inResult) < pRequest->length)
+	{	//	Short write:  send the rest
+		pRequest->done += uint32_t(inResult);
+		if (mpRing->Push(int(pRequest->direct ? mDirectFd : mBufferedFd), pRequest))
+			return;
+		Complete(*pRequest, -EIO);
+	}
+	else
+		Complete(*pRequest, inResult < 0 ? int64_t(inResult) : int64_t(pRequest->done) + inResult);
+#else
+	AJA_UNUSED(inResult);
+#endif
+	delete pRequest;
+}
+
+
+AJAStatus AJAAsyncFileWriter::Flush()
+{
+	for (;;)
+	{
+		{
+			AJAAutoLock lock(&mLock);
+			if (!mInFlight)
+				return AJA_STATUS_SUCCESS;
+			mDoneEvent.Clear();
+		}
+		mDoneEvent.WaitForSignal(100);
+	}
+}
+
+
+bool AJAAsyncFileWriter::GetCompletion(AJAAsyncWriteResult & outResult)
+{
+	AJAAutoLock lock(&mLock);
+	if (mCompleted.empty())
+		return false;
+	outResult = mCompleted.front();
+	mCompleted.pop_front();
+	return true;
+}
+
+
+AJAStatus AJAAsyncFileWriter::WaitForCompletion(AJAAsyncWriteResult & outResult, const uint32_t timeout)
+{
+	const uint64_t startMs (AJATime::GetSystemMilliseconds());
+	for (;;)
+	{
+		uint32_t waitMs (timeout);
+		{
+			AJAAutoLock lock(&mLock);
+			if (!mCompleted.empty())
+			{
+				outResult = mCompleted.front();
+				mCompleted.pop_front();
+				return AJA_STATUS_SUCCESS;
+			}
+			if (!mInFlight)
+				return AJA_STATUS_FAIL;
+			if (timeout != 0xffffffff)
+			{
+				const uint64_t elapsedMs (AJATime::GetSystemMilliseconds() - startMs);
+				if (elapsedMs >= timeout)
+					return AJA_STATUS_TIMEOUT;
+				waitMs = uint32_t(timeout - elapsedMs);
+			}
+			mDoneEvent.Clear();
+		}
+		mDoneEvent.WaitForSignal(waitMs);
+	}
+}
+
+
+uint32_t AJAAsyncFileWriter::GetNumInFlight() const
+{
+	AJAAutoLock lock(&mLock);
+	return mInFlight;
+}
+
+
+AJAAsyncWriteStats AJAAsyncFileWriter::GetStats() const
+{
+	AJAAutoLock lock(&mLock);
+	return mStats;
+}
@@ -0,0 +1,235 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		asyncfilewriter.h
+	@brief		Declares the AJAAsyncFileWriter class.
+	@copyright	(C) 2022 AJA Video Systems, Inc.  All rights reserved.
+**/
+
+#ifndef AJA_ASYNC_FILE_WRITER_H
+#define AJA_ASYNC_FILE_WRITER_H
+
+#include "ajabase/common/public.h"
+#include "ajabase/system/file_io.h"
+#include "ajabase/system/event.h"
+#include "ajabase/system/lock.h"
+#include <deque>
+#include <string>
+#include <vector>
+
+class AJAThread;
+
+
+typedef enum
+{
+	eAJAAsyncWriteAuto,			///< @brief	io_uring where the kernel has it, otherwise a pwrite thread pool
+	eAJAAsyncWriteIOUring,		///< @brief	Linux io_uring only
+	eAJAAsyncWriteThreadPool	///< @brief	Thread pool calling pwrite
+} AJAAsyncWriteBackend;
+
+
+/**
+ *	Describes a completed AJAAsyncFileWriter write.
+ */
+typedef struct AJAAsyncWriteResult
+{
+	const void *	pBuffer;		///< @brief	The buffer passed to AJAAsyncFileWriter::Write, free for re-use
+	uint64_t		offset;			///< @brief	Where it was written in the file
+	uint32_t		length;			///< @brief	The number of bytes requested
+	uint32_t		written;		///< @brief	The number of bytes actually written
+	uint64_t		userTag;		///< @brief	The tag passed to AJAAsyncFileWriter::Write
+	uint64_t		latencyUs;		///< @brief	Microseconds from Write to completion
+	AJAStatus		status;			///< @brief	AJA_STATUS_SUCCESS, or AJA_STATUS_IO if the write failed
+} AJAAsyncWriteResult;
+
+
+/**
+ *	Running totals for an AJAAsyncFileWriter.
+ */
+typedef struct AJAAsyncWriteStats
+{
+	uint64_t		writesQueued;		///< @brief	Writes accepted by AJAAsyncFileWriter::Write
+	uint64_t		writesCompleted;	///< @brief	Writes that finished, successfully or not
+	uint64_t		writesFailed;		///< @brief	Writes that failed or came up short
+	uint64_t		writesBuffered;		///< @brief	Writes that went through the page cache because they weren't aligned
+	uint64_t		writesRejected;		///< @brief	Writes refused because the queue was full
+	uint64_t		bytesWritten;		///< @brief	Total bytes written
+	uint64_t		latencyMinUs;		///< @brief	Fastest write
+	uint64_t		latencyMaxUs;		///< @brief	Slowest write
+	uint64_t		latencyTotalUs;		///< @brief	Sum of all write latencies (divide by writesCompleted for the average)
+	uint32_t		maxInFlight;		///< @brief	Most writes ever outstanding at once
+} AJAAsyncWriteStats;
+
+
+/**
+ *	Writes a file asynchronously, bypassing the page cache (O_DIRECT on Linux, F_NOCACHE on macOS),
+ *	for capturing raw frames to disk at full storage bandwidth without stalling the capture thread.
+ *	On Linux, writes are submitted through io_uring when the kernel supports it, otherwise a pool of
+ *	threads calls pwrite. Windows always uses the thread pool and the page cache.
+ *	@ingroup AJAGroupSystem
+ *
+ *	Write queues the buffer and returns immediately, or returns AJA_STATUS_BUSY if the queue is full.
+ *	The buffer must stay valid and unmodified until its AJAAsyncWriteResult comes back from
+ *	GetCompletion or WaitForCompletion. For direct I/O, the buffer address, length and file offset
+ *	must be multiples of GetAlignment(); a page-aligned NTV2Buffer (NTV2Buffer::IsPageAligned)
+ *	whose size is a multiple of the page size always qualifies. Anything else still gets written,
+ *	but through the page cache.
+ *
+ *	@note	Write & GetCompletion can be called from different threads.
+ */
+class AJA_EXPORT AJAAsyncFileWriter
+{
+public:
+	AJAAsyncFileWriter();
+	~AJAAsyncFileWriter();
+
+	/**
+	 *	Opens (creates or truncates) a file for asynchronous writing.
+	 *
+	 *	@param[in]	fileName			The fully qualified file name.
+	 *	@param[in]	queueDepth			The maximum number of writes that can be outstanding at once.
+	 *	@param[in]	properties			Specify eAJANoCaching to bypass the page cache (the default), or eAJABuffered.
+	 *	@param[in]	backend				How the writes are issued.
+	 *
+	 *	@return		AJA_STATUS_SUCCESS	The file was opened
+	 *				AJA_STATUS_OPEN		The file could not be opened
+	 *				AJA_STATUS_FEATURE	io_uring was requested but isn't available
+	 */
+	AJAStatus Open(
+				const std::string &				fileName,
+				const uint32_t					queueDepth	= 8,
+				const int						properties	= eAJANoCaching,
+				const AJAAsyncWriteBackend		backend		= eAJAAsyncWriteAuto);
+
+	/**
+	 *	Waits for all outstanding writes to finish, then closes the file.
+	 *
+	 *	@return		AJA_STATUS_SUCCESS	The file was closed and every write succeeded
+	 *				AJA_STATUS_IO		At least one write failed
+	 */
+	AJAStatus Close();
+
+	/**
+	 *	@return		True if a file is open.
+	 */
+	bool IsOpen() const;
+
+	/**
+	 *	Queues a write at the end of the file (i.e. following the previous Write).
+	 *
+	 *	@param[in]	pBuffer				The data to write. Must stay valid until the write completes.
+	 *	@param[in]	length				The number of bytes to write.
+	 *	@param[in]	userTag				Returned in the write's AJAAsyncWriteResult.
+	 *
+	 *	@return		AJA_STATUS_SUCCESS	The write was queued
+	 *				AJA_STATUS_BUSY		The queue is full -- collect some completions, then try again
+	 *				AJA_STATUS_NULL		The buffer is NULL or the length is zero
+	 *				AJA_STATUS_OPEN		No file is open
+	 */
+	AJAStatus Write(const void * pBuffer, const uint32_t length, const uint64_t userTag = 0);
+
+	/**
+	 *	Queues a write at the given file offset.
+	 *
+	 *	@param[in]	pBuffer				The data to write. Must stay valid until the write completes.
+	 *	@param[in]	length				The number of bytes to write.
+	 *	@param[in]	offset				The file offset to write at.
+	 *	@param[in]	userTag				Returned in the write's AJAAsyncWriteResult.
+	 *
+	 *	@return		The same as Write.
+	 */
+	AJAStatus WriteAt(const void * pBuffer, const uint32_t length, const uint64_t offset, const uint64_t userTag = 0);
+
+	/**
+	 *	Collects a completed write, if there is one, without waiting.
+	 *
+	 *	@param[out]	outResult			Receives the completed write.
+	 *
+	 *	@return		True if a completed write was returned.
+	 */
+	bool GetCompletion(AJAAsyncWriteResult & outResult);
+
+	/**
+	 *	Waits for a write to complete, and collects it.
+	 *
+	 *	@param[out]	outResult			Receives the completed write.
+	 *	@param[in]	timeout				Milliseconds to wait.
+	 *
+	 *	@return		AJA_STATUS_SUCCESS	A completed write was returned
+	 *				AJA_STATUS_TIMEOUT	Nothing completed in time
+	 *				AJA_STATUS_FAIL		Nothing is outstanding
+	 */
+	AJAStatus WaitForCompletion(AJAAsyncWriteResult & outResult, const uint32_t timeout = 0xffffffff);
+
+	/**
+	 *	Waits until every queued write has finished. Completions are still kept for GetCompletion.
+	 *
+	 *	@return		AJA_STATUS_SUCCESS	Nothing is outstanding
+	 */
+	AJAStatus Flush();
+
+	/**
+	 *	@return		The number of writes queued or in progress.
+	 */
+	uint32_t GetNumInFlight() const;
+
+	/**
+	 *	@return		A copy of my running totals.
+	 */
+	AJAAsyncWriteStats GetStats() const;
+
+	/**
+	 *	@return		The backend actually in use, or eAJAAsyncWriteAuto if no file is open.
+	 */
+	AJAAsyncWriteBackend GetBackend() const		{return mBackend;}
+
+	/**
+	 *	@return		The buffer address, length and offset alignment direct writes need, in bytes.
+	 */
+	static uint32_t GetAlignment();
+
+	/**
+	 *	@return		True if the running kernel can do io_uring writes.
+	 */
+	static bool IsIOUringAvailable();
+
+private:
+	struct Request;
+	struct IOUring;
+
+	AJAStatus	Submit(const Request & inRequest);
+	bool		IsDirectCapable(const void * pBuffer, const uint32_t length, const uint64_t offset) const;
+	void		Complete(const Request & inRequest, const int64_t inResult);
+	bool		WriteNow(const Request & inRequest, int64_t & outResult);
+
+	static void	PoolThread(AJAThread * pThread, void * pContext);
+	static void	ReapThread(AJAThread * pThread, void * pContext);
+	void		PoolLoop(AJAThread * pThread);
+	void		ReapLoop(AJAThread * pThread);
+	void		Reaped(Request * pRequest, const int inResult);
+
+	AJAAsyncFileWriter(const AJAAsyncFileWriter &);					//	Not copyable
+	AJAAsyncFileWriter & operator = (const AJAAsyncFileWriter &);	//	Not assignable
+
+	AJAAsyncWriteBackend			mBackend;
+	uint32_t						mQueueDepth;
+	int64_t							mDirectFd;		//	Bypasses the page cache (-1 if not open)
+	int64_t							mBufferedFd;	//	Same file, through the page cache, for unaligned writes
+	uint64_t						mNextOffset;	//	Where the next Write goes
+
+	mutable AJALock					mLock;			//	Guards everything below
+	bool							mClosing;		//	Set by Close, before it flushes
+	std::deque<Request*>			mPending;		//	Thread pool:  waiting for a thread
+	std::deque<AJAAsyncWriteResult>	mCompleted;		//	Waiting for GetCompletion
+	uint32_t						mInFlight;
+	AJAAsyncWriteStats				mStats;
+	AJAEvent						mWorkEvent;		//	Signaled when mPending gets a request
+	AJAEvent						mDoneEvent;		//	Signaled when mCompleted gets a result
+	std::vector<AJAThread*>			mThreads;
+	IOUring *						mpRing;
+#if defined(AJA_WINDOWS)
+	AJAFileIO						mFile;			//	No pwrite on Windows, so Seek & Write...
+	AJALock							mFileLock;		//	...one at a time
+#endif
+};
+
+#endif	//	AJA_ASYNC_FILE_WRITER_H
@@ -562,6 +562,75 @@ AJAThreadImpl::SetRealTime(AJAThreadRealTimePolicy policy, int priority)
 }
 
 
+AJAStatus
+AJAThreadImpl::SetCPUAffinity(const AJACPUSet& cpus)
+{
+	AJA_UNUSED(cpus);
+	return AJA_STATUS_UNSUPPORTED;
+}
+
+
+AJAStatus
+AJAThreadImpl::GetCPUAffinity(AJACPUSet* pCPUs)
+{
+	if (pCPUs == NULL)
+		return AJA_STATUS_NULL;
+	return AJA_STATUS_UNSUPPORTED;
+}
+
+
+AJAStatus
+AJAThreadImpl::SetNUMANode(int node)
+{
+	AJA_UNUSED(node);
+	return AJA_STATUS_UNSUPPORTED;
+}
+
+
+AJAStatus
+AJAThreadImpl::GetNUMANode(int* pNode)
+{
+	if (pNode == NULL)
+		return AJA_STATUS_NULL;
+	*pNode = -1;
+	return AJA_STATUS_SUCCESS;
+}
+
+
+AJAStatus
+AJAThreadImpl::SetSchedulingProfile(AJAThreadSchedulingProfile profile)
+{
+	AJA_UNUSED(profile);
+	return AJA_STATUS_UNSUPPORTED;
+}
+
+
+AJAStatus
+AJAThreadImpl::GetSchedulingProfile(AJAThreadSchedulingProfile* pProfile)
+{
+	if (pProfile == NULL)
+		return AJA_STATUS_NULL;
+	*pProfile = AJA_ThreadSchedulingProfile_Default;
+	return AJA_STATUS_SUCCESS;
+}
+
+
+int
+AJAThreadImpl::GetNUMANodeCount()
+{
+	return 1;
+}
+
+
+AJAStatus
+AJAThreadImpl::GetNUMANodeCPUs(int node, AJACPUSet& outCPUs)
+{
+	AJA_UNUSED(node);
+	outCPUs.clear();
+	return AJA_STATUS_UNSUPPORTED;
+}
+
+
 AJAStatus
 AJAThreadImpl::Attach(AJAThreadFunction* pThreadFunction, void* pUserContext)
 {
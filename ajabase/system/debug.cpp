@@ -31,6 +31,9 @@ static const std::string sSeverityString[] = {"emergency", "alert", "assert", "e
 static AJALock sLock;
 static AJADebugShare* spShare = NULL;
 static bool sDebug = false;
+static std::string sDeferredText;	//	Backs GetMessageText(uint64_t, const char**) for deferred messages
+
+AJADebugShare * volatile AJADebug::spReportShare = NULL;
 
 #define addDebugGroupToLabelVector(x) sGroupLabelVector.push_back(#x)
 
@@ -102,6 +105,7 @@ AJAStatus AJADebug::Open (bool incrementRefCount)
 				Close();
 				return AJA_STATUS_FAIL;
 			}
+			spReportShare = spShare;
 
 			if (incrementRefCount)
 			{
@@ -195,6 +199,7 @@ AJAStatus AJADebug::Open (bool incrementRefCount)
 AJAStatus AJADebug::Close (bool decrementRefCount)
 {
 	AJAAutoLock lock(&sLock);
+	spReportShare = NULL;	//	stop IsReporting from touching the share before it goes away
 	try
 	{		
 		if (spShare)
@@ -443,6 +448,200 @@ void AJADebug::Report (int32_t index, int32_t severity, const char* pFileName, i
 	}
 }
 
+#if defined(AJA_USE_CPLUSPLUS11)
+void AJADebug::Report (int32_t index, int32_t severity, const char* pFileName, int32_t lineNumber, const AJADebugDeferredRecord & inRecord)
+{
+	if (!spShare)
+		return; //	Not open
+	try
+	{
+		uint64_t writeIndex = 0;
+		int32_t messageIndex = 0;
+		if (report_common(index, severity, pFileName, lineNumber, writeIndex, messageIndex))
+		{
+			// copy the packed format and arguments, the reader formats them
+			::memcpy(spShare->messageRing[messageIndex].messageText, inRecord.Data(), inRecord.Size());
+			if (inRecord.Size() < AJA_DEBUG_MESSAGE_MAX_SIZE)
+				spShare->messageRing[messageIndex].messageText[inRecord.Size()] = 0;	//	end-of-arguments tag
+			spShare->messageRing[messageIndex].destinationMask |= AJA_DEBUG_MESSAGE_DEFERRED;
+
+			// set last to indicate message complete
+			AJAAtomic::Exchange(&spShare->messageRing[messageIndex].sequenceNumber, writeIndex);
+			AJAAtomic::Increment(&spShare->statsMessagesAccepted);
+		}
+	}
+	catch (...)
+	{
+	}
+}
+#endif	//	AJA_USE_CPLUSPLUS11
+
+
+bool AJADebug::CountIgnored (void)
+{
+	AJADebugShare * pShare (spReportShare);
+	if (pShare)
+		AJAAtomic::Increment(&pShare->statsMessagesIgnored);
+	return false;
+}
+
+
+//	Pulls the next tagged argument from a deferred record, returns false when there are no more
+static bool deferred_next_arg (const char* & pArg, const char* pEnd, char & outTag, uint64_t & outBits, const char* & outString)
+{
+	if (pArg >= pEnd)
+		return false;
+	outTag = *pArg++;
+	switch (outTag)
+	{
+		case AJA_DEBUG_DEFERRED_TAG_SIGNED:
+		case AJA_DEBUG_DEFERRED_TAG_UNSIGNED:
+		case AJA_DEBUG_DEFERRED_TAG_DOUBLE:
+		case AJA_DEBUG_DEFERRED_TAG_POINTER:
+			if (pArg + sizeof(uint64_t) > pEnd)
+				return false;
+			::memcpy(&outBits, pArg, sizeof(uint64_t));
+			pArg += sizeof(uint64_t);
+			return true;
+		case AJA_DEBUG_DEFERRED_TAG_STRING:
+		{
+			const void * pNul (::memchr(pArg, 0, size_t(pEnd - pArg)));
+			if (!pNul)
+				return false;
+			outString = pArg;
+			pArg = reinterpret_cast<const char*>(pNul) + 1;
+			return true;
+		}
+		default:
+			return false;	//	garbage, or a record written by something newer
+	}
+}
+
+static int64_t deferred_arg_as_int (const char inTag, const uint64_t inBits)
+{
+	if (inTag == AJA_DEBUG_DEFERRED_TAG_DOUBLE)
+	{
+		double value(0.0);
+		::memcpy(&value, &inBits, sizeof(value));
+		return int64_t(value);
+	}
+	return int64_t(inBits);
+}
+
+static double deferred_arg_as_double (const char inTag, const uint64_t inBits)
+{
+	if (inTag == AJA_DEBUG_DEFERRED_TAG_DOUBLE)
+	{
+		double value(0.0);
+		::memcpy(&value, &inBits, sizeof(value));
+		return value;
+	}
+	if (inTag == AJA_DEBUG_DEFERRED_TAG_SIGNED)
+		return double(int64_t(inBits));
+	return double(inBits);
+}
+
+std::string AJADebug::FormatDeferred (const char* pRecord, const size_t inSize)
+{
+	std::string result;
+	if (!pRecord || !inSize)
+		return result;
+
+	const char * pEnd (pRecord + inSize);
+	const char * pFormatEnd (reinterpret_cast<const char*>(::memchr(pRecord, 0, inSize)));
+	if (!pFormatEnd)
+		return std::string(pRecord, inSize);
+	const char * pArg (pFormatEnd + 1);
+	char buffer[AJA_DEBUG_MESSAGE_MAX_SIZE];
+
+	for (const char * pFmt(pRecord);  pFmt < pFormatEnd;  )
+	{
+		if (*pFmt != '%')
+		{
+			result += *pFmt++;
+			continue;
+		}
+		if (pFmt[1] == '%')
+		{
+			result += '%';
+			pFmt += 2;
+			continue;
+		}
+
+		//	collect flags, width & precision, drop the length modifiers, keep the conversion
+		const char * pSpecStart (pFmt++);
+		std::string spec("%");
+		char tag(0);
+		uint64_t bits(0);
+		const char * pString(NULL);
+		bool missing(false);
+		while (pFmt < pFormatEnd  &&  ::strchr("-+ #0123456789.*", *pFmt))
+		{
+			if (*pFmt == '*')
+			{	//	width or precision comes from the argument list
+				if (deferred_next_arg(pArg, pEnd, tag, bits, pString)  &&  tag != AJA_DEBUG_DEFERRED_TAG_STRING)
+					spec += aja::to_string(int(deferred_arg_as_int(tag, bits)));
+				else
+					missing = true;
+			}
+			else
+				spec += *pFmt;
+			pFmt++;
+		}
+		while (pFmt < pFormatEnd  &&  ::strchr("hlLqjzt", *pFmt))
+			pFmt++;
+		if (pFmt >= pFormatEnd)
+		{	//	dangling '%': emit as-is
+			result.append(pSpecStart, size_t(pFormatEnd - pSpecStart));
+			break;
+		}
+		const char conversion (*pFmt++);
+		if (conversion == 'n')
+			continue;
+		if (missing  ||  !deferred_next_arg(pArg, pEnd, tag, bits, pString))
+		{	//	argument didn't fit in the record
+			result.append(pSpecStart, size_t(pFmt - pSpecStart));
+			continue;
+		}
+
+		buffer[0] = 0;
+		if (tag == AJA_DEBUG_DEFERRED_TAG_STRING)
+		{
+			if (conversion == 's')
+				ajasnprintf(buffer, sizeof(buffer), (spec + "s").c_str(), pString);
+			else
+				aja::safer_strncpy(buffer, pString, ::strlen(pString), sizeof(buffer));
+		}
+		else switch (conversion)
+		{
+			case 'd':	case 'i':
+				ajasnprintf(buffer, sizeof(buffer), (spec + "lld").c_str(), (long long)deferred_arg_as_int(tag, bits));
+				break;
+			case 'u':	case 'o':	case 'x':	case 'X':
+				ajasnprintf(buffer, sizeof(buffer), (spec + "ll" + conversion).c_str(), (unsigned long long)deferred_arg_as_int(tag, bits));
+				break;
+			case 'c':
+				ajasnprintf(buffer, sizeof(buffer), (spec + "c").c_str(), int(deferred_arg_as_int(tag, bits)));
+				break;
+			case 'e':	case 'E':	case 'f':	case 'F':	case 'g':	case 'G':	case 'a':	case 'A':
+				ajasnprintf(buffer, sizeof(buffer), (spec + conversion).c_str(), deferred_arg_as_double(tag, bits));
+				break;
+			case 'p':
+				ajasnprintf(buffer, sizeof(buffer), "0x%llx", (unsigned long long)bits);
+				break;
+			case 's':
+				ajasnprintf(buffer, sizeof(buffer), "%lld", (long long)deferred_arg_as_int(tag, bits));
+				break;
+			default:	//	unknown conversion: emit as-is
+				result.append(pSpecStart, size_t(pFmt - pSpecStart));
+				break;
+		}
+		result += buffer;
+	}
+	return result;
+}
+
+
 void AJADebug::AssertWithMessage (const char* pFileName, int32_t lineNumber, const std::string& pExpression)
 {
 #if defined(AJA_DEBUG)
@@ -608,7 +807,7 @@ AJAStatus AJADebug::GetMessageDestination (const uint64_t sequenceNumber, uint32
 		return AJA_STATUS_RANGE;
 	try
 	{
-		outDestination = spShare->messageRing[sequenceNumber%AJA_DEBUG_MESSAGE_RING_SIZE].destinationMask;
+		outDestination = spShare->messageRing[sequenceNumber%AJA_DEBUG_MESSAGE_RING_SIZE].destinationMask & ~uint32_t(AJA_DEBUG_MESSAGE_DEFERRED);
 	}
 	catch(...)
 	{
@@ -735,7 +934,11 @@ AJAStatus AJADebug::GetMessageText (const uint64_t sequenceNumber, std::string &
 		return AJA_STATUS_RANGE;
 	try
 	{
-		outMessage = spShare->messageRing[sequenceNumber%AJA_DEBUG_MESSAGE_RING_SIZE].messageText;
+		const AJADebugMessage & msg (spShare->messageRing[sequenceNumber%AJA_DEBUG_MESSAGE_RING_SIZE]);
+		if (msg.destinationMask & AJA_DEBUG_MESSAGE_DEFERRED)
+			outMessage = FormatDeferred(msg.messageText, sizeof(msg.messageText));
+		else
+			outMessage = msg.messageText;
 	}
 	catch(...)
 	{
@@ -754,7 +957,15 @@ AJAStatus AJADebug::GetMessageText (uint64_t sequenceNumber, const char** ppMess
 		return AJA_STATUS_NULL;
 	try
 	{
-		*ppMessage = spShare->messageRing[sequenceNumber%AJA_DEBUG_MESSAGE_RING_SIZE].messageText;
+		const AJADebugMessage & msg (spShare->messageRing[sequenceNumber%AJA_DEBUG_MESSAGE_RING_SIZE]);
+		if (msg.destinationMask & AJA_DEBUG_MESSAGE_DEFERRED)
+		{	//	only valid until the next deferred message is fetched this way
+			AJAAutoLock lock(&sLock);
+			sDeferredText = FormatDeferred(msg.messageText, sizeof(msg.messageText));
+			*ppMessage = sDeferredText.c_str();
+		}
+		else
+			*ppMessage = msg.messageText;
 	}
 	catch(...)
 	{
@@ -9,10 +9,14 @@
 #define AJA_DEBUG_H
 
 #include <stdio.h>
+#include <string.h>
 #include <sstream>
 #include <set>
 #include "ajabase/common/public.h"
 #include "ajabase/system/debugshare.h"
+#if defined(AJA_USE_CPLUSPLUS11)
+	#include <type_traits>
+#endif
 
 
 
@@ -137,10 +141,13 @@
  *	@param[in]	_index_		Specifies the message classification as an ::AJADebugUnit.
  *	@param[in]	_severity_	Severity (::AJADebugSeverity) of the message to report.
  *	@param[in]	_expr_		The message to report, as a <tt>std::ostream</tt> expression (e.g. <tt>"Foo" << std::hex << 3500</tt>).
+ *	@note		The expression isn't evaluated unless AJADebug::IsReporting returns true for the unit.
  */
-#define AJA_sREPORT(_index_,_severity_,_expr_)		do {std::ostringstream	__ss__;	 __ss__ << _expr_;									\
-														AJADebug::Report((_index_), (_severity_), __FILE__, __LINE__, __ss__.str());	\
-														} while (false)
+#define AJA_sREPORT(_index_,_severity_,_expr_)		do {if (AJADebug::IsReporting(_index_))												\
+														{	std::ostringstream	__ss__;	 __ss__ << _expr_;								\
+															AJADebug::Report((_index_), (_severity_), __FILE__, __LINE__, __ss__.str());	\
+														}																					\
+													} while (false)
 
 /** @def AJA_sEMERGENCY(_index_, _expr_)
  *	Reports a ::AJA_DebugSeverity_Emergency message to active destinations using the given std::ostream expression.
@@ -219,6 +226,32 @@
  */
 #define AJA_sDEBUG(_index_,_expr_)			AJA_sREPORT((_index_), AJA_DebugSeverity_Debug,		_expr_)
 
+
+#if defined(AJA_USE_CPLUSPLUS11)
+/** @def AJA_dREPORT(_index_, _severity_, _format_, ...)
+ *	Report a printf-style message to active destinations without formatting it in the calling process.
+ *	@hideinitializer
+ *
+ *	The format string and the raw argument values are copied into the message ring, and the text is produced
+ *	by the reader (e.g. <b>logreader</b>) when it calls AJADebug::GetMessageText. Integers, enums, <tt>bool</tt>,
+ *	floating-point values, C strings, <tt>std::string</tt> and pointers are supported. Nothing is evaluated
+ *	unless AJADebug::IsReporting returns true for the unit.
+ *
+ *	@param[in]	_index_		Specifies the message classification as an ::AJADebugUnit.
+ *	@param[in]	_severity_	Severity (::AJADebugSeverity) of the message to report.
+ *	@param[in]	_format_	The printf format string, followed by its arguments.
+ */
+#define AJA_dREPORT(_index_,_severity_,...)		do {if (AJADebug::IsReporting(_index_))													\
+														AJADebug::ReportDeferred((_index_), (_severity_), __FILE__, __LINE__, __VA_ARGS__);	\
+													} while (false)
+
+#define AJA_dERROR(_index_,...)				AJA_dREPORT((_index_), AJA_DebugSeverity_Error,		__VA_ARGS__)	///< @brief Deferred-format ::AJA_DebugSeverity_Error message. @hideinitializer
+#define AJA_dWARNING(_index_,...)			AJA_dREPORT((_index_), AJA_DebugSeverity_Warning,	__VA_ARGS__)	///< @brief Deferred-format ::AJA_DebugSeverity_Warning message. @hideinitializer
+#define AJA_dNOTICE(_index_,...)			AJA_dREPORT((_index_), AJA_DebugSeverity_Notice,	__VA_ARGS__)	///< @brief Deferred-format ::AJA_DebugSeverity_Notice message. @hideinitializer
+#define AJA_dINFO(_index_,...)				AJA_dREPORT((_index_), AJA_DebugSeverity_Info,		__VA_ARGS__)	///< @brief Deferred-format ::AJA_DebugSeverity_Info message. @hideinitializer
+#define AJA_dDEBUG(_index_,...)				AJA_dREPORT((_index_), AJA_DebugSeverity_Debug,		__VA_ARGS__)	///< @brief Deferred-format ::AJA_DebugSeverity_Debug message. @hideinitializer
+#endif	//	AJA_USE_CPLUSPLUS11
+
 /** @} */
 
 
@@ -226,6 +259,79 @@
 // forward declarations
 class AJAMemory;
 
+
+#if defined(AJA_USE_CPLUSPLUS11)
+/**
+ *	Packs a printf format string and its argument values into a deferred message record, which
+ *	AJADebug::GetMessageText formats on the reading side. Used by AJA_dREPORT, and never allocates.
+ *	The record is the NUL-terminated format string, followed by one type tag and value per argument.
+ *	Arguments that don't fit in AJA_DEBUG_MESSAGE_MAX_SIZE bytes are dropped.
+ *	@ingroup AJAGroupDebug
+ */
+class AJADebugDeferredRecord	//	New in SDK 17.1
+{
+	public:
+		enum
+		{
+			kTagSigned		= AJA_DEBUG_DEFERRED_TAG_SIGNED,	///< @brief Followed by an int64_t
+			kTagUnsigned	= AJA_DEBUG_DEFERRED_TAG_UNSIGNED,	///< @brief Followed by a uint64_t
+			kTagDouble		= AJA_DEBUG_DEFERRED_TAG_DOUBLE,	///< @brief Followed by a double
+			kTagString		= AJA_DEBUG_DEFERRED_TAG_STRING,	///< @brief Followed by a NUL-terminated string
+			kTagPointer		= AJA_DEBUG_DEFERRED_TAG_POINTER	///< @brief Followed by a uint64_t address
+		};
+
+		explicit inline AJADebugDeferredRecord (const char * pFormat)
+			:	mSize(0)
+		{
+			PutString(pFormat ? pFormat : "no message");
+		}
+
+		template <typename T>	inline typename std::enable_if<std::is_integral<T>::value>::type	Add (const T inValue)
+		{
+			if (std::is_signed<T>::value)
+				PutValue(char(kTagSigned), int64_t(inValue));
+			else
+				PutValue(char(kTagUnsigned), uint64_t(inValue));
+		}
+		template <typename T>	inline typename std::enable_if<std::is_enum<T>::value>::type			Add (const T inValue)	{PutValue(char(kTagSigned), int64_t(inValue));}
+		template <typename T>	inline typename std::enable_if<std::is_floating_point<T>::value>::type	Add (const T inValue)	{PutValue(char(kTagDouble), double(inValue));}
+		template <typename T>	inline void	Add (const T * pValue)		{PutValue(char(kTagPointer), uint64_t(reinterpret_cast<uintptr_t>(pValue)));}
+		inline void	Add (const char * pValue)			{if (Room(2))  {mBuffer[mSize++] = char(kTagString);  PutString(pValue ? pValue : "(null)");}}
+		inline void	Add (char * pValue)					{Add(static_cast<const char *>(pValue));}
+		inline void	Add (const std::string & inValue)	{Add(inValue.c_str());}
+
+		inline void AddAll (void)	{}
+		template <typename T, typename... Args>	inline void AddAll (const T & inFirst, const Args &... inRest)	{Add(inFirst);  AddAll(inRest...);}
+
+		inline const char *	Data (void) const	{return mBuffer;}	///< @return	The packed record.
+		inline size_t		Size (void) const	{return mSize;}		///< @return	The packed record size, in bytes.
+
+	private:
+		inline bool	Room (const size_t inBytes) const	{return mSize + inBytes <= sizeof(mBuffer);}
+		template <typename T>	inline void PutValue (const char inTag, const T inValue)
+		{
+			if (!Room(1 + sizeof(T)))
+				return;
+			mBuffer[mSize++] = inTag;
+			::memcpy(mBuffer + mSize, &inValue, sizeof(T));
+			mSize += sizeof(T);
+		}
+		inline void PutString (const char * pStr)
+		{	//	always NUL-terminated, truncated to fit
+			const size_t	avail (sizeof(mBuffer) - mSize - 1);
+			size_t			len (::strlen(pStr));
+			if (len > avail)
+				len = avail;
+			::memcpy(mBuffer + mSize, pStr, len);
+			mSize += len;
+			mBuffer[mSize++] = 0;
+		}
+
+		char	mBuffer[AJA_DEBUG_MESSAGE_MAX_SIZE];
+		size_t	mSize;
+};	//	AJADebugDeferredRecord
+#endif	//	AJA_USE_CPLUSPLUS11
+
 /** 
  *	@param[in]	inStatus	The AJAStatus value of interest.
  *	@param[in]	inDetailed	Optionally specifies the type of string content to return.
@@ -336,6 +442,25 @@ public:
 	 */
 	static bool IsActive (int32_t index);
 
+	/**
+	 *	Answers quickly if a message reported to the given unit would be accepted into the message ring,
+	 *	i.e. the debug facility is open, a client (e.g. <b>logreader</b>) is attached, and the unit has a
+	 *	destination. Costs a few loads and no locking, so AJA_sREPORT and AJA_dREPORT call it before
+	 *	building their message.
+	 *
+	 *	@param[in]	index		The message unit (::AJADebugUnit) of interest.
+	 *	@return		True if the message would be accepted;	otherwise false.
+	 */
+	static inline bool IsReporting (int32_t index)	//	New in SDK 17.1
+	{
+		const AJADebugShare * pShare (spReportShare);
+		if (!pShare  ||  pShare->clientRefCount <= 0)
+			return false;	//	Not open, or nobody listening
+		if (uint32_t(index) >= uint32_t(AJA_DEBUG_UNIT_ARRAY_SIZE))
+			index = AJA_DebugUnit_Unknown;
+		return pShare->unitArray[index] != AJA_DEBUG_DESTINATION_NONE  ||  CountIgnored();
+	}
+
 	/**
 	 *	@return		True if the debug facility is open;	 otherwise false.
 	 */
@@ -368,6 +493,48 @@ public:
 	 */
 	static void Report (int32_t index, int32_t severity, const char* pFileName, int32_t lineNumber, const std::string& message);
 
+#if defined(AJA_USE_CPLUSPLUS11)
+	/**
+	 *	Report a debug message to the specified destination index, leaving the formatting to the reader.
+	 *	Normally called through the AJA_dREPORT macro.
+	 *
+	 *	@param[in]	index		Report the message to this destination index.
+	 *	@param[in]	severity	Severity (::AJA_DEBUG_SEVERITY) of the message to report.
+	 *	@param[in]	pFileName	The source filename reporting the message.
+	 *	@param[in]	lineNumber	The line number in the source file reporting the message.
+	 *	@param[in]	pFormat		The printf format string.
+	 *	@param[in]	inArgs		The format arguments, copied by value into the message ring.
+	 */
+	template <typename... Args>
+	static inline void ReportDeferred (int32_t index, int32_t severity, const char* pFileName, int32_t lineNumber,
+										const char* pFormat, const Args &... inArgs)	//	New in SDK 17.1
+	{
+		AJADebugDeferredRecord	record(pFormat);
+		record.AddAll(inArgs...);
+		Report(index, severity, pFileName, lineNumber, record);
+	}
+
+	/**
+	 *	Report a packed deferred message record to the specified destination index.
+	 *
+	 *	@param[in]	index		Report the message to this destination index.
+	 *	@param[in]	severity	Severity (::AJA_DEBUG_SEVERITY) of the message to report.
+	 *	@param[in]	pFileName	The source filename reporting the message.
+	 *	@param[in]	lineNumber	The line number in the source file reporting the message.
+	 *	@param[in]	inRecord	The format string and arguments to report.
+	 */
+	static void Report (int32_t index, int32_t severity, const char* pFileName, int32_t lineNumber, const AJADebugDeferredRecord & inRecord);	//	New in SDK 17.1
+#endif	//	AJA_USE_CPLUSPLUS11
+
+	/**
+	 *	Formats a deferred message record into text.
+	 *
+	 *	@param[in]	pRecord		The packed record (see AJADebugDeferredRecord).
+	 *	@param[in]	inSize		The record's capacity, in bytes.
+	 *	@return		The formatted message text.
+	 */
+	static std::string FormatDeferred (const char* pRecord, const size_t inSize);	//	New in SDK 17.1
+
 	/**
 	 *	Assert that an unexpected error has occurred.
 	 *
@@ -747,6 +914,10 @@ public:
 	static void * GetPrivateDataLoc (void);
 	static size_t GetPrivateDataLen (void);
 
+private:
+	static bool CountIgnored (void);	///< @brief	Tallies a message filtered out by IsReporting. Always returns false.
+	static AJADebugShare * volatile spReportShare;	///< @brief	The open shared region, as seen by IsReporting (NULL when closed)
+
 };	//	AJADebug
 
 std::ostream & operator << (std::ostream & oss, const AJADebugStat & inStat);
@@ -167,6 +167,20 @@ typedef enum _AJADebugUnit
 #define AJA_DEBUG_DESTINATION_CONSOLE	0x00000002	/**< Send message to the console */
 #define AJA_DEBUG_DESTINATION_LOG		0x00000004	/**< Send message to a log file */
 #define AJA_DEBUG_DESTINATION_DRIVER	0x00000008	/**< Send message directly to driver output (driver messages only) */
+#define AJA_DEBUG_MESSAGE_DEFERRED		0x80000000	/**< Not a destination: set in a message's destinationMask when its text holds a format string and packed arguments (see AJA_dREPORT) */
+///@}
+
+/**
+	@defgroup	AJAGroupDeferredTag AJA_DEBUG_DEFERRED_TAG
+	Type tags that precede each packed argument in a deferred message's text (see ::AJA_DEBUG_MESSAGE_DEFERRED).
+	@ingroup	AJAGroupDebug
+**/
+///@{
+#define AJA_DEBUG_DEFERRED_TAG_SIGNED	'i'		/**< Followed by an int64_t */
+#define AJA_DEBUG_DEFERRED_TAG_UNSIGNED	'u'		/**< Followed by a uint64_t */
+#define AJA_DEBUG_DEFERRED_TAG_DOUBLE	'f'		/**< Followed by a double */
+#define AJA_DEBUG_DEFERRED_TAG_STRING	's'		/**< Followed by a NUL-terminated string */
+#define AJA_DEBUG_DEFERRED_TAG_POINTER	'p'		/**< Followed by a uint64_t address */
 ///@}
 
 /**
@@ -249,6 +263,10 @@ typedef enum _AJADebugStats
 	AJA_DebugStat_ACXferRPCDecode,
 	AJA_DebugStat_NUM_STATS
 } AJADebugStats;
+
+#define	AJA_DebugStat_ACLatencyFirst		128		/**< First of the stat keys reserved for AutoCirculate latency percentiles (see CNTV2Card::AutoCirculatePublishLatencyStats) */
+#define	AJA_DebugStat_ACLatencyCount		96		/**< Number of stat keys reserved for AutoCirculate latency percentiles (8 channels x 4 stages x 3 percentiles) */
+#define	AJA_DebugStat_ACLatencyDevice		(AJA_DebugStat_ACLatencyFirst + AJA_DebugStat_ACLatencyCount)	/**< Index number of the device that owns the AutoCirculate latency keys */
 ///@}
 
 
@@ -8,26 +8,96 @@
 #include "ajabase/system/linux/eventimpl.h"
 #include "ajabase/system/debug.h"
 #include <errno.h>
+#include <limits.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <linux/futex.h>
 
 #define MAX_EVENTS 64
 
 using std::string;
 
+// Events are eventfds: the counter is non-zero while signaled, so any number of events can be waited
+// on together with poll. WaitForSignal sleeps on a futex instead, a generation count that Signal bumps,
+// so a manual reset Signal immediately followed by Clear still releases every thread that was already
+// waiting. Signal only makes the futex wake call when a thread is waiting. Timeouts are measured
+// against CLOCK_MONOTONIC, so waits are unaffected by wall-clock changes.
+
+static int64_t MonotonicMilliseconds(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t(ts.tv_sec) * 1000) + (ts.tv_nsec / 1000000);
+}
+
+// Returns the poll/futex timeout for the time left until deadline (-1 is infinite)
+static int RemainingMilliseconds(uint32_t timeout, int64_t deadline)
+{
+	if (timeout == 0xffffffff)
+		return -1;
+	int64_t remaining = deadline - MonotonicMilliseconds();
+	if (remaining <= 0)
+		return 0;
+	return int(remaining);
+}
+
+// Returns true if the eventfd's counter is non-zero, without consuming it
+static bool IsSignaled(int fd)
+{
+	struct pollfd pfd;
+	pfd.fd = fd;
+	pfd.events = POLLIN;
+	pfd.revents = 0;
+	return poll(&pfd, 1, 0) > 0;
+}
+
+// Consumes a signal, returns false if the event wasn't signaled (another waiter took it)
+static bool ConsumeSignal(int fd)
+{
+	eventfd_t value;
+	return eventfd_read(fd, &value) == 0;
+}
+
+// Sleeps while *pWord equals value, for up to timeoutMs (-1 is infinite)
+static int FutexWait(uint32_t* pWord, uint32_t value, int timeoutMs)
+{
+	struct timespec ts;
+	ts.tv_sec = timeoutMs / 1000;
+	ts.tv_nsec = long(timeoutMs % 1000) * 1000000;
+	return int(syscall(SYS_futex, pWord, FUTEX_WAIT_PRIVATE, value, timeoutMs < 0 ? NULL : &ts, NULL, 0));
+}
+
+static void FutexWake(uint32_t* pWord, int count)
+{
+	syscall(SYS_futex, pWord, FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+}
+
+
 // event implementation class (linux)
 AJAEventImpl::AJAEventImpl(bool manualReset, const std::string& name)
-	: mManualReset(manualReset)
+	: mEventFd(-1),
+	  mGeneration(0),
+	  mWaiters(0),
+	  mManualReset(manualReset)
 {
 	AJA_UNUSED(name);
-	pthread_mutex_init(&mMutex, NULL);
-	pthread_cond_init(&mCondVar, NULL);
-	Clear();
+	mEventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (mEventFd < 0)
+	{
+		AJA_REPORT(0, AJA_DebugSeverity_Error, "AJAEventImpl::AJAEventImpl() eventfd returns error %08x", errno);
+	}
 }
 
 
 AJAEventImpl::~AJAEventImpl(void)
 {
-	pthread_cond_destroy(&mCondVar);
-	pthread_mutex_destroy(&mMutex);
+	if (mEventFd >= 0)
+	{
+		close(mEventFd);
+		mEventFd = -1;
+	}
 }
 
 
@@ -35,12 +105,19 @@ AJAStatus
 AJAEventImpl::Signal(void)
 {
 	// check for open
-	int theError;
+	if (mEventFd < 0)
+		return AJA_STATUS_OPEN;
 
-	pthread_mutex_lock(&mMutex);
-	mSignaled = true;
-	theError  = pthread_cond_broadcast(&mCondVar);
-	pthread_mutex_unlock(&mMutex);
+	// adding to an already non-zero counter leaves the event signaled once
+	int theError = 0;
+	if (eventfd_write(mEventFd, 1) != 0  &&  errno != EAGAIN)
+		theError = errno;
+
+	// a waiter that saw the old generation either hasn't slept yet, and its futex wait returns at once,
+	// or it counted itself in mWaiters first, and gets woken
+	__atomic_add_fetch(&mGeneration, 1, __ATOMIC_SEQ_CST);
+	if (__atomic_load_n(&mWaiters, __ATOMIC_SEQ_CST))
+		FutexWake(&mGeneration, mManualReset ? INT_MAX : 1);
 
 	if (theError)
 	{
@@ -55,7 +132,11 @@ AJAStatus
 AJAEventImpl::Clear(void)
 {
 	// check for open
-	mSignaled = false;
+	if (mEventFd < 0)
+		return AJA_STATUS_OPEN;
+
+	// reading resets the counter, EAGAIN means it was already clear
+	ConsumeSignal(mEventFd);
 	return AJA_STATUS_SUCCESS;
 }
 
@@ -81,10 +162,17 @@ AJAEventImpl::SetState(bool signaled)
 AJAStatus
 AJAEventImpl::GetState(bool* pSignaled)
 {
-	AJA_UNUSED(pSignaled);
+	// check for open
+	if (mEventFd < 0)
+		return AJA_STATUS_OPEN;
+
+	if (pSignaled != NULL)
+	{
+		// peek without consuming the signal
+		*pSignaled = IsSignaled(mEventFd);
+	}
 
-	// wait with timeout 0 returns immediately
-	return WaitForSignal(0);
+	return AJA_STATUS_SUCCESS;
 }
 
 
@@ -112,70 +200,69 @@ AJAEventImpl::GetManualReset(bool* pManualReset)
 AJAStatus
 AJAEventImpl::WaitForSignal(uint32_t timeout)
 {
-	static const long long	NS_PER_SEC = 1000000000ULL;
-
 	// check for open
-	int64_t nanos = timeout;
-	nanos *= 1000000;
+	if (mEventFd < 0)
+		return AJA_STATUS_OPEN;
 
-	struct timespec ts;
-	int32_t			result;
-	AJAStatus		status = AJA_STATUS_SUCCESS;
-	
-	clock_gettime(CLOCK_REALTIME, &ts);
-
-	nanos	  += ts.tv_nsec;
-	ts.tv_sec += (nanos / NS_PER_SEC);
-	ts.tv_nsec = (nanos % NS_PER_SEC);
-
-	pthread_mutex_lock(&mMutex);
-
-	if (false == mSignaled)
+	int64_t deadline = MonotonicMilliseconds() + timeout;
+	const uint32_t generation = __atomic_load_n(&mGeneration, __ATOMIC_SEQ_CST);
+	uint32_t current = generation;
+	for (;;)
 	{
-		result = pthread_cond_timedwait(&mCondVar, &mMutex, &ts);
+		// an auto reset event releases only one waiter, the others keep waiting
+		if (mManualReset ? IsSignaled(mEventFd) : ConsumeSignal(mEventFd))
+			return AJA_STATUS_SUCCESS;
+		// a manual reset event signaled since the wait began releases it, even if cleared again since
+		if (mManualReset  &&  current != generation)
+			return AJA_STATUS_SUCCESS;
+
+		int remaining = RemainingMilliseconds(timeout, deadline);
+		if (remaining == 0)
+		{
+			AJA_REPORT(0, AJA_DebugSeverity_Info, "AJAEventImpl::WaitForSignal() timeout");
+			return AJA_STATUS_TIMEOUT;
+		}
 
-		if (0 != result)
+		__atomic_add_fetch(&mWaiters, 1, __ATOMIC_SEQ_CST);
+		int result = FutexWait(&mGeneration, current, remaining);
+		int theError = errno;
+		__atomic_sub_fetch(&mWaiters, 1, __ATOMIC_SEQ_CST);
+		if (result != 0  &&  theError != EAGAIN  &&  theError != EINTR  &&  theError != ETIMEDOUT)
 		{
-			if (result == ETIMEDOUT) 
-			{
-				AJA_REPORT(0, AJA_DebugSeverity_Info,
-					"AJAEventImpl::WaitForSignal() timeout", result);
-				status = AJA_STATUS_TIMEOUT;
-			}
-			else
-			{
-				AJA_REPORT(0, AJA_DebugSeverity_Error,
-					"AJAEventImpl::WaitForSignal() "
-					"pthread_cond_timedwait returns error %08x", result);
-				status = AJA_STATUS_FAIL;
-			}
+			AJA_REPORT(0, AJA_DebugSeverity_Error, "AJAEventImpl::WaitForSignal() futex wait returns error %08x", theError);
+			return AJA_STATUS_FAIL;
 		}
+		current = __atomic_load_n(&mGeneration, __ATOMIC_SEQ_CST);
 	}
-	if (!mManualReset)
-	{
-		mSignaled = false;
-	}
-	pthread_mutex_unlock(&mMutex);
-	return (status);
 }
 
 
 AJAStatus
 AJAEventImpl::GetEventObject(uint64_t* pEventObject)
 {
-	AJA_UNUSED(pEventObject);
+	if (pEventObject != NULL)
+	{
+		if (mEventFd >= 0)
+		{
+			*pEventObject = (uint64_t)mEventFd;
+		}
+		else
+		{
+			return AJA_STATUS_OPEN;
+		}
+	}
 
 	return AJA_STATUS_SUCCESS;
 }
 
 
-/*
 AJAStatus
-AJAWaitForEvents(AJAEventPtr* pEventList, uint32_t numEvents, bool all, uint32_t timeout)
+AJAWaitForEvents(AJAEvent* pEventList, uint32_t numEvents, bool all, uint32_t timeout)
 {
-	
-	HANDLE eventArray[MAX_EVENTS];
-	
+	struct pollfd	pollFds[MAX_EVENTS];
+	bool			manualReset[MAX_EVENTS];
+	bool			registered[MAX_EVENTS];
+
 	if (pEventList == NULL)
 	{
 		AJA_REPORT(0, AJA_DebugSeverity_Error, "AJAWaitForEvents  event list is NULL");
@@ -194,44 +281,86 @@ AJAWaitForEvents(AJAEventPtr* pEventList, uint32_t numEvents, bool all, uint32_t
 		return AJA_STATUS_RANGE;
 	}
 
-	uint32_t i;
-
-	// build the array of handles from the AJAEvent(s)
+	// poll the eventfds of the AJAEvent(s) directly, the same event listed twice is only waited on once
+	uint32_t i, j;
 	for (i = 0; i < numEvents; i++)
 	{
-		AJAEventPtr eventPtr = pEventList[i];
-		AJA_ASSERT(eventPtr->mImplPtr->mEvent != NULL);
-		if(eventPtr->mImplPtr->mEvent == NULL)
+		AJAEventImpl* pImpl = pEventList[i].mpImpl;
+		if (pImpl == NULL || pImpl->mEventFd < 0)
 		{
 			AJA_REPORT(0, AJA_DebugSeverity_Error, "AJAWaitForEvents  event not initialized");
-			return AJA_STATUS_INITIALIZE;
+			return AJA_STATUS_OPEN;
 		}
-		eventArray[i] = eventPtr->mImplPtr->mEvent;
+		pImpl->GetManualReset(&manualReset[i]);
+		registered[i] = true;
+		for (j = 0; j < i; j++)
+			if (registered[j]  &&  pollFds[j].fd == pImpl->mEventFd)
+				registered[i] = false;
+		pollFds[i].fd = registered[i] ? pImpl->mEventFd : -1;	// poll skips negative fds
+		pollFds[i].events = POLLIN;
+		pollFds[i].revents = 0;
 	}
 
-	// check for infinite timeout
-	if (timeout == 0xffffffff)
+	int64_t deadline = MonotonicMilliseconds() + timeout;
+	for (;;)
 	{
-		timeout = INFINITE;
-	}
+		int result = poll(pollFds, numEvents, RemainingMilliseconds(timeout, deadline));
+		if (result == 0)
+			return AJA_STATUS_TIMEOUT;
+		if (result < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			AJA_REPORT(0, AJA_DebugSeverity_Error, "AJAWaitForEvents  poll returns error %08x", errno);
+			return AJA_STATUS_FAIL;
+		}
 
-	// wait for event(s) to be signaled
-	DWORD retCode = WaitForMultipleObjects(numEvents, eventArray, all, (DWORD)timeout);
+		if (!all)
+		{
+			// any one event will do, auto reset events another thread consumed first don't count
+			for (i = 0; i < numEvents; i++)
+				if ((pollFds[i].revents & POLLIN)  &&  (manualReset[i] || ConsumeSignal(pollFds[i].fd)))
+					return AJA_STATUS_SUCCESS;
+			continue;
+		}
 
-	// an event was signaled
-	if ((retCode >= WAIT_OBJECT_0) && (retCode < (WAIT_OBJECT_0 + numEvents)))
-	{
-		return AJA_STATUS_SUCCESS;
-	}
-	// the wait timed out
-	else if (retCode == WAIT_TIMEOUT)
-	{
-		return AJA_STATUS_TIMEOUT;
-	}
+		// in all mode stop polling the ones seen signaled, until every event has been seen
+		bool allSeen = true;
+		for (i = 0; i < numEvents; i++)
+		{
+			if (pollFds[i].revents & POLLIN)
+				pollFds[i].fd = -1;
+			if (registered[i]  &&  pollFds[i].fd >= 0)
+				allSeen = false;
+		}
+		if (!allSeen)
+			continue;
 
-	// some type of error occurred
-	AJA_REPORT(0, AJA_DebugSeverity_Error, "AJAEvent()::WaitForEvents WaitForMultipleObjects() returns error %08x", retCode);
+		// every event has been seen signaled, now take all the auto reset signals, or none of them
+		bool consumed[MAX_EVENTS];
+		bool allTaken = true;
+		for (i = 0; i < numEvents; i++)
+		{
+			consumed[i] = false;
+			if (!registered[i])
+				continue;
+			int fd = pEventList[i].mpImpl->mEventFd;
+			if (manualReset[i] ? IsSignaled(fd) : (consumed[i] = ConsumeSignal(fd)))
+				continue;
+
+			// this one was cleared or taken meanwhile
+			allTaken = false;
+		}
+		if (allTaken)
+			return AJA_STATUS_SUCCESS;
 
-	return AJA_STATUS_FAIL;
+		// put back what was taken and poll everything again, the ones still signaled report again at once
+		for (i = 0; i < numEvents; i++)
+		{
+			if (consumed[i])
+				pEventList[i].mpImpl->Signal();	// wakes any WaitForSignal that saw it taken
+			if (registered[i])
+				pollFds[i].fd = pEventList[i].mpImpl->mEventFd;
+		}
+	}
 }
-*/
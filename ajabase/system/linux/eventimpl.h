@@ -33,10 +33,11 @@ public:
 
 	virtual AJAStatus	GetEventObject(uint64_t* pEventObject);
 
+	int					mEventFd;		///< @brief	eventfd whose counter is non-zero while signaled, pollable by AJAWaitForEvents
+
 private:
-	pthread_mutex_t		mMutex;
-	pthread_cond_t		mCondVar;
-	bool				mSignaled;
+	uint32_t			mGeneration;	///< @brief	Futex word bumped by every Signal, so a manual reset pulse isn't missed
+	uint32_t			mWaiters;		///< @brief	Threads blocked in WaitForSignal, Signal skips the futex wake if none
 	bool				mManualReset;
 };
 
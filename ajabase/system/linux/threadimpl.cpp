@@ -15,9 +15,22 @@
 #include <sys/prctl.h>
 #include <unistd.h>
 #include <string.h>
+#include <fstream>
+#include <sstream>
 
 static const size_t STACK_SIZE = 1024 * 1024;
 
+// reads a sysfs list file (used for both CPU and node lists)
+static bool ReadSysfsList(const std::string& path, AJACPUSet& outList)
+{
+	outList.clear();
+	std::ifstream ifs(path.c_str());
+	std::string text;
+	if (!ifs || !std::getline(ifs, text))
+		return false;
+	return AJAThreadImpl::ParseSysfsList(text, outList);
+}
+
 bool is_pthread_alive(pthread_t thread)
 {
 #if 1
@@ -45,6 +58,10 @@ AJAThreadImpl::AJAThreadImpl(AJAThread* pThreadContext) :
 	mThread(0),
 	mTid(0),
 	mPriority(AJA_ThreadPriority_Normal),
+	mNUMANode(-1),
+	mSchedulingProfile(AJA_ThreadSchedulingProfile_Default),
+	mStartNUMANode(-1),
+	mStartSchedulingProfile(AJA_ThreadSchedulingProfile_Default),
 	mThreadFunc(0),
 	mpUserContext(0),
 	mThreadStarted(false),
@@ -142,8 +159,11 @@ AJAThreadImpl::Start()
 		return AJA_STATUS_FAIL;
 	}
 
-	// create the thread
+	// create the thread, with its own copy of the placement settings to apply
 	mThreadStarted = false;
+	mStartCPUs = mCPUs;
+	mStartNUMANode = mNUMANode;
+	mStartSchedulingProfile = mSchedulingProfile;
 
 	rc = pthread_create(&mThread, &attr, ThreadProcStatic, this);
 	if (rc)
@@ -528,6 +548,285 @@ AJAThreadImpl::SetRealTime(AJAThreadRealTimePolicy policy, int priority)
 }
 
 
+AJAStatus
+AJAThreadImpl::SetCPUAffinity(const AJACPUSet& cpus)
+{
+	AJAAutoLock lock(&mLock);
+
+	// save affinity for starts
+	mCPUs = cpus;
+
+	// If thread isn't running, ThreadProcStatic will apply it
+	if (!Active())
+		return AJA_STATUS_SUCCESS;
+
+	return ApplyCPUAffinity(mThread, true, mCPUs, mNUMANode);
+}
+
+
+AJAStatus
+AJAThreadImpl::GetCPUAffinity(AJACPUSet* pCPUs)
+{
+	if (pCPUs == NULL)
+		return AJA_STATUS_NULL;
+
+	AJAAutoLock lock(&mLock);
+	if (!Active())
+	{
+		*pCPUs = mCPUs;
+		return AJA_STATUS_SUCCESS;
+	}
+
+	cpu_set_t cpuSet;
+	CPU_ZERO(&cpuSet);
+	int rc = pthread_getaffinity_np(mThread, sizeof(cpuSet), &cpuSet);
+	if (rc != 0)
+	{
+		AJA_REPORT(0, AJA_DebugSeverity_Error, "AJAThread(%p)::GetCPUAffinity: error %d getting affinity", mpThreadContext, rc);
+		return AJA_STATUS_FAIL;
+	}
+
+	pCPUs->clear();
+	for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+		if (CPU_ISSET(cpu, &cpuSet))
+			pCPUs->insert(uint32_t(cpu));
+	return AJA_STATUS_SUCCESS;
+}
+
+
+AJAStatus
+AJAThreadImpl::SetNUMANode(int node)
+{
+	AJACPUSet nodeCPUs;
+	if (node >= 0 && AJA_FAILURE(GetNUMANodeCPUs(node, nodeCPUs)))
+	{
+		AJA_REPORT(0, AJA_DebugSeverity_Error, "AJAThread(%p)::SetNUMANode: bad node %d", mpThreadContext, node);
+		return AJA_STATUS_RANGE;
+	}
+
+	AJAAutoLock lock(&mLock);
+
+	// save node for starts
+	mNUMANode = node < 0 ? -1 : node;
+
+	// If thread isn't running, ThreadProcStatic will apply it
+	if (!Active())
+		return AJA_STATUS_SUCCESS;
+
+	return ApplyCPUAffinity(mThread, true, mCPUs, mNUMANode);
+}
+
+
+AJAStatus
+AJAThreadImpl::GetNUMANode(int* pNode)
+{
+	if (pNode == NULL)
+		return AJA_STATUS_NULL;
+
+	AJAAutoLock lock(&mLock);
+	*pNode = mNUMANode;
+	return AJA_STATUS_SUCCESS;
+}
+
+
+AJAStatus
+AJAThreadImpl::SetSchedulingProfile(AJAThreadSchedulingProfile profile)
+{
+	switch (profile)
+	{
+		case AJA_ThreadSchedulingProfile_Default:
+		case AJA_ThreadSchedulingProfile_Background:
+		case AJA_ThreadSchedulingProfile_Normal:
+		case AJA_ThreadSchedulingProfile_Media:
+		case AJA_ThreadSchedulingProfile_Critical:
+			break;
+		default:
+			AJA_REPORT(0, AJA_DebugSeverity_Error, "AJAThread(%p)::SetSchedulingProfile: bad profile %d", mpThreadContext, profile);
+			return AJA_STATUS_RANGE;
+	}
+
+	AJAAutoLock lock(&mLock);
+
+	// save profile for starts
+	mSchedulingProfile = profile;
+
+	// If thread isn't running, ThreadProcStatic will apply it
+	if (!Active())
+		return AJA_STATUS_SUCCESS;
+
+	if (mTid == 0)
+		return AJA_STATUS_FAIL;
+
+	return ApplySchedulingProfile(mThread, mTid, mSchedulingProfile);
+}
+
+
+AJAStatus
+AJAThreadImpl::GetSchedulingProfile(AJAThreadSchedulingProfile* pProfile)
+{
+	if (pProfile == NULL)
+		return AJA_STATUS_NULL;
+
+	AJAAutoLock lock(&mLock);
+	*pProfile = mSchedulingProfile;
+	return AJA_STATUS_SUCCESS;
+}
+
+
+AJAStatus
+AJAThreadImpl::ApplyCPUAffinity(pthread_t thread, bool inWhenUnrestricted, const AJACPUSet& cpus, int node)
+{
+	const bool restricted = !cpus.empty() || node >= 0;
+	if (!restricted && !inWhenUnrestricted)
+		return AJA_STATUS_SUCCESS;	// nothing to do -- keep what the thread inherited
+
+	cpu_set_t cpuSet;
+	CPU_ZERO(&cpuSet);
+	if (!restricted)
+	{
+		// lift an earlier restriction -- the kernel clips this to the CPUs our cpuset allows
+		const long numCPUs = sysconf(_SC_NPROCESSORS_CONF);
+		for (long cpu = 0; cpu < numCPUs && cpu < CPU_SETSIZE; cpu++)
+			CPU_SET(cpu, &cpuSet);
+	}
+	else
+	{
+		AJACPUSet nodeCPUs;
+		if (node >= 0 && AJA_FAILURE(GetNUMANodeCPUs(node, nodeCPUs)))
+			return AJA_STATUS_RANGE;
+
+		int count = 0;
+		const AJACPUSet& useCPUs = cpus.empty() ? nodeCPUs : cpus;
+		for (AJACPUSet::const_iterator it(useCPUs.begin());  it != useCPUs.end();  ++it)
+		{
+			if (*it >= CPU_SETSIZE)
+				continue;
+			if (node >= 0 && nodeCPUs.find(*it) == nodeCPUs.end())
+				continue;	// run on the intersection of the CPU set and the node
+			CPU_SET(*it, &cpuSet);
+			count++;
+		}
+		if (count == 0)
+		{
+			AJA_REPORT(0, AJA_DebugSeverity_Error, "AJAThread(%p)::ApplyCPUAffinity: no usable CPU for node %d", mpThreadContext, node);
+			return AJA_STATUS_RANGE;
+		}
+	}
+
+	int rc = pthread_setaffinity_np(thread, sizeof(cpuSet), &cpuSet);
+	if (rc != 0)
+	{
+		AJA_REPORT(0, AJA_DebugSeverity_Error, "AJAThread(%p)::ApplyCPUAffinity: error %d setting affinity", mpThreadContext, rc);
+		return AJA_STATUS_FAIL;
+	}
+	return AJA_STATUS_SUCCESS;
+}
+
+
+AJAStatus
+AJAThreadImpl::ApplySchedulingProfile(pthread_t thread, pid_t tid, AJAThreadSchedulingProfile profile)
+{
+	int policy = SCHED_OTHER;
+	int priority = 0;	// sched_priority for SCHED_RR/SCHED_FIFO, "nice" level for SCHED_OTHER
+	switch (profile)
+	{
+		case AJA_ThreadSchedulingProfile_Default:
+			return AJA_STATUS_SUCCESS;	// keep what the thread inherited
+		case AJA_ThreadSchedulingProfile_Background:
+			policy = SCHED_OTHER;
+			priority = 10;
+			break;
+		case AJA_ThreadSchedulingProfile_Normal:
+			policy = SCHED_OTHER;
+			priority = 0;
+			break;
+		case AJA_ThreadSchedulingProfile_Media:
+			policy = SCHED_RR;
+			priority = 50;
+			break;
+		case AJA_ThreadSchedulingProfile_Critical:
+			policy = SCHED_FIFO;
+			priority = 80;
+			break;
+		default:
+			return AJA_STATUS_RANGE;
+	}
+
+	struct sched_param newParam;
+	memset(&newParam, 0, sizeof(newParam));
+	newParam.sched_priority = (policy == SCHED_OTHER) ? 0 : priority;
+	int rc = pthread_setschedparam(thread, policy, &newParam);
+	if (rc != 0)
+	{
+		AJA_REPORT(0, AJA_DebugSeverity_Error, "AJAThread(%p)::ApplySchedulingProfile: error %d setting sched param: policy = %d, priority = %d", mpThreadContext, rc, policy, newParam.sched_priority);
+		return AJA_STATUS_FAIL;
+	}
+
+	// real-time threads ignore "nice", so reset it to zero for them
+	const int newNice = (policy == SCHED_OTHER) ? priority : 0;
+	if (setpriority(PRIO_PROCESS, id_t(tid), newNice) != 0)
+	{
+		AJA_REPORT(0, AJA_DebugSeverity_Error, "AJAThread(%p)::ApplySchedulingProfile: error %d setting nice level: %d", mpThreadContext, errno, newNice);
+		return AJA_STATUS_FAIL;
+	}
+	return AJA_STATUS_SUCCESS;
+}
+
+
+int
+AJAThreadImpl::GetNUMANodeCount()
+{
+	AJACPUSet nodes;
+	if (!ReadSysfsList("/sys/devices/system/node/online", nodes))
+		return 1;	// kernel without NUMA support
+	return int(nodes.size());
+}
+
+
+AJAStatus
+AJAThreadImpl::GetNUMANodeCPUs(int node, AJACPUSet& outCPUs)
+{
+	outCPUs.clear();
+	if (node < 0)
+		return AJA_STATUS_RANGE;
+
+	std::ostringstream oss;
+	oss << "/sys/devices/system/node/node" << node << "/cpulist";
+	if (ReadSysfsList(oss.str(), outCPUs))
+		return AJA_STATUS_SUCCESS;
+
+	// kernel without NUMA support -- everything is node 0
+	AJACPUSet nodes;
+	if (node == 0 && !ReadSysfsList("/sys/devices/system/node/online", nodes))
+		if (ReadSysfsList("/sys/devices/system/cpu/online", outCPUs))
+			return AJA_STATUS_SUCCESS;
+	return AJA_STATUS_RANGE;
+}
+
+
+bool
+AJAThreadImpl::ParseSysfsList(const std::string& text, AJACPUSet& outList)
+{
+	outList.clear();
+	std::istringstream iss(text);
+	std::string range;
+	while (std::getline(iss, range, ','))
+	{
+		unsigned first = 0, last = 0;
+		const int n = sscanf(range.c_str(), "%u-%u", &first, &last);
+		if (n < 1)
+			continue;
+		if (n == 1)
+			last = first;
+		if (last < first || last - first > 0xFFFF)
+			continue;	// malformed, or too big to be a real CPU or node range
+		for (unsigned i = first; i <= last; i++)
+			outList.insert(uint32_t(i));
+	}
+	return !outList.empty();
+}
+
+
 AJAStatus
 AJAThreadImpl::Attach(AJAThreadFunction* pThreadFunction, void* pUserContext)
 {
@@ -557,6 +856,13 @@ AJAThreadImpl::ThreadProcStatic(void* pThreadImplContext)
 	if (errno == 0)							// theoretically gettid() cannot fail, so by extension syscall(SYS_gettid) can't either...?
 		pThreadImpl->mTid = myTid;
 
+	// Apply affinity and scheduling before signaling the parent, so that anything the thread
+	// allocates and touches first is already placed on its CPUs' NUMA node. Failures are logged
+	// but not fatal -- the thread still runs, just without the requested placement. Start holds mLock
+	// until we signal it, so use the copies it made rather than the live settings.
+	pThreadImpl->ApplyCPUAffinity(pthread_self(), false, pThreadImpl->mStartCPUs, pThreadImpl->mStartNUMANode);
+	pThreadImpl->ApplySchedulingProfile(pthread_self(), myTid, pThreadImpl->mStartSchedulingProfile);
+
 
 	// signal parent we've started
 	int rc = pthread_mutex_lock(&pThreadImpl->mStartMutex);
@@ -36,17 +36,37 @@ public:
 
 	AJAStatus		SetRealTime(AJAThreadRealTimePolicy policy, int priority);
 
+	AJAStatus		SetCPUAffinity(const AJACPUSet& cpus);
+	AJAStatus		GetCPUAffinity(AJACPUSet* pCPUs);
+	AJAStatus		SetNUMANode(int node);
+	AJAStatus		GetNUMANode(int* pNode);
+	AJAStatus		SetSchedulingProfile(AJAThreadSchedulingProfile profile);
+	AJAStatus		GetSchedulingProfile(AJAThreadSchedulingProfile* pProfile);
+
 	AJAStatus		Attach(AJAThreadFunction* pThreadFunction, void* pUserContext);
 	AJAStatus		SetThreadName(const char *name);
 
 	static uint64_t GetThreadId();
+	static int		GetNUMANodeCount();
+	static AJAStatus GetNUMANodeCPUs(int node, AJACPUSet& outCPUs);
+	static bool		ParseSysfsList(const std::string& text, AJACPUSet& outList);	// "0-3,8,10-11" style CPU or node list
 	static void*	ThreadProcStatic(void* pThreadImplContext);
 
+private:
+	AJAStatus		ApplyCPUAffinity(pthread_t thread, bool inWhenUnrestricted, const AJACPUSet& cpus, int node);
+	AJAStatus		ApplySchedulingProfile(pthread_t thread, pid_t tid, AJAThreadSchedulingProfile profile);
+
 public:
 	AJAThread*			mpThreadContext;
 	pthread_t			mThread;
 	pid_t				mTid;
 	AJAThreadPriority	mPriority;
+	AJACPUSet			mCPUs;
+	int					mNUMANode;
+	AJAThreadSchedulingProfile	mSchedulingProfile;
+	AJACPUSet			mStartCPUs;			// copies Start makes under mLock for the new thread
+	int					mStartNUMANode;
+	AJAThreadSchedulingProfile	mStartSchedulingProfile;
 	AJAThreadFunction*	mThreadFunc;
 	void*				mpUserContext;
 	AJALock				mLock;
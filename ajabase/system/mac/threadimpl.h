@@ -35,9 +35,18 @@ public:
 
 	AJAStatus		SetRealTime(AJAThreadRealTimePolicy policy, int priority);
 
+	AJAStatus		SetCPUAffinity(const AJACPUSet& cpus);
+	AJAStatus		GetCPUAffinity(AJACPUSet* pCPUs);
+	AJAStatus		SetNUMANode(int node);
+	AJAStatus		GetNUMANode(int* pNode);
+	AJAStatus		SetSchedulingProfile(AJAThreadSchedulingProfile profile);
+	AJAStatus		GetSchedulingProfile(AJAThreadSchedulingProfile* pProfile);
+
 	AJAStatus		Attach(AJAThreadFunction* pThreadFunction, void* pUserContext);
 
 	static uint64_t GetThreadId();
+	static int		GetNUMANodeCount();
+	static AJAStatus GetNUMANodeCPUs(int node, AJACPUSet& outCPUs);
 	static void*	ThreadProcStatic(void* pThreadImplContext);
 	AJAStatus		SetThreadName(const char *name);
 
@@ -17,6 +17,10 @@
 	#include <sys/types.h>
 	#include <unistd.h>
 	#include <string.h> //	for strerror
+	#if defined(AJA_LINUX)
+		#include <sys/syscall.h>
+		#include <linux/mempolicy.h>
+	#endif
 #elif defined(MSWindows)
     #include "ajabase/system/system.h"  //  for Windows API #includes
 #elif defined(AJA_BAREMETAL)
@@ -165,6 +169,79 @@ AJAMemory::FreeAligned(void* pMemory)
 }
 
 
+void*
+AJAMemory::AllocateAlignedOnNode(size_t size, size_t alignment, int node)
+{
+	if (size == 0)
+	{
+		AJA_REPORT(0, AJA_DebugSeverity_Error, "AJAMemory::AllocateAlignedOnNode	size is 0");
+		return NULL;
+	}
+
+	// whole pages only, so the memory policy never spills onto a neighbor's allocation
+	const size_t pageSize = size_t(AJA_PAGE_SIZE);
+	size = (size + pageSize - 1) / pageSize * pageSize;
+	if (alignment < pageSize)
+		alignment = pageSize;
+
+	void* pMemory = AllocateAligned(size, alignment);
+	if (pMemory == NULL || node < 0)
+		return pMemory;
+
+	if (!BindToNUMANode(pMemory, size, node))
+		AJA_REPORT(0, AJA_DebugSeverity_Warning, "AJAMemory::AllocateAlignedOnNode	can't prefer node %d, memory is unbound", node);
+
+	return pMemory;
+}
+
+
+bool
+AJAMemory::BindToNUMANode(void* pMemory, size_t size, int node)
+{
+	if (pMemory == NULL || size == 0 || node < 0)
+		return false;
+
+#if defined(AJA_LINUX)
+	// MPOL_PREFERRED falls back to other nodes rather than failing the fault,
+	// and MPOL_MF_MOVE migrates any pages that were already touched
+	static const int kMaxNodes = 1024;
+	unsigned long nodeMask[kMaxNodes / (8 * sizeof(unsigned long))];
+	if (node >= kMaxNodes)
+		return false;
+	memset(nodeMask, 0, sizeof(nodeMask));
+	nodeMask[node / (8 * sizeof(unsigned long))] |= 1UL << (node % (8 * sizeof(unsigned long)));
+	const size_t pageSize = size_t(AJA_PAGE_SIZE);
+	size = (size + pageSize - 1) / pageSize * pageSize;
+	if (syscall(SYS_mbind, pMemory, size, MPOL_PREFERRED, nodeMask, (unsigned long)(kMaxNodes + 1), MPOL_MF_MOVE) != 0)
+	{
+		// ENOSYS/EINVAL on kernels or containers without NUMA support
+		AJA_REPORT(0, AJA_DebugSeverity_Warning, "AJAMemory::BindToNUMANode	mbind to node %d failed errno=%d", node, errno);
+		return false;
+	}
+	return true;
+#else
+	return false;
+#endif
+}
+
+
+int
+AJAMemory::GetNUMANode(const void* pMemory)
+{
+	if (pMemory == NULL)
+		return -1;
+
+#if defined(AJA_LINUX)
+	int node = -1;
+	if (syscall(SYS_get_mempolicy, &node, NULL, 0UL, pMemory, (unsigned long)(MPOL_F_NODE | MPOL_F_ADDR)) != 0)
+		return -1;
+	return node;
+#else
+	return -1;
+#endif
+}
+
+
 void* 
 AJAMemory::AllocateShared(size_t* pMemorySize, const char* pShareName, bool global)
 {
@@ -52,6 +52,39 @@ public:
 	 */
 	static void  FreeAligned(void* pMemory);
 
+	/**
+	 *	Allocate memory aligned to alignment bytes, preferring physical pages from a given NUMA node.
+	 *
+	 *	The size is rounded up to a whole number of pages, and the alignment is raised to at least a page.
+	 *	On Linux the pages are bound to the node with a preferred memory policy before they are first touched,
+	 *	so the kernel places them on that node whenever it has free memory there.  Elsewhere (or if the node is
+	 *	negative) this behaves like AllocateAligned().
+	 *
+	 *	@param[in]	size		Bytes of memory to allocate.
+	 *	@param[in]	alignment	Alignment of allocated memory in bytes.
+	 *	@param[in]	node		Zero-based NUMA node number, or -1 for no preference.
+	 *	@return					Address of allocated memory, which must be freed using FreeAligned().  NULL if allocation fails.
+	 */
+	static void* AllocateAlignedOnNode(size_t size, size_t alignment, int node);	//	New in SDK 17.1
+
+	/**
+	 *	Set a preferred NUMA node for a page-aligned range of memory that hasn't been touched yet.
+	 *
+	 *	@param[in]	pMemory		Page-aligned address of the range.
+	 *	@param[in]	size		Bytes in the range (rounded up to whole pages).
+	 *	@param[in]	node		Zero-based NUMA node number.
+	 *	@return					True if the policy was set.  False on failure or on platforms without NUMA support.
+	 */
+	static bool  BindToNUMANode(void* pMemory, size_t size, int node);	//	New in SDK 17.1
+
+	/**
+	 *	Answers with the NUMA node that holds the physical page behind the given address.
+	 *
+	 *	@param[in]	pMemory		Address of memory that has already been touched.
+	 *	@return					Zero-based NUMA node number, or -1 if unknown or unsupported.
+	 */
+	static int   GetNUMANode(const void* pMemory);	//	New in SDK 17.1
+
 	/**
 	 *	Allocate memory aligned to alignment bytes.
 	 *
@@ -155,6 +155,54 @@ AJAThread::SetRealTime(AJAThreadRealTimePolicy policy, int priority)
 	return AJA_STATUS_FAIL;
 }
 
+AJAStatus
+AJAThread::SetCPUAffinity(const AJACPUSet& cpus)
+{
+	if(mpImpl)
+		return mpImpl->SetCPUAffinity(cpus);
+	return AJA_STATUS_FAIL;
+}
+
+AJAStatus
+AJAThread::GetCPUAffinity(AJACPUSet* pCPUs)
+{
+	if(mpImpl)
+		return mpImpl->GetCPUAffinity(pCPUs);
+	return AJA_STATUS_FAIL;
+}
+
+AJAStatus
+AJAThread::SetNUMANode(int node)
+{
+	if(mpImpl)
+		return mpImpl->SetNUMANode(node);
+	return AJA_STATUS_FAIL;
+}
+
+AJAStatus
+AJAThread::GetNUMANode(int* pNode)
+{
+	if(mpImpl)
+		return mpImpl->GetNUMANode(pNode);
+	return AJA_STATUS_FAIL;
+}
+
+AJAStatus
+AJAThread::SetSchedulingProfile(AJAThreadSchedulingProfile profile)
+{
+	if(mpImpl)
+		return mpImpl->SetSchedulingProfile(profile);
+	return AJA_STATUS_FAIL;
+}
+
+AJAStatus
+AJAThread::GetSchedulingProfile(AJAThreadSchedulingProfile* pProfile)
+{
+	if(mpImpl)
+		return mpImpl->GetSchedulingProfile(pProfile);
+	return AJA_STATUS_FAIL;
+}
+
 
 bool 
 AJAThread::Terminate()
@@ -181,3 +229,13 @@ uint64_t AJAThread::GetThreadId()
 {
 	return AJAThreadImpl::GetThreadId();
 }
+
+int AJAThread::GetNUMANodeCount()
+{
+	return AJAThreadImpl::GetNUMANodeCount();
+}
+
+AJAStatus AJAThread::GetNUMANodeCPUs(int node, AJACPUSet& outCPUs)
+{
+	return AJAThreadImpl::GetNUMANodeCPUs(node, outCPUs);
+}
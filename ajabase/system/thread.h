@@ -9,6 +9,7 @@
 #define AJA_THREAD_H
 
 #include "ajabase/common/public.h"
+#include <set>
 
 // forward declarations
 class AJAThread;
@@ -54,6 +55,26 @@ enum AJAThreadRealTimePolicy
 };
 
 
+/**
+ *	Enumerate scheduling profiles that combine a scheduler policy and priority for common thread roles.
+ */
+enum AJAThreadSchedulingProfile
+{
+	AJA_ThreadSchedulingProfile_Default,	/**< Leave the scheduler policy and priority inherited from the creator. */
+	AJA_ThreadSchedulingProfile_Background,	/**< Time-sharing, below normal priority (e.g. file writers, housekeeping). */
+	AJA_ThreadSchedulingProfile_Normal,		/**< Time-sharing, normal priority. */
+	AJA_ThreadSchedulingProfile_Media,		/**< Real-time round-robin, mid priority (e.g. capture/playout transfer threads). */
+	AJA_ThreadSchedulingProfile_Critical	/**< Real-time FIFO, high priority (e.g. interrupt-driven frame pacing). */
+};
+
+
+/**
+ *	A set of zero-based logical CPU numbers.
+ *	@relates AJAThread
+ */
+typedef std::set<uint32_t>	AJACPUSet;
+
+
 /**
  *	System independent class for creating and controlling threads.
  *	@ingroup AJAGroupSystem
@@ -146,6 +167,76 @@ public:
 	 */
 	virtual AJAStatus SetRealTime(AJAThreadRealTimePolicy policy, int priority);
 
+	/**
+	 *	Restrict the thread to a set of CPUs.
+	 *
+	 *	If the thread isn't running, the set is remembered and applied by the new thread before Start() returns.
+	 *	If a NUMA node has also been set, the thread runs on the intersection of the two.
+	 *
+	 *	@param[in]	cpus					Zero-based logical CPU numbers.  An empty set removes the restriction.
+	 *	@return		AJA_STATUS_SUCCESS		Affinity set (or remembered)
+	 *				AJA_STATUS_RANGE		No usable CPU in the set
+	 *				AJA_STATUS_UNSUPPORTED	Not available on this platform
+	 *				AJA_STATUS_FAIL			Affinity not set
+	 */
+	virtual AJAStatus SetCPUAffinity(const AJACPUSet& cpus);	//	New in SDK 17.1
+
+	/**
+	 *	Get the CPUs the thread may run on.
+	 *
+	 *	@param[out]	pCPUs					Receives the CPUs of the running thread, or the remembered set if not running.
+	 *	@return		AJA_STATUS_SUCCESS		Affinity returned
+	 *				AJA_STATUS_NULL			pCPUs is null
+	 *				AJA_STATUS_UNSUPPORTED	Not available on this platform
+	 */
+	virtual AJAStatus GetCPUAffinity(AJACPUSet* pCPUs);	//	New in SDK 17.1
+
+	/**
+	 *	Restrict the thread to the CPUs of a NUMA node.
+	 *
+	 *	Like SetCPUAffinity(), this is applied by the new thread before Start() returns, so memory the thread
+	 *	touches first in ThreadInit() or its attached function lands on the same node.
+	 *
+	 *	@param[in]	node					Zero-based NUMA node number, or -1 to remove the restriction.
+	 *	@return		AJA_STATUS_SUCCESS		Node set (or remembered)
+	 *				AJA_STATUS_RANGE		No such node
+	 *				AJA_STATUS_UNSUPPORTED	Not available on this platform
+	 *				AJA_STATUS_FAIL			Affinity not set
+	 */
+	virtual AJAStatus SetNUMANode(int node);	//	New in SDK 17.1
+
+	/**
+	 *	Get the NUMA node the thread is restricted to.
+	 *
+	 *	@param[out]	pNode					Receives the node number, or -1 if none.
+	 *	@return		AJA_STATUS_SUCCESS		Node returned
+	 *				AJA_STATUS_NULL			pNode is null
+	 */
+	virtual AJAStatus GetNUMANode(int* pNode);	//	New in SDK 17.1
+
+	/**
+	 *	Set the scheduler policy and priority from a profile.
+	 *
+	 *	If the thread isn't running, the profile is remembered and applied by the new thread before Start() returns.
+	 *	Real-time profiles usually need elevated privileges (e.g. CAP_SYS_NICE or an RLIMIT_RTPRIO grant on Linux).
+	 *
+	 *	@param[in]	profile					Scheduling profile.
+	 *	@return		AJA_STATUS_SUCCESS		Profile set (or remembered)
+	 *				AJA_STATUS_RANGE		Unknown profile
+	 *				AJA_STATUS_UNSUPPORTED	Not available on this platform
+	 *				AJA_STATUS_FAIL			Profile not set
+	 */
+	virtual AJAStatus SetSchedulingProfile(AJAThreadSchedulingProfile profile);	//	New in SDK 17.1
+
+	/**
+	 *	Get the scheduling profile.
+	 *
+	 *	@param[out]	pProfile				Receives the last profile set.
+	 *	@return		AJA_STATUS_SUCCESS		Profile returned
+	 *				AJA_STATUS_NULL			pProfile is null
+	 */
+	virtual AJAStatus GetSchedulingProfile(AJAThreadSchedulingProfile* pProfile);	//	New in SDK 17.1
+
 	/**
 	 *	Controlling function for the new thread.
 	 *
@@ -227,6 +318,24 @@ public:
 	 */
 	static uint64_t GetThreadId();
 
+	/**
+	 *	Get the number of NUMA nodes in the system.
+	 *
+	 *	@return The number of nodes, which is 1 on non-NUMA systems and unsupported platforms
+	 */
+	static int GetNUMANodeCount();	//	New in SDK 17.1
+
+	/**
+	 *	Get the CPUs that belong to a NUMA node.
+	 *
+	 *	@param[in]	node					Zero-based NUMA node number.
+	 *	@param[out]	outCPUs					Receives the node's logical CPU numbers.
+	 *	@return		AJA_STATUS_SUCCESS		CPUs returned
+	 *				AJA_STATUS_RANGE		No such node
+	 *				AJA_STATUS_UNSUPPORTED	Not available on this platform
+	 */
+	static AJAStatus GetNUMANodeCPUs(int node, AJACPUSet& outCPUs);	//	New in SDK 17.1
+
 private:
 
 	AJAThreadImpl* mpImpl;
@@ -16,26 +16,39 @@
 #include "limits.h"
 
 #include "ajabase/common/bytestream.h"
+#include "ajabase/common/circularbuffer.h"
 #include "ajabase/common/commandline.h"
 #include "ajabase/common/common.h"
+#include "ajabase/common/dpxsequencereader.h"
 #include "ajabase/common/guid.h"
 #include "ajabase/common/performance.h"
 #include "ajabase/common/timebase.h"
 #include "ajabase/common/timecode.h"
+#include "ajabase/common/timecodeburn.h"
 #include "ajabase/common/timer.h"
+#include "ajabase/common/videoutilities.h"
 #include "ajabase/common/ajamovingavg.h"
 #include "ajabase/persistence/persistence.h"
+#include "ajabase/system/asyncfilewriter.h"
 #include "ajabase/system/atomic.h"
+#include "ajabase/system/debug.h"
+#include "ajabase/system/event.h"
 #include "ajabase/system/file_io.h"
 #include "ajabase/system/info.h"
+#include "ajabase/system/memory.h"
 #include "ajabase/system/systemtime.h"
 #include "ajabase/system/thread.h"
+#if defined(AJA_LINUX)
+#include "ajabase/system/linux/threadimpl.h"
+#endif
 
 #include <algorithm>
 #include <clocale>
 #include <iostream>
 #include <limits>
 #include <string.h>
+#include <thread>
+#include <type_traits>
 
 #ifdef AJA_WINDOWS
 #include <direct.h>
@@ -1192,6 +1205,53 @@ TEST_SUITE("performance" * doctest::description("functions in ajabase/common/per
 		CHECK(p2.MaxTime() == 0);
 		CHECK(p2.Mean() == 0.0);
 		CHECK(p2.StandardDeviation() == 0.0);
+		CHECK(p2.Percentile(99.0) == 0);
+	}
+
+	TEST_CASE("AJALatencyHistogram")
+	{
+		AJALatencyHistogram h;
+		CHECK(h.Entries() == 0);
+		CHECK(h.Percentile(50.0) == 0);
+		CHECK(h.MinValue() == 0);
+
+		//	Small values are exact
+		for (uint64_t v(1);  v <= 50;  v++)
+			h.Record(v);
+		CHECK(h.Entries() == 50);
+		CHECK(h.MinValue() == 1);
+		CHECK(h.MaxValue() == 50);
+		CHECK(h.Percentile(50.0) == 25);
+		CHECK(h.Percentile(100.0) == 50);
+		CHECK(h.Mean() == doctest::Approx(25.5));
+
+		//	Larger values are within ~3%, and the tail is found
+		h.Reset();
+		CHECK(h.Entries() == 0);
+		for (uint64_t v(0);  v < 1000;  v++)
+			h.Record(v < 990 ? 1000 : 50000);	//	1% outliers
+		CHECK(h.Percentile(50.0) >= 970);
+		CHECK(h.Percentile(50.0) <= 1030);
+		CHECK(h.Percentile(98.9) <= 1030);
+		CHECK(h.Percentile(99.5) >= 48500);
+		CHECK(h.Percentile(99.9) <= 50000);
+		CHECK(h.MaxValue() == 50000);
+
+		//	Huge values land in the top bucket, but max stays exact
+		AJALatencyHistogram big;
+		big.Record(uint64_t(1) << 40);
+		CHECK(big.MaxValue() == (uint64_t(1) << 40));
+		CHECK(big.Percentile(50.0) == (uint64_t(1) << 40));
+
+		h.Merge(big);
+		CHECK(h.Entries() == 1001);
+		CHECK(h.MaxValue() == (uint64_t(1) << 40));
+
+		AJAPerformance p("unit_test_pct", AJATimerPrecisionMicroseconds);
+		for (int n(0);  n < 10;  n++)
+			{p.Start();  p.Stop();}
+		CHECK(p.Histogram().Entries() == 10);
+		CHECK(p.Percentile(99.0) <= p.MaxTime());
 	}
 
 } //performance
@@ -1260,8 +1320,199 @@ TEST_SUITE("thread" * doctest::description("functions in ajabase/system/thread.h
 		}
 		tt.Terminate();
 	}
+
+#if defined(AJA_LINUX)
+	class IdleThread : public AJAThread {
+	public:
+		AJAStatus ThreadRun(void) override {
+			while (!Terminate())
+				AJATime::Sleep(10);
+			return AJA_STATUS_SUCCESS;
+		}
+	};
+
+	TEST_CASE("AJAThreadImpl::ParseSysfsList")
+	{
+		AJACPUSet list;
+		CHECK(AJAThreadImpl::ParseSysfsList("0-3,8,10-11", list));
+		const uint32_t expected[] = {0, 1, 2, 3, 8, 10, 11};
+		CHECK(list == AJACPUSet(expected, expected + sizeof(expected) / sizeof(expected[0])));
+		CHECK(AJAThreadImpl::ParseSysfsList("5", list));
+		CHECK(list.size() == 1);
+		CHECK(*list.begin() == 5);
+		CHECK(AJAThreadImpl::ParseSysfsList("0-1\n", list));	//	Trailing newline
+		CHECK(list.size() == 2);
+		CHECK_FALSE(AJAThreadImpl::ParseSysfsList("", list));	//	No CPUs (e.g. a memory-only node)
+		CHECK(list.empty());
+		CHECK_FALSE(AJAThreadImpl::ParseSysfsList("x,-", list));
+		CHECK_FALSE(AJAThreadImpl::ParseSysfsList("7-3", list));	//	Backwards
+		CHECK_FALSE(AJAThreadImpl::ParseSysfsList("0-4294967295", list));	//	Absurdly big
+		CHECK(AJAThreadImpl::ParseSysfsList("2,2,1-2", list));	//	Duplicates
+		CHECK(list.size() == 2);
+	}
+
+	TEST_CASE("AJAThread::CPUAffinity")
+	{
+		//	Find the CPUs this process may use
+		AJACPUSet allowed;
+		{
+			IdleThread probe;
+			REQUIRE(probe.Start() == AJA_STATUS_SUCCESS);
+			CHECK(probe.GetCPUAffinity(&allowed) == AJA_STATUS_SUCCESS);
+			CHECK(probe.Stop(1000) == AJA_STATUS_SUCCESS);
+		}
+		REQUIRE_FALSE(allowed.empty());
+
+		AJACPUSet wanted, actual;
+		wanted.insert(*allowed.rbegin());
+		IdleThread tt;
+		CHECK(tt.SetCPUAffinity(wanted) == AJA_STATUS_SUCCESS);
+		CHECK(tt.GetCPUAffinity(&actual) == AJA_STATUS_SUCCESS);
+		CHECK(actual == wanted);	//	Remembered until Start
+		REQUIRE(tt.Start() == AJA_STATUS_SUCCESS);
+		actual.clear();
+		CHECK(tt.GetCPUAffinity(&actual) == AJA_STATUS_SUCCESS);
+		CHECK(actual == wanted);	//	Applied by the new thread
+		CHECK(tt.SetCPUAffinity(AJACPUSet()) == AJA_STATUS_SUCCESS);
+		CHECK(tt.GetCPUAffinity(&actual) == AJA_STATUS_SUCCESS);
+		CHECK(actual == allowed);	//	Restriction lifted
+		CHECK(tt.Stop(1000) == AJA_STATUS_SUCCESS);
+
+		int node(-2);
+		CHECK(tt.SetNUMANode(AJAThread::GetNUMANodeCount()) == AJA_STATUS_RANGE);
+		CHECK(tt.SetNUMANode(0) == AJA_STATUS_SUCCESS);
+		CHECK(tt.GetNUMANode(&node) == AJA_STATUS_SUCCESS);
+		CHECK(node == 0);
+	}
+
+	TEST_CASE("AJAMemory::AllocateAlignedOnNode")
+	{
+		const size_t size(1024 * 1024);
+		uint8_t * pMemory (reinterpret_cast<uint8_t*>(AJAMemory::AllocateAlignedOnNode(size, 4096, 0)));
+		REQUIRE(pMemory != NULL);
+		CHECK(uintptr_t(pMemory) % 4096 == 0);
+		::memset(pMemory, 0x5A, size);	//	First touch places the pages
+		const int node (AJAMemory::GetNUMANode(pMemory));
+		CHECK((node == 0  ||  node == -1));	//	-1 if the kernel won't say (e.g. get_mempolicy is filtered)
+		if (node >= 0)
+			CHECK(AJAMemory::GetNUMANode(pMemory + size - 1) == 0);
+		AJAMemory::FreeAligned(pMemory);
+		CHECK(AJAMemory::GetNUMANode(NULL) == -1);
+	}
+#endif	//	AJA_LINUX
 }
 
+void event_marker() {}
+TEST_SUITE("event" * doctest::description("functions in ajabase/system/event.h")) {
+
+	TEST_CASE("AJAEvent")
+	{
+		AJAEvent autoEvent(false);
+		bool signaled(true);
+		CHECK(autoEvent.GetState(&signaled) == AJA_STATUS_SUCCESS);
+		CHECK_FALSE(signaled);
+		CHECK(autoEvent.WaitForSignal(0) == AJA_STATUS_TIMEOUT);
+
+		//	Auto reset releases one wait, GetState doesn't consume
+		autoEvent.Signal();
+		autoEvent.Signal();
+		CHECK(autoEvent.GetState(&signaled) == AJA_STATUS_SUCCESS);
+		CHECK(signaled);
+		CHECK(autoEvent.WaitForSignal(0) == AJA_STATUS_SUCCESS);
+		CHECK(autoEvent.WaitForSignal(0) == AJA_STATUS_TIMEOUT);
+
+		//	Manual reset stays signaled until cleared
+		AJAEvent manualEvent(true);
+		manualEvent.SetState(true);
+		CHECK(manualEvent.WaitForSignal(0) == AJA_STATUS_SUCCESS);
+		CHECK(manualEvent.WaitForSignal(10) == AJA_STATUS_SUCCESS);
+		manualEvent.Clear();
+		CHECK(manualEvent.WaitForSignal(10) == AJA_STATUS_TIMEOUT);
+
+		//	Signaled from another thread
+		std::thread signaler([&autoEvent]{AJATime::Sleep(20);  autoEvent.Signal();});
+		CHECK(autoEvent.WaitForSignal(2000) == AJA_STATUS_SUCCESS);
+		signaler.join();
+
+		//	Pulsing a manual reset event releases every thread already waiting on it
+		AJAStatus waitStatus[2] = {AJA_STATUS_FAIL, AJA_STATUS_FAIL};
+		std::thread waiter0([&]{waitStatus[0] = manualEvent.WaitForSignal(5000);});
+		std::thread waiter1([&]{waitStatus[1] = manualEvent.WaitForSignal(5000);});
+		AJATime::Sleep(200);	//	Let both start waiting
+		manualEvent.Signal();
+		manualEvent.Clear();
+		waiter0.join();
+		waiter1.join();
+		CHECK(waitStatus[0] == AJA_STATUS_SUCCESS);
+		CHECK(waitStatus[1] == AJA_STATUS_SUCCESS);
+		CHECK(manualEvent.WaitForSignal(0) == AJA_STATUS_TIMEOUT);
+	}
+
+#if defined(AJA_LINUX)
+	TEST_CASE("AJAWaitForEvents")
+	{
+		AJAEvent events[3];
+		events[0].SetManualReset(false);
+		events[1].SetManualReset(false);
+		CHECK(AJAWaitForEvents(NULL, 3) == AJA_STATUS_INITIALIZE);
+		CHECK(AJAWaitForEvents(events, 0) == AJA_STATUS_RANGE);
+		CHECK(AJAWaitForEvents(events, 3, false, 10) == AJA_STATUS_TIMEOUT);
+
+		//	Any: only the signaled auto reset event is consumed
+		events[1].Signal();
+		CHECK(AJAWaitForEvents(events, 3, false, 0) == AJA_STATUS_SUCCESS);
+		CHECK(AJAWaitForEvents(events, 3, false, 0) == AJA_STATUS_TIMEOUT);
+
+		//	All: nothing is consumed until every event is signaled
+		events[0].Signal();
+		events[2].Signal();
+		CHECK(AJAWaitForEvents(events, 3, true, 10) == AJA_STATUS_TIMEOUT);
+		bool signaled(false);
+		events[0].GetState(&signaled);
+		CHECK(signaled);
+		std::thread signaler([&events]{AJATime::Sleep(20);  events[1].Signal();});
+		CHECK(AJAWaitForEvents(events, 3, true, 2000) == AJA_STATUS_SUCCESS);
+		signaler.join();
+		events[0].GetState(&signaled);
+		CHECK_FALSE(signaled);
+		events[2].GetState(&signaled);
+		CHECK(signaled);	//	manual reset
+	}
+#endif	//	AJA_LINUX
+
+	TEST_CASE("AJAEvent wake-up latency")
+	{
+		//	Ping-pong between two threads, the time from Signal to the waiter running is one wake-up
+		static const int kWakeups(2000);
+		AJAEvent ping(false), pong(false);
+		uint64_t signalTime(0);
+		AJALatencyHistogram wakeups;
+		std::thread waiter([&]{
+			for (int n(0);  n < kWakeups;  n++)
+			{
+				if (ping.WaitForSignal(2000) != AJA_STATUS_SUCCESS)
+					break;
+				wakeups.Record(AJATime::GetSystemNanoseconds() - signalTime);
+				pong.Signal();
+			}
+		});
+		int n(0);
+		for (;  n < kWakeups;  n++)
+		{
+			signalTime = AJATime::GetSystemNanoseconds();
+			ping.Signal();
+			if (pong.WaitForSignal(2000) != AJA_STATUS_SUCCESS)
+				break;
+		}
+		waiter.join();
+		CHECK(n == kWakeups);
+		CHECK(wakeups.Entries() == uint64_t(kWakeups));
+		std::cout << "AJAEvent wake-up latency (ns): ";
+		wakeups.Print(std::cout) << std::endl;
+	}
+
+}	//	event
+
 void bytestream_marker() {}
 TEST_SUITE("bytestream" * doctest::description("functions in ajabase/common/bytestream.h")) {
 	TEST_CASE("Bytestream Constructor, Pos, Seek, Read/Write methods")
@@ -1906,6 +2157,164 @@ TEST_SUITE("atomic" * doctest::description("functions in ajabase/system/atomic.h
 
 } //atomic
 
+void debug_marker() {}
+TEST_SUITE("debug" * doctest::description("functions in ajabase/system/debug.h")) {
+
+	TEST_CASE("AJADebug::FormatDeferred")
+	{
+		AJADebugDeferredRecord record("unit %d %s %u%% %-4s| %08X %.2f %c %5.1f %*d %lld %p");
+		const std::string name("vid");
+		record.AddAll(-7, name, 42u, "ab", uint16_t(0xBEEF), 1.5f, 'z', 2, 3, 12, int64_t(-9000000000LL), (const void*)0x10);
+		CHECK_EQ(AJADebug::FormatDeferred(record.Data(), record.Size()), "unit -7 vid 42% ab  | 0000BEEF 1.50 z   2.0  12 -9000000000 0x10");
+
+		//	arguments that were never packed come out as their conversion specs
+		AJADebugDeferredRecord partial("a=%d b=%d");
+		partial.Add(1);
+		CHECK_EQ(AJADebug::FormatDeferred(partial.Data(), partial.Size()), "a=1 b=%d");
+	}
+
+	TEST_CASE("AJADebug::IsReporting")
+	{
+		int evaluated(0);
+		if (!AJADebug::IsOpen())
+		{
+			CHECK_FALSE(AJADebug::IsReporting(AJA_DebugUnit_Testing));
+			AJA_sDEBUG(AJA_DebugUnit_Testing, "never formatted " << ++evaluated);
+			AJA_dDEBUG(AJA_DebugUnit_Testing, "never packed %d", ++evaluated);
+			CHECK_EQ(evaluated, 0);
+		}
+		if (AJA_FAILURE(AJADebug::Open()))
+			return;	//	no shared memory here
+
+		int32_t refCount(0);
+		uint32_t destination(0);
+		AJADebug::GetClientReferenceCount(refCount);
+		AJADebug::GetDestination(AJA_DebugUnit_Testing, destination);
+		AJADebug::SetClientReferenceCount(refCount + 1);	//	pretend a logger is attached
+
+		AJADebug::SetDestination(AJA_DebugUnit_Testing, AJA_DEBUG_DESTINATION_NONE);
+		CHECK_FALSE(AJADebug::IsReporting(AJA_DebugUnit_Testing));
+		AJA_sDEBUG(AJA_DebugUnit_Testing, "never formatted " << ++evaluated);
+		CHECK_EQ(evaluated, 0);
+
+		AJADebug::SetDestination(AJA_DebugUnit_Testing, AJA_DEBUG_DESTINATION_LOG);
+		CHECK(AJADebug::IsReporting(AJA_DebugUnit_Testing));
+		AJA_dINFO(AJA_DebugUnit_Testing, "frame %u of %s", 12u, std::string("clip"));
+		uint64_t seqNum(0);
+		std::string text;
+		uint32_t msgDest(0);
+		AJADebug::GetSequenceNumber(seqNum);
+		CHECK(AJA_SUCCESS(AJADebug::GetMessageText(seqNum, text)));
+		CHECK_EQ(text, "frame 12 of clip");
+		CHECK(AJA_SUCCESS(AJADebug::GetMessageDestination(seqNum, msgDest)));
+		CHECK_EQ(msgDest, uint32_t(AJA_DEBUG_DESTINATION_LOG));
+
+		AJADebug::SetDestination(AJA_DebugUnit_Testing, destination);
+		AJADebug::SetClientReferenceCount(refCount);
+		AJADebug::Close();
+	}
+
+} //debug
+
+void circularbuffer_marker() {}
+TEST_SUITE("circularbuffer" * doctest::description("functions in ajabase/common/circularbuffer.h")) {
+
+	//	Pushes inNumFrames sequence numbers through inBuffer on a producer and a consumer thread,
+	//	returns the number of frames the consumer saw in order, and the elapsed time in microseconds.
+	static uint32_t RunProducerConsumer (AJACircularBuffer<uint32_t*> & inBuffer, const uint32_t inNumFrames, uint64_t & outMicroseconds)
+	{
+		uint32_t inOrder(0);
+		const uint64_t startTime(AJATime::GetSystemMicroseconds());
+		std::thread producer([&]()
+		{
+			for (uint32_t num(0);  num < inNumFrames;  num++)
+			{
+				uint32_t * pFrame(inBuffer.StartProduceNextBuffer());
+				if (!pFrame)
+					break;
+				*pFrame = num;
+				inBuffer.EndProduceNextBuffer();
+			}
+		});
+		std::thread consumer([&]()
+		{
+			for (uint32_t num(0);  num < inNumFrames;  num++)
+			{
+				uint32_t * pFrame(inBuffer.StartConsumeNextBuffer());
+				if (!pFrame)
+					break;
+				if (*pFrame == num)
+					inOrder++;
+				inBuffer.EndConsumeNextBuffer();
+			}
+		});
+		producer.join();
+		consumer.join();
+		outMicroseconds = AJATime::GetSystemMicroseconds() - startTime;
+		return inOrder;
+	}
+
+	TEST_CASE("AJACircularBuffer SPSC mode")
+	{
+		std::vector<uint32_t> frames(4, 0xFFFFFFFF);
+		AJACircularBuffer<uint32_t*> cb;
+		for (size_t ndx(0);  ndx < frames.size();  ndx++)
+			CHECK(cb.Add(&frames[ndx]) == AJA_STATUS_SUCCESS);
+		CHECK_FALSE(cb.IsSingleProducerSingleConsumer());
+		CHECK(cb.SetSingleProducerSingleConsumer(true) == AJA_STATUS_SUCCESS);
+		CHECK(cb.IsSingleProducerSingleConsumer());
+		CHECK(cb.IsEmpty());
+
+		//	Single-threaded: fill it up, then drain it
+		for (uint32_t num(0);  num < 4;  num++)
+		{
+			uint32_t * pFrame(cb.StartProduceNextBuffer());
+			REQUIRE(pFrame == &frames[num]);
+			*pFrame = num;
+			cb.EndProduceNextBuffer();
+			CHECK(cb.GetCircBufferCount() == num + 1);
+		}
+		CHECK(cb.SetSingleProducerSingleConsumer(false) == AJA_STATUS_FAIL);	//	not while non-empty
+		for (uint32_t num(0);  num < 4;  num++)
+		{
+			uint32_t * pFrame(cb.StartConsumeNextBuffer());
+			REQUIRE(pFrame == &frames[num]);
+			CHECK(*pFrame == num);
+			cb.EndConsumeNextBuffer();
+		}
+		CHECK(cb.IsEmpty());
+
+		//	Abort flag releases a consumer waiting on an empty buffer
+		bool abort(true);
+		cb.SetAbortFlag(&abort);
+		CHECK(cb.StartConsumeNextBuffer() == NULL);
+
+		//	Two threads, many laps around the ring
+		cb.SetAbortFlag(NULL);
+		uint64_t usecs(0);
+		CHECK(RunProducerConsumer(cb, 100000, usecs) == 100000);
+		CHECK(cb.IsEmpty());
+	}
+
+	TEST_CASE("AJACircularBuffer locked vs. SPSC benchmark")
+	{
+		const uint32_t numFrames(200000);
+		std::vector<uint32_t> frames(8, 0);
+		for (int spsc(0);  spsc < 2;  spsc++)
+		{
+			AJACircularBuffer<uint32_t*> cb;
+			for (size_t ndx(0);  ndx < frames.size();  ndx++)
+				cb.Add(&frames[ndx]);
+			CHECK(cb.SetSingleProducerSingleConsumer(spsc ? true : false) == AJA_STATUS_SUCCESS);
+			uint64_t usecs(0);
+			CHECK(RunProducerConsumer(cb, numFrames, usecs) == numFrames);
+			std::cout << "AJACircularBuffer " << (spsc ? "SPSC  " : "locked") << ": " << numFrames << " frames in "
+					<< usecs << " us (" << (usecs ? uint64_t(numFrames) * 1000000 / usecs : 0) << " frames/sec)" << std::endl;
+		}
+	}
+
+} //circularbuffer
+
 void info_marker() {}
 TEST_SUITE("info" * doctest::description("functions in ajabase/system/info.h")) {
 
@@ -2193,3 +2602,397 @@ TEST_SUITE("file" * doctest::description("functions in ajabase/system/file_io.h"
 	}
 
 } //file
+
+
+TEST_SUITE("asyncfilewriter" * doctest::description("functions in ajabase/system/asyncfilewriter.h")) {
+
+	//	Answers with a unique path in the temp directory
+	static std::string AsyncTempPath (void)
+	{
+		std::string tempPath;
+		REQUIRE(AJAFileIO::TempDirectory(tempPath) == AJA_STATUS_SUCCESS);
+		aja::rstrip(tempPath, std::string(1, AJA_PATHSEP));
+		return tempPath + std::string(1, AJA_PATHSEP) + "AJAAsyncFileWriter_unittest_"
+				+ aja::to_string((unsigned long)AJATime::GetSystemMilliseconds()) + ".raw";
+	}
+
+	//	Writes numFrames aligned frames plus one odd-sized tail, then reads the file back
+	static void TestAsyncWrites (const AJAAsyncWriteBackend inBackend, const int inProperties)
+	{
+		const std::string tempPath (AsyncTempPath());
+
+		const uint32_t	numFrames (16),  queueDepth (4),  frameBytes (1024*1024),  tailBytes (1000);
+		std::vector<uint8_t*>	frames;
+		for (uint32_t num(0);  num < queueDepth;  num++)
+			frames.push_back(reinterpret_cast<uint8_t*>(AJAMemory::AllocateAligned(frameBytes, AJAAsyncFileWriter::GetAlignment())));
+
+		AJAAsyncFileWriter	writer;
+		REQUIRE(writer.Open(tempPath, queueDepth, inProperties, inBackend) == AJA_STATUS_SUCCESS);
+		CHECK(writer.IsOpen());
+		CHECK(writer.GetBackend() != eAJAAsyncWriteAuto);
+		if (inBackend != eAJAAsyncWriteAuto)
+			CHECK_EQ(writer.GetBackend(), inBackend);
+
+		//	Keep the queue full, re-using each buffer as its write completes
+		uint32_t numCompleted(0);
+		for (uint32_t frame(0);  frame < numFrames;  frame++)
+		{
+			uint8_t * pFrame (frames.at(frame % queueDepth));
+			if (frame >= queueDepth)
+			{
+				AJAAsyncWriteResult result;
+				REQUIRE(writer.WaitForCompletion(result, 5000) == AJA_STATUS_SUCCESS);
+				CHECK_EQ(result.status, AJA_STATUS_SUCCESS);
+				CHECK_EQ(result.written, frameBytes);
+				CHECK_EQ(result.offset, uint64_t(result.userTag) * frameBytes);
+				pFrame = const_cast<uint8_t*>(reinterpret_cast<const uint8_t*>(result.pBuffer));
+				numCompleted++;
+			}
+			::memset(pFrame, int(frame & 0xFF), frameBytes);
+			CHECK(writer.Write(pFrame, frameBytes, frame) == AJA_STATUS_SUCCESS);
+		}
+		CHECK(writer.GetNumInFlight() <= queueDepth);
+
+		//	Queue full?
+		uint8_t tail[tailBytes];
+		::memset(tail, 0xEE, tailBytes);
+		AJAStatus status (writer.Write(tail, tailBytes, numFrames));
+		while (status == AJA_STATUS_BUSY)
+		{
+			AJAAsyncWriteResult result;
+			if (writer.WaitForCompletion(result, 5000) == AJA_STATUS_SUCCESS)
+				numCompleted++;
+			status = writer.Write(tail, tailBytes, numFrames);
+		}
+		CHECK(status == AJA_STATUS_SUCCESS);
+		CHECK(writer.Flush() == AJA_STATUS_SUCCESS);
+		CHECK_EQ(writer.GetNumInFlight(), 0);
+		AJAAsyncWriteResult result;
+		while (writer.GetCompletion(result))
+			{CHECK_EQ(result.status, AJA_STATUS_SUCCESS);  numCompleted++;}
+		CHECK_EQ(numCompleted, numFrames + 1);
+
+		const AJAAsyncWriteStats stats (writer.GetStats());
+		CHECK_EQ(stats.writesQueued, numFrames + 1);
+		CHECK_EQ(stats.writesCompleted, numFrames + 1);
+		CHECK_EQ(stats.writesFailed, 0);
+		CHECK(stats.writesBuffered >= 1);	//	The tail, at least
+		CHECK_EQ(stats.bytesWritten, uint64_t(numFrames) * frameBytes + tailBytes);
+		CHECK(stats.latencyMinUs <= stats.latencyMaxUs);
+		CHECK(stats.maxInFlight <= queueDepth);
+		CHECK(writer.Close() == AJA_STATUS_SUCCESS);
+		CHECK_FALSE(writer.IsOpen());
+		CHECK(writer.Write(tail, tailBytes) == AJA_STATUS_OPEN);
+
+		AJAFileIO file;
+		REQUIRE(file.Open(tempPath, eAJAReadOnly, 0) == AJA_STATUS_SUCCESS);
+		int64_t createTime(0), modTime(0), size(0);
+		CHECK(file.FileInfo(createTime, modTime, size) == AJA_STATUS_SUCCESS);
+		CHECK_EQ(size, int64_t(numFrames) * frameBytes + tailBytes);
+		std::vector<uint8_t> readBack(frameBytes);
+		for (uint32_t frame(0);  frame < numFrames;  frame++)
+		{
+			REQUIRE(file.Read(&readBack[0], frameBytes) == frameBytes);
+			CHECK(std::count(readBack.begin(), readBack.end(), uint8_t(frame & 0xFF)) == frameBytes);
+		}
+		CHECK(file.Read(&readBack[0], tailBytes) == tailBytes);
+		CHECK(::memcmp(&readBack[0], tail, tailBytes) == 0);
+		file.Close();
+		AJAFileIO::Delete(tempPath);
+		for (size_t ndx(0);  ndx < frames.size();  ndx++)
+			AJAMemory::FreeAligned(frames[ndx]);
+	}
+
+	TEST_CASE("AJAAsyncFileWriter")
+	{
+		AJAAsyncFileWriter writer;
+		CHECK_FALSE(writer.IsOpen());
+		CHECK(writer.Write("x", 1) == AJA_STATUS_OPEN);
+		CHECK(writer.Open("", 4) == AJA_STATUS_BAD_PARAM);
+		CHECK_EQ(writer.GetBackend(), eAJAAsyncWriteAuto);
+		CHECK(writer.Close() == AJA_STATUS_SUCCESS);
+
+		SUBCASE("thread pool, direct")		{TestAsyncWrites(eAJAAsyncWriteThreadPool, eAJANoCaching);}
+		SUBCASE("thread pool, buffered")	{TestAsyncWrites(eAJAAsyncWriteThreadPool, eAJABuffered);}
+		SUBCASE("auto")						{TestAsyncWrites(eAJAAsyncWriteAuto, eAJANoCaching);}
+		SUBCASE("io_uring")
+		{
+			if (AJAAsyncFileWriter::IsIOUringAvailable())
+				TestAsyncWrites(eAJAAsyncWriteIOUring, eAJANoCaching);
+			else
+			{
+				const std::string tempPath (AsyncTempPath());
+				CHECK(writer.Open(tempPath, 4, eAJANoCaching, eAJAAsyncWriteIOUring) == AJA_STATUS_FEATURE);
+				AJAFileIO::Delete(tempPath);	//	Open may have created it before finding no io_uring
+			}
+		}
+	}
+
+} //asyncfilewriter
+
+
+TEST_SUITE("dpx" * doctest::description("functions in ajabase/common/dpxsequencereader.h")) {
+
+	static const uint32_t kDPXWidth(192), kDPXHeight(8), kDPXFrames(6);
+
+	//	Answers the 10-bit component at the given position in the frame's Cb Y Cr Y... stream
+	static uint32_t DPXComponent (const uint32_t inFrame, const size_t inNdx)
+	{
+		return uint32_t(inFrame * 97 + inNdx * 5 + (inNdx >> 7)) & 0x3FF;
+	}
+
+	//	Fills a big-endian 10-bit 4:2:2 DPX payload (3 components per word, first in bits 31-22)
+	static void MakeDPXPayload (const uint32_t inFrame, std::vector<uint32_t> & outPayload)
+	{
+		outPayload.resize(kDPXWidth * kDPXHeight * 8 / 3 / 4);
+		for (size_t ndx(0);  ndx < outPayload.size();  ndx++)
+			outPayload[ndx] = AJA_ENDIAN_SWAP32((DPXComponent(inFrame, ndx * 3) << 22)  |  (DPXComponent(inFrame, ndx * 3 + 1) << 12)
+									|  (DPXComponent(inFrame, ndx * 3 + 2) << 2));
+	}
+
+	TEST_CASE("AJADPXSequenceReader")
+	{
+		std::string dir;
+		REQUIRE(AJAFileIO::TempDirectory(dir) == AJA_STATUS_SUCCESS);
+		aja::rstrip(dir, std::string(1, AJA_PATHSEP));
+		dir += std::string(1, AJA_PATHSEP) + "AJADPXSequenceReader_unittest_" + aja::to_string((unsigned long)AJATime::GetSystemMilliseconds());
+#if defined(AJA_WINDOWS)
+		_mkdir(dir.c_str());
+#else
+		mkdir(dir.c_str(), ACCESSPERMS);
+#endif
+		REQUIRE(AJAFileIO::DoesDirectoryExist(dir) == AJA_STATUS_SUCCESS);
+
+		//	Write a short sequence
+		std::vector<std::string> files;
+		for (uint32_t frame(0);  frame < kDPXFrames;  frame++)
+		{
+			DpxHdr hdr;
+			hdr.set_ii_pixels(kDPXWidth);
+			hdr.set_ii_lines(kDPXHeight);
+			hdr.set_ie_descriptor(DPX_C_IMAGE_ELEM_DESC_422);
+			hdr.set_ie_bit_size(10);
+			hdr.set_fi_image_offset(hdr.GetHdrSize());
+			std::vector<uint32_t> payload;
+			MakeDPXPayload(frame, payload);
+			REQUIRE_EQ(hdr.get_ii_image_size(), payload.size() * 4);
+
+			char name[16];
+			ajasnprintf(name, sizeof(name), "%.8u.dpx", frame);
+			files.push_back(dir + std::string(1, AJA_PATHSEP) + name);
+			AJAFileIO file;
+			REQUIRE(file.Open(files.back(), eAJAWriteOnly | eAJACreateAlways, 0) == AJA_STATUS_SUCCESS);
+			CHECK(file.Write((const uint8_t*)&hdr.GetHdr(), uint32_t(hdr.GetHdrSize())) == hdr.GetHdrSize());
+			CHECK(file.Write((const uint8_t*)&payload[0], uint32_t(payload.size() * 4)) == payload.size() * 4);
+			file.Close();
+		}
+
+		AJADPXSequenceReader reader;
+		const uint8_t * pPayload(NULL);
+		uint32_t size(0), index(0);
+		CHECK(reader.ReadNext(pPayload, size, index) == AJA_STATUS_INITIALIZE);
+		CHECK(reader.Start() == AJA_STATUS_INITIALIZE);		//	No path
+		REQUIRE(reader.SetPath(dir) == AJA_STATUS_SUCCESS);
+		REQUIRE_EQ(reader.GetFileCount(), kDPXFrames);
+		CHECK_FALSE(std::is_base_of<AJADPXFileIO, AJADPXSequenceReader>::value);	//	Only its own SetIndex can seek it
+
+		SUBCASE("sequential, no loop")
+		{
+			reader.SetLoopMode(false);
+			REQUIRE(reader.Start(3, 2) == AJA_STATUS_SUCCESS);
+			CHECK(reader.IsRunning());
+			std::vector<uint32_t> expected;
+			for (uint32_t frame(0);  frame < kDPXFrames;  frame++)
+			{
+				REQUIRE(reader.ReadNext(pPayload, size, index, 5000) == AJA_STATUS_SUCCESS);
+				CHECK_EQ(index, frame);
+				MakeDPXPayload(frame, expected);
+				CHECK_EQ(size, expected.size() * 4);
+				CHECK(::memcmp(pPayload, &expected[0], size) == 0);
+				CHECK_EQ(uintptr_t(pPayload) % 4096, 0);
+				CHECK_EQ(reader.get_ii_pixels(), kDPXWidth);
+			}
+			CHECK(reader.ReadNext(pPayload, size, index, 5000) == AJA_STATUS_RANGE);
+
+			//	Seek back
+			CHECK(reader.SetIndex(2) == AJA_STATUS_SUCCESS);
+			REQUIRE(reader.ReadNext(pPayload, size, index, 5000) == AJA_STATUS_SUCCESS);
+			CHECK_EQ(index, 2);
+			CHECK_EQ(reader.GetIndex(), 3);
+			CHECK(reader.SetPath(dir) == AJA_STATUS_FAIL);		//	Running
+			std::vector<uint32_t> copy(expected.size());
+			REQUIRE(reader.ReadNext(*(uint8_t*)&copy[0], uint32_t(copy.size() * 4), index, 5000) == AJA_STATUS_SUCCESS);
+			CHECK_EQ(index, 3);
+			MakeDPXPayload(3, expected);
+			CHECK(copy == expected);
+			CHECK(reader.ReadNext(*(uint8_t*)&copy[0], 16, index, 5000) == AJA_STATUS_BADBUFFERSIZE);
+			reader.Stop();
+			CHECK_FALSE(reader.IsRunning());
+		}
+
+		SUBCASE("loop & pause")
+		{
+			reader.SetLoopMode(true);
+			REQUIRE(reader.SetIndex(kDPXFrames - 2) == AJA_STATUS_SUCCESS);
+			REQUIRE(reader.Start(4, 3) == AJA_STATUS_SUCCESS);
+			const uint32_t expectedIndexes[] = {kDPXFrames - 2, kDPXFrames - 1, 0, 1};
+			for (size_t ndx(0);  ndx < sizeof(expectedIndexes) / sizeof(expectedIndexes[0]);  ndx++)
+			{
+				REQUIRE(reader.ReadNext(pPayload, size, index, 5000) == AJA_STATUS_SUCCESS);
+				CHECK_EQ(index, expectedIndexes[ndx]);
+			}
+			reader.SetPauseMode(true);
+			for (int num(0);  num < 3;  num++)
+			{
+				REQUIRE(reader.ReadNext(pPayload, size, index, 5000) == AJA_STATUS_SUCCESS);
+				CHECK_EQ(index, 1);
+			}
+			reader.SetPauseMode(false);
+			REQUIRE(reader.ReadNext(pPayload, size, index, 5000) == AJA_STATUS_SUCCESS);
+			CHECK_EQ(index, 2);
+		}
+
+		SUBCASE("repack")
+		{
+			REQUIRE(reader.Start(2, 1, true) == AJA_STATUS_SUCCESS);
+			REQUIRE(reader.ReadNext(pPayload, size, index, 5000) == AJA_STATUS_SUCCESS);
+			//	v210:  3 components per little-endian word, first in bits 9-0
+			std::vector<uint32_t> expected(kDPXWidth * kDPXHeight * 8 / 3 / 4);
+			for (size_t ndx(0);  ndx < expected.size();  ndx++)
+				expected[ndx] = DPXComponent(index, ndx * 3)  |  (DPXComponent(index, ndx * 3 + 1) << 10)
+								|  (DPXComponent(index, ndx * 3 + 2) << 20);
+			REQUIRE_EQ(size, expected.size() * 4);
+			CHECK(::memcmp(pPayload, &expected[0], size) == 0);
+			const uint32_t * pWords (reinterpret_cast<const uint32_t*>(pPayload));
+			CHECK_EQ(pWords[0] & 0x3FF, DPXComponent(index, 0));	//	Cb0
+			CHECK_EQ((pWords[0] >> 10) & 0x3FF, DPXComponent(index, 1));	//	Y0
+			CHECK_EQ((pWords[1] >> 20) & 0x3FF, DPXComponent(index, 5));	//	Y2
+			CHECK_EQ(pWords[0] >> 30, 0);
+		}
+
+		reader.Stop();
+		for (size_t ndx(0);  ndx < files.size();  ndx++)
+			AJAFileIO::Delete(files[ndx]);
+#if defined(AJA_WINDOWS)
+		_rmdir(dir.c_str());
+#else
+		rmdir(dir.c_str());
+#endif
+	}
+
+} //dpx
+
+TEST_SUITE("timecodeburn" * doctest::description("functions in ajabase/common/timecodeburn.h")) {
+
+	static const uint32_t kTCWidth(1920), kTCHeight(1080), kTCLine(900);	//	kTCLine is inside the burn-in at 80%
+
+	TEST_CASE("AJATimeCodeBurn formats")
+	{
+		const AJA_PixelFormat formats[] = {AJA_PixelFormat_YCbCr8, AJA_PixelFormat_YUY28, AJA_PixelFormat_ARGB8, AJA_PixelFormat_RGBA8,
+											AJA_PixelFormat_ABGR8, AJA_PixelFormat_RGB8_PACK, AJA_PixelFormat_BGR8_PACK, AJA_PixelFormat_YCbCr10,
+											AJA_PixelFormat_RGB10, AJA_PixelFormat_RGB_DPX, AJA_PixelFormat_RGB_DPX_LE, AJA_PixelFormat_RGB12,
+											AJA_PixelFormat_RGB16, AJA_PixelFormat_YCBCR8_420PL, AJA_PixelFormat_YCBCR8_422PL,
+											AJA_PixelFormat_YCBCR8_420PL3, AJA_PixelFormat_YCBCR8_422PL3, AJA_PixelFormat_YCBCR10_420PL,
+											AJA_PixelFormat_YCBCR10_422PL, AJA_PixelFormat_YCBCR10_420PL3LE, AJA_PixelFormat_YCBCR10_422PL3LE};
+		for (size_t ndx(0);  ndx < sizeof(formats) / sizeof(formats[0]);  ndx++)
+		{
+			const size_t rowBytes (AJA_CalcRowBytesForFormat(formats[ndx], kTCWidth));
+			std::vector<uint8_t> burnedTwice (rowBytes * kTCHeight * 2, 0xA5), burnedOnce (burnedTwice);
+
+			//	Only the characters that changed get redrawn -- the result must be the same
+			AJATimeCodeBurn burner, fresh;
+			REQUIRE(burner.RenderTimeCodeFont(formats[ndx], kTCWidth, kTCHeight));
+			REQUIRE(fresh.RenderTimeCodeFont(formats[ndx], kTCWidth, kTCHeight));
+			CHECK(burner.BurnTimeCode(&burnedTwice[0], "00:00:00:00", 80));
+			CHECK(burner.BurnTimeCode(&burnedTwice[0], "12:34:56;78", 80));
+			CHECK(fresh.BurnTimeCode(&burnedOnce[0], "12:34:56;78", 80));
+			CHECK(burnedTwice == burnedOnce);
+			CHECK(burnedOnce[0] == 0xA5);
+			CHECK(burnedOnce[kTCLine * rowBytes] == 0xA5);		//	left of the burn-in
+		}
+
+		AJATimeCodeBurn burner;
+		CHECK_FALSE(burner.RenderTimeCodeFont(AJA_PixelFormat_DVCPRO, kTCWidth, kTCHeight));
+		CHECK_FALSE(burner.RenderTimeCodeFont(AJA_PixelFormat_YCbCr8, 64, 32));		//	Too small
+		std::vector<uint8_t> buffer (kTCWidth * 2 * kTCHeight);
+		CHECK_FALSE(burner.BurnTimeCode(&buffer[0], "00:00:00:00", 80));		//	Not rendered
+		REQUIRE(burner.RenderTimeCodeFont(AJA_PixelFormat_YCbCr8, kTCWidth, kTCHeight));
+		CHECK_FALSE(burner.BurnTimeCode(&buffer[0], "00:00:00:00:00:00", 80));	//	Too long
+		CHECK(burner.BurnTimeCode(&buffer[0], "00:00:00:00", 100));			//	Kept inside the raster
+	}
+
+	TEST_CASE("AJATimeCodeBurn box opacity")
+	{
+		AJATimeCodeBurn burner;
+		CHECK_EQ(burner.GetBoxOpacity(), 100);
+		CHECK_FALSE(burner.SetBoxOpacity(101));
+		CHECK(burner.SetBoxOpacity(50));
+		CHECK_EQ(burner.GetBoxOpacity(), 50);
+		const std::string spaces ("           ");
+
+		SUBCASE("8-bit YCbCr")
+		{
+			const size_t rowBytes (kTCWidth * 2);
+			std::vector<uint8_t> buffer (rowBytes * kTCHeight);
+			for (size_t ndx(0);  ndx < buffer.size();  ndx += 2)
+				{buffer[ndx] = 0x80;  buffer[ndx + 1] = 0xEB;}		//	White
+			REQUIRE(burner.RenderTimeCodeFont(AJA_PixelFormat_YCbCr8, kTCWidth, kTCHeight));
+			CHECK(burner.BurnTimeCode(&buffer[0], spaces, 80));
+			const uint8_t * pCenter (&buffer[kTCLine * rowBytes + kTCWidth]);
+			CHECK_EQ(pCenter[0], 0x80);
+			CHECK_EQ(pCenter[1], (0xEB + 0x10 + 1) / 2);		//	Halfway to black
+
+			//	No box:  only the strokes change
+			const std::vector<uint8_t> before (buffer);
+			CHECK(burner.SetBoxOpacity(0));
+			CHECK(burner.BurnTimeCode(&buffer[0], spaces, 80));
+			CHECK(buffer == before);
+			CHECK(burner.BurnTimeCode(&buffer[0], "88:88:88:88", 80));
+			CHECK(buffer != before);
+			CHECK_EQ(buffer[kTCLine * rowBytes + 1], before[kTCLine * rowBytes + 1]);
+		}
+
+		SUBCASE("ARGB keeps alpha")
+		{
+			const size_t rowBytes (kTCWidth * 4);
+			std::vector<uint8_t> buffer (rowBytes * kTCHeight, 200);
+			REQUIRE(burner.RenderTimeCodeFont(AJA_PixelFormat_ARGB8, kTCWidth, kTCHeight));
+			CHECK(burner.BurnTimeCode(&buffer[0], spaces, 80));
+			const uint8_t * pCenter (&buffer[kTCLine * rowBytes + kTCWidth * 2]);
+			CHECK_EQ(pCenter[0], 100);
+			CHECK_EQ(pCenter[1], 100);
+			CHECK_EQ(pCenter[2], 100);
+			CHECK_EQ(pCenter[3], 200);
+		}
+
+		SUBCASE("v210")
+		{
+			const size_t rowBytes (AJA_CalcRowBytesForFormat(AJA_PixelFormat_YCbCr10, kTCWidth));
+			std::vector<uint32_t> buffer (rowBytes * kTCHeight / 4);
+			const uint32_t kY(940), kC(512);
+			for (size_t ndx(0);  ndx < buffer.size();  ndx++)
+				buffer[ndx] = (ndx & 1) ? (kY | (kC << 10) | (kY << 20)) : (kC | (kY << 10) | (kC << 20));
+			REQUIRE(burner.RenderTimeCodeFont(AJA_PixelFormat_YCbCr10, kTCWidth, kTCHeight));
+			CHECK(burner.BurnTimeCode(&buffer[0], spaces, 80));
+			const uint32_t word (buffer[(kTCLine * rowBytes + rowBytes / 2) / 4 & ~size_t(1)]);
+			CHECK_EQ(word & 0x3FF, kC);
+			CHECK_EQ((word >> 10) & 0x3FF, (kY + 64) / 2);
+			CHECK_EQ((word >> 20) & 0x3FF, kC);
+		}
+
+		SUBCASE("planar chroma")
+		{
+			//	Opaque box over 4:2:0:  the chroma planes go neutral too
+			CHECK(burner.SetBoxOpacity(100));
+			std::vector<uint8_t> buffer (kTCWidth * kTCHeight * 3 / 2, 0x10);
+			REQUIRE(burner.RenderTimeCodeFont(AJA_PixelFormat_YCBCR8_420PL3, kTCWidth, kTCHeight));
+			CHECK(burner.BurnTimeCode(&buffer[0], spaces, 80));
+			const size_t cbPlane (kTCWidth * kTCHeight), crPlane (cbPlane + kTCWidth * kTCHeight / 4);
+			CHECK_EQ(buffer[kTCLine * kTCWidth + kTCWidth / 2], 0x10);		//	Black luma
+			CHECK_EQ(buffer[cbPlane + kTCLine / 2 * kTCWidth / 2 + kTCWidth / 4], 0x80);
+			CHECK_EQ(buffer[crPlane + kTCLine / 2 * kTCWidth / 2 + kTCWidth / 4], 0x80);
+			CHECK_EQ(buffer[crPlane + kTCLine / 2 * kTCWidth / 2], 0x10);		//	Left of the burn-in
+		}
+	}
+
+} //timecodeburn
@@ -0,0 +1,136 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		ajantv2/includes/ntv2bufferpool.h
+	@brief		Declares the NTV2BufferPool class.
+	@copyright	(C) 2023 AJA Video Systems, Inc.
+**/
+
+#ifndef NTV2_BUFFERPOOL_H
+#define NTV2_BUFFERPOOL_H
+
+#include "ajaexport.h"
+#include "ntv2publicinterface.h"
+
+class CNTV2Card;
+struct NTV2BufferPoolFreeList;
+
+/**
+	@brief	Kinds of memory pages that can back an NTV2BufferPool, from smallest to largest.
+**/
+typedef enum
+{
+	NTV2_POOLPAGES_SMALL,			///< @brief	Ordinary pages (usually 4KB)
+	NTV2_POOLPAGES_TRANSPARENT,		///< @brief	Ordinary pages, 2MB-aligned and advised for transparent huge pages
+	NTV2_POOLPAGES_2MB,				///< @brief	Reserved 2MB huge pages (hugetlbfs)
+	NTV2_POOLPAGES_1GB,				///< @brief	Reserved 1GB huge pages (hugetlbfs)
+	NTV2_POOLPAGES_INVALID
+} NTV2PoolPageKind;
+
+#define NTV2_IS_VALID_POOLPAGES(__k__)	((__k__) >= NTV2_POOLPAGES_SMALL  &&  (__k__) < NTV2_POOLPAGES_INVALID)
+
+/**
+	@brief	A fixed set of equally-sized host buffers carved out of one huge-page-backed region. The buffers
+			are page-locked (and optionally segment-mapped) with CNTV2Card::DMABufferLock once, up front, then
+			handed out and taken back without locks or allocation, so per-frame DMAs skip the driver's
+			page-pinning and mapping work. Huge pages also let the driver coalesce each buffer into far fewer
+			scatter-gather segments.
+	@note	Acquire and Release may be called concurrently from any number of threads. Allocate, Lock, Unlock
+			and Deallocate must not race with them.
+**/
+class AJAExport NTV2BufferPool
+{
+	//	CLASS METHODS
+	public:
+		/**
+			@return		The size, in bytes, of the given kind of page, or zero if invalid.
+			@param[in]	inPageKind		Specifies the page kind.
+		**/
+		static ULWord	GetPageSize (const NTV2PoolPageKind inPageKind);
+
+		/**
+			@return		A string containing a human-readable description of the given page kind.
+			@param[in]	inPageKind		Specifies the page kind.
+		**/
+		static std::string	PageKindToString (const NTV2PoolPageKind inPageKind);
+
+	//	INSTANCE METHODS
+	public:
+						NTV2BufferPool ();
+		virtual			~NTV2BufferPool ();	///< @brief	Unlocks and frees my buffers.
+
+		/**
+			@brief		Allocates my buffers from one region, using the largest page kind that the host can supply.
+						Reserved 1GB pages are only tried if the region is at least 1GB, and reserved 2MB pages need
+						hugetlbfs pages to have been set aside (e.g. via /proc/sys/vm/nr_hugepages). Otherwise this
+						falls back to transparent huge pages, then to ordinary pages. The buffers are zeroed.
+			@param[in]	inNumBuffers		Specifies the number of buffers. Must be non-zero.
+			@param[in]	inBufferByteCount	Specifies the size of each buffer, in bytes. Each buffer starts on a page boundary.
+			@param[in]	inLargestPageKind	Optionally specifies the largest page kind to try. Defaults to NTV2_POOLPAGES_1GB.
+			@param[in]	inNUMANode			Optionally specifies the NUMA node to take pages from, typically from
+											CNTV2DriverInterface::GetNUMANode. Defaults to -1 (no preference).
+			@return		True if successful;  otherwise false.
+			@note		Any buffers I had before are unlocked and freed first. Outstanding buffers become invalid.
+		**/
+		virtual bool	Allocate (const ULWord inNumBuffers, const ULWord inBufferByteCount,
+								const NTV2PoolPageKind inLargestPageKind = NTV2_POOLPAGES_1GB,
+								const int inNUMANode = -1);
+
+		/**
+			@brief		Page-locks all of my buffers for DMA with the given device, and keeps them locked until I'm
+						unlocked, deallocated or destroyed.
+			@param[in]	inDevice		Specifies the open device my buffers will be transferred to or from.
+			@param[in]	inMap			Optionally also locks the scatter-gather segment maps. Defaults to true.
+			@return		True if every buffer was locked;  otherwise false (and none are left locked).
+			@note		The device must outlive the lock, or at least my call to Unlock.
+		**/
+		virtual bool	Lock (CNTV2Card & inDevice, const bool inMap = true);
+
+		virtual void	Unlock (void);		///< @brief	Unlocks my buffers, if they're locked.
+		virtual void	Deallocate (void);	///< @brief	Unlocks and frees my buffers.
+
+		/**
+			@brief		Hands out one of my free buffers, without blocking.
+			@param[out]	outBuffer		Receives a non-owning reference to the buffer.
+			@return		True if successful;  false if all buffers are in use (or I have none).
+		**/
+		virtual bool	Acquire (NTV2Buffer & outBuffer);
+
+		/**
+			@brief		Takes back a buffer that was handed out by Acquire.
+			@param[in]	inBuffer		Specifies the buffer. Only its address is used.
+			@return		True if successful;  false if the buffer isn't mine or is already free.
+		**/
+		virtual bool	Release (const NTV2Buffer & inBuffer);
+
+		/**
+			@brief		Answers with one of my buffers, whether it's free or not. Use this to assign buffers to
+						clients statically, instead of using Acquire and Release.
+			@param[in]	inIndex			Specifies the zero-based buffer index.
+			@param[out]	outBuffer		Receives a non-owning reference to the buffer.
+			@return		True if successful;  false if the index is out of range.
+		**/
+		virtual bool	GetBuffer (const ULWord inIndex, NTV2Buffer & outBuffer) const;
+
+		virtual ULWord	GetNumAvailable (void) const;	///< @return	The number of buffers that are currently free.
+		inline ULWord	GetNumBuffers (void) const		{return mNumBuffers;}	///< @return	My total number of buffers.
+		inline ULWord	GetBufferByteCount (void) const	{return mBufferByteCount;}	///< @return	The size of each buffer, in bytes.
+		inline NTV2PoolPageKind	GetPageKind (void) const	{return mPageKind;}	///< @return	The kind of pages backing my buffers.
+		inline bool		IsAllocated (void) const		{return mpRegion != AJA_NULL;}	///< @return	True if I have buffers.
+		inline bool		IsLocked (void) const			{return mpLockDevice != AJA_NULL;}	///< @return	True if my buffers are page-locked.
+
+	private:
+		NTV2BufferPool (const NTV2BufferPool & inObj);				//	No copying
+		NTV2BufferPool & operator = (const NTV2BufferPool & inRHS);	//	No copying
+
+		UByte *					mpRegion;			///< @brief	Start of the region holding all my buffers
+		ULWord64				mRegionByteCount;	///< @brief	Size of the region, in bytes
+		ULWord					mNumBuffers;		///< @brief	Number of buffers
+		ULWord					mBufferByteCount;	///< @brief	Size of each buffer, in bytes
+		ULWord					mSlotByteCount;		///< @brief	Distance between buffer starts, in bytes
+		NTV2PoolPageKind		mPageKind;			///< @brief	Kind of pages backing the region
+		bool					mMapped;			///< @brief	True if the region came from mmap (else AJAMemory::AllocateAligned)
+		CNTV2Card *				mpLockDevice;		///< @brief	Device my buffers are locked with, if any
+		NTV2BufferPoolFreeList *	mpFreeList;		///< @brief	Which buffers are free
+};	//	NTV2BufferPool
+
+#endif	//	NTV2_BUFFERPOOL_H
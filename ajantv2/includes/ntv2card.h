@@ -19,6 +19,7 @@
 #endif
 #include "ntv2signalrouter.h"
 #include "ntv2utils.h"
+#include "ajabase/common/performance.h"
 #include <set>
 #include <string>
 #include <iostream>
@@ -217,38 +218,29 @@ class AJAExport DeviceCapabilities
 		inline UWord	GetNumBufferedAudioSystems (void)		{return UWord(dev.GetNumSupported(kDeviceGetNumBufferedAudioSystems));}
 		inline ULWord	GetUFCVersion (void)					{return dev.GetNumSupported(kDeviceGetUFCVersion);}
 		bool			CanDoChannel (const NTV2Channel inChannel)
-						{	const ULWordSet itms (dev.GetSupportedItems(kNTV2EnumsID_Channel));
-							return itms.find(ULWord(inChannel)) != itms.end();
-						}
+						{return CanDo(kNTV2EnumsID_Channel, ULWord(inChannel));}
 		bool			CanDoConversionMode (const NTV2ConversionMode inMode)
-						{	const ULWordSet itms (dev.GetSupportedItems(kNTV2EnumsID_ConversionMode));
-							return itms.find(ULWord(inMode)) != itms.end();
-						}
+						{return CanDo(kNTV2EnumsID_ConversionMode, ULWord(inMode));}
 		bool			CanDoDSKMode (const NTV2DSKMode inMode)
-						{	const ULWordSet itms (dev.GetSupportedItems(kNTV2EnumsID_DSKMode));
-							return itms.find(ULWord(inMode)) != itms.end();
-						}
+						{return CanDo(kNTV2EnumsID_DSKMode, ULWord(inMode));}
 		bool			CanDoFrameBufferFormat (const NTV2PixelFormat inPF)
-						{	const ULWordSet itms (dev.GetSupportedItems(kNTV2EnumsID_PixelFormat));
-							return itms.find(ULWord(inPF)) != itms.end();
-						}
+						{return CanDo(kNTV2EnumsID_PixelFormat, ULWord(inPF));}
 		bool			CanDoInputSource (const NTV2InputSource inSrc)
-						{	const ULWordSet itms (dev.GetSupportedItems(kNTV2EnumsID_InputSource));
-							return itms.find(ULWord(inSrc)) != itms.end();
-						}
+						{return CanDo(kNTV2EnumsID_InputSource, ULWord(inSrc));}
 		bool			CanDoOutputDestination (const NTV2OutputDestination inDest)
-						{	const ULWordSet itms (dev.GetSupportedItems(kNTV2EnumsID_OutputDest));
-							return itms.find(ULWord(inDest)) != itms.end();
-						}
+						{return CanDo(kNTV2EnumsID_OutputDest, ULWord(inDest));}
 		bool			CanDoVideoFormat (const NTV2VideoFormat inVF)
-						{	const ULWordSet itms (dev.GetSupportedItems(kNTV2EnumsID_VideoFormat));
-							return itms.find(ULWord(inVF)) != itms.end();
-						}
+						{return CanDo(kNTV2EnumsID_VideoFormat, ULWord(inVF));}
 		bool			CanDoWidget (const NTV2WidgetID inWgtID)
-						{	const ULWordSet itms (dev.GetSupportedItems(kNTV2EnumsID_WidgetID));
-							return itms.find(ULWord(inWgtID)) != itms.end();
-						}
+						{return CanDo(kNTV2EnumsID_WidgetID, ULWord(inWgtID));}
 	private:
+		bool			CanDo (const NTV2EnumsID inEnumsID, const ULWord inItem)
+						{	const NTV2DeviceCapsSnapshot & caps (dev.GetCapsSnapshot());
+							if (caps.IsValid())
+								return caps.CanDo(inEnumsID, inItem);
+							const ULWordSet itms (dev.GetSupportedItems(inEnumsID));
+							return itms.find(inItem) != itms.end();
+						}
 		CNTV2DriverInterface &	dev;	//	My reference to the physical or virtual NTV2 device
 };	//	DeviceCapabilities
 #endif	//	defined(NTV2_INCLUDE_DEVICE_CAPABILITIES_API)
@@ -3678,6 +3670,43 @@ public:
 	**/
 	AJA_VIRTUAL bool	AutoCirculateTransfer (const NTV2Channel inChannel, AUTOCIRCULATE_TRANSFER & transferInfo);
 
+	/**
+		@brief		Prepares the given channel for a steady stream of CNTV2Card::AutoCirculateTransfer calls that reuse the
+					host buffers of the given ::AUTOCIRCULATE_TRANSFER object.
+		@param[in]	inChannel		Specifies the ::NTV2Channel of interest. AutoCirculate must already be initialized on it.
+		@param[in]	inXferInfo		Specifies the ::AUTOCIRCULATE_TRANSFER whose video, audio and anc host buffers
+									will be used in subsequent transfers.
+		@param[in]	inLockBuffers	If true (the default), also page-locks those host buffers (see CNTV2Card::DMABufferLock).
+		@return		True if successful; otherwise false.
+		@details	This validates and caches the channel's AutoCirculate crosspoint, which can't change until AutoCirculate
+					is stopped or re-initialized, so that each subsequent CNTV2Card::AutoCirculateTransfer call on the channel
+					skips the driver call it would otherwise make to look it up. Locking the host buffers once up-front saves
+					the driver from pinning (and unpinning) their pages in every transfer. State that can change at any time,
+					like the video format or the device's task mode, is still read when a transfer needs it.
+					Each frame, the client then only needs to update its ::AUTOCIRCULATE_TRANSFER with what changed for that
+					frame (e.g. its timecode or frame number) before calling CNTV2Card::AutoCirculateTransfer.
+		@note		Call this once for each set of host buffers the channel's transfers cycle through. Transfers that use
+					other buffers still work, but their pages get pinned by the driver in the usual way.
+		@note		The preparation is undone by CNTV2Card::AutoCirculateUnprepareTransfer, and also by
+					CNTV2Card::AutoCirculateStop, CNTV2Card::AutoCirculateInitForInput and CNTV2Card::AutoCirculateInitForOutput.
+		@see		CNTV2Card::AutoCirculateTransfer, \ref aboutautocirculate
+	**/
+	AJA_VIRTUAL bool	AutoCirculatePrepareTransfer (const NTV2Channel inChannel, const AUTOCIRCULATE_TRANSFER & inXferInfo,
+														const bool inLockBuffers = true);	//	New in SDK 17.1
+
+	/**
+		@brief		Undoes CNTV2Card::AutoCirculatePrepareTransfer, unlocking any host buffers it locked.
+		@param[in]	inChannel		Specifies the ::NTV2Channel of interest. Specify ::NTV2_CHANNEL_INVALID for all channels.
+		@return		True if successful; otherwise false.
+	**/
+	AJA_VIRTUAL bool	AutoCirculateUnprepareTransfer (const NTV2Channel inChannel = NTV2_CHANNEL_INVALID);	//	New in SDK 17.1
+
+	/**
+		@param[in]	inChannel		Specifies the ::NTV2Channel of interest.
+		@return		True if the given channel has been prepared by CNTV2Card::AutoCirculatePrepareTransfer; otherwise false.
+	**/
+	AJA_VIRTUAL bool	AutoCirculateIsTransferPrepared (const NTV2Channel inChannel) const;	//	New in SDK 17.1
+
 	/**
 		@brief		Returns the device frame buffer numbers of the first unallocated contiguous band of frame buffers having the given
 					size that are available for use. This function is called by CNTV2Card::AutoCirculateInitForInput and
@@ -3698,6 +3727,65 @@ public:
 	**/
 	AJA_VIRTUAL bool	FindUnallocatedFrames (const UWord inFrameCount, LWord & outStartFrame, LWord & outEndFrame,
 												const NTV2Channel inFrameStore = NTV2_CHANNEL_INVALID);
+
+	/**
+		@brief		Enables or disables per-channel, per-stage AutoCirculate latency histograms.
+		@param[in]	inEnable	Specify true to start recording;  false to stop recording (and discard everything recorded).
+		@return		True if successful; otherwise false.
+		@details	While enabled, each CNTV2Card::AutoCirculateTransfer call records its ::NTV2_AC_LATENCY_DMA,
+					::NTV2_AC_LATENCY_HOST and ::NTV2_AC_LATENCY_FRAME_AGE latencies, and each CNTV2Card::WaitForInputVerticalInterrupt
+					or CNTV2Card::WaitForOutputVerticalInterrupt call records its ::NTV2_AC_LATENCY_VBI_WAIT latency, all in
+					microseconds. Every 64 transfers, the channel's p50/p99/p99.9 values are also published into the AJADebug
+					stats area (see CNTV2Card::AutoCirculatePublishLatencyStats).
+		@note		This is disabled by default. It can be enabled or disabled while AutoCirculate threads are running.
+		@see		CNTV2Card::AutoCirculateGetLatencyStats
+	**/
+	AJA_VIRTUAL bool	AutoCirculateSetLatencyStatsEnabled (const bool inEnable);	//	New in SDK 17.1
+
+	/**
+		@return		True if AutoCirculate latency histograms are being recorded; otherwise false.
+	**/
+	AJA_VIRTUAL bool	AutoCirculateIsLatencyStatsEnabled (void) const;	//	New in SDK 17.1
+
+	/**
+		@brief		Answers with a copy of the latency histogram for the given channel and stage.
+		@param[in]	inChannel		Specifies the ::NTV2Channel of interest.
+		@param[in]	inStage			Specifies the ::NTV2ACLatencyStage of interest.
+		@param[out]	outHistogram	Receives the latency histogram (in microseconds).
+		@return		True if successful; false if latency stats aren't enabled, or the channel or stage is invalid.
+	**/
+	AJA_VIRTUAL bool	AutoCirculateGetLatencyStats (const NTV2Channel inChannel, const NTV2ACLatencyStage inStage,
+														AJALatencyHistogram & outHistogram);	//	New in SDK 17.1
+
+	/**
+		@brief		Discards all latency values recorded for the given channel.
+		@param[in]	inChannel		Specifies the ::NTV2Channel of interest. Specify ::NTV2_CHANNEL_INVALID to reset all channels.
+		@return		True if successful; false if latency stats aren't enabled.
+	**/
+	AJA_VIRTUAL bool	AutoCirculateResetLatencyStats (const NTV2Channel inChannel = NTV2_CHANNEL_INVALID);	//	New in SDK 17.1
+
+	/**
+		@brief		Records a latency value measured by the caller (e.g. for a stage implemented outside the SDK).
+		@param[in]	inChannel		Specifies the ::NTV2Channel of interest.
+		@param[in]	inStage			Specifies the ::NTV2ACLatencyStage of interest.
+		@param[in]	inMicroseconds	Specifies the latency, in microseconds.
+		@return		True if successful; false if latency stats aren't enabled, or the channel or stage is invalid.
+	**/
+	AJA_VIRTUAL bool	AutoCirculateRecordLatency (const NTV2Channel inChannel, const NTV2ACLatencyStage inStage,
+													const uint64_t inMicroseconds);	//	New in SDK 17.1
+
+	/**
+		@brief		Publishes the given channel's p50, p99 and p99.9 latencies for each stage into the AJADebug stats area.
+		@param[in]	inChannel		Specifies the ::NTV2Channel of interest. Specify ::NTV2_CHANNEL_INVALID to publish all channels.
+		@return		True if successful; false if latency stats aren't enabled, the AJADebug facility has no stats area,
+					or another device owns the latency stat keys.
+		@details	The stat key for a given channel, stage and percentile (0=p50, 1=p99, 2=p99.9) is
+					::AJA_DebugStat_ACLatencyFirst + (channel * ::NTV2_AC_LATENCY_NUM_STAGES + stage) * 3 + percentile,
+					and is named accordingly (e.g. "AC1DMAp99"). These keys are shared by all devices, so only one
+					device publishes into them at a time. Its index number is stored in ::AJA_DebugStat_ACLatencyDevice.
+					Another device takes over once the owner hasn't published for 10 seconds.
+	**/
+	AJA_VIRTUAL bool	AutoCirculatePublishLatencyStats (const NTV2Channel inChannel = NTV2_CHANNEL_INVALID);	//	New in SDK 17.1
 	///@}
 
 
@@ -6759,7 +6847,21 @@ private:
 
 	AJA_VIRTUAL bool	IsMultiFormatActive (void); ///< @return	True if the device supports the multi format feature and it's enabled; otherwise false.
 	AJA_VIRTUAL bool	CopyVideoFormat(const NTV2Channel inSrc, const NTV2Channel inFirst, const NTV2Channel inLast);
+
+	//	AutoCirculate latency histograms
+	AJA_VIRTUAL void	ACLatencyRecordTransfer (const NTV2Channel inChannel, const uint64_t inStartMicroseconds, const AUTOCIRCULATE_TRANSFER & inXferInfo);
+	AJA_VIRTUAL void	ACLatencyResetChannel (const NTV2Channel inChannel);
+	AJA_VIRTUAL void	ACLatencyAlloc (void);
+	AJA_VIRTUAL void	ACLatencyFree (void);
+
+	//	AutoCirculate prepared transfers
+	AJA_VIRTUAL bool	ACPreparedGetCrosspoint (const NTV2Channel inChannel, NTV2Crosspoint & outCrosspoint) const;
+	AJA_VIRTUAL void	ACPreparedAlloc (void);
+	AJA_VIRTUAL void	ACPreparedFree (void);
+
 	class DeviceCapabilities	mDevCap;
+	struct NTV2ACLatencyStats *	mpACLatency;	///< @brief	AutoCirculate latency histograms (allocated by the constructor)
+	struct NTV2ACPreparedXfers *	mpACPrepared;	///< @brief	AutoCirculate prepared transfer state (allocated by the constructor)
 };	//	CNTV2Card
 
 
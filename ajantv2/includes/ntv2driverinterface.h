@@ -15,10 +15,11 @@
 #include "ntv2publicinterface.h"
 #include "ntv2utils.h"
 #include "ntv2devicefeatures.h"
-#if defined(NTV2_WRITEREG_PROFILING)	//	Register Write Profiling
-	#include "ajabase/system/lock.h"
-#endif	//	NTV2_WRITEREG_PROFILING		Register Write Profiling
+#include "ajabase/system/lock.h"
 #include <string>
+#if defined(NTV2_USE_CPLUSPLUS11)
+	#include <atomic>
+#endif
 
 //	Check consistent use of AJA_USE_CPLUSPLUS11 and NTV2_USE_CPLUSPLUS11
 #ifdef AJA_USE_CPLUSPLUS11
@@ -58,6 +59,40 @@ typedef struct
 } PACKAGE_INFO_STRUCT, *PPACKAGE_INFO_STRUCT;
 
 
+/**
+	@brief	An immutable copy of a device's features -- its boolean and numeric parameters, and its supported
+			items for each NTV2EnumsID -- taken when the device is opened. Queries are answered from memory,
+			without calling into the device features functions, the driver, or a remote device.
+			See CNTV2DriverInterface::GetCapsSnapshot.
+**/
+class AJAExport NTV2DeviceCapsSnapshot	//	New in SDK 17.1
+{
+	public:
+		NTV2DeviceCapsSnapshot ();	///< @brief	Constructs an empty (invalid) snapshot.
+		inline bool			IsValid (void) const		{return mDeviceID != DEVICE_ID_NOTFOUND;}	///< @return	True if I was taken from an open device.
+		inline NTV2DeviceID	GetDeviceID (void) const	{return mDeviceID;}	///< @return	The ID of the device I was taken from.
+		bool				IsSupported (const NTV2BoolParamID inParamID) const;	///< @return	True if the given device feature is supported.
+		ULWord				GetNumSupported (const NTV2NumericParamID inParamID) const;	///< @return	The quantity for the given device feature.
+		const ULWordSet &	GetSupportedItems (const NTV2EnumsID inEnumsID) const;	///< @return	The supported items of the given enumerated type.
+
+		/**
+			@return		True if the given item is supported.
+			@param[in]	inEnumsID	The NTV2EnumsID of interest.
+			@param[in]	inItem		The item of interest (e.g. an NTV2VideoFormat if inEnumsID is kNTV2EnumsID_VideoFormat).
+			@note		This is a bitmap lookup for every NTV2EnumsID except kNTV2EnumsID_DeviceID.
+		**/
+		bool				CanDo (const NTV2EnumsID inEnumsID, const ULWord inItem) const;
+
+	private:
+		friend class CNTV2DriverInterface;
+		NTV2DeviceID					mDeviceID;	///< @brief	The device I was taken from
+		std::vector<bool>				mBools;		///< @brief	Indexed by NTV2BoolParamID
+		std::vector<ULWord>				mNums;		///< @brief	Indexed by NTV2NumericParamID, starting at kNTV2NumericParam_FIRST
+		std::vector<ULWordSet>			mItems;		///< @brief	Indexed by NTV2EnumsID
+		std::vector<std::vector<bool> >	mItemBits;	///< @brief	Indexed by NTV2EnumsID, then by item (empty for sparse enumerations)
+};	//	NTV2DeviceCapsSnapshot
+
+
 /**
 	@brief	I'm the base class that undergirds the platform-specific derived classes (from which ::CNTV2Card is ultimately derived).
 **/
@@ -118,6 +153,14 @@ class AJAExport CNTV2DriverInterface
 		AJA_VIRTUAL inline UWord	GetIndexNumber (void) const	{return _boardNumber;}	///< @return	My zero-based index number (relative to other devices attached to the host).
 		AJA_VIRTUAL inline bool		IsOpen (void) const			{return _boardOpened;}	///< @return	True if I'm able to communicate with the device I represent;  otherwise false.
 
+		/**
+			@return		The zero-based NUMA node my PCIe device is attached to, or -1 if unknown, not applicable (e.g. remote
+						devices or non-NUMA hosts), or not supported on this platform.
+			@note		Pass this to AJAThread::SetNUMANode and NTV2Buffer::AllocateOnNode to keep capture/playout threads
+						and their host buffers on the same node as the device's DMA engine.
+		**/
+		AJA_VIRTUAL int			GetNUMANode (void);	//	New in SDK 17.1
+
 		/**
 			@return		True if the device is ready to be fully operable;  otherwise false.
 			@param[in]	inCheckValid	If true, additionally checks CNTV2Card::IsMBSystemValid. Defaults to false.
@@ -423,7 +466,9 @@ class AJAExport CNTV2DriverInterface
 			@param[in]	inParamID	The NTV2BoolParamID of interest.
 		**/
 		AJA_VIRTUAL bool		IsSupported (const NTV2BoolParamID inParamID)	//	New in SDK 17.0
-									{	ULWord value(0);
+									{	if (mCaps.IsValid())
+											return mCaps.IsSupported(inParamID);
+										ULWord value(0);
 										GetBoolParam (ULWord(inParamID), value);
 										return bool(value);
 									}
@@ -432,7 +477,9 @@ class AJAExport CNTV2DriverInterface
 			@param[in]	inParamID	The NTV2NumericParamID of interest.
 		**/
 		AJA_VIRTUAL ULWord		GetNumSupported (const NTV2NumericParamID inParamID)	//	New in SDK 17.0
-									{	ULWord value(0);
+									{	if (mCaps.IsValid())
+											return mCaps.GetNumSupported(inParamID);
+										ULWord value(0);
 										GetNumericParam (ULWord(inParamID), value);
 										return value;
 									}
@@ -442,6 +489,15 @@ class AJAExport CNTV2DriverInterface
 			@return		The supported items.
 		**/
 		AJA_VIRTUAL ULWordSet	GetSupportedItems (const NTV2EnumsID inEnumsID);	//	New in SDK 17.0
+
+		/**
+			@return		The immutable snapshot of my device features that was taken when I was opened,
+						which is invalid if I'm not open. IsSupported, GetNumSupported and GetSupportedItems
+						are answered from it while I'm open.
+			@note		Register-backed features (e.g. ::kDeviceCanDoAudioMixer) reflect the firmware that
+						was running at Open, or at the last successful CNTV2Card::LoadDynamicDevice.
+		**/
+		inline const NTV2DeviceCapsSnapshot &	GetCapsSnapshot (void) const	{return mCaps;}	//	New in SDK 17.1
 	///@}
 
 		// stream channel operations
@@ -618,6 +674,45 @@ class AJAExport CNTV2DriverInterface
 		///@}
 #endif	//	NTV2_WRITEREG_PROFILING		//	Register Write Profiling
 
+		/**
+			@name	Shadow Register Cache
+			@brief	When enabled, ReadRegister answers from a host-side copy of the device's configuration registers
+					(e.g. channel control, global control, SDI output control and crosspoint select registers), which
+					is kept current by WriteRegister and WriteRegisters. Status and other volatile registers always
+					go to the hardware. The cache is disabled by default.
+			@note	Don't enable the cache if another process or the driver changes the cacheable registers behind
+					this object's back (e.g. when sharing a device with the AJA Agent or other applications).
+		**/
+		///@{
+		AJA_VIRTUAL bool	EnableRegisterCache (const bool inEnable = true);	///< @brief	Enables or disables my shadow register cache. Disabling it discards its contents.
+		AJA_VIRTUAL bool	IsRegisterCacheEnabled (void) const;	///< @return	True if my shadow register cache is enabled;  otherwise false.
+		AJA_VIRTUAL void	InvalidateRegisterCache (void);			///< @brief	Discards my shadow register cache contents, so subsequent reads go to the hardware.
+
+		/**
+			@brief		Overrides the classification of a register for my shadow register cache.
+			@param[in]	inRegNum		Specifies the register number of interest. Must be less than kRegNumRegisters.
+			@param[in]	inCacheable		Specify true if the register only changes when written through this object;
+										specify false if it's volatile and must always be read from the hardware.
+			@return		True if successful;  otherwise false.
+		**/
+		AJA_VIRTUAL bool	SetRegisterCacheable (const ULWord inRegNum, const bool inCacheable);
+		AJA_VIRTUAL bool	IsRegisterCacheable (const ULWord inRegNum) const;	///< @return	True if the given register's value can be served from my shadow register cache.
+
+		/**
+			@brief		Answers with my shadow register cache statistics.
+			@param[out]	outHits			Receives the number of ReadRegister calls answered from the cache.
+			@param[out]	outMisses		Receives the number of ReadRegister calls for cacheable registers that went to the hardware.
+			@param[in]	inReset			Optionally resets the counters after reading them. Defaults to false.
+		**/
+		AJA_VIRTUAL void	GetRegisterCacheStats (ULWord64 & outHits, ULWord64 & outMisses, const bool inReset = false);
+
+		/**
+			@return		The set of registers that are cacheable by default. These are configuration registers that
+						the device and driver never change on their own.
+		**/
+		static NTV2RegNumSet	GetDefaultCacheableRegisters (void);
+		///@}
+
 
 	//	PROTECTED METHODS
 	protected:
@@ -659,8 +754,41 @@ class AJAExport CNTV2DriverInterface
 			@brief		Initializes my member variables after a successful Open.
 		**/
 		AJA_VIRTUAL void	FinishOpen (void);
+		AJA_VIRTUAL void	SnapshotCaps (void);	///< @brief	Fills mCaps from my device features. Called by FinishOpen, and by LoadDynamicDevice.
 		AJA_VIRTUAL bool	ReadFlashULWord (const ULWord inAddress, ULWord & outValue, const ULWord inRetryCount = 1000);
 
+		/**
+			@brief		Platform ReadRegister implementations call this before reading the hardware.
+			@param[in]	inRegNum	Specifies the register number of interest.
+			@param[out]	outValue	Receives the register value if the read was satisfied from the shadow register cache.
+			@param[in]	inMask		Specifies the bit mask passed to ReadRegister.
+			@param[in]	inShift		Specifies the right-shift passed to ReadRegister.
+			@return		True if the read was satisfied without a hardware read of the requested bits;  otherwise false.
+		**/
+		AJA_VIRTUAL bool	ShadowReadRegister (const ULWord inRegNum, ULWord & outValue, const ULWord inMask, const ULWord inShift);
+
+		/**
+			@return		The given register's shadow write generation, which changes whenever the register is written or
+						the cache is invalidated. Platform ReadRegister implementations sample this before a hardware
+						read, and pass it to ShadowStoreRegister afterwards.
+			@param[in]	inRegNum	Specifies the register number.
+		**/
+		AJA_VIRTUAL ULWord	ShadowRegisterGeneration (const ULWord inRegNum) const;
+
+		/**
+			@brief		Platform ReadRegister implementations call this after a successful hardware read. The value is
+						only cached if the register wasn't written (and the cache wasn't invalidated) since the given
+						generation was sampled, so a read that races a write can't leave a stale value in the cache.
+			@param[in]	inRegNum		Specifies the register number.
+			@param[in]	inValue			Specifies the value read from the hardware.
+			@param[in]	inMask			Specifies the bit mask passed to ReadRegister.
+			@param[in]	inShift			Specifies the right-shift passed to ReadRegister.
+			@param[in]	inGeneration	Specifies the ShadowRegisterGeneration sampled before the hardware read.
+		**/
+		AJA_VIRTUAL void	ShadowStoreRegister (const ULWord inRegNum, const ULWord inValue, const ULWord inMask, const ULWord inShift, const ULWord inGeneration);
+		AJA_VIRTUAL void	ShadowWriteRegister (const ULWord inRegNum, const ULWord inValue, const ULWord inMask, const ULWord inShift);	///< @brief	Platform WriteRegister implementations call this after a successful hardware write.
+		void				ClassifyRegisterCache (void);	///< @brief	Sizes my shadow register cache and classifies its registers, if not done already. Caller must hold mRegCacheLock.
+
 
 	//	PRIVATE TYPES
 	protected:
@@ -681,6 +809,18 @@ class AJAExport CNTV2DriverInterface
 		NTV2RPCAPI *		_pRPCAPI;				///< @brief	Points to remote or software device interface; otherwise NULL for local physical device.
 		_EventHandles		mInterruptEventHandles;	///< @brief	For subscribing to each possible event, one for each interrupt type
 		_EventCounts		mEventCounts;			///< @brief	My event tallies, one for each interrupt type. Note that these
+#if defined(NTV2_USE_CPLUSPLUS11)
+		std::atomic<bool>	mRegCacheEnabled;		///< @brief	True if my shadow register cache is enabled
+#else
+		bool				mRegCacheEnabled;		///< @brief	True if my shadow register cache is enabled (guarded by mRegCacheLock)
+#endif
+		std::vector<ULWord>	mRegCacheValues;		///< @brief	Shadow register values, indexed by register number
+		std::vector<UByte>	mRegCacheFlags;			///< @brief	Shadow register cacheable/valid flags, indexed by register number
+		std::vector<ULWord>	mRegCacheGens;			///< @brief	Shadow register write generations, indexed by register number
+		ULWord64			mRegCacheHits;			///< @brief	Number of reads answered from the shadow register cache
+		ULWord64			mRegCacheMisses;		///< @brief	Number of cacheable register reads that went to the hardware
+		mutable AJALock		mRegCacheLock;			///< @brief	Guard mutex for my shadow register cache
+		NTV2DeviceCapsSnapshot	mCaps;				///< @brief	My device features, taken at Open and LoadDynamicDevice
 #if defined(NTV2_WRITEREG_PROFILING)
 		NTV2RegisterWrites	mRegWrites;				///< @brief	Stores WriteRegister data
 		mutable AJALock		mRegWritesLock;			///< @brief	Guard mutex for mRegWrites
@@ -0,0 +1,120 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		ajantv2/includes/ntv2frameconverter.h
+	@brief		Declares the NTV2FrameConverter class.
+	@copyright	(C) 2023 AJA Video Systems, Inc.
+**/
+
+#ifndef NTV2_FRAMECONVERTER_H
+#define NTV2_FRAMECONVERTER_H
+
+#include "ajaexport.h"
+#include "ntv2formatdescriptor.h"
+#include "ntv2publicinterface.h"
+#include <vector>
+
+class AJALock;
+struct NTV2FrameConverterWorker;
+
+/**
+	@brief	Converts whole frames from one pixel format to another, using the line transcoders declared in
+			ntv2transcode.h. The visible raster is split into bands of lines, and each band is converted on
+			a worker thread. The worker threads are created once, and are reused for every conversion.
+			Other whole-frame work can be spread across the same threads by calling ::NTV2FrameConverter::RunBands.
+	@note	One conversion runs at a time. Calls to ::NTV2FrameConverter::Convert or ::NTV2FrameConverter::RunBands
+			from multiple threads are serialized.
+**/
+class AJAExport NTV2FrameConverter
+{
+	//	CLASS METHODS
+	public:
+		/**
+			@return		True if I can convert frames from the given source pixel format to the given destination pixel format.
+			@param[in]	inSrcPixelFormat	Specifies the source pixel format.
+			@param[in]	inDstPixelFormat	Specifies the destination pixel format.
+		**/
+		static bool		CanConvert (const NTV2PixelFormat inSrcPixelFormat, const NTV2PixelFormat inDstPixelFormat);
+
+		/**
+			@return		A process-wide converter that uses one thread per CPU core. It's created on first use.
+		**/
+		static NTV2FrameConverter &	GetShared (void);
+
+		/**
+			@return		The number of CPU cores on the host.
+		**/
+		static ULWord	GetNumCPUCores (void);
+
+	//	INSTANCE METHODS
+	public:
+		typedef bool (*LineConverter) (const void * pInSrcLine, void * pOutDstLine, const ULWord inNumPixels);	///< @brief	Converts one raster line
+		typedef bool (*BandFunc) (void * pContext, const ULWord inFirstLine, const ULWord inNumLines);		///< @brief	Processes one band of lines
+
+		/**
+			@brief		Constructs me.
+			@param[in]	inNumThreads	Optionally specifies the number of threads to convert with, including the
+										calling thread. Zero, the default, uses one thread per CPU core.
+		**/
+		explicit		NTV2FrameConverter (const ULWord inNumThreads = 0);
+		virtual			~NTV2FrameConverter ();
+
+		/**
+			@brief		Converts the visible raster of a frame into another pixel format.
+			@param[in]	inSrcBuffer		Specifies the host buffer containing the source frame.
+			@param[in]	inSrcDesc		Describes the source frame.
+			@param[out]	outDstBuffer	Specifies the host buffer that is to receive the converted frame.
+			@param[in]	inDstDesc		Describes the destination frame. Its raster width and visible raster
+										height must match those of the source.
+			@return		True if successful;  otherwise false.
+		**/
+		virtual bool	Convert (const NTV2Buffer & inSrcBuffer, const NTV2FormatDescriptor & inSrcDesc,
+								NTV2Buffer & outDstBuffer, const NTV2FormatDescriptor & inDstDesc);
+
+		/**
+			@brief		Splits the given number of lines into bands, the same way ::NTV2FrameConverter::Convert does,
+						and calls the given function for each band on my worker threads. The first band is
+						processed on the calling thread.
+			@param[in]	inNumLines		Specifies the total number of lines.
+			@param[in]	inFunc			Specifies the function to call for each band. It's called concurrently,
+										so it must only write to the lines in its band. It must not call
+										RunBands or Convert.
+			@param[in]	pContext		Specifies an opaque pointer that's passed to the function.
+			@return		True if every band succeeded;  otherwise false.
+		**/
+		virtual bool	RunBands (const ULWord inNumLines, BandFunc inFunc, void * pContext);	//	New in SDK 17.1
+
+		/**
+			@return		The number of threads I convert with, including the calling thread.
+		**/
+		inline ULWord	GetNumThreads (void) const		{return ULWord(mWorkers.size()) + 1;}
+
+		/**
+			@brief		Sets the minimum number of lines per band. Small rasters use fewer threads, since
+						the cost of waking a thread outweighs the conversion of a handful of lines.
+			@param[in]	inNumLines		Specifies the minimum number of lines per band. Defaults to 32.
+		**/
+		inline void		SetMinLinesPerBand (const ULWord inNumLines)	{mMinLinesPerBand = inNumLines ? inNumLines : 1;}
+		inline ULWord	GetMinLinesPerBand (void) const					{return mMinLinesPerBand;}	///< @return	The minimum number of lines per band.
+
+	private:
+		friend struct NTV2FrameConverterWorker;
+		bool			RunBand (const ULWord inFirstLine, const ULWord inNumLines) const;
+		bool			ConvertLines (const ULWord inFirstLine, const ULWord inNumLines) const;
+		static bool		ConvertBand (void * pContext, const ULWord inFirstLine, const ULWord inNumLines);
+		NTV2FrameConverter (const NTV2FrameConverter & inObj);						//	No copying
+		NTV2FrameConverter & operator = (const NTV2FrameConverter & inRHS);		//	No copying
+
+		std::vector<NTV2FrameConverterWorker*>	mWorkers;			///< @brief	My worker threads
+		AJALock *				mpLock;				///< @brief	Serializes conversions
+		ULWord					mMinLinesPerBand;	///< @brief	Minimum number of lines in a band
+		//	Current job
+		const UByte *			mpSrc;				///< @brief	Source frame start
+		UByte *					mpDst;				///< @brief	Destination frame start
+		NTV2FormatDescriptor	mSrcDesc;			///< @brief	Source frame description
+		NTV2FormatDescriptor	mDstDesc;			///< @brief	Destination frame description
+		LineConverter			mpConvertLine;		///< @brief	Line converter (or NULL to copy)
+		BandFunc				mpBandFunc;			///< @brief	Band function being run
+		void *					mpBandContext;		///< @brief	Band function context
+};	//	NTV2FrameConverter
+
+#endif	//	NTV2_FRAMECONVERTER_H
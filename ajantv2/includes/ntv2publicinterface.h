@@ -4251,6 +4251,22 @@ typedef enum
 #define NTV2_IS_VALID_AUTO_CIRC_STATE(__m__)		((__m__) >= NTV2_AUTOCIRCULATE_DISABLED	 &&	 (__m__) < NTV2_AUTOCIRCULATE_INVALID)
 
 
+/**
+	@brief	Identifies an AutoCirculate pipeline stage whose latency can be tracked. See CNTV2Card::AutoCirculateGetLatencyStats.
+**/
+typedef enum
+{
+	NTV2_AC_LATENCY_VBI_WAIT = 0,	///< @brief Time spent blocked in CNTV2Card::WaitForInputVerticalInterrupt or CNTV2Card::WaitForOutputVerticalInterrupt.
+	NTV2_AC_LATENCY_DMA,			///< @brief Duration of the driver call made by CNTV2Card::AutoCirculateTransfer.
+	NTV2_AC_LATENCY_HOST,			///< @brief Host processing time, from the end of one CNTV2Card::AutoCirculateTransfer to the start of the next.
+	NTV2_AC_LATENCY_FRAME_AGE,		///< @brief Time from the frame's VBI to the end of its transfer, from the FRAME_STAMP audio clock timestamps.
+	NTV2_AC_LATENCY_INVALID
+} NTV2ACLatencyStage;
+
+#define NTV2_AC_LATENCY_NUM_STAGES					(NTV2_AC_LATENCY_INVALID)
+#define NTV2_IS_VALID_AC_LATENCY_STAGE(__s__)		((__s__) >= NTV2_AC_LATENCY_VBI_WAIT  &&  (__s__) < NTV2_AC_LATENCY_INVALID)
+
+
 /**
 	@brief	Describes the task mode state. See also: \ref devicesharing
 **/
@@ -6178,6 +6194,19 @@ typedef enum
 				**/
 				bool			Allocate (const size_t inByteCount, const bool inPageAligned = false);
 
+				/**
+					@brief		Allocates (or re-allocates) my user-space storage as a page-aligned block whose physical
+								pages are preferably taken from the given NUMA node. I assume full responsibility for any
+								memory that I allocate.
+					@param[in]	inByteCount		Specifies the number of bytes to allocate.
+												Specifying zero is the same as calling Set(NULL, 0).
+					@param[in]	inNUMANode		Specifies the zero-based NUMA node, typically from CNTV2DriverInterface::GetNUMANode.
+												Specify -1 for no preference (same as calling Allocate with inPageAligned true).
+					@return		True if successful;	 otherwise false.
+					@note		Placement is a preference. If the node has no free memory, pages come from another node.
+				**/
+				bool			AllocateOnNode (const size_t inByteCount, const int inNUMANode);	//	New in SDK 17.1
+
 				/**
 					@brief		Deallocates my user-space storage (if I own it -- i.e. from a prior call to Allocate).
 					@return		True if successful;	 otherwise false.
@@ -8819,6 +8848,13 @@ typedef enum
 			**/
 			AJAExport std::string NTV2AutoCirculateStateToString (const NTV2AutoCirculateState inState);
 
+			/**
+				@return		A string that contains the human-readable representation of the given ::NTV2ACLatencyStage value.
+				@param[in]	inStage		Specifies the ::NTV2ACLatencyStage of interest.
+				@param[in]	inCompact	Specify true for a short name (e.g. "DMA");  false for a descriptive one.
+			**/
+			AJAExport std::string NTV2ACLatencyStageToString (const NTV2ACLatencyStage inStage, const bool inCompact = false);
+
 			/**
 				@brief	Returns a set of distinct ::NTV2VideoFormat values supported on the given device.
 				@param[in]	inDeviceID	Specifies the ::NTV2DeviceID of the device of interest.
@@ -12,6 +12,8 @@
 
 #include "ajabase/system/lock.h"
 #include "ajabase/common/ajarefptr.h"
+#include <algorithm>
+#include <vector>
 
 class RoutingExpert;
 typedef AJARefPtr<RoutingExpert>	RoutingExpertPtr;
@@ -35,9 +37,9 @@ class RoutingExpert
 		std::string			OutputXptToString (const NTV2OutputXptID inOutputXpt) const;
 		NTV2InputXptID		StringToInputXpt (const std::string & inStr) const;
 		NTV2OutputXptID		StringToOutputXpt (const std::string & inStr) const;
-		NTV2WidgetType		WidgetIDToType (const NTV2WidgetID inWidgetID);
-		NTV2Channel			WidgetIDToChannel(const NTV2WidgetID inWidgetID);
-		NTV2WidgetID		WidgetIDFromTypeAndChannel(const NTV2WidgetType inWidgetType, const NTV2Channel inChannel);
+		NTV2WidgetType		WidgetIDToType (const NTV2WidgetID inWidgetID) const;
+		NTV2Channel			WidgetIDToChannel(const NTV2WidgetID inWidgetID) const;
+		NTV2WidgetID		WidgetIDFromTypeAndChannel(const NTV2WidgetType inWidgetType, const NTV2Channel inChannel) const;
 		bool				GetWidgetsForOutput (const NTV2OutputXptID inOutputXpt, NTV2WidgetIDSet & outWidgetIDs) const;
 		bool				GetWidgetsForInput (const NTV2InputXptID inInputXpt, NTV2WidgetIDSet & outWidgetIDs) const;
 		bool				GetWidgetInputs (const NTV2WidgetID inWidgetID, NTV2InputXptIDSet & outInputs) const;
@@ -58,42 +60,104 @@ class RoutingExpert
 		bool				IsHDMIInWidget(const NTV2WidgetType inWidgetType) const;
 		bool				IsHDMIOutWidget(const NTV2WidgetType inWidgetType) const;
 
+		/**
+			@brief		Finds the connections that route each source to its destination on the given device,
+						going through a CSC or LUT widget when a destination can't accept the source's format.
+						Results are cached per device.
+			@param[in]	inDeviceID		Specifies the device.
+			@param[in]	inEndpoints		Maps each destination input crosspoint to its source output crosspoint.
+			@param[out]	outConnections	Receives the connections.
+			@return		True if every path was found;  otherwise false.
+		**/
+		bool				FindRoutes (const NTV2DeviceID inDeviceID, const NTV2XptConnections & inEndpoints, NTV2XptConnections & outConnections) const;	//	New in SDK 17.1
+
 		private:
-			void InitInputXpt2String(void);
-			void InitOutputXpt2String(void);
-			void InitInputXpt2WidgetIDs(void);
-			void InitOutputXpt2WidgetIDs(void);
-			void InitWidgetIDToChannels(void);
-			void InitWidgetIDToWidgetTypes(void);
-
-			mutable AJALock			gLock;
-			String2InputXpt			gString2InputXpt;
-			InputXpt2String			gInputXpt2String;
-			InputXpt2WidgetIDs		gInputXpt2WidgetIDs;
-			String2OutputXpt		gString2OutputXpt;
-			OutputXpt2String		gOutputXpt2String;
-			OutputXpt2WidgetIDs		gOutputXpt2WidgetIDs;
-			Widget2OutputXpts		gWidget2OutputXpts;
-			Widget2InputXpts		gWidget2InputXpts;
-			Widget2Channels			gWidget2Channels;
-			Widget2Types			gWidget2Types;
-			// NTV2InputXptID Helpers
-			NTV2InputXptIDSet		gRGBOnlyInputXpts;
-			NTV2InputXptIDSet		gYUVOnlyInputXpts;
-			NTV2InputXptIDSet		gKeyInputXpts;
-			// NTV2WidgetType Helpers
-			NTV2WidgetTypeSet		gSDIWidgetTypes;
-			NTV2WidgetTypeSet		gSDI3GWidgetTypes;
-			NTV2WidgetTypeSet		gSDI12GWidgetTypes;
-			NTV2WidgetTypeSet		gSDIInWidgetTypes;
-			NTV2WidgetTypeSet		gSDIOutWidgetTypes;
-			NTV2WidgetTypeSet		gDualLinkWidgetTypes;
-			NTV2WidgetTypeSet		gDualLinkInWidgetTypes;
-			NTV2WidgetTypeSet		gDualLinkOutWidgetTypes;
-			NTV2WidgetTypeSet		gHDMIWidgetTypes;
-			NTV2WidgetTypeSet		gHDMIInWidgetTypes;
-			NTV2WidgetTypeSet		gHDMIOutWidgetTypes;
-			NTV2WidgetTypeSet		gAnalogWidgetTypes;
+			struct Tables;	//	The crosspoint & widget maps populated by the Init functions
+			void InitInputXpt2String(Tables & t);
+			void InitOutputXpt2String(Tables & t);
+			void InitInputXpt2WidgetIDs(Tables & t);
+			void InitOutputXpt2WidgetIDs(Tables & t);
+			void InitWidgetIDToChannels(Tables & t);
+			void InitWidgetIDToWidgetTypes(Tables & t);
+			void BuildDenseTables(const Tables & t);
+
+			typedef std::vector<bool>	NTV2WidgetIDFlags;	//	Indexed by NTV2WidgetID
+			bool IsRouteInputUsable (const NTV2InputXptID inInputXpt, const NTV2WidgetIDFlags & inWidgets) const;
+			bool CanConnect (const NTV2OutputXptID inOutputXpt, const NTV2InputXptID inInputXpt) const;
+			bool SolvePath (const NTV2WidgetIDFlags & inDeviceWidgets, const NTV2WidgetIDFlags & inBusyWidgets,
+							const NTV2OutputXptID inSource, const NTV2InputXptID inDestination,
+							const NTV2XptConnections & inUsed, NTV2XptConnections & outPath) const;
+			bool SolveRoutes (const NTV2WidgetIDFlags & inDeviceWidgets, const NTV2XptConnections & inEndpoints, NTV2XptConnections & outConnections) const;
+
+			/**
+				@brief	A dense one-to-many lookup:  key K's values are mValues[mFirst[K]] thru mValues[mFirst[K+1]-1].
+			**/
+			template <typename V>	struct DenseSets
+			{
+				std::vector<uint32_t>	mFirst;
+				std::vector<V>			mValues;
+
+				template <typename K>	inline bool Get (const K inKey, std::set<V> & outValues) const
+				{
+					if (size_t(inKey) + 1 >= mFirst.size())
+						return false;
+					outValues.insert(mValues.begin() + mFirst[size_t(inKey)], mValues.begin() + mFirst[size_t(inKey)+1]);
+					return mFirst[size_t(inKey)] != mFirst[size_t(inKey)+1];
+				}
+				template <typename K>	inline size_t	Count (const K inKey) const		{return size_t(inKey) + 1 < mFirst.size() ? size_t(mFirst[size_t(inKey)+1] - mFirst[size_t(inKey)]) : 0;}
+				template <typename K>	inline const V*	Begin (const K inKey) const		{return mValues.empty() ? AJA_NULL : &mValues[0] + mFirst[size_t(inKey)];}
+				template <typename K, typename MMAP>	void Build (const MMAP & inMap, const size_t inNumKeys)
+				{
+					mFirst.assign(inNumKeys + 1, 0);
+					mValues.clear();
+					for (size_t key(0);  key < inNumKeys;  key++)
+					{
+						mFirst[key] = uint32_t(mValues.size());
+						for (typename MMAP::const_iterator it(inMap.find(K(key)));  it != inMap.end() && it->first == K(key);  ++it)
+							if (std::find(mValues.begin() + mFirst[key], mValues.end(), it->second) == mValues.end())
+								mValues.push_back(it->second);
+					}
+					mFirst[inNumKeys] = uint32_t(mValues.size());
+				}
+			};
+
+			enum
+			{
+				kNumInputXpts	= NTV2_LAST_INPUT_CROSSPOINT + 1,
+				kNumOutputXpts	= NTV2_LAST_OUTPUT_CROSSPOINT + 1,
+				kNumWidgets		= NTV2_WIDGET_INVALID,
+				kNumWidgetTypes	= NTV2WidgetType_Max,
+				kNumChannels	= NTV2_MAX_NUM_CHANNELS + 1		//	Last slot is for widgets that have no channel
+			};
+			typedef std::vector<std::pair<std::string, NTV2InputXptID> >	InputXptNames;		//	Sorted by name
+			typedef std::vector<std::pair<std::string, NTV2OutputXptID> >	OutputXptNames;		//	Sorted by name
+			typedef std::map<NTV2XptConnections, NTV2XptConnections>		RouteCache;			//	Requested endpoints => solved connections
+			struct DeviceRoutes
+			{
+				NTV2WidgetIDFlags	mWidgets;	//	Widgets the device has
+				RouteCache			mRoutes;
+			};
+			typedef std::map<NTV2DeviceID, DeviceRoutes>					DeviceRouteCache;
+
+			//	These are built once by my constructor, and are read without locking thereafter
+			std::string				gInputXpt2String[kNumInputXpts];
+			std::string				gOutputXpt2String[kNumOutputXpts];
+			InputXptNames			gString2InputXpt;
+			OutputXptNames			gString2OutputXpt;
+			uint8_t					gInputXptFlags[kNumInputXpts];		//	RGB-only, YUV-only, key
+			uint8_t					gOutputXptFlags[kNumOutputXpts];	//	Valid, key
+			DenseSets<NTV2WidgetID>		gInputXpt2WidgetIDs;
+			DenseSets<NTV2WidgetID>		gOutputXpt2WidgetIDs;
+			DenseSets<NTV2InputXptID>	gWidget2InputXpts;
+			DenseSets<NTV2OutputXptID>	gWidget2OutputXpts;
+			NTV2Channel				gWidget2Channel[kNumWidgets];
+			NTV2WidgetType			gWidget2Type[kNumWidgets];
+			NTV2WidgetID			gTypeAndChannel2Widget[kNumWidgetTypes][kNumChannels];
+			uint16_t				gWidgetTypeFlags[kNumWidgetTypes];	//	SDI, HDMI, dual-link, etc.
+
+			//	Solved routes, per device
+			mutable AJALock			gRouteLock;
+			mutable DeviceRouteCache	gRoutes;
 
 };	//	RoutingExpert
 
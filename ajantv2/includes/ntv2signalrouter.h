@@ -535,6 +535,33 @@ class AJAExport CNTV2SignalRouter
 		**/
 		static bool					IsHDMIOutWidgetType (const NTV2WidgetType inWidgetType);	// New in SDK 16.1
 
+		/**
+			@brief		Finds the crosspoint connections that route each of the given sources to its destination on the given device.
+						Where a destination can't accept its source's RGB or YUV format, the path goes through the device's
+						CSC and/or LUT widgets (preferring those on the destination's channel). No widget is shared between paths.
+			@param[in]	inDeviceID		Specifies the device.
+			@param[in]	inEndpoints		Maps each destination input crosspoint to the source output crosspoint that should feed it.
+			@param[out]	outConnections	Receives the connections for all of the paths, ready for CNTV2Card::ApplySignalRoute.
+			@return		True if every path was found;  otherwise false.
+			@note		Possible connections come from the SDK's crosspoint tables, not from the device's routing ROM.
+			@note		Solutions are cached per device, so repeating a request (e.g. reconfiguring the four UHD quadrant
+						channels) costs a lookup.
+			@see		CNTV2SignalRouter::FindRoute
+		**/
+		static bool					FindRoutes (const NTV2DeviceID inDeviceID, const NTV2XptConnections & inEndpoints, NTV2XptConnections & outConnections);	//	New in SDK 17.1
+
+		/**
+			@brief		Finds the crosspoint connections that route the given source to the given destination on the given device.
+			@param[in]	inDeviceID		Specifies the device.
+			@param[in]	inSource		Specifies the source output crosspoint.
+			@param[in]	inDestination	Specifies the destination input crosspoint.
+			@param[out]	outConnections	Receives the connections for the path.
+			@return		True if a path was found;  otherwise false.
+			@see		CNTV2SignalRouter::FindRoutes
+		**/
+		static bool					FindRoute (const NTV2DeviceID inDeviceID, const NTV2OutputXptID inSource,
+												const NTV2InputXptID inDestination, NTV2XptConnections & outConnections);	//	New in SDK 17.1
+
 		/**
 			@brief		Compares two sets of crosspoint connections.
 			@param[in]	inLHS		Specifies the input crosspoints.
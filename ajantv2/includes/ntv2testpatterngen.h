@@ -112,6 +112,40 @@ class AJAExport NTV2TestPatternGen
 		static ULWord					findRGBColorByName (const std::string & inName);	//	New in SDK 16.0
 		///@}
 
+		/**
+			@name	Pattern Cache
+			@brief	Rendered test patterns are kept in a process-wide cache, keyed by pattern, raster geometry,
+					pixel format and the generator's drawing options, so redrawing a pattern just copies it.
+					The least recently used patterns are discarded when the cache exceeds its memory budget.
+		**/
+		///@{
+		/**
+			@brief		Sets the maximum amount of memory the pattern cache can use. Patterns are discarded, least
+						recently used first, until the cache fits. Defaults to 256MB.
+			@param[in]	inMaxBytes	Specifies the new budget, in bytes. Zero disables the cache.
+		**/
+		static void						setCacheBudget (const ULWord64 inMaxBytes);	//	New in SDK 17.1
+
+		/**
+			@return		The maximum amount of memory the pattern cache can use, in bytes.
+		**/
+		static ULWord64					getCacheBudget (void);	//	New in SDK 17.1
+
+		/**
+			@brief		Discards every pattern in the cache.
+		**/
+		static void						flushCache (void);	//	New in SDK 17.1
+
+		/**
+			@brief		Answers with the pattern cache statistics.
+			@param[out]	outHits		Receives the number of patterns drawn from the cache.
+			@param[out]	outMisses	Receives the number of cacheable patterns that had to be rendered.
+			@param[out]	outBytes	Receives the amount of memory the cache currently uses, in bytes.
+			@param[in]	inReset		Optionally resets the hit & miss counters after reading them. Defaults to false.
+		**/
+		static void						getCacheStats (ULWord64 & outHits, ULWord64 & outMisses, ULWord64 & outBytes, const bool inReset = false);	//	New in SDK 17.1
+		///@}
+
 	//	INSTANCE METHODS
 	public:
 		/**
@@ -178,6 +212,7 @@ class AJAExport NTV2TestPatternGen
 		inline const double &	getSliderValue (void) const				{return mSliderValue;}
 		inline bool				getAlphaFromLuma (void) const			{return mSetAlphaFromLuma;}
 		inline bool				setVANCToLegalBlack (void) const		{return mSetDstVancBlack;}	///< @return	True if DrawTestPattern will also set VANC lines (if any) to legal black.
+		inline bool				getUseCache (void) const				{return mUseCache;}	///< @return	True if DrawTestPattern uses the process-wide pattern cache.
 		///@}
 
 		/**
@@ -194,6 +229,13 @@ class AJAExport NTV2TestPatternGen
 			@return		A non-constant reference to me.
 		**/
 		inline NTV2TestPatternGen &	setVANCToLegalBlack (const bool inClearVANC)		{mSetDstVancBlack = inClearVANC; return *this;}
+		/**
+			@brief		Changes my "use the pattern cache" setting, which defaults to true.
+			@param[in]	inUseCache		Specify false to always render patterns from scratch.
+			@return		A non-constant reference to me.
+			@note		Subclasses never use the cache, as they may override the drawing methods.
+		**/
+		inline NTV2TestPatternGen &	setUseCache (const bool inUseCache)					{mUseCache = inUseCache; return *this;}	//	New in SDK 17.1
 		///@}
 
 	//	INTERNAL METHODS
@@ -221,6 +263,15 @@ class AJAExport NTV2TestPatternGen
 		bool			GetStandard (int & outStandard, bool & outIs4K, bool & outIs8K) const;
 		virtual bool	drawIt (void);
 
+		//	Band rendering -- each function draws lines [inFirstLine, inFirstLine+inNumLines), and may run concurrently:
+		typedef bool (NTV2TestPatternGen::*LineDrawer) (const ULWord inFirstLine, const ULWord inNumLines);
+		bool			drawLines (LineDrawer inDrawer, const ULWord inNumLines);	///< @brief	Runs inDrawer over bands of lines on NTV2FrameConverter::GetShared's threads
+		bool			DrawSlantRampLines (const ULWord inFirstLine, const ULWord inNumLines);
+		bool			DrawZonePlateLines (const ULWord inFirstLine, const ULWord inNumLines);
+		bool			Fill12BitRampLines (const ULWord inFirstLine, const ULWord inNumLines);
+		bool			Fill12BitZonePlateLines (const ULWord inFirstLine, const ULWord inNumLines);
+		bool			PrepareLinesForOutput (const ULWord inFirstLine, const ULWord inNumLines);
+
 	//	INSTANCE DATA
 	protected:
 		NTV2TestPatternID	mPatternID;			///< @brief	Pattern number
@@ -239,6 +290,7 @@ class AJAExport NTV2TestPatternGen
 		bool				mSetDstVancBlack;	///< @brief	Set destination VANC lines to legal black?
 		double				mSliderValue;		///< @brief	Used for Zone Plate
 		NTV2SignalMask		mSignalMask;		///< @brief	Component mask for MultiBurst, LineSweep
+		bool				mUseCache;			///< @brief	Use the process-wide pattern cache?
 
 		uint32_t			mNumPixels;
 		uint32_t			mNumLines;
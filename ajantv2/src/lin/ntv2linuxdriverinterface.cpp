@@ -11,6 +11,9 @@
 #include <fcntl.h>
 #include <sys/ioctl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
+#include <fstream>
 
 using namespace std;
 
@@ -91,6 +94,25 @@ bool CNTV2LinuxDriverInterface::OpenLocalPhysical (const UWord inDeviceIndex)
 }
 
 
+int CNTV2LinuxDriverInterface::GetNUMANode (void)
+{
+	if (!IsOpen() || IsRemote() || _hDevice == INVALID_HANDLE_VALUE)
+		return -1;
+
+	//	Go from the open character device to its PCI parent in sysfs -- this works regardless of the driver's class name
+	struct stat st;
+	if (fstat(int(_hDevice), &st) != 0  ||  !S_ISCHR(st.st_mode))
+		{LDIFAIL("fstat failed or not a char device: ndx=" << DEC(_boardNumber));  return -1;}
+	ostringstream path;  path << "/sys/dev/char/" << DEC(major(st.st_rdev)) << ":" << DEC(minor(st.st_rdev)) << "/device/numa_node";
+	ifstream ifs(path.str().c_str());
+	int node(-1);
+	if (!(ifs >> node))
+		{LDIDBG("Can't read '" << path.str() << "'");  return -1;}
+	LDIDBG("'" << path.str() << "' ndx=" << DEC(_boardNumber) << " node=" << DEC(node));
+	return node < 0 ? -1 : node;	//	The kernel reports -1 on non-NUMA hosts
+}
+
+
 bool CNTV2LinuxDriverInterface::CloseLocalPhysical (void)
 {
 	NTV2_ASSERT(!IsRemote());
@@ -124,6 +146,8 @@ bool CNTV2LinuxDriverInterface::ReadRegister (const ULWord inRegNum,  ULWord & o
 		LDIFAIL("Shift " << DEC(inShift) << " > 31, reg=" << DEC(inRegNum) << " msk=" << xHEX0N(inMask,8));
 		return false;
 	}
+	if (ShadowReadRegister(inRegNum, outValue, inMask, inShift))
+		return true;	//	Answered from shadow register cache
 #if defined(NTV2_NUB_CLIENT_SUPPORT)
 	if (IsRemote())
 		return CNTV2DriverInterface::ReadRegister (inRegNum, outValue, inMask, inShift);
@@ -135,12 +159,14 @@ bool CNTV2LinuxDriverInterface::ReadRegister (const ULWord inRegNum,  ULWord & o
 	ra.RegisterMask	  = inMask;
 	ra.RegisterShift  = inShift;
 	ra.RegisterValue  = 0xDEADBEEF;
+	const ULWord shadowGen (ShadowRegisterGeneration(inRegNum));
 	AJADebug::StatTimerStart(AJA_DebugStat_ReadRegister);
 	const int result (ioctl(int(_hDevice), IOCTL_NTV2_READ_REGISTER, &ra));
 	AJADebug::StatTimerStop(AJA_DebugStat_ReadRegister);
 	if (result)
 		{LDIFAIL("IOCTL_NTV2_READ_REGISTER failed");	return false;}
 	outValue = ra.RegisterValue;
+	ShadowStoreRegister(inRegNum, outValue, inMask, inShift, shadowGen);
 	return true;
 }
 
@@ -176,6 +202,7 @@ bool CNTV2LinuxDriverInterface::WriteRegister (const ULWord inRegNum,  const ULW
 	AJADebug::StatTimerStop(AJA_DebugStat_WriteRegister);
 	if (result)
 		{LDIFAIL("IOCTL_NTV2_WRITE_REGISTER failed");  return false;}
+	ShadowWriteRegister(inRegNum, inValue, inMask, inShift);
 	return true;
 }
 
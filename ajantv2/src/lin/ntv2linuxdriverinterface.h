@@ -35,6 +35,7 @@ class CNTV2LinuxDriverInterface : public CNTV2DriverInterface
 												{return pOutValue && ReadRegister(inRegNum, *pOutValue, inRegMask, inRegShift);}
 #endif	//	!defined(NTV2_DEPRECATE_14_3)
 
+		AJA_VIRTUAL int		GetNUMANode (void);	//	New in SDK 17.1
 		AJA_VIRTUAL bool	RestoreHardwareProcampRegisters (void);
 
 		AJA_VIRTUAL bool	DmaTransfer (const NTV2DMAEngine	inDMAEngine,
@@ -713,6 +713,8 @@ bool CNTV2MacDriverInterface::ReadRegister (const ULWord inRegNum, ULWord & outV
 		DIFAIL("Shift " << DEC(inShift) << " > 31, reg=" << DEC(inRegNum) << " msk=" << xHEX0N(inMask,8));
 		return false;
 	}
+	if (ShadowReadRegister(inRegNum, outValue, inMask, inShift))
+		return true;	//	Answered from shadow register cache
 #if defined (NTV2_NUB_CLIENT_SUPPORT)
 	if (IsRemote())
 		return CNTV2DriverInterface::ReadRegister(inRegNum, outValue, inMask, inShift);
@@ -725,6 +727,7 @@ bool CNTV2MacDriverInterface::ReadRegister (const ULWord inRegNum, ULWord & outV
 	uint64_t	scalarI_64[2] = {inRegNum, inMask};
 	uint64_t	scalarO_64 = outValue;
 	uint32_t	outputCount = 1;
+	const ULWord shadowGen (ShadowRegisterGeneration(inRegNum));
 	if (GetIOConnect())
 	{
 		AJADebug::StatTimerStart(AJA_DebugStat_ReadRegister);
@@ -738,7 +741,7 @@ bool CNTV2MacDriverInterface::ReadRegister (const ULWord inRegNum, ULWord & outV
 	}
 	outValue = uint32_t(scalarO_64);
 	if (kernResult == KERN_SUCCESS)
-		return true;
+		{ShadowStoreRegister(inRegNum, outValue, inMask, inShift, shadowGen);  return true;}
 	DIFAIL(KR(kernResult) << ": ndx=" << _boardNumber << ", con=" << HEX8(GetIOConnect())
 			<< " -- reg=" << DEC(inRegNum) << ", mask=" << HEX8(inMask) << ", shift=" << HEX8(inShift));
 	return false;
@@ -790,7 +793,7 @@ bool CNTV2MacDriverInterface::WriteRegister (const ULWord inRegNum, const ULWord
 		AJADebug::StatTimerStop(AJA_DebugStat_WriteRegister);
 	}
 	if (kernResult == KERN_SUCCESS)
-		return true;
+		{ShadowWriteRegister(inRegNum, inValue, inMask, inShift);  return true;}
 	DIFAIL (KR(kernResult) << ": con=" << HEX8(GetIOConnect()) << " -- reg=" << inRegNum
 			<< ", val=" << HEX8(inValue) << ", mask=" << HEX8(inMask) << ", shift=" << HEX8(inShift));
 	return false;
@@ -15,6 +15,10 @@
 #include "ajaanc/includes/ancillarydata_timecode_atc.h"
 #include "ajabase/common/timecode.h"
 #include "ajabase/common/common.h"
+#include "ajabase/system/systemtime.h"
+#if defined(NTV2_USE_CPLUSPLUS11)
+	#include <atomic>
+#endif
 #include <iomanip>
 #include <assert.h>
 #include <algorithm>
@@ -42,6 +46,7 @@ using namespace std;
 #define ACINFO(__x__)		AJA_sINFO	(AJA_DebugUnit_AutoCirculate,	ACTHIS << "::" << AJAFUNC << ": " << __x__)
 #define ACDBG(__x__)		AJA_sDEBUG	(AJA_DebugUnit_AutoCirculate,	ACTHIS << "::" << AJAFUNC << ": " << __x__)
 
+
 #define RCVFAIL(__x__)		AJA_sERROR	(AJA_DebugUnit_Anc2110Rcv,		ACTHIS << "::" << AJAFUNC << ": " << __x__)
 #define RCVWARN(__x__)		AJA_sWARNING(AJA_DebugUnit_Anc2110Rcv,		ACTHIS << "::" << AJAFUNC << ": " << __x__)
 #define RCVNOTE(__x__)		AJA_sNOTICE (AJA_DebugUnit_Anc2110Rcv,		ACTHIS << "::" << AJAFUNC << ": " << __x__)
@@ -59,6 +64,57 @@ static const char	gFBAllocLockName[]	=	"com.aja.ntv2.mutex.FBAlloc";
 static AJALock		gFBAllocLock(gFBAllocLockName); //	New in SDK 15:	Global mutex to avoid device frame buffer allocation race condition
 
 
+//	AutoCirculate latency histograms
+static const double	sACLatencyPercentiles[]	= {50.0, 99.0, 99.9};
+static const char *	sACLatencyPctNames[]	= {"p50", "p99", "p99.9"};
+static const ULWord	kACLatencyNumPcts		(sizeof(sACLatencyPercentiles) / sizeof(double));
+static const ULWord	kACLatencyPublishPeriod	(64);	//	Publish to AJADebug stats every this many transfers
+static const uint64_t	kACLatencyOwnerTimeout	(10 * 1000000);	//	Microseconds a silent owner keeps the latency stat keys
+
+struct NTV2ACLatencyStats
+{
+	NTV2ACLatencyStats () : fEnabled(false)		{for (int ch(0);  ch < NTV2_MAX_NUM_CHANNELS;  ch++)  ResetChannel(NTV2Channel(ch));}
+	void ResetChannel (const NTV2Channel inChannel)
+	{
+		for (int stage(0);  stage < NTV2_AC_LATENCY_NUM_STAGES;  stage++)
+			fHistograms[inChannel][stage].Reset();
+		fXfersSincePublish[inChannel] = 0;
+		ForgetLastTransfer(inChannel);
+	}
+	inline void ForgetLastTransfer (const NTV2Channel inChannel)	{AJAAutoLock tmp(&fLock);  fLastXferEnd[inChannel] = 0;}
+
+#if defined(NTV2_USE_CPLUSPLUS11)
+	std::atomic<bool>	fEnabled;												///< @brief	Recording? (read on the transfer path without the lock)
+#else
+	bool				fEnabled;												///< @brief	Recording? (guarded by fLock)
+#endif
+	AJALock				fLock;													///< @brief	Guards everything below
+	AJALatencyHistogram	fHistograms[NTV2_MAX_NUM_CHANNELS][NTV2_AC_LATENCY_NUM_STAGES];	///< @brief	Per-channel, per-stage latencies (usec)
+	uint64_t			fLastXferEnd[NTV2_MAX_NUM_CHANNELS];					///< @brief	When the last transfer ended (usec), or zero
+	ULWord				fXfersSincePublish[NTV2_MAX_NUM_CHANNELS];				///< @brief	Transfers since stats were last published
+};
+
+
+//	AutoCirculate prepared transfers
+typedef pair<ULWord64,ULWord>				NTV2ACLockedBuffer;		///< @brief	Host address & byte count of a buffer locked by AutoCirculatePrepareTransfer
+typedef vector<NTV2ACLockedBuffer>			NTV2ACLockedBuffers;
+typedef NTV2ACLockedBuffers::const_iterator	NTV2ACLockedBuffersConstIter;
+
+struct NTV2ACPreparedXfer
+{
+	NTV2ACPreparedXfer () : fPrepared(false), fCrosspoint(NTV2CROSSPOINT_INVALID)	{}
+	bool					fPrepared;			///< @brief	True if AutoCirculatePrepareTransfer was called
+	NTV2Crosspoint			fCrosspoint;		///< @brief	The channel's A/C crosspoint (fixed until AutoCirculate is stopped or re-initialized)
+	NTV2ACLockedBuffers		fLockedBuffers;		///< @brief	Host buffers I locked
+};
+
+struct NTV2ACPreparedXfers
+{
+	mutable AJALock		fLock;								///< @brief	Guards fChannels
+	NTV2ACPreparedXfer	fChannels[NTV2_MAX_NUM_CHANNELS];	///< @brief	Per-channel state
+};
+
+
 //GetFrameStamp(NTV2Crosspoint channelSpec, ULONG frameNum, FRAME_STAMP_STRUCT* pFrameStamp)
 //When a channelSpec is autocirculating, the ISR or DPC will continously fill in a
 // FRAME_STAMP_STRUCT for the frame it is working on.
@@ -230,6 +286,7 @@ bool CNTV2Card::AutoCirculateInitForInput ( const NTV2Channel		inChannel,
 		{ACFAIL("Ch" << DEC(inChannel+1) << " is illegal channel value");  return false;}	//	Must be valid channel
 	if (!inNumChannels  ||  inNumChannels > 8)
 		{ACFAIL("Input Ch" << DEC(inChannel+1) << ": illegal 'inNumChannels' value '" << DEC(inNumChannels) << "' -- must be 1-8");  return false;}	//	At least one channel
+	AutoCirculateUnprepareTransfer(inChannel);	//	Any prepared state is stale
 	if (!gFBAllocLock.IsValid())
 		{ACFAIL("Input Ch" << DEC(inChannel+1) << ": FBAllocLock mutex not ready");  return false;}	//	Mutex not ready
 
@@ -362,6 +419,7 @@ bool CNTV2Card::AutoCirculateInitForOutput (const NTV2Channel		inChannel,
 		{ACFAIL("Ch" << DEC(inChannel+1) << " is illegal channel value");  return false;}	//	Must be valid channel
 	if (!inNumChannels  ||  inNumChannels > 8)
 		{ACFAIL("Output Ch" << DEC(inChannel+1) << ": illegal 'inNumChannels' value '" << DEC(inNumChannels) << "' -- must be 1-8");  return false;}	//	At least one channel
+	AutoCirculateUnprepareTransfer(inChannel);	//	Any prepared state is stale
 	if (!gFBAllocLock.IsValid())
 		{ACFAIL("Output Ch" << DEC(inChannel+1) << ": FBAllocLock mutex not ready");  return false;}	//	Mutex not ready
 
@@ -527,6 +585,8 @@ bool CNTV2Card::AutoCirculateStop (const NTV2Channel inChannel, const bool inAbo
 	NTV2Mode				mode		(NTV2_MODE_INVALID);
 	AUTOCIRCULATE_STATUS	acStatus;
 
+	AutoCirculateUnprepareTransfer(inChannel);
+
 	//	Stop input or output A/C using the old driver call...
 	const bool	stopInputFailed		(!AutoCirculate (stopInput));
 	const bool	stopOutputFailed	(!AutoCirculate (stopOutput));
@@ -541,6 +601,10 @@ bool CNTV2Card::AutoCirculateStop (const NTV2Channel inChannel, const bool inAbo
 		return true;	//	In abort case, no more to do!
 	}
 
+	//	Don't count the idle time until the next start as host processing time...
+	if (AutoCirculateIsLatencyStatsEnabled())
+		mpACLatency->ForgetLastTransfer(inChannel);
+
 	//	Wait until driver changes AC state to DISABLED...
 	bool result (GetMode(inChannel, mode));
 	if (NTV2_IS_INPUT_MODE(mode))
@@ -700,25 +764,29 @@ bool CNTV2Card::AutoCirculateTransfer (const NTV2Channel inChannel, AUTOCIRCULAT
 		NTV2_ASSERT (inOutXferInfo.NTV2_IS_STRUCT_VALID ());
 	#endif
 
-	NTV2Crosspoint			crosspoint	(NTV2CROSSPOINT_INVALID);
-	NTV2EveryFrameTaskMode	taskMode	(NTV2_OEM_TASKS);
-	if (!GetCurrentACChannelCrosspoint (*this, inChannel, crosspoint))
-		return false;
-	if (!NTV2_IS_VALID_NTV2CROSSPOINT(crosspoint))
-		return false;
-	GetEveryFrameServices(taskMode);
+	NTV2Crosspoint	crosspoint	(NTV2CROSSPOINT_INVALID);
+	if (!ACPreparedGetCrosspoint (inChannel, crosspoint))
+	{	//	Not prepared -- ask the device...
+		if (!GetCurrentACChannelCrosspoint (*this, inChannel, crosspoint))
+			return false;
+		if (!NTV2_IS_VALID_NTV2CROSSPOINT(crosspoint))
+			return false;
+	}
 
 	if (NTV2_IS_INPUT_CROSSPOINT(crosspoint))
 		inOutXferInfo.acTransferStatus.acFrameStamp.acTimeCodes.Fill(ULWord(0xFFFFFFFF));	//	Invalidate old timecodes
 	else if (NTV2_IS_OUTPUT_CROSSPOINT(crosspoint))
 	{
-		bool isProgressive (false);
-		IsProgressiveStandard(isProgressive, inChannel);
+		const NTV2_RP188 *	pArray	(reinterpret_cast <const NTV2_RP188*>(inOutXferInfo.acOutputTimeCodes.GetHostPointer()));
+		const bool			hasDefaultTC (pArray  &&  pArray[NTV2_TCINDEX_DEFAULT].IsValid());
+		bool				isProgressive (false);
+		if (inOutXferInfo.acRP188.IsValid()  ||  hasDefaultTC)
+			IsProgressiveStandard(isProgressive, inChannel);	//	Only needed for timecode, and the format can change anytime
+
 		if (inOutXferInfo.acRP188.IsValid())
 			inOutXferInfo.SetAllOutputTimeCodes(inOutXferInfo.acRP188, /*alsoSetF2*/!isProgressive);
 
-		const NTV2_RP188 *	pArray	(reinterpret_cast <const NTV2_RP188*>(inOutXferInfo.acOutputTimeCodes.GetHostPointer()));
-		if (pArray	&&	pArray[NTV2_TCINDEX_DEFAULT].IsValid())
+		if (hasDefaultTC)
 			inOutXferInfo.SetAllOutputTimeCodes(pArray[NTV2_TCINDEX_DEFAULT], /*alsoSetF2*/!isProgressive);
 	}
 
@@ -801,7 +869,10 @@ bool CNTV2Card::AutoCirculateTransfer (const NTV2Channel inChannel, AUTOCIRCULAT
 	/////////////////////////////////////////////////////////////////////////////
 	//	Call the driver...
 	inOutXferInfo.acCrosspoint = crosspoint;
+	const uint64_t xferStartMicrosecs (AutoCirculateIsLatencyStatsEnabled() ? AJATime::GetSystemMicroseconds() : 0);
 	bool result = NTV2Message(inOutXferInfo);
+	if (result	&&	xferStartMicrosecs)
+		ACLatencyRecordTransfer(inChannel, xferStartMicrosecs, inOutXferInfo);
 	/////////////////////////////////////////////////////////////////////////////
 
 	if (result	&&	NTV2_IS_INPUT_CROSSPOINT(crosspoint))
@@ -810,6 +881,8 @@ bool CNTV2Card::AutoCirculateTransfer (const NTV2Channel inChannel, AUTOCIRCULAT
 		{	//	S2110:	decode VPID and timecode anc packets from RTP, and put into A/C Xfer and device regs
 			S2110DeviceAncFromXferBuffers(inChannel, inOutXferInfo);
 		}
+		NTV2EveryFrameTaskMode	taskMode (NTV2_OEM_TASKS);
+		GetEveryFrameServices(taskMode);	//	Read every time, the task mode can change anytime
 		if (taskMode == NTV2_STANDARD_TASKS)
 		{
 			//	After 12.? shipped, we discovered problems with timecode capture in our classic retail stuff.
@@ -930,6 +1003,297 @@ bool CNTV2Card::AutoCirculateTransfer (const NTV2Channel inChannel, AUTOCIRCULAT
 }	//	AutoCirculateTransfer
 
 
+//	AutoCirculate prepared transfers
+bool CNTV2Card::AutoCirculatePrepareTransfer (const NTV2Channel inChannel, const AUTOCIRCULATE_TRANSFER & inXferInfo, const bool inLockBuffers)
+{
+	if (!_boardOpened)
+		return false;
+	if (!NTV2_IS_VALID_CHANNEL(inChannel))
+		{ACFAIL("Ch" << DEC(inChannel+1) << " is illegal channel value");  return false;}
+
+	//	Validate the channel's A/C state, and look up its crosspoint, which can't change until A/C is stopped or re-initialized
+	//	(both of which unprepare the channel)...
+	NTV2Crosspoint			crosspoint		(NTV2CROSSPOINT_INVALID);
+	AUTOCIRCULATE_STATUS	acStatus;
+	if (!GetCurrentACChannelCrosspoint (*this, inChannel, crosspoint)  ||  !NTV2_IS_VALID_NTV2CROSSPOINT(crosspoint))
+		{ACFAIL("Ch" << DEC(inChannel+1) << ": no valid crosspoint");  return false;}
+	if (!AutoCirculateGetStatus (inChannel, acStatus)  ||  acStatus.IsStopped())
+		{ACFAIL("Ch" << DEC(inChannel+1) << ": AutoCirculate not initialized");  return false;}
+
+	//	Lock the host buffers...
+	NTV2ACLockedBuffers	buffers;
+	if (inLockBuffers)
+	{
+		const NTV2Buffer *	pBuffers[]	=	{&inXferInfo.acVideoBuffer, &inXferInfo.acAudioBuffer, &inXferInfo.acANCBuffer, &inXferInfo.acANCField2Buffer};
+		for (size_t ndx(0);  ndx < sizeof(pBuffers) / sizeof(NTV2Buffer*);  ndx++)
+		{
+			const NTV2Buffer &	buffer		(*pBuffers[ndx]);
+			ULWord				byteCount	(buffer.GetByteCount());
+			if (buffer.IsNULL())
+				continue;
+			if (ndx == 0  &&  inXferInfo.acInSegmentedDMAInfo.acNumSegments > 1)	//	Segmented video DMA:  fByteCount is the segment size
+				byteCount += (inXferInfo.acInSegmentedDMAInfo.acNumSegments - 1) * inXferInfo.acInSegmentedDMAInfo.acSegmentHostPitch;
+			buffers.push_back(NTV2ACLockedBuffer(ULWord64(buffer.GetRawHostPointer()), byteCount));
+		}
+	}
+
+	AJAAutoLock tmp(&mpACPrepared->fLock);
+	NTV2ACPreparedXfer & prepared (mpACPrepared->fChannels[inChannel]);
+	ULWord numLocked(0);
+	for (NTV2ACLockedBuffersConstIter it(buffers.begin());  it != buffers.end();  ++it)
+	{
+		if (find(prepared.fLockedBuffers.begin(), prepared.fLockedBuffers.end(), *it) != prepared.fLockedBuffers.end())
+			continue;	//	Already locked
+		if (!DMABufferLock (NTV2Buffer(reinterpret_cast<const void*>(it->first), it->second)))
+			{ACWARN("Ch" << DEC(inChannel+1) << ": failed to lock " << DEC(it->second) << "-byte host buffer " << xHEX0N(it->first,16));  continue;}
+		prepared.fLockedBuffers.push_back(*it);
+		numLocked++;
+	}
+	prepared.fCrosspoint	= crosspoint;
+	prepared.fPrepared		= true;
+	ACINFO("Prepared Ch" << DEC(inChannel+1) << " transfers, " << DEC(numLocked) << " host buffer(s) locked, "
+			<< DEC(prepared.fLockedBuffers.size()) << " total");
+	return true;
+}
+
+
+bool CNTV2Card::AutoCirculateUnprepareTransfer (const NTV2Channel inChannel)
+{
+	if (!NTV2_IS_VALID_CHANNEL(inChannel))
+	{	UWord failures(0);
+		for (int ch(0);  ch < NTV2_MAX_NUM_CHANNELS;  ch++)
+			if (!AutoCirculateUnprepareTransfer(NTV2Channel(ch)))
+				failures++;
+		return !failures;
+	}
+
+	NTV2ACLockedBuffers	buffers;
+	{
+		AJAAutoLock tmp(&mpACPrepared->fLock);
+		NTV2ACPreparedXfer & prepared (mpACPrepared->fChannels[inChannel]);
+		if (!prepared.fPrepared)
+			return true;
+		buffers.swap(prepared.fLockedBuffers);
+		prepared = NTV2ACPreparedXfer();
+	}
+	UWord failures(0);
+	if (_boardOpened)
+		for (NTV2ACLockedBuffersConstIter it(buffers.begin());  it != buffers.end();  ++it)
+			if (!DMABufferUnlock (NTV2Buffer(reinterpret_cast<const void*>(it->first), it->second)))
+				failures++;
+	ACINFO("Unprepared Ch" << DEC(inChannel+1) << " transfers, " << DEC(buffers.size() - failures) << " of " << DEC(buffers.size()) << " host buffer(s) unlocked");
+	return !failures;
+}
+
+
+bool CNTV2Card::AutoCirculateIsTransferPrepared (const NTV2Channel inChannel) const
+{
+	if (!NTV2_IS_VALID_CHANNEL(inChannel))
+		return false;
+	AJAAutoLock tmp(&mpACPrepared->fLock);
+	return mpACPrepared->fChannels[inChannel].fPrepared;
+}
+
+
+bool CNTV2Card::ACPreparedGetCrosspoint (const NTV2Channel inChannel, NTV2Crosspoint & outCrosspoint) const
+{
+	if (!NTV2_IS_VALID_CHANNEL(inChannel))
+		return false;
+	AJAAutoLock tmp(&mpACPrepared->fLock);
+	const NTV2ACPreparedXfer & prepared (mpACPrepared->fChannels[inChannel]);
+	if (!prepared.fPrepared)
+		return false;
+	outCrosspoint = prepared.fCrosspoint;
+	return true;
+}
+
+
+void CNTV2Card::ACPreparedAlloc (void)
+{	//	Called only by the constructors, before any other thread can see this instance
+	if (!mpACPrepared)
+		mpACPrepared = new NTV2ACPreparedXfers;
+}
+
+
+void CNTV2Card::ACPreparedFree (void)
+{
+	delete mpACPrepared;
+	mpACPrepared = AJA_NULL;
+}
+
+
+//	AutoCirculate latency histograms
+bool CNTV2Card::AutoCirculateSetLatencyStatsEnabled (const bool inEnable)
+{
+	AJAAutoLock tmp(&mpACLatency->fLock);
+	for (int ch(0);  ch < NTV2_MAX_NUM_CHANNELS;  ch++)
+		mpACLatency->ResetChannel(NTV2Channel(ch));
+	mpACLatency->fEnabled = inEnable;
+	ACINFO("AutoCirculate latency stats " << (inEnable ? "enabled" : "disabled"));
+	return true;
+}
+
+bool CNTV2Card::AutoCirculateIsLatencyStatsEnabled (void) const
+{
+#if !defined(NTV2_USE_CPLUSPLUS11)
+	AJAAutoLock tmp(&mpACLatency->fLock);
+#endif
+	return mpACLatency->fEnabled;
+}
+
+bool CNTV2Card::AutoCirculateGetLatencyStats (const NTV2Channel inChannel, const NTV2ACLatencyStage inStage, AJALatencyHistogram & outHistogram)
+{
+	outHistogram.Reset();
+	if (!AutoCirculateIsLatencyStatsEnabled())
+		return false;
+	if (!NTV2_IS_VALID_CHANNEL(inChannel)  ||  !NTV2_IS_VALID_AC_LATENCY_STAGE(inStage))
+		return false;
+	AJAAutoLock tmp(&mpACLatency->fLock);
+	outHistogram = mpACLatency->fHistograms[inChannel][inStage];
+	return true;
+}
+
+bool CNTV2Card::AutoCirculateResetLatencyStats (const NTV2Channel inChannel)
+{
+	if (!AutoCirculateIsLatencyStatsEnabled())
+		return false;
+	if (NTV2_IS_VALID_CHANNEL(inChannel))
+		ACLatencyResetChannel(inChannel);
+	else for (int ch(0);  ch < NTV2_MAX_NUM_CHANNELS;  ch++)
+		ACLatencyResetChannel(NTV2Channel(ch));
+	return true;
+}
+
+bool CNTV2Card::AutoCirculateRecordLatency (const NTV2Channel inChannel, const NTV2ACLatencyStage inStage, const uint64_t inMicroseconds)
+{
+	if (!AutoCirculateIsLatencyStatsEnabled())
+		return false;
+	if (!NTV2_IS_VALID_CHANNEL(inChannel)  ||  !NTV2_IS_VALID_AC_LATENCY_STAGE(inStage))
+		return false;
+	AJAAutoLock tmp(&mpACLatency->fLock);
+	mpACLatency->fHistograms[inChannel][inStage].Record(inMicroseconds);
+	return true;
+}
+
+//	All devices share the one block of latency stat keys, so they belong to one device at a time. The owner's
+//	index number is kept in AJA_DebugStat_ACLatencyDevice, so readers can tell which device the values are for.
+static bool ClaimACLatencyStats (const ULWord inDeviceIndex)
+{
+	AJADebugStat owner;
+	if (!AJADebug::StatIsAllocated(AJA_DebugStat_ACLatencyDevice))
+	{
+		if (AJA_FAILURE(AJADebug::StatAllocate(AJA_DebugStat_ACLatencyDevice)))
+			return false;
+		AJADebugStat::SetStatKeyName(int(AJA_DebugStat_ACLatencyDevice), "ACLatencyDevice");
+	}
+	else if (AJA_SUCCESS(AJADebug::StatGetInfo(AJA_DebugStat_ACLatencyDevice, owner))
+			&&  owner.fCount  &&  owner.GetCurrentValue() != inDeviceIndex)
+	{
+		if (AJATime::GetSystemMicroseconds() - owner.fLastTimeStamp < kACLatencyOwnerTimeout)
+			return false;	//	Another device is still publishing
+		//	Taking over -- drop the old owner's values so they aren't reported as mine
+		for (uint32_t key(AJA_DebugStat_ACLatencyFirst);  key < AJA_DebugStat_ACLatencyFirst + AJA_DebugStat_ACLatencyCount;  key++)
+			if (AJADebug::StatIsAllocated(key))
+				AJADebug::StatFree(key);
+	}
+	return AJA_SUCCESS(AJADebug::StatSetValue(AJA_DebugStat_ACLatencyDevice, inDeviceIndex));
+}
+
+bool CNTV2Card::AutoCirculatePublishLatencyStats (const NTV2Channel inChannel)
+{
+	if (!AutoCirculateIsLatencyStatsEnabled())
+		return false;
+	if (!AJADebug::HasStats())
+		return false;
+	if (!NTV2_IS_VALID_CHANNEL(inChannel))
+	{	UWord failures(0);
+		for (int ch(0);  ch < NTV2_MAX_NUM_CHANNELS;  ch++)
+			if (!AutoCirculatePublishLatencyStats(NTV2Channel(ch)))
+				failures++;
+		return !failures;
+	}
+	if (!ClaimACLatencyStats(GetIndexNumber()))
+		return false;
+
+	//	Snapshot the percentiles, then publish them outside the lock...
+	uint64_t values[NTV2_AC_LATENCY_NUM_STAGES][kACLatencyNumPcts];
+	uint64_t counts[NTV2_AC_LATENCY_NUM_STAGES];
+	{
+		AJAAutoLock tmp(&mpACLatency->fLock);
+		mpACLatency->fXfersSincePublish[inChannel] = 0;
+		for (int stage(0);  stage < NTV2_AC_LATENCY_NUM_STAGES;  stage++)
+		{
+			const AJALatencyHistogram & histo (mpACLatency->fHistograms[inChannel][stage]);
+			counts[stage] = histo.Entries();
+			for (ULWord pct(0);  pct < kACLatencyNumPcts;  pct++)
+				values[stage][pct] = histo.Percentile(sACLatencyPercentiles[pct]);
+		}
+	}
+	for (int stage(0);  stage < NTV2_AC_LATENCY_NUM_STAGES;  stage++)
+	{
+		if (!counts[stage])
+			continue;	//	Nothing recorded for this stage
+		for (ULWord pct(0);  pct < kACLatencyNumPcts;  pct++)
+		{
+			const uint32_t key (AJA_DebugStat_ACLatencyFirst + (ULWord(inChannel) * NTV2_AC_LATENCY_NUM_STAGES + ULWord(stage)) * kACLatencyNumPcts + pct);
+			if (!AJADebug::StatIsAllocated(key))
+			{
+				ostringstream name;
+				name << "AC" << DEC(inChannel+1) << ::NTV2ACLatencyStageToString(NTV2ACLatencyStage(stage), true) << sACLatencyPctNames[pct];
+				if (AJA_FAILURE(AJADebug::StatAllocate(key)))
+					return false;
+				AJADebugStat::SetStatKeyName(int(key), name.str());
+			}
+			AJADebug::StatSetValue(key, values[stage][pct] > 0xFFFFFFFF ? 0xFFFFFFFF : uint32_t(values[stage][pct]));
+		}
+	}
+	return true;
+}
+
+void CNTV2Card::ACLatencyRecordTransfer (const NTV2Channel inChannel, const uint64_t inStartMicroseconds, const AUTOCIRCULATE_TRANSFER & inXferInfo)
+{
+	if (!NTV2_IS_VALID_CHANNEL(inChannel))
+		return;
+	const uint64_t		endMicrosecs (AJATime::GetSystemMicroseconds());
+	const FRAME_STAMP &	stamp (inXferInfo.acTransferStatus.acFrameStamp);
+	bool				doPublish (false);
+	{
+		AJAAutoLock tmp(&mpACLatency->fLock);
+		AJALatencyHistogram * pHistos (mpACLatency->fHistograms[inChannel]);
+		pHistos[NTV2_AC_LATENCY_DMA].Record(endMicrosecs - inStartMicroseconds);
+		if (mpACLatency->fLastXferEnd[inChannel]  &&  inStartMicroseconds > mpACLatency->fLastXferEnd[inChannel])
+			pHistos[NTV2_AC_LATENCY_HOST].Record(inStartMicroseconds - mpACLatency->fLastXferEnd[inChannel]);
+		mpACLatency->fLastXferEnd[inChannel] = endMicrosecs;
+		//	Audio clock timestamps are 10MHz ticks...
+		if (stamp.acAudioClockTimeStamp  &&  stamp.acAudioClockCurrentTime > stamp.acAudioClockTimeStamp)
+			pHistos[NTV2_AC_LATENCY_FRAME_AGE].Record((stamp.acAudioClockCurrentTime - stamp.acAudioClockTimeStamp) / 10);
+		doPublish = ++mpACLatency->fXfersSincePublish[inChannel] >= kACLatencyPublishPeriod;
+	}
+	if (doPublish)
+		AutoCirculatePublishLatencyStats(inChannel);
+}
+
+void CNTV2Card::ACLatencyResetChannel (const NTV2Channel inChannel)
+{
+	if (!NTV2_IS_VALID_CHANNEL(inChannel))
+		return;
+	AJAAutoLock tmp(&mpACLatency->fLock);
+	mpACLatency->ResetChannel(inChannel);
+}
+
+void CNTV2Card::ACLatencyAlloc (void)
+{	//	Called only by the constructors, before any other thread can see this instance
+	if (!mpACLatency)
+		mpACLatency = new NTV2ACLatencyStats;
+}
+
+void CNTV2Card::ACLatencyFree (void)
+{
+	delete mpACLatency;
+	mpACLatency = AJA_NULL;
+}
+
+
 static const AJA_FrameRate	sNTV2Rate2AJARate[] = { AJA_FrameRate_Unknown	//	NTV2_FRAMERATE_UNKNOWN	= 0,
 													,AJA_FrameRate_6000		//	NTV2_FRAMERATE_6000		= 1,
 													,AJA_FrameRate_5994		//	NTV2_FRAMERATE_5994		= 2,
@@ -0,0 +1,392 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		ntv2bufferpool.cpp
+	@brief		Implements the NTV2BufferPool class.
+	@copyright	(C) 2023 AJA Video Systems, Inc.
+**/
+#include "ntv2bufferpool.h"
+#include "ntv2card.h"
+#include "ajabase/system/debug.h"
+#include "ajabase/system/lock.h"
+#include "ajabase/system/memory.h"
+#if defined(NTV2_USE_CPLUSPLUS11)
+	#include <atomic>
+#endif
+#if defined(AJALinux) || defined(AJAMac)
+	#include <sys/mman.h>
+#endif
+#include <string.h>
+#include <vector>
+
+using namespace std;
+
+#define INSTP(_p_)		xHEX0N(uint64_t(_p_),16)
+#define BPFAIL(__x__)	AJA_sERROR	(AJA_DebugUnit_DriverInterface, INSTP(this) << "::" << AJAFUNC << ": " << __x__)
+#define BPWARN(__x__)	AJA_sWARNING(AJA_DebugUnit_DriverInterface, INSTP(this) << "::" << AJAFUNC << ": " << __x__)
+#define BPINFO(__x__)	AJA_sINFO	(AJA_DebugUnit_DriverInterface, INSTP(this) << "::" << AJAFUNC << ": " << __x__)
+
+#if defined(AJALinux)
+	#if !defined(MAP_HUGE_SHIFT)
+		#define MAP_HUGE_SHIFT	26
+	#endif
+	#define NTV2_MAP_HUGE_2MB	(21 << MAP_HUGE_SHIFT)
+	#define NTV2_MAP_HUGE_1GB	(30 << MAP_HUGE_SHIFT)
+#endif
+
+static const ULWord64	k2MB	(ULWord64(2) << 20);
+static const ULWord64	k1GB	(ULWord64(1) << 30);
+
+
+//	Returns the index of the only bit set in the given word
+static inline ULWord BitIndex (const uint64_t inBit)
+{
+#if defined(__GNUC__)
+	return ULWord(__builtin_ctzll(inBit));
+#else
+	ULWord ndx(0);
+	for (uint64_t bit(inBit);  !(bit & 1);  bit >>= 1)
+		ndx++;
+	return ndx;
+#endif
+}
+
+static inline ULWord BitCount (uint64_t inBits)
+{
+	ULWord count(0);
+	for (;  inBits;  inBits &= inBits - 1)
+		count++;
+	return count;
+}
+
+
+/**
+	@brief	One bit per buffer, set while the buffer is free. With C++11, buffers are claimed and returned
+			with atomic compare-exchange and fetch-or on 64-bit words, so Acquire and Release never block.
+**/
+struct NTV2BufferPoolFreeList
+{
+	explicit NTV2BufferPoolFreeList (const ULWord inNumBuffers)
+		:	mWords ((inNumBuffers + 63) / 64)
+	{
+		for (size_t ndx(0);  ndx < mWords.size();  ndx++)
+		{
+			const ULWord bitsInWord (ndx + 1 < mWords.size()  ||  !(inNumBuffers % 64)  ?  64  :  inNumBuffers % 64);
+			const uint64_t bits (bitsInWord == 64  ?  ~uint64_t(0)  :  (uint64_t(1) << bitsInWord) - 1);
+#if defined(NTV2_USE_CPLUSPLUS11)
+			mWords[ndx].store(bits, std::memory_order_relaxed);
+#else
+			mWords[ndx] = bits;
+#endif
+		}
+	}
+
+	//	Returns the index of a buffer that was free and is now claimed, or -1 if none are free
+	int Claim (void)
+	{
+#if defined(NTV2_USE_CPLUSPLUS11)
+		for (size_t ndx(0);  ndx < mWords.size();  ndx++)
+		{
+			uint64_t bits (mWords[ndx].load(std::memory_order_relaxed));
+			while (bits)
+			{
+				const uint64_t lowest (bits & (~bits + 1));
+				if (mWords[ndx].compare_exchange_weak(bits, bits & ~lowest, std::memory_order_acquire, std::memory_order_relaxed))
+					return int(ndx * 64 + BitIndex(lowest));
+			}	//	else 'bits' was reloaded -- try again with what's left
+		}
+#else
+		AJAAutoLock autoLock(&mLock);
+		for (size_t ndx(0);  ndx < mWords.size();  ndx++)
+			if (mWords[ndx])
+			{
+				const uint64_t lowest (mWords[ndx] & (~mWords[ndx] + 1));
+				mWords[ndx] &= ~lowest;
+				return int(ndx * 64 + BitIndex(lowest));
+			}
+#endif
+		return -1;
+	}
+
+	//	Frees the given buffer, returning false if it was already free
+	bool Return (const ULWord inIndex)
+	{
+		const uint64_t bit (uint64_t(1) << (inIndex % 64));
+#if defined(NTV2_USE_CPLUSPLUS11)
+		return !(mWords[inIndex / 64].fetch_or(bit, std::memory_order_release) & bit);
+#else
+		AJAAutoLock autoLock(&mLock);
+		const bool wasInUse (!(mWords[inIndex / 64] & bit));
+		mWords[inIndex / 64] |= bit;
+		return wasInUse;
+#endif
+	}
+
+	ULWord NumFree (void) const
+	{
+		ULWord count(0);
+		for (size_t ndx(0);  ndx < mWords.size();  ndx++)
+#if defined(NTV2_USE_CPLUSPLUS11)
+			count += BitCount(mWords[ndx].load(std::memory_order_relaxed));
+#else
+			count += BitCount(mWords[ndx]);
+#endif
+		return count;
+	}
+
+#if defined(NTV2_USE_CPLUSPLUS11)
+	std::vector<std::atomic<uint64_t> >	mWords;
+#else
+	std::vector<uint64_t>	mWords;
+	AJALock					mLock;
+#endif
+};	//	NTV2BufferPoolFreeList
+
+
+#if defined(AJALinux) || defined(AJAMac)
+//	Maps an anonymous region backed by the given kind of page, returning NULL if the host can't supply them.
+//	On success, ioByteCount is rounded up to the page size.
+static void * MapRegion (ULWord64 & ioByteCount, const NTV2PoolPageKind inPageKind)
+{
+	const ULWord64 pageSize (NTV2BufferPool::GetPageSize(inPageKind));
+	const ULWord64 byteCount ((ioByteCount + pageSize - 1) / pageSize * pageSize);
+	int flags (MAP_PRIVATE | MAP_ANONYMOUS);
+	switch (inPageKind)
+	{
+	#if defined(AJALinux)
+		case NTV2_POOLPAGES_1GB:	flags |= MAP_HUGETLB | NTV2_MAP_HUGE_1GB;	break;
+		case NTV2_POOLPAGES_2MB:	flags |= MAP_HUGETLB | NTV2_MAP_HUGE_2MB;	break;
+		case NTV2_POOLPAGES_TRANSPARENT:
+		{	//	Over-map, then trim to a 2MB boundary, so the kernel can back the region with whole huge pages
+			void * pMap (mmap(AJA_NULL, size_t(byteCount + k2MB), PROT_READ | PROT_WRITE, flags, -1, 0));
+			if (pMap == MAP_FAILED)
+				return AJA_NULL;
+			UByte * pStart (reinterpret_cast<UByte*>((uintptr_t(pMap) + k2MB - 1) & ~uintptr_t(k2MB - 1)));
+			const size_t headBytes (size_t(pStart - reinterpret_cast<UByte*>(pMap)));
+			if (headBytes)
+				munmap(pMap, headBytes);
+			if (k2MB - headBytes)
+				munmap(pStart + byteCount, size_t(k2MB - headBytes));
+			if (madvise(pStart, size_t(byteCount), MADV_HUGEPAGE) != 0)
+			{	//	Kernel without THP (or THP disabled) -- keep the region as ordinary pages
+				munmap(pStart, size_t(byteCount));
+				return AJA_NULL;
+			}
+			ioByteCount = byteCount;
+			return pStart;
+		}
+	#endif	//	AJALinux
+		case NTV2_POOLPAGES_SMALL:	break;
+		default:					return AJA_NULL;
+	}
+	void * pMap (mmap(AJA_NULL, size_t(byteCount), PROT_READ | PROT_WRITE, flags, -1, 0));
+	if (pMap == MAP_FAILED)
+		return AJA_NULL;
+	ioByteCount = byteCount;
+	return pMap;
+}
+#endif	//	AJALinux or AJAMac
+
+
+ULWord NTV2BufferPool::GetPageSize (const NTV2PoolPageKind inPageKind)
+{
+	switch (inPageKind)
+	{
+		case NTV2_POOLPAGES_SMALL:			return ULWord(AJA_PAGE_SIZE);
+		case NTV2_POOLPAGES_TRANSPARENT:	return ULWord(k2MB);
+		case NTV2_POOLPAGES_2MB:			return ULWord(k2MB);
+		case NTV2_POOLPAGES_1GB:			return ULWord(k1GB);
+		default:							break;
+	}
+	return 0;
+}
+
+
+string NTV2BufferPool::PageKindToString (const NTV2PoolPageKind inPageKind)
+{
+	switch (inPageKind)
+	{
+		case NTV2_POOLPAGES_SMALL:			return "small pages";
+		case NTV2_POOLPAGES_TRANSPARENT:	return "transparent huge pages";
+		case NTV2_POOLPAGES_2MB:			return "2MB huge pages";
+		case NTV2_POOLPAGES_1GB:			return "1GB huge pages";
+		default:							break;
+	}
+	return "";
+}
+
+
+NTV2BufferPool::NTV2BufferPool ()
+	:	mpRegion			(AJA_NULL),
+		mRegionByteCount	(0),
+		mNumBuffers			(0),
+		mBufferByteCount	(0),
+		mSlotByteCount		(0),
+		mPageKind			(NTV2_POOLPAGES_INVALID),
+		mMapped				(false),
+		mpLockDevice		(AJA_NULL),
+		mpFreeList			(AJA_NULL)
+{
+}
+
+
+NTV2BufferPool::~NTV2BufferPool ()
+{
+	Deallocate();
+}
+
+
+bool NTV2BufferPool::Allocate (const ULWord inNumBuffers, const ULWord inBufferByteCount,
+								const NTV2PoolPageKind inLargestPageKind, const int inNUMANode)
+{
+	Deallocate();
+	if (!inNumBuffers  ||  !inBufferByteCount)
+		{BPFAIL("Zero buffers (" << DEC(inNumBuffers) << ") or zero buffer size (" << DEC(inBufferByteCount) << ")");  return false;}
+	if (!NTV2_IS_VALID_POOLPAGES(inLargestPageKind))
+		{BPFAIL("Bad page kind " << DEC(inLargestPageKind));  return false;}
+
+	const ULWord64 pageSize (NTV2Buffer::DefaultPageSize());
+	const ULWord64 slotByteCount ((ULWord64(inBufferByteCount) + pageSize - 1) / pageSize * pageSize);
+	if (slotByteCount > 0xFFFFFFFF)
+		{BPFAIL("Buffer size " << DEC(inBufferByteCount) << " too large");  return false;}
+	ULWord64 regionByteCount (slotByteCount * inNumBuffers);
+
+#if defined(AJALinux) || defined(AJAMac)
+	//	Try the largest page kind first, falling back to smaller ones
+	for (int kind(inLargestPageKind);  kind >= NTV2_POOLPAGES_SMALL  &&  !mpRegion;  kind--)
+	{
+		if (kind == NTV2_POOLPAGES_1GB  &&  regionByteCount < k1GB)
+			continue;	//	Don't waste most of a 1GB page
+		ULWord64 byteCount (regionByteCount);
+		mpRegion = reinterpret_cast<UByte*>(MapRegion(byteCount, NTV2PoolPageKind(kind)));
+		if (mpRegion)
+		{
+			regionByteCount = byteCount;
+			mPageKind = NTV2PoolPageKind(kind);
+			mMapped = true;
+		}
+	}
+	//	Prefer the device's node before the pages are first touched (by the zeroing below)
+	if (mpRegion  &&  inNUMANode >= 0)
+		if (!AJAMemory::BindToNUMANode(mpRegion, size_t(regionByteCount), inNUMANode))
+			BPWARN("Can't prefer NUMA node " << DEC(inNUMANode));
+#endif	//	AJALinux or AJAMac
+	if (!mpRegion)
+	{	//	No mmap (or even small-page mmap failed) -- use the aligned heap
+		mpRegion = reinterpret_cast<UByte*>(AJAMemory::AllocateAlignedOnNode(size_t(regionByteCount), size_t(pageSize), inNUMANode));
+		mPageKind = NTV2_POOLPAGES_SMALL;
+		mMapped = false;
+	}
+	if (!mpRegion)
+	{
+		BPFAIL("Failed to allocate " << DEC(inNumBuffers) << " x " << DEC(inBufferByteCount) << " bytes");
+		mPageKind = NTV2_POOLPAGES_INVALID;
+		return false;
+	}
+
+	::memset(mpRegion, 0, size_t(regionByteCount));	//	Fault in every page now, not during the first DMA
+	mRegionByteCount = regionByteCount;
+	mNumBuffers = inNumBuffers;
+	mBufferByteCount = inBufferByteCount;
+	mSlotByteCount = ULWord(slotByteCount);
+	mpFreeList = new NTV2BufferPoolFreeList(inNumBuffers);
+	BPINFO(DEC(mNumBuffers) << " x " << DEC(mBufferByteCount) << " bytes at " << INSTP(mpRegion)
+			<< " in " << PageKindToString(mPageKind) << ", region " << DEC(mRegionByteCount) << " bytes");
+	return true;
+}
+
+
+bool NTV2BufferPool::Lock (CNTV2Card & inDevice, const bool inMap)
+{
+	if (!IsAllocated())
+		{BPFAIL("No buffers");  return false;}
+	if (mpLockDevice == &inDevice)
+		return true;	//	Already locked
+	Unlock();
+	if (!inDevice.IsOpen())
+		{BPFAIL("Device not open");  return false;}
+
+	NTV2Buffer buffer;
+	for (ULWord ndx(0);  ndx < mNumBuffers;  ndx++)
+		if (!GetBuffer(ndx, buffer)  ||  !inDevice.DMABufferLock(buffer, inMap))
+		{
+			BPFAIL("DMABufferLock failed for buffer " << DEC(ndx) << " of " << DEC(mNumBuffers));
+			while (ndx--)
+				if (GetBuffer(ndx, buffer))
+					inDevice.DMABufferUnlock(buffer);
+			return false;
+		}
+	mpLockDevice = &inDevice;
+	return true;
+}
+
+
+void NTV2BufferPool::Unlock (void)
+{
+	if (!mpLockDevice)
+		return;
+	NTV2Buffer buffer;
+	if (mpLockDevice->IsOpen())
+		for (ULWord ndx(0);  ndx < mNumBuffers;  ndx++)
+			if (GetBuffer(ndx, buffer))
+				mpLockDevice->DMABufferUnlock(buffer);
+	mpLockDevice = AJA_NULL;
+}
+
+
+void NTV2BufferPool::Deallocate (void)
+{
+	Unlock();
+	if (mpRegion)
+	{
+#if defined(AJALinux) || defined(AJAMac)
+		if (mMapped)
+			munmap(mpRegion, size_t(mRegionByteCount));
+		else
+#endif
+			AJAMemory::FreeAligned(mpRegion);
+	}
+	delete mpFreeList;
+	mpFreeList = AJA_NULL;
+	mpRegion = AJA_NULL;
+	mRegionByteCount = 0;
+	mNumBuffers = mBufferByteCount = mSlotByteCount = 0;
+	mPageKind = NTV2_POOLPAGES_INVALID;
+	mMapped = false;
+}
+
+
+bool NTV2BufferPool::Acquire (NTV2Buffer & outBuffer)
+{
+	const int ndx (mpFreeList ? mpFreeList->Claim() : -1);
+	if (ndx < 0)
+		return false;
+	return outBuffer.Set(mpRegion + ULWord64(ndx) * mSlotByteCount, mBufferByteCount);
+}
+
+
+bool NTV2BufferPool::Release (const NTV2Buffer & inBuffer)
+{
+	const UByte * pBuffer (reinterpret_cast<const UByte*>(inBuffer.GetHostPointer()));
+	if (!mpFreeList  ||  pBuffer < mpRegion)
+		return false;
+	const ULWord64 offset (ULWord64(pBuffer - mpRegion));
+	if (offset % mSlotByteCount  ||  offset / mSlotByteCount >= mNumBuffers)
+		{BPFAIL("Buffer " << INSTP(pBuffer) << " isn't one of mine");  return false;}
+	if (!mpFreeList->Return(ULWord(offset / mSlotByteCount)))
+		{BPWARN("Buffer " << DEC(offset / mSlotByteCount) << " already free");  return false;}
+	return true;
+}
+
+
+bool NTV2BufferPool::GetBuffer (const ULWord inIndex, NTV2Buffer & outBuffer) const
+{
+	if (!mpRegion  ||  inIndex >= mNumBuffers)
+		return false;
+	return outBuffer.Set(mpRegion + ULWord64(inIndex) * mSlotByteCount, mBufferByteCount);
+}
+
+
+ULWord NTV2BufferPool::GetNumAvailable (void) const
+{
+	return mpFreeList ? mpFreeList->NumFree() : 0;
+}
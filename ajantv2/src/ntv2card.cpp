@@ -17,17 +17,25 @@ using namespace std;
 
 // Default Constructor
 CNTV2Card::CNTV2Card ()
-	:	mDevCap(*(reinterpret_cast<CNTV2DriverInterface*>(this)))
+	:	mDevCap(*(reinterpret_cast<CNTV2DriverInterface*>(this))),
+		mpACLatency(AJA_NULL),
+		mpACPrepared(AJA_NULL)
 {
 	_boardOpened = false;
+	ACLatencyAlloc();
+	ACPreparedAlloc();
 }
 
 CNTV2Card::CNTV2Card (const UWord inDeviceIndex, const string & inHostName)
-	:	mDevCap(*(reinterpret_cast<CNTV2DriverInterface*>(this)))
+	:	mDevCap(*(reinterpret_cast<CNTV2DriverInterface*>(this))),
+		mpACLatency(AJA_NULL),
+		mpACPrepared(AJA_NULL)
 {
 	string hostName(inHostName);
 	aja::strip(hostName);
 	_boardOpened = false;
+	ACLatencyAlloc();
+	ACPreparedAlloc();
 	bool openOK = hostName.empty()	?  CNTV2DriverInterface::Open(inDeviceIndex) :	CNTV2DriverInterface::Open(hostName);
 	if (openOK)
 	{
@@ -55,7 +63,12 @@ CNTV2Card::CNTV2Card (const UWord inDeviceIndex, const string & inHostName)
 CNTV2Card::~CNTV2Card ()
 {
 	if (IsOpen ())
+	{
+		AutoCirculateUnprepareTransfer();
 		Close ();
+	}
+	ACLatencyFree();
+	ACPreparedFree();
 
 }	//	destructor
 
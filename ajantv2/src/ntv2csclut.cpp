@@ -10,6 +10,7 @@
 #include "ntv2utils.h"
 #include "ntv2registerexpert.h"
 #include "ajabase/system/debug.h"
+#include "ajabase/system/systemtime.h"
 #include <math.h>
 #include <assert.h>
 #if defined (AJALinux)
@@ -689,6 +690,52 @@ static const NTV2ColorCorrectionHostAccessBank	gLUTBank0[] =
 static const size_t kLUTArraySize (NTV2_COLORCORRECTOR_WORDSPERTABLE * 2);
 static const size_t k12BitLUTArraySize (NTV2_12BIT_COLORCORRECTOR_WORDSPERTABLE * 2);
 
+//	The Linux driver rejects any SETREGS message bigger than one page (4KB on most hosts), so LUT downloads are
+//	sent as a series of page-sized batches. Each batch starts with the plane select (if any), so it never
+//	depends on which plane an earlier batch left selected.
+static const size_t kMaxLUTRegsPerBatch (4096 / sizeof(NTV2RegInfo));
+
+class LUTBatcher
+{
+	public:
+		explicit LUTBatcher (const size_t inNumRegs)
+			:	mHasSelect(false)
+		{
+			mBatches.reserve(inNumRegs / (kMaxLUTRegsPerBatch - 1) + 4);
+		}
+		void	StartPlane (void)								{mHasSelect = false;  NewBatch();}
+		void	StartPlane (const NTV2RegInfo & inPlaneSelect)	{mSelect = inPlaneSelect;  mHasSelect = true;  NewBatch();}
+		void	Add (const NTV2RegInfo & inRegWrite)
+		{
+			if (mBatches.back().size() >= kMaxLUTRegsPerBatch)
+				NewBatch();
+			mBatches.back().push_back(inRegWrite);
+		}
+		bool	WriteTo (CNTV2Card & inDevice, size_t & outNumRegs, size_t & outNumFailedBatches) const
+		{
+			outNumRegs = outNumFailedBatches = 0;
+			for (size_t ndx(0);  ndx < mBatches.size();  ndx++)
+			{
+				outNumRegs += mBatches.at(ndx).size();
+				if (!inDevice.WriteRegisters(mBatches.at(ndx)))
+					outNumFailedBatches++;
+			}
+			return outNumFailedBatches == 0;
+		}
+		inline size_t	GetNumBatches (void) const	{return mBatches.size();}
+	private:
+		void	NewBatch (void)
+		{
+			mBatches.push_back(NTV2RegisterWrites());
+			mBatches.back().reserve(kMaxLUTRegsPerBatch);
+			if (mHasSelect)
+				mBatches.back().push_back(mSelect);
+		}
+		vector<NTV2RegisterWrites>	mBatches;
+		NTV2RegInfo					mSelect;
+		bool						mHasSelect;
+};	//	LUTBatcher
+
 
 
 // this allows for three 1024-entry LUTs that we're going to download to all four channels
@@ -847,84 +894,52 @@ bool CNTV2Card::WriteLUTTables (const UWordSequence & inRedLUT, const UWordSeque
 	if (inRedLUT.size() < kLUTArraySize	 ||	 inGreenLUT.size() < kLUTArraySize	||	inBlueLUT.size() < kLUTArraySize)
 		{LUTFAIL("Size error (< 1024): R=" << DEC(inRedLUT.size()) << " G=" << DEC(inGreenLUT.size()) << " B=" << DEC(inBlueLUT.size())); return false;}
 
-	size_t	errorCount(0), nonzeroes(0);
-	ULWord	RTableReg = (Has12BitLUTSupport() ? kColorCorrection12BitLUTOffset_Base : kColorCorrectionLUTOffset_Red) / 4;	//	Byte offset to LUT in register bar;	 divide by sizeof (ULWord) to get register number
-	ULWord	GTableReg = (Has12BitLUTSupport() ? kColorCorrection12BitLUTOffset_Base : kColorCorrectionLUTOffset_Green) / 4;
-	ULWord	BTableReg = (Has12BitLUTSupport() ? kColorCorrection12BitLUTOffset_Base : kColorCorrectionLUTOffset_Blue) / 4;
+	//	Build the table download as a few page-sized SETREGS batches...
+	const uint64_t		startMicrosecs	(AJATime::GetSystemMicroseconds());
+	const bool			is12BitLUT		(Has12BitLUTSupport());
+	const UWordSequence * pLUTs[3]		= {&inRedLUT, &inGreenLUT, &inBlueLUT};
+	static const NTV2LUTPlaneSelect	sPlanes[3]		= {NTV2_REDPLANE, NTV2_GREENPLANE, NTV2_BLUEPLANE};
+	static const ULWord				sTableRegs[3]	= {kColorCorrectionLUTOffset_Red / 4, kColorCorrectionLUTOffset_Green / 4, kColorCorrectionLUTOffset_Blue / 4};	//	Byte offset to LUT in register bar;	 divide by sizeof (ULWord) to get register number
+	size_t				nonzeroes		(0);
+	LUTBatcher			regWrites		(3 * (is12BitLUT ? 4 * NTV2_COLORCORRECTOR_WORDSPERTABLE : NTV2_COLORCORRECTOR_WORDSPERTABLE));
 
-	for (size_t ndx(0);	 ndx < NTV2_COLORCORRECTOR_WORDSPERTABLE;  ndx++)
+	for (size_t plane(0);  plane < 3;  plane++)
 	{
-		ULWord	loRed(ULWord(inRedLUT[2 * ndx + 0]) & 0x3FF);
-		ULWord	hiRed(ULWord(inRedLUT[2 * ndx + 1]) & 0x3FF);
-
-		ULWord	loGreen = ULWord(inGreenLUT[2 * ndx + 0]) & 0x3FF;
-		ULWord	hiGreen = ULWord(inGreenLUT[2 * ndx + 1]) & 0x3FF;
-
-		ULWord	loBlue = ULWord(inBlueLUT[2 * ndx + 0]) & 0x3FF;
-		ULWord	hiBlue = ULWord(inBlueLUT[2 * ndx + 1]) & 0x3FF;
-		
-		if(!Has12BitLUTSupport())
-		{
-			ULWord	tmpRed((hiRed << kRegColorCorrectionLUTOddShift) + (loRed << kRegColorCorrectionLUTEvenShift));
-			if (tmpRed) nonzeroes++;
-			if (!WriteRegister(RTableReg++, tmpRed))
-				errorCount++;
-			
-			ULWord	tmpGreen = (hiGreen << kRegColorCorrectionLUTOddShift) + (loGreen << kRegColorCorrectionLUTEvenShift);
-			if (tmpGreen) nonzeroes++;
-			if (!WriteRegister(GTableReg++, tmpGreen))
-				errorCount++;
-			
-			ULWord	tmpBlue = (hiBlue << kRegColorCorrectionLUTOddShift) + (loBlue << kRegColorCorrectionLUTEvenShift);
-			if (tmpBlue) nonzeroes++;
-			if (!WriteRegister(BTableReg++, tmpBlue))
-				errorCount++;
-		}
+		const UWordSequence &	lut			(*pLUTs[plane]);
+		ULWord					tableReg	(is12BitLUT ? kColorCorrection12BitLUTOffset_Base / 4 : sTableRegs[plane]);
+		if (is12BitLUT)		//	Each plane's writes are grouped, so the plane select is only written at the start of each batch
+			regWrites.StartPlane(NTV2RegInfo(kRegLUTV2Control, sPlanes[plane], kRegMask12BitLUTPlaneSelect, kRegShift12BitLUTPlaneSelect));
 		else
+			regWrites.StartPlane();
+		for (size_t ndx(0);	 ndx < NTV2_COLORCORRECTOR_WORDSPERTABLE;  ndx++)
 		{
-			ULWord	tmpRedLo((loRed << kRegColorCorrection10To12BitLUTOddShift) + (loRed << kRegColorCorrection10To12BitLUTEvenShift));
-			ULWord	tmpRedHi((hiRed << kRegColorCorrection10To12BitLUTOddShift) + (hiRed << kRegColorCorrection10To12BitLUTEvenShift));
-			if(tmpRedLo || tmpRedHi) nonzeroes++;
-			Set12BitLUTPlaneSelect(NTV2_REDPLANE);
-			if (!WriteRegister(RTableReg++, tmpRedLo))
-				errorCount++;
-			if (!WriteRegister(RTableReg++, tmpRedLo))
-				errorCount++;
-			if (!WriteRegister(RTableReg++, tmpRedHi))
-				errorCount++;
-			if (!WriteRegister(RTableReg++, tmpRedHi))
-				errorCount++;
-			
-			ULWord	tmpGreenLo((loGreen << kRegColorCorrection10To12BitLUTOddShift) + (loGreen << kRegColorCorrection10To12BitLUTEvenShift));
-			ULWord	tmpGreenHi((hiGreen << kRegColorCorrection10To12BitLUTOddShift) + (hiGreen << kRegColorCorrection10To12BitLUTEvenShift));
-			if(tmpGreenLo || tmpGreenHi) nonzeroes++;
-			Set12BitLUTPlaneSelect(NTV2_GREENPLANE);
-			if (!WriteRegister(GTableReg++, tmpGreenLo))
-				errorCount++;
-			if (!WriteRegister(GTableReg++, tmpGreenLo))
-				errorCount++;
-			if (!WriteRegister(GTableReg++, tmpGreenHi))
-				errorCount++;
-			if (!WriteRegister(GTableReg++, tmpGreenHi))
-				errorCount++;
-			
-			ULWord	tmpBlueLo((loBlue << kRegColorCorrection10To12BitLUTOddShift) + (loBlue << kRegColorCorrection10To12BitLUTEvenShift));
-			ULWord	tmpBlueHi((hiBlue << kRegColorCorrection10To12BitLUTOddShift) + (hiBlue << kRegColorCorrection10To12BitLUTEvenShift));
-			if(tmpBlueLo || tmpBlueHi) nonzeroes++;
-			Set12BitLUTPlaneSelect(NTV2_BLUEPLANE);
-			if (!WriteRegister(BTableReg++, tmpBlueLo))
-				errorCount++;
-			if (!WriteRegister(BTableReg++, tmpBlueLo))
-				errorCount++;
-			if (!WriteRegister(BTableReg++, tmpBlueHi))
-				errorCount++;
-			if (!WriteRegister(BTableReg++, tmpBlueHi))
-				errorCount++;
+			const ULWord	lo(ULWord(lut[2 * ndx + 0]) & 0x3FF);
+			const ULWord	hi(ULWord(lut[2 * ndx + 1]) & 0x3FF);
+			if (!is12BitLUT)
+			{
+				const ULWord	tmp((hi << kRegColorCorrectionLUTOddShift) + (lo << kRegColorCorrectionLUTEvenShift));
+				if (tmp) nonzeroes++;
+				regWrites.Add(NTV2RegInfo(tableReg++, tmp));
+			}
+			else
+			{
+				const ULWord	tmpLo((lo << kRegColorCorrection10To12BitLUTOddShift) + (lo << kRegColorCorrection10To12BitLUTEvenShift));
+				const ULWord	tmpHi((hi << kRegColorCorrection10To12BitLUTOddShift) + (hi << kRegColorCorrection10To12BitLUTEvenShift));
+				if (tmpLo || tmpHi) nonzeroes++;
+				regWrites.Add(NTV2RegInfo(tableReg++, tmpLo));
+				regWrites.Add(NTV2RegInfo(tableReg++, tmpLo));
+				regWrites.Add(NTV2RegInfo(tableReg++, tmpHi));
+				regWrites.Add(NTV2RegInfo(tableReg++, tmpHi));
+			}
 		}
 	}
-	if (errorCount) LUTFAIL(GetDisplayName() << " " << DEC(errorCount) << " WriteRegister calls failed");
+
+	size_t numRegs(0), numFailedBatches(0);
+	const bool result (regWrites.WriteTo(*this, numRegs, numFailedBatches));
+	if (!result) LUTFAIL(GetDisplayName() << " WriteRegisters failed for " << DEC(numFailedBatches) << " of " << DEC(regWrites.GetNumBatches()) << " LUT register batch(es)");
 	else if (!nonzeroes) LUTWARN(GetDisplayName() << " All zero LUT table values!");
-	return !errorCount;
+	LUTDBG(GetDisplayName() << " " << DEC(numRegs) << " LUT register(s) written in " << DEC(regWrites.GetNumBatches()) << " batch(es) in " << DEC(AJATime::GetSystemMicroseconds() - startMicrosecs) << "us");
+	return result;
 }
 
 bool CNTV2Card::Write12BitLUTTables (const UWordSequence & inRedLUT, const UWordSequence & inGreenLUT, const UWordSequence & inBlueLUT)
@@ -934,51 +949,35 @@ bool CNTV2Card::Write12BitLUTTables (const UWordSequence & inRedLUT, const UWord
 
 	if (!Has12BitLUTSupport())
 		return false;
-	
-	size_t	errorCount(0), nonzeroes(0);
-	ULWord	RTableReg(kColorCorrection12BitLUTOffset_Base / 4); //	Byte offset to LUT in register bar;	 divide by sizeof (ULWord) to get register number
-	ULWord	GTableReg(kColorCorrection12BitLUTOffset_Base / 4);
-	ULWord	BTableReg(kColorCorrection12BitLUTOffset_Base / 4);
 
-	Set12BitLUTPlaneSelect(NTV2_REDPLANE);
-	for (size_t ndx(0);	 ndx < NTV2_12BIT_COLORCORRECTOR_WORDSPERTABLE;	 ndx++)
-	{
-		ULWord	loRed(ULWord(inRedLUT[2 * ndx + 0]) & 0xFFF);
-		ULWord	hiRed(ULWord(inRedLUT[2 * ndx + 1]) & 0xFFF);
+	//	Build the table download as a few page-sized SETREGS batches...
+	const uint64_t		startMicrosecs	(AJATime::GetSystemMicroseconds());
+	const UWordSequence * pLUTs[3]		= {&inRedLUT, &inGreenLUT, &inBlueLUT};
+	static const NTV2LUTPlaneSelect	sPlanes[3]	= {NTV2_REDPLANE, NTV2_GREENPLANE, NTV2_BLUEPLANE};
+	size_t				nonzeroes		(0);
+	LUTBatcher			regWrites		(3 * NTV2_12BIT_COLORCORRECTOR_WORDSPERTABLE);
 
-		ULWord	tmpRed((hiRed << kRegColorCorrection12BitLUTOddShift) + (loRed << kRegColorCorrection12BitLUTEvenShift));
-		if (tmpRed) nonzeroes++;
-		if (!WriteRegister(RTableReg++, tmpRed))
-			errorCount++;
-	}
-	
-	Set12BitLUTPlaneSelect(NTV2_GREENPLANE);
-	for (size_t ndx(0);	 ndx < NTV2_12BIT_COLORCORRECTOR_WORDSPERTABLE;	 ndx++)
+	for (size_t plane(0);  plane < 3;  plane++)
 	{
-		ULWord	loGreen = ULWord(inGreenLUT[2 * ndx + 0]) & 0xFFF;
-		ULWord	hiGreen = ULWord(inGreenLUT[2 * ndx + 1]) & 0xFFF;
-		
-		ULWord	tmpGreen = (hiGreen << kRegColorCorrection12BitLUTOddShift) + (loGreen << kRegColorCorrection12BitLUTEvenShift);
-		if (tmpGreen) nonzeroes++;
-		if (!WriteRegister(GTableReg++, tmpGreen))
-			errorCount++;
+		const UWordSequence &	lut			(*pLUTs[plane]);
+		ULWord					tableReg	(kColorCorrection12BitLUTOffset_Base / 4);	//	Byte offset to LUT in register bar;	 divide by sizeof (ULWord) to get register number
+		regWrites.StartPlane(NTV2RegInfo(kRegLUTV2Control, sPlanes[plane], kRegMask12BitLUTPlaneSelect, kRegShift12BitLUTPlaneSelect));
+		for (size_t ndx(0);	 ndx < NTV2_12BIT_COLORCORRECTOR_WORDSPERTABLE;	 ndx++)
+		{
+			const ULWord	lo(ULWord(lut[2 * ndx + 0]) & 0xFFF);
+			const ULWord	hi(ULWord(lut[2 * ndx + 1]) & 0xFFF);
+			const ULWord	tmp((hi << kRegColorCorrection12BitLUTOddShift) + (lo << kRegColorCorrection12BitLUTEvenShift));
+			if (tmp) nonzeroes++;
+			regWrites.Add(NTV2RegInfo(tableReg++, tmp));
+		}
 	}
-	
-	Set12BitLUTPlaneSelect(NTV2_BLUEPLANE);
-	for (size_t ndx(0);	 ndx < NTV2_12BIT_COLORCORRECTOR_WORDSPERTABLE;	 ndx++)
-	{
-		ULWord	loBlue = ULWord(inBlueLUT[2 * ndx + 0]) & 0xFFF;
-		ULWord	hiBlue = ULWord(inBlueLUT[2 * ndx + 1]) & 0xFFF;
 
-		ULWord	tmpBlue = (hiBlue << kRegColorCorrection12BitLUTOddShift) + (loBlue << kRegColorCorrection12BitLUTEvenShift);
-		if (tmpBlue) nonzeroes++;
-		if (!WriteRegister(BTableReg++, tmpBlue))
-			errorCount++;
-	}
-	
-	if (errorCount) LUTFAIL(GetDisplayName() << " " << DEC(errorCount) << " WriteRegister calls failed");
+	size_t numRegs(0), numFailedBatches(0);
+	const bool result (regWrites.WriteTo(*this, numRegs, numFailedBatches));
+	if (!result) LUTFAIL(GetDisplayName() << " WriteRegisters failed for " << DEC(numFailedBatches) << " of " << DEC(regWrites.GetNumBatches()) << " LUT register batch(es)");
 	else if (!nonzeroes) LUTWARN(GetDisplayName() << " All zero LUT table values!");
-	return !errorCount;
+	LUTDBG(GetDisplayName() << " " << DEC(numRegs) << " LUT register(s) written in " << DEC(regWrites.GetNumBatches()) << " batch(es) in " << DEC(AJATime::GetSystemMicroseconds() - startMicrosecs) << "us");
+	return result;
 }
 
 bool CNTV2Card::GetLUTTables (NTV2DoubleArray & outRedLUT, NTV2DoubleArray & outGreenLUT, NTV2DoubleArray & outBlueLUT)
@@ -12361,2459 +12361,173 @@ ULWord NTV2DeviceGetUFCVersion (const NTV2DeviceID inDeviceID)
 }	//  NTV2DeviceGetUFCVersion (auto-generated)
 
 
+/**
+	The NTV2DeviceCanDo... functions that take an enumerated value are answered from the bitset tables
+	below. Each table has one row per device, in the order given by NTV2DeviceCapsTableRow, and bit N of
+	a row is set if the device supports enum value N.
+**/
+#define	NTV2_CAPS_TABLE_WORDS(__count__)			(((__count__) + 31) / 32)
+#define	NTV2_CAPS_TABLE_HAS(__tbl__,__row__,__item__)	(((__tbl__)[__row__][(__item__) / 32] >> ((__item__) % 32)) & 1)
+
+static int NTV2DeviceCapsTableRow (const NTV2DeviceID inDeviceID)
+{
+	switch (inDeviceID)
+	{
+		case DEVICE_ID_CORVID1:					return 0;
+		case DEVICE_ID_CORVID22:				return 1;
+		case DEVICE_ID_CORVID24:				return 2;
+		case DEVICE_ID_CORVID3G:				return 3;
+		case DEVICE_ID_CORVID44:				return 4;
+		case DEVICE_ID_CORVID44_2X4K:			return 5;
+		case DEVICE_ID_CORVID44_8K:				return 6;
+		case DEVICE_ID_CORVID44_8KMK:			return 7;
+		case DEVICE_ID_CORVID44_PLNR:			return 8;
+		case DEVICE_ID_CORVID88:				return 9;
+		case DEVICE_ID_CORVIDHBR:				return 10;
+		case DEVICE_ID_CORVIDHEVC:				return 11;
+		case DEVICE_ID_IO4K:					return 12;
+		case DEVICE_ID_IO4KPLUS:				return 13;
+		case DEVICE_ID_IO4KUFC:					return 14;
+		case DEVICE_ID_IOEXPRESS:				return 15;
+		case DEVICE_ID_IOIP_2022:				return 16;
+		case DEVICE_ID_IOIP_2110:				return 17;
+		case DEVICE_ID_IOIP_2110_RGB12:			return 18;
+		case DEVICE_ID_IOX3:					return 19;
+		case DEVICE_ID_IOXT:					return 20;
+		case DEVICE_ID_KONA1:					return 21;
+		case DEVICE_ID_KONA3G:					return 22;
+		case DEVICE_ID_KONA3GQUAD:				return 23;
+		case DEVICE_ID_KONA4:					return 24;
+		case DEVICE_ID_KONA4UFC:				return 25;
+		case DEVICE_ID_KONA5:					return 26;
+		case DEVICE_ID_KONA5_2X4K:				return 27;
+		case DEVICE_ID_KONA5_3DLUT:				return 28;
+		case DEVICE_ID_KONA5_8K:				return 29;
+		case DEVICE_ID_KONA5_8K_MV_TX:			return 30;
+		case DEVICE_ID_KONA5_8KMK:				return 31;
+		case DEVICE_ID_KONA5_OE1:				return 32;
+		case DEVICE_ID_KONA5_OE10:				return 33;
+		case DEVICE_ID_KONA5_OE11:				return 34;
+		case DEVICE_ID_KONA5_OE12:				return 35;
+		case DEVICE_ID_KONA5_OE2:				return 36;
+		case DEVICE_ID_KONA5_OE3:				return 37;
+		case DEVICE_ID_KONA5_OE4:				return 38;
+		case DEVICE_ID_KONA5_OE5:				return 39;
+		case DEVICE_ID_KONA5_OE6:				return 40;
+		case DEVICE_ID_KONA5_OE7:				return 41;
+		case DEVICE_ID_KONA5_OE8:				return 42;
+		case DEVICE_ID_KONA5_OE9:				return 43;
+		case DEVICE_ID_KONAHDMI:				return 44;
+		case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:	return 45;
+		case DEVICE_ID_KONAIP_1RX_1TX_2110:		return 46;
+		case DEVICE_ID_KONAIP_2022:				return 47;
+		case DEVICE_ID_KONAIP_2110:				return 48;
+		case DEVICE_ID_KONAIP_2110_RGB12:		return 49;
+		case DEVICE_ID_KONAIP_2TX_1SFP_J2K:		return 50;
+		case DEVICE_ID_KONAIP_4CH_2SFP:			return 51;
+		case DEVICE_ID_KONALHEPLUS:				return 52;
+		case DEVICE_ID_KONALHI:					return 53;
+		case DEVICE_ID_KONALHIDVI:				return 54;
+		case DEVICE_ID_KONAX:					return 55;
+		case DEVICE_ID_KONAXM:					return 56;
+		case DEVICE_ID_SOJI_3DLUT:				return 57;
+		case DEVICE_ID_SOJI_DIAGS:				return 58;
+		case DEVICE_ID_SOJI_OE1:				return 59;
+		case DEVICE_ID_SOJI_OE2:				return 60;
+		case DEVICE_ID_SOJI_OE3:				return 61;
+		case DEVICE_ID_SOJI_OE4:				return 62;
+		case DEVICE_ID_SOJI_OE5:				return 63;
+		case DEVICE_ID_SOJI_OE6:				return 64;
+		case DEVICE_ID_SOJI_OE7:				return 65;
+		case DEVICE_ID_TTAP:					return 66;
+		case DEVICE_ID_TTAP_PRO:				return 67;
+		default:							break;
+	}
+	return -1;
+}	//	NTV2DeviceCapsTableRow (auto-generated)
+
+
 /**
 	NTV2DeviceCanDoConversionMode
 **/
+static const ULWord gConversionModeCaps [][NTV2_CAPS_TABLE_WORDS(NTV2_NUM_CONVERSIONMODES)] =
+{
+	{0x00000000, 0x00000000},	//	DEVICE_ID_CORVID1
+	{0x00000000, 0x00000000},	//	DEVICE_ID_CORVID22
+	{0x00000000, 0x00000000},	//	DEVICE_ID_CORVID24
+	{0x00000000, 0x00000000},	//	DEVICE_ID_CORVID3G
+	{0x00000000, 0x00000000},	//	DEVICE_ID_CORVID44
+	{0x00000000, 0x00000000},	//	DEVICE_ID_CORVID44_2X4K
+	{0x00000000, 0x00000000},	//	DEVICE_ID_CORVID44_8K
+	{0x00000000, 0x00000000},	//	DEVICE_ID_CORVID44_8KMK
+	{0x00000000, 0x00000000},	//	DEVICE_ID_CORVID44_PLNR
+	{0x00000000, 0x00000000},	//	DEVICE_ID_CORVID88
+	{0x00000000, 0x00000000},	//	DEVICE_ID_CORVIDHBR
+	{0x00000000, 0x00000000},	//	DEVICE_ID_CORVIDHEVC
+	{0x00000000, 0x00000000},	//	DEVICE_ID_IO4K
+	{0x00000000, 0x00000000},	//	DEVICE_ID_IO4KPLUS
+	{0x3FFFFFFF, 0x00000000},	//	DEVICE_ID_IO4KUFC
+	{0x0000100F, 0x00000000},	//	DEVICE_ID_IOEXPRESS
+	{0x00000000, 0x00000000},	//	DEVICE_ID_IOIP_2022
+	{0x00000000, 0x00000000},	//	DEVICE_ID_IOIP_2110
+	{0x00000000, 0x00000000},	//	DEVICE_ID_IOIP_2110_RGB12
+	{0x00000000, 0x00000000},	//	DEVICE_ID_IOX3
+	{0x07FFFFFF, 0x00000000},	//	DEVICE_ID_IOXT
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONA1
+	{0x3FFFFFFF, 0x00000000},	//	DEVICE_ID_KONA3G
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONA3GQUAD
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONA4
+	{0x3FFFFFFF, 0x00000000},	//	DEVICE_ID_KONA4UFC
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONA5
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_2X4K
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_3DLUT
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_8K
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_8K_MV_TX
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_8KMK
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_OE1
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_OE10
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_OE11
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_OE12
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_OE2
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_OE3
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_OE4
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_OE5
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_OE6
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_OE7
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_OE8
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_OE9
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONAHDMI
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONAIP_1RX_1TX_2110
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONAIP_2022
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONAIP_2110
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONAIP_2110_RGB12
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONAIP_2TX_1SFP_J2K
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONAIP_4CH_2SFP
+	{0x0000100F, 0x00000000},	//	DEVICE_ID_KONALHEPLUS
+	{0x07FFFFFF, 0x00000000},	//	DEVICE_ID_KONALHI
+	{0x07FFFFFF, 0x00000000},	//	DEVICE_ID_KONALHIDVI
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONAX
+	{0x00000000, 0x00000000},	//	DEVICE_ID_KONAXM
+	{0x00000000, 0x00000000},	//	DEVICE_ID_SOJI_3DLUT
+	{0x00000000, 0x00000000},	//	DEVICE_ID_SOJI_DIAGS
+	{0x00000000, 0x00000000},	//	DEVICE_ID_SOJI_OE1
+	{0x00000000, 0x00000000},	//	DEVICE_ID_SOJI_OE2
+	{0x00000000, 0x00000000},	//	DEVICE_ID_SOJI_OE3
+	{0x00000000, 0x00000000},	//	DEVICE_ID_SOJI_OE4
+	{0x00000000, 0x00000000},	//	DEVICE_ID_SOJI_OE5
+	{0x00000000, 0x00000000},	//	DEVICE_ID_SOJI_OE6
+	{0x00000000, 0x00000000},	//	DEVICE_ID_SOJI_OE7
+	{0x00000000, 0x00000000},	//	DEVICE_ID_TTAP
+	{0x00000000, 0x00000000} 	//	DEVICE_ID_TTAP_PRO
+};
+
 bool NTV2DeviceCanDoConversionMode (const NTV2DeviceID inDeviceID, const NTV2ConversionMode inConversionMode)
 {
-	switch (inConversionMode)
-	{
-		case NTV2_1080i2398to525_2398:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_1080i2398to525_2398:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_1080i2398to525_2398
-			break;	//  NTV2_1080i2398to525_2398
-
-		case NTV2_1080i2398to525_2997:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_1080i2398to525_2997:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_1080i2398to525_2997
-			break;	//  NTV2_1080i2398to525_2997
-
-		case NTV2_1080i2400to525_2400:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_1080i2400to525_2400:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_1080i2400to525_2400
-			break;	//  NTV2_1080i2400to525_2400
-
-		case NTV2_1080i_2398to720p_2398:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_1080i_2398to720p_2398:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_1080i_2398to720p_2398
-			break;	//  NTV2_1080i_2398to720p_2398
-
-		case NTV2_1080i_2500to625_2500:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_1080i_2500to625_2500:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_1080i_2500to625_2500
-			break;	//  NTV2_1080i_2500to625_2500
-
-		case NTV2_1080i_2500to720p_5000:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_1080i_2500to720p_5000:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_1080i_2500to720p_5000
-			break;	//  NTV2_1080i_2500to720p_5000
-
-		case NTV2_1080i_3000to720p_6000:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_1080i_3000to720p_6000:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_1080i_3000to720p_6000
-			break;	//  NTV2_1080i_3000to720p_6000
-
-		case NTV2_1080i_5000to1080psf_2500:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_1080i_5000to1080psf_2500:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_KONALHIDVI:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_1080i_5000to1080psf_2500
-			break;	//  NTV2_1080i_5000to1080psf_2500
-
-		case NTV2_1080i_5994to1080psf_2997:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_1080i_5994to1080psf_2997:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_KONALHIDVI:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_1080i_5994to1080psf_2997
-			break;	//  NTV2_1080i_5994to1080psf_2997
-
-		case NTV2_1080i_5994to525_5994:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_1080i_5994to525_5994:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_1080i_5994to525_5994
-			break;	//  NTV2_1080i_5994to525_5994
-
-		case NTV2_1080i_5994to720p_5994:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_1080i_5994to720p_5994:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_1080i_5994to720p_5994
-			break;	//  NTV2_1080i_5994to720p_5994
-
-		case NTV2_1080i_6000to1080psf_3000:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_1080i_6000to1080psf_3000:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_KONALHIDVI:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_1080i_6000to1080psf_3000
-			break;	//  NTV2_1080i_6000to1080psf_3000
-
-		case NTV2_1080p2398to525_2398:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_1080p2398to525_2398:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_1080p2398to525_2398
-			break;	//  NTV2_1080p2398to525_2398
-
-		case NTV2_1080p2398to525_2997:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_1080p2398to525_2997:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_1080p2398to525_2997
-			break;	//  NTV2_1080p2398to525_2997
-
-		case NTV2_1080p2400to525_2400:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_1080p2400to525_2400:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_1080p2400to525_2400
-			break;	//  NTV2_1080p2400to525_2400
-
-		case NTV2_525_2398to1080i_2398:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_525_2398to1080i_2398:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_525_2398to1080i_2398
-			break;	//  NTV2_525_2398to1080i_2398
-
-		case NTV2_525_5994to1080i_5994:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_525_5994to1080i_5994:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_525_5994to1080i_5994
-			break;	//  NTV2_525_5994to1080i_5994
-
-		case NTV2_525_5994to525_5994:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_525_5994to525_5994:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_525_5994to525_5994
-			break;	//  NTV2_525_5994to525_5994
-
-		case NTV2_525_5994to525psf_2997:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_525_5994to525psf_2997:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_525_5994to525psf_2997
-			break;	//  NTV2_525_5994to525psf_2997
-
-		case NTV2_525_5994to720p_5994:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_525_5994to720p_5994:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_525_5994to720p_5994
-			break;	//  NTV2_525_5994to720p_5994
-
-		case NTV2_625_2500to1080i_2500:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_625_2500to1080i_2500:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_625_2500to1080i_2500
-			break;	//  NTV2_625_2500to1080i_2500
-
-		case NTV2_625_2500to625_2500:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_625_2500to625_2500:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_625_2500to625_2500
-			break;	//  NTV2_625_2500to625_2500
-
-		case NTV2_625_2500to720p_5000:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_625_2500to720p_5000:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_625_2500to720p_5000
-			break;	//  NTV2_625_2500to720p_5000
-
-		case NTV2_625_5000to625psf_2500:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_625_5000to625psf_2500:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_625_5000to625psf_2500
-			break;	//  NTV2_625_5000to625psf_2500
-
-		case NTV2_720p_2398to1080i_2398:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_720p_2398to1080i_2398:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_720p_2398to1080i_2398
-			break;	//  NTV2_720p_2398to1080i_2398
-
-		case NTV2_720p_5000to1080i_2500:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_720p_5000to1080i_2500:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_720p_5000to1080i_2500
-			break;	//  NTV2_720p_5000to1080i_2500
-
-		case NTV2_720p_5000to625_2500:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_720p_5000to625_2500:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_720p_5000to625_2500
-			break;	//  NTV2_720p_5000to625_2500
-
-		case NTV2_720p_5994to1080i_5994:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_720p_5994to1080i_5994:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_720p_5994to1080i_5994
-			break;	//  NTV2_720p_5994to1080i_5994
-
-		case NTV2_720p_5994to525_5994:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_720p_5994to525_5994:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_720p_5994to525_5994
-			break;	//  NTV2_720p_5994to525_5994
-
-		case NTV2_720p_6000to1080i_3000:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_720p_6000to1080i_3000:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_720p_6000to1080i_3000
-			break;	//  NTV2_720p_6000to1080i_3000
-
-	#if defined(_DEBUG)		// These are unreferenced:
-		case NTV2_1080p_2398to1080i_5994:
-		case NTV2_1080p_2400to1080i_3000:
-		case NTV2_1080p_2500to1080i_2500:
-		case NTV2_1080p_3000to720p_6000:
-		case NTV2_1080psf_2398to1080i_5994:
-		case NTV2_1080psf_2400to1080i_3000:
-		case NTV2_1080psf_2500to1080i_2500:
-		case NTV2_CONVERSIONMODE_INVALID:
-	#else
-		default:
-	#endif
-			break;
-	}	//  switch on inConversionMode
-
-	return false;
+	const int row = NTV2DeviceCapsTableRow(inDeviceID);
+	if (row < 0  ||  (ULWord) inConversionMode >= (ULWord) NTV2_NUM_CONVERSIONMODES)
+		return false;
+	return NTV2_CAPS_TABLE_HAS(gConversionModeCaps, row, (ULWord) inConversionMode) ? true : false;
 
 }	//  NTV2DeviceCanDoConversionMode (auto-generated)
 
@@ -14821,505 +12535,84 @@ bool NTV2DeviceCanDoConversionMode (const NTV2DeviceID inDeviceID, const NTV2Con
 /**
 	NTV2DeviceCanDoDSKMode
 **/
+static const ULWord gDSKModeCaps [][NTV2_CAPS_TABLE_WORDS(NTV2_DSKMODE_INVALID)] =
+{
+	{0x00000000},	//	DEVICE_ID_CORVID1
+	{0x0000003F},	//	DEVICE_ID_CORVID22
+	{0x0000003F},	//	DEVICE_ID_CORVID24
+	{0x0000003F},	//	DEVICE_ID_CORVID3G
+	{0x0000003F},	//	DEVICE_ID_CORVID44
+	{0x0000003F},	//	DEVICE_ID_CORVID44_2X4K
+	{0x00000000},	//	DEVICE_ID_CORVID44_8K
+	{0x0000003F},	//	DEVICE_ID_CORVID44_8KMK
+	{0x00000000},	//	DEVICE_ID_CORVID44_PLNR
+	{0x0000003F},	//	DEVICE_ID_CORVID88
+	{0x00000000},	//	DEVICE_ID_CORVIDHBR
+	{0x00000000},	//	DEVICE_ID_CORVIDHEVC
+	{0x0000003F},	//	DEVICE_ID_IO4K
+	{0x0000003F},	//	DEVICE_ID_IO4KPLUS
+	{0x0000003F},	//	DEVICE_ID_IO4KUFC
+	{0x00000000},	//	DEVICE_ID_IOEXPRESS
+	{0x0000003F},	//	DEVICE_ID_IOIP_2022
+	{0x0000003F},	//	DEVICE_ID_IOIP_2110
+	{0x0000003F},	//	DEVICE_ID_IOIP_2110_RGB12
+	{0x0000003F},	//	DEVICE_ID_IOX3
+	{0x0000003F},	//	DEVICE_ID_IOXT
+	{0x0000003F},	//	DEVICE_ID_KONA1
+	{0x0000003F},	//	DEVICE_ID_KONA3G
+	{0x0000003F},	//	DEVICE_ID_KONA3GQUAD
+	{0x0000003F},	//	DEVICE_ID_KONA4
+	{0x0000003F},	//	DEVICE_ID_KONA4UFC
+	{0x0000003F},	//	DEVICE_ID_KONA5
+	{0x0000003F},	//	DEVICE_ID_KONA5_2X4K
+	{0x00000000},	//	DEVICE_ID_KONA5_3DLUT
+	{0x00000000},	//	DEVICE_ID_KONA5_8K
+	{0x00000000},	//	DEVICE_ID_KONA5_8K_MV_TX
+	{0x0000003F},	//	DEVICE_ID_KONA5_8KMK
+	{0x00000000},	//	DEVICE_ID_KONA5_OE1
+	{0x00000000},	//	DEVICE_ID_KONA5_OE10
+	{0x00000000},	//	DEVICE_ID_KONA5_OE11
+	{0x00000000},	//	DEVICE_ID_KONA5_OE12
+	{0x00000000},	//	DEVICE_ID_KONA5_OE2
+	{0x00000000},	//	DEVICE_ID_KONA5_OE3
+	{0x00000000},	//	DEVICE_ID_KONA5_OE4
+	{0x00000000},	//	DEVICE_ID_KONA5_OE5
+	{0x00000000},	//	DEVICE_ID_KONA5_OE6
+	{0x00000000},	//	DEVICE_ID_KONA5_OE7
+	{0x00000000},	//	DEVICE_ID_KONA5_OE8
+	{0x00000000},	//	DEVICE_ID_KONA5_OE9
+	{0x00000000},	//	DEVICE_ID_KONAHDMI
+	{0x0000003F},	//	DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K
+	{0x0000003F},	//	DEVICE_ID_KONAIP_1RX_1TX_2110
+	{0x0000003F},	//	DEVICE_ID_KONAIP_2022
+	{0x0000003F},	//	DEVICE_ID_KONAIP_2110
+	{0x0000003F},	//	DEVICE_ID_KONAIP_2110_RGB12
+	{0x0000003F},	//	DEVICE_ID_KONAIP_2TX_1SFP_J2K
+	{0x0000003F},	//	DEVICE_ID_KONAIP_4CH_2SFP
+	{0x00000007},	//	DEVICE_ID_KONALHEPLUS
+	{0x0000003F},	//	DEVICE_ID_KONALHI
+	{0x0000003F},	//	DEVICE_ID_KONALHIDVI
+	{0x0000003F},	//	DEVICE_ID_KONAX
+	{0x0000003F},	//	DEVICE_ID_KONAXM
+	{0x00000000},	//	DEVICE_ID_SOJI_3DLUT
+	{0x00000000},	//	DEVICE_ID_SOJI_DIAGS
+	{0x00000000},	//	DEVICE_ID_SOJI_OE1
+	{0x00000000},	//	DEVICE_ID_SOJI_OE2
+	{0x00000000},	//	DEVICE_ID_SOJI_OE3
+	{0x00000000},	//	DEVICE_ID_SOJI_OE4
+	{0x00000000},	//	DEVICE_ID_SOJI_OE5
+	{0x00000000},	//	DEVICE_ID_SOJI_OE6
+	{0x00000000},	//	DEVICE_ID_SOJI_OE7
+	{0x00000000},	//	DEVICE_ID_TTAP
+	{0x00000000} 	//	DEVICE_ID_TTAP_PRO
+};
+
 bool NTV2DeviceCanDoDSKMode (const NTV2DeviceID inDeviceID, const NTV2DSKMode inDSKMode)
 {
-	switch (inDSKMode)
-	{
-		case NTV2_DSKModeFBOverMatte:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_DSKModeFBOverMatte:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_DSKModeFBOverMatte
-			break;	//  NTV2_DSKModeFBOverMatte
-
-		case NTV2_DSKModeFBOverVideoIn:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_DSKModeFBOverVideoIn:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_DSKModeFBOverVideoIn
-			break;	//  NTV2_DSKModeFBOverVideoIn
-
-		case NTV2_DSKModeGraphicOverFB:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_DSKModeGraphicOverFB:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_DSKModeGraphicOverFB
-			break;	//  NTV2_DSKModeGraphicOverFB
-
-		case NTV2_DSKModeGraphicOverMatte:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_DSKModeGraphicOverMatte:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_DSKModeGraphicOverMatte
-			break;	//  NTV2_DSKModeGraphicOverMatte
-
-		case NTV2_DSKModeGraphicOverVideoIn:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_DSKModeGraphicOverVideoIn:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_DSKModeGraphicOverVideoIn
-			break;	//  NTV2_DSKModeGraphicOverVideoIn
-
-		case NTV2_DSKModeOff:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_DSKModeOff:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_DSKModeOff
-			break;	//  NTV2_DSKModeOff
-
-	#if defined(_DEBUG)		// These are unreferenced:
-		case NTV2_DSKMODE_INVALID:
-	#else
-		default:
-	#endif
-			break;
-	}	//  switch on inDSKMode
-
-	return false;
+	const int row = NTV2DeviceCapsTableRow(inDeviceID);
+	if (row < 0  ||  (ULWord) inDSKMode >= (ULWord) NTV2_DSKMODE_INVALID)
+		return false;
+	return NTV2_CAPS_TABLE_HAS(gDSKModeCaps, row, (ULWord) inDSKMode) ? true : false;
 
 }	//  NTV2DeviceCanDoDSKMode (auto-generated)
 
@@ -15327,2131 +12620,84 @@ bool NTV2DeviceCanDoDSKMode (const NTV2DeviceID inDeviceID, const NTV2DSKMode in
 /**
 	NTV2DeviceCanDoFrameBufferFormat
 **/
+static const ULWord gPixelFormatCaps [][NTV2_CAPS_TABLE_WORDS(NTV2_FBF_NUMFRAMEBUFFERFORMATS)] =
+{
+	{0x00000023},	//	DEVICE_ID_CORVID1
+	{0x0000B0FF},	//	DEVICE_ID_CORVID22
+	{0x0001B0FF},	//	DEVICE_ID_CORVID24
+	{0x0000B0FF},	//	DEVICE_ID_CORVID3G
+	{0x0C81B4FF},	//	DEVICE_ID_CORVID44
+	{0x0C83B4FF},	//	DEVICE_ID_CORVID44_2X4K
+	{0x0003B0FF},	//	DEVICE_ID_CORVID44_8K
+	{0x0003B0FF},	//	DEVICE_ID_CORVID44_8KMK
+	{0x0C800423},	//	DEVICE_ID_CORVID44_PLNR
+	{0x0C81B4FF},	//	DEVICE_ID_CORVID88
+	{0x0001BAFF},	//	DEVICE_ID_CORVIDHBR
+	{0xF0000023},	//	DEVICE_ID_CORVIDHEVC
+	{0x0301B0FF},	//	DEVICE_ID_IO4K
+	{0x0003B0FF},	//	DEVICE_ID_IO4KPLUS
+	{0x0001BAFF},	//	DEVICE_ID_IO4KUFC
+	{0x00000A23},	//	DEVICE_ID_IOEXPRESS
+	{0x0001B0FF},	//	DEVICE_ID_IOIP_2022
+	{0x0001B0FF},	//	DEVICE_ID_IOIP_2110
+	{0x0001B0FF},	//	DEVICE_ID_IOIP_2110_RGB12
+	{0x0301B0FF},	//	DEVICE_ID_IOX3
+	{0x0001BAFF},	//	DEVICE_ID_IOXT
+	{0x0001B1FF},	//	DEVICE_ID_KONA1
+	{0x0001BAFF},	//	DEVICE_ID_KONA3G
+	{0x0001BAFF},	//	DEVICE_ID_KONA3GQUAD
+	{0x0301B0FF},	//	DEVICE_ID_KONA4
+	{0x0001BAFF},	//	DEVICE_ID_KONA4UFC
+	{0x0C83B4FF},	//	DEVICE_ID_KONA5
+	{0x0C83B4FF},	//	DEVICE_ID_KONA5_2X4K
+	{0x0003B0FF},	//	DEVICE_ID_KONA5_3DLUT
+	{0x0003B0FF},	//	DEVICE_ID_KONA5_8K
+	{0x0003B0FF},	//	DEVICE_ID_KONA5_8K_MV_TX
+	{0x0003B0FF},	//	DEVICE_ID_KONA5_8KMK
+	{0x0003B0FF},	//	DEVICE_ID_KONA5_OE1
+	{0x0003B0FF},	//	DEVICE_ID_KONA5_OE10
+	{0x0003B0FF},	//	DEVICE_ID_KONA5_OE11
+	{0x0003B0FF},	//	DEVICE_ID_KONA5_OE12
+	{0x0003B0FF},	//	DEVICE_ID_KONA5_OE2
+	{0x0003B0FF},	//	DEVICE_ID_KONA5_OE3
+	{0x0003B0FF},	//	DEVICE_ID_KONA5_OE4
+	{0x0003B0FF},	//	DEVICE_ID_KONA5_OE5
+	{0x0003B0FF},	//	DEVICE_ID_KONA5_OE6
+	{0x0003B0FF},	//	DEVICE_ID_KONA5_OE7
+	{0x0003B0FF},	//	DEVICE_ID_KONA5_OE8
+	{0x0003B0FF},	//	DEVICE_ID_KONA5_OE9
+	{0x0001B0FF},	//	DEVICE_ID_KONAHDMI
+	{0x0301B0FF},	//	DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K
+	{0x0301B0FF},	//	DEVICE_ID_KONAIP_1RX_1TX_2110
+	{0x0301B0FF},	//	DEVICE_ID_KONAIP_2022
+	{0x0301B0FF},	//	DEVICE_ID_KONAIP_2110
+	{0x0301B0FF},	//	DEVICE_ID_KONAIP_2110_RGB12
+	{0x0301B0FF},	//	DEVICE_ID_KONAIP_2TX_1SFP_J2K
+	{0x0301B0FF},	//	DEVICE_ID_KONAIP_4CH_2SFP
+	{0x0000BAFF},	//	DEVICE_ID_KONALHEPLUS
+	{0x0001BAFF},	//	DEVICE_ID_KONALHI
+	{0x0001BAFF},	//	DEVICE_ID_KONALHIDVI
+	{0x0003B0FF},	//	DEVICE_ID_KONAX
+	{0x0003B0FF},	//	DEVICE_ID_KONAXM
+	{0x0003B0FF},	//	DEVICE_ID_SOJI_3DLUT
+	{0x0003B0FF},	//	DEVICE_ID_SOJI_DIAGS
+	{0x0003B0FF},	//	DEVICE_ID_SOJI_OE1
+	{0x0003B0FF},	//	DEVICE_ID_SOJI_OE2
+	{0x0003B0FF},	//	DEVICE_ID_SOJI_OE3
+	{0x0003B0FF},	//	DEVICE_ID_SOJI_OE4
+	{0x0003B0FF},	//	DEVICE_ID_SOJI_OE5
+	{0x0003B0FF},	//	DEVICE_ID_SOJI_OE6
+	{0x0003B0FF},	//	DEVICE_ID_SOJI_OE7
+	{0x00000A23},	//	DEVICE_ID_TTAP
+	{0x0003B0FF} 	//	DEVICE_ID_TTAP_PRO
+};
+
 bool NTV2DeviceCanDoFrameBufferFormat (const NTV2DeviceID inDeviceID, const NTV2FrameBufferFormat inFBFormat)
 {
-	switch (inFBFormat)
-	{
-		case NTV2_FBF_10BIT_DPX:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_10BIT_DPX:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_CORVIDHEVC:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_10BIT_DPX
-			break;	//  NTV2_FBF_10BIT_DPX
-
-		case NTV2_FBF_10BIT_DPX_LE:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_10BIT_DPX_LE:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_CORVIDHEVC:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_10BIT_DPX_LE
-			break;	//  NTV2_FBF_10BIT_DPX_LE
-
-		case NTV2_FBF_10BIT_RAW_RGB:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_10BIT_RAW_RGB:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_KONALHIDVI:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_10BIT_RAW_RGB
-			break;	//  NTV2_FBF_10BIT_RAW_RGB
-
-		case NTV2_FBF_10BIT_RAW_YCBCR:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_10BIT_RAW_YCBCR:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_KONALHIDVI:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_10BIT_RAW_YCBCR
-			break;	//  NTV2_FBF_10BIT_RAW_YCBCR
-
-		case NTV2_FBF_10BIT_RGB:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_10BIT_RGB:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_CORVIDHEVC:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_10BIT_RGB
-			break;	//  NTV2_FBF_10BIT_RGB
-
-		case NTV2_FBF_10BIT_YCBCR:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_10BIT_YCBCR:
-				case DEVICE_ID_NOTFOUND:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_10BIT_YCBCR
-			break;	//  NTV2_FBF_10BIT_YCBCR
-
-		case NTV2_FBF_10BIT_YCBCR_420PL2:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_CORVIDHEVC:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_10BIT_YCBCR_420PL2:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_KONALHIDVI:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_10BIT_YCBCR_420PL2
-			break;	//  NTV2_FBF_10BIT_YCBCR_420PL2
-
-		case NTV2_FBF_10BIT_YCBCR_420PL3_LE:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_CORVID44:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_10BIT_YCBCR_420PL3_LE:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_KONALHIDVI:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_10BIT_YCBCR_420PL3_LE
-			break;	//  NTV2_FBF_10BIT_YCBCR_420PL3_LE
-
-		case NTV2_FBF_10BIT_YCBCR_422PL2:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_CORVIDHEVC:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_10BIT_YCBCR_422PL2:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_KONALHIDVI:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_10BIT_YCBCR_422PL2
-			break;	//  NTV2_FBF_10BIT_YCBCR_422PL2
-
-		case NTV2_FBF_10BIT_YCBCR_422PL3_LE:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_CORVID44:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_10BIT_YCBCR_422PL3_LE:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_KONALHIDVI:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_10BIT_YCBCR_422PL3_LE
-			break;	//  NTV2_FBF_10BIT_YCBCR_422PL3_LE
-
-		case NTV2_FBF_10BIT_YCBCR_DPX:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONA1:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_10BIT_YCBCR_DPX:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_KONALHIDVI:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_10BIT_YCBCR_DPX
-			break;	//  NTV2_FBF_10BIT_YCBCR_DPX
-
-		case NTV2_FBF_12BIT_RGB_PACKED:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_SOJI_DIAGS:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_12BIT_RGB_PACKED:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_KONALHIDVI:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_12BIT_RGB_PACKED
-			break;	//  NTV2_FBF_12BIT_RGB_PACKED
-
-		case NTV2_FBF_24BIT_BGR:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_24BIT_BGR:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_CORVIDHEVC:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_24BIT_BGR
-			break;	//  NTV2_FBF_24BIT_BGR
-
-		case NTV2_FBF_24BIT_RGB:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_24BIT_RGB:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_CORVIDHEVC:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_24BIT_RGB
-			break;	//  NTV2_FBF_24BIT_RGB
-
-		case NTV2_FBF_48BIT_RGB:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_48BIT_RGB:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_CORVIDHEVC:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_48BIT_RGB
-			break;	//  NTV2_FBF_48BIT_RGB
-
-		case NTV2_FBF_8BIT_DVCPRO:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_8BIT_DVCPRO:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_8BIT_DVCPRO
-			break;	//  NTV2_FBF_8BIT_DVCPRO
-
-		case NTV2_FBF_8BIT_HDV:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_8BIT_HDV:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_8BIT_HDV
-			break;	//  NTV2_FBF_8BIT_HDV
-
-		case NTV2_FBF_8BIT_YCBCR:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_8BIT_YCBCR:
-				case DEVICE_ID_NOTFOUND:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_8BIT_YCBCR
-			break;	//  NTV2_FBF_8BIT_YCBCR
-
-		case NTV2_FBF_8BIT_YCBCR_420PL2:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_CORVIDHEVC:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_8BIT_YCBCR_420PL2:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_KONALHIDVI:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_8BIT_YCBCR_420PL2
-			break;	//  NTV2_FBF_8BIT_YCBCR_420PL2
-
-		case NTV2_FBF_8BIT_YCBCR_420PL3:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_CORVID44:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_8BIT_YCBCR_420PL3:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_KONALHIDVI:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_8BIT_YCBCR_420PL3
-			break;	//  NTV2_FBF_8BIT_YCBCR_420PL3
-
-		case NTV2_FBF_8BIT_YCBCR_422PL2:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_CORVIDHEVC:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_8BIT_YCBCR_422PL2:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_KONALHIDVI:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_8BIT_YCBCR_422PL2
-			break;	//  NTV2_FBF_8BIT_YCBCR_422PL2
-
-		case NTV2_FBF_8BIT_YCBCR_422PL3:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_CORVID44:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_8BIT_YCBCR_422PL3:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_KONALHIDVI:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_8BIT_YCBCR_422PL3
-			break;	//  NTV2_FBF_8BIT_YCBCR_422PL3
-
-		case NTV2_FBF_8BIT_YCBCR_YUY2:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_8BIT_YCBCR_YUY2:
-				case DEVICE_ID_NOTFOUND:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_8BIT_YCBCR_YUY2
-			break;	//  NTV2_FBF_8BIT_YCBCR_YUY2
-
-		case NTV2_FBF_ABGR:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_ABGR:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_CORVIDHEVC:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_ABGR
-			break;	//  NTV2_FBF_ABGR
-
-		case NTV2_FBF_ARGB:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_ARGB:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_CORVIDHEVC:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_ARGB
-			break;	//  NTV2_FBF_ARGB
-
-		case NTV2_FBF_RGBA:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_FBF_RGBA:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_CORVIDHEVC:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_FBF_RGBA
-			break;	//  NTV2_FBF_RGBA
-
-	#if defined(_DEBUG)		// These are unreferenced:
-		case NTV2_FBF_10BIT_ARGB:
-		case NTV2_FBF_10BIT_RGB_PACKED:
-		case NTV2_FBF_10BIT_YCBCRA:
-		case NTV2_FBF_16BIT_ARGB:
-		case NTV2_FBF_INVALID:
-		case NTV2_FBF_PRORES_DVCPRO:
-		case NTV2_FBF_PRORES_HDV:
-	#else
-		default:
-	#endif
-			break;
-	}	//  switch on inFBFormat
-
-	return false;
+	const int row = NTV2DeviceCapsTableRow(inDeviceID);
+	if (row < 0  ||  (ULWord) inFBFormat >= (ULWord) NTV2_FBF_NUMFRAMEBUFFERFORMATS)
+		return false;
+	return NTV2_CAPS_TABLE_HAS(gPixelFormatCaps, row, (ULWord) inFBFormat) ? true : false;
 
 }	//  NTV2DeviceCanDoFrameBufferFormat (auto-generated)
 
@@ -17459,1072 +12705,84 @@ bool NTV2DeviceCanDoFrameBufferFormat (const NTV2DeviceID inDeviceID, const NTV2
 /**
 	NTV2DeviceCanDoInputSource
 **/
+static const ULWord gInputSourceCaps [][NTV2_CAPS_TABLE_WORDS(NTV2_NUM_INPUTSOURCES)] =
+{
+	{0x00000020},	//	DEVICE_ID_CORVID1
+	{0x00000060},	//	DEVICE_ID_CORVID22
+	{0x000001E0},	//	DEVICE_ID_CORVID24
+	{0x00000020},	//	DEVICE_ID_CORVID3G
+	{0x000001E0},	//	DEVICE_ID_CORVID44
+	{0x000001E0},	//	DEVICE_ID_CORVID44_2X4K
+	{0x000001E0},	//	DEVICE_ID_CORVID44_8K
+	{0x000001E0},	//	DEVICE_ID_CORVID44_8KMK
+	{0x000001E0},	//	DEVICE_ID_CORVID44_PLNR
+	{0x00001FE0},	//	DEVICE_ID_CORVID88
+	{0x00000002},	//	DEVICE_ID_CORVIDHBR
+	{0x000001E0},	//	DEVICE_ID_CORVIDHEVC
+	{0x000001E2},	//	DEVICE_ID_IO4K
+	{0x000001E2},	//	DEVICE_ID_IO4KPLUS
+	{0x00000062},	//	DEVICE_ID_IO4KUFC
+	{0x00000022},	//	DEVICE_ID_IOEXPRESS
+	{0x000001E0},	//	DEVICE_ID_IOIP_2022
+	{0x000001E0},	//	DEVICE_ID_IOIP_2110
+	{0x00000000},	//	DEVICE_ID_IOIP_2110_RGB12
+	{0x000001E2},	//	DEVICE_ID_IOX3
+	{0x00000062},	//	DEVICE_ID_IOXT
+	{0x00000020},	//	DEVICE_ID_KONA1
+	{0x00000060},	//	DEVICE_ID_KONA3G
+	{0x000001E0},	//	DEVICE_ID_KONA3GQUAD
+	{0x000001E0},	//	DEVICE_ID_KONA4
+	{0x00000060},	//	DEVICE_ID_KONA4UFC
+	{0x000001E0},	//	DEVICE_ID_KONA5
+	{0x000001E0},	//	DEVICE_ID_KONA5_2X4K
+	{0x00000060},	//	DEVICE_ID_KONA5_3DLUT
+	{0x000001E0},	//	DEVICE_ID_KONA5_8K
+	{0x00000020},	//	DEVICE_ID_KONA5_8K_MV_TX
+	{0x000001E0},	//	DEVICE_ID_KONA5_8KMK
+	{0x00000060},	//	DEVICE_ID_KONA5_OE1
+	{0x00000060},	//	DEVICE_ID_KONA5_OE10
+	{0x00000060},	//	DEVICE_ID_KONA5_OE11
+	{0x00000060},	//	DEVICE_ID_KONA5_OE12
+	{0x00000060},	//	DEVICE_ID_KONA5_OE2
+	{0x00000060},	//	DEVICE_ID_KONA5_OE3
+	{0x00000060},	//	DEVICE_ID_KONA5_OE4
+	{0x00000060},	//	DEVICE_ID_KONA5_OE5
+	{0x00000060},	//	DEVICE_ID_KONA5_OE6
+	{0x00000060},	//	DEVICE_ID_KONA5_OE7
+	{0x00000060},	//	DEVICE_ID_KONA5_OE8
+	{0x00000060},	//	DEVICE_ID_KONA5_OE9
+	{0x0000001E},	//	DEVICE_ID_KONAHDMI
+	{0x00000020},	//	DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K
+	{0x000001E0},	//	DEVICE_ID_KONAIP_1RX_1TX_2110
+	{0x000001E0},	//	DEVICE_ID_KONAIP_2022
+	{0x000001E0},	//	DEVICE_ID_KONAIP_2110
+	{0x00000000},	//	DEVICE_ID_KONAIP_2110_RGB12
+	{0x00000000},	//	DEVICE_ID_KONAIP_2TX_1SFP_J2K
+	{0x000001E0},	//	DEVICE_ID_KONAIP_4CH_2SFP
+	{0x00000021},	//	DEVICE_ID_KONALHEPLUS
+	{0x00000023},	//	DEVICE_ID_KONALHI
+	{0x00000023},	//	DEVICE_ID_KONALHIDVI
+	{0x00000062},	//	DEVICE_ID_KONAX
+	{0x00000062},	//	DEVICE_ID_KONAXM
+	{0x00000060},	//	DEVICE_ID_SOJI_3DLUT
+	{0x00000060},	//	DEVICE_ID_SOJI_DIAGS
+	{0x00000060},	//	DEVICE_ID_SOJI_OE1
+	{0x00000060},	//	DEVICE_ID_SOJI_OE2
+	{0x00000060},	//	DEVICE_ID_SOJI_OE3
+	{0x00000060},	//	DEVICE_ID_SOJI_OE4
+	{0x00000060},	//	DEVICE_ID_SOJI_OE5
+	{0x00000060},	//	DEVICE_ID_SOJI_OE6
+	{0x00000060},	//	DEVICE_ID_SOJI_OE7
+	{0x00000000},	//	DEVICE_ID_TTAP
+	{0x00000000} 	//	DEVICE_ID_TTAP_PRO
+};
+
 bool NTV2DeviceCanDoInputSource (const NTV2DeviceID inDeviceID, const NTV2InputSource inInputSource)
 {
-	switch (inInputSource)
-	{
-		case NTV2_INPUTSOURCE_ANALOG1:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_INPUTSOURCE_ANALOG1:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_INPUTSOURCE_ANALOG1
-			break;	//  NTV2_INPUTSOURCE_ANALOG1
-
-		case NTV2_INPUTSOURCE_HDMI1:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_INPUTSOURCE_HDMI1:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_INPUTSOURCE_HDMI1
-			break;	//  NTV2_INPUTSOURCE_HDMI1
-
-		case NTV2_INPUTSOURCE_HDMI2:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONAHDMI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_INPUTSOURCE_HDMI2:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_KONALHIDVI:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_INPUTSOURCE_HDMI2
-			break;	//  NTV2_INPUTSOURCE_HDMI2
-
-		case NTV2_INPUTSOURCE_HDMI3:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONAHDMI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_INPUTSOURCE_HDMI3:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_KONALHIDVI:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_INPUTSOURCE_HDMI3
-			break;	//  NTV2_INPUTSOURCE_HDMI3
-
-		case NTV2_INPUTSOURCE_HDMI4:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_KONAHDMI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_INPUTSOURCE_HDMI4:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_KONALHIDVI:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_INPUTSOURCE_HDMI4
-			break;	//  NTV2_INPUTSOURCE_HDMI4
-
-		case NTV2_INPUTSOURCE_SDI1:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_KONALHIDVI:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_INPUTSOURCE_SDI1:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_INPUTSOURCE_SDI1
-			break;	//  NTV2_INPUTSOURCE_SDI1
-
-		case NTV2_INPUTSOURCE_SDI2:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_INPUTSOURCE_SDI2:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_KONALHIDVI:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_INPUTSOURCE_SDI2
-			break;	//  NTV2_INPUTSOURCE_SDI2
-
-		case NTV2_INPUTSOURCE_SDI3:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_INPUTSOURCE_SDI3:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_KONALHIDVI:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_INPUTSOURCE_SDI3
-			break;	//  NTV2_INPUTSOURCE_SDI3
-
-		case NTV2_INPUTSOURCE_SDI4:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_CORVID88:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_INPUTSOURCE_SDI4:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_KONALHIDVI:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_INPUTSOURCE_SDI4
-			break;	//  NTV2_INPUTSOURCE_SDI4
-
-		case NTV2_INPUTSOURCE_SDI5:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_CORVID88:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_INPUTSOURCE_SDI5:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_KONALHIDVI:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_INPUTSOURCE_SDI5
-			break;	//  NTV2_INPUTSOURCE_SDI5
-
-		case NTV2_INPUTSOURCE_SDI6:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_CORVID88:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_INPUTSOURCE_SDI6:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_KONALHIDVI:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_INPUTSOURCE_SDI6
-			break;	//  NTV2_INPUTSOURCE_SDI6
-
-		case NTV2_INPUTSOURCE_SDI7:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_CORVID88:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_INPUTSOURCE_SDI7:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_KONALHIDVI:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_INPUTSOURCE_SDI7
-			break;	//  NTV2_INPUTSOURCE_SDI7
-
-		case NTV2_INPUTSOURCE_SDI8:
-			switch (inDeviceID)
-			{
-				case DEVICE_ID_CORVID88:
-					return true;
-			#if defined(_DEBUG)		// These devices don't support NTV2_INPUTSOURCE_SDI8:
-				case DEVICE_ID_SOJI_OE6:
-				case DEVICE_ID_KONALHI:
-				case DEVICE_ID_CORVID44_8KMK:
-				case DEVICE_ID_SOJI_OE2:
-				case DEVICE_ID_IOEXPRESS:
-				case DEVICE_ID_IO4KPLUS:
-				case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case DEVICE_ID_TTAP_PRO:
-				case DEVICE_ID_IOIP_2022:
-				case DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case DEVICE_ID_KONA4:
-				case DEVICE_ID_TTAP:
-				case DEVICE_ID_SOJI_OE5:
-				case DEVICE_ID_CORVID24:
-				case DEVICE_ID_IO4K:
-				case DEVICE_ID_CORVID44_2X4K:
-				case DEVICE_ID_KONAIP_4CH_2SFP:
-				case DEVICE_ID_KONA1:
-				case DEVICE_ID_IO4KUFC:
-				case DEVICE_ID_KONAHDMI:
-				case DEVICE_ID_KONAIP_2022:
-				case DEVICE_ID_KONA5:
-				case DEVICE_ID_IOXT:
-				case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case DEVICE_ID_KONAXM:
-				case DEVICE_ID_SOJI_3DLUT:
-				case DEVICE_ID_KONA5_OE9:
-				case DEVICE_ID_KONA5_OE8:
-				case DEVICE_ID_KONA5_OE7:
-				case DEVICE_ID_KONA5_OE6:
-				case DEVICE_ID_KONA5_OE5:
-				case DEVICE_ID_KONA5_OE4:
-				case DEVICE_ID_KONA5_OE3:
-				case DEVICE_ID_KONA5_8K:
-				case DEVICE_ID_KONA5_OE1:
-				case DEVICE_ID_KONA5_8K_MV_TX:
-				case DEVICE_ID_KONAX:
-				case DEVICE_ID_NOTFOUND:
-				case DEVICE_ID_KONA5_2X4K:
-				case DEVICE_ID_IOX3:
-				case DEVICE_ID_CORVID3G:
-				case DEVICE_ID_KONA5_OE11:
-				case DEVICE_ID_CORVIDHBR:
-				case DEVICE_ID_SOJI_OE3:
-				case DEVICE_ID_KONA3GQUAD:
-				case DEVICE_ID_CORVID44_8K:
-				case DEVICE_ID_KONAIP_2110:
-				case DEVICE_ID_KONA4UFC:
-				case DEVICE_ID_SOJI_OE1:
-				case DEVICE_ID_KONA5_8KMK:
-				case DEVICE_ID_CORVID1:
-				case DEVICE_ID_KONA5_OE12:
-				case DEVICE_ID_KONA3G:
-				case DEVICE_ID_KONA5_OE10:
-				case DEVICE_ID_KONA5_3DLUT:
-				case DEVICE_ID_SOJI_OE7:
-				case DEVICE_ID_IOIP_2110:
-				case DEVICE_ID_KONA5_OE2:
-				case DEVICE_ID_CORVID44_PLNR:
-				case DEVICE_ID_SOJI_DIAGS:
-				case DEVICE_ID_KONALHEPLUS:
-				case DEVICE_ID_IOIP_2110_RGB12:
-				case DEVICE_ID_CORVID22:
-				case DEVICE_ID_KONAIP_2110_RGB12:
-				case DEVICE_ID_CORVIDHEVC:
-				case DEVICE_ID_CORVID44:
-				case DEVICE_ID_SOJI_OE4:
-				case DEVICE_ID_KONALHIDVI:
-			#else
-				default:
-			#endif
-					break;
-			}	//  switch on inDeviceID for NTV2_INPUTSOURCE_SDI8
-			break;	//  NTV2_INPUTSOURCE_SDI8
-
-	#if defined(_DEBUG)		// These are unreferenced:
-		case NTV2_INPUTSOURCE_INVALID:
-	#else
-		default:
-	#endif
-			break;
-	}	//  switch on inInputSource
-
-	return false;
+	const int row = NTV2DeviceCapsTableRow(inDeviceID);
+	if (row < 0  ||  (ULWord) inInputSource >= (ULWord) NTV2_NUM_INPUTSOURCES)
+		return false;
+	return NTV2_CAPS_TABLE_HAS(gInputSourceCaps, row, (ULWord) inInputSource) ? true : false;
 
 }	//  NTV2DeviceCanDoInputSource (auto-generated)
 
@@ -18532,11983 +12790,84 @@ bool NTV2DeviceCanDoInputSource (const NTV2DeviceID inDeviceID, const NTV2InputS
 /**
 	NTV2DeviceCanDoVideoFormat
 **/
+static const ULWord gVideoFormatCaps [][NTV2_CAPS_TABLE_WORDS(NTV2_MAX_NUM_VIDEO_FORMATS)] =
+{
+	{0x70039FFE, 0x00000003, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_CORVID1
+	{0x7FBFFFFE, 0x0000000F, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_CORVID22
+	{0x7FBFFFFE, 0x00000003, 0x3FFF0000, 0x00030003, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_CORVID24
+	{0x7FBFFFFE, 0x0000000F, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_CORVID3G
+	{0x7F9FFFFE, 0x00000033, 0x3FFF0000, 0x001FCFF3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_CORVID44
+	{0x7F9FFFFE, 0x00000033, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0xC0000000, 0x0000003F, 0x03FF0000},	//	DEVICE_ID_CORVID44_2X4K
+	{0x7F9FFFFE, 0x00000033, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0xC0000000, 0x0000003F, 0x03FF0000},	//	DEVICE_ID_CORVID44_8K
+	{0x7F9FFFFE, 0x00000033, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0xC0000000, 0x0000003F, 0x03FF0000},	//	DEVICE_ID_CORVID44_8KMK
+	{0x7F9FFFFE, 0x00000033, 0x3FFF0000, 0x001FCFF3, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_CORVID44_PLNR
+	{0x7F9FFFFE, 0x00000033, 0x3FFF0000, 0x001FCFF3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_CORVID88
+	{0x079E7F3E, 0x00000003, 0x3FFF0000, 0x001FCFF3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_CORVIDHBR
+	{0x7F9FFFFE, 0x00000033, 0x3FFF0000, 0x001FCFF3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_CORVIDHEVC
+	{0x7F9FFFFE, 0x00000033, 0x3FFF0000, 0x001FCFF3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_IO4K
+	{0x7F9FFFFE, 0x00000033, 0x3FFF0000, 0x001FCFF3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_IO4KPLUS
+	{0x7FFFFFFE, 0x0000000F, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_IO4KUFC
+	{0x70021FFE, 0x00000003, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_IOEXPRESS
+	{0x7FBFFFFE, 0x0000000B, 0x00000000, 0x00030000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_IOIP_2022
+	{0x7F83FFFE, 0x00000033, 0x3FFF0000, 0x001FCFF3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_IOIP_2110
+	{0x7F83FFFE, 0x00000033, 0x3FFF0000, 0x001FCFF3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_IOIP_2110_RGB12
+	{0x7F9FFFFE, 0x00000033, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_IOX3
+	{0x7FFFFFFE, 0x0000000F, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_IOXT
+	{0x7F9FFFFE, 0x00000033, 0x00000000, 0x0007C000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONA1
+	{0x7FFFFFFE, 0x0000003F, 0x00000000, 0x0007C000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONA3G
+	{0x7FBFFFFE, 0x00000003, 0x3FFF0000, 0x00030003, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONA3GQUAD
+	{0x7F9FFFFE, 0x00000033, 0x3FFF0000, 0x001FCFF3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONA4
+	{0x7FFFFFFE, 0x0000000F, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONA4UFC
+	{0x7F9FFFFE, 0x00000033, 0x3FFF0000, 0x001FCFF3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONA5
+	{0x7F9FFFFE, 0x00000033, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0xC0000000, 0x0000003F, 0x03FF0000},	//	DEVICE_ID_KONA5_2X4K
+	{0x7F9FFFFE, 0x00000000, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_3DLUT
+	{0x7F9FFFFE, 0x00000033, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0xC0000000, 0x0000003F, 0x03FF0000},	//	DEVICE_ID_KONA5_8K
+	{0x7F9FFFFE, 0x00000033, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0xC0000000, 0x0000003F, 0x03FF0000},	//	DEVICE_ID_KONA5_8K_MV_TX
+	{0x7F9FFFFE, 0x00000033, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0xC0000000, 0x0000003F, 0x03FF0000},	//	DEVICE_ID_KONA5_8KMK
+	{0x7F9FFFFE, 0x00000000, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_OE1
+	{0x7F9FFFFE, 0x00000000, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_OE10
+	{0x7F9FFFFE, 0x00000000, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_OE11
+	{0x7F9FFFFE, 0x00000000, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_OE12
+	{0x7F9FFFFE, 0x00000000, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_OE2
+	{0x7F9FFFFE, 0x00000000, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_OE3
+	{0x7F9FFFFE, 0x00000000, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_OE4
+	{0x7F9FFFFE, 0x00000000, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_OE5
+	{0x7F9FFFFE, 0x00000000, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_OE6
+	{0x7F9FFFFE, 0x00000000, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_OE7
+	{0x7F9FFFFE, 0x00000000, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_OE8
+	{0x7F9FFFFE, 0x00000000, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONA5_OE9
+	{0x079E7F3E, 0x00000003, 0x3E380000, 0x001FCFF3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONAHDMI
+	{0x07827F3E, 0x0000000B, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K
+	{0x7FBFFFFE, 0x0000000F, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONAIP_1RX_1TX_2110
+	{0x7FBFFFFE, 0x0000000F, 0x00000000, 0x00030000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONAIP_2022
+	{0x7F83FFFE, 0x00000033, 0x3FFF0000, 0x001FCFF3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONAIP_2110
+	{0x7F83FFFE, 0x00000033, 0x3FFF0000, 0x001FCFF3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONAIP_2110_RGB12
+	{0x07827F3E, 0x0000000B, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONAIP_2TX_1SFP_J2K
+	{0x7FBFFFFE, 0x0000000F, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONAIP_4CH_2SFP
+	{0x7C03FFFE, 0x00000003, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONALHEPLUS
+	{0x7FFFFFFE, 0x0000000F, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONALHI
+	{0x7FFFFFFE, 0x0000000F, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONALHIDVI
+	{0x7F83FFFE, 0x00000033, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONAX
+	{0x7F83FFFE, 0x00000033, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_KONAXM
+	{0x7F9FFFFE, 0x00000000, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_SOJI_3DLUT
+	{0x7F9FFFFE, 0x00000000, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_SOJI_DIAGS
+	{0x7F9FFFFE, 0x00000000, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_SOJI_OE1
+	{0x7F9FFFFE, 0x00000000, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_SOJI_OE2
+	{0x7F9FFFFE, 0x00000000, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_SOJI_OE3
+	{0x7F9FFFFE, 0x00000000, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_SOJI_OE4
+	{0x7F9FFFFE, 0x00000000, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_SOJI_OE5
+	{0x7F9FFFFE, 0x00000000, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_SOJI_OE6
+	{0x7F9FFFFE, 0x00000000, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001FFF00, 0xFC000000, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_SOJI_OE7
+	{0x7C03FFFE, 0x00000003, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},	//	DEVICE_ID_TTAP
+	{0x7F83FFFE, 0x00000033, 0x00000000, 0x001FC000, 0x00000000, 0x00000000, 0x001CF800, 0xE0000000, 0x000001F3, 0x00000000, 0x00000000, 0x00000000, 0x00000000} 	//	DEVICE_ID_TTAP_PRO
+};
+
 bool NTV2DeviceCanDoVideoFormat (const NTV2DeviceID inDeviceID, const NTV2VideoFormat inVideoFormat)
 {
-	switch (inDeviceID)
-	{
-		case DEVICE_ID_CORVID1:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_CORVID1:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_CORVID1
-
-		case DEVICE_ID_CORVID22:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_CORVID22:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_CORVID22
-
-		case DEVICE_ID_CORVID24:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_CORVID24:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_CORVID24
-
-		case DEVICE_ID_CORVID3G:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_CORVID3G:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_CORVID3G
-
-		case DEVICE_ID_CORVID44:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_CORVID44:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_CORVID44
-
-		case DEVICE_ID_CORVID44_2X4K:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_CORVID44_2X4K:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_CORVID44_2X4K
-
-		case DEVICE_ID_CORVID44_8K:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_CORVID44_8K:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_CORVID44_8K
-
-		case DEVICE_ID_CORVID44_8KMK:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_CORVID44_8KMK:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_CORVID44_8KMK
-
-		case DEVICE_ID_CORVID44_PLNR:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_CORVID44_PLNR:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_CORVID44_PLNR
-
-		case DEVICE_ID_CORVID88:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_CORVID88:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_CORVID88
-
-		case DEVICE_ID_CORVIDHBR:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_CORVIDHBR:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_CORVIDHBR
-
-		case DEVICE_ID_CORVIDHEVC:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_CORVIDHEVC:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_CORVIDHEVC
-
-		case DEVICE_ID_IO4K:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_IO4K:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_IO4K
-
-		case DEVICE_ID_IO4KPLUS:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_IO4KPLUS:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_IO4KPLUS
-
-		case DEVICE_ID_IO4KUFC:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_IO4KUFC:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_IO4KUFC
-
-		case DEVICE_ID_IOEXPRESS:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_IOEXPRESS:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_IOEXPRESS
-
-		case DEVICE_ID_IOIP_2022:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_IOIP_2022:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_IOIP_2022
-
-		case DEVICE_ID_IOIP_2110:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_IOIP_2110:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_IOIP_2110
-
-		case DEVICE_ID_IOIP_2110_RGB12:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_IOIP_2110_RGB12:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_IOIP_2110_RGB12
-
-		case DEVICE_ID_IOX3:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_IOX3:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_IOX3
-
-		case DEVICE_ID_IOXT:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_IOXT:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_IOXT
-
-		case DEVICE_ID_KONA1:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONA1:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONA1
-
-		case DEVICE_ID_KONA3G:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONA3G:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONA3G
-
-		case DEVICE_ID_KONA3GQUAD:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONA3GQUAD:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONA3GQUAD
-
-		case DEVICE_ID_KONA4:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONA4:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONA4
-
-		case DEVICE_ID_KONA4UFC:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONA4UFC:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONA4UFC
-
-		case DEVICE_ID_KONA5:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONA5:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONA5
-
-		case DEVICE_ID_KONA5_2X4K:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONA5_2X4K:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONA5_2X4K
-
-		case DEVICE_ID_KONA5_3DLUT:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONA5_3DLUT:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONA5_3DLUT
-
-		case DEVICE_ID_KONA5_8K:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONA5_8K:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONA5_8K
-
-		case DEVICE_ID_KONA5_8K_MV_TX:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONA5_8K_MV_TX:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONA5_8K_MV_TX
-
-		case DEVICE_ID_KONA5_8KMK:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONA5_8KMK:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONA5_8KMK
-
-		case DEVICE_ID_KONA5_OE1:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONA5_OE1:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONA5_OE1
-
-		case DEVICE_ID_KONA5_OE10:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONA5_OE10:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONA5_OE10
-
-		case DEVICE_ID_KONA5_OE11:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONA5_OE11:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONA5_OE11
-
-		case DEVICE_ID_KONA5_OE12:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONA5_OE12:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONA5_OE12
-
-		case DEVICE_ID_KONA5_OE2:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONA5_OE2:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONA5_OE2
-
-		case DEVICE_ID_KONA5_OE3:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONA5_OE3:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONA5_OE3
-
-		case DEVICE_ID_KONA5_OE4:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONA5_OE4:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONA5_OE4
-
-		case DEVICE_ID_KONA5_OE5:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONA5_OE5:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONA5_OE5
-
-		case DEVICE_ID_KONA5_OE6:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONA5_OE6:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONA5_OE6
-
-		case DEVICE_ID_KONA5_OE7:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONA5_OE7:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONA5_OE7
-
-		case DEVICE_ID_KONA5_OE8:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONA5_OE8:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONA5_OE8
-
-		case DEVICE_ID_KONA5_OE9:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONA5_OE9:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONA5_OE9
-
-		case DEVICE_ID_KONAHDMI:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONAHDMI:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONAHDMI
-
-		case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K
-
-		case DEVICE_ID_KONAIP_1RX_1TX_2110:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONAIP_1RX_1TX_2110
-
-		case DEVICE_ID_KONAIP_2022:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONAIP_2022:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONAIP_2022
-
-		case DEVICE_ID_KONAIP_2110:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONAIP_2110:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONAIP_2110
-
-		case DEVICE_ID_KONAIP_2110_RGB12:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONAIP_2110_RGB12:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONAIP_2110_RGB12
-
-		case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONAIP_2TX_1SFP_J2K
-
-		case DEVICE_ID_KONAIP_4CH_2SFP:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONAIP_4CH_2SFP:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONAIP_4CH_2SFP
-
-		case DEVICE_ID_KONALHEPLUS:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONALHEPLUS:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONALHEPLUS
-
-		case DEVICE_ID_KONALHI:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONALHI:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONALHI
-
-		case DEVICE_ID_KONALHIDVI:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONALHIDVI:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONALHIDVI
-
-		case DEVICE_ID_KONAX:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONAX:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONAX
-
-		case DEVICE_ID_KONAXM:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_KONAXM:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_KONAXM
-
-		case DEVICE_ID_SOJI_3DLUT:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_SOJI_3DLUT:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_SOJI_3DLUT
-
-		case DEVICE_ID_SOJI_DIAGS:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_SOJI_DIAGS:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_SOJI_DIAGS
-
-		case DEVICE_ID_SOJI_OE1:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_SOJI_OE1:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_SOJI_OE1
-
-		case DEVICE_ID_SOJI_OE2:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_SOJI_OE2:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_SOJI_OE2
-
-		case DEVICE_ID_SOJI_OE3:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_SOJI_OE3:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_SOJI_OE3
-
-		case DEVICE_ID_SOJI_OE4:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_SOJI_OE4:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_SOJI_OE4
-
-		case DEVICE_ID_SOJI_OE5:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_SOJI_OE5:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_SOJI_OE5
-
-		case DEVICE_ID_SOJI_OE6:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_SOJI_OE6:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_SOJI_OE6
-
-		case DEVICE_ID_SOJI_OE7:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_SOJI_OE7:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_SOJI_OE7
-
-		case DEVICE_ID_TTAP:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_TTAP:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_TTAP
-
-		case DEVICE_ID_TTAP_PRO:
-			switch (inVideoFormat)
-			{
-				case NTV2_FORMAT_1080i_5000:
-				case NTV2_FORMAT_1080i_5994:
-				case NTV2_FORMAT_1080i_6000:
-				case NTV2_FORMAT_1080p_2398:
-				case NTV2_FORMAT_1080p_2400:
-				case NTV2_FORMAT_1080p_2500:
-				case NTV2_FORMAT_1080p_2997:
-				case NTV2_FORMAT_1080p_2K_2398:
-				case NTV2_FORMAT_1080p_2K_2400:
-				case NTV2_FORMAT_1080p_2K_2500:
-				case NTV2_FORMAT_1080p_2K_2997:
-				case NTV2_FORMAT_1080p_2K_3000:
-				case NTV2_FORMAT_1080p_2K_4795_A:
-				case NTV2_FORMAT_1080p_2K_4800_A:
-				case NTV2_FORMAT_1080p_2K_5000_A:
-				case NTV2_FORMAT_1080p_2K_5994_A:
-				case NTV2_FORMAT_1080p_2K_6000_A:
-				case NTV2_FORMAT_1080p_3000:
-				case NTV2_FORMAT_1080p_5000_A:
-				case NTV2_FORMAT_1080p_5994_A:
-				case NTV2_FORMAT_1080p_6000_A:
-				case NTV2_FORMAT_1080psf_2398:
-				case NTV2_FORMAT_1080psf_2400:
-				case NTV2_FORMAT_1080psf_2500_2:
-				case NTV2_FORMAT_1080psf_2997_2:
-				case NTV2_FORMAT_1080psf_2K_2398:
-				case NTV2_FORMAT_1080psf_2K_2400:
-				case NTV2_FORMAT_1080psf_2K_2500:
-				case NTV2_FORMAT_1080psf_3000_2:
-				case NTV2_FORMAT_3840x2160p_2398:
-				case NTV2_FORMAT_3840x2160p_2400:
-				case NTV2_FORMAT_3840x2160p_2500:
-				case NTV2_FORMAT_3840x2160p_2997:
-				case NTV2_FORMAT_3840x2160p_3000:
-				case NTV2_FORMAT_3840x2160p_5000:
-				case NTV2_FORMAT_3840x2160p_5994:
-				case NTV2_FORMAT_3840x2160p_6000:
-				case NTV2_FORMAT_4096x2160p_2398:
-				case NTV2_FORMAT_4096x2160p_2400:
-				case NTV2_FORMAT_4096x2160p_2500:
-				case NTV2_FORMAT_4096x2160p_2997:
-				case NTV2_FORMAT_4096x2160p_3000:
-				case NTV2_FORMAT_4096x2160p_4795:
-				case NTV2_FORMAT_4096x2160p_4800:
-				case NTV2_FORMAT_4096x2160p_5000:
-				case NTV2_FORMAT_4096x2160p_5994:
-				case NTV2_FORMAT_4096x2160p_6000:
-				case NTV2_FORMAT_525_5994:
-				case NTV2_FORMAT_525psf_2997:
-				case NTV2_FORMAT_625_5000:
-				case NTV2_FORMAT_625psf_2500:
-				case NTV2_FORMAT_720p_5000:
-				case NTV2_FORMAT_720p_5994:
-				case NTV2_FORMAT_720p_6000:
-					return true;
-			#if defined(_DEBUG)		// NTV2VideoFormats not supported by DEVICE_ID_TTAP_PRO:
-				case NTV2_FORMAT_1080p_2K_4795_B:
-				case NTV2_FORMAT_1080p_2K_4800_B:
-				case NTV2_FORMAT_1080p_2K_5000_B:
-				case NTV2_FORMAT_1080p_2K_5994_B:
-				case NTV2_FORMAT_1080p_2K_6000_B:
-				case NTV2_FORMAT_1080p_5000_B:
-				case NTV2_FORMAT_1080p_5994_B:
-				case NTV2_FORMAT_1080p_6000_B:
-				case NTV2_FORMAT_2K_1498:
-				case NTV2_FORMAT_2K_1500:
-				case NTV2_FORMAT_2K_2398:
-				case NTV2_FORMAT_2K_2400:
-				case NTV2_FORMAT_2K_2500:
-				case NTV2_FORMAT_3840x2160p_5000_B:
-				case NTV2_FORMAT_3840x2160p_5994_B:
-				case NTV2_FORMAT_3840x2160p_6000_B:
-				case NTV2_FORMAT_3840x2160psf_2398:
-				case NTV2_FORMAT_3840x2160psf_2400:
-				case NTV2_FORMAT_3840x2160psf_2500:
-				case NTV2_FORMAT_3840x2160psf_2997:
-				case NTV2_FORMAT_3840x2160psf_3000:
-				case NTV2_FORMAT_4096x2160p_11988:
-				case NTV2_FORMAT_4096x2160p_12000:
-				case NTV2_FORMAT_4096x2160p_4795_B:
-				case NTV2_FORMAT_4096x2160p_4800_B:
-				case NTV2_FORMAT_4096x2160p_5000_B:
-				case NTV2_FORMAT_4096x2160p_5994_B:
-				case NTV2_FORMAT_4096x2160p_6000_B:
-				case NTV2_FORMAT_4096x2160psf_2398:
-				case NTV2_FORMAT_4096x2160psf_2400:
-				case NTV2_FORMAT_4096x2160psf_2500:
-				case NTV2_FORMAT_4096x2160psf_2997:
-				case NTV2_FORMAT_4096x2160psf_3000:
-				case NTV2_FORMAT_4x1920x1080p_2398:
-				case NTV2_FORMAT_4x1920x1080p_2400:
-				case NTV2_FORMAT_4x1920x1080p_2500:
-				case NTV2_FORMAT_4x1920x1080p_2997:
-				case NTV2_FORMAT_4x1920x1080p_3000:
-				case NTV2_FORMAT_4x1920x1080p_5000:
-				case NTV2_FORMAT_4x1920x1080p_5000_B:
-				case NTV2_FORMAT_4x1920x1080p_5994:
-				case NTV2_FORMAT_4x1920x1080p_5994_B:
-				case NTV2_FORMAT_4x1920x1080p_6000:
-				case NTV2_FORMAT_4x1920x1080p_6000_B:
-				case NTV2_FORMAT_4x1920x1080psf_2398:
-				case NTV2_FORMAT_4x1920x1080psf_2400:
-				case NTV2_FORMAT_4x1920x1080psf_2500:
-				case NTV2_FORMAT_4x1920x1080psf_2997:
-				case NTV2_FORMAT_4x1920x1080psf_3000:
-				case NTV2_FORMAT_4x2048x1080p_11988:
-				case NTV2_FORMAT_4x2048x1080p_12000:
-				case NTV2_FORMAT_4x2048x1080p_2398:
-				case NTV2_FORMAT_4x2048x1080p_2400:
-				case NTV2_FORMAT_4x2048x1080p_2500:
-				case NTV2_FORMAT_4x2048x1080p_2997:
-				case NTV2_FORMAT_4x2048x1080p_3000:
-				case NTV2_FORMAT_4x2048x1080p_4795:
-				case NTV2_FORMAT_4x2048x1080p_4795_B:
-				case NTV2_FORMAT_4x2048x1080p_4800:
-				case NTV2_FORMAT_4x2048x1080p_4800_B:
-				case NTV2_FORMAT_4x2048x1080p_5000:
-				case NTV2_FORMAT_4x2048x1080p_5000_B:
-				case NTV2_FORMAT_4x2048x1080p_5994:
-				case NTV2_FORMAT_4x2048x1080p_5994_B:
-				case NTV2_FORMAT_4x2048x1080p_6000:
-				case NTV2_FORMAT_4x2048x1080p_6000_B:
-				case NTV2_FORMAT_4x2048x1080psf_2398:
-				case NTV2_FORMAT_4x2048x1080psf_2400:
-				case NTV2_FORMAT_4x2048x1080psf_2500:
-				case NTV2_FORMAT_4x2048x1080psf_2997:
-				case NTV2_FORMAT_4x2048x1080psf_3000:
-				case NTV2_FORMAT_4x3840x2160p_2398:
-				case NTV2_FORMAT_4x3840x2160p_2400:
-				case NTV2_FORMAT_4x3840x2160p_2500:
-				case NTV2_FORMAT_4x3840x2160p_2997:
-				case NTV2_FORMAT_4x3840x2160p_3000:
-				case NTV2_FORMAT_4x3840x2160p_5000:
-				case NTV2_FORMAT_4x3840x2160p_5000_B:
-				case NTV2_FORMAT_4x3840x2160p_5994:
-				case NTV2_FORMAT_4x3840x2160p_5994_B:
-				case NTV2_FORMAT_4x3840x2160p_6000:
-				case NTV2_FORMAT_4x3840x2160p_6000_B:
-				case NTV2_FORMAT_4x4096x2160p_2398:
-				case NTV2_FORMAT_4x4096x2160p_2400:
-				case NTV2_FORMAT_4x4096x2160p_2500:
-				case NTV2_FORMAT_4x4096x2160p_2997:
-				case NTV2_FORMAT_4x4096x2160p_3000:
-				case NTV2_FORMAT_4x4096x2160p_4795:
-				case NTV2_FORMAT_4x4096x2160p_4795_B:
-				case NTV2_FORMAT_4x4096x2160p_4800:
-				case NTV2_FORMAT_4x4096x2160p_4800_B:
-				case NTV2_FORMAT_4x4096x2160p_5000:
-				case NTV2_FORMAT_4x4096x2160p_5000_B:
-				case NTV2_FORMAT_4x4096x2160p_5994:
-				case NTV2_FORMAT_4x4096x2160p_5994_B:
-				case NTV2_FORMAT_4x4096x2160p_6000:
-				case NTV2_FORMAT_4x4096x2160p_6000_B:
-				case NTV2_FORMAT_525_2398:
-				case NTV2_FORMAT_525_2400:
-				case NTV2_FORMAT_720p_2398:
-				case NTV2_FORMAT_720p_2500:
-				case NTV2_FORMAT_END_2K_DEF_FORMATS:
-				case NTV2_FORMAT_END_4K_DEF_FORMATS2:
-				case NTV2_FORMAT_END_4K_TSI_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS:
-				case NTV2_FORMAT_END_HIGH_DEF_FORMATS2:
-				case NTV2_FORMAT_END_STANDARD_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_DEF_FORMATS:
-				case NTV2_FORMAT_END_UHD2_FULL_DEF_FORMATS:
-				case NTV2_FORMAT_UNKNOWN:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inVideoFormat
-			break;	//	case DEVICE_ID_TTAP_PRO
-
-		case DEVICE_ID_NOTFOUND:
-			break;	//	case DEVICE_ID_NOTFOUND
-	}	//  switch on device ID
-
-	return false;
+	const int row = NTV2DeviceCapsTableRow(inDeviceID);
+	if (row < 0  ||  (ULWord) inVideoFormat >= (ULWord) NTV2_MAX_NUM_VIDEO_FORMATS)
+		return false;
+	return NTV2_CAPS_TABLE_HAS(gVideoFormatCaps, row, (ULWord) inVideoFormat) ? true : false;
 
 }	//  NTV2DeviceCanDoVideoFormat (auto-generated)
 
@@ -30516,8854 +12875,83 @@ bool NTV2DeviceCanDoVideoFormat (const NTV2DeviceID inDeviceID, const NTV2VideoF
 /**
 	NTV2DeviceCanDoWidget
 **/
+static const ULWord gWidgetCaps [][NTV2_CAPS_TABLE_WORDS(NTV2_WgtModuleTypeCount)] =
+{
+	{0x00010403, 0x00004000, 0x00000000, 0x00000000},	//	DEVICE_ID_CORVID1
+	{0x00303033, 0x00014040, 0x00000000, 0x00000000},	//	DEVICE_ID_CORVID22
+	{0x66F0F0FF, 0x03FD4040, 0x00000000, 0x00000000},	//	DEVICE_ID_CORVID24
+	{0x00101033, 0x00004040, 0x00000000, 0x00000000},	//	DEVICE_ID_CORVID3G
+	{0x66F0F0FF, 0x03FD4040, 0xC0000000, 0x00000003},	//	DEVICE_ID_CORVID44
+	{0x660000F3, 0x00F04040, 0x00000000, 0x000103FC},	//	DEVICE_ID_CORVID44_2X4K
+	{0x6600000F, 0x00F04000, 0x00000000, 0x000103FC},	//	DEVICE_ID_CORVID44_8K
+	{0x0000003F, 0x01014040, 0x00000000, 0x000103FC},	//	DEVICE_ID_CORVID44_8KMK
+	{0x0000000F, 0x00004000, 0x00000000, 0x0000007C},	//	DEVICE_ID_CORVID44_PLNR
+	{0x66F0F0FF, 0xE3FD4040, 0xCFFFFFFE, 0x00000003},	//	DEVICE_ID_CORVID88
+	{0x000000FF, 0x070C0000, 0x00000001, 0x00000000},	//	DEVICE_ID_CORVIDHBR
+	{0x0000F03F, 0x03014040, 0xCFC001E0, 0x00000003},	//	DEVICE_ID_CORVIDHEVC
+	{0x66F0F0FF, 0xFFFD4040, 0xC0000001, 0x00000003},	//	DEVICE_ID_IO4K
+	{0x66B0E0FF, 0xF3FD4040, 0xC0000001, 0x00004507},	//	DEVICE_ID_IO4KPLUS
+	{0x663030F3, 0xF00140D0, 0x30000000, 0x00000000},	//	DEVICE_ID_IO4KUFC
+	{0x00010701, 0x0000409D, 0x00000000, 0x00000000},	//	DEVICE_ID_IOEXPRESS
+	{0x66F0F0FF, 0xF3FD4040, 0xC0000001, 0x00004003},	//	DEVICE_ID_IOIP_2022
+	{0x66F0F0FF, 0xF3FD4040, 0xC0000001, 0x00004003},	//	DEVICE_ID_IOIP_2110
+	{0x60F000F3, 0xF3CC4000, 0xC0000000, 0x00004000},	//	DEVICE_ID_IOIP_2110_RGB12
+	{0x66F0F0FF, 0x0FFD4040, 0x00000000, 0x00000000},	//	DEVICE_ID_IOX3
+	{0x663030F3, 0x000040DD, 0x00000000, 0x00000000},	//	DEVICE_ID_IOXT
+	{0x221010F3, 0x00004040, 0x00000000, 0x00000000},	//	DEVICE_ID_KONA1
+	{0x663030F3, 0x000140D9, 0x00000000, 0x00000000},	//	DEVICE_ID_KONA3G
+	{0x66F0F0FF, 0x03FD40C9, 0x00000000, 0x00000000},	//	DEVICE_ID_KONA3GQUAD
+	{0x66F0F0FF, 0x6BFD4041, 0xC0000001, 0x00000003},	//	DEVICE_ID_KONA4
+	{0x663030F3, 0x800140D1, 0x20000000, 0x00000000},	//	DEVICE_ID_KONA4UFC
+	{0x66B0E0FF, 0x63FD4040, 0xC0000001, 0x00004107},	//	DEVICE_ID_KONA5
+	{0x660000F3, 0x00F04040, 0x00000000, 0x000143FC},	//	DEVICE_ID_KONA5_2X4K
+	{0x620000F3, 0x030C0040, 0x00000000, 0x000240CC},	//	DEVICE_ID_KONA5_3DLUT
+	{0x6600000F, 0x00F04000, 0x00000000, 0x000143FC},	//	DEVICE_ID_KONA5_8K
+	{0x6200000F, 0x00C04000, 0x00000000, 0x000143C4},	//	DEVICE_ID_KONA5_8K_MV_TX
+	{0x0000003F, 0x00004040, 0x00000000, 0x000143FC},	//	DEVICE_ID_KONA5_8KMK
+	{0x42000033, 0x03000040, 0x00000000, 0x000840CC},	//	DEVICE_ID_KONA5_OE1
+	{0x42000033, 0x03000040, 0x00000000, 0x000840CC},	//	DEVICE_ID_KONA5_OE10
+	{0x42000033, 0x03000040, 0x00000000, 0x000840CC},	//	DEVICE_ID_KONA5_OE11
+	{0x42000033, 0x03000040, 0x00000000, 0x000840CC},	//	DEVICE_ID_KONA5_OE12
+	{0x42000033, 0x03000040, 0x00000000, 0x000840CC},	//	DEVICE_ID_KONA5_OE2
+	{0x42000033, 0x03000040, 0x00000000, 0x000840CC},	//	DEVICE_ID_KONA5_OE3
+	{0x42000033, 0x03000040, 0x00000000, 0x000840CC},	//	DEVICE_ID_KONA5_OE4
+	{0x42000033, 0x03000040, 0x00000000, 0x000840CC},	//	DEVICE_ID_KONA5_OE5
+	{0x42000033, 0x03000040, 0x00000000, 0x000840CC},	//	DEVICE_ID_KONA5_OE6
+	{0x42000033, 0x03000040, 0x00000000, 0x000840CC},	//	DEVICE_ID_KONA5_OE7
+	{0x42000033, 0x03000040, 0x00000000, 0x000840CC},	//	DEVICE_ID_KONA5_OE8
+	{0x42000033, 0x03000040, 0x00000000, 0x000840CC},	//	DEVICE_ID_KONA5_OE9
+	{0x000000FF, 0x630C4000, 0xC03F0000, 0x00003C03},	//	DEVICE_ID_KONAHDMI
+	{0x001010FF, 0x00014040, 0x20000000, 0x00000000},	//	DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K
+	{0x66F0F0FF, 0x03FD4040, 0x20000000, 0x00000000},	//	DEVICE_ID_KONAIP_1RX_1TX_2110
+	{0x66F0F0FF, 0x63FD4040, 0x20000000, 0x00000000},	//	DEVICE_ID_KONAIP_2022
+	{0x60F0F0FF, 0x0BCD4040, 0xC0000001, 0x00000003},	//	DEVICE_ID_KONAIP_2110
+	{0x60F000F3, 0x0BCC4000, 0xC0000000, 0x00000003},	//	DEVICE_ID_KONAIP_2110_RGB12
+	{0x003000FF, 0x00014040, 0x20000000, 0x00000000},	//	DEVICE_ID_KONAIP_2TX_1SFP_J2K
+	{0x66F0F0FF, 0x63FD4040, 0x20000000, 0x00000000},	//	DEVICE_ID_KONAIP_4CH_2SFP
+	{0x80030453, 0x000040D1, 0x00000000, 0x00000000},	//	DEVICE_ID_KONALHEPLUS
+	{0x80030FF3, 0x0000405D, 0x00000000, 0x00000000},	//	DEVICE_ID_KONALHI
+	{0x80030FF3, 0x0000405D, 0x00000000, 0x00000000},	//	DEVICE_ID_KONALHIDVI
+	{0x660000F3, 0x01004040, 0x00000000, 0x001080CC},	//	DEVICE_ID_KONAX
+	{0x6600003F, 0x01004040, 0x00000000, 0x001080CC},	//	DEVICE_ID_KONAXM
+	{0x620000F3, 0x030C0040, 0x00000000, 0x000240CC},	//	DEVICE_ID_SOJI_3DLUT
+	{0x620000F3, 0x030C0040, 0x00000000, 0x000240CC},	//	DEVICE_ID_SOJI_DIAGS
+	{0x42000033, 0x03000040, 0x00000000, 0x000840CC},	//	DEVICE_ID_SOJI_OE1
+	{0x42000033, 0x03000040, 0x00000000, 0x000840CC},	//	DEVICE_ID_SOJI_OE2
+	{0x42000033, 0x03000040, 0x00000000, 0x000840CC},	//	DEVICE_ID_SOJI_OE3
+	{0x42000033, 0x03000040, 0x00000000, 0x000840CC},	//	DEVICE_ID_SOJI_OE4
+	{0x42000033, 0x03000040, 0x00000000, 0x000840CC},	//	DEVICE_ID_SOJI_OE5
+	{0x42000033, 0x03000040, 0x00000000, 0x000840CC},	//	DEVICE_ID_SOJI_OE6
+	{0x42000033, 0x03000040, 0x00000000, 0x000840CC},	//	DEVICE_ID_SOJI_OE7
+	{0x00010001, 0x00004088, 0x00000000, 0x00000000},	//	DEVICE_ID_TTAP
+	{0x20000051, 0x00004000, 0x00000000, 0x00008040} 	//	DEVICE_ID_TTAP_PRO
+};
+
 bool NTV2DeviceCanDoWidget (const NTV2DeviceID inDeviceID, const NTV2WidgetID inWidgetID)
 {
-	switch (inDeviceID)
-	{
-		case DEVICE_ID_CORVID1:
-			switch (inWidgetID)
-			{
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIOut1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_CORVID1:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_CORVID1
-
-		case DEVICE_ID_CORVID22:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_CORVID22:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_CORVID22
-
-		case DEVICE_ID_CORVID24:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_CORVID24:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_CORVID24
-
-		case DEVICE_ID_CORVID3G:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtMixer1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_CORVID3G:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_CORVID3G
-
-		case DEVICE_ID_CORVID44:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_CORVID44:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_CORVID44
-
-		case DEVICE_ID_CORVID44_2X4K:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMultiLinkOut1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_CORVID44_2X4K:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_CORVID44_2X4K
-
-		case DEVICE_ID_CORVID44_8K:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtMultiLinkOut1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_CORVID44_8K:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_CORVID44_8K
-
-		case DEVICE_ID_CORVID44_8KMK:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMultiLinkOut1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_CORVID44_8KMK:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_CORVID44_8KMK
-
-		case DEVICE_ID_CORVID44_PLNR:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtGenLock:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_CORVID44_PLNR:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_CORVID44_PLNR
-
-		case DEVICE_ID_CORVID88:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_CORVID88:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_CORVID88
-
-		case DEVICE_ID_CORVIDHBR:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_CORVIDHBR:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_CORVIDHBR
-
-		case DEVICE_ID_CORVIDHEVC:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_CORVIDHEVC:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_CORVIDHEVC
-
-		case DEVICE_ID_IO4K:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtSDIMonOut1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_IO4K:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_IO4K
-
-		case DEVICE_ID_IO4KPLUS:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtSDIMonOut1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_IO4KPLUS:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_IO4KPLUS
-
-		case DEVICE_ID_IO4KUFC:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtUpDownConverter1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_IO4KUFC:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_IO4KUFC
-
-		case DEVICE_ID_IOEXPRESS:
-			switch (inWidgetID)
-			{
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtUpDownConverter1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_IOEXPRESS:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_IOEXPRESS
-
-		case DEVICE_ID_IOIP_2022:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtSDIMonOut1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_IOIP_2022:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_IOIP_2022
-
-		case DEVICE_ID_IOIP_2110:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtSDIMonOut1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_IOIP_2110:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_IOIP_2110
-
-		case DEVICE_ID_IOIP_2110_RGB12:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtSDIMonOut1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_IOIP_2110_RGB12:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_IOIP_2110_RGB12
-
-		case DEVICE_ID_IOX3:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_IOX3:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_IOX3
-
-		case DEVICE_ID_IOXT:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtUpDownConverter1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_IOXT:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_IOXT
-
-		case DEVICE_ID_KONA1:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtMixer1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONA1:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONA1
-
-		case DEVICE_ID_KONA3G:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtUpDownConverter1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONA3G:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONA3G
-
-		case DEVICE_ID_KONA3GQUAD:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONA3GQUAD:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONA3GQUAD
-
-		case DEVICE_ID_KONA4:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONA4:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONA4
-
-		case DEVICE_ID_KONA4UFC:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtUpDownConverter1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONA4UFC:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONA4UFC
-
-		case DEVICE_ID_KONA5:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONA5:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONA5
-
-		case DEVICE_ID_KONA5_2X4K:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMultiLinkOut1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONA5_2X4K:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONA5_2X4K
-
-		case DEVICE_ID_KONA5_3DLUT:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtMixer1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONA5_3DLUT:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONA5_3DLUT
-
-		case DEVICE_ID_KONA5_8K:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtMultiLinkOut1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONA5_8K:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONA5_8K
-
-		case DEVICE_ID_KONA5_8K_MV_TX:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtMultiLinkOut1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONA5_8K_MV_TX:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONA5_8K_MV_TX
-
-		case DEVICE_ID_KONA5_8KMK:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMultiLinkOut1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONA5_8KMK:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONA5_8KMK
-
-		case DEVICE_ID_KONA5_OE1:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtOE1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONA5_OE1:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONA5_OE1
-
-		case DEVICE_ID_KONA5_OE10:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtOE1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONA5_OE10:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONA5_OE10
-
-		case DEVICE_ID_KONA5_OE11:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtOE1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONA5_OE11:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONA5_OE11
-
-		case DEVICE_ID_KONA5_OE12:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtOE1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONA5_OE12:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONA5_OE12
-
-		case DEVICE_ID_KONA5_OE2:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtOE1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONA5_OE2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONA5_OE2
-
-		case DEVICE_ID_KONA5_OE3:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtOE1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONA5_OE3:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONA5_OE3
-
-		case DEVICE_ID_KONA5_OE4:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtOE1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONA5_OE4:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONA5_OE4
-
-		case DEVICE_ID_KONA5_OE5:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtOE1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONA5_OE5:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONA5_OE5
-
-		case DEVICE_ID_KONA5_OE6:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtOE1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONA5_OE6:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONA5_OE6
-
-		case DEVICE_ID_KONA5_OE7:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtOE1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONA5_OE7:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONA5_OE7
-
-		case DEVICE_ID_KONA5_OE8:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtOE1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONA5_OE8:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONA5_OE8
-
-		case DEVICE_ID_KONA5_OE9:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtOE1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONA5_OE9:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONA5_OE9
-
-		case DEVICE_ID_KONAHDMI:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONAHDMI:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONAHDMI
-
-		case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONAIP_1RX_1TX_1SFP_J2K
-
-		case DEVICE_ID_KONAIP_1RX_1TX_2110:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONAIP_1RX_1TX_2110:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONAIP_1RX_1TX_2110
-
-		case DEVICE_ID_KONAIP_2022:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONAIP_2022:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONAIP_2022
-
-		case DEVICE_ID_KONAIP_2110:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONAIP_2110:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONAIP_2110
-
-		case DEVICE_ID_KONAIP_2110_RGB12:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONAIP_2110_RGB12:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONAIP_2110_RGB12
-
-		case DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONAIP_2TX_1SFP_J2K:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONAIP_2TX_1SFP_J2K
-
-		case DEVICE_ID_KONAIP_4CH_2SFP:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONAIP_4CH_2SFP:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONAIP_4CH_2SFP
-
-		case DEVICE_ID_KONALHEPLUS:
-			switch (inWidgetID)
-			{
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtUpDownConverter1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONALHEPLUS:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONALHEPLUS
-
-		case DEVICE_ID_KONALHI:
-			switch (inWidgetID)
-			{
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtUpDownConverter1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONALHI:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONALHI
-
-		case DEVICE_ID_KONALHIDVI:
-			switch (inWidgetID)
-			{
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtUpDownConverter1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONALHIDVI:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONALHIDVI
-
-		case DEVICE_ID_KONAX:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtMixer1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONAX:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONAX
-
-		case DEVICE_ID_KONAXM:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtMixer1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_KONAXM:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_KONAXM
-
-		case DEVICE_ID_SOJI_3DLUT:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtMixer1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_SOJI_3DLUT:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_SOJI_3DLUT
-
-		case DEVICE_ID_SOJI_DIAGS:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtMixer1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_SOJI_DIAGS:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_SOJI_DIAGS
-
-		case DEVICE_ID_SOJI_OE1:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtOE1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_SOJI_OE1:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_SOJI_OE1
-
-		case DEVICE_ID_SOJI_OE2:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtOE1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_SOJI_OE2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_SOJI_OE2
-
-		case DEVICE_ID_SOJI_OE3:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtOE1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_SOJI_OE3:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_SOJI_OE3
-
-		case DEVICE_ID_SOJI_OE4:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtOE1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_SOJI_OE4:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_SOJI_OE4
-
-		case DEVICE_ID_SOJI_OE5:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtOE1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_SOJI_OE5:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_SOJI_OE5
-
-		case DEVICE_ID_SOJI_OE6:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtOE1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_SOJI_OE6:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_SOJI_OE6
-
-		case DEVICE_ID_SOJI_OE7:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtOE1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_SOJI_OE7:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_SOJI_OE7
-
-		case DEVICE_ID_TTAP:
-			switch (inWidgetID)
-			{
-				case NTV2_WgtCompression1:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtSDIOut1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_TTAP:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT1:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_TTAP
-
-		case DEVICE_ID_TTAP_PRO:
-			switch (inWidgetID)
-			{
-				case NTV2_Wgt12GSDIOut1:
-				case NTV2_WgtCSC1:
-				case NTV2_WgtDualLinkV2Out1:
-				case NTV2_WgtFrameBuffer1:
-				case NTV2_WgtGenLock:
-				case NTV2_WgtHDMIOut1v5:
-				case NTV2_WgtLUT1:
-					return true;
-			#if defined(_DEBUG)		// NTV2WidgetIDs not supported by DEVICE_ID_TTAP_PRO:
-				case NTV2_Wgt12GSDIIn1:
-				case NTV2_Wgt12GSDIIn2:
-				case NTV2_Wgt12GSDIIn3:
-				case NTV2_Wgt12GSDIIn4:
-				case NTV2_Wgt12GSDIOut2:
-				case NTV2_Wgt12GSDIOut3:
-				case NTV2_Wgt12GSDIOut4:
-				case NTV2_Wgt3DLUT1:
-				case NTV2_Wgt3GSDIIn1:
-				case NTV2_Wgt3GSDIIn2:
-				case NTV2_Wgt3GSDIIn3:
-				case NTV2_Wgt3GSDIIn4:
-				case NTV2_Wgt3GSDIIn5:
-				case NTV2_Wgt3GSDIIn6:
-				case NTV2_Wgt3GSDIIn7:
-				case NTV2_Wgt3GSDIIn8:
-				case NTV2_Wgt3GSDIOut1:
-				case NTV2_Wgt3GSDIOut2:
-				case NTV2_Wgt3GSDIOut3:
-				case NTV2_Wgt3GSDIOut4:
-				case NTV2_Wgt3GSDIOut5:
-				case NTV2_Wgt3GSDIOut6:
-				case NTV2_Wgt3GSDIOut7:
-				case NTV2_Wgt3GSDIOut8:
-				case NTV2_Wgt425Mux1:
-				case NTV2_Wgt425Mux2:
-				case NTV2_Wgt425Mux3:
-				case NTV2_Wgt425Mux4:
-				case NTV2_Wgt4KDownConverter:
-				case NTV2_WgtAnalogCompositeOut1:
-				case NTV2_WgtAnalogIn1:
-				case NTV2_WgtAnalogOut1:
-				case NTV2_WgtCompression1:
-				case NTV2_WgtCSC2:
-				case NTV2_WgtCSC3:
-				case NTV2_WgtCSC4:
-				case NTV2_WgtCSC5:
-				case NTV2_WgtCSC6:
-				case NTV2_WgtCSC7:
-				case NTV2_WgtCSC8:
-				case NTV2_WgtDCIMixer1:
-				case NTV2_WgtDualLinkIn1:
-				case NTV2_WgtDualLinkOut1:
-				case NTV2_WgtDualLinkOut2:
-				case NTV2_WgtDualLinkV2In1:
-				case NTV2_WgtDualLinkV2In2:
-				case NTV2_WgtDualLinkV2In3:
-				case NTV2_WgtDualLinkV2In4:
-				case NTV2_WgtDualLinkV2In5:
-				case NTV2_WgtDualLinkV2In6:
-				case NTV2_WgtDualLinkV2In7:
-				case NTV2_WgtDualLinkV2In8:
-				case NTV2_WgtDualLinkV2Out2:
-				case NTV2_WgtDualLinkV2Out3:
-				case NTV2_WgtDualLinkV2Out4:
-				case NTV2_WgtDualLinkV2Out5:
-				case NTV2_WgtDualLinkV2Out6:
-				case NTV2_WgtDualLinkV2Out7:
-				case NTV2_WgtDualLinkV2Out8:
-				case NTV2_WgtFrameBuffer2:
-				case NTV2_WgtFrameBuffer3:
-				case NTV2_WgtFrameBuffer4:
-				case NTV2_WgtFrameBuffer5:
-				case NTV2_WgtFrameBuffer6:
-				case NTV2_WgtFrameBuffer7:
-				case NTV2_WgtFrameBuffer8:
-				case NTV2_WgtFrameSync1:
-				case NTV2_WgtFrameSync2:
-				case NTV2_WgtHDMIIn1:
-				case NTV2_WgtHDMIIn1v2:
-				case NTV2_WgtHDMIIn1v3:
-				case NTV2_WgtHDMIIn1v4:
-				case NTV2_WgtHDMIIn1v5:
-				case NTV2_WgtHDMIIn2v4:
-				case NTV2_WgtHDMIIn3v4:
-				case NTV2_WgtHDMIIn4v4:
-				case NTV2_WgtHDMIOut1:
-				case NTV2_WgtHDMIOut1v2:
-				case NTV2_WgtHDMIOut1v3:
-				case NTV2_WgtHDMIOut1v4:
-				case NTV2_WgtIICT1:
-				case NTV2_WgtIICT2:
-				case NTV2_WgtLUT2:
-				case NTV2_WgtLUT3:
-				case NTV2_WgtLUT4:
-				case NTV2_WgtLUT5:
-				case NTV2_WgtLUT6:
-				case NTV2_WgtLUT7:
-				case NTV2_WgtLUT8:
-				case NTV2_WgtMixer1:
-				case NTV2_WgtMixer2:
-				case NTV2_WgtMixer3:
-				case NTV2_WgtMixer4:
-				case NTV2_WgtMultiLinkOut1:
-				case NTV2_WgtMultiLinkOut2:
-				case NTV2_WgtOE1:
-				case NTV2_WgtProcAmp1:
-				case NTV2_WgtSDIIn1:
-				case NTV2_WgtSDIIn2:
-				case NTV2_WgtSDIMonOut1:
-				case NTV2_WgtSDIOut1:
-				case NTV2_WgtSDIOut2:
-				case NTV2_WgtSDIOut3:
-				case NTV2_WgtSDIOut4:
-				case NTV2_WgtStereoCompressor:
-				case NTV2_WgtTestPattern1:
-				case NTV2_WgtUpDownConverter1:
-				case NTV2_WgtUpDownConverter2:
-				case NTV2_WgtWaterMarker1:
-				case NTV2_WgtWaterMarker2:
-				case NTV2_WIDGET_INVALID:
-			#else
-				default:
-			#endif
-					break;
-			}	//	switch on inWidgetID
-			break;	//	case DEVICE_ID_TTAP_PRO
-
-		case DEVICE_ID_NOTFOUND:
-			break;	//	case DEVICE_ID_NOTFOUND
-	}	//  switch on device ID
-
-	return false;
+	const int row = NTV2DeviceCapsTableRow(inDeviceID);
+	if (row < 0  ||  (ULWord) inWidgetID >= (ULWord) NTV2_WgtModuleTypeCount)
+		return false;
+	return NTV2_CAPS_TABLE_HAS(gWidgetCaps, row, (ULWord) inWidgetID) ? true : false;
 
 }	//  NTV2DeviceCanDoWidget (auto-generated)
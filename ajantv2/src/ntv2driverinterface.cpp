@@ -80,6 +80,14 @@ CNTV2DriverInterface::CNTV2DriverInterface ()
 		_pRPCAPI						(AJA_NULL),
 		mInterruptEventHandles			(),
 		mEventCounts					(),
+		mRegCacheEnabled				(false),
+		mRegCacheValues					(),
+		mRegCacheFlags					(),
+		mRegCacheGens					(),
+		mRegCacheHits					(0),
+		mRegCacheMisses					(0),
+		mRegCacheLock					(),
+		mCaps							(),
 #if defined(NTV2_WRITEREG_PROFILING)
 		mRegWrites						(),
 		mRegWritesLock					(),
@@ -185,6 +193,7 @@ bool CNTV2DriverInterface::Open (const std::string & inURLSpec)
 	Close();
 	if (OpenRemote(inURLSpec))
 	{
+		InvalidateRegisterCache();
 		FinishOpen();
 		AJAAtomic::Increment(&gOpenCount);
 		DIDBGX(DEC(gOpenCount) << " opens, " << DEC(gCloseCount) << " closes");
@@ -205,6 +214,8 @@ bool CNTV2DriverInterface::Close (void)
 		if (closeOK)
 			AJAAtomic::Increment(&gCloseCount);
 		_boardID = DEVICE_ID_NOTFOUND;
+		mCaps = NTV2DeviceCapsSnapshot();
+		InvalidateRegisterCache();
 		DIDBGX(DEC(gOpenCount) << " opens, " << DEC(gCloseCount) << " closes");
 		return closeOK;
 	}
@@ -387,6 +398,11 @@ NTV2DeviceID CNTV2DriverInterface::GetDeviceID (void)
 	return DEVICE_ID_NOTFOUND;
 }
 
+int CNTV2DriverInterface::GetNUMANode (void)
+{
+	return -1;	//	Platform-specific subclasses that can find their PCIe device override this
+}
+
 
 // Common remote card read register.  Subclasses have overloaded function
 // that does platform-specific read of register on local card.
@@ -394,7 +410,13 @@ bool CNTV2DriverInterface::ReadRegister (const ULWord inRegNum, ULWord & outValu
 {
 #if defined(NTV2_NUB_CLIENT_SUPPORT)
 	if (IsRemote())
-		return _pRPCAPI->NTV2ReadRegisterRemote (inRegNum, outValue, inMask, inShift);
+	{
+		const ULWord shadowGen (ShadowRegisterGeneration(inRegNum));
+		if (!_pRPCAPI->NTV2ReadRegisterRemote (inRegNum, outValue, inMask, inShift))
+			return false;
+		ShadowStoreRegister(inRegNum, outValue, inMask, inShift, shadowGen);
+		return true;
+	}
 #else
 	(void) inRegNum;	(void) outValue;	(void) inMask;	(void) inShift;
 #endif
@@ -461,7 +483,10 @@ bool CNTV2DriverInterface::WriteRegister (const ULWord inRegNum, const ULWord in
 #endif	//	NTV2_WRITEREG_PROFILING
 #if defined(NTV2_NUB_CLIENT_SUPPORT)
 	//	If we get here, must be a non-physical device connection...
-	return IsRemote() ? _pRPCAPI->NTV2WriteRegisterRemote(inRegNum, inValue, inMask, inShift) : false;
+	if (!IsRemote()  ||  !_pRPCAPI->NTV2WriteRegisterRemote(inRegNum, inValue, inMask, inShift))
+		return false;
+	ShadowWriteRegister(inRegNum, inValue, inMask, inShift);
+	return true;
 #else
 	(void) inRegNum;	(void) inValue; (void) inMask;	(void) inShift;
 	return false;
@@ -559,6 +584,9 @@ bool CNTV2DriverInterface::AutoCirculate (AUTOCIRCULATE_DATA & autoCircData)
 			case eGetAutoCirc:
 			case eStopAutoCirc:
 			case eInitAutoCirc:
+			case ePrerollAutoCirculate:
+			case eSetActiveFrame:
+			case eStartAutoCircAtTime:
 				return _pRPCAPI->NTV2AutoCirculateRemote(autoCircData);
 			default:	// Others not handled
 				return false;
@@ -896,10 +924,39 @@ void CNTV2DriverInterface::FinishOpen (void)
 	_pCh1FrameBaseAddress = AJA_NULL;
 	_pCh2FrameBaseAddress = AJA_NULL;
 #endif	//	!defined(NTV2_DEPRECATE_16_0)
+	SnapshotCaps();
 
 }	//	FinishOpen
 
 
+void CNTV2DriverInterface::SnapshotCaps (void)
+{
+	//	Build it with mCaps invalid, so the queries go to the device features functions or remote device...
+	mCaps = NTV2DeviceCapsSnapshot();
+	NTV2DeviceCapsSnapshot caps;
+	caps.mBools.resize(size_t(kNTV2BoolParam_LAST), false);
+	for (size_t ndx(0);  ndx < caps.mBools.size();  ndx++)
+		caps.mBools[ndx] = IsSupported(NTV2BoolParamID(ndx));
+	caps.mNums.resize(size_t(kNTV2NumericParam_LAST - kNTV2NumericParam_FIRST), 0);
+	for (size_t ndx(0);  ndx < caps.mNums.size();  ndx++)
+		caps.mNums[ndx] = GetNumSupported(NTV2NumericParamID(kNTV2NumericParam_FIRST + ndx));
+	caps.mItems.resize(size_t(kNTV2EnumsID_INVALID));
+	caps.mItemBits.resize(size_t(kNTV2EnumsID_INVALID));
+	for (size_t ndx(0);  ndx < caps.mItems.size();  ndx++)
+	{
+		const ULWordSet & items (caps.mItems[ndx] = GetSupportedItems(NTV2EnumsID(ndx)));
+		if (items.empty()  ||  *items.rbegin() >= 4096)
+			continue;	//	Empty or sparse (e.g. NTV2DeviceID) -- CanDo uses the set
+		std::vector<bool> & bits (caps.mItemBits[ndx]);
+		bits.resize(size_t(*items.rbegin()) + 1, false);
+		for (ULWordSetConstIter it(items.begin());  it != items.end();  ++it)
+			bits[*it] = true;
+	}
+	caps.mDeviceID = _boardID;
+	mCaps = caps;
+}	//	SnapshotCaps
+
+
 bool CNTV2DriverInterface::ParseFlashHeader (BITFILE_INFO_STRUCT & bitFileInfo)
 {
 	if (!IsDeviceReady(false))
@@ -1268,6 +1325,190 @@ bool CNTV2DriverInterface::IsMBSystemReady (void)
 	return (val < 2) ? false : true;
 }
 
+//	Shadow Register Cache
+static const UByte	kRegCacheCacheable	(0x01);	//	Register value can be served from the cache
+static const UByte	kRegCacheValid		(0x02);	//	Cached register value is current
+
+NTV2RegNumSet CNTV2DriverInterface::GetDefaultCacheableRegisters (void)
+{
+	static const ULWord	sConfigRegs[] = {	kRegGlobalControl,		kRegGlobalControl2,		kRegGlobalControl3,
+											kRegGlobalControlCh2,	kRegGlobalControlCh3,	kRegGlobalControlCh4,	kRegGlobalControlCh5,
+											kRegGlobalControlCh6,	kRegGlobalControlCh7,	kRegGlobalControlCh8,
+											kRegCh1Control,			kRegCh2Control,			kRegCh3Control,			kRegCh4Control,
+											kRegCh5Control,			kRegCh6Control,			kRegCh7Control,			kRegCh8Control,
+											kRegVidProc1Control,	kRegVidProc2Control,	kRegVidProc3Control,	kRegVidProc4Control,
+											kRegSDIOut1Control,		kRegSDIOut2Control,		kRegSDIOut3Control,		kRegSDIOut4Control,
+											kRegSDIOut5Control,		kRegSDIOut6Control,		kRegSDIOut7Control,		kRegSDIOut8Control,
+											kRegXptSelectGroup1,	kRegXptSelectGroup2,	kRegXptSelectGroup3,	kRegXptSelectGroup4,
+											kRegXptSelectGroup5,	kRegXptSelectGroup6,	kRegXptSelectGroup7,	kRegXptSelectGroup8,
+											kRegXptSelectGroup9,	kRegXptSelectGroup10,	kRegXptSelectGroup11,	kRegXptSelectGroup12,
+											kRegXptSelectGroup13,	kRegXptSelectGroup14,	kRegXptSelectGroup15,	kRegXptSelectGroup16,
+											kRegXptSelectGroup17,	kRegXptSelectGroup18,	kRegXptSelectGroup19,	kRegXptSelectGroup20,
+											kRegXptSelectGroup21,	kRegXptSelectGroup22,	kRegXptSelectGroup23,	kRegXptSelectGroup24,
+											kRegXptSelectGroup25,	kRegXptSelectGroup26,	kRegXptSelectGroup27,	kRegXptSelectGroup28,
+											kRegXptSelectGroup29,	kRegXptSelectGroup30,	kRegXptSelectGroup31,	kRegXptSelectGroup32,
+											kRegXptSelectGroup33,	kRegXptSelectGroup34,	kRegXptSelectGroup35,	kRegXptSelectGroup36,
+											kRegXptSelectGroup37	};
+	NTV2RegNumSet result;
+	for (size_t ndx(0);  ndx < sizeof(sConfigRegs) / sizeof(ULWord);  ndx++)
+		result.insert(sConfigRegs[ndx]);
+	return result;
+}
+
+bool CNTV2DriverInterface::EnableRegisterCache (const bool inEnable)
+{
+	AJAAutoLock autoLock(&mRegCacheLock);
+	ClassifyRegisterCache();
+	for (size_t ndx(0);  ndx < mRegCacheFlags.size();  ndx++)
+		{mRegCacheFlags[ndx] &= ~kRegCacheValid;  mRegCacheGens[ndx]++;}
+	mRegCacheEnabled = inEnable;
+	DIDBG("Shadow register cache " << (inEnable ? "enabled" : "disabled"));
+	return true;
+}
+
+void CNTV2DriverInterface::ClassifyRegisterCache (void)
+{	//	Caller must hold mRegCacheLock
+	if (!mRegCacheFlags.empty())
+		return;
+	mRegCacheValues.resize(kRegNumRegisters, 0);
+	mRegCacheFlags.resize(kRegNumRegisters, 0);
+	mRegCacheGens.resize(kRegNumRegisters, 0);
+	const NTV2RegNumSet cacheableRegs (GetDefaultCacheableRegisters());
+	for (NTV2RegNumSetConstIter it(cacheableRegs.begin());  it != cacheableRegs.end();  ++it)
+		mRegCacheFlags.at(*it) = kRegCacheCacheable;
+}
+
+bool CNTV2DriverInterface::IsRegisterCacheEnabled (void) const
+{
+#if defined(NTV2_USE_CPLUSPLUS11)
+	return mRegCacheEnabled;
+#else
+	AJAAutoLock autoLock(&mRegCacheLock);
+	return mRegCacheEnabled;
+#endif
+}
+
+void CNTV2DriverInterface::InvalidateRegisterCache (void)
+{
+	AJAAutoLock autoLock(&mRegCacheLock);
+	for (size_t ndx(0);  ndx < mRegCacheFlags.size();  ndx++)
+		{mRegCacheFlags[ndx] &= ~kRegCacheValid;  mRegCacheGens[ndx]++;}
+}
+
+bool CNTV2DriverInterface::SetRegisterCacheable (const ULWord inRegNum, const bool inCacheable)
+{
+	if (inRegNum >= ULWord(kRegNumRegisters))
+		{DIFAIL("Register " << DEC(inRegNum) << " out of range, must be less than " << DEC(kRegNumRegisters)); return false;}
+	AJAAutoLock autoLock(&mRegCacheLock);
+	ClassifyRegisterCache();	//	Classify the registers, but leave the cache enabled or disabled
+	mRegCacheFlags.at(inRegNum) = inCacheable ? kRegCacheCacheable : 0;	//	Always clears kRegCacheValid
+	mRegCacheGens.at(inRegNum)++;
+	return true;
+}
+
+bool CNTV2DriverInterface::IsRegisterCacheable (const ULWord inRegNum) const
+{
+	AJAAutoLock autoLock(&mRegCacheLock);
+	if (mRegCacheFlags.empty())
+	{
+		static const NTV2RegNumSet sDefaultCacheableRegs (GetDefaultCacheableRegisters());
+		return sDefaultCacheableRegs.find(inRegNum) != sDefaultCacheableRegs.end();
+	}
+	return inRegNum < mRegCacheFlags.size()  &&  (mRegCacheFlags[inRegNum] & kRegCacheCacheable);
+}
+
+void CNTV2DriverInterface::GetRegisterCacheStats (ULWord64 & outHits, ULWord64 & outMisses, const bool inReset)
+{
+	AJAAutoLock autoLock(&mRegCacheLock);
+	outHits = mRegCacheHits;
+	outMisses = mRegCacheMisses;
+	if (inReset)
+		mRegCacheHits = mRegCacheMisses = 0;
+}
+
+bool CNTV2DriverInterface::ShadowReadRegister (const ULWord inRegNum, ULWord & outValue, const ULWord inMask, const ULWord inShift)
+{
+	if (!IsRegisterCacheEnabled())
+		return false;
+	const bool	isFullRead ((inMask == 0xFFFFFFFF  ||  !inMask)  &&  !inShift);
+	{
+		AJAAutoLock autoLock(&mRegCacheLock);
+		if (inRegNum >= mRegCacheFlags.size())
+			return false;
+		const UByte flags (mRegCacheFlags[inRegNum]);
+		if (!(flags & kRegCacheCacheable))
+			return false;	//	Volatile -- always read hardware
+		if (flags & kRegCacheValid)
+		{
+			const ULWord regValue (mRegCacheValues[inRegNum]);
+			outValue = ((inMask ? inMask : 0xFFFFFFFF) & regValue) >> inShift;
+			mRegCacheHits++;
+			return true;
+		}
+		if (isFullRead)
+		{
+			mRegCacheMisses++;
+			return false;	//	Caller reads hardware, then calls ShadowStoreRegister
+		}
+	}
+	//	Miss on a partial read -- read (and cache) the whole register, then mask & shift it...
+	ULWord regValue (0);
+	if (!ReadRegister(inRegNum, regValue))
+		return false;
+	outValue = (inMask & regValue) >> inShift;
+	return true;
+}
+
+ULWord CNTV2DriverInterface::ShadowRegisterGeneration (const ULWord inRegNum) const
+{
+	if (!IsRegisterCacheEnabled())
+		return 0;
+	AJAAutoLock autoLock(&mRegCacheLock);
+	return inRegNum < mRegCacheGens.size()  ?  mRegCacheGens[inRegNum]  :  0;
+}
+
+void CNTV2DriverInterface::ShadowStoreRegister (const ULWord inRegNum, const ULWord inValue, const ULWord inMask, const ULWord inShift, const ULWord inGeneration)
+{
+	if ((inMask != 0xFFFFFFFF  &&  inMask)  ||  inShift)
+		return;	//	Only whole-register reads can be cached
+	if (!IsRegisterCacheEnabled())
+		return;
+	AJAAutoLock autoLock(&mRegCacheLock);
+	if (inRegNum >= mRegCacheFlags.size())
+		return;
+	if (mRegCacheGens[inRegNum] != inGeneration)
+		return;	//	Written or invalidated since the hardware read started -- the value may be stale
+	if (mRegCacheFlags[inRegNum] & kRegCacheCacheable)
+	{
+		mRegCacheValues[inRegNum] = inValue;
+		mRegCacheFlags[inRegNum] |= kRegCacheValid;
+	}
+}
+
+void CNTV2DriverInterface::ShadowWriteRegister (const ULWord inRegNum, const ULWord inValue, const ULWord inMask, const ULWord inShift)
+{
+	if (!IsRegisterCacheEnabled())
+		return;
+	AJAAutoLock autoLock(&mRegCacheLock);
+	if (inRegNum >= mRegCacheFlags.size())
+		return;
+	mRegCacheGens[inRegNum]++;	//	Any in-flight hardware read of this register may now be stale
+	UByte & flags (mRegCacheFlags[inRegNum]);
+	if (!(flags & kRegCacheCacheable))
+		return;
+	if (!inMask)
+		flags &= ~kRegCacheValid;	//	Zero mask handling is platform-dependent -- re-read it next time
+	else if (inMask == 0xFFFFFFFF)
+	{	//	Whole-register write
+		mRegCacheValues[inRegNum] = inValue << inShift;
+		flags |= kRegCacheValid;
+	}
+	else if (flags & kRegCacheValid)	//	Read-modify-write of a cached register
+		mRegCacheValues[inRegNum] = (mRegCacheValues[inRegNum] & ~inMask)  |  ((inValue << inShift) & inMask);
+	//	else partial write of an uncached register -- leave it uncached
+}
+
+
 #if defined(NTV2_WRITEREG_PROFILING)	//	Register Write Profiling
 	bool CNTV2DriverInterface::GetRecordedRegisterWrites (NTV2RegisterWrites & outRegWrites) const
 	{
@@ -1326,8 +1567,50 @@ bool CNTV2DriverInterface::IsMBSystemReady (void)
 #endif	//	NTV2_WRITEREG_PROFILING
 
 
+NTV2DeviceCapsSnapshot::NTV2DeviceCapsSnapshot ()
+	:	mDeviceID	(DEVICE_ID_NOTFOUND),
+		mBools		(),
+		mNums		(),
+		mItems		(),
+		mItemBits	()
+{
+}
+
+bool NTV2DeviceCapsSnapshot::IsSupported (const NTV2BoolParamID inParamID) const
+{
+	return size_t(inParamID) < mBools.size()  ?  bool(mBools[size_t(inParamID)])  :  false;
+}
+
+ULWord NTV2DeviceCapsSnapshot::GetNumSupported (const NTV2NumericParamID inParamID) const
+{
+	if (!NTV2_IS_VALID_NUMPARAMID(inParamID))
+		return 0;
+	const size_t ndx (size_t(inParamID - kNTV2NumericParam_FIRST));
+	return ndx < mNums.size()  ?  mNums[ndx]  :  0;
+}
+
+const ULWordSet & NTV2DeviceCapsSnapshot::GetSupportedItems (const NTV2EnumsID inEnumsID) const
+{
+	static const ULWordSet sEmpty;
+	return size_t(inEnumsID) < mItems.size()  ?  mItems[size_t(inEnumsID)]  :  sEmpty;
+}
+
+bool NTV2DeviceCapsSnapshot::CanDo (const NTV2EnumsID inEnumsID, const ULWord inItem) const
+{
+	if (size_t(inEnumsID) >= mItems.size())
+		return false;
+	const std::vector<bool> & bits (mItemBits[size_t(inEnumsID)]);
+	if (!bits.empty())
+		return size_t(inItem) < bits.size()  &&  bits[size_t(inItem)];
+	const ULWordSet & items (mItems[size_t(inEnumsID)]);
+	return items.find(inItem) != items.end();
+}
+
+
 ULWordSet CNTV2DriverInterface::GetSupportedItems (const NTV2EnumsID inEnumsID)
 {
+	if (mCaps.IsValid())
+		return mCaps.GetSupportedItems(inEnumsID);
 	ULWordSet result;
 	if (IsRemote()  &&  _pRPCAPI->NTV2GetSupportedRemote (inEnumsID, result))
 		return result;
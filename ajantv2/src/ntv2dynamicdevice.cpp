@@ -208,6 +208,9 @@ bool CNTV2Card::LoadDynamicDevice (const NTV2DeviceID inDeviceID)
 	if (!BitstreamWrite (partialStream, false, true))
 		{DDFAIL("BitstreamWrite failed writing 'partial' bitstream for " << oldDevName);  return false;}
 
+	//	I'm now a different device, so my cached ID and features snapshot must follow...
+	_boardID = GetDeviceID();
+	SnapshotCaps();
 	DDNOTE(oldDevName << " dynamically changed to '" << ::NTV2DeviceIDToString(inDeviceID) << "' (" << xHEX0N(inDeviceID,8) << ")");
 	return true;
 }	//	LoadDynamicDevice
@@ -0,0 +1,311 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		ntv2frameconverter.cpp
+	@brief		Implements the NTV2FrameConverter class.
+	@copyright	(C) 2023 AJA Video Systems, Inc.
+**/
+#include "ntv2frameconverter.h"
+#include "ntv2transcode.h"
+#include "ntv2utils.h"
+#include "ajabase/common/common.h"
+#include "ajabase/system/debug.h"
+#include "ajabase/system/event.h"
+#include "ajabase/system/info.h"
+#include "ajabase/system/lock.h"
+#include "ajabase/system/thread.h"
+#if defined(NTV2_USE_CPLUSPLUS11)
+	#include <thread>
+#endif
+#include <string.h>
+
+using namespace std;
+
+#define FCFAIL(__x__)	AJA_sERROR	(AJA_DebugUnit_VideoGeneric, AJAFUNC << ": " << __x__)
+#define FCDBG(__x__)	AJA_sDEBUG	(AJA_DebugUnit_VideoGeneric, AJAFUNC << ": " << __x__)
+
+
+//	Adapters that give each line transcoder the common NTV2FrameConverter::LineConverter signature
+static bool Conv_2vuy_to_v210 (const void * pSrc, void * pDst, const ULWord inNumPixels)
+{	return ::ConvertLine_2vuy_to_v210 (reinterpret_cast<const UByte*>(pSrc), reinterpret_cast<ULWord*>(pDst), inNumPixels);	}
+
+static bool Conv_2vuy_to_yuy2 (const void * pSrc, void * pDst, const ULWord inNumPixels)
+{	return ::ConvertLine_2vuy_to_yuy2 (reinterpret_cast<const UByte*>(pSrc), reinterpret_cast<UWord*>(pDst), inNumPixels);	}
+
+static bool Conv_v210_to_2vuy (const void * pSrc, void * pDst, const ULWord inNumPixels)
+{	return ::ConvertLine_v210_to_2vuy (reinterpret_cast<const ULWord*>(pSrc), reinterpret_cast<UByte*>(pDst), inNumPixels);	}
+
+static bool Conv_ABGR_to_10bitRGB (const void * pSrc, void * pDst, const ULWord inNumPixels)
+{	return ::ConvertLine_8bitABGR_to_10bitABGR (reinterpret_cast<const UByte*>(pSrc), reinterpret_cast<ULWord*>(pDst), inNumPixels);	}
+
+static bool Conv_ABGR_to_10bitDPX (const void * pSrc, void * pDst, const ULWord inNumPixels)
+{	return ::ConvertLine_8bitABGR_to_10bitRGBDPX (reinterpret_cast<const UByte*>(pSrc), reinterpret_cast<ULWord*>(pDst), inNumPixels);	}
+
+static bool Conv_ABGR_to_10bitDPXLE (const void * pSrc, void * pDst, const ULWord inNumPixels)
+{	return ::ConvertLine_8bitABGR_to_10bitRGBDPXLE (reinterpret_cast<const UByte*>(pSrc), reinterpret_cast<ULWord*>(pDst), inNumPixels);	}
+
+static bool Conv_ABGR_to_24bitRGB (const void * pSrc, void * pDst, const ULWord inNumPixels)
+{	return ::ConvertLine_8bitABGR_to_24bitRGB (reinterpret_cast<const UByte*>(pSrc), reinterpret_cast<UByte*>(pDst), inNumPixels);	}
+
+static bool Conv_ABGR_to_24bitBGR (const void * pSrc, void * pDst, const ULWord inNumPixels)
+{	return ::ConvertLine_8bitABGR_to_24bitBGR (reinterpret_cast<const UByte*>(pSrc), reinterpret_cast<UByte*>(pDst), inNumPixels);	}
+
+static bool Conv_ABGR_to_48bitRGB (const void * pSrc, void * pDst, const ULWord inNumPixels)
+{	return ::ConvertLine_8bitABGR_to_48bitRGB (reinterpret_cast<const UByte*>(pSrc), reinterpret_cast<ULWord*>(pDst), inNumPixels);	}
+
+typedef NTV2FrameConverter::LineConverter	LineConverterFunc;
+
+struct LineConverterEntry
+{
+	NTV2PixelFormat		fSrc;
+	NTV2PixelFormat		fDst;
+	LineConverterFunc	fConvert;
+};
+
+static const LineConverterEntry	sLineConverters[] =
+{
+	{NTV2_FBF_8BIT_YCBCR,	NTV2_FBF_10BIT_YCBCR,		Conv_2vuy_to_v210},
+	{NTV2_FBF_8BIT_YCBCR,	NTV2_FBF_8BIT_YCBCR_YUY2,	Conv_2vuy_to_yuy2},
+	{NTV2_FBF_10BIT_YCBCR,	NTV2_FBF_8BIT_YCBCR,		Conv_v210_to_2vuy},
+	{NTV2_FBF_ABGR,			NTV2_FBF_10BIT_RGB,			Conv_ABGR_to_10bitRGB},
+	{NTV2_FBF_ABGR,			NTV2_FBF_10BIT_DPX,			Conv_ABGR_to_10bitDPX},
+	{NTV2_FBF_ABGR,			NTV2_FBF_10BIT_DPX_LE,		Conv_ABGR_to_10bitDPXLE},
+	{NTV2_FBF_ABGR,			NTV2_FBF_24BIT_RGB,			Conv_ABGR_to_24bitRGB},
+	{NTV2_FBF_ABGR,			NTV2_FBF_24BIT_BGR,			Conv_ABGR_to_24bitBGR},
+	{NTV2_FBF_ABGR,			NTV2_FBF_48BIT_RGB,			Conv_ABGR_to_48bitRGB}
+};
+
+static LineConverterFunc FindLineConverter (const NTV2PixelFormat inSrcPF, const NTV2PixelFormat inDstPF)
+{
+	for (size_t ndx(0);  ndx < sizeof(sLineConverters) / sizeof(LineConverterEntry);  ndx++)
+		if (sLineConverters[ndx].fSrc == inSrcPF  &&  sLineConverters[ndx].fDst == inDstPF)
+			return sLineConverters[ndx].fConvert;
+	return AJA_NULL;
+}
+
+
+/**
+	@brief	A persistent worker thread that processes one band of lines each time it's signaled.
+**/
+struct NTV2FrameConverterWorker
+{
+	NTV2FrameConverterWorker (NTV2FrameConverter & inOwner)
+		:	mOwner		(inOwner),
+			mGo			(false),	//	auto-reset
+			mDone		(false),	//	auto-reset
+			mFirstLine	(0),
+			mNumLines	(0),
+			mResult		(false),
+			mQuit		(false)
+	{
+		mThread.Attach(WorkerThreadStatic, this);
+		mThread.SetThreadName("NTV2FrameConverter");
+		mThread.Start();
+	}
+
+	~NTV2FrameConverterWorker ()
+	{
+		mQuit = true;
+		mGo.Signal();
+		mThread.Stop();
+	}
+
+	static void WorkerThreadStatic (AJAThread * pThread, void * pContext)
+	{	(void) pThread;
+		NTV2FrameConverterWorker * pWorker (reinterpret_cast<NTV2FrameConverterWorker*>(pContext));
+		if (pWorker)
+			pWorker->WorkerThread();
+	}
+
+	void WorkerThread (void)
+	{
+		while (true)
+		{
+			if (AJA_FAILURE(mGo.WaitForSignal()))
+				continue;
+			if (mQuit)
+				break;
+			mResult = mOwner.RunBand(mFirstLine, mNumLines);
+			mDone.Signal();
+		}
+	}
+
+	void Run (const ULWord inFirstLine, const ULWord inNumLines)
+	{
+		mFirstLine = inFirstLine;
+		mNumLines = inNumLines;
+		mResult = false;
+		mGo.Signal();
+	}
+
+	bool Wait (void)
+	{
+		mDone.WaitForSignal();
+		return mResult;
+	}
+
+	NTV2FrameConverter &	mOwner;
+	AJAThread				mThread;
+	AJAEvent				mGo;		///< @brief	Signaled by the owner to start processing a band
+	AJAEvent				mDone;		///< @brief	Signaled by the worker when its band is done
+	ULWord					mFirstLine;
+	ULWord					mNumLines;
+	bool					mResult;
+	bool					mQuit;
+};	//	NTV2FrameConverterWorker
+
+
+bool NTV2FrameConverter::CanConvert (const NTV2PixelFormat inSrcPixelFormat, const NTV2PixelFormat inDstPixelFormat)
+{
+	if (inSrcPixelFormat == inDstPixelFormat)
+		return NTV2_IS_VALID_FRAME_BUFFER_FORMAT(inSrcPixelFormat)  &&  !NTV2_IS_FBF_PLANAR(inSrcPixelFormat);
+	return FindLineConverter(inSrcPixelFormat, inDstPixelFormat) != AJA_NULL;
+}
+
+ULWord NTV2FrameConverter::GetNumCPUCores (void)
+{
+	static ULWord sNumCores (0);
+	if (!sNumCores)
+	{
+		ULWord numCores (0);
+#if defined(NTV2_USE_CPLUSPLUS11)
+		numCores = ULWord(std::thread::hardware_concurrency());
+#endif
+		if (!numCores)
+		{
+			string str;
+			AJASystemInfo info (AJA_SystemInfoMemoryUnit_Megabytes, AJA_SystemInfoSection_CPU);
+			if (AJA_SUCCESS(info.GetValue(AJA_SystemInfoTag_CPU_NumCores, str)))
+				numCores = ULWord(aja::stoul(str));
+		}
+		sNumCores = numCores ? numCores : 1;
+	}
+	return sNumCores;
+}
+
+NTV2FrameConverter & NTV2FrameConverter::GetShared (void)
+{
+	static NTV2FrameConverter	sSharedConverter;
+	return sSharedConverter;
+}
+
+
+NTV2FrameConverter::NTV2FrameConverter (const ULWord inNumThreads)
+	:	mpLock			(new AJALock),
+		mMinLinesPerBand(32),
+		mpSrc			(AJA_NULL),
+		mpDst			(AJA_NULL),
+		mpConvertLine	(AJA_NULL),
+		mpBandFunc		(AJA_NULL),
+		mpBandContext	(AJA_NULL)
+{
+	const ULWord numThreads (inNumThreads ? inNumThreads : GetNumCPUCores());
+	for (ULWord num(1);  num < numThreads;  num++)	//	The calling thread converts the first band
+		mWorkers.push_back(new NTV2FrameConverterWorker(*this));
+	FCDBG(numThreads << " thread(s)");
+}
+
+NTV2FrameConverter::~NTV2FrameConverter ()
+{
+	while (!mWorkers.empty())
+	{
+		delete mWorkers.back();
+		mWorkers.pop_back();
+	}
+	delete mpLock;
+}
+
+bool NTV2FrameConverter::Convert (const NTV2Buffer & inSrcBuffer, const NTV2FormatDescriptor & inSrcDesc,
+								NTV2Buffer & outDstBuffer, const NTV2FormatDescriptor & inDstDesc)
+{
+	if (!inSrcDesc.IsValid()  ||  !inDstDesc.IsValid())
+		{FCFAIL("Invalid source or destination descriptor");  return false;}
+	if (inSrcDesc.IsPlanar()  ||  inDstDesc.IsPlanar())
+		{FCFAIL("Planar formats not supported");  return false;}
+	if (!CanConvert(inSrcDesc.GetPixelFormat(), inDstDesc.GetPixelFormat()))
+		{FCFAIL("No converter from " << ::NTV2FrameBufferFormatToString(inSrcDesc.GetPixelFormat())
+				<< " to " << ::NTV2FrameBufferFormatToString(inDstDesc.GetPixelFormat()));  return false;}
+	if (inSrcDesc.GetRasterWidth() != inDstDesc.GetRasterWidth()  ||  inSrcDesc.GetVisibleRasterHeight() != inDstDesc.GetVisibleRasterHeight())
+		{FCFAIL("Source raster " << inSrcDesc.GetRasterWidth() << "x" << inSrcDesc.GetVisibleRasterHeight() << " doesn't match destination raster "
+				<< inDstDesc.GetRasterWidth() << "x" << inDstDesc.GetVisibleRasterHeight());  return false;}
+	if (inSrcBuffer.GetByteCount() < inSrcDesc.GetTotalRasterBytes()  ||  outDstBuffer.GetByteCount() < inDstDesc.GetTotalRasterBytes())
+		{FCFAIL("Source or destination buffer too small");  return false;}
+	if (inSrcBuffer.IsNULL()  ||  outDstBuffer.IsNULL())
+		{FCFAIL("NULL source or destination buffer");  return false;}
+
+	AJAAutoLock autoLock (mpLock);
+	mpSrc = reinterpret_cast<const UByte*>(inSrcBuffer.GetHostPointer());
+	mpDst = reinterpret_cast<UByte*>(outDstBuffer.GetHostPointer());
+	mSrcDesc = inSrcDesc;
+	mDstDesc = inDstDesc;
+	mpConvertLine = FindLineConverter(inSrcDesc.GetPixelFormat(), inDstDesc.GetPixelFormat());
+	const bool result (RunBands(inSrcDesc.GetVisibleRasterHeight(), ConvertBand, this));
+	mpSrc = AJA_NULL;
+	mpDst = AJA_NULL;
+	return result;
+}
+
+bool NTV2FrameConverter::RunBands (const ULWord inNumLines, BandFunc inFunc, void * pContext)
+{
+	if (!inFunc)
+		{FCFAIL("NULL band function");  return false;}
+	if (!inNumLines)
+		return true;
+
+	AJAAutoLock autoLock (mpLock);
+	mpBandFunc = inFunc;
+	mpBandContext = pContext;
+
+	//	Split the lines into bands, one per thread, but no smaller than mMinLinesPerBand...
+	ULWord numBands (inNumLines / mMinLinesPerBand);
+	if (numBands > GetNumThreads())
+		numBands = GetNumThreads();
+	if (!numBands)
+		numBands = 1;
+	const ULWord linesPerBand (inNumLines / numBands),  extraLines (inNumLines % numBands);
+
+	//	Hand bands 1 thru N-1 to the workers, and do band 0 on this thread...
+	ULWord firstLine (linesPerBand + (extraLines ? 1 : 0));
+	for (ULWord band(1);  band < numBands;  band++)
+	{
+		const ULWord bandLines (linesPerBand + (band < extraLines ? 1 : 0));
+		mWorkers.at(band - 1)->Run(firstLine, bandLines);
+		firstLine += bandLines;
+	}
+	NTV2_ASSERT(firstLine == inNumLines);
+	bool result (RunBand(0, linesPerBand + (extraLines ? 1 : 0)));
+	for (ULWord band(1);  band < numBands;  band++)
+		if (!mWorkers.at(band - 1)->Wait())
+			result = false;
+
+	mpBandFunc = AJA_NULL;
+	mpBandContext = AJA_NULL;
+	return result;
+}
+
+bool NTV2FrameConverter::RunBand (const ULWord inFirstLine, const ULWord inNumLines) const
+{
+	return mpBandFunc(mpBandContext, inFirstLine, inNumLines);
+}
+
+bool NTV2FrameConverter::ConvertBand (void * pContext, const ULWord inFirstLine, const ULWord inNumLines)
+{
+	return reinterpret_cast<const NTV2FrameConverter*>(pContext)->ConvertLines(inFirstLine, inNumLines);
+}
+
+bool NTV2FrameConverter::ConvertLines (const ULWord inFirstLine, const ULWord inNumLines) const
+{
+	const ULWord	numPixels	(mSrcDesc.GetRasterWidth());
+	const ULWord	copyBytes	(mSrcDesc.GetBytesPerRow() < mDstDesc.GetBytesPerRow() ? mSrcDesc.GetBytesPerRow() : mDstDesc.GetBytesPerRow());
+	for (ULWord line(inFirstLine);  line < inFirstLine + inNumLines;  line++)
+	{
+		const void *	pSrcLine (mSrcDesc.GetRowAddress(mpSrc, line + mSrcDesc.GetFirstActiveLine()));
+		void *			pDstLine (mDstDesc.GetWriteableRowAddress(mpDst, line + mDstDesc.GetFirstActiveLine()));
+		if (!pSrcLine  ||  !pDstLine)
+			return false;
+		if (!mpConvertLine)
+			::memcpy(pDstLine, pSrcLine, copyBytes);
+		else if (!mpConvertLine(pSrcLine, pDstLine, numPixels))
+			return false;
+	}
+	return true;
+}
@@ -1297,6 +1297,16 @@ string NTV2AutoCirculateStateToString (const NTV2AutoCirculateState inState)
 		return "<invalid>";
 }
 
+string NTV2ACLatencyStageToString (const NTV2ACLatencyStage inStage, const bool inCompact)
+{
+	static const char * sCompactStrings []	= { "VBI", "DMA", "Host", "Age", AJA_NULL};
+	static const char * sStageStrings []	= { "VBI Wait", "DMA Transfer", "Host Processing", "Frame Age", AJA_NULL};
+	if (NTV2_IS_VALID_AC_LATENCY_STAGE(inStage))
+		return string (inCompact ? sCompactStrings [inStage] : sStageStrings [inStage]);
+	else
+		return "<invalid>";
+}
+
 
 
 NTV2_TRAILER::NTV2_TRAILER ()
@@ -1585,6 +1595,32 @@ bool NTV2Buffer::Allocate (const size_t inByteCount, const bool inPageAligned)
 }
 
 
+bool NTV2Buffer::AllocateOnNode (const size_t inByteCount, const int inNUMANode)
+{
+	if (GetByteCount()	&&	IsAllocatedBySDK()	&&	IsPageAligned())	//	If already was Allocated page-aligned
+		if (inByteCount == GetByteCount())								//	If same byte count
+			if (inNUMANode < 0	||	AJAMemory::GetNUMANode(GetHostPointer()) == inNUMANode)	//	If already on that node
+			{
+				Fill(0);		//	Zero it...
+				return true;	//	...and return true
+			}
+
+	bool result(Set(AJA_NULL, 0));	//	Jettison existing buffer (if any)
+	if (inByteCount)
+	{	//	Allocate the byte array, and call Set...
+		UByte * pBuffer(reinterpret_cast<UByte*>(AJAMemory::AllocateAlignedOnNode(inByteCount, DefaultPageSize(), inNUMANode)));
+		result = false;
+		if (pBuffer	 &&	 Set(pBuffer, inByteCount))
+		{	//	SDK owns this memory -- I'm responsible for freeing it (with AJAMemory::FreeAligned)
+			result = true;
+			fFlags |= NTV2Buffer_ALLOCATED | NTV2Buffer_PAGE_ALIGNED;
+			Fill(0);	//	Zero it -- this first touch faults the pages in on the preferred node
+		}
+	}	//	if requested size is non-zero
+	return result;
+}
+
+
 bool NTV2Buffer::Deallocate (void)
 {
 	if (IsAllocatedBySDK())
@@ -3078,7 +3114,8 @@ bool NTV2GetRegisters::GetRegisterValues (NTV2RegisterReads & outValues) const
 			NTV2RegValueMapConstIter mapIter(regValMap.find(it->registerNumber));
 			if (mapIter == regValMap.end())
 				missingTally++; //	Missing register
-			it->registerValue = mapIter->second;
+			else
+				it->registerValue = mapIter->second;
 		}
 		return !missingTally;
 	}
@@ -4507,6 +4507,14 @@ bool CNTV2Card::WriteRegisters (const NTV2RegisterWrites & inRegWrites)
 				pBadNdxs[setRegsParams.mOutNumFailures++] = UWord(ndx);
 		result = true;
 	}
+	else if (IsRegisterCacheEnabled())
+	{	//	The driver wrote them -- update my shadow register cache...
+		if (setRegsParams.mOutNumFailures)
+			InvalidateRegisterCache();
+		else
+			for (NTV2RegisterWritesConstIter it(inRegWrites.begin());  it != inRegWrites.end();  ++it)
+				ShadowWriteRegister(it->registerNumber, it->registerValue, it->registerMask, it->registerShift);
+	}
 	if (result	&&	setRegsParams.mInNumRegisters  &&  setRegsParams.mOutNumFailures)
 		result = false; //	fail if any writes failed
 	if (!result)	CVIDFAIL("Failed: setRegsParams: " << setRegsParams);
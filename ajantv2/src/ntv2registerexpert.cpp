@@ -13,7 +13,9 @@
 #include "ntv2bitfile.h"
 #include "ntv2signalrouter.h"
 #include "ajabase/common/common.h"
+#include "ajabase/system/atomic.h"
 #include "ajabase/system/lock.h"
+#include "ajabase/system/systemtime.h"
 #include "ajabase/common/ajarefptr.h"
 #include "ajabase/system/debug.h"
 #include <algorithm>
@@ -70,10 +72,13 @@ public:
 
 private:
 	RegisterExpert()
+		:	mLastClassNdx(0)
 	{
-		AJAAutoLock lock(&mGuardMutex);
 		AJAAtomic::Increment(&gInstanceTally);
 		AJAAtomic::Increment(&gLivingInstances);
+		mRegNumToStringTable.reserve(8192);
+		mRegNumToDecoderTable.reserve(8192);
+		mRegClassTable.reserve(16384);
 		//	Name "Classic" registers using NTV2RegisterNameString...
 		for (ULWord regNum (0);	 regNum < kRegNumRegisters;	 regNum++)
 			DefineRegName (regNum,	::NTV2RegisterNameString(regNum));
@@ -96,16 +101,17 @@ private:
 		SetupLEDRegs();			//	Bracket LEDs
 		SetupCMWRegs();			//	Clock Monitor Out
 		SetupVRegs();			//	Virtuals
+		FreezeTables();			//	Sort for lookup -- read-only from here on
 		REiNOTE(DEC(gLivingInstances) << " extant, " << DEC(gInstanceTally) << " total");
 		if (LOGGING_MAPPINGS)
 		{
-			REiDBG("RegsToStrsMap=" << mRegNumToStringMap.size()
-					<< " RegsToDecodersMap=" << mRegNumToDecoderMap.size()
-					<< " ClassToRegsMMap=" << mRegClassToRegNumMMap.size()
-					<< " StrToRegsMMap=" << mStringToRegNumMMap.size()
+			REiDBG("RegsToStrsTable=" << mRegNumToStringTable.size()
+					<< " RegsToDecodersTable=" << mRegNumToDecoderTable.size()
+					<< " ClassToRegsTable=" << mRegClassTable.size()
+					<< " StrToRegsTable=" << mStringToRegNumTable.size()
 					<< " InpXptsToXptRegInfoMap=" << mInputXpt2XptRegNumMaskIndexMap.size()
 					<< " XptRegInfoToInpXptsMap=" << mXptRegNumMaskIndex2InputXptMap.size()
-					<< " RegClasses=" << mAllRegClasses.size());
+					<< " RegClasses=" << mRegClassNames.size());
 		}
 	}	//	constructor
 public:
@@ -130,46 +136,87 @@ private:
 		}
 	} mDefaultRegDecoder;
 
+	//	The Define* functions only append to the tables. FreezeTables sorts them once, after which they're read-only,
+	//	and the first name or decoder defined for a register wins, as before. They only run in the constructor,
+	//	before the instance is published to other threads, and lookups never write, so none of this needs a lock.
 	void DefineRegName(const uint32_t regNumber, const string & regName)
 	{
 		if (!regName.empty())
-		{
-			AJAAutoLock lock(&mGuardMutex);
-			if (mRegNumToStringMap.find(regNumber) == mRegNumToStringMap.end())
-			{
-				mRegNumToStringMap.insert (RegNumToStringPair(regNumber, regName));
-				string lowerCaseRegName(regName);
-				mStringToRegNumMMap.insert (StringToRegNumPair(aja::lower(lowerCaseRegName), regNumber));
-			}
-		}
+			mRegNumToStringTable.push_back(RegNumToStringPair(regNumber, regName));
 	}
 	inline void DefineRegDecoder(const uint32_t inRegNum, const Decoder & dec)
 	{
-		AJAAutoLock lock(&mGuardMutex);
-		mRegNumToDecoderMap.insert (RegNumToDecoderPair(inRegNum, &dec));
+		mRegNumToDecoderTable.push_back(RegNumToDecoderPair(inRegNum, &dec));
 	}
 	inline void DefineRegClass (const uint32_t inRegNum, const string & className)
 	{
 		if (!className.empty())
-		{
-			AJAAutoLock lock(&mGuardMutex);
-			mRegClassToRegNumMMap.insert(StringToRegNumPair(className, inRegNum));
-		}
+			mRegClassTable.push_back(ClassNdxRegNumPair(ClassNameIndex(className), inRegNum));
 	}
 	void DefineRegReadWrite(const uint32_t inRegNum, const int rdWrt)
 	{
-		AJAAutoLock lock(&mGuardMutex);
 		if (rdWrt == READONLY)
-		{
-			NTV2_ASSERT (!IsRegisterWriteOnly(inRegNum));
 			DefineRegClass (inRegNum, kRegClass_ReadOnly);
-		}
 		if (rdWrt == WRITEONLY)
-		{
-			NTV2_ASSERT (!IsRegisterReadOnly(inRegNum));
 			DefineRegClass (inRegNum, kRegClass_WriteOnly);
-		}
 	}
+	uint32_t ClassNameIndex (const string & inClassName)
+	{	//	Interns the class name -- there are only a few dozen, and consecutive definitions mostly use the same ones
+		if (mLastClassNdx < mRegClassNames.size()  &&  mRegClassNames[mLastClassNdx] == inClassName)
+			return mLastClassNdx;
+		for (mLastClassNdx = 0;  mLastClassNdx < mRegClassNames.size();  mLastClassNdx++)
+			if (mRegClassNames[mLastClassNdx] == inClassName)
+				return mLastClassNdx;
+		mRegClassNames.push_back(inClassName);
+		return mLastClassNdx;
+	}
+
+	void FreezeTables (void)
+	{
+		//	Sort by register number, keeping the first name & decoder defined for each...
+		std::stable_sort (mRegNumToStringTable.begin(), mRegNumToStringTable.end(), LessFirst<RegNumToStringPair>);
+		mRegNumToStringTable.erase (std::unique(mRegNumToStringTable.begin(), mRegNumToStringTable.end(), SameFirst<RegNumToStringPair>), mRegNumToStringTable.end());
+		std::stable_sort (mRegNumToDecoderTable.begin(), mRegNumToDecoderTable.end(), LessFirst<RegNumToDecoderPair>);
+		mRegNumToDecoderTable.erase (std::unique(mRegNumToDecoderTable.begin(), mRegNumToDecoderTable.end(), SameFirst<RegNumToDecoderPair>), mRegNumToDecoderTable.end());
+		RegNumToStringTable(mRegNumToStringTable).swap(mRegNumToStringTable);		//	Trim excess capacity
+		RegNumToDecoderTable(mRegNumToDecoderTable).swap(mRegNumToDecoderTable);
+
+		//	Lower-case name search table, ties go to the lowest register number...
+		mStringToRegNumTable.reserve(mRegNumToStringTable.size());
+		for (RegNumToStringTable::const_iterator it(mRegNumToStringTable.begin());  it != mRegNumToStringTable.end();  ++it)
+			mStringToRegNumTable.push_back(StringToRegNumPair(ToLower(it->second), it->first));
+		std::stable_sort (mStringToRegNumTable.begin(), mStringToRegNumTable.end(), LessFirst<StringToRegNumPair>);
+
+		//	Renumber classes in name order, then sort by class and register number...
+		vector<uint32_t> byName(mRegClassNames.size()), newNdx(mRegClassNames.size());
+		for (uint32_t ndx(0);  ndx < byName.size();  ndx++)
+			byName[ndx] = ndx;
+		std::sort (byName.begin(), byName.end(), ClassNameOrder(mRegClassNames));
+		NTV2StringList sortedNames;
+		for (uint32_t ndx(0);  ndx < byName.size();  ndx++)
+			{newNdx[byName[ndx]] = ndx;  sortedNames.push_back(mRegClassNames[byName[ndx]]);}
+		mRegClassNames = sortedNames;
+		for (RegClassTable::iterator it(mRegClassTable.begin());  it != mRegClassTable.end();  ++it)
+			it->first = newNdx[it->first];
+		std::sort (mRegClassTable.begin(), mRegClassTable.end());
+		mRegClassTable.erase (std::unique(mRegClassTable.begin(), mRegClassTable.end()), mRegClassTable.end());
+		RegClassTable(mRegClassTable).swap(mRegClassTable);
+
+	#if defined(AJA_DEBUG) || defined(_DEBUG)
+		const NTV2RegNumSet readOnlyRegs (GetRegistersForClass(kRegClass_ReadOnly));
+		for (NTV2RegNumSetConstIter it(readOnlyRegs.begin());  it != readOnlyRegs.end();  ++it)
+			NTV2_ASSERT (!IsRegisterWriteOnly(*it));
+	#endif
+	}	//	FreezeTables
+
+	template <typename T>	static bool LessFirst (const T & inLHS, const T & inRHS)	{return inLHS.first < inRHS.first;}
+	template <typename T>	static bool SameFirst (const T & inLHS, const T & inRHS)	{return inLHS.first == inRHS.first;}
+	struct ClassNameOrder
+	{
+		explicit ClassNameOrder (const NTV2StringList & inNames) : mNames(inNames)	{}
+		bool operator () (const uint32_t inLHS, const uint32_t inRHS) const		{return mNames[inLHS] < mNames[inRHS];}
+		const NTV2StringList & mNames;
+	};
 	void DefineRegister(const uint32_t inRegNum, const string & regName, const Decoder & dec, const int rdWrt, const string & className1, const string & className2, const string & className3)
 	{
 		DefineRegName (inRegNum, regName);
@@ -197,7 +244,6 @@ private:
 
 	void SetupBasicRegs(void)
 	{
-		AJAAutoLock lock(&mGuardMutex);
 		DefineRegister (kRegGlobalControl,		"", mDecodeGlobalControlReg,	READWRITE,	kRegClass_NULL,		kRegClass_Channel1, kRegClass_NULL);
 		DefineRegister (kRegGlobalControl2,		"", mDecodeGlobalControl2,		READWRITE,	kRegClass_NULL,		kRegClass_Channel1, kRegClass_NULL);
 		DefineRegister (kRegGlobalControl3,		"", mDecodeGlobalControl3,		READWRITE,	kRegClass_NULL,		kRegClass_Channel1, kRegClass_NULL);
@@ -304,7 +350,6 @@ private:
 	}
 	void SetupBOBRegs(void)
 	{
-		AJAAutoLock lock(&mGuardMutex);
 		DefineRegister (kRegBOBStatus,				"kRegBOBStatus",				mDecodeBOBStatus,					READWRITE,	kRegClass_NULL,		kRegClass_NULL,		kRegClass_NULL);
 		DefineRegister (kRegBOBGPIInData,			"kRegBOBGPIInData",				mDecodeBOBGPIIn,					READWRITE,	kRegClass_NULL,		kRegClass_NULL,		kRegClass_NULL);
 		DefineRegister (kRegBOBGPIInterruptControl,	"kRegBOBGPIInterruptControl",	mDecodeBOBGPIInInterruptControl,	READWRITE,	kRegClass_NULL,		kRegClass_NULL,		kRegClass_NULL);
@@ -313,7 +358,6 @@ private:
 	}
 	void SetupLEDRegs(void)
 	{
-		AJAAutoLock lock(&mGuardMutex);
 		DefineRegister (kRegLEDReserved0,		"kRegLEDReserved0",			mDefaultRegDecoder,		READWRITE,		kRegClass_NULL,		kRegClass_NULL,		kRegClass_NULL);
 		DefineRegister (kRegLEDClockDivide,		"kRegLEDClockDivide",		mDefaultRegDecoder,		READWRITE,		kRegClass_NULL,		kRegClass_NULL,		kRegClass_NULL);
 		DefineRegister (kRegLEDReserved2,		"kRegLEDReserved2",			mDefaultRegDecoder,		READWRITE,		kRegClass_NULL,		kRegClass_NULL,		kRegClass_NULL);
@@ -325,7 +369,6 @@ private:
 	}
 	void SetupCMWRegs(void)
 	{
-		AJAAutoLock lock(&mGuardMutex);
 		DefineRegister (kRegCMWControl,		"kRegCMWControl",		mDefaultRegDecoder,		READWRITE,		kRegClass_NULL,		kRegClass_NULL,		kRegClass_NULL);
 		DefineRegister (kRegCMW1485Out,		"kRegCMW1485Out",		mDefaultRegDecoder,		READWRITE,		kRegClass_NULL,		kRegClass_NULL,		kRegClass_NULL);
 		DefineRegister (kRegCMW14835Out,	"kRegCMW14835Out",		mDefaultRegDecoder,		READWRITE,		kRegClass_NULL,		kRegClass_NULL,		kRegClass_NULL);
@@ -335,7 +378,6 @@ private:
 	}
 	void SetupVPIDRegs(void)
 	{
-		AJAAutoLock lock(&mGuardMutex);
 		DefineRegister (kRegSDIIn1VPIDA,		"", mVPIDInpRegDecoder,			READONLY,	kRegClass_VPID,		kRegClass_Input,	kRegClass_Channel1);
 		DefineRegister (kRegSDIIn1VPIDB,		"", mVPIDInpRegDecoder,			READONLY,	kRegClass_VPID,		kRegClass_Input,	kRegClass_Channel1);
 		DefineRegister (kRegSDIOut1VPIDA,		"", mVPIDOutRegDecoder,			READWRITE,	kRegClass_VPID,		kRegClass_Output,	kRegClass_Channel1);
@@ -371,7 +413,6 @@ private:
 	}
 	void SetupTimecodeRegs(void)
 	{
-		AJAAutoLock lock(&mGuardMutex);
 		DefineRegister	(kRegRP188InOut1DBB,			"", mRP188InOutDBBRegDecoder,	READWRITE,	kRegClass_Timecode, kRegClass_Channel1, kRegClass_NULL);
 		DefineRegister	(kRegRP188InOut1Bits0_31,		"", mDefaultRegDecoder,			READWRITE,	kRegClass_Timecode, kRegClass_Channel1, kRegClass_NULL);
 		DefineRegister	(kRegRP188InOut1Bits32_63,		"", mDefaultRegDecoder,			READWRITE,	kRegClass_Timecode, kRegClass_Channel1, kRegClass_NULL);
@@ -437,7 +478,6 @@ private:
 	
 	void SetupAudioRegs(void)
 	{
-		AJAAutoLock lock(&mGuardMutex);
 		DefineRegister (kRegAud1Control,		"", mDecodeAudControlReg,		READWRITE,	kRegClass_Audio,	kRegClass_Channel1, kRegClass_NULL);
 		DefineRegister (kRegAud2Control,		"", mDecodeAudControlReg,		READWRITE,	kRegClass_Audio,	kRegClass_Channel2, kRegClass_NULL);
 		DefineRegister (kRegAud3Control,		"", mDecodeAudControlReg,		READWRITE,	kRegClass_Audio,	kRegClass_Channel3, kRegClass_NULL);
@@ -523,7 +563,6 @@ private:
 
 	void SetupMRRegs(void)
 	{
-		AJAAutoLock lock(&mGuardMutex);
 		DefineRegister	(kRegMRQ1Control,		"kRegMRQ1Control",	mDefaultRegDecoder,	READWRITE,	kRegClass_NULL,	kRegClass_NULL, kRegClass_NULL);
 		DefineRegister	(kRegMRQ2Control,		"kRegMRQ2Control",	mDefaultRegDecoder,	READWRITE,	kRegClass_NULL,	kRegClass_NULL, kRegClass_NULL);
 		DefineRegister	(kRegMRQ3Control,		"kRegMRQ3Control",	mDefaultRegDecoder,	READWRITE,	kRegClass_NULL,	kRegClass_NULL, kRegClass_NULL);
@@ -534,7 +573,6 @@ private:
 
 	void SetupDMARegs(void)
 	{
-		AJAAutoLock lock(&mGuardMutex);
 		DefineRegister	(kRegDMA1HostAddr,		"", mDefaultRegDecoder,			READWRITE,	kRegClass_DMA,	kRegClass_NULL, kRegClass_NULL);
 		DefineRegister	(kRegDMA1HostAddrHigh,	"", mDefaultRegDecoder,			READWRITE,	kRegClass_DMA,	kRegClass_NULL, kRegClass_NULL);
 		DefineRegister	(kRegDMA1LocalAddr,		"", mDefaultRegDecoder,			READWRITE,	kRegClass_DMA,	kRegClass_NULL, kRegClass_NULL);
@@ -565,7 +603,6 @@ private:
 	
 	void SetupXptSelect(void)
 	{
-		AJAAutoLock lock(&mGuardMutex);
 		//				RegNum					0-7								8-15							16-23							24-31
 		DefineXptReg	(kRegXptSelectGroup1,	NTV2_XptLUT1Input,				NTV2_XptCSC1VidInput,			NTV2_XptConversionModInput,		NTV2_XptCompressionModInput);
 		DefineXptReg	(kRegXptSelectGroup2,	NTV2_XptFrameBuffer1Input,		NTV2_XptFrameSync1Input,		NTV2_XptFrameSync2Input,		NTV2_XptDualLinkOut1Input);
@@ -657,7 +694,6 @@ private:
 		NTV2_ASSERT(size_t(regAncExt_LAST) == sizeof(AncExtRegNames)/sizeof(AncExtRegNames[0]));
 		NTV2_ASSERT(size_t(regAncIns_LAST) == sizeof(AncInsRegNames)/sizeof(string));
 
-		AJAAutoLock lock(&mGuardMutex);
 		for (ULWord offsetNdx (0);	offsetNdx < 8;	offsetNdx++)
 		{
 			for (ULWord reg(regAncExtControl);	reg < regAncExt_LAST;  reg++)
@@ -741,7 +777,6 @@ private:
 		NTV2_ASSERT(size_t(regAuxExt_LAST) == sizeof(AuxExtRegNames)/sizeof(AuxExtRegNames[0]));
 		//NTV2_ASSERT(size_t(regAncIns_LAST) == sizeof(AncInsRegNames)/sizeof(string));
 
-		AJAAutoLock lock(&mGuardMutex);
 		for (ULWord offsetNdx (0);	offsetNdx < 4;	offsetNdx++)
 		{
 			for (ULWord reg(regAuxExtControl);	reg < regAuxExt_LAST;  reg++)
@@ -801,7 +836,6 @@ private:
 
 	void SetupHDMIRegs(void)
 	{
-		AJAAutoLock lock(&mGuardMutex);
 		DefineRegister (kRegHDMIOutControl,							"", mDecodeHDMIOutputControl,	READWRITE,	kRegClass_HDMI,		kRegClass_Output,	kRegClass_Channel1);
 		DefineRegister (kRegHDMIInputStatus,						"", mDecodeHDMIInputStatus,		READWRITE,	kRegClass_HDMI,		kRegClass_Input,	kRegClass_Channel1);
 		DefineRegister (kRegHDMIInputControl,						"", mDecodeHDMIInputControl,	READWRITE,	kRegClass_HDMI,		kRegClass_Input,	kRegClass_Channel1);
@@ -959,7 +993,6 @@ private:
 		static const string suffixes [] =	{"Status",	"CRCErrorCount",	"FrameCountLow",	"FrameCountHigh",	"FrameRefCountLow", "FrameRefCountHigh"};
 		static const int	perms []	=	{READWRITE, READWRITE,			READWRITE,			READWRITE,			READONLY,			READONLY};
 
-		AJAAutoLock lock(&mGuardMutex);
 		for (ULWord chan (0);  chan < 8;  chan++)
 			for (UWord ndx(0);	ndx < 6;  ndx++)
 			{
@@ -980,14 +1013,12 @@ private:
 
 	void SetupLUTRegs (void)
 	{
-		AJAAutoLock lock(&mGuardMutex);
 	}
 
 	void SetupCSCRegs(void)
 	{
 		static const string sChan[8] = {kRegClass_Channel1, kRegClass_Channel2, kRegClass_Channel3, kRegClass_Channel4, kRegClass_Channel5, kRegClass_Channel6, kRegClass_Channel7, kRegClass_Channel8};
 
-		AJAAutoLock lock(&mGuardMutex);
 		for (unsigned num(0);  num < 8;	 num++)
 		{
 			ostringstream ossRegName;  ossRegName << "kRegEnhancedCSC" << (num+1);
@@ -1055,7 +1086,6 @@ private:
 
 	void SetupMixerKeyerRegs(void)
 	{
-		AJAAutoLock lock(&mGuardMutex);
 		//	VidProc/Mixer/Keyer
 		DefineRegister	(kRegVidProc1Control,	"", mVidProcControlRegDecoder,	READWRITE,	kRegClass_Mixer,	kRegClass_Channel1, kRegClass_Channel2);
 		DefineRegister	(kRegVidProc2Control,	"", mVidProcControlRegDecoder,	READWRITE,	kRegClass_Mixer,	kRegClass_Channel3, kRegClass_Channel4);
@@ -1074,7 +1104,6 @@ private:
 
 	void SetupVRegs(void)
 	{
-		AJAAutoLock lock(&mGuardMutex);
 		DEF_REG	(kVRegDriverVersion, mDriverVersionDecoder,	READWRITE,	kRegClass_Virtual,	kRegClass_NULL, kRegClass_NULL);
 		DEF_REGNAME	(kVRegRelativeVideoPlaybackDelay);
 		DEF_REGNAME	(kVRegAudioRecordPinDelay);
@@ -1596,14 +1625,8 @@ private:
 
 		for (ULWord ndx(1);  ndx < 1024;  ndx++)	//	<== Start at 1, kVRegDriverVersion already done
 		{
-			ostringstream oss;	oss << "VIRTUALREG_START+" << ndx;
-			const string	regName (oss.str());
 			const ULWord	regNum	(VIRTUALREG_START + ndx);
-			if (mRegNumToStringMap.find(regNum) == mRegNumToStringMap.end())
-			{
-				mRegNumToStringMap.insert (RegNumToStringPair(regNum, regName));
-				mStringToRegNumMMap.insert (StringToRegNumPair(ToLower(regName), regNum));
-			}
+			DefineRegName (regNum, "VIRTUALREG_START+" + aja::to_string(ndx));	//	Unless already named
 			DefineRegDecoder (regNum, mDefaultRegDecoder);
 			DefineRegReadWrite (regNum, READWRITE);
 			DefineRegClass (regNum, kRegClass_Virtual);
@@ -1638,9 +1661,8 @@ public:
 
 	string RegNameToString (const uint32_t inRegNum) const
 	{
-		AJAAutoLock lock(&mGuardMutex);
-		RegNumToStringMap::const_iterator	iter	(mRegNumToStringMap.find (inRegNum));
-		if (iter != mRegNumToStringMap.end())
+		RegNumToStringTable::const_iterator	iter	(FindRegNum(mRegNumToStringTable, inRegNum));
+		if (iter != mRegNumToStringTable.end())
 			return iter->second;
 
 		ostringstream	oss;	oss << "Reg ";
@@ -1655,10 +1677,9 @@ public:
 	
 	string RegValueToString (const uint32_t inRegNum, const uint32_t inRegValue, const NTV2DeviceID inDeviceID) const
 	{
-		AJAAutoLock lock(&mGuardMutex);
-		RegNumToDecoderMap::const_iterator	iter	(mRegNumToDecoderMap.find (inRegNum));
+		RegNumToDecoderTable::const_iterator	iter	(FindRegNum(mRegNumToDecoderTable, inRegNum));
 		ostringstream	oss;
-		if (iter != mRegNumToDecoderMap.end()  &&  iter->second)
+		if (iter != mRegNumToDecoderTable.end()  &&  iter->second)
 		{
 			const Decoder * pDecoder (iter->second);
 			oss << (*pDecoder)(inRegNum, inRegValue, inDeviceID);
@@ -1668,11 +1689,22 @@ public:
 	
 	bool	IsRegInClass (const uint32_t inRegNum, const string & inClassName) const
 	{
-		AJAAutoLock lock(&mGuardMutex);
-		for (RegClassToRegNumConstIter	it	(mRegClassToRegNumMMap.find (inClassName));	 it != mRegClassToRegNumMMap.end() && it->first == inClassName;	 ++it)
-			if (it->second == inRegNum)
-				return true;
-		return false;
+		const uint32_t classNdx (FindClassName(inClassName));
+		if (classNdx >= mRegClassNames.size())
+			return false;
+		return std::binary_search (mRegClassTable.begin(), mRegClassTable.end(), ClassNdxRegNumPair(classNdx, inRegNum));
+	}
+
+	template <typename T>	static typename vector<T>::const_iterator FindRegNum (const vector<T> & inTable, const uint32_t inRegNum)
+	{	//	Binary search of a table that's sorted by register number
+		typename vector<T>::const_iterator it (std::lower_bound(inTable.begin(), inTable.end(), T(inRegNum, typename T::second_type()), LessFirst<T>));
+		return (it != inTable.end()  &&  it->first == inRegNum) ? it : inTable.end();
+	}
+
+	uint32_t	FindClassName (const string & inClassName) const
+	{	//	Returns mRegClassNames.size() if not found
+		NTV2StringList::const_iterator it (std::lower_bound(mRegClassNames.begin(), mRegClassNames.end(), inClassName));
+		return (it != mRegClassNames.end()  &&  *it == inClassName) ? uint32_t(it - mRegClassNames.begin()) : uint32_t(mRegClassNames.size());
 	}
 	
 	inline bool		IsRegisterWriteOnly (const uint32_t inRegNum) const				{return IsRegInClass (inRegNum, kRegClass_WriteOnly);}
@@ -1680,23 +1712,16 @@ public:
 
 	NTV2StringSet	GetAllRegisterClasses (void) const
 	{
-		AJAAutoLock lock(&mGuardMutex);
-		if (mAllRegClasses.empty())
-			for (RegClassToRegNumConstIter	it	(mRegClassToRegNumMMap.begin ());  it != mRegClassToRegNumMMap.end();  ++it)
-				if (mAllRegClasses.find (it->first) == mAllRegClasses.end())
-					mAllRegClasses.insert (it->first);
-		return mAllRegClasses;
+		return NTV2StringSet(mRegClassNames.begin(), mRegClassNames.end());
 	}
 
 	NTV2StringSet	GetRegisterClasses (const uint32_t inRegNum, const bool inRemovePrefix) const
 	{
-		AJAAutoLock lock(&mGuardMutex);
 		NTV2StringSet	result;
-		NTV2StringSet	allClasses	(GetAllRegisterClasses());
-		for (NTV2StringSetConstIter it	(allClasses.begin ());	it != allClasses.end();	 ++it)
-			if (IsRegInClass (inRegNum, *it))
+		for (uint32_t classNdx(0);  classNdx < mRegClassNames.size();  classNdx++)
+			if (std::binary_search (mRegClassTable.begin(), mRegClassTable.end(), ClassNdxRegNumPair(classNdx, inRegNum)))
 			{
-				string str(*it);
+				string str(mRegClassNames[classNdx]);
 				if (inRemovePrefix)
 					str.erase(0, 10);	//	Remove "kRegClass_" prefix
 				if (result.find(str) == result.end())
@@ -1707,11 +1732,13 @@ public:
 
 	NTV2RegNumSet	GetRegistersForClass (const string & inClassName) const
 	{
-		AJAAutoLock lock(&mGuardMutex);
 		NTV2RegNumSet	result;
-		for (RegClassToRegNumConstIter	it(mRegClassToRegNumMMap.find(inClassName));  it != mRegClassToRegNumMMap.end() && it->first == inClassName;  ++it)
-			if (result.find(it->second) == result.end())
-				result.insert(it->second);
+		const uint32_t	classNdx (FindClassName(inClassName));
+		if (classNdx >= mRegClassNames.size())
+			return result;
+		RegClassTable::const_iterator it (std::lower_bound(mRegClassTable.begin(), mRegClassTable.end(), ClassNdxRegNumPair(classNdx, 0)));
+		for ( ;  it != mRegClassTable.end()  &&  it->first == classNdx;  ++it)
+			result.insert(result.end(), it->second);	//	Already in order
 		return result;
 	}
 
@@ -1724,7 +1751,6 @@ public:
 		for (uint32_t regNum (0);  regNum <= maxRegNum;	 regNum++)
 			result.insert(regNum);
 
-		AJAAutoLock lock(&mGuardMutex);
 
 		if (::NTV2DeviceCanDoCustomAnc(inDeviceID))
 		{
@@ -1886,17 +1912,16 @@ public:
 		NTV2RegNumSet	result;
 		string			nameStr(inName);
 		const size_t	nameStrLen(aja::lower(nameStr).length());
-		StringToRegNumConstIter it;
-		AJAAutoLock lock(&mGuardMutex);
+		StringToRegNumTable::const_iterator it;
 		if (inMatchStyle == EXACTMATCH)
 		{
-			it = mStringToRegNumMMap.find(nameStr);
-			if (it != mStringToRegNumMMap.end())
+			it = std::lower_bound(mStringToRegNumTable.begin(), mStringToRegNumTable.end(), StringToRegNumPair(nameStr, 0), LessFirst<StringToRegNumPair>);
+			if (it != mStringToRegNumTable.end()  &&  it->first == nameStr)
 				result.insert(it->second);
 			return result;
 		}
 		//	Inexact match...
-		for (it = mStringToRegNumMMap.begin();	it != mStringToRegNumMMap.end();  ++it)
+		for (it = mStringToRegNumTable.begin();	 it != mStringToRegNumTable.end();  ++it)
 		{
 			const size_t pos(it->first.find(nameStr));
 			if (pos == string::npos)
@@ -1918,7 +1943,6 @@ public:
 
 	bool		GetXptRegNumAndMaskIndex (const NTV2InputCrosspointID inInputXpt, uint32_t & outXptRegNum, uint32_t & outMaskIndex) const
 	{
-		AJAAutoLock lock(&mGuardMutex);
 		outXptRegNum = 0xFFFFFFFF;
 		outMaskIndex = 0xFFFFFFFF;
 		InputXpt2XptRegNumMaskIndexMapConstIter iter	(mInputXpt2XptRegNumMaskIndexMap.find (inInputXpt));
@@ -1931,7 +1955,6 @@ public:
 
 	NTV2InputCrosspointID	GetInputCrosspointID (const uint32_t inXptRegNum, const uint32_t inMaskIndex) const
 	{
-		AJAAutoLock lock(&mGuardMutex);
 		const XptRegNumAndMaskIndex				key		(inXptRegNum, inMaskIndex);
 		XptRegNumMaskIndex2InputXptMapConstIter iter	(mXptRegNumMaskIndex2InputXptMap.find (key));
 		if (iter != mXptRegNumMaskIndex2InputXptMap.end())
@@ -1941,24 +1964,23 @@ public:
 
 	ostream &	Print (ostream & inOutStream) const
 	{
-		AJAAutoLock lock(&mGuardMutex);
 		static const string		sLineBreak	(96, '=');
 		static const uint32_t	sMasks[4]	=	{0x000000FF, 0x0000FF00, 0x00FF0000, 0xFF000000};
 		
-		inOutStream << endl << sLineBreak << endl << "RegisterExpert:  Dump of RegNumToStringMap:  " << mRegNumToStringMap.size() << " mappings:" << endl << sLineBreak << endl;
-		for (RegNumToStringMap::const_iterator it (mRegNumToStringMap.begin());	 it != mRegNumToStringMap.end();  ++it)
+		inOutStream << endl << sLineBreak << endl << "RegisterExpert:  Dump of RegNumToStringTable:  " << mRegNumToStringTable.size() << " mappings:" << endl << sLineBreak << endl;
+		for (RegNumToStringTable::const_iterator it (mRegNumToStringTable.begin());	 it != mRegNumToStringTable.end();  ++it)
 			inOutStream << "reg " << setw(5) << it->first << "(" << HEX0N(it->first,8) << dec << ")	 =>	 '" << it->second << "'" << endl;
 		
-		inOutStream << endl << sLineBreak << endl << "RegisterExpert:  Dump of RegNumToDecoderMap:	" << mRegNumToDecoderMap.size() << " mappings:" << endl << sLineBreak << endl;
-		for (RegNumToDecoderMap::const_iterator it (mRegNumToDecoderMap.begin());  it != mRegNumToDecoderMap.end();	 ++it)
+		inOutStream << endl << sLineBreak << endl << "RegisterExpert:  Dump of RegNumToDecoderTable:	" << mRegNumToDecoderTable.size() << " mappings:" << endl << sLineBreak << endl;
+		for (RegNumToDecoderTable::const_iterator it (mRegNumToDecoderTable.begin());  it != mRegNumToDecoderTable.end();	 ++it)
 			inOutStream << "reg " << setw(5) << it->first << "(" << HEX0N(it->first,8) << dec << ")	 =>	 " << (it->second == &mDefaultRegDecoder ? "(default decoder)" : "Custom Decoder") << endl;
 		
-		inOutStream << endl << sLineBreak << endl << "RegisterExpert:  Dump of RegClassToRegNumMMap:  " << mRegClassToRegNumMMap.size() << " mappings:" << endl << sLineBreak << endl;
-		for (RegClassToRegNumMMap::const_iterator it (mRegClassToRegNumMMap.begin());  it != mRegClassToRegNumMMap.end();  ++it)
-			inOutStream << setw(32) << it->first << "  =>  reg " << setw(5) << it->second << "(" << HEX0N(it->second,8) << dec << ") " << RegNameToString(it->second) << endl;
+		inOutStream << endl << sLineBreak << endl << "RegisterExpert:  Dump of RegClassTable:  " << mRegClassTable.size() << " mappings:" << endl << sLineBreak << endl;
+		for (RegClassTable::const_iterator it (mRegClassTable.begin());  it != mRegClassTable.end();  ++it)
+			inOutStream << setw(32) << mRegClassNames[it->first] << "  =>  reg " << setw(5) << it->second << "(" << HEX0N(it->second,8) << dec << ") " << RegNameToString(it->second) << endl;
 		
-		inOutStream << endl << sLineBreak << endl << "RegisterExpert:  Dump of StringToRegNumMMap:	" << mStringToRegNumMMap.size() << " mappings:" << endl << sLineBreak << endl;
-		for (StringToRegNumMMap::const_iterator it (mStringToRegNumMMap.begin());  it != mStringToRegNumMMap.end();	 ++it)
+		inOutStream << endl << sLineBreak << endl << "RegisterExpert:  Dump of StringToRegNumTable:	" << mStringToRegNumTable.size() << " mappings:" << endl << sLineBreak << endl;
+		for (StringToRegNumTable::const_iterator it (mStringToRegNumTable.begin());  it != mStringToRegNumTable.end();	 ++it)
 			inOutStream << setw(32) << it->first << "  =>  reg " << setw(5) << it->second << "(" << HEX0N(it->second,8) << dec << ") " << RegNameToString(it->second) << endl;
 		
 		inOutStream << endl << sLineBreak << endl << "RegisterExpert:  Dump of InputXpt2XptRegNumMaskIndexMap:	" << mInputXpt2XptRegNumMaskIndexMap.size() << " mappings:" << endl << sLineBreak << endl;
@@ -1976,8 +1998,8 @@ public:
 	}
 
 private:
-	typedef std::map<uint32_t, string>	RegNumToStringMap;
-	typedef std::pair<uint32_t, string> RegNumToStringPair;
+	typedef std::pair<uint32_t, string>		RegNumToStringPair;
+	typedef std::vector<RegNumToStringPair>	RegNumToStringTable;	//	Sorted by register number
 
 	static string ToLower (const string & inStr)
 	{
@@ -4310,12 +4332,12 @@ private:
 	static const int	ENDSWITH	=	2;
 	static const int	EXACTMATCH	=	3;
 
-	typedef map <uint32_t, const Decoder *>		RegNumToDecoderMap;
 	typedef pair <uint32_t, const Decoder *>	RegNumToDecoderPair;
-	typedef multimap <string, uint32_t>			RegClassToRegNumMMap, StringToRegNumMMap;
+	typedef vector <RegNumToDecoderPair>		RegNumToDecoderTable;	//	Sorted by register number
+	typedef pair <uint32_t, uint32_t>			ClassNdxRegNumPair;		//	First: index into mRegClassNames;  second: register number
+	typedef vector <ClassNdxRegNumPair>			RegClassTable;			//	Sorted by class, then register number
 	typedef pair <string, uint32_t>				StringToRegNumPair;
-	typedef RegClassToRegNumMMap::const_iterator	RegClassToRegNumConstIter;
-	typedef StringToRegNumMMap::const_iterator	StringToRegNumConstIter;
+	typedef vector <StringToRegNumPair>			StringToRegNumTable;	//	Sorted by lower-case register name
 
 	typedef pair <uint32_t, uint32_t>							XptRegNumAndMaskIndex;	//	First: register number;	 second: mask index (0=0x000000FF, 1=0x0000FF00, 2=0x00FF0000, 3=0xFF000000)
 	typedef map <NTV2InputCrosspointID, XptRegNumAndMaskIndex>	InputXpt2XptRegNumMaskIndexMap;
@@ -4324,64 +4346,103 @@ private:
 	typedef XptRegNumMaskIndex2InputXptMap::const_iterator		XptRegNumMaskIndex2InputXptMapConstIter;
 
 private:	//	INSTANCE DATA
-	mutable AJALock			mGuardMutex;
-	RegNumToStringMap		mRegNumToStringMap;
-	RegNumToDecoderMap		mRegNumToDecoderMap;
-	RegClassToRegNumMMap	mRegClassToRegNumMMap;
-	StringToRegNumMMap		mStringToRegNumMMap;
-	mutable NTV2StringSet	mAllRegClasses; //	Mutable -- caches results from 'const' method GetAllRegisterClasses
+	RegNumToStringTable		mRegNumToStringTable;
+	RegNumToDecoderTable	mRegNumToDecoderTable;
+	RegClassTable			mRegClassTable;
+	StringToRegNumTable		mStringToRegNumTable;
+	NTV2StringList			mRegClassNames;	//	Sorted once frozen
+	uint32_t				mLastClassNdx;	//	Speeds up ClassNameIndex while defining
 	InputXpt2XptRegNumMaskIndexMap		mInputXpt2XptRegNumMaskIndexMap;
 	XptRegNumMaskIndex2InputXptMap		mXptRegNumMaskIndex2InputXptMap;
 	
 };	//	RegisterExpert
 
 
-static RegisterExpertPtr	gpRegExpert;		//	Points to Register Expert Singleton
-static AJALock				gRegExpertGuardMutex;
+static RegisterExpertPtr	gpRegExpert;				//	Owns the Register Expert Singleton
+static void * volatile		gpPublishedRegExpert(AJA_NULL);	//	The same instance, for lookups that don't take the lock
+static int32_t volatile		gActiveLookups(0);			//	Lookups that may be using gpPublishedRegExpert
+static AJALock				gRegExpertGuardMutex;		//	Serializes creating & disposing the singleton
 
 
 RegisterExpertPtr RegisterExpert::GetInstance(const bool inCreateIfNecessary)
 {
 	AJAAutoLock		locker(&gRegExpertGuardMutex);
 	if (!gpRegExpert  &&  inCreateIfNecessary)
+	{
 		gpRegExpert = new RegisterExpert;
+		AJAAtomic::Exchange(&gpPublishedRegExpert, gpRegExpert.get());	//	Only published once it's fully built
+	}
 	return gpRegExpert;
 }
 
 bool RegisterExpert::DisposeInstance(void)
 {
-	AJAAutoLock		locker(&gRegExpertGuardMutex);
-	if (!gpRegExpert)
-		return false;
-	gpRegExpert = AJA_NULL;
+	RegisterExpertPtr	pDoomed;
+	{
+		AJAAutoLock		locker(&gRegExpertGuardMutex);
+		if (!gpRegExpert)
+			return false;
+		AJAAtomic::Exchange(&gpPublishedRegExpert, AJA_NULL);
+		pDoomed = gpRegExpert;
+		gpRegExpert = AJA_NULL;
+	}
+	//	New lookups can't see it any more, but those already under way may still be using it...
+	while (gActiveLookups)
+		AJATime::Sleep(0);
 	return true;
-}
+}	//	pDoomed releases the instance here
+
+
+/**
+	A lookup holds one of these while it uses the singleton. Once the singleton exists, this costs two atomic
+	increments and no lock. DisposeInstance unpublishes the instance, then waits for the active lookups to finish
+	before it releases it. A lookup that finds nothing published creates the singleton under the guard mutex.
+**/
+class RegisterExpertLookup
+{
+public:
+	RegisterExpertLookup()
+	{
+		AJAAtomic::Increment(&gActiveLookups);
+		mpExpert = static_cast<const RegisterExpert*>(gpPublishedRegExpert);
+		while (!mpExpert)
+		{	//	Not created yet, or being disposed -- don't count while waiting on the guard mutex
+			AJAAtomic::Decrement(&gActiveLookups);
+			RegisterExpert::GetInstance(true);
+			AJAAtomic::Increment(&gActiveLookups);
+			mpExpert = static_cast<const RegisterExpert*>(gpPublishedRegExpert);	//	Disposed again meanwhile?
+		}
+	}
+	~RegisterExpertLookup()						{AJAAtomic::Decrement(&gActiveLookups);}
+	const RegisterExpert * operator -> () const	{return mpExpert;}
+	operator bool() const						{return mpExpert ? true : false;}
+private:
+	RegisterExpertLookup (const RegisterExpertLookup &);
+	RegisterExpertLookup & operator = (const RegisterExpertLookup &);
+	const RegisterExpert *	mpExpert;
+};	//	RegisterExpertLookup
+
 
 bool CNTV2RegisterExpert::Allocate(void)
 {
-	AJAAutoLock lock(&gRegExpertGuardMutex);
 	RegisterExpertPtr pInst(RegisterExpert::GetInstance(true));
 	return pInst ? true : false;
 }
 
 bool CNTV2RegisterExpert::IsAllocated(void)
 {
-	AJAAutoLock lock(&gRegExpertGuardMutex);
 	RegisterExpertPtr pInst(RegisterExpert::GetInstance(false));
 	return pInst ? true : false;
 }
 
 bool CNTV2RegisterExpert::Deallocate(void)
 {
-	AJAAutoLock lock(&gRegExpertGuardMutex);
-	RegisterExpertPtr pInst(RegisterExpert::GetInstance(false));
-	return pInst ? pInst->DisposeInstance() : false;
+	return RegisterExpert::DisposeInstance();
 }
 
 string CNTV2RegisterExpert::GetDisplayName (const uint32_t inRegNum)
 {
-	AJAAutoLock locker(&gRegExpertGuardMutex);
-	RegisterExpertPtr pRegExpert(RegisterExpert::GetInstance());
+	RegisterExpertLookup pRegExpert;
 	if (pRegExpert)
 		return pRegExpert->RegNameToString(inRegNum);
 
@@ -4397,70 +4458,60 @@ string CNTV2RegisterExpert::GetDisplayName (const uint32_t inRegNum)
 
 string CNTV2RegisterExpert::GetDisplayValue (const uint32_t inRegNum, const uint32_t inRegValue, const NTV2DeviceID inDeviceID)
 {
-	AJAAutoLock locker(&gRegExpertGuardMutex);
-	RegisterExpertPtr pRegExpert(RegisterExpert::GetInstance());
+	RegisterExpertLookup pRegExpert;
 	return pRegExpert ? pRegExpert->RegValueToString(inRegNum, inRegValue, inDeviceID) : string();
 }
 
 bool CNTV2RegisterExpert::IsRegisterInClass (const uint32_t inRegNum, const string & inClassName)
 {
-	AJAAutoLock locker(&gRegExpertGuardMutex);
-	RegisterExpertPtr pRegExpert(RegisterExpert::GetInstance());
+	RegisterExpertLookup pRegExpert;
 	return pRegExpert ? pRegExpert->IsRegInClass(inRegNum, inClassName) : false;
 }
 
 NTV2StringSet CNTV2RegisterExpert::GetAllRegisterClasses (void)
 {
-	AJAAutoLock locker(&gRegExpertGuardMutex);
-	RegisterExpertPtr pRegExpert(RegisterExpert::GetInstance());
+	RegisterExpertLookup pRegExpert;
 	return pRegExpert ? pRegExpert->GetAllRegisterClasses() : NTV2StringSet();
 }
 
 NTV2StringSet CNTV2RegisterExpert::GetRegisterClasses (const uint32_t inRegNum, const bool inRemovePrefix)
 {
-	AJAAutoLock locker(&gRegExpertGuardMutex);
-	RegisterExpertPtr pRegExpert(RegisterExpert::GetInstance());
+	RegisterExpertLookup pRegExpert;
 	return pRegExpert ? pRegExpert->GetRegisterClasses(inRegNum, inRemovePrefix) : NTV2StringSet();
 }
 
 NTV2RegNumSet CNTV2RegisterExpert::GetRegistersForClass (const string & inClassName)
 {
-	AJAAutoLock locker(&gRegExpertGuardMutex);
-	RegisterExpertPtr pRegExpert(RegisterExpert::GetInstance());
+	RegisterExpertLookup pRegExpert;
 	return pRegExpert ? pRegExpert->GetRegistersForClass(inClassName) : NTV2RegNumSet();
 }
 
 NTV2RegNumSet CNTV2RegisterExpert::GetRegistersForChannel (const NTV2Channel inChannel)
 {
-	AJAAutoLock locker(&gRegExpertGuardMutex);
-	RegisterExpertPtr pRegExpert(RegisterExpert::GetInstance());
+	RegisterExpertLookup pRegExpert;
 	return NTV2_IS_VALID_CHANNEL(inChannel)	 ?	(pRegExpert ? pRegExpert->GetRegistersForClass(gChlClasses[inChannel]):NTV2RegNumSet())	 :	NTV2RegNumSet();
 }
 
 NTV2RegNumSet CNTV2RegisterExpert::GetRegistersForDevice (const NTV2DeviceID inDeviceID, const int inOtherRegsToInclude)
 {
-	AJAAutoLock locker(&gRegExpertGuardMutex);
-	RegisterExpertPtr pRegExpert(RegisterExpert::GetInstance());
+	RegisterExpertLookup pRegExpert;
 	return pRegExpert ? pRegExpert->GetRegistersForDevice(inDeviceID, inOtherRegsToInclude) : NTV2RegNumSet();
 }
 
 NTV2RegNumSet CNTV2RegisterExpert::GetRegistersWithName (const string & inName, const int inSearchStyle)
 {
-	AJAAutoLock locker(&gRegExpertGuardMutex);
-	RegisterExpertPtr pRegExpert(RegisterExpert::GetInstance());
+	RegisterExpertLookup pRegExpert;
 	return pRegExpert ? pRegExpert->GetRegistersWithName(inName, inSearchStyle) : NTV2RegNumSet();
 }
 
 NTV2InputCrosspointID CNTV2RegisterExpert::GetInputCrosspointID (const uint32_t inXptRegNum, const uint32_t inMaskIndex)
 {
-	AJAAutoLock locker(&gRegExpertGuardMutex);
-	RegisterExpertPtr pRegExpert(RegisterExpert::GetInstance());
+	RegisterExpertLookup pRegExpert;
 	return pRegExpert ? pRegExpert->GetInputCrosspointID(inXptRegNum, inMaskIndex) : NTV2_INPUT_CROSSPOINT_INVALID;
 }
 
 bool CNTV2RegisterExpert::GetCrosspointSelectGroupRegisterInfo (const NTV2InputCrosspointID inInputXpt, uint32_t & outXptRegNum, uint32_t & outMaskIndex)
 {
-	AJAAutoLock locker(&gRegExpertGuardMutex);
-	RegisterExpertPtr pRegExpert(RegisterExpert::GetInstance());
+	RegisterExpertLookup pRegExpert;
 	return pRegExpert ? pRegExpert->GetXptRegNumAndMaskIndex(inInputXpt, outXptRegNum, outMaskIndex) : false;
 }
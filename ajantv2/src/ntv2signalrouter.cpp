@@ -346,7 +346,6 @@ bool CNTV2SignalRouter::IsInitialized (void)		//	STATIC
 
 string CNTV2SignalRouter::NTV2InputCrosspointIDToString (const NTV2InputXptID inInputXpt)		//	STATIC
 {
-	AJAAutoLock		locker(&gRoutingExpertLock);
 	RoutingExpertPtr	pExpert(RoutingExpert::GetInstance());
 	return pExpert ? pExpert->InputXptToString(inInputXpt) : string();
 }
@@ -354,7 +353,6 @@ string CNTV2SignalRouter::NTV2InputCrosspointIDToString (const NTV2InputXptID in
 
 string CNTV2SignalRouter::NTV2OutputCrosspointIDToString (const NTV2OutputXptID inOutputXpt)		//	STATIC
 {
-	AJAAutoLock		locker(&gRoutingExpertLock);
 	RoutingExpertPtr	pExpert(RoutingExpert::GetInstance());
 	return pExpert ? pExpert->OutputXptToString(inOutputXpt) : string();
 }
@@ -362,7 +360,6 @@ string CNTV2SignalRouter::NTV2OutputCrosspointIDToString (const NTV2OutputXptID
 
 NTV2InputXptID CNTV2SignalRouter::StringToNTV2InputCrosspointID (const string & inStr)		//	STATIC
 {
-	AJAAutoLock		locker(&gRoutingExpertLock);
 	RoutingExpertPtr	pExpert(RoutingExpert::GetInstance());
 	return pExpert ? pExpert->StringToInputXpt(inStr) : NTV2_INPUT_CROSSPOINT_INVALID;
 }
@@ -370,7 +367,6 @@ NTV2InputXptID CNTV2SignalRouter::StringToNTV2InputCrosspointID (const string &
 
 NTV2OutputXptID CNTV2SignalRouter::StringToNTV2OutputCrosspointID (const string & inStr)		//	STATIC
 {
-	AJAAutoLock		locker(&gRoutingExpertLock);
 	RoutingExpertPtr	pExpert(RoutingExpert::GetInstance());
 	return pExpert ? pExpert->StringToOutputXpt(inStr) : NTV2_OUTPUT_CROSSPOINT_INVALID;
 }
@@ -389,7 +385,6 @@ bool CNTV2SignalRouter::GetWidgetIDs (const NTV2DeviceID inDeviceID, NTV2WidgetI
 bool CNTV2SignalRouter::GetWidgetsForInput (const NTV2InputXptID inInputXpt, NTV2WidgetIDSet & outWidgetIDs)		//	STATIC
 {
 	outWidgetIDs.clear();
-	AJAAutoLock		locker(&gRoutingExpertLock);
 	RoutingExpertPtr	pExpert(RoutingExpert::GetInstance());
 	return pExpert ? pExpert->GetWidgetsForInput(inInputXpt, outWidgetIDs) : false;
 }
@@ -417,7 +412,6 @@ bool CNTV2SignalRouter::GetWidgetForInput (const NTV2InputXptID inInputXpt, NTV2
 bool CNTV2SignalRouter::GetWidgetsForOutput (const NTV2OutputXptID inOutputXpt, NTV2WidgetIDSet & outWidgetIDs)		//	STATIC
 {
 	outWidgetIDs.clear();
-	AJAAutoLock		locker(&gRoutingExpertLock);
 	RoutingExpertPtr	pExpert(RoutingExpert::GetInstance());
 	return pExpert ? pExpert->GetWidgetsForOutput(inOutputXpt, outWidgetIDs) : false;
 }
@@ -427,11 +421,8 @@ bool CNTV2SignalRouter::GetWidgetForOutput (const NTV2OutputXptID inOutputXpt, N
 {
 	outWidgetID = NTV2_WIDGET_INVALID;
 	NTV2WidgetIDSet wgts;
-	{
-		AJAAutoLock		locker(&gRoutingExpertLock);
-		if (!GetWidgetsForOutput(inOutputXpt, wgts))
-			return false;
-	}
+	if (!GetWidgetsForOutput(inOutputXpt, wgts))
+		return false;
 	if (inDeviceID == DEVICE_ID_NOTFOUND)
 		outWidgetID = *(wgts.begin());
 	else
@@ -602,6 +593,20 @@ bool CNTV2SignalRouter::IsHDMIOutWidgetType(const NTV2WidgetType inWidgetType)
 	return pExpert ? pExpert->IsHDMIOutWidget(inWidgetType) : false;
 }
 
+bool CNTV2SignalRouter::FindRoutes (const NTV2DeviceID inDeviceID, const NTV2XptConnections & inEndpoints, NTV2XptConnections & outConnections)
+{
+	outConnections.clear();
+	RoutingExpertPtr	pExpert(RoutingExpert::GetInstance());
+	return pExpert ? pExpert->FindRoutes(inDeviceID, inEndpoints, outConnections) : false;
+}
+
+bool CNTV2SignalRouter::FindRoute (const NTV2DeviceID inDeviceID, const NTV2OutputXptID inSource, const NTV2InputXptID inDestination, NTV2XptConnections & outConnections)
+{
+	NTV2XptConnections	endpoints;
+	endpoints[inDestination] = inSource;
+	return FindRoutes(inDeviceID, endpoints, outConnections);
+}
+
 bool CNTV2SignalRouter::GetConnectionsFromRegs (const NTV2InputXptIDSet & inInputXptIDs, const NTV2RegisterReads & inRegValues, NTV2XptConnections & outConnections)
 {
 	outConnections.clear();
@@ -6,6 +6,7 @@
 **/
 
 #include "ntv2card.h"
+#include "ajabase/system/systemtime.h"
 
 using namespace std; 
 
@@ -138,10 +139,13 @@ bool CNTV2Card::WaitForOutputVerticalInterrupt (const NTV2Channel inChannel, UWo
 		return false;
 	if (!inRepeatCount)
 		return false;
+	const uint64_t startMicrosecs (AutoCirculateIsLatencyStatsEnabled() ? AJATime::GetSystemMicroseconds() : 0);
 	do
 	{
 		result = WaitForInterrupt (gChannelToOutputVerticalInterrupt [inChannel]);
 	} while (--inRepeatCount && result);
+	if (result  &&  startMicrosecs)
+		AutoCirculateRecordLatency (inChannel, NTV2_AC_LATENCY_VBI_WAIT, AJATime::GetSystemMicroseconds() - startMicrosecs);
 	return result;
 }
 
@@ -153,10 +157,13 @@ bool CNTV2Card::WaitForInputVerticalInterrupt (const NTV2Channel inChannel, UWor
 		return false;
 	if (!inRepeatCount)
 		return false;
+	const uint64_t startMicrosecs (AutoCirculateIsLatencyStatsEnabled() ? AJATime::GetSystemMicroseconds() : 0);
 	do
 	{
 		result = WaitForInterrupt (gChannelToInputVerticalInterrupt [inChannel]);
 	} while (--inRepeatCount && result);
+	if (result  &&  startMicrosecs)
+		AutoCirculateRecordLatency (inChannel, NTV2_AC_LATENCY_VBI_WAIT, AJATime::GetSystemMicroseconds() - startMicrosecs);
 	return result;
 }
 
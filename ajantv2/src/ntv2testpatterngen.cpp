@@ -14,9 +14,14 @@
 #include "ntv2testpatterngen.h"
 #include "ntv2transcode.h"
 #include "ntv2resample.h"
+#include "ntv2frameconverter.h"
 #include "ajabase/system/debug.h"
+#include "ajabase/system/lock.h"
 #include "ajabase/common/common.h"
 #include "math.h"
+#include <list>
+#include <map>
+#include <typeinfo>
 
 #define TPGFAIL(__x__)	AJA_sERROR	(AJA_DebugUnit_VideoGeneric, AJAFUNC << ": " << __x__)
 #define TPGWARN(__x__)	AJA_sWARNING(AJA_DebugUnit_VideoGeneric, AJAFUNC << ": " << __x__)
@@ -2583,6 +2588,118 @@ ULWord NTV2TestPatternGen::findRGBColorByName (const string & inName)
 	return iter != strToWebColors.end()	 ?	iter->second  :	 0UL;
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//	Pattern Cache
+
+struct TPCacheKey
+{
+	NTV2TestPatternSelect	fPattern;
+	NTV2PixelFormat			fPixelFormat;
+	ULWord					fWidth;
+	ULWord					fHeight;
+	ULWord					fBytesPerRow;
+	bool					fSMPTERange;
+	bool					fAlphaFromLuma;
+	double					fSliderValue;	///< @brief	Only affects NTV2_TestPatt_ZonePlate, otherwise zero
+
+	bool operator < (const TPCacheKey & inRHS) const
+	{
+		if (fPattern != inRHS.fPattern)				return fPattern < inRHS.fPattern;
+		if (fPixelFormat != inRHS.fPixelFormat)		return fPixelFormat < inRHS.fPixelFormat;
+		if (fWidth != inRHS.fWidth)					return fWidth < inRHS.fWidth;
+		if (fHeight != inRHS.fHeight)				return fHeight < inRHS.fHeight;
+		if (fBytesPerRow != inRHS.fBytesPerRow)		return fBytesPerRow < inRHS.fBytesPerRow;
+		if (fSMPTERange != inRHS.fSMPTERange)		return fSMPTERange < inRHS.fSMPTERange;
+		if (fAlphaFromLuma != inRHS.fAlphaFromLuma)	return fAlphaFromLuma < inRHS.fAlphaFromLuma;
+		return fSliderValue < inRHS.fSliderValue;
+	}
+};
+
+struct TPCacheEntry
+{
+	TPCacheKey				fKey;
+	std::vector<UByte>		fRaster;		///< @brief	The visible raster
+};
+
+typedef std::list<TPCacheEntry>						TPCacheList;	//	Most recently used first
+typedef std::map<TPCacheKey, TPCacheList::iterator>	TPCacheMap;
+
+static AJALock		sTPCacheLock;
+static TPCacheList	sTPCacheList;
+static TPCacheMap	sTPCacheMap;
+static ULWord64		sTPCacheBudget	(256ULL * 1024ULL * 1024ULL);
+static ULWord64		sTPCacheBytes	(0);
+static ULWord64		sTPCacheHits	(0);
+static ULWord64		sTPCacheMisses	(0);
+
+//	Discards least recently used patterns until the cache fits its budget. Caller must hold sTPCacheLock.
+static void TPCacheTrim (void)
+{
+	while (sTPCacheBytes > sTPCacheBudget  &&  !sTPCacheList.empty())
+	{
+		sTPCacheBytes -= sTPCacheList.back().fRaster.size();
+		sTPCacheMap.erase(sTPCacheList.back().fKey);
+		sTPCacheList.pop_back();
+	}
+}
+
+static bool TPCacheFetch (const TPCacheKey & inKey, UByte * pOutRaster, const size_t inByteCount)
+{
+	AJAAutoLock autoLock (&sTPCacheLock);
+	TPCacheMap::iterator it (sTPCacheMap.find(inKey));
+	if (it == sTPCacheMap.end()  ||  it->second->fRaster.size() != inByteCount)
+		{sTPCacheMisses++;  return false;}
+	sTPCacheList.splice(sTPCacheList.begin(), sTPCacheList, it->second);	//	Now most recently used
+	::memcpy(pOutRaster, &it->second->fRaster[0], inByteCount);
+	sTPCacheHits++;
+	return true;
+}
+
+static void TPCacheStore (const TPCacheKey & inKey, const UByte * pInRaster, const size_t inByteCount)
+{
+	AJAAutoLock autoLock (&sTPCacheLock);
+	if (ULWord64(inByteCount) > sTPCacheBudget  ||  sTPCacheMap.find(inKey) != sTPCacheMap.end())
+		return;		//	Too big, or another thread beat me to it
+	sTPCacheList.push_front(TPCacheEntry());
+	TPCacheEntry & entry (sTPCacheList.front());
+	entry.fKey = inKey;
+	entry.fRaster.assign(pInRaster, pInRaster + inByteCount);
+	sTPCacheMap[inKey] = sTPCacheList.begin();
+	sTPCacheBytes += inByteCount;
+	TPCacheTrim();
+}
+
+void NTV2TestPatternGen::setCacheBudget (const ULWord64 inMaxBytes)
+{
+	AJAAutoLock autoLock (&sTPCacheLock);
+	sTPCacheBudget = inMaxBytes;
+	TPCacheTrim();
+}
+
+ULWord64 NTV2TestPatternGen::getCacheBudget (void)
+{
+	AJAAutoLock autoLock (&sTPCacheLock);
+	return sTPCacheBudget;
+}
+
+void NTV2TestPatternGen::flushCache (void)
+{
+	AJAAutoLock autoLock (&sTPCacheLock);
+	sTPCacheMap.clear();
+	sTPCacheList.clear();
+	sTPCacheBytes = 0;
+}
+
+void NTV2TestPatternGen::getCacheStats (ULWord64 & outHits, ULWord64 & outMisses, ULWord64 & outBytes, const bool inReset)
+{
+	AJAAutoLock autoLock (&sTPCacheLock);
+	outHits = sTPCacheHits;
+	outMisses = sTPCacheMisses;
+	outBytes = sTPCacheBytes;
+	if (inReset)
+		sTPCacheHits = sTPCacheMisses = 0;
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 NTV2TestPatternGen::NTV2TestPatternGen()
@@ -2601,6 +2718,7 @@ NTV2TestPatternGen::NTV2TestPatternGen()
 		mSetDstVancBlack	(false),
 		mSliderValue		(DEFAULT_PATT_GAIN),
 		mSignalMask			(NTV2_SIGNALMASK_ALL),
+		mUseCache			(true),
 		mNumPixels			(1920),
 		mNumLines			(0),
 		mBitsPerComponent	(0),
@@ -2769,17 +2887,34 @@ bool NTV2TestPatternGen::DrawTestPattern (const NTV2TestPatternSelect inPattern,
 	if (buffer.GetByteCount() < mDstBufferSize)
 		{TPGFAIL("Actual buffer size " << DEC(buffer.GetByteCount()) << " < reqd size " << DEC(mDstBufferSize)); return false;}
 
-	mRGBBuffer.resize(mDstFrameWidth * mDstFrameHeight * 3 + 1);
-
 	mpDstBuffer = inFormatDesc.GetTopVisibleRowAddress(AsUBytePtr(buffer.GetHostPointer()));
 
-	mpPackedLineBuffer = new uint32_t[mDstFrameWidth*2];
-	mpUnpackedLineBuffer = new uint16_t[mDstFrameWidth*4];
-	MakeUnPacked10BitYCbCrBuffer(mpUnpackedLineBuffer,CCIR601_10BIT_BLACK,CCIR601_10BIT_CHROMAOFFSET,CCIR601_10BIT_CHROMAOFFSET,mDstFrameWidth);
-	if (NTV2_IS_12B_PATTERN(inPattern))
-		HDRTPGeometry geom(mNumPixels, mNumLines);	//	setupHDRTestPatternGeometries();
+	//	Subclasses may override the Draw methods, so only my own renderings are cached...
+	const bool useCache (mUseCache  &&  typeid(*this) == typeid(NTV2TestPatternGen));
+	const TPCacheKey key = {inPattern, mDstPixelFormat, mDstFrameWidth, mDstFrameHeight, mDstLinePitch,
+							mSetRGBSmpteRange, mSetAlphaFromLuma, inPattern == NTV2_TestPatt_ZonePlate ? mSliderValue : 0.0};
+	bool ok(false);
+	if (useCache  &&  TPCacheFetch(key, mpDstBuffer, mDstBufferSize))
+	{
+		ok = true;
+		if (inPattern == NTV2_TestPatt_MultiBurst  ||  inPattern == NTV2_TestPatt_LineSweep)
+			mSignalMask = NTV2_SIGNALMASK_Y;	//	Same as DrawSegmentedTestPattern
+	}
+	else
+	{
+		UByte * pTopVisibleRow (mpDstBuffer);
+		if (NTV2_IS_12B_PATTERN(inPattern))	//	Only the 12-bit patterns use mRGBBuffer
+			mRGBBuffer.resize(mDstFrameWidth * mDstFrameHeight * 3 + 1);
+		mpPackedLineBuffer = new uint32_t[mDstFrameWidth*2];
+		mpUnpackedLineBuffer = new uint16_t[mDstFrameWidth*4];
+		MakeUnPacked10BitYCbCrBuffer(mpUnpackedLineBuffer,CCIR601_10BIT_BLACK,CCIR601_10BIT_CHROMAOFFSET,CCIR601_10BIT_CHROMAOFFSET,mDstFrameWidth);
+		if (NTV2_IS_12B_PATTERN(inPattern))
+			HDRTPGeometry geom(mNumPixels, mNumLines);	//	setupHDRTestPatternGeometries();
 TPGDBUG("mpPackedLineBuff sz=" << DEC(mDstFrameWidth*2*4) << ", mpUnpackedLineBuff sz=" << DEC(mDstFrameWidth*4*2));
-	bool ok(drawIt());
+		ok = drawIt();
+		if (ok  &&  useCache)
+			TPCacheStore(key, pTopVisibleRow, mDstBufferSize);
+	}
 	if (ok	&&	setVANCToLegalBlack()  &&  inFormatDesc.IsVANC())
 	{	//	Set the VANC area, if any, to legal black...
 		if (!::SetRasterLinesBlack(inFormatDesc.GetPixelFormat(), AsUBytePtr(buffer.GetHostPointer()),
@@ -3028,22 +3163,33 @@ bool NTV2TestPatternGen::DrawLinearRampFrame()
 
 bool NTV2TestPatternGen::DrawSlantRampFrame()
 {
+	const bool ok (drawLines(&NTV2TestPatternGen::DrawSlantRampLines, mDstFrameHeight));
+	mpDstBuffer += mDstFrameHeight * mDstLinePitch;
+	return ok;
+}
+
+bool NTV2TestPatternGen::DrawSlantRampLines (const ULWord inFirstLine, const ULWord inNumLines)
+{
+	vector<uint16_t>	unpackedLine (mDstFrameWidth*4);
+	vector<uint32_t>	packedLine (mDstFrameWidth*2);
+	uint8_t *			pDstLine (mpDstBuffer + inFirstLine * mDstLinePitch);
+
 	// Ramp from 0x40-0x3AC
-	for ( uint32_t line = 0; line < mDstFrameHeight; line++ )
+	for ( uint32_t line = inFirstLine; line < inFirstLine + inNumLines; line++ )
 	{
 		uint16_t value = (line%(0x3AC-0x40))+0x40;
 
-		for ( uint16_t pixel = 0; pixel < mDstFrameWidth; pixel++ )
+		for ( uint32_t pixel = 0; pixel < mDstFrameWidth; pixel++ )
 		{
-			mpUnpackedLineBuffer[pixel*2] = value;
-			mpUnpackedLineBuffer[pixel*2+1] = value;
+			unpackedLine[pixel*2] = value;
+			unpackedLine[pixel*2+1] = value;
 			value++;
 			if ( value > 0x3AC )
 				value = 0x40;
 		}
-		ConvertUnpacked10BitYCbCrToPixelFormat(mpUnpackedLineBuffer, mpPackedLineBuffer,mDstFrameWidth,mDstPixelFormat,mSetRGBSmpteRange, mSetAlphaFromLuma);
-		::memcpy(mpDstBuffer,mpPackedLineBuffer,mDstLinePitch);
-		mpDstBuffer += mDstLinePitch;
+		ConvertUnpacked10BitYCbCrToPixelFormat(&unpackedLine[0], &packedLine[0],mDstFrameWidth,mDstPixelFormat,mSetRGBSmpteRange, mSetAlphaFromLuma);
+		::memcpy(pDstLine,&packedLine[0],mDstLinePitch);
+		pDstLine += mDstLinePitch;
 	}
 	return true;
 }
@@ -3117,25 +3263,41 @@ static uint16_t MakeSineWaveVideoEx (const double radians, const bool bChroma, c
 }
 
 bool NTV2TestPatternGen::DrawZonePlateFrame()
+{
+	const bool ok (drawLines(&NTV2TestPatternGen::DrawZonePlateLines, mDstFrameHeight));
+	mpDstBuffer += mDstFrameHeight * mDstLinePitch;
+	return ok;
+}
+
+bool NTV2TestPatternGen::DrawZonePlateLines (const ULWord inFirstLine, const ULWord inNumLines)
 {
 	static const double kPi(3.1415926535898);
 	double pattScale = (kPi*.5 ) / (mDstFrameWidth + 1);
+	vector<uint16_t>	unpackedLine (mDstFrameWidth*4);
+	vector<uint32_t>	packedLine (mDstFrameWidth*2);
+	uint8_t *			pDstLine (mpDstBuffer + inFirstLine * mDstLinePitch);
 
-	for (uint32_t line(0);	line < mDstFrameHeight;	 line++)
+	//	Pixels 'n' and 'width-n' are equidistant from the center, so only compute the left half (plus the center)...
+	const uint32_t numToCompute (mDstFrameWidth & 1  ?  mDstFrameWidth  :  mDstFrameWidth / 2 + 1);
+	for (uint32_t line(inFirstLine);  line < inFirstLine + inNumLines;  line++)
 	{
-		for (uint16_t pixel(0);	 pixel < mDstFrameWidth;  pixel++)
+		for (uint32_t pixel(0);	 pixel < numToCompute;  pixel++)
 		{
 			double xDist = double(pixel) - (double(mDstFrameWidth)	/ 2.0);
 			double yDist = double(line) - (double(mDstFrameHeight) / 2.0);
 			double r = ((xDist * xDist) + (yDist * yDist)) * pattScale;
 
-			mpUnpackedLineBuffer[pixel*2+1] = MakeSineWaveVideoEx(r, false, mSliderValue);
-			mpUnpackedLineBuffer[pixel*2  ] = MakeSineWaveVideoEx(r,  true, mSliderValue);
-
+			unpackedLine[pixel*2+1] = MakeSineWaveVideoEx(r, false, mSliderValue);
+			unpackedLine[pixel*2  ] = MakeSineWaveVideoEx(r,  true, mSliderValue);
 		}
-		ConvertUnpacked10BitYCbCrToPixelFormat(mpUnpackedLineBuffer, mpPackedLineBuffer,mDstFrameWidth,mDstPixelFormat,mSetRGBSmpteRange, mSetAlphaFromLuma);
-		::memcpy(mpDstBuffer,mpPackedLineBuffer,mDstLinePitch);
-		mpDstBuffer += mDstLinePitch;
+		for (uint32_t pixel(numToCompute);	 pixel < mDstFrameWidth;  pixel++)
+		{
+			unpackedLine[pixel*2+1] = unpackedLine[(mDstFrameWidth-pixel)*2+1];
+			unpackedLine[pixel*2  ] = unpackedLine[(mDstFrameWidth-pixel)*2  ];
+		}
+		ConvertUnpacked10BitYCbCrToPixelFormat(&unpackedLine[0], &packedLine[0],mDstFrameWidth,mDstPixelFormat,mSetRGBSmpteRange, mSetAlphaFromLuma);
+		::memcpy(pDstLine,&packedLine[0],mDstLinePitch);
+		pDstLine += mDstLinePitch;
 	}
 	return true;
 }
@@ -3667,19 +3829,31 @@ static void ConvertRGBLineTo10BitYCbCr422 (AJA_RGB16BitPixel* lineBuffer, const
 
 void NTV2TestPatternGen::PrepareForOutput()
 {
-	uint16_t* rgb16BitBuffer = new uint16_t[mNumPixels*mNumLines * 3];
-	uint16_t* rgb12Buffer = mRGBBuffer.data();
-	ULWord* buffer = AsULWordPtr(rgb16BitBuffer);
-	for (uint32_t i(0);	 i < mNumPixels*mNumLines;	i++)
-	{
-		uint16_t r = uint16_t((*rgb12Buffer++) << 4);
-		uint16_t g = uint16_t((*rgb12Buffer++) << 4);
-		uint16_t b = uint16_t((*rgb12Buffer++) << 4);
-		*rgb16BitBuffer++ = b;	// b
-		*rgb16BitBuffer++ = g; //g
-		*rgb16BitBuffer++ = r;
-	}
-	::memcpy(mpDstBuffer, AsUInt8Ptr(buffer), mDstBufferSize);
+	drawLines(&NTV2TestPatternGen::PrepareLinesForOutput, mNumLines);
+}
+
+bool NTV2TestPatternGen::PrepareLinesForOutput (const ULWord inFirstLine, const ULWord inNumLines)
+{
+	//	mRGBBuffer holds 12-bit R,G,B components, which are written into the destination as 16-bit B,G,R,
+	//	filling no more than mDstBufferSize bytes...
+	const size_t	maxPixels	(mDstBufferSize / 6);
+	const size_t	firstPixel	(size_t(inFirstLine) * mNumPixels);
+	const size_t	bandEnd		(size_t(inFirstLine + inNumLines) * mNumPixels);
+	const size_t	endPixel	(bandEnd < maxPixels ? bandEnd : maxPixels);
+	const uint16_t * pRGB12 (mRGBBuffer.data() + firstPixel * 3);
+	uint16_t *		pBGR16 (AsUInt16Ptr(mpDstBuffer) + firstPixel * 3);
+	for (size_t pixel(firstPixel);  pixel < endPixel;  pixel++,  pRGB12 += 3,  pBGR16 += 3)
+	{	//	Simple enough for the compiler to vectorize
+		pBGR16[0] = uint16_t(pRGB12[2] << 4);
+		pBGR16[1] = uint16_t(pRGB12[1] << 4);
+		pBGR16[2] = uint16_t(pRGB12[0] << 4);
+	}
+	if (firstPixel <= maxPixels  &&  maxPixels < bandEnd  &&  (mDstBufferSize % 6))
+	{	//	Partial last pixel
+		const uint16_t bgr16[3] = {uint16_t(pRGB12[2] << 4), uint16_t(pRGB12[1] << 4), uint16_t(pRGB12[0] << 4)};
+		::memcpy(pBGR16, bgr16, mDstBufferSize % 6);
+	}
+	return true;
 }
 
 
@@ -4023,21 +4197,31 @@ bool NTV2TestPatternGen::DrawTestPatternWidePQ()
 bool NTV2TestPatternGen::Draw12BitRamp()
 {
 	mBitsPerComponent = 16;
-	size_t ndx(0);//uint16_t* rgbBuffer (&mRGBBuffer.at(0));
 	NTV2_ASSERT(mRGBBuffer.size() >= size_t(3*mNumPixels*mNumLines));
-	for (uint32_t lineCount(0);	 lineCount < mNumLines;	 lineCount++)
-		for (uint32_t pixelCount(0);  pixelCount < mNumPixels;	pixelCount++)
-		{
-			const double dvalue (double(pixelCount)*(4095.0/double(mNumPixels-1)));
-			const uint16_t ivalue = uint16_t(dvalue);
-			mRGBBuffer.at(ndx++) = ivalue;
-			mRGBBuffer.at(ndx++) = ivalue;
-			mRGBBuffer.at(ndx++) = ivalue;
-		}
+	if (!drawLines(&NTV2TestPatternGen::Fill12BitRampLines, mNumLines))
+		return false;
 	PrepareForOutput();
 	return true;
 }
 
+bool NTV2TestPatternGen::Fill12BitRampLines (const ULWord inFirstLine, const ULWord inNumLines)
+{
+	//	Every line is the same, so compute the band's first line, then copy it...
+	uint16_t * pFirstLine (mRGBBuffer.data() + size_t(inFirstLine) * mNumPixels * 3);
+	size_t ndx(0);
+	for (uint32_t pixelCount(0);  pixelCount < mNumPixels;	pixelCount++)
+	{
+		const double dvalue (double(pixelCount)*(4095.0/double(mNumPixels-1)));
+		const uint16_t ivalue = uint16_t(dvalue);
+		pFirstLine[ndx++] = ivalue;
+		pFirstLine[ndx++] = ivalue;
+		pFirstLine[ndx++] = ivalue;
+	}
+	for (uint32_t lineCount(1);	 lineCount < inNumLines;  lineCount++)
+		::memcpy(pFirstLine + size_t(lineCount) * mNumPixels * 3, pFirstLine, mNumPixels * 3 * sizeof(uint16_t));
+	return true;
+}
+
 
 static const int	kRGBMinChroma12		(0x10);
 static const int	kRGBMaxChroma12		(0xFEF);
@@ -4056,21 +4240,55 @@ static uint32_t MakeSineWaveVideo (const double radians, const double Gain)
 bool NTV2TestPatternGen::Draw12BitZonePlate()
 {
 	mBitsPerComponent = 16;
-	const double pattScale ((kPi * 0.5 ) / double(mNumPixels + 1));
-	size_t ndx(0);//uint16_t * pRGBBuffer (&mRGBBuffer.at(0));
 	NTV2_ASSERT(mRGBBuffer.size() >= size_t(3*mNumPixels*mNumLines));
-	for (uint32_t lineCount(0);	 lineCount < mNumLines;	 lineCount++)
-		for (uint32_t pixelCount(0);  pixelCount < mNumPixels;	pixelCount++)
+	if (!drawLines(&NTV2TestPatternGen::Fill12BitZonePlateLines, mNumLines))
+		return false;
+	PrepareForOutput();
+	return true;
+}
+
+bool NTV2TestPatternGen::Fill12BitZonePlateLines (const ULWord inFirstLine, const ULWord inNumLines)
+{
+	const double pattScale ((kPi * 0.5 ) / double(mNumPixels + 1));
+	//	Pixels 'n' and 'width-n' are equidistant from the center, so only compute the left half (plus the center)...
+	const uint32_t numToCompute (mNumPixels & 1  ?  mNumPixels  :  mNumPixels / 2 + 1);
+	for (uint32_t lineCount(inFirstLine);  lineCount < inFirstLine + inNumLines;  lineCount++)
+	{
+		uint16_t * pLine (mRGBBuffer.data() + size_t(lineCount) * mNumPixels * 3);
+		for (uint32_t pixelCount(0);  pixelCount < numToCompute;	pixelCount++)
 		{
 			const double xDist(double(pixelCount) - (double(mNumPixels) / 2.0));
 			const double yDist(double(lineCount) - (double(mNumLines) / 2.0));
 			const double r (((xDist * xDist) + (yDist * yDist)) * pattScale);
 			const uint16_t u16 (uint16_t(MakeSineWaveVideo(r, 0.9)));
 
-			mRGBBuffer[ndx++] = u16;
-			mRGBBuffer[ndx++] = u16;
-			mRGBBuffer[ndx++] = u16;
+			pLine[pixelCount*3+0] = u16;
+			pLine[pixelCount*3+1] = u16;
+			pLine[pixelCount*3+2] = u16;
 		}
-	PrepareForOutput();
+		for (uint32_t pixelCount(numToCompute);  pixelCount < mNumPixels;	pixelCount++)
+		{
+			const uint16_t u16 (pLine[(mNumPixels-pixelCount)*3]);
+			pLine[pixelCount*3+0] = u16;
+			pLine[pixelCount*3+1] = u16;
+			pLine[pixelCount*3+2] = u16;
+		}
+	}
 	return true;
 }
+
+bool NTV2TestPatternGen::drawLines (LineDrawer inDrawer, const ULWord inNumLines)
+{
+	struct BandJob
+	{
+		NTV2TestPatternGen *	fGen;
+		LineDrawer				fDrawer;
+		static bool DrawBand (void * pContext, const ULWord inFirstLine, const ULWord inNumLines)
+		{
+			const BandJob & job (*reinterpret_cast<const BandJob*>(pContext));
+			return (job.fGen->*job.fDrawer)(inFirstLine, inNumLines);
+		}
+	};
+	BandJob job = {this, inDrawer};
+	return NTV2FrameConverter::GetShared().RunBands(inNumLines, BandJob::DrawBand, &job);
+}
@@ -17,6 +17,7 @@
 #include "ntv2devicefeatures.h"	//	Required for NTV2DeviceCanDoVideoFormat
 #include "ajabase/system/lock.h"
 #include "ajabase/common/common.h"
+#include "ajabase/common/pixelkernels.h"
 #if defined(AJALinux)
 	#include <string.h>	 // For memset
 	#include <stdint.h>
@@ -168,30 +169,14 @@ bool UnpackLine_10BitYUVtoUWordSequence (const void * pIn10BitYUVLine, const NTV
 // UnPack 10 Bit YCbCr Data to 16 bit Word per component
 void UnPack10BitYCbCrBuffer( uint32_t* packedBuffer, uint16_t* ycbcrBuffer, uint32_t numPixels )
 {
-	for (  uint32_t sampleCount = 0, dataCount = 0; 
-		sampleCount < (numPixels*2) ; 
-		sampleCount+=3,dataCount++ )
-	{
-		ycbcrBuffer[sampleCount]   =  packedBuffer[dataCount]&0x3FF;  
-		ycbcrBuffer[sampleCount+1] = (packedBuffer[dataCount]>>10)&0x3FF;  
-		ycbcrBuffer[sampleCount+2] = (packedBuffer[dataCount]>>20)&0x3FF;  
-
-	}
+	AJA_UnPack10BitYCbCrLine (packedBuffer, ycbcrBuffer, numPixels);
 }
 
 // PackTo10BitYCbCrBuffer
 // Pack 16 bit Word per component to 10 Bit YCbCr Data 
 void PackTo10BitYCbCrBuffer (const uint16_t * ycbcrBuffer, uint32_t * packedBuffer, const uint32_t numPixels)
 {
-	for ( uint32_t inputCount=0, outputCount=0; 
-		inputCount < (numPixels*2);
-		outputCount += 4, inputCount += 12 )
-	{
-		packedBuffer[outputCount]	= uint32_t (ycbcrBuffer[inputCount+0]) + uint32_t (ycbcrBuffer[inputCount+1]<<10) + uint32_t (ycbcrBuffer[inputCount+2]<<20);
-		packedBuffer[outputCount+1] = uint32_t (ycbcrBuffer[inputCount+3]) + uint32_t (ycbcrBuffer[inputCount+4]<<10) + uint32_t (ycbcrBuffer[inputCount+5]<<20);
-		packedBuffer[outputCount+2] = uint32_t (ycbcrBuffer[inputCount+6]) + uint32_t (ycbcrBuffer[inputCount+7]<<10) + uint32_t (ycbcrBuffer[inputCount+8]<<20);
-		packedBuffer[outputCount+3] = uint32_t (ycbcrBuffer[inputCount+9]) + uint32_t (ycbcrBuffer[inputCount+10]<<10) + uint32_t (ycbcrBuffer[inputCount+11]<<20);
-	}
+	AJA_Pack10BitYCbCrLine (ycbcrBuffer, packedBuffer, numPixels);
 }
 
 void MakeUnPacked10BitYCbCrBuffer( uint16_t* buffer, uint16_t Y , uint16_t Cb , uint16_t Cr,uint32_t numPixels )
@@ -513,14 +498,7 @@ void UnpackLine_10BitYUVto16BitYUV (const ULWord * pIn10BitYUVLine, UWord * pOut
 	NTV2_ASSERT (pIn10BitYUVLine && pOut16BitYUVLine && "UnpackLine_10BitYUVto16BitYUV -- NULL buffer pointer(s)");
 	NTV2_ASSERT (inNumPixels && "UnpackLine_10BitYUVto16BitYUV -- Zero pixel count");
 
-	for (ULWord outputCount = 0,  inputCount = 0;
-		 outputCount < (inNumPixels * 2);
-		 outputCount += 3,	inputCount++)
-	{
-		pOut16BitYUVLine [outputCount	 ] =  pIn10BitYUVLine [inputCount]		  & 0x3FF;
-		pOut16BitYUVLine [outputCount + 1] = (pIn10BitYUVLine [inputCount] >> 10) & 0x3FF;
-		pOut16BitYUVLine [outputCount + 2] = (pIn10BitYUVLine [inputCount] >> 20) & 0x3FF;
-	}
+	AJA_UnPack10BitYCbCrLine (pIn10BitYUVLine, pOut16BitYUVLine, inNumPixels);
 }
 
 
@@ -529,15 +507,7 @@ void PackLine_16BitYUVto10BitYUV (const UWord * pIn16BitYUVLine, ULWord * pOut10
 	NTV2_ASSERT (pIn16BitYUVLine && pOut10BitYUVLine && "PackLine_16BitYUVto10BitYUV -- NULL buffer pointer(s)");
 	NTV2_ASSERT (inNumPixels && "PackLine_16BitYUVto10BitYUV -- Zero pixel count");
 
-	for (ULWord inputCount = 0,	 outputCount = 0;
-		  inputCount < (inNumPixels * 2);
-		  outputCount += 4,	 inputCount += 12)
-	{
-		pOut10BitYUVLine [outputCount	 ] = ULWord (pIn16BitYUVLine [inputCount + 0]) + (ULWord (pIn16BitYUVLine [inputCount + 1]) << 10) + (ULWord (pIn16BitYUVLine [inputCount + 2]) << 20);
-		pOut10BitYUVLine [outputCount + 1] = ULWord (pIn16BitYUVLine [inputCount + 3]) + (ULWord (pIn16BitYUVLine [inputCount + 4]) << 10) + (ULWord (pIn16BitYUVLine [inputCount + 5]) << 20);
-		pOut10BitYUVLine [outputCount + 2] = ULWord (pIn16BitYUVLine [inputCount + 6]) + (ULWord (pIn16BitYUVLine [inputCount + 7]) << 10) + (ULWord (pIn16BitYUVLine [inputCount + 8]) << 20);
-		pOut10BitYUVLine [outputCount + 3] = ULWord (pIn16BitYUVLine [inputCount + 9]) + (ULWord (pIn16BitYUVLine [inputCount +10]) << 10) + (ULWord (pIn16BitYUVLine [inputCount +11]) << 20);
-	}	//	for each component in the line
+	AJA_Pack10BitYCbCrLine (pIn16BitYUVLine, pOut10BitYUVLine, inNumPixels);
 }
 
 
@@ -303,6 +303,8 @@ bool CNTV2WinDriverInterface::ReadRegister (const ULWord inRegNum,	ULWord & outV
 		WDIFAIL("Shift " << DEC(inShift) << " > 31, reg=" << DEC(inRegNum) << " msk=" << xHEX0N(inMask,8));
 		return false;
 	}
+	if (ShadowReadRegister(inRegNum, outValue, inMask, inShift))
+		return true;	//	Answered from shadow register cache
 #if defined(NTV2_NUB_CLIENT_SUPPORT)
 	if (IsRemote())
 		return CNTV2DriverInterface::ReadRegister (inRegNum, outValue, inMask, inShift);
@@ -321,6 +323,7 @@ bool CNTV2WinDriverInterface::ReadRegister (const ULWord inRegNum,	ULWord & outV
 	propStruct.RegisterID		= inRegNum;
 	propStruct.ulRegisterMask	= inMask;
 	propStruct.ulRegisterShift	= inShift;
+	const ULWord shadowGen (ShadowRegisterGeneration(inRegNum));
 	AJADebug::StatTimerStart(AJA_DebugStat_ReadRegister);
 	const bool ok = DeviceIoControl(_hDevice, IOCTL_AJAPROPS_GETSETREGISTER, &propStruct, sizeof(KSPROPERTY_AJAPROPS_GETSETREGISTER_S),
 						&propStruct, sizeof(KSPROPERTY_AJAPROPS_GETSETREGISTER_S), &dwBytesReturned, NULL);
@@ -328,6 +331,7 @@ bool CNTV2WinDriverInterface::ReadRegister (const ULWord inRegNum,	ULWord & outV
 	if (ok)
 	{
 		outValue = propStruct.ulRegisterValue;
+		ShadowStoreRegister(inRegNum, outValue, inMask, inShift, shadowGen);
 		return true;
 	}
 	WDIFAIL("reg=" << DEC(inRegNum) << " val=" << xHEX0N(outValue,8) << " msk=" << xHEX0N(inMask,8) << " shf=" << DEC(inShift) << " failed: " << ::GetKernErrStr(GetLastError()));
@@ -378,6 +382,7 @@ bool CNTV2WinDriverInterface::WriteRegister (const ULWord inRegNum,	 const ULWor
 		WDIFAIL("reg=" << DEC(inRegNum) << " val=" << xHEX0N(inValue,8) << " msk=" << xHEX0N(inMask,8) << " shf=" << DEC(inShift) << " failed: " << ::GetKernErrStr(GetLastError()));
 		return false;
 	}
+	ShadowWriteRegister(inRegNum, inValue, inMask, inShift);
 	return true;
 }
 
@@ -12,19 +12,28 @@
 #define DOCTEST_THREAD_LOCAL
 #include "doctest.h"
 #include "ntv2bitfile.h"
+#include "ntv2bufferpool.h"
 #include "ntv2card.h"
 #include "ntv2debug.h"
 #include "ntv2endian.h"
+#include "ntv2frameconverter.h"
 #include "ntv2signalrouter.h"
 #include "ntv2routingexpert.h"
+#include "ntv2registerexpert.h"
 #include "ntv2transcode.h"
 #include "ntv2utils.h"
 #include "ntv2vpid.h"
+#include "ut_devicefeatures.h"
 #include "ntv2version.h"
 #include "ntv2testpatterngen.h"
 #include "ajabase/system/debug.h"
+#include "ajabase/system/systemtime.h"
+#include "ajabase/system/thread.h"
 #include "ajabase/common/common.h"
+#include "ajabase/common/pixelkernels.h"
+#include "ajabase/common/videoutilities.h"
 #include <vector>
+#include <set>
 #include <algorithm>
 #include <iomanip>
 #include <iterator>    //      For std::inserter
@@ -652,6 +661,81 @@ TEST_SUITE("ntv2utils" * doctest::description("ntv2 utils functions")) {
 			}	//	for each pixel format
 		}	//	for each standard
 	}	//	TEST_CASE("SetRasterLinesBlack")
+
+	//	Reference implementations -- verbatim copies of the original scalar loops
+	static void RefUnpack10BitYUV (const ULWord * pIn, UWord * pOut, const ULWord inNumPixels)
+	{
+		for (ULWord outputCount = 0,  inputCount = 0;  outputCount < (inNumPixels * 2);  outputCount += 3,  inputCount++)
+		{
+			pOut [outputCount	 ] =  pIn [inputCount]		 & 0x3FF;
+			pOut [outputCount + 1] = (pIn [inputCount] >> 10) & 0x3FF;
+			pOut [outputCount + 2] = (pIn [inputCount] >> 20) & 0x3FF;
+		}
+	}
+	static void RefPack10BitYUV (const UWord * pIn, ULWord * pOut, const ULWord inNumPixels)
+	{
+		for (ULWord inputCount = 0,  outputCount = 0;  inputCount < (inNumPixels * 2);  outputCount += 4,  inputCount += 12)
+		{
+			pOut [outputCount	 ] = ULWord (pIn [inputCount + 0]) + (ULWord (pIn [inputCount + 1]) << 10) + (ULWord (pIn [inputCount + 2]) << 20);
+			pOut [outputCount + 1] = ULWord (pIn [inputCount + 3]) + (ULWord (pIn [inputCount + 4]) << 10) + (ULWord (pIn [inputCount + 5]) << 20);
+			pOut [outputCount + 2] = ULWord (pIn [inputCount + 6]) + (ULWord (pIn [inputCount + 7]) << 10) + (ULWord (pIn [inputCount + 8]) << 20);
+			pOut [outputCount + 3] = ULWord (pIn [inputCount + 9]) + (ULWord (pIn [inputCount +10]) << 10) + (ULWord (pIn [inputCount +11]) << 20);
+		}
+	}
+
+	TEST_CASE("PackUnpack10BitYUV SIMD")
+	{
+		static const ULWord widths[] = {1, 2, 3, 5, 6, 11, 12, 23, 24, 47, 48, 49, 95, 96, 97, 720, 1280, 1918, 1920, 2048, 3840, 4096, 7680, 8192};
+		const AJA_SIMDLevel savedLevel (AJA_GetSIMDLevel());
+		vector<AJA_SIMDLevel> levels;
+		for (int lvl(AJA_SIMD_NONE);  lvl < AJA_SIMD_INVALID;  lvl++)
+			if (AJA_SetSIMDLevel(AJA_SIMDLevel(lvl)))
+				levels.push_back(AJA_SIMDLevel(lvl));
+		CHECK_FALSE(levels.empty());
+		LOGNOTE("Supported SIMD level: " << ::AJA_SIMDLevelToString(::AJA_GetSupportedSIMDLevel()));
+
+		const size_t kSlop (64);	//	Guard area to detect overruns past what the scalar code writes
+		uint32_t rnd (0x1234567);
+		for (size_t ndx(0);  ndx < sizeof(widths)/sizeof(ULWord);  ndx++)
+		{
+			const ULWord numPixels (widths[ndx]);
+			const size_t numWords (size_t(numPixels/6 + 1) * 4 + kSlop),  numComps (numWords * 3 + kSlop);
+			vector<ULWord> packed(numWords), refPacked(numWords, 0xDEADBEEF);
+			vector<UWord> unpacked(numComps), refUnpacked(numComps, 0xBEEF);
+			for (size_t n(0);  n < packed.size();  n++)
+				{rnd = rnd * 1664525 + 1013904223;  packed[n] = rnd;}
+			for (size_t n(0);  n < unpacked.size();  n++)
+				{rnd = rnd * 1664525 + 1013904223;  unpacked[n] = UWord(rnd >> 16);}	//	Not limited to 10 bits
+			RefUnpack10BitYUV (&packed[0], &refUnpacked[0], numPixels);
+			RefPack10BitYUV (&unpacked[0], &refPacked[0], numPixels);
+
+			for (size_t lvlNdx(0);  lvlNdx < levels.size();  lvlNdx++)
+			{
+				CHECK(AJA_SetSIMDLevel(levels[lvlNdx]));
+				INFO("width=" << numPixels << " simd=" << ::AJA_SIMDLevelToString(levels[lvlNdx]));
+				vector<UWord> outUnpacked(numComps, 0xBEEF);
+				::UnpackLine_10BitYUVto16BitYUV (&packed[0], &outUnpacked[0], numPixels);
+				CHECK(outUnpacked == refUnpacked);
+				outUnpacked.assign(numComps, 0xBEEF);
+				::UnPack10BitYCbCrBuffer (&packed[0], &outUnpacked[0], numPixels);
+				CHECK(outUnpacked == refUnpacked);
+				outUnpacked.assign(numComps, 0xBEEF);
+				::AJA_UnPack10BitYCbCrBuffer (&packed[0], &outUnpacked[0], numPixels);
+				CHECK(outUnpacked == refUnpacked);
+
+				vector<ULWord> outPacked(numWords, 0xDEADBEEF);
+				::PackLine_16BitYUVto10BitYUV (&unpacked[0], &outPacked[0], numPixels);
+				CHECK(outPacked == refPacked);
+				outPacked.assign(numWords, 0xDEADBEEF);
+				::PackTo10BitYCbCrBuffer (&unpacked[0], &outPacked[0], numPixels);
+				CHECK(outPacked == refPacked);
+				outPacked.assign(numWords, 0xDEADBEEF);
+				::AJA_PackTo10BitYCbCrBuffer (&unpacked[0], &outPacked[0], numPixels);
+				CHECK(outPacked == refPacked);
+			}	//	for each SIMD level
+		}	//	for each width
+		CHECK(AJA_SetSIMDLevel(savedLevel));
+	}	//	TEST_CASE("PackUnpack10BitYUV SIMD")
 }	//	TEST_SUITE("ntv2utils")
 
 void ntv2devicescanner_marker() {}
@@ -931,7 +1015,102 @@ TEST_SUITE("CNTV2VPID" * doctest::description("CNTV2VPID functions")) {
 	}
 } // ntv2vpid
 
+//	A CNTV2Card whose "hardware" registers are an array in host memory, for testing the shadow register cache
+class FakeRegistersCard : public CNTV2Card
+{
+	public:
+		FakeRegistersCard () : mRegs(kRegNumRegisters, 0), mNumHWReads(0), mNumHWWrites(0), mpWriteDuringRead(AJA_NULL)	{}
+		virtual bool ReadRegister (const ULWord inRegNum, ULWord & outValue, const ULWord inMask = 0xFFFFFFFF, const ULWord inShift = 0)
+		{
+			if (ShadowReadRegister(inRegNum, outValue, inMask, inShift))
+				return true;
+			const ULWord gen (ShadowRegisterGeneration(inRegNum));
+			mNumHWReads++;
+			outValue = (mRegs.at(inRegNum) & inMask) >> inShift;
+			if (mpWriteDuringRead)	//	Simulate another thread's write landing while the hardware read is in flight
+				{WriteRegister(mpWriteDuringRead->registerNumber, mpWriteDuringRead->registerValue);  mpWriteDuringRead = AJA_NULL;}
+			ShadowStoreRegister(inRegNum, outValue, inMask, inShift, gen);
+			return true;
+		}
+		virtual bool WriteRegister (const ULWord inRegNum, const ULWord inValue, const ULWord inMask = 0xFFFFFFFF, const ULWord inShift = 0)
+		{
+			mNumHWWrites++;
+			mRegs.at(inRegNum) = (mRegs.at(inRegNum) & ~inMask)  |  ((inValue << inShift) & inMask);
+			ShadowWriteRegister(inRegNum, inValue, inMask, inShift);
+			return true;
+		}
+		std::vector<ULWord>	mRegs;
+		ULWord				mNumHWReads, mNumHWWrites;
+		const NTV2RegInfo *	mpWriteDuringRead;
+};
+
 void bft_marker() {}
+//	Probes device features for a device ID without opening a device, so the classic device features functions answer
+class NTV2DeviceFeaturesProbe : public CNTV2Card
+{
+	public:
+		explicit NTV2DeviceFeaturesProbe (const NTV2DeviceID inDeviceID) : mProbeID(inDeviceID)	{}
+		virtual NTV2DeviceID	GetDeviceID (void)	{return mProbeID;}
+	private:
+		NTV2DeviceID	mProbeID;
+};
+
+//	One hex digit per four items, lowest item in the first digit's LS bit, trailing zero digits dropped
+static string NTV2FeatureBitsToHex (const vector<bool> & inBits)
+{
+	string result;
+	for (size_t ndx(0);  ndx < inBits.size();  ndx += 4)
+	{
+		unsigned nibble(0);
+		for (size_t bit(0);  bit < 4  &&  ndx + bit < inBits.size();  bit++)
+			if (inBits[ndx + bit])
+				nibble |= 1 << bit;
+		result += "0123456789ABCDEF"[nibble];
+	}
+	return result.erase(result.find_last_not_of('0') + 1);
+}
+
+template <typename T>	static string NTV2FeatureCanDoToHex (const NTV2DeviceID inDeviceID, bool (*pCanDo)(const NTV2DeviceID, const T), const ULWord inCount)
+{
+	vector<bool> bits(inCount, false);
+	for (ULWord item(0);  item < inCount;  item++)
+		bits[item] = pCanDo(inDeviceID, T(item));
+	return NTV2FeatureBitsToHex(bits);
+}
+
+//	Digests every bool & numeric param, every NTV2EnumsID's supported items, and the bitset-table NTV2DeviceCanDo functions
+static void NTV2DeviceFeaturesDigest (const NTV2DeviceID inDeviceID, string & outBools, string & outNums, string & outItems, string & outCanDo)
+{
+	NTV2DeviceFeaturesProbe probe(inDeviceID);
+	vector<bool> bools(size_t(kNTV2BoolParam_LAST), false);
+	for (size_t ndx(0);  ndx < bools.size();  ndx++)
+		bools[ndx] = probe.IsSupported(NTV2BoolParamID(ndx));
+	outBools = NTV2FeatureBitsToHex(bools);
+
+	ostringstream nums;
+	for (ULWord ndx(kNTV2NumericParam_FIRST);  ndx < ULWord(kNTV2NumericParam_LAST);  ndx++)
+		nums << (ndx > ULWord(kNTV2NumericParam_FIRST) ? "," : "") << probe.GetNumSupported(NTV2NumericParamID(ndx));
+	outNums = nums.str();
+
+	outItems.clear();
+	for (ULWord ndx(kNTV2EnumsID_Standard);  ndx < ULWord(kNTV2EnumsID_INVALID);  ndx++)
+	{	//	kNTV2EnumsID_DeviceID doesn't depend on the device
+		const ULWordSet items (probe.GetSupportedItems(NTV2EnumsID(ndx)));
+		vector<bool> bits(items.empty() ? 0 : size_t(*items.rbegin()) + 1, false);
+		for (ULWordSetConstIter it(items.begin());  it != items.end();  ++it)
+			bits[*it] = true;
+		outItems += (ndx > ULWord(kNTV2EnumsID_Standard) ? ";" : "") + NTV2FeatureBitsToHex(bits);
+	}
+
+	outCanDo =			NTV2FeatureCanDoToHex(inDeviceID, ::NTV2DeviceCanDoConversionMode,	ULWord(NTV2_NUM_CONVERSIONMODES));
+	outCanDo += ";" +	NTV2FeatureCanDoToHex(inDeviceID, ::NTV2DeviceCanDoDSKMode,			ULWord(NTV2_DSKMODE_INVALID));
+	outCanDo += ";" +	NTV2FeatureCanDoToHex(inDeviceID, ::NTV2DeviceCanDoFrameBufferFormat,	ULWord(NTV2_FBF_NUMFRAMEBUFFERFORMATS));
+	outCanDo += ";" +	NTV2FeatureCanDoToHex(inDeviceID, ::NTV2DeviceCanDoInputSource,		ULWord(NTV2_NUM_INPUTSOURCES));
+	outCanDo += ";" +	NTV2FeatureCanDoToHex(inDeviceID, ::NTV2DeviceCanDoVideoFormat,		ULWord(NTV2_MAX_NUM_VIDEO_FORMATS));
+	outCanDo += ";" +	NTV2FeatureCanDoToHex(inDeviceID, ::NTV2DeviceCanDoWidget,			ULWord(NTV2_WgtModuleTypeCount));
+}
+
+
 TEST_SUITE("bft" * doctest::description("ajantv2 basic functionality tests")) {
 	TEST_CASE("NTV2SegmentedXferInfo")
 	{
@@ -1819,15 +1998,90 @@ TEST_SUITE("bft" * doctest::description("ajantv2 basic functionality tests")) {
 		CHECK_EQ(::NTV2AudioChannelOctetToString (NTV2_AudioChannel121_128), "NTV2_AudioChannel121_128");
 	}
 
-	// TEST_CASE("NTV2RegisterExpert")
-	// {
-	// 	const NTV2RegNumSet	audioRegs	(CNTV2RegisterExpert::GetRegistersForClass(kRegClass_Audio));
-	// 	const NTV2RegNumSet	deviceRegs	(CNTV2RegisterExpert::GetRegistersForDevice(DEVICE_ID_KONA4));
-	// 	//cerr << endl << endl << "AUDIO REGS:" << endl << audioRegs << endl;
-	// 	//cerr << endl << endl << "DEVICE REGS:" << endl << deviceRegs << endl;
-	// 	CHECK(audioRegs.find(kRegAudioMixerInputSelects) != audioRegs.end());
-	// 	CHECK(deviceRegs.find(kRegAudioMixerInputSelects) != audioRegs.end());
-	// }
+	//	Looks up register names until stopped, counting the wrong answers
+	static void NTV2RegisterExpertLookupThread (AJAThread * pThread, void * pContext)
+	{
+		uint32_t & wrongNames (*reinterpret_cast<uint32_t*>(pContext));
+		while (!pThread->Terminate())
+			for (uint32_t regNum(kRegCh1Control);  regNum < kRegCh1Control + 64;  regNum++)
+				if (CNTV2RegisterExpert::GetDisplayName(regNum) != ::NTV2RegisterNameString(regNum))
+					wrongNames++;
+	}
+
+	TEST_CASE("NTV2RegisterExpert")
+	{
+		//	Cold start...
+		CNTV2RegisterExpert::Deallocate();
+		CHECK_FALSE(CNTV2RegisterExpert::IsAllocated());
+		uint64_t startUs (AJATime::GetSystemMicroseconds());
+		CHECK(CNTV2RegisterExpert::Allocate());
+		const uint64_t coldUs (AJATime::GetSystemMicroseconds() - startUs);
+
+		CHECK_EQ(CNTV2RegisterExpert::GetDisplayName(kRegCh1Control), "kRegCh1Control");
+		CHECK_EQ(CNTV2RegisterExpert::GetDisplayName(kVRegDriverVersion), "kVRegDriverVersion");
+		CHECK_EQ(CNTV2RegisterExpert::GetDisplayName(VIRTUALREG_START+900), "VIRTUALREG_START+900");
+		CHECK(CNTV2RegisterExpert::IsRegisterInClass(kRegAud1Control, kRegClass_Audio));
+		CHECK(CNTV2RegisterExpert::IsRegisterInClass(kRegBoardID, kRegClass_ReadOnly));
+		CHECK_FALSE(CNTV2RegisterExpert::IsRegisterInClass(kRegBoardID, kRegClass_WriteOnly));
+		CHECK_FALSE(CNTV2RegisterExpert::IsRegisterInClass(kRegBoardID, "kRegClass_NoSuchClass"));
+		const NTV2StringSet ch1Classes (CNTV2RegisterExpert::GetRegisterClasses(kRegAud1Control, true));
+		CHECK(ch1Classes.find("Audio") != ch1Classes.end());
+		CHECK(ch1Classes.find("Channel1") != ch1Classes.end());
+		const NTV2RegNumSet audioRegs (CNTV2RegisterExpert::GetRegistersForClass(kRegClass_Audio));
+		CHECK(audioRegs.find(kRegAud1Control) != audioRegs.end());
+		const NTV2RegNumSet namedRegs (CNTV2RegisterExpert::GetRegistersWithName("KREGCH1CONTROL"));
+		CHECK_EQ(namedRegs.size(), 1);
+		CHECK(namedRegs.find(kRegCh1Control) != namedRegs.end());
+		CHECK(CNTV2RegisterExpert::GetRegistersWithName("ch1control", CNTV2RegisterExpert::ENDSWITH).size() >= 1);
+		CHECK(CNTV2RegisterExpert::GetAllRegisterClasses().size() > 20);
+
+		//	Lookup throughput...
+		static const uint32_t kPasses (20);
+		size_t nameBytes (0), inClass (0);
+		startUs = AJATime::GetSystemMicroseconds();
+		for (uint32_t pass(0);  pass < kPasses;  pass++)
+			for (uint32_t regNum(0);  regNum < kRegNumRegisters;  regNum++)
+				nameBytes += CNTV2RegisterExpert::GetDisplayName(regNum).size();
+		const uint64_t namesUs (AJATime::GetSystemMicroseconds() - startUs);
+		startUs = AJATime::GetSystemMicroseconds();
+		for (uint32_t pass(0);  pass < kPasses;  pass++)
+			for (uint32_t regNum(0);  regNum < kRegNumRegisters;  regNum++)
+				inClass += CNTV2RegisterExpert::IsRegisterInClass(regNum, kRegClass_Audio) ? 1 : 0;
+		const uint64_t classUs (AJATime::GetSystemMicroseconds() - startUs);
+		startUs = AJATime::GetSystemMicroseconds();
+		const NTV2RegNumSet deviceRegs (CNTV2RegisterExpert::GetRegistersForDevice(DEVICE_ID_KONA5, kIncludeOtherRegs_VRegs | kIncludeOtherRegs_XptROM));
+		const uint64_t deviceUs (AJATime::GetSystemMicroseconds() - startUs);
+		CHECK(nameBytes > 0);
+		CHECK_EQ(inClass, kPasses * size_t(std::distance(audioRegs.begin(), audioRegs.lower_bound(kRegNumRegisters))));
+		CHECK(deviceRegs.find(kRegCh1Control) != deviceRegs.end());
+
+		const double numLookups (double(kPasses) * double(kRegNumRegisters));
+		//	Lookups don't lock, so they must survive the singleton being disposed & rebuilt under them...
+		uint32_t wrongNames[2] = {0, 0};
+		AJAThread lookupThreads[2];
+		for (size_t ndx(0);  ndx < 2;  ndx++)
+		{
+			CHECK_EQ(lookupThreads[ndx].Attach(NTV2RegisterExpertLookupThread, &wrongNames[ndx]), AJA_STATUS_SUCCESS);
+			CHECK_EQ(lookupThreads[ndx].Start(), AJA_STATUS_SUCCESS);
+		}
+		for (unsigned cycle(0);  cycle < 8;  cycle++)
+		{
+			CNTV2RegisterExpert::Deallocate();
+			CNTV2RegisterExpert::Allocate();
+		}
+		for (size_t ndx(0);  ndx < 2;  ndx++)
+		{
+			CHECK_EQ(lookupThreads[ndx].Stop(), AJA_STATUS_SUCCESS);
+			CHECK_EQ(wrongNames[ndx], 0);
+		}
+		CHECK(CNTV2RegisterExpert::IsAllocated());
+
+		if (gVerboseOutput)
+			MESSAGE("NTV2RegisterExpert: cold start " << coldUs << "us, GetDisplayName "
+					<< uint64_t(namesUs ? numLookups * 1e6 / double(namesUs) : 0.0) << "/s, IsRegisterInClass "
+					<< uint64_t(classUs ? numLookups * 1e6 / double(classUs) : 0.0) << "/s, GetRegistersForDevice "
+					<< deviceUs << "us");
+	}
 
 	TEST_CASE("NTV2FormatDescriptorBFT")
 	{
@@ -2642,6 +2896,64 @@ TEST_SUITE("bft" * doctest::description("ajantv2 basic functionality tests")) {
 		}
 	}
 
+	TEST_CASE("NTV2SignalRouter Routes")
+	{
+		CHECK(CNTV2SignalRouter::Initialize());
+		CHECK_EQ(CNTV2SignalRouter::NTV2InputCrosspointIDToString(NTV2_XptCSC1VidInput), "CSC1");
+		CHECK_EQ(CNTV2SignalRouter::StringToNTV2InputCrosspointID(" NTV2_XptCSC1VidInput "), NTV2_XptCSC1VidInput);
+		CHECK_EQ(CNTV2SignalRouter::StringToNTV2OutputCrosspointID("csc1keyyuv"), NTV2_XptCSC1KeyYUV);
+		CHECK_EQ(CNTV2SignalRouter::StringToNTV2InputCrosspointID("NoSuchXpt"), NTV2_INPUT_CROSSPOINT_INVALID);
+		CHECK(CNTV2SignalRouter::IsRGBOnlyInputXpt(NTV2_XptLUT1Input));
+		CHECK_FALSE(CNTV2SignalRouter::IsRGBOnlyInputXpt(NTV2_INPUT_CROSSPOINT_INVALID));
+		CHECK_EQ(CNTV2SignalRouter::WidgetIDToType(NTV2_WgtCSC3), NTV2WidgetType_CSC);
+		CHECK_EQ(CNTV2SignalRouter::WidgetIDToChannel(NTV2_WgtCSC3), NTV2_CHANNEL3);
+		CHECK_EQ(CNTV2SignalRouter::WidgetIDFromTypeAndChannel(NTV2WidgetType_CSC, NTV2_CHANNEL3), NTV2_WgtCSC3);
+		CHECK_EQ(CNTV2SignalRouter::WidgetIDFromTypeAndChannel(NTV2WidgetType_Invalid, NTV2_CHANNEL3), NTV2_WIDGET_INVALID);
+		NTV2WidgetIDSet widgets;
+		CHECK(CNTV2SignalRouter::GetWidgetsForOutput(NTV2_XptSDIIn1, widgets));
+		CHECK(widgets.find(NTV2_Wgt12GSDIIn1) != widgets.end());
+
+		//	Direct connection
+		NTV2XptConnections conns;
+		CHECK(CNTV2SignalRouter::FindRoute(DEVICE_ID_KONA5, NTV2_XptSDIIn1, NTV2_XptFrameBuffer1Input, conns));
+		CHECK_EQ(conns.size(), 1);
+		CHECK_EQ(conns[NTV2_XptFrameBuffer1Input], NTV2_XptSDIIn1);
+
+		//	YUV into RGB-only LUT inputs for four UHD quadrants: each goes through its own channel's CSC
+		NTV2XptConnections quads;
+		quads[NTV2_XptLUT1Input] = NTV2_XptSDIIn1;		quads[NTV2_XptLUT2Input] = NTV2_XptSDIIn2;
+		quads[NTV2_XptLUT3Input] = NTV2_XptSDIIn3;		quads[NTV2_XptLUT4Input] = NTV2_XptSDIIn4;
+		uint64_t startUs (AJATime::GetSystemMicroseconds());
+		CHECK(CNTV2SignalRouter::FindRoutes(DEVICE_ID_KONA5, quads, conns));
+		const uint64_t solveUs (AJATime::GetSystemMicroseconds() - startUs);
+		CHECK_EQ(conns.size(), 8);
+		CHECK_EQ(conns[NTV2_XptCSC3VidInput], NTV2_XptSDIIn3);
+		CHECK_EQ(conns[NTV2_XptLUT3Input], NTV2_XptCSC3VidRGB);
+		CHECK_EQ(conns[NTV2_XptLUT4Input], NTV2_XptCSC4VidRGB);
+
+		//	No widget is shared between paths
+		NTV2XptConnections sameChannel;
+		sameChannel[NTV2_XptLUT1Input] = NTV2_XptSDIIn1;		sameChannel[NTV2_XptLUT2Input] = NTV2_XptSDIIn1;
+		CHECK(CNTV2SignalRouter::FindRoutes(DEVICE_ID_KONA5, sameChannel, conns));
+		CHECK_EQ(conns.size(), 4);
+
+		//	Unsolvable requests
+		CHECK_FALSE(CNTV2SignalRouter::FindRoute(DEVICE_ID_CORVID1, NTV2_XptSDIIn1, NTV2_XptSDIOut4Input, conns));	//	No SDIOut4
+		CHECK(conns.empty());
+		CHECK_FALSE(CNTV2SignalRouter::FindRoute(DEVICE_ID_KONA5, NTV2_XptSDIIn1, NTV2_INPUT_CROSSPOINT_INVALID, conns));
+
+		//	Cached...
+		static const uint32_t kPasses (1000);
+		startUs = AJATime::GetSystemMicroseconds();
+		for (uint32_t pass(0);  pass < kPasses;  pass++)
+			CNTV2SignalRouter::FindRoutes(DEVICE_ID_KONA5, quads, conns);
+		const uint64_t cachedUs (AJATime::GetSystemMicroseconds() - startUs);
+		CHECK_EQ(conns.size(), 8);
+		if (gVerboseOutput)
+			MESSAGE("NTV2SignalRouter: 4 quadrant routes solved in " << solveUs << "us, cached "
+					<< double(cachedUs) / double(kPasses) << "us");
+	}
+
 	TEST_CASE("NTV2WidgetCount")
 	{
 		//	This test exposes contradictions between NTV2DeviceGetNumXXXXX and NTV2DeviceCanDoWidget...
@@ -2688,6 +3000,27 @@ TEST_SUITE("bft" * doctest::description("ajantv2 basic functionality tests")) {
 		}	//	for each supported device
 	}
 
+	TEST_CASE("NTV2DeviceFeatures")
+	{
+		//	Every supported device must answer exactly as the checked-in table in ut_devicefeatures.h says...
+		const size_t			numExpected	(sizeof(sExpectedDeviceFeatures) / sizeof(UTDeviceFeatures));
+		const NTV2DeviceIDSet	devices		(::NTV2GetSupportedDevices());
+		CHECK_EQ(devices.size(), numExpected);
+		for (size_t ndx(0);  ndx < numExpected;  ndx++)
+		{
+			const UTDeviceFeatures &	expected	(sExpectedDeviceFeatures[ndx]);
+			const NTV2DeviceID			deviceID	(NTV2DeviceID(expected.deviceID));
+			INFO(::NTV2DeviceIDToString(deviceID) << " (" << xHEX0N(expected.deviceID,8) << ")");
+			CHECK(devices.find(deviceID) != devices.end());
+			string bools, nums, items, canDo;
+			NTV2DeviceFeaturesDigest(deviceID, bools, nums, items, canDo);
+			CHECK_EQ(bools, string(expected.bools));
+			CHECK_EQ(nums, string(expected.nums));
+			CHECK_EQ(items, string(expected.items));
+			CHECK_EQ(canDo, string(expected.canDo));
+		}	//	for each expected device
+	}	//	TEST_CASE("NTV2DeviceFeatures")
+
 	TEST_CASE("NTV2Transcode")
 	{
 		//	Make a '2vuy' line to test with...
@@ -2713,6 +3046,234 @@ TEST_SUITE("bft" * doctest::description("ajantv2 basic functionality tests")) {
 		CHECK_EQ(::memcmp(buffer2VUY.GetHostPointer(), &compLine2VUY[0], compLine2VUY.size()), 0);
 	}
 
+	TEST_CASE("NTV2FrameConverter")
+	{
+		CHECK(NTV2FrameConverter::CanConvert(NTV2_FBF_10BIT_YCBCR, NTV2_FBF_8BIT_YCBCR));
+		CHECK(NTV2FrameConverter::CanConvert(NTV2_FBF_ABGR, NTV2_FBF_10BIT_DPX));
+		CHECK(NTV2FrameConverter::CanConvert(NTV2_FBF_10BIT_YCBCR, NTV2_FBF_10BIT_YCBCR));
+		CHECK_FALSE(NTV2FrameConverter::CanConvert(NTV2_FBF_8BIT_YCBCR_420PL3, NTV2_FBF_8BIT_YCBCR_420PL3));
+		CHECK_FALSE(NTV2FrameConverter::CanConvert(NTV2_FBF_10BIT_DPX, NTV2_FBF_ABGR));
+
+		const NTV2FormatDesc fdV210 (NTV2_FORMAT_4x1920x1080p_5994, NTV2_FBF_10BIT_YCBCR);
+		const NTV2FormatDesc fd2VUY (NTV2_FORMAT_4x1920x1080p_5994, NTV2_FBF_8BIT_YCBCR);
+		const NTV2FormatDesc fd2VUYVanc (NTV2_FORMAT_1080p_5994_A, NTV2_FBF_8BIT_YCBCR, NTV2_VANCMODE_TALL);
+		NTV2Buffer srcV210 (fdV210.GetTotalRasterBytes()), dst2VUY (fd2VUY.GetTotalRasterBytes());
+		ULWord * pWords (reinterpret_cast<ULWord*>(srcV210.GetHostPointer()));
+		for (ULWord ndx(0);  ndx < srcV210.GetByteCount() / 4;  ndx++)
+			pWords[ndx] = ndx * 2654435761UL;
+
+		//	Frame conversion must exactly match line-by-line conversion, for any number of threads...
+		NTV2Buffer ref2VUY (fd2VUY.GetTotalRasterBytes());
+		for (ULWord line(0);  line < fdV210.GetFullRasterHeight();  line++)
+			CHECK(::ConvertLine_v210_to_2vuy(reinterpret_cast<const ULWord*>(fdV210.GetRowAddress(srcV210.GetHostPointer(), line)),
+											reinterpret_cast<UByte*>(fd2VUY.GetWriteableRowAddress(ref2VUY.GetHostPointer(), line)), fdV210.GetRasterWidth()));
+		static const ULWord threadCounts[] = {1, 2, 3, 7, 16};
+		for (size_t ndx(0);  ndx < sizeof(threadCounts)/sizeof(ULWord);  ndx++)
+		{
+			NTV2FrameConverter converter(threadCounts[ndx]);
+			CHECK_EQ(converter.GetNumThreads(), threadCounts[ndx]);
+			dst2VUY.Fill(UByte(0xA5));
+			CHECK(converter.Convert(srcV210, fdV210, dst2VUY, fd2VUY));
+			CHECK(dst2VUY.IsContentEqual(ref2VUY));
+			dst2VUY.Fill(UByte(0xA5));
+			CHECK(converter.Convert(srcV210, fdV210, dst2VUY, fd2VUY));	//	Reuse the same workers
+			CHECK(dst2VUY.IsContentEqual(ref2VUY));
+		}
+		NTV2FrameConverter & shared (NTV2FrameConverter::GetShared());
+		CHECK(shared.GetNumThreads() >= 1);
+		CHECK(shared.Convert(srcV210, fdV210, dst2VUY, fd2VUY));
+
+		//	Mismatched rasters, unsupported conversions, short buffers...
+		NTV2Buffer dst2VUYVanc (fd2VUYVanc.GetTotalRasterBytes());
+		CHECK_FALSE(shared.Convert(srcV210, fdV210, dst2VUYVanc, fd2VUYVanc));
+		CHECK_FALSE(shared.Convert(dst2VUY, fd2VUY, srcV210, NTV2FormatDesc(NTV2_FORMAT_4x1920x1080p_5994, NTV2_FBF_10BIT_DPX)));
+		NTV2Buffer shortBuffer (fd2VUY.GetTotalRasterBytes() / 2);
+		CHECK_FALSE(shared.Convert(srcV210, fdV210, shortBuffer, fd2VUY));
+
+		//	Same-format copy, from a VANC raster into a non-VANC raster, copies the visible lines only...
+		const NTV2FormatDesc fd2VUYHD (NTV2_FORMAT_1080p_5994_A, NTV2_FBF_8BIT_YCBCR);
+		NTV2Buffer dst2VUYHD (fd2VUYHD.GetTotalRasterBytes());
+		dst2VUYVanc.Fill(UByte(0x10));
+		UByte * pTopVisible (fd2VUYVanc.GetTopVisibleRowAddress(reinterpret_cast<UByte*>(dst2VUYVanc.GetHostPointer())));
+		::memset(pTopVisible, 0x80, fd2VUYVanc.GetVisibleRasterBytes());
+		CHECK(shared.Convert(dst2VUYVanc, fd2VUYVanc, dst2VUYHD, fd2VUYHD));
+		CHECK(dst2VUYHD.IsContentEqual(NTV2Buffer(pTopVisible, fd2VUYHD.GetTotalRasterBytes())));
+
+		//	RunBands visits every line exactly once...
+		struct LineCounter
+		{
+			static bool CountBand (void * pContext, const ULWord inFirstLine, const ULWord inNumLines)
+			{
+				vector<ULWord> & counts (*reinterpret_cast<vector<ULWord>*>(pContext));
+				for (ULWord line(inFirstLine);  line < inFirstLine + inNumLines;  line++)
+					counts.at(line)++;
+				return true;
+			}
+			static bool FailBand (void * pContext, const ULWord inFirstLine, const ULWord inNumLines)
+			{	(void) pContext;  (void) inNumLines;
+				return inFirstLine == 0;
+			}
+		};
+		for (size_t ndx(0);  ndx < sizeof(threadCounts)/sizeof(ULWord);  ndx++)
+		{
+			NTV2FrameConverter converter(threadCounts[ndx]);
+			vector<ULWord> counts(2161, 0);
+			CHECK(converter.RunBands(ULWord(counts.size()), LineCounter::CountBand, &counts));
+			CHECK_EQ(ULWord(std::count(counts.begin(), counts.end(), 1)), ULWord(counts.size()));
+			CHECK(converter.RunBands(0, LineCounter::CountBand, &counts));
+			CHECK_FALSE(converter.RunBands(ULWord(counts.size()), AJA_NULL, &counts));
+			if (converter.GetNumThreads() > 1)
+				CHECK_FALSE(converter.RunBands(ULWord(counts.size()), LineCounter::FailBand, AJA_NULL));
+		}
+	}	//	TEST_CASE("NTV2FrameConverter")
+
+	TEST_CASE("NTV2BufferPool")
+	{
+		NTV2BufferPool pool;
+		NTV2Buffer buffer;
+		CHECK_FALSE(pool.Acquire(buffer));						//	No buffers yet
+		CHECK_FALSE(pool.Allocate(0, 4096));					//	Zero buffers
+		CHECK_FALSE(pool.Allocate(4, 0));						//	Zero size
+		CHECK_FALSE(pool.Allocate(4, 4096, NTV2_POOLPAGES_INVALID));
+
+		//	More than 64 buffers, so the free list spans words; no hugetlbfs pages, so it runs on any host
+		const ULWord numBuffers(70), byteCount(5000);
+		REQUIRE(pool.Allocate(numBuffers, byteCount, NTV2_POOLPAGES_TRANSPARENT));
+		CHECK(NTV2_IS_VALID_POOLPAGES(pool.GetPageKind()));
+		CHECK_EQ(pool.GetNumBuffers(), numBuffers);
+		CHECK_EQ(pool.GetBufferByteCount(), byteCount);
+		CHECK_EQ(pool.GetNumAvailable(), numBuffers);
+		CHECK_FALSE(pool.IsLocked());
+
+		std::vector<NTV2Buffer *> held;
+		std::set<const void *> addresses;
+		for (ULWord ndx(0);  ndx < numBuffers;  ndx++)
+		{
+			held.push_back(new NTV2Buffer);
+			REQUIRE(pool.Acquire(*held.back()));
+			CHECK_EQ(held.back()->GetByteCount(), byteCount);
+			CHECK_FALSE(held.back()->IsAllocatedBySDK());		//	Pool owns the memory
+			CHECK_EQ(ULWord64(held.back()->GetHostPointer()) % NTV2Buffer::DefaultPageSize(), 0);
+			addresses.insert(held.back()->GetHostPointer());
+		}
+		CHECK_EQ(addresses.size(), size_t(numBuffers));		//	All distinct
+		CHECK_FALSE(pool.Acquire(buffer));						//	Exhausted
+		CHECK_EQ(pool.GetNumAvailable(), 0);
+
+		CHECK(pool.Release(*held[66]));
+		CHECK_FALSE(pool.Release(*held[66]));					//	Already free
+		UByte notMine[64];
+		CHECK_FALSE(pool.Release(NTV2Buffer(notMine, sizeof(notMine))));
+		CHECK(pool.Acquire(buffer));
+		CHECK_EQ(buffer.GetHostPointer(), held[66]->GetHostPointer());	//	The only free one
+		CHECK(pool.Release(buffer));
+		for (ULWord ndx(0);  ndx < numBuffers;  ndx++)
+		{
+			if (ndx != 66)
+				CHECK(pool.Release(*held[ndx]));
+			delete held[ndx];
+		}
+		CHECK_EQ(pool.GetNumAvailable(), numBuffers);
+		CHECK(pool.GetBuffer(numBuffers - 1, buffer));
+		CHECK_FALSE(pool.GetBuffer(numBuffers, buffer));
+
+		pool.Deallocate();
+		CHECK_FALSE(pool.IsAllocated());
+		CHECK_EQ(pool.GetNumAvailable(), 0);
+	}	//	TEST_CASE("NTV2BufferPool")
+
+	TEST_CASE("NTV2RegisterCache")
+	{
+		CHECK(CNTV2DriverInterface::GetDefaultCacheableRegisters().count(kRegCh1Control));
+		CHECK(CNTV2DriverInterface::GetDefaultCacheableRegisters().count(kRegXptSelectGroup37));
+		CHECK_FALSE(CNTV2DriverInterface::GetDefaultCacheableRegisters().count(kRegStatus));
+		CHECK_FALSE(CNTV2DriverInterface::GetDefaultCacheableRegisters().count(kRegCh1OutputFrame));
+
+		FakeRegistersCard card;
+		CNTV2DriverInterface & dev (card);
+		ULWord value(0);  ULWord64 hits(0), misses(0);
+		CHECK(card.IsRegisterCacheable(kRegGlobalControl));
+		CHECK_FALSE(card.IsRegisterCacheEnabled());
+		card.mRegs[kRegCh1Control] = 0x12345678;
+		CHECK(dev.ReadRegister(kRegCh1Control, value));
+		CHECK(dev.ReadRegister(kRegCh1Control, value));
+		CHECK_EQ(card.mNumHWReads, 2);	//	Cache disabled -- every read goes to hardware
+
+		//	Cacheable registers are read from hardware once...
+		CHECK(card.EnableRegisterCache());
+		card.mNumHWReads = 0;
+		for (unsigned num(0);  num < 10;  num++)
+		{
+			CHECK(dev.ReadRegister(kRegCh1Control, value));
+			CHECK_EQ(value, 0x12345678);
+			CHECK(dev.ReadRegister(kRegCh1Control, value, 0x0000FF00, 8));
+			CHECK_EQ(value, 0x56);
+		}
+		CHECK_EQ(card.mNumHWReads, 1);
+		card.GetRegisterCacheStats(hits, misses, true);
+		CHECK_EQ(hits, 19);
+		CHECK_EQ(misses, 1);
+
+		//	A masked read of an uncached register reads & caches the whole register...
+		card.mRegs[kRegGlobalControl] = 0xABCD0000;
+		CHECK(dev.ReadRegister(kRegGlobalControl, value, 0xFFFF0000, 16));
+		CHECK_EQ(value, 0xABCD);
+		CHECK(dev.ReadRegister(kRegGlobalControl, value));
+		CHECK_EQ(value, 0xABCD0000);
+		CHECK_EQ(card.mNumHWReads, 2);
+
+		//	Writes keep the cache current...
+		CHECK(dev.WriteRegister(kRegCh1Control, 0x9, 0x000000F0, 4));
+		CHECK(dev.ReadRegister(kRegCh1Control, value));
+		CHECK_EQ(value, 0x12345698);
+		CHECK_EQ(value, card.mRegs[kRegCh1Control]);
+		CHECK(dev.WriteRegister(kRegXptSelectGroup1, 0x01020304));
+		CHECK(dev.ReadRegister(kRegXptSelectGroup1, value));
+		CHECK_EQ(value, 0x01020304);
+		CHECK_EQ(card.mNumHWReads, 2);
+
+		//	A write that lands between a miss's hardware read and its cache store wins...
+		card.InvalidateRegisterCache();
+		card.mRegs[kRegCh2Control] = 0x11111111;
+		const NTV2RegInfo racingWrite (kRegCh2Control, 0x22222222);
+		card.mpWriteDuringRead = &racingWrite;
+		CHECK(dev.ReadRegister(kRegCh2Control, value));
+		CHECK_EQ(value, 0x11111111);			//	The read itself returns what the hardware had
+		CHECK(dev.ReadRegister(kRegCh2Control, value));
+		CHECK_EQ(value, 0x22222222);			//	...but the stale value isn't left in the cache
+		CHECK(dev.ReadRegister(kRegCh1Control, value));
+		CHECK(dev.ReadRegister(kRegXptSelectGroup1, value));
+		CHECK_EQ(card.mNumHWReads, 5);			//	Ch2Control was cached by the write;  Ch1Control & XptSelectGroup1 were re-read
+
+		//	Volatile registers always go to hardware...
+		for (unsigned num(0);  num < 3;  num++)
+		{
+			card.mRegs[kRegStatus] = num;
+			CHECK(dev.ReadRegister(kRegStatus, value));
+			CHECK_EQ(value, num);
+		}
+		CHECK_EQ(card.mNumHWReads, 8);
+
+		//	Reclassify...
+		CHECK(card.SetRegisterCacheable(kRegStatus, true));
+		CHECK(dev.ReadRegister(kRegStatus, value));
+		CHECK(dev.ReadRegister(kRegStatus, value));
+		CHECK_EQ(card.mNumHWReads, 9);
+		CHECK(card.SetRegisterCacheable(kRegCh1Control, false));
+		CHECK(dev.ReadRegister(kRegCh1Control, value));
+		CHECK_EQ(card.mNumHWReads, 10);
+		CHECK_FALSE(card.SetRegisterCacheable(kRegNumRegisters, true));
+
+		//	Invalidate & disable...
+		card.InvalidateRegisterCache();
+		CHECK(dev.ReadRegister(kRegGlobalControl, value));
+		CHECK_EQ(card.mNumHWReads, 11);
+		CHECK(card.EnableRegisterCache(false));
+		CHECK(dev.ReadRegister(kRegGlobalControl, value));
+		CHECK(dev.ReadRegister(kRegGlobalControl, value));
+		CHECK_EQ(card.mNumHWReads, 13);
+	}	//	TEST_CASE("NTV2RegisterCache")
+
 	TEST_CASE("NTV2Bitfile")
 	{
 		static unsigned char sTTapPro[] = { //	.............a.Et_tap_pro;COMPRESS=TRUE;UserID=0XFFFFFFFF;TANDEM=TRUE;Version=2019.1.b..xcku035-fbva676-1LV-i.c..2020/11/04.d..14:58:54.e..'......................................................................".D..........Uf ... ...0. .....0.......0......
@@ -3174,6 +3735,95 @@ TEST_SUITE("TestPatternGen" * doctest::description("NTV2TestPatternGen tests"))
 			}	//	for each pixel format
 		}	//	for each video standard
 	}	//	TEST_CASE("Permutations")
+
+	TEST_CASE("Cache")
+	{
+		struct SubclassGen : public NTV2TestPatternGen	{};
+		const ULWord64 origBudget (NTV2TestPatternGen::getCacheBudget());
+		ULWord64 hits(0), misses(0), bytes(0);
+		NTV2TestPatternGen::flushCache();
+		NTV2TestPatternGen::getCacheStats(hits, misses, bytes, true);
+		CHECK_EQ(bytes, 0);
+
+		const NTV2FormatDesc fd (NTV2_FORMAT_1080p_5994_A, NTV2_FBF_10BIT_YCBCR);
+		const NTV2FormatDesc fdVanc (NTV2_FORMAT_1080p_5994_A, NTV2_FBF_10BIT_YCBCR, NTV2_VANCMODE_TALL);
+		const NTV2FormatDesc fdRGB (NTV2_FORMAT_4x1920x1080p_2398, NTV2_FBF_48BIT_RGB);
+		static const NTV2TestPatternSelect patterns[] = {NTV2_TestPatt_ZonePlate, NTV2_TestPatt_SlantRamp, NTV2_TestPatt_MultiBurst};
+		for (size_t ndx(0);  ndx < sizeof(patterns)/sizeof(NTV2TestPatternSelect);  ndx++)
+		{
+			//	A cached pattern must match one drawn from scratch...
+			NTV2Buffer ref(fd.GetTotalBytes()), cached(fd.GetTotalBytes());
+			NTV2TestPatternGen uncachedGen, gen;
+			uncachedGen.setUseCache(false);
+			CHECK(uncachedGen.DrawTestPattern(patterns[ndx], fd, ref));
+			CHECK(gen.DrawTestPattern(patterns[ndx], fd, cached));		//	Miss
+			CHECK(cached.IsContentEqual(ref));
+			cached.Fill(UByte(0xA5));
+			CHECK(gen.DrawTestPattern(patterns[ndx], fd, cached));		//	Hit
+			CHECK(cached.IsContentEqual(ref));
+			CHECK_EQ(gen.getSignalMask(), uncachedGen.getSignalMask());
+
+			//	...and is shared by other generators, and other VANC geometries...
+			NTV2Buffer vanc(fdVanc.GetTotalBytes());
+			NTV2TestPatternGen vancGen;
+			vancGen.setVANCToLegalBlack(true);
+			CHECK(vancGen.DrawTestPattern(patterns[ndx], fdVanc, vanc));	//	Hit
+			CHECK(NTV2Buffer(fdVanc.GetTopVisibleRowAddress(reinterpret_cast<UByte*>(vanc.GetHostPointer())), fd.GetTotalBytes()).IsContentEqual(ref));
+		}
+		NTV2TestPatternGen::getCacheStats(hits, misses, bytes);
+		CHECK_EQ(hits, 6);
+		CHECK_EQ(misses, 3);
+		CHECK_EQ(bytes, 3 * fd.GetVisibleRasterBytes());
+
+		//	Different options are different patterns...
+		NTV2Buffer buffer(fd.GetTotalBytes());
+		NTV2TestPatternGen gen;
+		CHECK(gen.setSliderValue(0.5).DrawTestPattern(NTV2_TestPatt_ZonePlate, fd, buffer));
+		CHECK(gen.DrawTestPattern(NTV2_TestPatt_SlantRamp, fd, buffer));	//	Slider doesn't affect the slant ramp
+		SubclassGen subGen;		//	Subclasses bypass the cache
+		CHECK(subGen.DrawTestPattern(NTV2_TestPatt_ZonePlate, fd, buffer));
+		NTV2TestPatternGen::getCacheStats(hits, misses, bytes, true);
+		CHECK_EQ(hits, 7);
+		CHECK_EQ(misses, 4);
+
+		//	12-bit RGB...
+		NTV2Buffer refRGB(fdRGB.GetTotalBytes()), cachedRGB(fdRGB.GetTotalBytes());
+		NTV2TestPatternGen uncachedGen;
+		uncachedGen.setUseCache(false);
+		CHECK(uncachedGen.DrawTestPattern(NTV2_TestPatt_ZonePlate_12b_RGB, fdRGB, refRGB));
+		CHECK(gen.DrawTestPattern(NTV2_TestPatt_ZonePlate_12b_RGB, fdRGB, cachedRGB));
+		CHECK(cachedRGB.IsContentEqual(refRGB));
+		CHECK(gen.DrawTestPattern(NTV2_TestPatt_ZonePlate_12b_RGB, fdRGB, cachedRGB));
+		CHECK(cachedRGB.IsContentEqual(refRGB));
+		const UWord * pRGB (reinterpret_cast<const UWord*>(refRGB.GetHostPointer()));
+		CHECK_EQ(pRGB[3], pRGB[3 * 3839]);	//	Symmetric about the center
+		CHECK_EQ(pRGB[0] & 0xF, 0);			//	12-bit values in the top of each 16-bit component
+
+		//	The budget is enforced, least recently used first...
+		NTV2TestPatternGen::setCacheBudget(2 * fd.GetVisibleRasterBytes());
+		NTV2TestPatternGen::getCacheStats(hits, misses, bytes, true);
+		CHECK(bytes <= 2 * fd.GetVisibleRasterBytes());
+		CHECK(gen.setSliderValue(1.0).DrawTestPattern(NTV2_TestPatt_ColorBars100, fd, buffer));
+		CHECK(gen.DrawTestPattern(NTV2_TestPatt_ColorBars75, fd, buffer));
+		CHECK(gen.DrawTestPattern(NTV2_TestPatt_ColorBars100, fd, buffer));	//	Hit -- now most recently used
+		CHECK(gen.DrawTestPattern(NTV2_TestPatt_Ramp, fd, buffer));			//	Evicts ColorBars75
+		CHECK(gen.DrawTestPattern(NTV2_TestPatt_ColorBars100, fd, buffer));	//	Hit
+		CHECK(gen.DrawTestPattern(NTV2_TestPatt_ColorBars75, fd, buffer));	//	Miss
+		NTV2TestPatternGen::getCacheStats(hits, misses, bytes, true);
+		CHECK_EQ(hits, 2);
+		CHECK_EQ(misses, 4);
+		CHECK_EQ(bytes, 2 * fd.GetVisibleRasterBytes());
+
+		NTV2TestPatternGen::setCacheBudget(0);	//	Disables the cache
+		NTV2TestPatternGen::getCacheStats(hits, misses, bytes);
+		CHECK_EQ(bytes, 0);
+		CHECK(gen.DrawTestPattern(NTV2_TestPatt_ColorBars100, fd, buffer));
+		NTV2TestPatternGen::getCacheStats(hits, misses, bytes, true);
+		CHECK_EQ(hits, 0);
+		CHECK_EQ(bytes, 0);
+		NTV2TestPatternGen::setCacheBudget(origBudget);
+		CHECK_EQ(NTV2TestPatternGen::getCacheBudget(), origBudget);
+	}	//	TEST_CASE("Cache")
 }	//	TEST_SUITE("TestPatternGen")
 
 
@@ -3276,4 +3926,106 @@ TEST_SUITE("AutoCirculate" * doctest::description("AutoCirculate tests"))
 		cerr << fRange.setFromString("36-1") << endl;
 		CHECK_FALSE(fRange.valid());
 	}	//	TEST_CASE("NTV2ACFrameRange")
+
+	TEST_CASE("NTV2ACLatencyStats")
+	{
+		CNTV2Card card;	//	Not open -- exercises the bookkeeping only
+		AJALatencyHistogram histo;
+		CHECK_FALSE(card.AutoCirculateIsLatencyStatsEnabled());
+		CHECK_FALSE(card.AutoCirculateRecordLatency(NTV2_CHANNEL1, NTV2_AC_LATENCY_DMA, 100));
+		CHECK_FALSE(card.AutoCirculateGetLatencyStats(NTV2_CHANNEL1, NTV2_AC_LATENCY_DMA, histo));
+		CHECK(card.AutoCirculateSetLatencyStatsEnabled(false));
+
+		CHECK(card.AutoCirculateSetLatencyStatsEnabled(true));
+		CHECK(card.AutoCirculateIsLatencyStatsEnabled());
+		CHECK_FALSE(card.AutoCirculateRecordLatency(NTV2_CHANNEL_INVALID, NTV2_AC_LATENCY_DMA, 100));
+		CHECK_FALSE(card.AutoCirculateRecordLatency(NTV2_CHANNEL1, NTV2_AC_LATENCY_INVALID, 100));
+		for (ULWord n(0);  n < 1000;  n++)
+			CHECK(card.AutoCirculateRecordLatency(NTV2_CHANNEL2, NTV2_AC_LATENCY_DMA, n < 990 ? 2000 : 16000));
+		CHECK(card.AutoCirculateGetLatencyStats(NTV2_CHANNEL2, NTV2_AC_LATENCY_DMA, histo));
+		CHECK_EQ(histo.Entries(), 1000);
+		CHECK(histo.Percentile(50.0) >= 1940);
+		CHECK(histo.Percentile(50.0) <= 2060);
+		CHECK(histo.Percentile(99.9) >= 15500);
+		CHECK(card.AutoCirculateGetLatencyStats(NTV2_CHANNEL1, NTV2_AC_LATENCY_DMA, histo));
+		CHECK_EQ(histo.Entries(), 0);	//	Channels are independent
+		CHECK(card.AutoCirculateGetLatencyStats(NTV2_CHANNEL2, NTV2_AC_LATENCY_HOST, histo));
+		CHECK_EQ(histo.Entries(), 0);	//	...and so are stages
+
+		CHECK(card.AutoCirculateResetLatencyStats(NTV2_CHANNEL2));
+		CHECK(card.AutoCirculateGetLatencyStats(NTV2_CHANNEL2, NTV2_AC_LATENCY_DMA, histo));
+		CHECK_EQ(histo.Entries(), 0);
+
+		CHECK_EQ(::NTV2ACLatencyStageToString(NTV2_AC_LATENCY_FRAME_AGE), "Frame Age");
+		CHECK_EQ(::NTV2ACLatencyStageToString(NTV2_AC_LATENCY_DMA, true), "DMA");
+		CHECK_EQ(::NTV2ACLatencyStageToString(NTV2_AC_LATENCY_INVALID), "<invalid>");
+
+		CHECK(card.AutoCirculateSetLatencyStatsEnabled(false));
+		CHECK_FALSE(card.AutoCirculateIsLatencyStatsEnabled());
+		CHECK_FALSE(card.AutoCirculateGetLatencyStats(NTV2_CHANNEL2, NTV2_AC_LATENCY_DMA, histo));
+	}	//	TEST_CASE("NTV2ACLatencyStats")
+
+	TEST_CASE("NTV2ACPrepareTransfer")
+	{
+		CNTV2Card card;	//	Not open -- exercises the bookkeeping only
+		AUTOCIRCULATE_TRANSFER xfer;
+		NTV2Buffer video(8192);
+		CHECK(xfer.SetVideoBuffer(reinterpret_cast<ULWord*>(video.GetHostPointer()), video.GetByteCount()));
+		CHECK_FALSE(card.AutoCirculateIsTransferPrepared(NTV2_CHANNEL1));
+		CHECK_FALSE(card.AutoCirculatePrepareTransfer(NTV2_CHANNEL1, xfer));
+		CHECK_FALSE(card.AutoCirculatePrepareTransfer(NTV2_CHANNEL_INVALID, xfer));
+		CHECK_FALSE(card.AutoCirculateIsTransferPrepared(NTV2_CHANNEL1));
+		CHECK_FALSE(card.AutoCirculateIsTransferPrepared(NTV2_CHANNEL_INVALID));
+		CHECK(card.AutoCirculateUnprepareTransfer(NTV2_CHANNEL1));	//	Never prepared -- nothing to do
+		CHECK(card.AutoCirculateUnprepareTransfer());
+		CHECK_FALSE(card.AutoCirculateTransfer(NTV2_CHANNEL1, xfer));
+	}	//	TEST_CASE("NTV2ACPrepareTransfer")
+
+	TEST_CASE("NTV2ACPreparedTransferSWDevice")
+	{
+		CNTV2Card card;
+		if (!card.Open("ntv2swdevice://localhost/?nosharedmemory"))
+		{
+			MESSAGE("NTV2ACPreparedTransferSWDevice: skipped, software device plug-in not installed");
+			return;
+		}
+		CHECK(card.SetVideoFormat(NTV2_FORMAT_1080p_3000, false, false, NTV2_CHANNEL1));
+		CHECK(card.SetFrameBufferFormat(NTV2_CHANNEL1, NTV2_FBF_8BIT_YCBCR));
+		card.AutoCirculateStop(NTV2_CHANNEL1, true);
+		REQUIRE(card.AutoCirculateInitForOutput(NTV2_CHANNEL1, 8));
+		REQUIRE(card.AutoCirculateStart(NTV2_CHANNEL1));
+
+		const NTV2FormatDescriptor fd (NTV2_FORMAT_1080p_3000, NTV2_FBF_8BIT_YCBCR);
+		NTV2Buffer video(fd.GetTotalBytes());
+		video.Fill(ULWord(0x10801080));
+		AUTOCIRCULATE_TRANSFER xfer;
+		CHECK(xfer.SetVideoBuffer(reinterpret_cast<ULWord*>(video.GetHostPointer()), video.GetByteCount()));
+		REQUIRE(card.AutoCirculatePrepareTransfer(NTV2_CHANNEL1, xfer));
+		CHECK(card.AutoCirculateIsTransferPrepared(NTV2_CHANNEL1));
+		CHECK_FALSE(card.AutoCirculateIsTransferPrepared(NTV2_CHANNEL2));
+
+		//	Transfers use the prepared state, and fill the ring...
+		CHECK(card.AutoCirculateTransfer(NTV2_CHANNEL1, xfer));
+		CHECK(card.AutoCirculateTransfer(NTV2_CHANNEL1, xfer));
+		AUTOCIRCULATE_STATUS acStatus;
+		CHECK(card.AutoCirculateGetStatus(NTV2_CHANNEL1, acStatus));
+		CHECK(acStatus.GetBufferLevel() >= 1);
+
+		//	The video format isn't cached, so changing it after preparing changes how the next transfer sets timecode...
+		const NTV2_RP188 *	pTimeCodes (reinterpret_cast<const NTV2_RP188*>(xfer.acOutputTimeCodes.GetHostPointer()));
+		REQUIRE(pTimeCodes);
+		xfer.acRP188 = NTV2_RP188(0, 0x01020304, 0x05060708);
+		CHECK(card.AutoCirculateTransfer(NTV2_CHANNEL1, xfer));
+		CHECK_FALSE(pTimeCodes[NTV2_TCINDEX_SDI1_2].IsValid());	//	Progressive:  no F2 timecode
+		CHECK(card.SetVideoFormat(NTV2_FORMAT_1080i_5994, false, false, NTV2_CHANNEL1));
+		CHECK(card.AutoCirculateIsTransferPrepared(NTV2_CHANNEL1));
+		CHECK(card.AutoCirculateTransfer(NTV2_CHANNEL1, xfer));
+		CHECK(pTimeCodes[NTV2_TCINDEX_SDI1_2].IsValid());		//	Interlaced:  F2 timecode too
+		xfer.acRP188 = NTV2_RP188();
+
+		CHECK(card.AutoCirculateUnprepareTransfer(NTV2_CHANNEL1));
+		CHECK_FALSE(card.AutoCirculateIsTransferPrepared(NTV2_CHANNEL1));
+		CHECK(card.AutoCirculateTransfer(NTV2_CHANNEL1, xfer));	//	Still works unprepared
+		CHECK(card.AutoCirculateStop(NTV2_CHANNEL1, true));
+	}	//	TEST_CASE("NTV2ACPreparedTransferSWDevice")
 }	//	TEST_SUITE("AutoCirculate")
@@ -0,0 +1,371 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		ut_devicefeatures.h
+	@brief		Expected device features for every supported device, checked by the "NTV2DeviceFeatures" test case.
+	@copyright	(C) 2023 AJA Video Systems, Inc. All rights reserved.
+**/
+//	Captured from the per-device switch bodies that preceded the bitset tables in ntv2devicefeatures.hpp.
+//	Each entry holds the digests made by NTV2DeviceFeaturesDigest in ut_ajantv2.cpp:
+//		- IsSupported for every NTV2BoolParamID, as hex digits, four params per digit, lowest param in the LS bit
+//		- GetNumSupported for every NTV2NumericParamID, comma-separated
+//		- GetSupportedItems for kNTV2EnumsID_Standard thru kNTV2EnumsID_DSKMode, as hex digits, semicolon-separated
+//		- NTV2DeviceCanDoConversionMode, DSKMode, FrameBufferFormat, InputSource, VideoFormat and Widget for every item
+//	Trailing zero digits are dropped. Regenerate this when a device's features change on purpose.
+
+#ifndef UT_DEVICEFEATURES_H
+#define UT_DEVICEFEATURES_H
+
+typedef struct UTDeviceFeatures
+{
+	ULWord			deviceID;
+	const char *	bools;
+	const char *	nums;
+	const char *	items;
+	const char *	canDo;
+} UTDeviceFeatures;
+
+static const UTDeviceFeatures	sExpectedDeviceFeatures[] =
+{
+	{0x10244800,	//	Corvid
+		"3007400A140C04048D",
+		"268435456,0,0,0,1,16,151,2097151,2,2,524288,0,0,0,0,0,0,0,0,1,0,0,0,16,16,2,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,0,1,0,0,0,1,1",
+		"F9;32;FF7E;EF1;;EFF930073;3;02;4;3;B;1;1;304010000004;;",
+		";;32;02;EFF930073;304010000004"},
+	{0x10266400,	//	KonaLHi
+		"30FFEA2F1C8C06258D",
+		"268435456,2,1,1,1,8,235,2097151,3,2,65536,1,0,2,2,2,2,1,1,1,1,2,1,8,8,2,0,8,8,1,1,1,2,1,1,1,1,1,1,1,0,0,1,1,0,0,1,1",
+		"FD;FFAB1;FF7E;EF1;;EFFFFFF7F;3;32;7;3;B3;3;D;3FF03008D504;FFFFFF7;",
+		"FFFFFF7;F3;FFAB1;32;EFFFFFF7F;3FF03008D504"},
+	{0x10266401,	//	KonaLHiDVI
+		"30FFEA2F1C8C06258D",
+		"268435456,2,1,1,1,8,235,2097151,3,2,65536,1,0,2,2,2,2,1,1,1,1,2,1,8,8,2,0,8,8,1,1,1,2,1,1,1,1,1,1,1,0,0,1,1,0,0,1,1",
+		"FD;FFAB1;FF7E;EF1;;EFFFFFF7F;3;32;7;3;B3;3;D;3FF03008D504;FFFFFF7;",
+		"FFFFFF7;F3;FFAB1;32;EFFFFFF7F;3FF03008D504"},
+	{0x10280300,	//	IoExpress
+		"30BF482B148C04058F0000088",
+		"268435456,2,0,1,1,8,235,2097151,2,1,65536,1,0,2,2,0,2,0,1,1,0,0,1,8,8,1,0,8,8,1,1,1,0,0,1,1,1,0,1,1,0,0,1,1,0,0,1,1",
+		"F1;32A;FD3C;EF1;;EFF120073;3;22;7;1;B2;3;9;10701000D904;F001;",
+		"F001;;32A;22;EFF120073;10701000D904"},
+	{0x10293000,	//	Corvid22
+		"3007402A0C0EC6248D",
+		"536870912,0,0,0,1,16,255,2097151,3,2,524288,0,0,0,0,0,0,0,0,2,0,2,0,16,16,2,0,0,0,0,0,0,0,2,0,1,2,0,2,2,0,0,2,2,0,0,2,2",
+		"FD;FF0B;FF7E;EF1;;EFFFFBF7F;3;06;C;3;F;1;1;3303030004041;;",
+		";F3;FF0B;06;EFFFFBF7F;3303030004041"},
+	{0x10294700,	//	Kona3G
+		"F0BFEEAF0C8EC6ED9D1",
+		"536870912,2,1,1,1,16,255,2097151,2,2,65536,1,0,16,16,0,0,0,1,2,1,2,1,16,16,2,0,0,8,0,1,1,2,2,1,1,2,1,2,2,0,0,2,2,0,0,2,2",
+		"FD;FFAB1;FF7E;EF1;;EFFFFFF7F300000000000000000C7;3;06;F;3;F;3;1;3F0303669D041;FFFFFFF3;",
+		"FFFFFFF3;F3;FFAB1;06;EFFFFFF7F300000000000000000C7;3F0303669D041"},
+	{0x10294900,	//	Corvid3G
+		"3007422A1C8E06248D",
+		"268435456,0,0,0,1,16,251,2097151,2,2,524288,0,0,0,0,0,0,0,0,1,0,2,0,16,16,2,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,0,1,0,0,0,1,1",
+		"FD;FF0B;FF7E;EF1;;EFFFFBF7F;3;02;4;3;B;1;1;330101000404;;",
+		";F3;FF0B;02;EFFFFBF7F;330101000404"},
+	{0x10322950,	//	Kona3GQuad
+		"B8BFEEAA0C8EE6FD9D",
+		"536870912,2,0,1,1,16,319,2097151,2,4,65536,0,0,16,16,0,0,0,1,4,0,4,0,16,16,4,0,0,8,0,1,0,4,2,0,1,2,0,4,4,0,0,2,2,0,0,4,4",
+		"FD3;FFAB1;FF7E3;EF1;;EFFFFBF7300000000000FFF330003;3;0E1;F3;F;FC;3;1;FF0F0F669C04DF3;;",
+		";F3;FFAB1;0E1;EFFFFBF7300000000000FFF330003;FF0F0F669C04DF3"},
+	{0x10352300,	//	KonaLHe+
+		"30F7E82B0C8E068D9D",
+		"268435456,2,1,0,1,8,239,2097151,2,2,65536,1,0,2,2,2,2,1,1,1,0,1,1,8,8,2,0,0,0,0,0,1,1,1,1,1,1,0,1,2,0,0,0,0,0,0,1,1",
+		"FD;FFAB;FF7E;EF1;;EFFF30C73;3;12;D;3;B1;1;5;354030081D04;F001;",
+		"F001;7;FFAB;12;EFFF30C73;354030081D04"},
+	{0x10378800,	//	IoXT
+		"30AFCEAF3C8ECFED9F10000081",
+		"201326592,2,1,1,1,16,255,2097151,2,2,65536,1,0,0,0,0,8,0,1,2,1,2,1,16,16,2,0,8,8,1,1,1,2,1,1,1,1,1,2,2,0,0,1,1,0,0,2,2",
+		"FD;FFAB1;FF7E;EF1;;EFFFFFF7F;3;26;F;3;F2;3;9;3F030366DD04;FFFFFF7;",
+		"FFFFFF7;F3;FFAB1;26;EFFFFFF7F;3F030366DD04"},
+	{0x10402100,	//	Corvid24
+		"380FC22A1C0EEEFE9D1",
+		"536870912,0,0,0,1,16,313,2097151,2,4,65536,0,0,0,0,0,0,0,0,4,0,4,0,16,16,4,0,0,0,0,0,0,4,2,0,1,2,0,4,4,0,0,2,2,0,0,4,4",
+		"FD3;FF0B1;FF7E3;EF1;;EFFFFBF7300000000000FFF330003;3;0E1;C3;F;FC;3;1;FF0F0F660404DF3;;",
+		";F3;FF0B1;0E1;EFFFFBF7300000000000FFF330003;FF0F0F660404DF3"},
+	{0x10416000,	//	TTap
+		"300F0823248C09CD9F",
+		"134217728,0,0,1,1,8,235,2097151,2,1,65536,0,0,0,0,0,0,0,0,1,0,0,0,0,8,1,0,0,8,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1",
+		"FD;32A;FF7E;EF1;;EFFF30C73;1;;6;1;8;3;;100010008804;;",
+		";;32A;;EFFF30C73;100010008804"},
+	{0x10478300,	//	Io4K
+		"3F2FD72AFC9EEFFDAF33000C81",
+		"931135488,0,0,2,1,16,511,2097151,2,4,65536,0,1,0,0,0,8,0,0,4,0,5,0,16,16,4,0,8,8,1,1,0,5,2,0,1,1,0,4,5,0,0,1,1,0,0,4,4",
+		"FDF;FF0B103;FF7E3;EF7;;EFFFF9F7330000000000FFF33FFCF1;3;2E1;E7;F;FE;3;9;FF0F0F660404DFFF1000000C3;;",
+		";F3;FF0B103;2E1;EFFFF9F7330000000000FFF33FFCF1;FF0F0F660404DFFF1000000C3"},
+	{0x10478350,	//	Io4KUfc
+		"332FDFAFBC9EEFEDAF31000C81",
+		"931135488,0,1,3,1,16,375,2097151,2,2,65536,2,0,0,16,0,8,0,0,2,1,3,1,16,16,2,0,8,8,1,1,1,3,2,1,1,1,1,2,3,0,0,1,1,0,0,2,2",
+		"FD;FFAB1;FF7E;EF1;;EFFFFFF7F;3;26;E1;3;F2;3;9;3F0303660D04100F00000003;FFFFFFF3;",
+		"FFFFFFF3;F3;FFAB1;26;EFFFFFF7F;3F0303660D04100F00000003"},
+	{0x10518400,	//	Kona4
+		"3FBFF7AAED9EEEFDAD130025",
+		"931135488,2,0,2,1,16,511,2097151,2,4,65536,0,1,16,16,0,0,0,1,4,0,5,0,16,16,4,0,0,8,0,1,0,5,2,1,1,1,0,4,4,0,0,2,2,0,0,4,4",
+		"FDF;FF0B103;FF7E3;EF7;;EFFFF9F7330000000000FFF33FFCF1;3;0E1;F3;F;FC;3;1;FF0F0F661404DFB61000000C3;;",
+		";F3;FF0B103;0E1;EFFFF9F7330000000000FFF33FFCF1;FF0F0F661404DFB61000000C3"},
+	{0x10518450,	//	Kona4Ufc
+		"33BFFFAFAC9EEEEDAD110004",
+		"931135488,2,1,3,1,16,358,2097151,2,2,65536,2,0,16,16,0,0,0,1,2,1,2,1,16,16,2,0,0,8,0,1,1,2,2,1,1,1,1,2,2,0,0,2,2,0,0,2,2",
+		"FD;FFAB1;FF7E;EF1;;EFFFFFF7F;3;06;F;3;F;3;1;3F0303661D04100800000002;FFFFFFF3;",
+		"FFFFFFF3;F3;FFAB1;06;EFFFFFF7F;3F0303661D04100800000002"},
+	{0x10538200,	//	Corvid88
+		"3F0FD53AFD9EFEFCAD1100A5",
+		"1073741824,0,0,0,2,16,511,2097151,2,8,65536,0,0,0,0,0,0,0,0,8,0,8,0,16,16,8,0,0,0,0,0,0,8,4,0,1,1,0,8,8,0,0,2,1,0,0,8,8",
+		"FDF;FF4B18C;FF7E3;EF7;;EFFFF9F7330000000000FFF33FFCF1;3;0EF1;CF3;FF;FCF;3;1;FF0F0F660404DF3EEFFFFFFC3;;",
+		";F3;FF4B18C;0EF1;EFFFF9F7330000000000FFF33FFCF1;FF0F0F660404DF3EEFFFFFFC3"},
+	{0x10565400,	//	Corvid44
+		"3F0FD53AFD9EFEFCAD1100A5",
+		"1073741824,0,0,0,2,16,511,2097151,2,4,65536,0,0,0,0,0,0,0,0,4,0,4,0,16,16,4,0,0,0,0,0,0,4,2,0,1,1,0,4,4,0,0,2,1,0,0,4,4",
+		"FDF;FF4B18C;FF7E3;EF7;;EFFFF9F7330000000000FFF33FFCF1;3;0E1;C3;F;FC;3;1;FF0F0F660404DF300000000C3;;",
+		";F3;FF4B18C;0E1;EFFFF9F7330000000000FFF33FFCF1;FF0F0F660404DF300000000C3"},
+	{0x10634500,	//	CorvidHEVC
+		"3D07512A7C0C2CECAD51",
+		"1073741824,0,0,0,0,16,511,2097151,2,8,65536,0,0,0,0,0,0,0,0,4,0,4,0,16,0,8,0,0,0,0,0,0,0,4,0,1,0,0,4,8,0,0,1,0,0,0,4,4",
+		"FDF;3200000F;FF7E3;EF7;;EFFFF9F7330000000000FFF33FFCF1;3;0E1;CF3;FF;FC;1;1;F30F0000040410300E100CFC3;;",
+		";;3200000F;0E1;EFFFF9F7330000000000FFF33FFCF1;F30F0000040410300E100CFC3"},
+	{0x10646700,	//	KonaIP s2022
+		"330FD7A2EC8EEEF5CD130044",
+		"931135488,0,0,3,1,16,511,2097151,2,4,65536,0,0,0,0,0,0,0,0,4,0,5,0,16,16,4,0,0,8,0,1,0,5,2,0,1,0,0,4,4,4,0,0,0,0,0,4,4",
+		"FD;FF0B103;FF7E;EF1;;EFFFFBF7F00000000000000000003;3;0E1;E3;F;FC;3;1;FF0F0F660404DF3600000002;;",
+		";F3;FF0B103;0E1;EFFFFBF7F00000000000000000003;FF0F0F660404DF3600000002"},
+	{0x10646701,	//	KonaIP s2022 2+2
+		"330FD7A2EC8EEEF5CD130044",
+		"931135488,0,0,2,1,16,511,2097151,2,4,65536,0,1,0,0,0,0,0,0,4,0,5,0,16,16,4,0,0,8,0,1,0,5,2,0,1,0,0,4,4,2,2,0,0,0,0,4,4",
+		"FD;FF0B103;FF7E;EF7;;EFFFFBF7F000000000000000000CF1;3;0E1;E3;F;FC;3;1;FF0F0F660404DF3600000002;;",
+		";F3;FF0B103;0E1;EFFFFBF7F000000000000000000CF1;FF0F0F660404DF3600000002"},
+	{0x10646702,	//	KonaIP J2K 1I 1O
+		"3017D2AA7C8E2EE5CD170044",
+		"931135488,0,0,3,1,16,511,2097151,2,2,65536,0,0,16,0,0,0,0,0,4,0,2,0,16,16,4,0,0,8,0,1,0,2,2,0,1,0,0,1,1,2,0,0,0,0,0,4,4",
+		"F5;FF0B103;FF7E;EF7;;E3F72870B000000000000000000CF1;3;02;6;F;B;1;1;FF0101000404100000000002;;",
+		";F3;FF0B103;02;E3F72870B000000000000000000CF1;FF0101000404100000000002"},
+	{0x10646703,	//	KonaIP J2K 2O
+		"301792AA7C8E2EE5CD170044",
+		"931135488,0,0,3,1,16,511,2097151,2,2,65536,0,0,16,0,0,0,0,0,4,0,2,0,16,16,4,0,0,8,0,1,0,2,2,0,1,0,0,0,2,2,0,0,0,0,0,4,4",
+		"F5;FF0B103;FF7E;EF7;;E3F72870B000000000000000000CF1;1;;E;F;9;1;;FF0003000404100000000002;;",
+		";F3;FF0B103;;E3F72870B000000000000000000CF1;FF0003000404100000000002"},
+	{0x10646705,	//	KonaIP s2110 1I 1O
+		"330FD7A2EC8EEEF5CD132044",
+		"931135488,0,0,3,1,16,511,2097151,2,4,65536,0,0,0,0,0,0,0,0,4,0,4,0,16,16,4,0,0,8,0,1,0,4,2,0,1,0,0,4,4,4,0,0,0,0,0,4,4",
+		"FD;FF0B103;FF7E;EF7;;EFFFFBF7F000000000000000000CF1;3;0E1;E3;F;FC;3;1;FF0F0F660404DF3000000002;;",
+		";F3;FF0B103;0E1;EFFFFBF7F000000000000000000CF1;FF0F0F660404DF3000000002"},
+	{0x10646706,	//	KonaIP s2110
+		"3F07D3A2EC8EAEF5CD132044",
+		"931135488,0,0,2,1,16,511,2097151,2,4,65536,0,0,0,0,0,0,0,0,4,0,4,0,16,16,4,0,0,8,0,1,0,4,2,0,1,0,0,4,4,4,0,0,0,0,0,4,4",
+		"FDF;FF0B103;FF7E3;EF7;;EFFF38F7330000000000FFF33FFCF1;3;0E1;E3;F;FC;1;1;FF0F0F060404DCB01000000C3;;",
+		";F3;FF0B103;0E1;EFFF38F7330000000000FFF33FFCF1;FF0F0F060404DCB01000000C3"},
+	{0x10646707,	//	KonaIP s2110 RGB12
+		"3F0797A2EC8EAEE5CD132044",
+		"931135488,0,0,2,2,16,511,2097151,2,4,65536,0,0,0,0,0,0,0,0,4,0,4,0,0,16,2,0,0,8,0,1,0,4,0,0,0,0,0,0,4,4,0,0,0,0,0,4,4",
+		"FDF;FF0B103;FF7E3;EF7;;EFFF38F7330000000000FFF33FFCF1;1;;E3;3;8;1;;3F000F060004CCB00000000C3;;",
+		";F3;FF0B103;;EFFF38F7330000000000FFF33FFCF1;3F000F060004CCB00000000C3"},
+	{0x10668200,	//	CorvidHBR
+		"281FC00228082CEDAD1",
+		"536870912,0,0,2,1,16,511,2097151,2,4,65536,0,1,2,0,0,8,0,0,1,0,4,0,0,0,4,0,8,0,1,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1",
+		"F5F;FFAB1;FF7E3;EF7;;E3F7E970300000000000FFF33FFCF1;2;2;;F;;3;8;FF0000000000C0701;;",
+		";;FFAB1;2;E3F7E970300000000000FFF33FFCF1;FF0000000000C0701"},
+	{0x10710800,	//	Io4KPlus
+		"3F2FD72AFC9EEF3D8F339424BD",
+		"2147483648,0,0,4,2,16,511,2097151,2,4,65536,0,1,0,0,8,8,0,0,4,0,5,0,16,16,4,0,8,8,1,1,0,5,2,0,1,1,0,4,5,0,0,1,1,0,0,4,4",
+		"FDF;FF0B3;FF7E3;EF7;;EFFFF9F7330000000000FFF33FFCF1;3;2E1;E7;F;FE;7;9;FF0E0B660404DF3F1000000C7054;;",
+		";F3;FF0B3;2E1;EFFFF9F7330000000000FFF33FFCF1;FF0E0B660404DF3F1000000C7054"},
+	{0x10710850,	//	IoIP-s2022
+		"372FD72AFC8EEF2D8F330044BD",
+		"2147483648,0,0,4,2,16,511,2097151,2,8,65536,0,1,0,0,8,8,0,0,4,0,5,0,16,16,4,0,0,8,0,1,0,5,2,0,1,0,0,4,5,4,0,1,0,0,0,4,4",
+		"FD;FF0B1;FF7E;EF1;;EFFFFBF7B00000000000000000003;3;0E1;E7;F;FC;3;1;FF0F0F660404DF3F1000000C3004;;",
+		";F3;FF0B1;0E1;EFFFFBF7B00000000000000000003;FF0F0F660404DF3F1000000C3004"},
+	{0x10710851,	//	IoIP-s2110
+		"3F2FD32AFC8EEF3D8F332044BD",
+		"2147483648,0,0,4,2,16,511,2097151,2,8,65536,0,1,0,0,8,8,0,0,4,0,5,0,16,16,4,0,0,8,0,1,0,5,2,0,1,0,0,4,5,4,0,1,0,0,0,4,4",
+		"FDF;FF0B1;FF7E3;EF7;;EFFF38F7330000000000FFF33FFCF1;3;0E1;E7;F;FC;3;1;FF0F0F660404DF3F1000000C3004;;",
+		";F3;FF0B1;0E1;EFFF38F7330000000000FFF33FFCF1;FF0F0F660404DF3F1000000C3004"},
+	{0x10710852,	//	IoIP-s2110_RGB12
+		"3F2797AAFC8EAFAD8F332044AD",
+		"2147483648,0,0,4,2,16,511,2097151,2,4,65536,0,1,0,0,0,8,0,0,4,0,5,0,0,16,2,0,0,8,0,1,0,5,0,0,0,0,0,0,5,4,0,1,0,0,0,4,4",
+		"FDF;FF0B1;FF7E3;EF7;;EFFF38F7330000000000FFF33FFCF1;1;;E7;3;8;1;;3F000F060004CC3F0000000C0004;;",
+		";F3;FF0B1;;EFFF38F7330000000000FFF33FFCF1;3F000F060004CC3F0000000C0004"},
+	{0x10756600,	//	Kona1
+		"2307D72ABD8E3EEDAD310004",
+		"1073741824,0,0,0,2,16,511,2097151,2,2,524288,0,0,0,0,0,0,0,0,2,0,2,0,16,16,2,0,0,0,0,0,0,2,1,0,1,1,0,1,1,0,0,1,0,0,0,2,2",
+		"FD;FF1B1;FF7E;EF1;;EFFFF9F73300000000000000000C7;3;02;4;3;B;1;1;3F0101220404;;",
+		";F3;FF1B1;02;EFFFF9F73300000000000000000C7;3F0101220404"},
+	{0x10767400,	//	KonaHDMI
+		"3C07C102680A2C2DAD10020408",
+		"2147483648,0,0,4,2,16,511,2097151,2,4,65536,0,0,0,0,0,0,0,0,4,0,8,0,0,0,4,0,8,0,4,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,4,4",
+		"F5F;FF0B1;FF7E3;EF7;;E3F7E97030000000000083E33FFCF1;2;E1;;F;;1;8;FF0000000004C0360000F30C30C3;;",
+		";;FF0B1;E1;E3F7E97030000000000083E33FFCF1;FF0000000004C0360000F30C30C3"},
+	{0x10798400,	//	Kona5
+		"3F17F7AAFD9EEE3D8D1398AF4C",
+		"2147483648,0,0,4,2,16,511,2097151,2,4,65536,0,1,8,8,0,0,0,0,4,0,5,0,16,16,4,0,0,8,0,1,0,5,2,0,1,1,0,4,4,0,0,2,2,0,0,4,4",
+		"FDF;FF4B38C;FF7E3;EF7;;EFFFF9F7330000000000FFF33FFCF1;3;0E1;E3;F;FC;5;1;FF0E0B660404DF361000000C7014;;",
+		";F3;FF4B38C;0E1;EFFFF9F7330000000000FFF33FFCF1;FF0E0B660404DF361000000C7014"},
+	{0x10798401,	//	Kona5-8KMK
+		"3B1775AAFD9EFC3C8D1BD8A74C",
+		"4160749568,0,0,4,0,16,511,2097151,2,4,65536,0,1,8,8,0,0,0,0,4,0,2,0,16,16,4,0,0,8,0,1,0,0,1,0,1,1,0,4,4,0,0,2,2,0,0,4,4",
+		"FDF3;FF0B3;FF7EF;EF7;;EFFFF9F73300000000000000000CF100000000000000000000FFF100000000CFFF100000000000000000000CF30000000000FF3;3;0E1;E3;F;FC;5;1;F30000000404000000000000CF341;;",
+		";F3;FF0B3;0E1;EFFFF9F73300000000000000000CF100000000000000000000FFF100000000CFFF100000000000000000000CF30000000000FF3;F30000000404000000000000CF341"},
+	{0x10798402,	//	Kona5-8K
+		"3B1775AAF59CFC1C8D1BD8A74C",
+		"4160749568,0,0,4,2,16,511,2097151,2,4,65536,0,1,8,8,0,0,0,0,4,0,0,0,16,16,4,0,0,8,0,1,0,0,0,0,1,1,0,4,4,0,0,2,2,0,0,4,4",
+		"FDF3;FF0B3;FF7EF;EF7;;EFFFF9F73300000000000000000CF100000000000000000000FFF100000000CFFF100000000000000000000CF30000000000FF3;3;0E1;E3;F;FC;5;1;F000006600040F0000000000CF341;;",
+		";;FF0B3;0E1;EFFFF9F73300000000000000000CF100000000000000000000FFF100000000CFFF100000000000000000000CF30000000000FF3;F000006600040F0000000000CF341"},
+	{0x10798403,	//	Kona5-12Bit
+		"3B17F7AAFD9EEC3D8D1BD8A74C",
+		"4160749568,0,0,4,2,16,511,2097151,2,4,65536,0,1,8,8,0,0,0,0,2,0,2,0,16,16,2,0,0,8,0,1,0,2,1,0,1,1,0,4,4,0,0,2,2,0,0,2,2",
+		"FDF3;FF4B38C;FF7EF;EF7;;EFFFF9F73300000000000000000CF100000000000000000000FFF100000000CFFF100000000000000000000CF30000000000FF3;3;0E1;E3;3;FC;5;1;3F00006604040F0000000000CF341;;",
+		";F3;FF4B38C;0E1;EFFFF9F73300000000000000000CF100000000000000000000FFF100000000CFFF100000000000000000000CF30000000000FF3;3F00006604040F0000000000CF341"},
+	{0x10798404,	//	Kona5-3DLUT
+		"3B17F5B2ED8E2E3D8D1B98A74C",
+		"4160749568,0,0,4,2,16,511,2097151,2,2,65536,0,1,8,8,0,0,0,0,1,0,4,0,16,16,2,0,0,8,0,1,0,4,1,0,0,0,0,2,2,0,0,0,0,0,0,1,1",
+		"3DF;FF0B3;33723;EF7;;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;3;06;E;3;E;5;1;3F0000260400C03000000000CC042;;",
+		";;FF0B3;06;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;3F0000260400C03000000000CC042"},
+	{0x10798405,	//	Kona5-OE1
+		"3B1775B2ED8E2E3D8D1B90274C",
+		"4160749568,0,0,4,2,16,511,2097151,2,2,65536,0,1,8,8,0,0,0,0,1,0,4,0,16,16,2,0,0,8,0,1,0,0,1,0,0,0,0,2,2,0,0,0,0,0,0,1,1",
+		"3DF;FF0B3;33723;EF7;;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;3;06;E;3;E;5;1;330000240400003000000000CC048;;",
+		";;FF0B3;06;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;330000240400003000000000CC048"},
+	{0x10798406,	//	Kona5-OE2
+		"3B1775B2ED8E2E3D8D1B90274C",
+		"4160749568,0,0,4,2,16,511,2097151,2,2,65536,0,1,8,8,0,0,0,0,1,0,4,0,16,16,2,0,0,8,0,1,0,0,1,0,0,0,0,2,2,0,0,0,0,0,0,1,1",
+		"3DF;FF0B3;33723;EF7;;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;3;06;E;3;E;5;1;330000240400003000000000CC048;;",
+		";;FF0B3;06;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;330000240400003000000000CC048"},
+	{0x10798407,	//	Kona5-OE3
+		"3B1775B2ED8E2E3D8D1B90274C",
+		"4160749568,0,0,4,2,16,511,2097151,2,2,65536,0,1,8,8,0,0,0,0,1,0,4,0,16,16,2,0,0,8,0,1,0,0,1,0,0,0,0,2,2,0,0,0,0,0,0,1,1",
+		"3DF;FF0B3;33723;EF7;;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;3;06;E;3;E;5;1;330000240400003000000000CC048;;",
+		";;FF0B3;06;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;330000240400003000000000CC048"},
+	{0x10798408,	//	Kona5-OE4
+		"3B1775B2ED8E2E3D8D1B90274C",
+		"4160749568,0,0,4,2,16,511,2097151,2,2,65536,0,1,8,8,0,0,0,0,1,0,4,0,16,16,2,0,0,8,0,1,0,0,1,0,0,0,0,2,2,0,0,0,0,0,0,1,1",
+		"3DF;FF0B3;33723;EF7;;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;3;06;E;3;E;5;1;330000240400003000000000CC048;;",
+		";;FF0B3;06;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;330000240400003000000000CC048"},
+	{0x10798409,	//	Kona5-OE5
+		"3B1775B2ED8E2E3D8D1B90274C",
+		"4160749568,0,0,4,2,16,511,2097151,2,2,65536,0,1,8,8,0,0,0,0,1,0,4,0,16,16,2,0,0,8,0,1,0,0,1,0,0,0,0,2,2,0,0,0,0,0,0,1,1",
+		"3DF;FF0B3;33723;EF7;;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;3;06;E;3;E;5;1;330000240400003000000000CC048;;",
+		";;FF0B3;06;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;330000240400003000000000CC048"},
+	{0x1079840A,	//	Kona5-OE6
+		"3B1775B2ED8E2E3D8D1B90274C",
+		"4160749568,0,0,4,2,16,511,2097151,2,2,65536,0,1,8,8,0,0,0,0,1,0,4,0,16,16,2,0,0,8,0,1,0,0,1,0,0,0,0,2,2,0,0,0,0,0,0,1,1",
+		"3DF;FF0B3;33723;EF7;;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;3;06;E;3;E;5;1;330000240400003000000000CC048;;",
+		";;FF0B3;06;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;330000240400003000000000CC048"},
+	{0x1079840B,	//	Kona5-OE7
+		"3B1775B2ED8E2E3D8D1B90274C",
+		"4160749568,0,0,4,2,16,511,2097151,2,2,65536,0,1,8,8,0,0,0,0,1,0,4,0,16,16,2,0,0,8,0,1,0,0,1,0,0,0,0,2,2,0,0,0,0,0,0,1,1",
+		"3DF;FF0B3;33723;EF7;;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;3;06;E;3;E;5;1;330000240400003000000000CC048;;",
+		";;FF0B3;06;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;330000240400003000000000CC048"},
+	{0x1079840C,	//	Kona5-OE8
+		"3B1775B2ED8E2E3D8D1B90274C",
+		"4160749568,0,0,4,2,16,511,2097151,2,2,65536,0,1,8,8,0,0,0,0,1,0,4,0,16,16,2,0,0,8,0,1,0,0,1,0,0,0,0,2,2,0,0,0,0,0,0,1,1",
+		"3DF;FF0B3;33723;EF7;;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;3;06;E;3;E;5;1;330000240400003000000000CC048;;",
+		";;FF0B3;06;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;330000240400003000000000CC048"},
+	{0x1079840D,	//	Kona5-OE9
+		"3B1775B2ED8E2E3D8D1B90274C",
+		"4160749568,0,0,4,2,16,511,2097151,2,2,65536,0,1,8,8,0,0,0,0,1,0,4,0,16,16,2,0,0,8,0,1,0,0,1,0,0,0,0,2,2,0,0,0,0,0,0,1,1",
+		"3DF;FF0B3;33723;EF7;;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;3;06;E;3;E;5;1;330000240400003000000000CC048;;",
+		";;FF0B3;06;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;330000240400003000000000CC048"},
+	{0x1079840E,	//	Kona5-OE10
+		"3B1775B2ED8E2E3D8D1B90274C",
+		"4160749568,0,0,4,2,16,511,2097151,2,2,65536,0,1,8,8,0,0,0,0,1,0,4,0,16,16,2,0,0,8,0,1,0,0,1,0,0,0,0,2,2,0,0,0,0,0,0,1,1",
+		"3DF;FF0B3;33723;EF7;;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;3;06;E;3;E;5;1;330000240400003000000000CC048;;",
+		";;FF0B3;06;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;330000240400003000000000CC048"},
+	{0x1079840F,	//	Kona5-OE11
+		"3B1775B2ED8E2E3D8D1B90274C",
+		"4160749568,0,0,4,2,16,511,2097151,2,2,65536,0,1,8,8,0,0,0,0,1,0,4,0,16,16,2,0,0,8,0,1,0,0,1,0,0,0,0,2,2,0,0,0,0,0,0,1,1",
+		"3DF;FF0B3;33723;EF7;;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;3;06;E;3;E;5;1;330000240400003000000000CC048;;",
+		";;FF0B3;06;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;330000240400003000000000CC048"},
+	{0x10798410,	//	Kona5-OE12
+		"3B1775B2ED8E2E3D8D1B90274C",
+		"4160749568,0,0,4,2,16,511,2097151,2,2,65536,0,1,8,8,0,0,0,0,1,0,4,0,16,16,2,0,0,8,0,1,0,0,1,0,0,0,0,2,2,0,0,0,0,0,0,1,1",
+		"3DF;FF0B3;33723;EF7;;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;3;06;E;3;E;5;1;330000240400003000000000CC048;;",
+		";;FF0B3;06;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;330000240400003000000000CC048"},
+	{0x10798420,	//	Kona5-8K-MV-TX
+		"3B1775AAF59CFC1C8D1BD8A74C",
+		"4160749568,0,0,4,2,16,511,2097151,2,4,65536,0,1,8,8,0,0,0,0,4,0,0,0,16,16,4,0,0,8,0,1,0,0,0,0,1,1,0,1,4,0,0,2,2,0,0,4,4",
+		"FDF3;FF0B3;FF7EF;EF7;;EFFFF9F73300000000000000000CF100000000000000000000FFF100000000CFFF100000000000000000000CF30000000000FF3;3;02;E3;F;B;5;1;F000002600040C00000000004C341;;",
+		";;FF0B3;02;EFFFF9F73300000000000000000CF100000000000000000000FFF100000000CFFF100000000000000000000CF30000000000FF3;F000002600040C00000000004C341"},
+	{0x10832400,	//	Corvid44-8KMK
+		"3907552AFD9CFC3C8D1950074C",
+		"4160749568,0,0,0,0,16,511,2097151,2,4,65536,0,0,0,0,0,0,0,0,4,0,3,0,16,16,4,0,0,0,0,0,0,0,2,0,1,1,0,4,4,0,0,2,2,0,0,4,4",
+		"FDF3;FF0B3;FF7EF;EF7;;EFFFF9F73300000000000000000CF100000000000000000000FFF100000000CFFF100000000000000000000CF30000000000FF3;3;0E1;C3;F;FC;1;1;F30000000404101000000000CF301;;",
+		";F3;FF0B3;0E1;EFFFF9F73300000000000000000CF100000000000000000000FFF100000000CFFF100000000000000000000CF30000000000FF3;F30000000404101000000000CF301"},
+	{0x10832401,	//	Corvid44-8K
+		"3B07552AF59CFC1C8D1950274C",
+		"4160749568,0,0,0,0,16,511,2097151,2,4,65536,0,0,0,0,0,0,0,0,4,0,0,0,16,16,4,0,0,0,0,0,0,0,0,0,1,1,0,4,4,0,0,2,2,0,0,4,4",
+		"FDF3;FF0B3;FF7EF;EF7;;EFFFF9F73300000000000000000CF100000000000000000000FFF100000000CFFF100000000000000000000CF30000000000FF3;3;0E1;C3;F;FC;1;1;F000006600040F0000000000CF301;;",
+		";;FF0B3;0E1;EFFFF9F73300000000000000000CF100000000000000000000FFF100000000CFFF100000000000000000000CF30000000000FF3;F000006600040F0000000000CF301"},
+	{0x10832402,	//	Corvid44-2x4K
+		"3B17F7AAFD9EFC3D8D1B50274C",
+		"4160749568,0,0,0,2,16,511,2097151,2,4,65536,0,1,8,8,0,0,0,0,2,0,2,0,16,16,2,0,0,0,0,0,0,2,1,0,1,1,0,4,4,0,0,2,2,0,0,2,2",
+		"FDF3;FF4B38C;FF7EF;EF7;;EFFFF9F73300000000000000000CF100000000000000000000FFF100000000CFFF100000000000000000000CF30000000000FF3;3;0E1;C3;3;FC;1;1;3F00006604040F0000000000CF301;;",
+		";F3;FF4B38C;0E1;EFFFF9F73300000000000000000CF100000000000000000000FFF100000000CFFF100000000000000000000CF30000000000FF3;3F00006604040F0000000000CF301"},
+	{0x10832403,	//	Corvid44-PLNR
+		"3907512AF59CFC1C8D1910274C",
+		"4160749568,0,0,0,0,16,511,2097151,2,4,65536,0,0,0,0,0,0,0,0,4,0,0,0,16,16,4,0,0,0,0,0,0,0,0,0,1,1,0,4,1,0,0,2,0,0,0,4,4",
+		"FDF;324008C;FF7E3;EF7;;EFFFF9F7330000000000FFF33FFCF100000000000000000000FFF100000000CFFF1;3;0E1;4;F;FC;1;1;F00000000004000000000000C7;;",
+		";;324008C;0E1;EFFFF9F7330000000000FFF33FFCF100000000000000000000FFF100000000CFFF1;F00000000004000000000000C7"},
+	{0x10879000,	//	TTapPro
+		"3B079522AC8C2C0CAD1B10270A",
+		"1073741824,0,0,4,2,16,511,2097151,2,1,65536,0,0,0,0,0,0,0,0,1,0,1,0,16,16,1,0,0,8,0,1,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1",
+		"FDF;FF0B3;FF7E3;EF7;;EFFF38F73300000000000000000CF1000000000000000000008FC1000000000E3F1;1;;6;1;8;1;;1500000200040000000000000408;;",
+		";;FF0B3;;EFFF38F73300000000000000000CF1000000000000000000008FC1000000000E3F1;1500000200040000000000000408"},
+	{0x10920600,	//	IoX3
+		"332FD72AEC9EEFBDAF33882499",
+		"1073741824,0,0,2,1,16,511,2097151,2,4,65536,0,0,0,0,8,8,0,0,4,0,4,0,16,16,4,0,8,8,1,1,0,4,2,0,1,1,0,4,4,0,0,1,1,0,0,4,4",
+		"FD;FF0B103;FF7E;EF7;;EFFFF9F73300000000000000000CF1;3;2E1;E3;F;FE;7;9;FF0F0F660404DFF;;",
+		";F3;FF0B103;2E1;EFFFF9F73300000000000000000CF1;FF0F0F660404DFF"},
+	{0x10922400,	//	SOJI-3DLUT
+		"3B17F5B2ED8E2E3D8D1B98A74C",
+		"4160749568,0,0,4,2,16,511,2097151,2,2,65536,0,1,8,8,0,0,0,0,1,0,4,0,16,16,2,0,0,8,0,1,0,4,1,0,0,0,0,2,2,0,0,0,0,0,0,1,1",
+		"3DF;FF0B3;33723;EF7;;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;3;06;E;3;E;5;1;3F0000260400C03000000000CC042;;",
+		";;FF0B3;06;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;3F0000260400C03000000000CC042"},
+	{0x10922401,	//	SOJI-OE1
+		"3B1775B2ED8E2E3D8D1B90274C",
+		"4160749568,0,0,4,2,16,511,2097151,2,2,65536,0,1,8,8,0,0,0,0,1,0,4,0,16,16,2,0,0,8,0,1,0,0,1,0,0,0,0,2,2,0,0,0,0,0,0,1,1",
+		"3DF;FF0B3;33723;EF7;;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;3;06;E;3;E;5;1;330000240400003000000000CC048;;",
+		";;FF0B3;06;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;330000240400003000000000CC048"},
+	{0x10922402,	//	SOJI-OE2
+		"3B1775B2ED8E2E3D8D1B90274C",
+		"4160749568,0,0,4,2,16,511,2097151,2,2,65536,0,1,8,8,0,0,0,0,1,0,4,0,16,16,2,0,0,8,0,1,0,0,1,0,0,0,0,2,2,0,0,0,0,0,0,1,1",
+		"3DF;FF0B3;33723;EF7;;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;3;06;E;3;E;5;1;330000240400003000000000CC048;;",
+		";;FF0B3;06;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;330000240400003000000000CC048"},
+	{0x10922403,	//	SOJI-OE3
+		"3B1775B2ED8E2E3D8D1B90274C",
+		"4160749568,0,0,4,2,16,511,2097151,2,2,65536,0,1,8,8,0,0,0,0,1,0,4,0,16,16,2,0,0,8,0,1,0,0,1,0,0,0,0,2,2,0,0,0,0,0,0,1,1",
+		"3DF;FF0B3;33723;EF7;;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;3;06;E;3;E;5;1;330000240400003000000000CC048;;",
+		";;FF0B3;06;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;330000240400003000000000CC048"},
+	{0x10922404,	//	SOJI-OE4
+		"3B1775B2ED8E2E3D8D1B90274C",
+		"4160749568,0,0,4,2,16,511,2097151,2,2,65536,0,1,8,8,0,0,0,0,1,0,4,0,16,16,2,0,0,8,0,1,0,0,1,0,0,0,0,2,2,0,0,0,0,0,0,1,1",
+		"3DF;FF0B3;33723;EF7;;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;3;06;E;3;E;5;1;330000240400003000000000CC048;;",
+		";;FF0B3;06;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;330000240400003000000000CC048"},
+	{0x10922405,	//	SOJI-OE5
+		"3B1775B2ED8E2E3D8D1B90274C",
+		"4160749568,0,0,4,2,16,511,2097151,2,2,65536,0,1,8,8,0,0,0,0,1,0,4,0,16,16,2,0,0,8,0,1,0,0,1,0,0,0,0,2,2,0,0,0,0,0,0,1,1",
+		"3DF;FF0B3;33723;EF7;;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;3;06;E;3;E;5;1;330000240400003000000000CC048;;",
+		";;FF0B3;06;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;330000240400003000000000CC048"},
+	{0x10922406,	//	SOJI-OE6
+		"3B1775B2ED8E2E3D8D1B90274C",
+		"4160749568,0,0,4,2,16,511,2097151,2,2,65536,0,1,8,8,0,0,0,0,1,0,4,0,16,16,2,0,0,8,0,1,0,0,1,0,0,0,0,2,2,0,0,0,0,0,0,1,1",
+		"3DF;FF0B3;33723;EF7;;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;3;06;E;3;E;5;1;330000240400003000000000CC048;;",
+		";;FF0B3;06;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;330000240400003000000000CC048"},
+	{0x10922407,	//	SOJI-OE7
+		"3B1775B2ED8E2E3D8D1B90274C",
+		"4160749568,0,0,4,2,16,511,2097151,2,2,65536,0,1,8,8,0,0,0,0,1,0,4,0,16,16,2,0,0,8,0,1,0,0,1,0,0,0,0,2,2,0,0,0,0,0,0,1,1",
+		"3DF;FF0B3;33723;EF7;;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;3;06;E;3;E;5;1;330000240400003000000000CC048;;",
+		";;FF0B3;06;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;330000240400003000000000CC048"},
+	{0x10922499,	//	SOJI-DIAGS
+		"3B17F5B2ED8E2E3D8D1B98A74C",
+		"4160749568,0,0,4,2,16,511,2097151,2,2,65536,0,1,8,8,0,0,0,0,1,0,4,0,16,16,2,0,0,8,0,1,0,4,1,0,0,0,0,2,2,0,0,0,0,0,0,1,1",
+		"3DF;FF0B3;33723;EF7;;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;3;06;E;3;E;5;1;3F0000260400C03000000000CC042;;",
+		";;FF0B3;06;EFFFF9F70000000000000000000CF100000000000000000000FFF100000000CFFF1;3F0000260400C03000000000CC042"},
+	{0x10958500,	//	KonaXM
+		"3B07553AFD9CFC3C8D19502748",
+		"4160749568,0,0,5,0,16,511,2097151,2,4,65536,0,0,0,0,0,0,0,0,4,0,3,0,16,16,4,0,8,8,1,1,0,0,1,0,1,0,0,2,2,0,0,2,0,0,0,4,4",
+		"FDF;FF0B3;FF7E3;EF7;;EFFF38F73300000000000000000CF100000000000000000000FFF100000000CFFF1;3;26;E;F;F2;1;9;F30000660404001000000000CC0801;;",
+		";F3;FF0B3;26;EFFF38F73300000000000000000CF100000000000000000000FFF100000000CFFF1;F30000660404001000000000CC0801"},
+	{0x10958501,	//	KonaX
+		"3B37D73AFD9EFE3D8D1B902748",
+		"2013265920,0,0,5,2,16,511,2097151,2,2,65536,0,0,8,8,2,2,0,0,2,0,3,0,16,16,2,0,8,8,1,1,0,2,1,0,1,1,0,2,2,0,0,1,1,0,0,2,2",
+		"FDF;FF0B3;FF7E3;EF7;;EFFF38F73300000000000000000CF100000000000000000000FFF100000000CFFF1;3;26;E;3;F2;5;9;3F0000660404001000000000CC0801;;",
+		";F3;FF0B3;26;EFFF38F73300000000000000000CF100000000000000000000FFF100000000CFFF1;3F0000660404001000000000CC0801"},
+};
+
+#endif	//	UT_DEVICEFEATURES_H
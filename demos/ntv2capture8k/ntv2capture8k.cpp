@@ -25,6 +25,7 @@ NTV2Capture8K::NTV2Capture8K (const CaptureConfig & inConfig)
 		mSavedTaskMode		(NTV2_DISABLE_TASKS),
 		mAudioSystem		(inConfig.fWithAudio ? NTV2_AUDIOSYSTEM_1 : NTV2_AUDIOSYSTEM_INVALID),
 		mHostBuffers		(),
+		mVideoPool			(),
 		mAVCircularBuffer	(),
 		mGlobalQuit			(false)
 {
@@ -54,6 +55,7 @@ void NTV2Capture8K::Quit (void)
 	while (mProducerThread.Active())
 		AJATime::Sleep(10);
 
+	mVideoPool.Unlock();
 	mDevice.DMABufferUnlockAll();
 
 	//	Restore some of the device's former state...
@@ -236,18 +238,30 @@ void NTV2Capture8K::SetupHostBuffers (void)
 	const size_t audioBufferSize (NTV2_AUDIOSIZE_MAX);
 	mHostBuffers.reserve(size_t(CIRCULAR_BUFFER_SIZE));
 	cout << "## NOTE: Buffer size:  vid=" << mFormatDesc.GetVideoWriteSize() << " aud=" << audioBufferSize << " anc=" << F1AncSize << endl;
+
+	//	8K requires page-locked buffers -- take the video buffers from a pool of huge pages on the device's
+	//	NUMA node, locked and mapped once up front, so each frame's DMA needs far fewer segments...
+	bool usePool (mVideoPool.Allocate(ULWord(CIRCULAR_BUFFER_SIZE), mFormatDesc.GetVideoWriteSize(), NTV2_POOLPAGES_1GB, mDevice.GetNUMANode()));
+	if (usePool  &&  !mVideoPool.Lock(mDevice))
+		{mVideoPool.Deallocate();  usePool = false;}
+	if (usePool)
+		cout << "## NOTE: Video buffers use " << NTV2BufferPool::PageKindToString(mVideoPool.GetPageKind()) << endl;
+
 	while (mHostBuffers.size() < size_t(CIRCULAR_BUFFER_SIZE))
 	{
 		mHostBuffers.push_back(NTV2FrameData());
 		NTV2FrameData & frameData(mHostBuffers.back());
-		frameData.fVideoBuffer.Allocate(mFormatDesc.GetVideoWriteSize());
+		if (usePool)
+			mVideoPool.GetBuffer(ULWord(mHostBuffers.size() - 1), frameData.fVideoBuffer);
+		else
+			frameData.fVideoBuffer.Allocate(mFormatDesc.GetVideoWriteSize());
 		frameData.fAudioBuffer.Allocate(NTV2_IS_VALID_AUDIO_SYSTEM(mAudioSystem) ? audioBufferSize : 0);
 		frameData.fAncBuffer.Allocate(F1AncSize);
 		frameData.fAncBuffer2.Allocate(F2AncSize);
 		mAVCircularBuffer.Add(&frameData);
 
 		//	8K requires page-locked buffers
-		if (frameData.fVideoBuffer)
+		if (frameData.fVideoBuffer  &&  !usePool)
 			mDevice.DMABufferLock(frameData.fVideoBuffer, true);
 		if (frameData.fAudioBuffer)
 			mDevice.DMABufferLock(frameData.fAudioBuffer, true);
@@ -10,6 +10,7 @@
 #define _NTV2CAPTURE_H
 
 #include "ntv2democommon.h"
+#include "ntv2bufferpool.h"
 #include "ajabase/system/thread.h"
 
 
@@ -130,6 +131,7 @@ class NTV2Capture8K
 		NTV2TaskMode		mSavedTaskMode;		///< @brief	Used to restore prior every-frame task mode
 		NTV2AudioSystem		mAudioSystem;		///< @brief	The audio system I'm using (if any)
 		NTV2FrameDataArray	mHostBuffers;		///< @brief	My host buffers
+		NTV2BufferPool		mVideoPool;			///< @brief	Pre-locked, huge-page-backed video buffers for mHostBuffers
 		FrameDataRingBuffer	mAVCircularBuffer;	///< @brief	My ring buffer object
 		bool				mGlobalQuit;		///< @brief	Set "true" to gracefully stop
 		NTV2ChannelSet		mActiveFrameStores;	///< @brief	Active FrameStores/Channels
@@ -194,7 +194,7 @@ static int dmaPageBufferInit(ULWord deviceNumber, PDMA_PAGE_BUFFER pBuffer,
 							 ULWord numPages, bool rdma);
 static void dmaPageBufferRelease(ULWord deviceNumber, PDMA_PAGE_BUFFER pBuffer);
 static int dmaPageLock(ULWord deviceNumber, PDMA_PAGE_BUFFER pBuffer,
-					   PVOID pAddress, ULWord size, ULWord direction);
+					   PVOID pAddress, ULWord size, ULWord direction, bool merge);
 static void dmaPageUnlock(ULWord deviceNumber, PDMA_PAGE_BUFFER pBuffer);
 #ifdef AJA_RDMA
 static void rdmaFreeCallback(void* data);
@@ -1051,7 +1051,7 @@ int dmaTransfer(PDMA_PARAMS pDmaParams)
 								pVideoPageBuffer,
 								pDmaParams->pVidUserVa,
 								videoCardBytes,
-								direction);
+								direction, false);
 				}
 
 				if (mapVideo)
@@ -1243,7 +1243,7 @@ int dmaTransfer(PDMA_PARAMS pDmaParams)
 							pAudioPageBuffer,
 									 pDmaParams->pAudUserVa,
 							audioCardBytes,
-							direction);
+							direction, false);
 			}
 
 			if (mapAudio)
@@ -1360,7 +1360,7 @@ int dmaTransfer(PDMA_PARAMS pDmaParams)
 							pAncF1PageBuffer,
 							pDmaParams->pAncF1UserVa,
 							ancF1CardBytes,
-							direction);
+							direction, false);
 			}
 			
 			if (mapAncF1)
@@ -1466,7 +1466,7 @@ int dmaTransfer(PDMA_PARAMS pDmaParams)
 							pAncF2PageBuffer,
 							pDmaParams->pAncF2UserVa,
 							ancF2CardBytes,
-							direction);
+							direction, false);
 			}
 			
 			if (mapAncF2)
@@ -2707,7 +2707,7 @@ int dmaPageRootAdd(ULWord deviceNumber, PDMA_PAGE_ROOT pRoot,
 	}
 	
 	// lock buffer 
-	ret = dmaPageLock(deviceNumber, pBuffer, pAddress, size, DMA_BIDIRECTIONAL);
+	ret = dmaPageLock(deviceNumber, pBuffer, pAddress, size, DMA_BIDIRECTIONAL, true);
 	if (ret < 0)
 	{
 		kfree(pBuffer);
@@ -2985,14 +2985,18 @@ static void dmaPageBufferRelease(ULWord deviceNumber, PDMA_PAGE_BUFFER pBuffer)
 }
 
 static int dmaPageLock(ULWord deviceNumber, PDMA_PAGE_BUFFER pBuffer,
-					   PVOID pAddress, ULWord size, ULWord direction)
+					   PVOID pAddress, ULWord size, ULWord direction, bool merge)
 {
+	NTV2PrivateParams *pNTV2Params = getNTV2Params(deviceNumber);
 	unsigned long address = (unsigned long)pAddress;
+	unsigned int maxSegLength;
 	bool write;
 	int numPages;
 	int numPinned;
 	int pageOffset;
 	int count;
+	int segLength;
+	int numSgs;
 	int i;
 
 	if ((pBuffer == NULL) || (pAddress == NULL) || (size == 0) || pBuffer->busMap)
@@ -3132,33 +3136,53 @@ static int dmaPageLock(ULWord deviceNumber, PDMA_PAGE_BUFFER pBuffer,
 	// offset on first page
 	pageOffset = (int)(address & ~PAGE_MASK);
 
-	// build scatter list
-	count = size;
-	if (numPages > 1)
+	// largest segment the device and its dma mapping (iommu, swiotlb) accept
+	maxSegLength = PAGE_SIZE;
+	if (merge)
 	{
-		sg_set_page(&pBuffer->pSgList[0], pBuffer->pPageList[0], PAGE_SIZE - pageOffset, pageOffset);
-		count -= sg_dma_len(&pBuffer->pSgList[0]);
+		maxSegLength = min_t(unsigned int, DMA_SG_SEGMENT_MAX,
+							 dma_get_max_seg_size(&(pNTV2Params->pci_dev)->dev));
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(5,1,0))
+		maxSegLength = min_t(size_t, maxSegLength,
+							 dma_max_mapping_size(&(pNTV2Params->pci_dev)->dev));
+#endif
+		if (maxSegLength < PAGE_SIZE)
+			maxSegLength = PAGE_SIZE;
+	}
 
-		for (i = 1; i < numPages; i++)
+	// build scatter list, coalescing physically contiguous pages (e.g. huge pages) of
+	// explicitly locked buffers into segments of up to maxSegLength bytes
+	count = size;
+	numSgs = 0;
+	segLength = (count < (int)(PAGE_SIZE - pageOffset)) ? count : (int)(PAGE_SIZE - pageOffset);
+	sg_set_page(&pBuffer->pSgList[0], pBuffer->pPageList[0], segLength, pageOffset);
+	count -= segLength;
+	for (i = 1; i < numPages; i++)
+	{
+		segLength = count < PAGE_SIZE ? count : PAGE_SIZE;
+		if ((page_to_pfn(pBuffer->pPageList[i]) == (page_to_pfn(pBuffer->pPageList[i - 1]) + 1)) &&
+			((pBuffer->pSgList[numSgs].length + segLength) <= maxSegLength))
 		{
-			sg_set_page(&pBuffer->pSgList[i], pBuffer->pPageList[i], count < PAGE_SIZE ? count : PAGE_SIZE, 0);
-			count -= PAGE_SIZE;
+			pBuffer->pSgList[numSgs].length += segLength;
 		}
+		else
+		{
+			numSgs++;
+			sg_set_page(&pBuffer->pSgList[numSgs], pBuffer->pPageList[i], segLength, 0);
+		}
+		count -= segLength;
 	}
-	else
-	{
-		sg_set_page(&pBuffer->pSgList[0], pBuffer->pPageList[0], count, pageOffset);
-	}
+	numSgs++;
 
 	// save parameters
 	pBuffer->pUserAddress = pAddress;
 	pBuffer->userSize = size;
 	pBuffer->direction = direction;
 	pBuffer->numPages = numPages;
-	pBuffer->numSgs = numPages;
+	pBuffer->numSgs = numSgs;
 	pBuffer->pageLock = true;
 
-	NTV2_MSG_PAGE_MAP("%s%d: dmaPageLock lock %d pages\n", DMA_MSG_DEVICE, numPages);
+	NTV2_MSG_PAGE_MAP("%s%d: dmaPageLock lock %d pages in %d segment(s)\n", DMA_MSG_DEVICE, numPages, numSgs);
 	
 	return 0;
 
@@ -24,6 +24,7 @@ struct nvidia_p2p_dma_mapping;
 #define DMA_TRANSFERCOUNT_TOHOST 			0x80000000
 #define DMA_TRANSFERCOUNT_BYTES  			4
 #define DMA_DESCRIPTOR_PAGES_MAX			1024
+#define DMA_SG_SEGMENT_MAX					0x200000	// largest coalesced host segment (one 2MB huge page)
 
 typedef enum _NTV2DmaMethod
 {
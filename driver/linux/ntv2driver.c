@@ -4955,6 +4955,10 @@ dma_registers_init (struct pci_dev *pdev, NTV2PrivateParams * ntv2pp)
 		MSG("%s: Using 32-bit DMA mask with 64-bit capable firmware\n",
 			ntv2pp->name);
 	}
+
+	// allow the segments dmaPageLock coalesces for locked buffers, which it also caps
+	// at dma_get_max_seg_size and dma_max_mapping_size in case this is not honored
+	dma_set_max_seg_size(&pdev->dev, DMA_SG_SEGMENT_MAX);
 }
 
 #if defined(AJA_HEVC)
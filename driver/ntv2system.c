@@ -53,9 +53,33 @@ bool ntv2WriteVirtualRegister(Ntv2SystemContext* context, uint32_t regNum, uint3
 
 #if defined (AJAVirtual)
 
-#ifdef AJALinux
+#include <stdarg.h>
+#include <errno.h>
+#include <time.h>
 #include <unistd.h>
-#endif
+
+static bool sMessageEnable = false;
+
+static void ntv2TimeDeadline(struct timespec* pDeadline, int64_t microseconds);
+
+// virtual message functions
+
+void ntv2MessageEnable(bool enable)
+{
+	sMessageEnable = enable;
+}
+
+void ntv2MessagePrint(const char* pFormat, ...)
+{
+	va_list args;
+
+	if(!sMessageEnable) return;
+
+	va_start(args, pFormat);
+	vprintf(pFormat, args);
+	va_end(args);
+	fflush(stdout);
+}
 
 // virtual spinlock functions
 
@@ -64,22 +88,31 @@ bool ntv2SpinLockOpen(Ntv2SpinLock* pSpinLock, Ntv2SystemContext* pSysCon)
 	if((pSpinLock == NULL) ||
 	   (pSysCon == NULL)) return false;
 
-	return false;
+	memset(pSpinLock, 0, sizeof(Ntv2SpinLock));
+
+	return pthread_mutex_init(&pSpinLock->lock, NULL) == 0;
 }
 
 void ntv2SpinLockClose(Ntv2SpinLock* pSpinLock)
 {
 	if(pSpinLock == NULL) return;
+
+	pthread_mutex_destroy(&pSpinLock->lock);
+	memset(pSpinLock, 0, sizeof(Ntv2SpinLock));
 }
 
 void ntv2SpinLockAcquire(Ntv2SpinLock* pSpinLock)
 {
 	if(pSpinLock == NULL) return;
+
+	pthread_mutex_lock(&pSpinLock->lock);
 }
 
 void ntv2SpinLockRelease(Ntv2SpinLock* pSpinLock)
 {
 	if(pSpinLock == NULL) return;
+
+	pthread_mutex_unlock(&pSpinLock->lock);
 }
 
 // virtual interrupt lock fucntions
@@ -89,22 +122,33 @@ bool ntv2InterruptLockOpen(Ntv2InterruptLock* pInterruptLock, Ntv2SystemContext*
 	if((pInterruptLock == NULL) ||
 	   (pSysCon == NULL)) return false;
 
-	return false;
+	memset(pInterruptLock, 0, sizeof(Ntv2InterruptLock));
+
+	return pthread_mutex_init(&pInterruptLock->lock, NULL) == 0;
 }
 
 void ntv2InterruptLockClose(Ntv2InterruptLock* pInterruptLock)
 {
 	if(pInterruptLock == NULL) return;
+
+	pthread_mutex_destroy(&pInterruptLock->lock);
+	memset(pInterruptLock, 0, sizeof(Ntv2InterruptLock));
 }
 
 void ntv2InterruptLockAcquire(Ntv2InterruptLock* pInterruptLock)
 {
 	if(pInterruptLock == NULL) return;
+
+	pthread_mutex_lock(&pInterruptLock->lock);
+	pInterruptLock->locked = true;
 }
 
 void ntv2InterruptLockRelease(Ntv2InterruptLock* pInterruptLock)
 {
 	if(pInterruptLock == NULL) return;
+
+	pInterruptLock->locked = false;
+	pthread_mutex_unlock(&pInterruptLock->lock);
 }
 
 // virtual memory functions
@@ -126,13 +170,22 @@ void ntv2MemoryFree(void* pAddress, uint32_t size)
 bool ntv2DmaMemoryAlloc(Ntv2DmaMemory* pDmaMemory, Ntv2SystemContext* pSysCon, uint32_t size)
 {
 	void* pAddress = NULL;
-	Ntv2DmaAddress dmaAddress = 0;
 
 	if((pDmaMemory == NULL) ||
 	   (pSysCon == NULL) ||
 	   (size == 0)) return false;
 
-	return false;
+	if(posix_memalign(&pAddress, NTV2_MEMORY_ALIGN_MAX, size) != 0) return false;
+
+	// initialize memory data structure
+	memset(pDmaMemory, 0, sizeof(Ntv2DmaMemory));
+
+	// there is no bus address in user space, so the virtual address stands in for it
+	pDmaMemory->pAddress = pAddress;
+	pDmaMemory->dmaAddress = (Ntv2DmaAddress)pAddress;
+	pDmaMemory->size = size;
+
+	return true;
 }
 
 void ntv2DmaMemoryFree(Ntv2DmaMemory* pDmaMemory)
@@ -141,27 +194,31 @@ void ntv2DmaMemoryFree(Ntv2DmaMemory* pDmaMemory)
 	   (pDmaMemory->pAddress == NULL) ||
 	   (pDmaMemory->dmaAddress == 0) ||
 	   (pDmaMemory->size == 0)) return;
+
+	free(pDmaMemory->pAddress);
+
+	memset(pDmaMemory, 0, sizeof(Ntv2DmaMemory));
 }
 
 void* ntv2DmaMemoryVirtual(Ntv2DmaMemory* pDmaMemory)
 {
 	if(pDmaMemory == NULL) return NULL;
 
-	return NULL;
+	return pDmaMemory->pAddress;
 }
 
 Ntv2DmaAddress ntv2DmaMemoryPhysical(Ntv2DmaMemory* pDmaMemory)
 {
 	if(pDmaMemory == NULL) return 0;
 
-	return (Ntv2DmaAddress)0;
+	return pDmaMemory->dmaAddress;
 }
 
 uint32_t ntv2DmaMemorySize(Ntv2DmaMemory* pDmaMemory)
 {
 	if(pDmaMemory == NULL) return 0;
 
-	return 0;
+	return pDmaMemory->size;
 }
 
 // virtual user buffer functions
@@ -193,7 +250,6 @@ void ntv2UserBufferRelease(Ntv2UserBuffer* pUserBuffer)
 bool ntv2UserBufferCopyTo(Ntv2UserBuffer* pDstBuffer, uint32_t dstOffset, void* pSrcAddress, uint32_t size)
 {
 	uint8_t* pDst;
-	int result;
 
 	if((pDstBuffer == NULL) ||
 	   (pSrcAddress == NULL) ||
@@ -213,7 +269,6 @@ bool ntv2UserBufferCopyTo(Ntv2UserBuffer* pDstBuffer, uint32_t dstOffset, void*
 bool ntv2UserBufferCopyFrom(Ntv2UserBuffer* pSrcBuffer, uint32_t srcOffset, void* pDstAddress, uint32_t size)
 {
 	uint8_t* pSrc;
-	int result;
 
 	if((pSrcBuffer == NULL) ||
 	   (pDstAddress == NULL) ||
@@ -239,7 +294,10 @@ bool ntv2DpcOpen(Ntv2Dpc* pDpc, Ntv2SystemContext* pSysCon, Ntv2DpcTask* pDpcTas
 	// initialize dpc data structure
 	memset(pDpc, 0, sizeof(Ntv2Dpc));
 
-	return false;
+	pDpc->pTask = pDpcTask;
+	pDpc->data = dpcData;
+
+	return true;
 }
 
 void ntv2DpcClose(Ntv2Dpc* pDpc)
@@ -252,7 +310,11 @@ void ntv2DpcClose(Ntv2Dpc* pDpc)
 
 void ntv2DpcSchedule(Ntv2Dpc* pDpc)
 {
-	if(pDpc == NULL) return;
+	if((pDpc == NULL) ||
+	   (pDpc->pTask == NULL)) return;
+
+	// no deferred context in user space, so run the task now
+	(*pDpc->pTask)(pDpc->data);
 }
 
 // virtual event functions
@@ -265,38 +327,67 @@ bool ntv2EventOpen(Ntv2Event* pEvent, Ntv2SystemContext* pSysCon)
 	// initialize event data structure
 	memset(pEvent, 0, sizeof(Ntv2Event));
 
-	return false;
+	if(pthread_mutex_init(&pEvent->mutex, NULL) != 0) return false;
+	if(pthread_cond_init(&pEvent->cond, NULL) != 0)
+	{
+		pthread_mutex_destroy(&pEvent->mutex);
+		return false;
+	}
+
+	return true;
 }
 
 void ntv2EventClose(Ntv2Event* pEvent)
 {
 	if(pEvent == NULL) return;
+
+	pthread_cond_destroy(&pEvent->cond);
+	pthread_mutex_destroy(&pEvent->mutex);
+
+	// initialize event data structure
+	memset(pEvent, 0, sizeof(Ntv2Event));
 }
 
 void ntv2EventSignal(Ntv2Event* pEvent)
 {
 	if(pEvent == NULL) return;
+
+	pthread_mutex_lock(&pEvent->mutex);
+	pEvent->flag = true;
+	pthread_cond_broadcast(&pEvent->cond);
+	pthread_mutex_unlock(&pEvent->mutex);
 }
 
 void ntv2EventClear(Ntv2Event* pEvent)
 {
 	if(pEvent == NULL) return;
+
+	pthread_mutex_lock(&pEvent->mutex);
+	pEvent->flag = false;
+	pthread_mutex_unlock(&pEvent->mutex);
 }
 
 bool ntv2EventWaitForSignal(Ntv2Event* pEvent, int64_t timeout, bool alert)
 {
+	struct timespec deadline;
 	int result = 0;
-	uint32_t jifout;
+	bool signaled;
 
 	if(pEvent == NULL) return false;
 
-#if defined (MSWindows)
-    Sleep(timeout/1000);
-#elif defined (AJALinux)
-    usleep(timeout);
-#endif
+	(void)alert;
+	ntv2TimeDeadline(&deadline, timeout);
 
-	return false;
+	// wait for signal
+	pthread_mutex_lock(&pEvent->mutex);
+	while(!pEvent->flag && (result != ETIMEDOUT))
+	{
+		result = pthread_cond_timedwait(&pEvent->cond, &pEvent->mutex, &deadline);
+	}
+	signaled = pEvent->flag;
+	pthread_mutex_unlock(&pEvent->mutex);
+
+	return signaled;
 }
 
 // virtual semaphore functions
@@ -310,35 +401,70 @@ bool ntv2SemaphoreOpen(Ntv2Semaphore* pSemaphore, Ntv2SystemContext* pSysCon, ui
 	// initialize semaphore data structure
 	memset(pSemaphore, 0, sizeof(Ntv2Semaphore));
 
-	return false;
+	if(pthread_mutex_init(&pSemaphore->mutex, NULL) != 0) return false;
+	if(pthread_cond_init(&pSemaphore->cond, NULL) != 0)
+	{
+		pthread_mutex_destroy(&pSemaphore->mutex);
+		return false;
+	}
+	pSemaphore->count = count;
+
+	return true;
 }
 
 void ntv2SemaphoreClose(Ntv2Semaphore* pSemaphore)
 {
 	if(pSemaphore == NULL) return;
 
+	pthread_cond_destroy(&pSemaphore->cond);
+	pthread_mutex_destroy(&pSemaphore->mutex);
+
 	// initialize semaphore data structure
 	memset(pSemaphore, 0, sizeof(Ntv2Semaphore));
 }
 
 bool ntv2SemaphoreDown(Ntv2Semaphore* pSemaphore, int64_t timeout)
 {
-	uint32_t jifout;
-	int result;
+	struct timespec deadline;
+	int result = 0;
+	bool acquired = false;
 
 	if(pSemaphore == NULL) return false;
 
-	return false;
+	ntv2TimeDeadline(&deadline, timeout);
+
+	// wait for our turn
+	pthread_mutex_lock(&pSemaphore->mutex);
+	while((pSemaphore->count == 0) && (result != ETIMEDOUT))
+	{
+		result = pthread_cond_timedwait(&pSemaphore->cond, &pSemaphore->mutex, &deadline);
+	}
+	if(pSemaphore->count > 0)
+	{
+		pSemaphore->count--;
+		acquired = true;
+	}
+	pthread_mutex_unlock(&pSemaphore->mutex);
+
+	return acquired;
 }
 
 void ntv2SemaphoreUp(Ntv2Semaphore* pSemaphore)
 {
 	if(pSemaphore == NULL) return;
+
+	pthread_mutex_lock(&pSemaphore->mutex);
+	pSemaphore->count++;
+	pthread_cond_signal(&pSemaphore->cond);
+	pthread_mutex_unlock(&pSemaphore->mutex);
 }
 
 int64_t ntv2TimeCounter(void)
 {
-	return 0;
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (((int64_t)ts.tv_sec * 1000000) + (ts.tv_nsec / 1000));
 }
 
 int64_t ntv2TimeFrequency(void)
@@ -348,16 +474,31 @@ int64_t ntv2TimeFrequency(void)
 
 int64_t ntv2Time100ns(void)
 {
-	return 0;
+	struct timespec ts;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	return (((int64_t)ts.tv_sec * 10000000) + (ts.tv_nsec / 100));
 }
 
 void ntv2TimeSleep(int64_t microseconds)
 {
-	if(microseconds == 0) return;
+	if(microseconds <= 0) return;
+
+	usleep((useconds_t)microseconds);
+}
 
-#ifdef AJALinux
-    usleep(microseconds);
-#endif    
+static void ntv2TimeDeadline(struct timespec* pDeadline, int64_t microseconds)
+{
+	clock_gettime(CLOCK_REALTIME, pDeadline);
+	if(microseconds < 0) microseconds = 0;
+
+	pDeadline->tv_sec += (time_t)(microseconds / 1000000);
+	pDeadline->tv_nsec += (long)((microseconds % 1000000) * 1000);
+	if(pDeadline->tv_nsec >= 1000000000)
+	{
+		pDeadline->tv_sec++;
+		pDeadline->tv_nsec -= 1000000000;
+	}
 }
 
 bool ntv2ThreadOpen(Ntv2Thread* pThread, Ntv2SystemContext* pSysCon, const char* pName)
@@ -365,7 +506,7 @@ bool ntv2ThreadOpen(Ntv2Thread* pThread, Ntv2SystemContext* pSysCon, const char*
 	if((pThread == NULL) ||
 	   (pSysCon == NULL)) return false;
 
-	// initialize semaphore data structure
+	// initialize thread data structure
 	memset(pThread, 0, sizeof(Ntv2Thread));
 
 	pThread->pName = pName;
@@ -386,13 +527,13 @@ void ntv2ThreadClose(Ntv2Thread* pThread)
 	memset(pThread, 0, sizeof(Ntv2Thread));
 }
 
-int ntv2ThreadFunc(void* pData)
+static void* ntv2ThreadFunc(void* pData)
 {
 	Ntv2Thread* pThread = (Ntv2Thread*)pData;
 
 	(*pThread->pFunc)(pThread->pContext);
 
-	return 0;
+	return NULL;
 }
 
 bool ntv2ThreadRun(Ntv2Thread* pThread, Ntv2ThreadTask* pTask, void* pContext)
@@ -404,11 +545,18 @@ bool ntv2ThreadRun(Ntv2Thread* pThread, Ntv2ThreadTask* pTask, void* pContext)
 
 	pThread->pFunc = pTask;
 	pThread->pContext = pContext;
+	pThread->stop = false;
 	pThread->run = true;
 
-    (pTask)(pContext);
+	if(pthread_create(&pThread->thread, NULL, ntv2ThreadFunc, (void*)pThread) != 0)
+	{
+		pThread->pFunc = NULL;
+		pThread->pContext = NULL;
+		pThread->run = false;
+		return false;
+	}
 
-	return false;
+	return true;
 }
 
 void ntv2ThreadStop(Ntv2Thread* pThread)
@@ -418,6 +566,9 @@ void ntv2ThreadStop(Ntv2Thread* pThread)
 	if(!pThread->run) return;
 	pThread->run = false;
 
+	pThread->stop = true;
+	pthread_join(pThread->thread, NULL);
+
 	pThread->pFunc = NULL;
 	pThread->pContext = NULL;
 }
@@ -434,13 +585,12 @@ const char* ntv2ThreadGetName(Ntv2Thread* pThread)
 
 bool ntv2ThreadShouldStop(Ntv2Thread* pThread)
 {
-	return false;
+	if(pThread == NULL) return true;
+	return pThread->stop;
 }
 
 Ntv2Status ntv2ReadPciConfig(Ntv2SystemContext* pSysCon, void* pData, int32_t offset, int32_t size)
 {
-	int status;
-	
 	if ((pSysCon == NULL) || (pData == NULL))
 		return NTV2_STATUS_BAD_PARAMETER;
 	
@@ -449,8 +599,6 @@ Ntv2Status ntv2ReadPciConfig(Ntv2SystemContext* pSysCon, void* pData, int32_t of
 
 Ntv2Status ntv2WritePciConfig(Ntv2SystemContext* pSysCon, void* pData, int32_t offset, int32_t size)
 {
-	int status;
-	
 	if ((pSysCon == NULL)  || (pData == NULL))
 		return NTV2_STATUS_BAD_PARAMETER;
 	
@@ -22,12 +22,15 @@
 
 #if defined(AJAVirtual)
 
+	// virtual (user-space) system headers
+
 	#include <stdbool.h>
 	#include <stddef.h>
 	#include <stdint.h>
 	#include <string.h>
 	#include <stdio.h>
 	#include <stdlib.h>
+	#include <pthread.h>
 
 	#include "ajatypes.h"
 
@@ -55,7 +58,8 @@
 
 	typedef struct ntv2_system_context
 	{
-        PVOID pDevice;
+		uint32_t			devNum;				// device number
+		PVOID				pDevice;			// virtual device (register file owner)
 	} Ntv2SystemContext;
 
 	// virtual register abstraction
@@ -65,22 +69,25 @@
 	//MRBILL	#define ntv2WriteRegister32(reg, value)		
 	//MRBILL	#define ntv2ReadRegister32(reg)				
 
-	// virtual message abstraction
+	// virtual message abstraction (quiet unless enabled, so benchmarks are not dominated by printf)
 
-	#define ntv2Message(string, ...) 			printf(string, __VA_ARGS__); fflush(stdout)
+	void		ntv2MessageEnable(bool enable);
+	void		ntv2MessagePrint(const char* pFormat, ...);
+	#define ntv2Message(string, ...) 			ntv2MessagePrint(string, __VA_ARGS__)
 
 	// virtual spinlock abstraction
 
 	typedef struct ntv2_spinlock
 	{
- 		uint32_t dummy;
+		pthread_mutex_t		lock;
 	} Ntv2SpinLock;
 
 	// virtual interrupt lock abstraction
 
 	typedef struct ntv2_interrupt_lock
 	{
-		uint32_t dummy;
+		pthread_mutex_t		lock;
+		bool				locked;
 	} Ntv2InterruptLock;
 
 	// virtual memory abstraction
@@ -102,28 +109,33 @@
 		bool				write;
 	} Ntv2UserBuffer;
 
-	// virtual dpc task abstraction
+	// virtual dpc task abstraction (runs synchronously when scheduled)
 
 	typedef unsigned long 	Ntv2DpcData;
 	typedef void Ntv2DpcTask(Ntv2DpcData data);
 
 	typedef struct ntv2_dpc
 	{
-		uint32_t dummy;
+		Ntv2DpcTask*		pTask;
+		Ntv2DpcData			data;
 	} Ntv2Dpc;
 
 	// virtual event abstraction
 
 	typedef struct ntv2_event
 	{
-		uint32_t dummy;
+		pthread_mutex_t		mutex;
+		pthread_cond_t		cond;
+		bool				flag;
 	} Ntv2Event;
 
 	// virtual semaphore abstraction
 
 	typedef struct ntv2_semaphore
 	{
-		uint32_t dummy;
+		pthread_mutex_t		mutex;
+		pthread_cond_t		cond;
+		uint32_t			count;
 	} Ntv2Semaphore;
 
 	// virtual thread abstraction
@@ -132,9 +144,11 @@
 	typedef struct ntv2_thread
 	{
 		const char*			pName;
+		pthread_t			thread;
 		Ntv2ThreadTask*		pFunc;				
 		void*				pContext;
 		bool				run;
+		volatile bool		stop;
 	} Ntv2Thread;
 
 //endif	//	defined(AJAVirtual)
@@ -0,0 +1,255 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (C) 2004 - 2022 AJA Video Systems, Inc.
+ */
+//========================================================================
+//
+//  ntv2acbench.c
+//
+//	Replays vertical interrupts and AutoCirculateTransfer calls against the
+//	portable driver core on a virtual device, and reports the per-call cost
+//	of AutoCirculate() and AutoCirculateFindNextAvailFrame().
+//
+//==========================================================================
+
+#include "ntv2virtualdevice.h"
+#include "ntv2kona.h"
+
+#include <time.h>
+#include <unistd.h>
+
+#define BENCH_MAX_CIRCULATORS		16
+
+typedef struct bench_stage
+{
+	const char*		pName;
+	uint64_t		count;
+	int64_t			totalNs;
+	int64_t			minNs;
+	int64_t			maxNs;
+} BenchStage;
+
+typedef struct bench_options
+{
+	uint32_t		numCirculators;			// outputs first, then inputs
+	uint32_t		numInterrupts;
+	uint32_t		framesPerCirculator;
+	uint32_t		transfersPerInterrupt;
+	uint32_t		videoBytes;
+	NTV2DeviceID	deviceID;
+	bool			verbose;
+} BenchOptions;
+
+static int64_t benchNow(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((int64_t)ts.tv_sec * 1000000000) + ts.tv_nsec;
+}
+
+static void benchStageInit(BenchStage* pStage, const char* pName)
+{
+	memset(pStage, 0, sizeof(BenchStage));
+	pStage->pName = pName;
+	pStage->minNs = INT64_MAX;
+}
+
+static void benchStageAdd(BenchStage* pStage, int64_t ns)
+{
+	pStage->count++;
+	pStage->totalNs += ns;
+	if (ns < pStage->minNs) pStage->minNs = ns;
+	if (ns > pStage->maxNs) pStage->maxNs = ns;
+}
+
+static void benchStagePrint(const BenchStage* pStage)
+{
+	if (pStage->count == 0)
+	{
+		printf("%-28s %12s\n", pStage->pName, "-");
+		return;
+	}
+	printf("%-28s %12llu %12.1f %10lld %10lld\n", pStage->pName,
+		   (unsigned long long)pStage->count,
+		   (double)pStage->totalNs / (double)pStage->count,
+		   (long long)pStage->minNs, (long long)pStage->maxNs);
+}
+
+static NTV2Crosspoint benchCrosspoint(uint32_t index)
+{
+	return (index < NTV2_MAX_NUM_CHANNELS) ? GetNTV2CrosspointChannelForIndex(index)
+										   : GetNTV2CrosspointInputForIndex(index - NTV2_MAX_NUM_CHANNELS);
+}
+
+static void benchUsage(const char* pProgram)
+{
+	printf("usage: %s [-c circulators] [-n interrupts] [-f frames] [-t transfers] [-b videobytes] [-d deviceid] [-v]\n", pProgram);
+	printf("  -c  number of circulators, 1-%d (outputs 1-8, then inputs 1-8; default 16)\n", BENCH_MAX_CIRCULATORS);
+	printf("  -n  vertical interrupts to replay (default 100000)\n");
+	printf("  -f  frames per circulator (default 7)\n");
+	printf("  -t  AutoCirculateTransfer calls per circulator per interrupt (default 1)\n");
+	printf("  -b  video bytes per transfer (default 1920x1080 8-bit YCbCr)\n");
+	printf("  -d  device id in hex (default Corvid 88)\n");
+	printf("  -v  print driver messages\n");
+}
+
+int main(int argc, char* argv[])
+{
+	BenchOptions options;
+	BenchStage interruptStage, autoCirculateStage, findNextStage, transferStage;
+	Ntv2VirtualDevice* pDevice;
+	NTV2AutoCirc* pAutoCirc;
+	AUTOCIRCULATE_TRANSFER transfer;
+	AUTOCIRCULATE_STATUS status;
+	NTV2Crosspoint crosspoints[BENCH_MAX_CIRCULATORS];
+	uint64_t framesProcessed = 0;
+	uint64_t framesDropped = 0;
+	uint8_t* pVideo;
+	uint32_t i, vbi, xfer;
+	int64_t start, t0, t1, wall;
+	int opt;
+
+	memset(&options, 0, sizeof(options));
+	options.numCirculators = BENCH_MAX_CIRCULATORS;
+	options.numInterrupts = 100000;
+	options.framesPerCirculator = 7;
+	options.transfersPerInterrupt = 1;
+	options.videoBytes = 1920 * 1080 * 2;
+	options.deviceID = DEVICE_ID_CORVID88;
+
+	while ((opt = getopt(argc, argv, "c:n:f:t:b:d:vh")) != -1)
+	{
+		switch (opt)
+		{
+		case 'c':	options.numCirculators = (uint32_t)strtoul(optarg, NULL, 0);		break;
+		case 'n':	options.numInterrupts = (uint32_t)strtoul(optarg, NULL, 0);		break;
+		case 'f':	options.framesPerCirculator = (uint32_t)strtoul(optarg, NULL, 0);	break;
+		case 't':	options.transfersPerInterrupt = (uint32_t)strtoul(optarg, NULL, 0);	break;
+		case 'b':	options.videoBytes = (uint32_t)strtoul(optarg, NULL, 0);			break;
+		case 'd':	options.deviceID = (NTV2DeviceID)strtoul(optarg, NULL, 16);		break;
+		case 'v':	options.verbose = true;												break;
+		default:	benchUsage(argv[0]);												return 2;
+		}
+	}
+	if ((options.numCirculators < 1) || (options.numCirculators > BENCH_MAX_CIRCULATORS) ||
+		(options.framesPerCirculator < 2) ||
+		((options.numCirculators * options.framesPerCirculator) > MAX_FRAMEBUFFERS))
+	{
+		benchUsage(argv[0]);
+		return 2;
+	}
+	ntv2MessageEnable(options.verbose);
+
+	pDevice = ntv2VirtualDeviceOpen(options.deviceID, 0);
+	pVideo = (uint8_t*)ntv2MemoryAlloc(options.videoBytes ? options.videoBytes : 1);
+	if ((pDevice == NULL) || (pVideo == NULL))
+	{
+		fprintf(stderr, "## ERROR: out of memory\n");
+		ntv2MemoryFree(pVideo, options.videoBytes);
+		ntv2VirtualDeviceClose(pDevice);
+		return 1;
+	}
+	pAutoCirc = pDevice->pAutoCirc;
+
+	benchStageInit(&interruptStage, "interrupt (all circulators)");
+	benchStageInit(&autoCirculateStage, "AutoCirculate");
+	benchStageInit(&findNextStage, "AutoCirculateFindNextAvail");
+	benchStageInit(&transferStage, "AutoCirculateTransfer");
+
+	memset(&transfer, 0, sizeof(transfer));
+	transfer.acDesiredFrame = -1;
+	transfer.acFrameRepeatCount = 1;
+	transfer.acVideoBuffer.fUserSpacePtr = (ULWord64)(uintptr_t)pVideo;
+	transfer.acVideoBuffer.fByteCount = options.videoBytes;
+
+	// initialize, preroll playout, then start every circulator
+	for (i = 0; i < options.numCirculators; i++)
+	{
+		int32_t startFrame = (int32_t)(i * options.framesPerCirculator);
+		int32_t endFrame = startFrame + (int32_t)options.framesPerCirculator - 1;
+		crosspoints[i] = benchCrosspoint(i);
+		if (AutoCirculateInit(pAutoCirc, crosspoints[i], startFrame, endFrame, NTV2_AUDIOSYSTEM_1, 1,
+							  false, false, false, false, false, false, false, false, false, false) != NTV2_STATUS_SUCCESS)
+		{
+			fprintf(stderr, "## ERROR: AutoCirculateInit failed for circulator %u\n", i);
+			ntv2MemoryFree(pVideo, options.videoBytes);
+			ntv2VirtualDeviceClose(pDevice);
+			return 1;
+		}
+		if (NTV2_IS_OUTPUT_CROSSPOINT(crosspoints[i]))
+		{
+			transfer.acCrosspoint = crosspoints[i];
+			for (xfer = 0; xfer + 1 < options.framesPerCirculator; xfer++)
+				AutoCirculateTransfer(pAutoCirc, &transfer);
+		}
+		AutoCirculateStart(pAutoCirc, crosspoints[i], 0);
+	}
+
+	// replay interrupts on the simulated frame clock, each followed by the client transfers that would run in that frame time
+	start = benchNow();
+	for (vbi = 0; vbi < options.numInterrupts; vbi++)
+	{
+		int64_t isrStart = benchNow();
+		int32_t isrTimeStamp;
+		ntv2VirtualDeviceVerticalBlank(pDevice);
+		isrTimeStamp = ntv2VirtualDeviceInterruptTime(pDevice);
+		for (i = 0; i < options.numCirculators; i++)
+		{
+			t0 = benchNow();
+			AutoCirculate(pAutoCirc, crosspoints[i], isrTimeStamp);
+			t1 = benchNow();
+			benchStageAdd(&autoCirculateStage, t1 - t0);
+		}
+		benchStageAdd(&interruptStage, benchNow() - isrStart);
+
+		for (i = 0; i < options.numCirculators; i++)
+		{
+			INTERNAL_AUTOCIRCULATE_STRUCT* pAuto = &pAutoCirc->autoCirculate[crosspoints[i]];
+			transfer.acCrosspoint = crosspoints[i];
+			for (xfer = 0; xfer < options.transfersPerInterrupt; xfer++)
+			{
+				t0 = benchNow();
+				AutoCirculateFindNextAvailFrame(pAuto);
+				t1 = benchNow();
+				benchStageAdd(&findNextStage, t1 - t0);
+
+				t0 = benchNow();
+				AutoCirculateTransfer(pAutoCirc, &transfer);
+				t1 = benchNow();
+				benchStageAdd(&transferStage, t1 - t0);
+			}
+		}
+	}
+	wall = benchNow() - start;
+
+	for (i = 0; i < options.numCirculators; i++)
+	{
+		memset(&status, 0, sizeof(status));
+		status.acCrosspoint = crosspoints[i];
+		if (AutoCirculateGetStatus(pAutoCirc, &status) == NTV2_STATUS_SUCCESS)
+		{
+			framesProcessed += status.acFramesProcessed;
+			framesDropped += status.acFramesDropped;
+		}
+		AutoCirculateStop(pAutoCirc, crosspoints[i]);
+	}
+	// stopping takes effect on the next interrupt
+	ntv2VirtualDeviceInterrupt(pDevice);
+
+	printf("device %08X, %u circulators x %u frames, %u interrupts, %u transfer(s) per interrupt\n",
+		   (uint32_t)options.deviceID, options.numCirculators, options.framesPerCirculator,
+		   options.numInterrupts, options.transfersPerInterrupt);
+	printf("%-28s %12s %12s %10s %10s\n", "stage", "calls", "avg ns", "min ns", "max ns");
+	benchStagePrint(&interruptStage);
+	benchStagePrint(&autoCirculateStage);
+	benchStagePrint(&findNextStage);
+	benchStagePrint(&transferStage);
+	printf("frames processed %llu, dropped %llu, dma calls %llu (%llu bytes), wall %.3f s (%.0f interrupts/s)\n",
+		   (unsigned long long)framesProcessed, (unsigned long long)framesDropped,
+		   (unsigned long long)pDevice->dmaCount, (unsigned long long)pDevice->dmaBytes,
+		   (double)wall / 1e9, wall ? (double)options.numInterrupts * 1e9 / (double)wall : 0.0);
+
+	ntv2MemoryFree(pVideo, options.videoBytes);
+	ntv2VirtualDeviceClose(pDevice);
+	return 0;
+}
@@ -0,0 +1,285 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (C) 2004 - 2022 AJA Video Systems, Inc.
+ */
+//========================================================================
+//
+//  ntv2virtualdevice.c
+//
+//==========================================================================
+
+#include "ntv2virtualdevice.h"
+#include "ntv2autofunc.h"
+#include "ntv2video.h"
+
+static const uint32_t	gChannelToGlobalControlRegNum []	= {	kRegGlobalControl, kRegGlobalControlCh2, kRegGlobalControlCh3, kRegGlobalControlCh4,
+																kRegGlobalControlCh5, kRegGlobalControlCh6, kRegGlobalControlCh7, kRegGlobalControlCh8};
+
+// field id bits read by IsFieldID0 for outputs 1-8 and inputs 1-8
+#define NTV2_VIRTUAL_STATUS_FIELD_BITS		(BIT_23 | BIT_21 | BIT_19 | BIT_5 | BIT_3 | BIT_1)
+#define NTV2_VIRTUAL_STATUS2_FIELD_BITS		(BIT_21 | BIT_19 | BIT_17 | BIT_15 | BIT_13 | BIT_11 | BIT_9 | BIT_7 | BIT_5 | BIT_3)
+
+static uint32_t* ntv2VirtualRegisterAddress(Ntv2SystemContext* context, uint32_t regNum)
+{
+	Ntv2VirtualDevice* pDevice;
+
+	if((context == NULL) ||
+	   (context->pDevice == NULL)) return NULL;
+
+	pDevice = (Ntv2VirtualDevice*)context->pDevice;
+	if(regNum < NTV2_VIRTUAL_NUM_REGISTERS)
+		return &pDevice->pRegisters[regNum];
+	if((regNum >= VIRTUALREG_START) &&
+	   (regNum < (VIRTUALREG_START + MAX_NUM_VIRTUAL_REGISTERS)))
+		return &pDevice->pVirtualRegisters[regNum - VIRTUALREG_START];
+
+	return NULL;
+}
+
+static uint32_t ntv2VirtualAudioSamplesPerFrame(NTV2FrameRate frameRate)
+{
+	switch(frameRate)
+	{
+	case NTV2_FRAMERATE_12000:
+	case NTV2_FRAMERATE_11988:	return 400;
+	case NTV2_FRAMERATE_5000:	return 960;
+	case NTV2_FRAMERATE_4800:
+	case NTV2_FRAMERATE_4795:	return 1000;
+	case NTV2_FRAMERATE_3000:
+	case NTV2_FRAMERATE_2997:	return 1600;
+	case NTV2_FRAMERATE_2500:	return 1920;
+	case NTV2_FRAMERATE_2400:
+	case NTV2_FRAMERATE_2398:	return 2000;
+	default:					break;
+	}
+	return 800;
+}
+
+// register access used by ntv2system.c
+
+uint32_t ntv2ReadRegCon32(Ntv2SystemContext* context, uint32_t regNum)
+{
+	uint32_t* pReg = ntv2VirtualRegisterAddress(context, regNum);
+	if (pReg == NULL) return 0;
+	return *pReg;
+}
+
+bool ntv2ReadRegMSCon32(Ntv2SystemContext* context, uint32_t regNum, uint32_t* regValue, uint32_t regMask, uint32_t regShift)
+{
+	uint32_t* pReg = ntv2VirtualRegisterAddress(context, regNum);
+	if ((pReg == NULL) || (regValue == NULL)) return false;
+	*regValue = (*pReg & regMask) >> regShift;
+	return true;
+}
+
+bool ntv2WriteRegCon32(Ntv2SystemContext* context, uint32_t regNum, uint32_t regValue)
+{
+	uint32_t* pReg = ntv2VirtualRegisterAddress(context, regNum);
+	if (pReg == NULL) return false;
+	*pReg = regValue;
+	return true;
+}
+
+bool ntv2WriteRegMSCon32(Ntv2SystemContext* context, uint32_t regNum, uint32_t regValue, uint32_t regMask, uint32_t regShift)
+{
+	uint32_t* pReg = ntv2VirtualRegisterAddress(context, regNum);
+	if (pReg == NULL) return false;
+	*pReg = (*pReg & ~regMask) | ((regValue << regShift) & regMask);
+	return true;
+}
+
+uint32_t ntv2ReadVirtRegCon32(Ntv2SystemContext* context, uint32_t regNum)
+{
+	return ntv2ReadRegCon32(context, regNum);
+}
+
+bool ntv2WriteVirtRegCon32(Ntv2SystemContext* context, uint32_t regNum, uint32_t data)
+{
+	return ntv2WriteRegCon32(context, regNum, data);
+}
+
+// autocirculate hooks used by ntv2autocirc.c
+
+Ntv2Status AutoDmaTransfer(void* pContext, PAUTO_DMA_PARAMS pDmaParams)
+{
+	Ntv2VirtualDevice* pDevice = (Ntv2VirtualDevice*)pContext;
+	uint32_t numSegments;
+
+	if ((pDevice == NULL) || (pDmaParams == NULL))
+		return NTV2_STATUS_BAD_PARAMETER;
+
+	// account for the transfer, the simulated board has no frame memory to move it to
+	numSegments = (pDmaParams->numSegments > 1) ? pDmaParams->numSegments : 1;
+	pDevice->dmaCount++;
+	if (pDmaParams->pVidUserVa != NULL)
+		pDevice->dmaBytes += (uint64_t)pDmaParams->vidNumBytes * numSegments;
+	if (pDmaParams->pAudUserVa != NULL)
+		pDevice->dmaBytes += pDmaParams->audNumBytes;
+	if (pDmaParams->pAncF1UserVa != NULL)
+		pDevice->dmaBytes += pDmaParams->ancF1NumBytes;
+	if (pDmaParams->pAncF2UserVa != NULL)
+		pDevice->dmaBytes += pDmaParams->ancF2NumBytes;
+
+	return NTV2_STATUS_SUCCESS;
+}
+
+int64_t AutoGetAudioClock(void* pContext)
+{
+	Ntv2VirtualDevice* pDevice = (Ntv2VirtualDevice*)pContext;
+	if (pDevice == NULL) return 0;
+	return pDevice->audioClock;
+}
+
+bool AutoBoardCanDoP2P(void* pContext)
+{
+	(void)pContext;
+	return false;
+}
+
+uint64_t AutoGetFrameAperturePhysicalAddress(void* pContext)
+{
+	(void)pContext;
+	return 0;
+}
+
+uint32_t AutoGetFrameApertureBaseSize(void* pContext)
+{
+	(void)pContext;
+	return 0;
+}
+
+void AutoWriteFrameApertureOffset(void* pContext, uint32_t value)
+{
+	(void)pContext;
+	(void)value;
+}
+
+uint64_t AutoGetMessageAddress(void* pContext, NTV2Channel channel)
+{
+	(void)pContext;
+	(void)channel;
+	return 0;
+}
+
+// virtual device
+
+Ntv2VirtualDevice* ntv2VirtualDeviceOpen(NTV2DeviceID deviceID, uint32_t devNum)
+{
+	Ntv2VirtualDevice* pDevice;
+	uint32_t xpt;
+
+	pDevice = (Ntv2VirtualDevice*)ntv2MemoryAlloc(sizeof(Ntv2VirtualDevice));
+	if (pDevice == NULL)
+		return NULL;
+	memset(pDevice, 0, sizeof(Ntv2VirtualDevice));
+
+	pDevice->pRegisters = (uint32_t*)ntv2MemoryAlloc(NTV2_VIRTUAL_NUM_REGISTERS * sizeof(uint32_t));
+	pDevice->pVirtualRegisters = (uint32_t*)ntv2MemoryAlloc(MAX_NUM_VIRTUAL_REGISTERS * sizeof(uint32_t));
+	pDevice->pAutoCirc = (NTV2AutoCirc*)ntv2MemoryAlloc(sizeof(NTV2AutoCirc));
+	if ((pDevice->pRegisters == NULL) ||
+		(pDevice->pVirtualRegisters == NULL) ||
+		(pDevice->pAutoCirc == NULL))
+	{
+		ntv2VirtualDeviceClose(pDevice);
+		return NULL;
+	}
+	memset(pDevice->pRegisters, 0, NTV2_VIRTUAL_NUM_REGISTERS * sizeof(uint32_t));
+	memset(pDevice->pVirtualRegisters, 0, MAX_NUM_VIRTUAL_REGISTERS * sizeof(uint32_t));
+	memset(pDevice->pAutoCirc, 0, sizeof(NTV2AutoCirc));
+
+	pDevice->systemContext.devNum = devNum;
+	pDevice->systemContext.pDevice = pDevice;
+	pDevice->deviceID = deviceID;
+
+	ntv2WriteRegister(&pDevice->systemContext, kRegBoardID, (uint32_t)deviceID);
+	ntv2WriteRegisterMS(&pDevice->systemContext, kRegGlobalControl2, 1, kRegMaskIndependentMode, kRegShiftIndependentMode);
+	ntv2VirtualDeviceSetVideo(pDevice, NTV2_STANDARD_1080p, NTV2_FG_1920x1080, NTV2_FRAMERATE_6000);
+
+	pDevice->pAutoCirc->pSysCon = &pDevice->systemContext;
+	pDevice->pAutoCirc->pFunCon = pDevice;
+	pDevice->pAutoCirc->deviceID = deviceID;
+	pDevice->pAutoCirc->syncChannel1 = NTV2CROSSPOINT_FGKEY;
+	pDevice->pAutoCirc->syncChannel2 = NTV2CROSSPOINT_FGKEY;
+	for (xpt = 0; xpt < NUM_CIRCULATORS; xpt++)
+	{
+		if (!ILLEGAL_CHANNELSPEC(xpt))
+			AutoCirculateReset(pDevice->pAutoCirc, (NTV2Crosspoint)xpt);
+	}
+
+	return pDevice;
+}
+
+void ntv2VirtualDeviceClose(Ntv2VirtualDevice* pDevice)
+{
+	if (pDevice == NULL)
+		return;
+
+	ntv2MemoryFree(pDevice->pAutoCirc, sizeof(NTV2AutoCirc));
+	ntv2MemoryFree(pDevice->pVirtualRegisters, MAX_NUM_VIRTUAL_REGISTERS * sizeof(uint32_t));
+	ntv2MemoryFree(pDevice->pRegisters, NTV2_VIRTUAL_NUM_REGISTERS * sizeof(uint32_t));
+	ntv2MemoryFree(pDevice, sizeof(Ntv2VirtualDevice));
+}
+
+void ntv2VirtualDeviceSetVideo(Ntv2VirtualDevice* pDevice, NTV2Standard standard,
+							   NTV2FrameGeometry geometry, NTV2FrameRate frameRate)
+{
+	Ntv2SystemContext* pSysCon;
+	uint32_t i;
+
+	if (pDevice == NULL)
+		return;
+
+	pSysCon = &pDevice->systemContext;
+	for (i = 0; i < NTV2_MAX_NUM_CHANNELS; i++)
+	{
+		ntv2WriteRegisterMS(pSysCon, gChannelToGlobalControlRegNum[i], (uint32_t)standard, kRegMaskStandard, kRegShiftStandard);
+		ntv2WriteRegisterMS(pSysCon, gChannelToGlobalControlRegNum[i], (uint32_t)geometry, kRegMaskGeometry, kRegShiftGeometry);
+		ntv2WriteRegisterMS(pSysCon, gChannelToGlobalControlRegNum[i], (uint32_t)frameRate, kRegMaskFrameRate, kRegShiftFrameRate);
+	}
+	pDevice->frameRate = frameRate;
+}
+
+void ntv2VirtualDeviceVerticalBlank(Ntv2VirtualDevice* pDevice)
+{
+	if (pDevice == NULL)
+		return;
+
+	pDevice->pRegisters[kRegStatus] ^= NTV2_VIRTUAL_STATUS_FIELD_BITS;
+	pDevice->pRegisters[kRegStatus2] ^= NTV2_VIRTUAL_STATUS2_FIELD_BITS;
+	pDevice->audioClock += ntv2VirtualAudioSamplesPerFrame(pDevice->frameRate);
+	pDevice->interruptTime += GetFramePeriod(&pDevice->systemContext, NTV2_CHANNEL1);
+	pDevice->vbiCount++;
+}
+
+int32_t ntv2VirtualDeviceInterruptTime(Ntv2VirtualDevice* pDevice)
+{
+	if (pDevice == NULL)
+		return 0;
+
+	return (int32_t)(pDevice->interruptTime & INT32_MAX);
+}
+
+void ntv2VirtualDeviceInterrupt(Ntv2VirtualDevice* pDevice)
+{
+	int32_t isrTimeStamp;
+	uint32_t xpt;
+
+	if (pDevice == NULL)
+		return;
+
+	ntv2VirtualDeviceVerticalBlank(pDevice);
+	isrTimeStamp = ntv2VirtualDeviceInterruptTime(pDevice);
+	for (xpt = 0; xpt < NUM_CIRCULATORS; xpt++)
+	{
+		if (ntv2VirtualDeviceCirculating(pDevice, (NTV2Crosspoint)xpt))
+			AutoCirculate(pDevice->pAutoCirc, (NTV2Crosspoint)xpt, isrTimeStamp);
+	}
+}
+
+bool ntv2VirtualDeviceCirculating(Ntv2VirtualDevice* pDevice, NTV2Crosspoint channelSpec)
+{
+	if ((pDevice == NULL) || ILLEGAL_CHANNELSPEC(channelSpec))
+		return false;
+
+	return pDevice->pAutoCirc->autoCirculate[channelSpec].state != NTV2_AUTOCIRCULATE_DISABLED;
+}
@@ -0,0 +1,59 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (C) 2004 - 2022 AJA Video Systems, Inc.
+ */
+//========================================================================
+//
+//  ntv2virtualdevice.h
+//
+//	User-space stand-in for an NTV2 board, used to run the portable driver
+//	core (ntv2autocirc.c, ntv2stream.c, ntv2anc.c, ntv2vpid.c ...) without
+//	a kernel module. Registers live in memory, DMA is accounted but not
+//	performed, and vertical interrupts are replayed by the caller.
+//
+//==========================================================================
+
+#ifndef NTV2VIRTUALDEVICE_H
+#define NTV2VIRTUALDEVICE_H
+
+#include "ntv2system.h"
+#include "ntv2autocirc.h"
+
+#define NTV2_VIRTUAL_NUM_REGISTERS		0x40000		// covers the register space touched by the driver core
+
+typedef struct ntv2_virtual_device
+{
+	Ntv2SystemContext	systemContext;			// handed to every driver core call
+	NTV2DeviceID		deviceID;				// reported in kRegBoardID
+	uint32_t*			pRegisters;				// simulated register file
+	uint32_t*			pVirtualRegisters;		// simulated virtual registers
+	NTV2AutoCirc*		pAutoCirc;				// autocirculate state owned by this device
+	NTV2FrameRate		frameRate;				// rate used to advance the audio clock
+	int64_t				audioClock;				// simulated 48 kHz sample clock
+	int64_t				interruptTime;			// simulated 100 ns clock, one frame period per vertical blank
+	uint64_t			vbiCount;				// vertical interrupts replayed
+	uint64_t			dmaCount;				// AutoDmaTransfer calls
+	uint64_t			dmaBytes;				// bytes those calls would have moved
+} Ntv2VirtualDevice;
+
+// Creates a device reporting deviceID, with every channel in independent mode and 1080p60.
+Ntv2VirtualDevice*	ntv2VirtualDeviceOpen(NTV2DeviceID deviceID, uint32_t devNum);
+void				ntv2VirtualDeviceClose(Ntv2VirtualDevice* pDevice);
+
+// Programs standard, geometry and rate into every channel's global control register.
+void				ntv2VirtualDeviceSetVideo(Ntv2VirtualDevice* pDevice, NTV2Standard standard,
+											  NTV2FrameGeometry geometry, NTV2FrameRate frameRate);
+
+// Hardware side of one vertical blank: toggles the field IDs and advances the audio and interrupt clocks.
+void				ntv2VirtualDeviceVerticalBlank(Ntv2VirtualDevice* pDevice);
+
+// Interrupt time stamp for AutoCirculate, wraps like the 32-bit hardware time stamp.
+int32_t				ntv2VirtualDeviceInterruptTime(Ntv2VirtualDevice* pDevice);
+
+// Replays one vertical interrupt: the hardware side, then AutoCirculate for every enabled circulator.
+void				ntv2VirtualDeviceInterrupt(Ntv2VirtualDevice* pDevice);
+
+// True when the circulator on channelSpec is not disabled.
+bool				ntv2VirtualDeviceCirculating(Ntv2VirtualDevice* pDevice, NTV2Crosspoint channelSpec);
+
+#endif	//	NTV2VIRTUALDEVICE_H
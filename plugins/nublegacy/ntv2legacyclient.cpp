@@ -432,7 +432,8 @@ class AJAExport NTV2LegacyNubClient : public NTV2RPCClientAPI
 														_sockfd				(-1),
 														_remoteHandle		(INVALID_NUB_HANDLE),
 														_nubProtocolVersion	(ntv2NubProtocolVersionNone),
-														_remoteIndex		(0)								{}
+														_remoteIndex		(0),
+														_nextRequestID		(1)								{}
 		AJA_VIRTUAL									~NTV2LegacyNubClient()			{NTV2CloseRemote();}
 		AJA_VIRTUAL	inline bool						IsConnected	(void) const		{return SocketValid()  &&  HandleValid();}
 		AJA_VIRTUAL inline AJASocket				Socket (void) const				{return _sockfd;}
@@ -466,6 +467,11 @@ class AJAExport NTV2LegacyNubClient : public NTV2RPCClientAPI
 		AJA_VIRTUAL int			OpenRemoteDeviceWithIndex (const UWord inDeviceIndex);
 		AJA_VIRTUAL	bool		NTV2CloseRemote (void);
 		AJA_VIRTUAL	inline		ULWord	ConnectionID (void) const		{return 0;}
+		AJA_VIRTUAL	inline bool	CanFrame (void) const			{return ProtocolVersion() >= ntv2NubProtocolVersion4;}
+		AJA_VIRTUAL	int			SendFrame (const ULWord inOpcode, const ULWord inRequestID, const void * pInPayload, const ULWord inPayloadLength);
+		AJA_VIRTUAL	int			RecvFrameHeader (const ULWord inRequestID, NTV2NubFrameHeader & outHeader, const int inTimeoutSecs = 2);
+		AJA_VIRTUAL	int			RecvFrame (const ULWord inRequestID, NTV2NubFrameHeader & outHeader, std::vector<char> & outPayload, const int inTimeoutSecs = 2);
+		AJA_VIRTUAL	int			TransactRegisters (const bool inIsRead, NTV2RegInfo * pInOutRegs, const ULWord inNumRegs, ULWord & outFailedNdx);
 
 	//	Instance Data
 	private:
@@ -473,6 +479,7 @@ class AJAExport NTV2LegacyNubClient : public NTV2RPCClientAPI
 		LWord					_remoteHandle;			///< @brief	Remote host handle
 		NTV2NubProtocolVersion	_nubProtocolVersion;	///< @brief	Protocol version
 		UWord					_remoteIndex;			///< @brief	Remote device index number
+		ULWord					_nextRequestID;			///< @brief	Next framed request ID (protocol version 4)
 		string					_name;					///< @brief	User-friendly name
 };	//	NTV2LegacyNubClient
 
@@ -531,6 +538,7 @@ bool NTV2LegacyNubClient::NTV2OpenRemote (void)
 	}
 	if (retval < 0)
 		return false;
+	::setnodelay(Socket());
 
 	retval = OpenRemoteDeviceWithIndex(inDeviceIndexNum);
 	switch (retval)
@@ -665,6 +673,128 @@ bool NTV2LegacyNubClient::NTV2CloseRemote (void)
 }
 
 
+int NTV2LegacyNubClient::SendFrame (const ULWord inOpcode, const ULWord inRequestID, const void * pInPayload, const ULWord inPayloadLength)
+{
+	NTV2NubFrameHeader hdr;
+	hdr.magic			= NTV2_NUB_FRAME_MAGIC;
+	hdr.opcode			= inOpcode;
+	hdr.requestID		= inRequestID;
+	hdr.handle			= Handle();
+	hdr.status			= NTV2_REMOTE_ACCESS_SUCCESS;
+	hdr.payloadLength	= inPayloadLength;
+	if (::sendframe(Socket(), hdr, pInPayload) == -1)
+		{NBFAIL("'sendframe' failed, socket=" << Socket() << ", opcode=" << inOpcode << ", request=" << inRequestID << ": " << ::strerror(errno));  return NTV2_REMOTE_ACCESS_SEND_ERR;}
+	return NTV2_REMOTE_ACCESS_SUCCESS;
+}
+
+
+int NTV2LegacyNubClient::RecvFrameHeader (const ULWord inRequestID, NTV2NubFrameHeader & outHeader, const int inTimeoutSecs)
+{
+	while (true)
+	{
+		char * p (reinterpret_cast<char*>(&outHeader));
+		int numbytes (::recvtimeout_sec(Socket(), p, sizeof(outHeader), inTimeoutSecs));
+		switch (numbytes)
+		{
+			case  0:	NBFAIL("'recvtimeout_sec' returned zero bytes:  remote access connection closed");
+						return NTV2_REMOTE_ACCESS_CONNECTION_CLOSED;
+
+			case -1:	NBFAIL("'recvtimeout_sec' failed on socket " << Socket() << ": " << ::strerror(errno));
+						return NTV2_REMOTE_ACCESS_RECV_ERR;
+
+			case -2:	NBFAIL("'recvtimeout_sec' timed out on socket " << Socket() << " waiting for request " << inRequestID);
+						return NTV2_REMOTE_ACCESS_TIMEDOUT;
+
+			default:	break;
+		}
+		const int rc (::recvframeheader(Socket(), outHeader, numbytes));
+		if (rc == RECVFRAME_BAD_FRAME)
+			{NBFAIL("Non-nub frame on NTV2 port, socket=" << Socket());  return NTV2_REMOTE_ACCESS_NON_NUB_PKT;}
+		if (rc == -1)
+			{NBFAIL("'recvframeheader' failed on socket " << Socket() << ": " << ::strerror(errno));  return NTV2_REMOTE_ACCESS_RECV_ERR;}
+		if (outHeader.requestID == inRequestID)
+			return NTV2_REMOTE_ACCESS_SUCCESS;
+
+		// Left over from an earlier request that failed part way -- count it and discard it.
+		++gIgnoredNTV2pkts;
+		NBWARN("Discarding frame for request " << outHeader.requestID << " while awaiting " << inRequestID << ", " << gIgnoredNTV2pkts << " ignored pkts");
+		vector<char> junk(outHeader.payloadLength);
+		int len (int(outHeader.payloadLength));
+		if (len  &&  ::recvall(Socket(), &junk[0], &len) == -1)
+			{NBFAIL("'recvall' failed on socket " << Socket() << ": " << ::strerror(errno));  return NTV2_REMOTE_ACCESS_RECV_ERR;}
+	}
+}
+
+
+int NTV2LegacyNubClient::RecvFrame (const ULWord inRequestID, NTV2NubFrameHeader & outHeader, vector<char> & outPayload, const int inTimeoutSecs)
+{
+	int retcode (RecvFrameHeader(inRequestID, outHeader, inTimeoutSecs));
+	if (retcode != NTV2_REMOTE_ACCESS_SUCCESS)
+		return retcode;
+	outPayload.resize(outHeader.payloadLength);
+	int len (int(outHeader.payloadLength));
+	if (len  &&  ::recvall(Socket(), &outPayload[0], &len) == -1)
+		{NBFAIL("'recvall' failed on socket " << Socket() << ": " << ::strerror(errno));  return NTV2_REMOTE_ACCESS_RECV_ERR;}
+	return NTV2_REMOTE_ACCESS_SUCCESS;
+}
+
+
+//	Sends every batch before reading any response, so the whole set costs a single round trip.
+int NTV2LegacyNubClient::TransactRegisters (const bool inIsRead, NTV2RegInfo * pInOutRegs, const ULWord inNumRegs, ULWord & outFailedNdx)
+{
+	static const ULWord kMaxRegsPerFrame ((NTV2_NUB_FRAME_MAX_PAYLOAD - sizeof(NTV2NubRegistersPayloadHeader)) / sizeof(NTV2RegInfo));
+	const ULWord opcode (inIsRead ? eNubFrameReadRegisters : eNubFrameWriteRegisters);
+	const ULWord firstRequestID (_nextRequestID);
+	ULWord numFrames (0);
+	vector<char> payload;
+	outFailedNdx = inNumRegs;
+
+	for (ULWord ndx(0);  ndx < inNumRegs;  ndx += kMaxRegsPerFrame, numFrames++)
+	{
+		const ULWord numRegs (NTV2_CPP_MIN(kMaxRegsPerFrame, inNumRegs - ndx));
+		::EncodeNubRegistersPayload(payload, pInOutRegs + ndx, numRegs, /*withValues*/!inIsRead);
+		const int retcode (SendFrame(opcode, _nextRequestID++, &payload[0], ULWord(payload.size())));
+		if (retcode != NTV2_REMOTE_ACCESS_SUCCESS)
+			return retcode;
+	}
+
+	int retcode (NTV2_REMOTE_ACCESS_SUCCESS);
+	for (ULWord frame(0), ndx(0);  frame < numFrames;  frame++, ndx += kMaxRegsPerFrame)
+	{
+		const ULWord numRegs (NTV2_CPP_MIN(kMaxRegsPerFrame, inNumRegs - ndx));
+		NTV2NubFrameHeader hdr;
+		const int rc (RecvFrame(firstRequestID + frame, hdr, payload));
+		if (rc != NTV2_REMOTE_ACCESS_SUCCESS)
+			return rc;	//	Any responses still in flight are discarded by the next transaction
+		const size_t respSize (sizeof(NTV2NubRegistersPayloadHeader) + (inIsRead ? numRegs * sizeof(NTV2RegInfo) : 0));
+		if (hdr.status != NTV2_REMOTE_ACCESS_SUCCESS  &&  payload.size() < sizeof(NTV2NubRegistersPayloadHeader))
+		{	//	e.g. NTV2_REMOTE_ACCESS_NO_CARD
+			if (retcode == NTV2_REMOTE_ACCESS_SUCCESS)
+				{retcode = hdr.status;  outFailedNdx = ndx;}
+			continue;
+		}
+		if (payload.size() != respSize)
+			{NBFAIL("Response to request " << hdr.requestID << " has " << payload.size() << " bytes, expected " << respSize);  return NTV2_REMOTE_ACCESS_NON_NUB_PKT;}
+
+		const NTV2NubRegistersPayloadHeader * pHdr (reinterpret_cast<const NTV2NubRegistersPayloadHeader*>(&payload[0]));
+		const ULWord whichFailed (NTV2_CPP_MIN(numRegs, ULWord(ntohl(pHdr->whichRegisterFailed))));
+		if (hdr.status != NTV2_REMOTE_ACCESS_SUCCESS  &&  retcode == NTV2_REMOTE_ACCESS_SUCCESS)
+			{retcode = hdr.status;  outFailedNdx = ndx + whichFailed;}
+		if (inIsRead)
+		{
+			NTV2RegisterReads regs;
+			ULWord unused (0);
+			if (!::DecodeNubRegistersPayload(payload, regs, unused)  ||  regs.size() != numRegs)
+				{NBFAIL("Response to request " << hdr.requestID << " has " << regs.size() << " registers, expected " << numRegs);  return NTV2_REMOTE_ACCESS_NON_NUB_PKT;}
+			const ULWord numGood (hdr.status == NTV2_REMOTE_ACCESS_SUCCESS ? numRegs : whichFailed);
+			for (ULWord n(0);  n < numGood;  n++)
+				pInOutRegs[ndx+n].registerValue = regs[n].registerValue;
+		}
+	}
+	return retcode;
+}	//	TransactRegisters
+
+
 bool NTV2LegacyNubClient::NTV2ReadRegisterRemote (const ULWord regNum, ULWord & outRegValue, const ULWord regMask, const ULWord regShift)
 {
 	outRegValue = 0;
@@ -1293,6 +1423,13 @@ bool NTV2LegacyNubClient::NTV2ReadRegisterMultiRemote	(const ULWord numRegs, ULW
 	if (!numRegs)
 		return true;	//	Nothing to do
 	// Connected?
+	if (CanFrame())
+	{	//	Protocol version 4 has no NTV2_NUB_NUM_MULTI_REGS limit
+		ULWord failedNdx (numRegs);
+		const int retcode (TransactRegisters(/*isRead*/true, outRegs, numRegs, failedNdx));
+		outFailedRegNum = failedNdx < numRegs ? outRegs[failedNdx].registerNumber : 0;
+		return retcode == NTV2_REMOTE_ACCESS_SUCCESS;
+	}
 
 	// Construct open query
 	NTV2NubPkt *pPkt (BuildReadRegisterMultiQueryPacket (Handle(),  _nubProtocolVersion,  numRegs,  outRegs));
@@ -1418,11 +1555,78 @@ bool NTV2LegacyNubClient::NTV2DMATransferRemote(	const NTV2DMAEngine inDMAEngine
 											const ULWord inCardOffsetBytes,		const ULWord inNumSegments,
 											const ULWord inSegmentHostPitch,	const ULWord inSegmentCardPitch,
 											const bool inSynchronous)
-{
+{	(void) inSynchronous;	//	Remote transfers are always synchronous
 	if (!IsConnected())
 		return false;	//	No connection
-	return false;
-}
+	if (!CanFrame())
+		{NBWARN("DMA needs nub protocol " << ntv2NubProtocolVersion4 << ", remote speaks " << ProtocolVersion());  return false;}
+	const ULWord byteCount (inOutBuffer.GetByteCount());
+	if (!inOutBuffer  ||  byteCount > NTV2_NUB_DMA_MAX_BYTES  ||  inNumSegments > byteCount)
+		{NBFAIL("Bad DMA buffer " << inOutBuffer.AsString() << ", numSegments=" << inNumSegments);  return false;}
+
+	//	Segments travel packed -- the host pitch is applied here
+	const bool		segmented	(inNumSegments > 1);
+	const ULWord	segBytes	(segmented ? byteCount / inNumSegments : byteCount);
+	const ULWord	xferBytes	(segmented ? segBytes * inNumSegments : byteCount);
+	NTV2Buffer		packed;
+	NTV2SegmentedXferInfo hostSegs;
+	hostSegs.setSegmentInfo(inNumSegments, segBytes);
+	if (segmented)
+	{
+		if (!packed.Allocate(xferBytes))
+			{NBFAIL("Failed to allocate " << xferBytes << "-byte DMA buffer");  return false;}
+		if (!inIsRead)
+			if (!packed.CopyFrom(inOutBuffer, hostSegs.setSourceInfo(0, inSegmentHostPitch).setDestInfo(0, segBytes)))
+				{NBFAIL("Failed to pack " << inNumSegments << " segments");  return false;}
+	}
+	NTV2Buffer & wire (segmented ? packed : inOutBuffer);
+
+	NTV2NubDMAPayload dma;
+	dma.dmaEngine			= htonl(ULWord(inDMAEngine));
+	dma.isRead				= htonl(inIsRead ? 1 : 0);
+	dma.frameNumber			= htonl(inFrameNumber);
+	dma.cardOffsetBytes		= htonl(inCardOffsetBytes);
+	dma.byteCount			= htonl(xferBytes);
+	dma.numSegments			= htonl(segmented ? inNumSegments : 0);
+	dma.segmentCardPitch	= htonl(inSegmentCardPitch);
+	const ULWord requestID (_nextRequestID++);
+	int retcode (SendFrame(eNubFrameDMATransfer, requestID, &dma, sizeof(dma)));
+
+	//	Writes stream the data right behind the request...
+	for (ULWord offset(0), chunk(0);  !inIsRead  &&  retcode == NTV2_REMOTE_ACCESS_SUCCESS  &&  offset < xferBytes;  offset += chunk)
+	{
+		chunk = NTV2_CPP_MIN(ULWord(NTV2_NUB_DMA_CHUNK_SIZE), xferBytes - offset);
+		retcode = SendFrame(eNubFrameDMAData, requestID, wire.GetHostAddress(offset), chunk);
+	}
+
+	//	...reads get it streamed back ahead of the response
+	NTV2NubFrameHeader hdr;
+	ULWord received (0);
+	while (retcode == NTV2_REMOTE_ACCESS_SUCCESS)
+	{
+		retcode = RecvFrameHeader(requestID, hdr);
+		if (retcode != NTV2_REMOTE_ACCESS_SUCCESS  ||  hdr.opcode != eNubFrameDMAData)
+			break;
+		if (!inIsRead  ||  hdr.payloadLength > xferBytes - received)
+			{NBFAIL("Unexpected " << hdr.payloadLength << "-byte DMA data frame, " << received << " of " << xferBytes << " bytes received");  retcode = NTV2_REMOTE_ACCESS_NON_NUB_PKT;  break;}
+		int len (int(hdr.payloadLength));
+		if (::recvall(Socket(), reinterpret_cast<char*>(wire.GetHostAddress(received)), &len) == -1)
+			{NBFAIL("'recvall' failed on socket " << Socket() << ": " << ::strerror(errno));  retcode = NTV2_REMOTE_ACCESS_RECV_ERR;  break;}
+		received += hdr.payloadLength;
+	}
+	if (retcode != NTV2_REMOTE_ACCESS_SUCCESS)
+		return false;
+	if (hdr.opcode != eNubFrameDMATransfer  ||  hdr.payloadLength)
+		{NBFAIL("Expected DMA response for request " << requestID << ", got opcode " << hdr.opcode);  return false;}
+	if (hdr.status != NTV2_REMOTE_ACCESS_SUCCESS)
+		{NBFAIL("DMA " << (inIsRead ? "read" : "write") << " of frame " << inFrameNumber << " failed on remote side, status " << hdr.status);  return false;}
+	if (inIsRead  &&  received != xferBytes)
+		{NBFAIL("DMA read of frame " << inFrameNumber << " returned " << received << " of " << xferBytes << " bytes");  return false;}
+	if (segmented  &&  inIsRead)
+		if (!inOutBuffer.CopyFrom(packed, hostSegs.setSourceInfo(0, segBytes).setDestInfo(0, inSegmentHostPitch)))
+			{NBFAIL("Failed to unpack " << inNumSegments << " segments");  return false;}
+	return true;
+}	//	NTV2DMATransferRemote
 
 bool NTV2LegacyNubClient::NTV2MessageRemote (NTV2_HEADER *	pInMessage)
 {
@@ -1430,7 +1634,41 @@ bool NTV2LegacyNubClient::NTV2MessageRemote (NTV2_HEADER *	pInMessage)
 		return false;	//	Not connected
 	if (!pInMessage)
 		return false;	//	NULL message pointer
-	return false;	//	TBD
+
+	switch (pInMessage->GetType())
+	{
+		case NTV2_TYPE_SETREGS:
+		{	NTV2SetRegisters & setRegs (*AsNTV2SetRegs(pInMessage));
+			NTV2RegInfo * pRegInfos (setRegs.mInRegInfos);
+			UWord * pBadNdxs (setRegs.mOutBadRegIndexes);
+			if (!pRegInfos  ||  !pBadNdxs
+				||  setRegs.mInRegInfos.GetByteCount() < setRegs.mInNumRegisters * sizeof(NTV2RegInfo)
+				||  setRegs.mOutBadRegIndexes.GetByteCount() < setRegs.mInNumRegisters * sizeof(UWord))
+					return false;
+			setRegs.mOutNumFailures = 0;
+			if (!CanFrame())
+			{	//	Older servers only know single-register writes
+				for (ULWord n(0);  n < setRegs.mInNumRegisters;  n++)
+					if (!NTV2WriteRegisterRemote(pRegInfos[n].registerNumber, pRegInfos[n].registerValue,
+												pRegInfos[n].registerMask, pRegInfos[n].registerShift))
+						pBadNdxs[setRegs.mOutNumFailures++] = UWord(n);
+				return true;
+			}
+			//	Batched register writes travel as a register frame
+			ULWord failedNdx (setRegs.mInNumRegisters);
+			const int retcode (setRegs.mInNumRegisters ? TransactRegisters(/*isRead*/false, pRegInfos, setRegs.mInNumRegisters, failedNdx)
+														: NTV2_REMOTE_ACCESS_SUCCESS);
+			if (retcode == NTV2_REMOTE_ACCESS_WRITE_REG_FAILED)
+				for (ULWord n(failedNdx);  n < setRegs.mInNumRegisters;  n++)	//	Assume the rest failed, too
+					pBadNdxs[setRegs.mOutNumFailures++] = UWord(n);
+			return retcode == NTV2_REMOTE_ACCESS_SUCCESS  ||  retcode == NTV2_REMOTE_ACCESS_WRITE_REG_FAILED;
+		}
+
+		default:
+			break;
+	}
+	NBWARN("Message type " << xHEX0N(pInMessage->GetType(),8) << " unsupported by nub protocol " << ProtocolVersion());
+	return false;
 }
 
 ostream & NTV2LegacyNubClient::Print (ostream & oss) const
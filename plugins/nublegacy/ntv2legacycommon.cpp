@@ -14,6 +14,7 @@
 	#include <sys/socket.h>
 	#include <netinet/in.h>
 	#include <arpa/inet.h>
+	#include <netinet/tcp.h>
 	#include <sys/time.h>
 	#include <netdb.h>
 #elif defined(MSWindows)
@@ -289,6 +290,129 @@ int sendall (AJASocket s, char * buf, int * len)
 } 
 
 
+int recvall (AJASocket s, char * buf, int * len)
+{
+	const int wanted = *len;
+	int total = 0;		  // how many bytes we've received
+	int bytesleft = *len; // how many we have left to receive
+	int n = -1;
+
+	while (total < wanted)
+	{
+		n = int(::recv(s, buf+total, size_t(bytesleft), 0));
+		if (n <= 0) break;	// error or remote side hung up
+		total += n;
+		bytesleft -= n;
+	}
+	*len = total; // return number actually received here
+	return total < wanted ? -1 : 0; // return -1 on failure or hang-up, 0 on success
+}
+
+
+// Put frame header in network byte order
+void NBOifyNTV2NubFrameHeader (NTV2NubFrameHeader & inOutHeader)
+{
+	inOutHeader.magic			= htonl(inOutHeader.magic);
+	inOutHeader.opcode			= htonl(inOutHeader.opcode);
+	inOutHeader.requestID		= htonl(inOutHeader.requestID);
+	inOutHeader.handle			= LWord(htonl(ULWord(inOutHeader.handle)));
+	inOutHeader.status			= LWord(htonl(ULWord(inOutHeader.status)));
+	inOutHeader.payloadLength	= htonl(inOutHeader.payloadLength);
+}
+
+
+// Put frame header in host byte order
+void deNBOifyNTV2NubFrameHeader (NTV2NubFrameHeader & inOutHeader)
+{
+	inOutHeader.magic			= ntohl(inOutHeader.magic);
+	inOutHeader.opcode			= ntohl(inOutHeader.opcode);
+	inOutHeader.requestID		= ntohl(inOutHeader.requestID);
+	inOutHeader.handle			= LWord(ntohl(ULWord(inOutHeader.handle)));
+	inOutHeader.status			= LWord(ntohl(ULWord(inOutHeader.status)));
+	inOutHeader.payloadLength	= ntohl(inOutHeader.payloadLength);
+}
+
+
+// Send a frame header (given in host byte order) followed by its payload
+int sendframe (AJASocket s, const NTV2NubFrameHeader & inHeader, const void * pPayload)
+{
+	NTV2NubFrameHeader hdr(inHeader);
+	const int payloadLen (int(inHeader.payloadLength));
+	NBOifyNTV2NubFrameHeader(hdr);
+	int len (int(sizeof(hdr)));
+	if (sendall(s, reinterpret_cast<char*>(&hdr), &len) == -1)
+		return -1;
+	if (!payloadLen)
+		return 0;
+	if (!pPayload)
+		return -1;
+	len = payloadLen;
+	return sendall(s, reinterpret_cast<char*>(const_cast<void*>(pPayload)), &len);
+}
+
+
+// Receive a frame header and put it in host byte order.  The first 'inBytesAlreadyRead' bytes of
+// 'outHeader' must already hold what was read of it (still in network byte order).
+// Returns 0 on success, -1 on failure or hang-up, or RECVFRAME_BAD_FRAME if it isn't a valid frame.
+int recvframeheader (AJASocket s, NTV2NubFrameHeader & outHeader, const int inBytesAlreadyRead)
+{
+	int len (int(sizeof(outHeader)) - inBytesAlreadyRead);
+	if (len > 0  &&  recvall(s, reinterpret_cast<char*>(&outHeader) + inBytesAlreadyRead, &len) == -1)
+		return -1;
+	deNBOifyNTV2NubFrameHeader(outHeader);
+	if (outHeader.magic != NTV2_NUB_FRAME_MAGIC  ||  outHeader.payloadLength > NTV2_NUB_FRAME_MAX_PAYLOAD)
+		return RECVFRAME_BAD_FRAME;
+	return 0;
+}
+
+
+// Build a register frame payload in network byte order.  Register values are sent as zero unless 'inWithValues'.
+void EncodeNubRegistersPayload (std::vector<char> & outPayload, const NTV2RegInfo * pInRegs, const ULWord inNumRegs,
+								const bool inWithValues, const ULWord inWhichRegisterFailed)
+{
+	outPayload.resize(sizeof(NTV2NubRegistersPayloadHeader) + size_t(inNumRegs) * sizeof(NTV2RegInfo));
+	NTV2NubRegistersPayloadHeader * pHdr (reinterpret_cast<NTV2NubRegistersPayloadHeader*>(&outPayload[0]));
+	NTV2RegInfo * pRegs (reinterpret_cast<NTV2RegInfo*>(&outPayload[sizeof(NTV2NubRegistersPayloadHeader)]));
+	pHdr->numRegs				= htonl(inNumRegs);
+	pHdr->whichRegisterFailed	= htonl(inWhichRegisterFailed);
+	for (ULWord n(0);  n < inNumRegs;  n++)
+	{
+		pRegs[n].registerNumber	= htonl(pInRegs[n].registerNumber);
+		pRegs[n].registerValue	= htonl(inWithValues ? pInRegs[n].registerValue : 0);
+		pRegs[n].registerMask	= htonl(pInRegs[n].registerMask);
+		pRegs[n].registerShift	= htonl(pInRegs[n].registerShift);
+	}
+}
+
+
+// Parse a register frame payload into host byte order.  Fails if its size doesn't match its register count.
+bool DecodeNubRegistersPayload (const std::vector<char> & inPayload, NTV2RegisterReads & outRegs, ULWord & outWhichRegisterFailed)
+{
+	outRegs.clear();
+	if (inPayload.size() < sizeof(NTV2NubRegistersPayloadHeader))
+		return false;
+	const NTV2NubRegistersPayloadHeader * pHdr (reinterpret_cast<const NTV2NubRegistersPayloadHeader*>(&inPayload[0]));
+	const ULWord numRegs (ntohl(pHdr->numRegs));
+	if (inPayload.size() != sizeof(NTV2NubRegistersPayloadHeader) + size_t(numRegs) * sizeof(NTV2RegInfo))
+		return false;
+	const NTV2RegInfo * pRegs (reinterpret_cast<const NTV2RegInfo*>(&inPayload[sizeof(NTV2NubRegistersPayloadHeader)]));
+	outRegs.reserve(numRegs);
+	for (ULWord n(0);  n < numRegs;  n++)
+		outRegs.push_back(NTV2RegInfo(ntohl(pRegs[n].registerNumber), ntohl(pRegs[n].registerValue),
+										ntohl(pRegs[n].registerMask), ntohl(pRegs[n].registerShift)));
+	outWhichRegisterFailed = ntohl(pHdr->whichRegisterFailed);
+	return true;
+}
+
+
+// Framed requests are small and often pipelined, so don't let Nagle hold them back
+void setnodelay (AJASocket s)
+{
+	int yes (1);
+	::setsockopt(s, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<char*>(&yes), sizeof(yes));
+}
+
+
 int recvtimeout_sec (AJASocket s, char * buf, int len, int timeout)
 {
 	fd_set fds;
@@ -50,6 +50,9 @@
 #define NTV2_REMOTE_ACCESS_DRIVER_GET_BUILD_INFO_FAILED		-25
 #define NTV2_REMOTE_ACCESS_NOT_DRIVER_GET_BUILD_INFO		-26
 #define NTV2_REMOTE_ACCESS_UNIMPLEMENTED					-27
+#define NTV2_REMOTE_ACCESS_WRITE_REG_FAILED					-28
+#define NTV2_REMOTE_ACCESS_DMA_TRANSFER_FAILED				-29
+#define NTV2_REMOTE_ACCESS_BAD_REQUEST						-30
 
 
 typedef ULWord NTV2NubProtocolVersion;
@@ -58,7 +61,8 @@ const ULWord ntv2NubProtocolVersionNone = 0;
 const ULWord ntv2NubProtocolVersion1 = 1;
 const ULWord ntv2NubProtocolVersion2 = 2;
 const ULWord ntv2NubProtocolVersion3 = 3;	// Added get buildinfo
-const ULWord maxKnownProtocolVersion = 3;
+const ULWord ntv2NubProtocolVersion4 = 4;	// Added framed, pipelined requests and bulk DMA
+const ULWord maxKnownProtocolVersion = 4;
 
 typedef enum
 {
@@ -271,6 +275,69 @@ typedef struct
 
 
 
+/**
+	Protocol version 4 framing
+	--------------------------
+	The open query/response is unchanged, and negotiates the protocol version. If both ends know
+	version 4, the client sends its requests as framed messages on the same connection. (The server
+	still accepts legacy packets, telling them apart by their first word.)
+
+	Every frame is an NTV2NubFrameHeader followed by 'payloadLength' bytes of payload, all in network
+	byte order. The client picks a unique request ID for each request, and the server echoes it in the
+	response, so a client can have many requests in flight. The server answers requests in the order
+	it receives them.
+
+	DMA data travels in eNubFrameDMAData frames of up to NTV2_NUB_DMA_CHUNK_SIZE bytes that carry the
+	request ID of their eNubFrameDMATransfer request:
+	-	Writes:  the client sends the request, then the data frames. The server transfers once it has
+				all of the data, then responds.
+	-	Reads:   the server transfers, sends the data frames, then responds.
+	Segmented transfers send only the segment data, packed. The client applies the host pitch.
+**/
+#define NTV2_NUB_FRAME_MAGIC		0x6E756234					// 'nub4' -- never a legacy protocol version
+#define NTV2_NUB_DMA_CHUNK_SIZE		(1024 * 1024)				// Max payload of one eNubFrameDMAData frame
+#define NTV2_NUB_DMA_MAX_BYTES		(512 * 1024 * 1024)			// Max byte count of one DMA transfer
+#define NTV2_NUB_FRAME_MAX_PAYLOAD	(NTV2_NUB_DMA_CHUNK_SIZE)	// Also bounds register batches (64K regs)
+
+typedef enum
+{
+	eNubFrameReadRegisters		= 1,	// Payload: NTV2NubRegistersPayloadHeader + NTV2RegInfo[numRegs]
+	eNubFrameWriteRegisters		= 2,	// Query: NTV2NubRegistersPayloadHeader + NTV2RegInfo[numRegs];  response: NTV2NubRegistersPayloadHeader
+	eNubFrameAutoCirculate		= 3,	// Query: NTV2ControlAutoCircPayload;  response: NTV2GetAutoCircPayload (eGetAutoCirc only)
+	eNubFrameWaitForInterrupt	= 4,	// Query: NTV2WaitForInterruptPayload;  response: none
+	eNubFrameDMATransfer		= 5,	// Query: NTV2NubDMAPayload;  response: none
+	eNubFrameDMAData			= 6,	// Payload: up to NTV2_NUB_DMA_CHUNK_SIZE bytes of DMA data
+	eNumNubFrameOpcodes
+} NTV2NubFrameOpcode;
+
+typedef struct
+{
+	ULWord	magic;			// Always NTV2_NUB_FRAME_MAGIC
+	ULWord	opcode;			// Actually enum: NTV2NubFrameOpcode
+	ULWord	requestID;		// Chosen by client, echoed by server
+	LWord	handle;			// Session cookie from the open response
+	LWord	status;			// Response only: NTV2_REMOTE_ACCESS_SUCCESS or an NTV2_REMOTE_ACCESS_xxx error
+	ULWord	payloadLength;	// Number of payload bytes that follow
+} NTV2NubFrameHeader;
+
+typedef struct
+{
+	ULWord	numRegs;				// Number of NTV2RegInfo's that follow
+	ULWord	whichRegisterFailed;	// Response only: index of first failed register, if any
+} NTV2NubRegistersPayloadHeader;
+
+typedef struct
+{
+	ULWord	dmaEngine;			// Actually enum: NTV2DMAEngine
+	ULWord	isRead;				// Actually a bool
+	ULWord	frameNumber;
+	ULWord	cardOffsetBytes;
+	ULWord	byteCount;			// Total bytes transferred (and streamed)
+	ULWord	numSegments;		// Zero or one for a contiguous transfer
+	ULWord	segmentCardPitch;
+} NTV2NubDMAPayload;
+
+
 extern AJAExport const char *NTV2NubQueryRespStrProtVer1[eNumNTV2NubPktTypes];
 extern AJAExport const char *NTV2NubQueryRespStrProtVer2[eNumNTV2NubPktTypes];
 
@@ -295,11 +362,21 @@ AJAExport bool NBOifyNTV2NubPkt (NTV2NubPkt * pPkt);
 AJAExport bool deNBOifyNTV2NubPkt (NTV2NubPkt * pPkt, ULWord size);
 AJAExport bool isNTV2NubPacketType (NTV2NubPkt * pPkt, NTV2NubPktType nubPktType);
 AJAExport int sendall (AJASocket s, char * buf, int * len);
+AJAExport int recvall (AJASocket s, char * buf, int * len);
+AJAExport int sendframe (AJASocket s, const NTV2NubFrameHeader & inHeader, const void * pPayload);
+AJAExport int recvframeheader (AJASocket s, NTV2NubFrameHeader & outHeader, const int inBytesAlreadyRead = 0);
+AJAExport void EncodeNubRegistersPayload (std::vector<char> & outPayload, const NTV2RegInfo * pInRegs, const ULWord inNumRegs,
+											const bool inWithValues, const ULWord inWhichRegisterFailed = 0);
+AJAExport bool DecodeNubRegistersPayload (const std::vector<char> & inPayload, NTV2RegisterReads & outRegs, ULWord & outWhichRegisterFailed);
+AJAExport void NBOifyNTV2NubFrameHeader (NTV2NubFrameHeader & inOutHeader);
+AJAExport void deNBOifyNTV2NubFrameHeader (NTV2NubFrameHeader & inOutHeader);
+AJAExport void setnodelay (AJASocket s);
 AJAExport int recvtimeout_sec (AJASocket s, char * buf, int len, int timeout_seconds);
 AJAExport int recvtimeout_usec (AJASocket s, char * buf, int len, int timeout_uSecs);
 
 #define RVCFROMTIMEOUT_ERR		(-1)
 #define RVCFROMTIMEOUT_TIMEDOUT	(-2)
+#define RECVFRAME_BAD_FRAME		(-2)	// recvframeheader:  bad magic or oversized payload
 
 AJAExport int recvfromtimeout (AJASocket s, char * buf, int len, int timeout,
 								struct sockaddr * their_addr, socklen_t * addr_len);
@@ -7,6 +7,8 @@
 
 #include "ntv2utils.h"
 #include "ajabase/system/debug.h"
+#include "ajabase/system/lock.h"
+#include <set>
 #include "ntv2nubtypes.h"
 #include "ntv2devicescanner.h"
 #include "ntv2legacycommon.h"
@@ -448,25 +450,13 @@ NTV2NubPkt * BuildNubWriteRegisterRespPacket (NTV2NubProtocolVersion protocolVer
 	return pPkt;
 }
 
-NTV2NubPkt * BuildNubGetAutoCirculateRespPacket( NTV2NubProtocolVersion protocolVersion,
-												LWord cookie, 
-												ULWord channelSpec, 
-												AUTOCIRCULATE_STATUS_STRUCT *acStatus, 
-												UWord result)
+// Fill in a get autocirculate payload in network byte order
+static void NBOifyGetAutoCircPayload (NTV2GetAutoCircPayload *pGetAutoCircPayload,
+									LWord cookie, 
+									ULWord channelSpec, 
+									AUTOCIRCULATE_STATUS_STRUCT *acStatus, 
+									UWord result)
 {
-	NTV2NubPkt *pPkt;
-	char *p;
-	
-	pPkt = BuildNubBasePacket(	protocolVersion,
-								eNubGetAutoCirculateRespPkt,
-								sizeof(NTV2GetAutoCircPayload),
-								&p);
-	if (pPkt == 0)
-		return 0;
-
-	NTV2GetAutoCircPayload *pGetAutoCircPayload =
-		(NTV2GetAutoCircPayload *)p;
-
 	// Convert to network byte order
 	pGetAutoCircPayload->handle = htonl(cookie);
 	pGetAutoCircPayload->result = htonl(result);
@@ -502,7 +492,25 @@ NTV2NubPkt * BuildNubGetAutoCirculateRespPacket( NTV2NubProtocolVersion protocol
 	pGetAutoCircPayload->bWithColorCorrection = htonl((ULWord)(acStatus->bWithColorCorrection));
 	pGetAutoCircPayload->bWithVidProc = htonl((ULWord)(acStatus->bWithVidProc));
 	pGetAutoCircPayload->bWithCustomAncData = htonl((ULWord)(acStatus->bWithCustomAncData));
+}
+
+NTV2NubPkt * BuildNubGetAutoCirculateRespPacket( NTV2NubProtocolVersion protocolVersion,
+												LWord cookie, 
+												ULWord channelSpec, 
+												AUTOCIRCULATE_STATUS_STRUCT *acStatus, 
+												UWord result)
+{
+	NTV2NubPkt *pPkt;
+	char *p;
 	
+	pPkt = BuildNubBasePacket(	protocolVersion,
+								eNubGetAutoCirculateRespPkt,
+								sizeof(NTV2GetAutoCircPayload),
+								&p);
+	if (pPkt == 0)
+		return 0;
+
+	NBOifyGetAutoCircPayload((NTV2GetAutoCircPayload *)p, cookie, channelSpec, acStatus, result);
 	return pPkt;
 }
 
@@ -848,6 +856,7 @@ typedef OpenBoardEntries::iterator			OpenBoardEntriesIter;
 typedef OpenBoardEntries::const_iterator	OpenBoardEntriesCIter;
 
 static OpenBoardEntries	sOpenBoardEntries;
+static AJALock			sOpenBoardEntriesLock;	//	Guards sOpenBoardEntries -- each connection runs in its own thread
 
 static bool Append (const ULWord cookie, const ULWord boardNumber, const int fd)
 {
@@ -866,6 +875,7 @@ static bool Append (const ULWord cookie, const ULWord boardNumber, const int fd)
 static LWord OpenBoard (const ULWord boardNumber, const int fd)
 {
 	static ULWord nextCookie = 1;
+	AJAAutoLock autoLock(&sOpenBoardEntriesLock);
 
 	// Search for already opened board
 	for (OpenBoardEntriesIter it(sOpenBoardEntries.begin());  it != sOpenBoardEntries.end();  ++it)
@@ -897,8 +907,10 @@ static LWord OpenBoard (const ULWord boardNumber, const int fd)
 }
 
 // Returns CNTV2Card pointer corresponding to cookie.
+// (The CNTV2Card outlives its entry, so the pointer stays valid after the lock is released.)
 static CNTV2Card * FindOpenBoard (ULWord cookie)
 {
+	AJAAutoLock autoLock(&sOpenBoardEntriesLock);
 	// Search for opened board
 	for (OpenBoardEntriesIter it(sOpenBoardEntries.begin());  it != sOpenBoardEntries.end();  ++it)
 	{
@@ -913,6 +925,7 @@ static CNTV2Card * FindOpenBoard (ULWord cookie)
 // closes board so driver can possibly be unloaded.
 static bool CloseBoard (int fileDescriptor)
 {
+	AJAAutoLock autoLock(&sOpenBoardEntriesLock);
 	// Search for opened board
 	for (OpenBoardEntriesIter it(sOpenBoardEntries.begin());  it != sOpenBoardEntries.end();  ++it)
 	{
@@ -928,6 +941,580 @@ static bool CloseBoard (int fileDescriptor)
 }	//	CloseBoard
 
 
+static bool GetAutoCirculate (CNTV2Card & card, const NTV2Crosspoint channelSpec, AUTOCIRCULATE_STATUS_STRUCT & outStatus)
+{
+	AUTOCIRCULATE_STATUS	acStatus;
+	const bool result (card.AutoCirculateGetStatus(::NTV2CrosspointToNTV2Channel(channelSpec), acStatus));
+	::memset(&outStatus, 0, sizeof(outStatus));
+	acStatus.CopyTo(outStatus);
+	return result;
+}
+
+static bool ControlAutoCirculate (CNTV2Card & card, const AUTO_CIRC_COMMAND eCommand, const NTV2Crosspoint channelSpec, const bool bPlayToPause)
+{
+	const NTV2Channel chan (::NTV2CrosspointToNTV2Channel (channelSpec));
+	switch (eCommand)
+	{
+		case eStartAutoCirc:		return card.AutoCirculateStart(chan);
+		case eStopAutoCirc:			return card.AutoCirculateStop(chan);
+		case eAbortAutoCirc:		return card.AutoCirculateStop(chan, true);
+		case ePauseAutoCirc:		return bPlayToPause	? card.AutoCirculateResume(chan)
+														: card.AutoCirculatePause(chan);
+		case eFlushAutoCirculate:	return card.AutoCirculateFlush(chan);
+		default:					break;	// Others not supported yet
+	}
+	return false;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+// Protocol version 4:  framed requests (see ntv2legacycommon.h)
+
+// If 'inMagic' is non-zero, the header's first word was already read (in network byte order).
+static bool RecvNubFrameHeader (const int fd, NTV2NubFrameHeader & outHeader, const ULWord inMagic = 0)
+{
+	outHeader.magic = inMagic;
+	switch (::recvframeheader(fd, outHeader, inMagic ? int(sizeof(inMagic)) : 0))
+	{
+		case 0:						return true;
+		case RECVFRAME_BAD_FRAME:	NBFAIL("Bad frame, magic " << xHEX0N(outHeader.magic,8) << ", " << outHeader.payloadLength << "-byte payload on fd " << fd);
+									return false;
+		default:					NBFAIL("'recvframeheader' failed on fd " << fd);
+									return false;
+	}
+}
+
+static bool RecvNubFrame (const int fd, NTV2NubFrameHeader & outHeader, vector<char> & outPayload, const ULWord inMagic)
+{
+	if (!RecvNubFrameHeader(fd, outHeader, inMagic))
+		return false;
+	outPayload.resize(outHeader.payloadLength);
+	int len (int(outHeader.payloadLength));
+	if (len  &&  ::recvall(fd, &outPayload[0], &len) == -1)
+		{NBFAIL("'recvall' failed on fd " << fd << " after " << len << " payload bytes");  return false;}
+	return true;
+}
+
+static bool SendNubFrameResp (const int fd, const NTV2NubFrameHeader & inQuery, const LWord inStatus,
+								const void * pPayload = AJA_NULL, const ULWord inPayloadLength = 0)
+{
+	NTV2NubFrameHeader resp (inQuery);
+	resp.status = inStatus;
+	resp.payloadLength = inPayloadLength;
+	if (::sendframe(fd, resp, pPayload) == -1)
+		{NBFAIL("'sendframe' failed on fd " << fd << ": " << ::strerror(errno));  return false;}
+	NBDBG("Sent response to request " << resp.requestID << ", status " << inStatus << ", " << inPayloadLength << " payload bytes on fd " << fd);
+	return true;
+}
+
+// Reads or writes the registers in the payload.  Read values are returned in place.
+static LWord DoRegistersFrame (CNTV2Card & card, const bool inIsRead, vector<char> & inOutPayload, ULWord & outRespLength)
+{
+	NTV2RegisterReads query, regs;
+	ULWord whichRegisterFailed (0);
+	if (!::DecodeNubRegistersPayload(inOutPayload, query, whichRegisterFailed))
+		return NTV2_REMOTE_ACCESS_BAD_REQUEST;
+	const ULWord numRegs (ULWord(query.size()));
+	regs = query;
+
+	whichRegisterFailed = numRegs;
+	bool result (false);
+	if (inIsRead)
+	{
+		result = card.ReadRegisters(regs);	//	One GETREGS message instead of numRegs round trips to the driver
+		if (!result)
+			whichRegisterFailed = 0;	//	Don't know which one
+		for (ULWord n(0);  n < numRegs;  n++)
+		{
+			const ULWord mask (query[n].registerMask),  shift (query[n].registerShift);
+			query[n].registerValue = n < ULWord(regs.size())  &&  shift < 32  ?  (regs[n].registerValue & mask) >> shift  :  0;
+		}
+	}
+	else
+	{
+		result = card.WriteRegisters(regs);	//	One SETREGS message
+		if (!result)
+			whichRegisterFailed = 0;	//	Don't know which one
+	}
+	::EncodeNubRegistersPayload(inOutPayload, numRegs ? &query[0] : AJA_NULL, numRegs, inIsRead, whichRegisterFailed);
+	outRespLength = inIsRead ? ULWord(inOutPayload.size()) : ULWord(sizeof(NTV2NubRegistersPayloadHeader));
+	if (!result)
+		return inIsRead ? NTV2_REMOTE_ACCESS_READ_REG_MULTI_FAILED : NTV2_REMOTE_ACCESS_WRITE_REG_FAILED;
+	return NTV2_REMOTE_ACCESS_SUCCESS;
+}
+
+static LWord DoAutoCirculateFrame (CNTV2Card & card, const LWord cookie, vector<char> & inOutPayload, ULWord & outRespLength)
+{
+	if (inOutPayload.size() != sizeof(NTV2ControlAutoCircPayload))
+		return NTV2_REMOTE_ACCESS_BAD_REQUEST;
+	const NTV2ControlAutoCircPayload * pCACP (reinterpret_cast<const NTV2ControlAutoCircPayload*>(&inOutPayload[0]));
+	const AUTO_CIRC_COMMAND eCommand (AUTO_CIRC_COMMAND(ntohl(pCACP->eCommand)));
+	const NTV2Crosspoint channelSpec (NTV2Crosspoint(ntohl(pCACP->channelSpec)));
+	const bool bPlayToPause (ntohl(pCACP->bVal1) ? true : false);	// Note: only valid if eCommand == ePauseAutoCirc
+
+	if (eCommand == eGetAutoCirc)
+	{
+		AUTOCIRCULATE_STATUS_STRUCT acStatus;
+		const bool result (GetAutoCirculate(card, channelSpec, acStatus));
+		inOutPayload.assign(sizeof(NTV2GetAutoCircPayload), 0);
+		NBOifyGetAutoCircPayload(reinterpret_cast<NTV2GetAutoCircPayload*>(&inOutPayload[0]), cookie, channelSpec, &acStatus, result);
+		outRespLength = sizeof(NTV2GetAutoCircPayload);
+		return result ? NTV2_REMOTE_ACCESS_SUCCESS : NTV2_REMOTE_AUTOCIRC_FAILED;
+	}
+	return ControlAutoCirculate(card, eCommand, channelSpec, bPlayToPause) ? NTV2_REMOTE_ACCESS_SUCCESS : NTV2_REMOTE_AUTOCIRC_FAILED;
+}
+
+static LWord DoWaitForInterruptFrame (CNTV2Card & card, const vector<char> & inPayload)
+{
+	if (inPayload.size() != sizeof(NTV2WaitForInterruptPayload))
+		return NTV2_REMOTE_ACCESS_BAD_REQUEST;
+	const NTV2WaitForInterruptPayload * pWFIP (reinterpret_cast<const NTV2WaitForInterruptPayload*>(&inPayload[0]));
+	const INTERRUPT_ENUMS eInterrupt (INTERRUPT_ENUMS(ntohl(pWFIP->eInterrupt)));
+	return card.WaitForInterrupt(eInterrupt, ntohl(pWFIP->timeOutMs)) ? NTV2_REMOTE_ACCESS_SUCCESS : NTV2_REMOTE_ACCESS_WAIT_FOR_INTERRUPT_FAILED;
+}
+
+// Handles an eNubFrameDMATransfer request, including its data frames and response.
+// Returns false if the connection is no longer usable.
+static bool DoDMATransferFrame (CNTV2Card * pCard, const int fd, const NTV2NubFrameHeader & inQuery, const vector<char> & inPayload)
+{
+	if (inPayload.size() != sizeof(NTV2NubDMAPayload))
+		{NBFAIL("Bad DMA payload size " << inPayload.size() << " on fd " << fd);  return false;}
+	const NTV2NubDMAPayload * pDMA (reinterpret_cast<const NTV2NubDMAPayload*>(&inPayload[0]));
+	const NTV2DMAEngine	dmaEngine		(NTV2DMAEngine(ntohl(pDMA->dmaEngine)));
+	const bool			isRead			(ntohl(pDMA->isRead) ? true : false);
+	const ULWord		frameNumber		(ntohl(pDMA->frameNumber));
+	const ULWord		cardOffset		(ntohl(pDMA->cardOffsetBytes));
+	const ULWord		byteCount		(ntohl(pDMA->byteCount));
+	const ULWord		numSegments		(ntohl(pDMA->numSegments));
+	const ULWord		segCardPitch	(ntohl(pDMA->segmentCardPitch));
+	if (!byteCount  ||  byteCount > NTV2_NUB_DMA_MAX_BYTES  ||  numSegments > byteCount)
+		{NBFAIL("Bad DMA byteCount " << byteCount << ", numSegments " << numSegments << " on fd " << fd);  return false;}
+
+	// Segments travel packed, so the host pitch here is the segment length
+	const bool		segmented	(numSegments > 1);
+	const ULWord	segBytes	(segmented ? byteCount / numSegments : byteCount);
+	const ULWord	xferBytes	(segmented ? segBytes * numSegments : byteCount);
+	NTV2Buffer		buffer;
+	if (!buffer.Allocate(xferBytes, /*pageAligned*/true))
+		{NBFAIL("Failed to allocate " << xferBytes << "-byte DMA buffer");  return false;}
+
+	if (!isRead)	// Collect the data frames
+		for (ULWord offset(0);  offset < xferBytes;  )
+		{
+			NTV2NubFrameHeader dataHdr;
+			if (!RecvNubFrameHeader(fd, dataHdr))
+				return false;
+			if (dataHdr.opcode != eNubFrameDMAData  ||  dataHdr.requestID != inQuery.requestID
+				||  !dataHdr.payloadLength  ||  dataHdr.payloadLength > xferBytes - offset)
+				{NBFAIL("Unexpected frame, opcode " << dataHdr.opcode << ", request " << dataHdr.requestID << ", " << dataHdr.payloadLength << " bytes, during DMA write on fd " << fd);  return false;}
+			int len (int(dataHdr.payloadLength));
+			if (::recvall(fd, reinterpret_cast<char*>(buffer.GetHostAddress(offset)), &len) == -1)
+				{NBFAIL("'recvall' failed on fd " << fd << " after " << len << " DMA bytes");  return false;}
+			offset += dataHdr.payloadLength;
+		}
+
+	LWord status (NTV2_REMOTE_ACCESS_SUCCESS);
+	ULWord * pHostBuffer (reinterpret_cast<ULWord*>(buffer.GetHostPointer()));
+	if (!pCard)
+		status = NTV2_REMOTE_ACCESS_NO_CARD;
+	else if (segmented)
+	{
+		if (!pCard->DmaTransfer(dmaEngine, isRead, frameNumber, pHostBuffer, cardOffset, xferBytes, numSegments, segBytes, segCardPitch))
+			status = NTV2_REMOTE_ACCESS_DMA_TRANSFER_FAILED;
+	}
+	else if (!pCard->DmaTransfer(dmaEngine, isRead, frameNumber, pHostBuffer, cardOffset, xferBytes))
+		status = NTV2_REMOTE_ACCESS_DMA_TRANSFER_FAILED;
+	NBDBG((isRead ? "Read " : "Wrote ") << xferBytes << " bytes of frame " << frameNumber << ", status " << status << " on fd " << fd);
+
+	if (isRead  &&  status == NTV2_REMOTE_ACCESS_SUCCESS)	// Stream the data frames
+	{
+		NTV2NubFrameHeader dataHdr (inQuery);
+		dataHdr.opcode = eNubFrameDMAData;
+		dataHdr.status = NTV2_REMOTE_ACCESS_SUCCESS;
+		for (ULWord offset(0);  offset < xferBytes;  offset += dataHdr.payloadLength)
+		{
+			dataHdr.payloadLength = NTV2_CPP_MIN(ULWord(NTV2_NUB_DMA_CHUNK_SIZE), xferBytes - offset);
+			if (::sendframe(fd, dataHdr, buffer.GetHostAddress(offset)) == -1)
+				{NBFAIL("'sendframe' failed on fd " << fd << ": " << ::strerror(errno));  return false;}
+		}
+	}
+	return SendNubFrameResp(fd, inQuery, status);
+}
+
+// Receives and answers one framed request whose magic was already read.  Returns false if the connection should be closed.
+static bool HandleNubFrame (const int fd, const ULWord inMagic)
+{
+	NTV2NubFrameHeader query;
+	vector<char> payload;
+	if (!RecvNubFrame(fd, query, payload, inMagic))
+		return false;
+
+	CNTV2Card * card (FindOpenBoard(ULWord(query.handle)));
+	LWord status (NTV2_REMOTE_ACCESS_NO_CARD);
+	ULWord respLength (0);
+	switch (query.opcode)
+	{
+		case eNubFrameReadRegisters:
+		case eNubFrameWriteRegisters:
+			if (card)
+				status = DoRegistersFrame(*card, query.opcode == eNubFrameReadRegisters, payload, respLength);
+			break;
+
+		case eNubFrameAutoCirculate:
+			if (card)
+				status = DoAutoCirculateFrame(*card, query.handle, payload, respLength);
+			break;
+
+		case eNubFrameWaitForInterrupt:
+			if (card)
+				status = DoWaitForInterruptFrame(*card, payload);
+			break;
+
+		case eNubFrameDMATransfer:
+			return DoDMATransferFrame(card, fd, query, payload);	// Sends its own response
+
+		default:	// Includes stray eNubFrameDMAData -- can't trust the stream any more
+			NBFAIL("Unexpected frame opcode " << query.opcode << ", request " << query.requestID << " on fd " << fd);
+			return false;
+	}
+	return SendNubFrameResp(fd, query, status, respLength ? &payload[0] : AJA_NULL, respLength);
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+// Connections
+
+typedef set<int>	ConnectionFDs;
+
+static ConnectionFDs	sConnectionFDs;		//	Every open client connection
+static AJALock			sConnectionFDsLock;	//	Guards sConnectionFDs
+
+// Answers one legacy packet, the first 'nbytes' bytes of which are in 'buf'.
+static void HandleLegacyPacket (const int fd, char (&buf)[sizeof(NTV2NubPkt)], int nbytes)
+{
+	// Reassemble a fragmented packet
+	if (nbytes >= int(sizeof(NTV2NubPktHeader)))
+	{
+		const int pktSize (int(sizeof(NTV2NubPktHeader) + ntohl(reinterpret_cast<NTV2NubPkt*>(buf)->hdr.dataLength)));
+		int len (pktSize - nbytes);
+		if (len > 0  &&  pktSize <= int(sizeof(buf)))
+			if (::recvall(fd, buf + nbytes, &len) == 0)
+				nbytes = pktSize;
+	}
+	// NTV2NubPacket?  (Except discovery packets handed in child on another port)
+	if (deNBOifyNTV2NubPkt((NTV2NubPkt *)buf, nbytes))
+	{
+		NTV2NubPkt *recvdNubPkt = (NTV2NubPkt *)buf;
+		NTV2NubProtocolVersion recvdProtoVer = recvdNubPkt->hdr.protocolVersion;
+		NTV2NubPkt *pRespPkt = AJA_NULL;
+		if (isNubOpenQueryPacket(recvdNubPkt))
+		{
+			ULWord boardNumber(0), cookie(0);
+			ParseNubOpenQueryPacket(recvdNubPkt, boardNumber);
+			// printf("Opening board on fd %d\n", i);
+			cookie = OpenBoard(boardNumber, fd);
+			pRespPkt = BuildNubOpenRespPacket(	recvdProtoVer,  boardNumber,  cookie);
+			// printf("Got open for boardNumber %d, boardType %d.  cookie = 0x%08x\n", boardNumber, boardType, cookie);
+		}
+		else if (isNubReadSingleRegisterQueryPacket(recvdNubPkt))
+		{
+			LWord cookie	(0);
+			ULWord registerNumber(0), registerValue(0), registerMask(0), registerShift(0);
+			ULWord result	(0);
+
+			ParseNubReadRegisterSingleQueryPacket (recvdNubPkt, &cookie, &registerNumber, &registerMask, &registerShift);
+			// 	printf("Got register read for cookie = 0x%08x, register number %d, registerMask 0x%X, registerShift %d\n", cookie, registerNumber, registerMask, registerShift);
+
+			CNTV2Card * card =  FindOpenBoard(cookie);
+			if (card)
+				result = card->ReadRegister(registerNumber, registerValue, registerMask, registerShift);
+			else // Card not found, return failure.
+				cookie = INVALID_NUB_HANDLE;
+			pRespPkt = BuildNubReadSingleRegisterRespPacket(recvdProtoVer, cookie, registerNumber, registerValue, result);
+		}
+		else if (isNubWriteRegisterQueryPacket(recvdNubPkt))
+		{
+			LWord cookie;
+			ULWord registerNumber, registerValue, registerMask, registerShift;
+			ULWord result = 0;
+
+			ParseNubWriteRegisterQueryPacket (recvdNubPkt, &cookie, &registerNumber, &registerValue, &registerMask, &registerShift);
+			// printf("Got register write for cookie = 0x%08x, register number %d, register value %d, registerMask 0x%X, registerShift %d\n", cookie, registerNumber, registerValue, registerMask, registerShift);
+
+			CNTV2Card *card =  FindOpenBoard(cookie);
+			if (card)
+				result = card->WriteRegister(registerNumber, registerValue, registerMask, registerShift);
+			else // Card not found, return failure.
+				cookie = INVALID_NUB_HANDLE;
+			pRespPkt = BuildNubWriteRegisterRespPacket(recvdProtoVer, cookie, registerNumber, registerValue, result);
+		}
+		else if (isNubGetAutocirculateQueryPacket(recvdNubPkt))
+		{
+			LWord cookie;
+			NTV2Crosspoint		channelSpec;
+			ULWord result = 0;
+
+			ParseNubGetAutoCirculateQueryPacket (recvdNubPkt, &cookie, &channelSpec);
+			// printf("Received autocirculate get for cookie = 0x%08x, channel spec %d\n", cookie, (ULWord)channelSpec);
+
+			CNTV2Card *card =  FindOpenBoard(cookie);
+			AUTOCIRCULATE_STATUS_STRUCT oldStatus;
+			memset(&oldStatus, 0, sizeof(oldStatus));
+			if (card)
+				result = GetAutoCirculate(*card, channelSpec, oldStatus);
+			else // Card not found, return failure.
+				cookie = INVALID_NUB_HANDLE;
+			pRespPkt = BuildNubGetAutoCirculateRespPacket (recvdProtoVer, cookie, channelSpec, &oldStatus, result);
+		}
+		else if (isNubControlAutocirculateQueryPacket(recvdNubPkt))
+		{
+			LWord cookie;
+			AUTO_CIRC_COMMAND eCommand;
+			NTV2Crosspoint channelSpec;
+			bool bPlayToPause = true;
+			ULWord result = 0;
+
+			ParseNubControlAutoCirculateQueryPacket (recvdNubPkt, &cookie, &eCommand, &channelSpec, &bPlayToPause);
+			// printf("Received control autocirculate for cookie = 0x%08x, command %d, channel spec %d\n", cookie, (ULWord)eCommand, (ULWord)channelSpec);
+
+			CNTV2Card *card =  FindOpenBoard(cookie);
+			if (card)
+				result = ControlAutoCirculate(*card, eCommand, channelSpec, bPlayToPause);
+			else // Card not found, return failure.
+				cookie = INVALID_NUB_HANDLE;
+			pRespPkt = BuildNubControlAutoCirculateRespPacket(recvdProtoVer, cookie, channelSpec, result);
+		}
+		else if (isNubWaitForInterruptQueryPacket(recvdNubPkt))
+		{
+			LWord cookie;
+			INTERRUPT_ENUMS eInterrupt;
+			ULWord timeOutMs;
+			ULWord result = 0;
+
+			ParseNubWaitForInterruptQueryPacket(recvdNubPkt, &cookie, &eInterrupt, &timeOutMs);
+			// printf("Received wait for interrupt %d, timeout %d msec, for cookie = 0x%08x\n", eInterrupt, timeOutMs, cookie);
+
+			CNTV2Card *card =  FindOpenBoard(cookie);
+			if (card)
+				result = card->WaitForInterrupt(eInterrupt, timeOutMs);
+			else // Card not found, return failure.
+				cookie = INVALID_NUB_HANDLE;
+			pRespPkt = BuildNubWaitForInterruptRespPacket(recvdProtoVer, cookie, result);
+		}
+		else if (isNubDriverGetBitFileInformationQueryPacket(recvdNubPkt))
+		{
+			LWord cookie;
+			NTV2BitFileType bitFileType;
+			BITFILE_INFO_STRUCT bitFileInfo;
+			NTV2XilinxFPGA whichFPGA;
+			ULWord result = 0;
+
+			memset(&bitFileInfo, 0, sizeof(BITFILE_INFO_STRUCT));
+			ParseNubDriverGetBitFileInformationQueryPacket(recvdNubPkt, &cookie, &bitFileType, &whichFPGA);
+			// printf("Received driver get bitfile info for type %d\n", bitFileType);
+
+			CNTV2Card *card =  FindOpenBoard(cookie);
+			if (card)
+			{
+				bitFileInfo.whichFPGA = whichFPGA;
+				result = card->DriverGetBitFileInformation(bitFileInfo, bitFileType);
+			}
+			else // Card not found, return failure.
+				cookie = INVALID_NUB_HANDLE;
+			pRespPkt = BuildNubDriverGetBitFileInformationRespPacket(recvdProtoVer, cookie, bitFileInfo, bitFileType, result);
+		}
+		else if (isNubDownloadTestPatternQueryPacket(recvdNubPkt))
+		{
+			LWord cookie;
+			ULWord result = 0;
+			NTV2Channel channel;
+			NTV2FrameBufferFormat testPatternFrameBufferFormat;
+			UWord signalMask;
+			bool testPatternDMAEnable;
+			ULWord testPatternNumber;
+
+			ParseNubDownloadTestPatternQueryPacket(recvdNubPkt, &cookie, &channel, &testPatternFrameBufferFormat, &signalMask, &testPatternDMAEnable, &testPatternNumber);
+			// printf("Received download test pattern msg\n");
+
+			CNTV2Card *card =  FindOpenBoard(cookie);
+			if (card)
+			{
+				cerr << "Obsolete" << endl;
+			}
+			else // Card not found, return failure.
+				cookie = INVALID_NUB_HANDLE;
+			pRespPkt = BuildNubDownloadTestPatternRespPacket(recvdProtoVer, cookie, result);
+		}
+		else if (isNubReadMultiRegisterQueryPacket(recvdNubPkt))
+		{
+			LWord cookie;
+			ULWord numRegs;
+			ULWord result = 0;
+			NTV2RegInfo aRegs[NTV2_NUB_NUM_MULTI_REGS];
+
+			ParseNubReadRegisterMultiQueryPacket(recvdNubPkt, &cookie, &numRegs, aRegs);
+			// printf("Got multi register read for cookie = 0x%08x, %d registers,\n", cookie, numRegs);
+
+			CNTV2Card *card =  FindOpenBoard(cookie);
+			ULWord whichRegisterFailed=999;
+			if (card)
+			{
+#if defined(NTV2_DEPRECATE_16_0)
+				NTV2RegisterReads regs;
+				for (ULWord n(0);  n < numRegs;  n++)
+					regs.push_back(aRegs[n]);
+				result = card->ReadRegisters(regs);
+				if (result)
+					for (ULWord n(0);  n < numRegs;  n++)
+						aRegs[n] = regs.at(n);
+#else
+				result = card->ReadRegisterMulti(numRegs, &whichRegisterFailed, aRegs);
+#endif
+				// printf("ReadRegister multi %s, whichRegisterFailed = %d\n", result ? "succeeded" : "failed", whichRegisterFailed); 
+			}
+			else // Card not found, return failure.
+				cookie = INVALID_NUB_HANDLE;
+			pRespPkt = BuildNubReadMultiRegisterRespPacket(recvdProtoVer, cookie, numRegs, aRegs, result, whichRegisterFailed);
+		}
+		else if (isNubDriverGetBuildInformationQueryPacket(recvdNubPkt))
+		{
+			LWord cookie;
+			ULWord result = 0;
+
+			BUILD_INFO_STRUCT buildInfo;
+			ParseNubDriverGetBuildInformationQueryPacket(recvdNubPkt, &cookie, &buildInfo);
+			// printf("Got driver get buildinfo for cookie = 0x%08x\n", cookie);
+
+			CNTV2Card *card =  FindOpenBoard(cookie);
+			if (card)
+			{
+				result = card->DriverGetBuildInformation(buildInfo);
+				// printf("GetBuildInfo %s, buildInfo = %s\n", result ? "succeeded" : "failed", buildInfo.buildStr); 
+			}
+			else // Card not found, return failure.
+				cookie = INVALID_NUB_HANDLE;
+			pRespPkt = BuildNubDriverGetBuildInfoRespPacket(recvdProtoVer, cookie, result, &buildInfo);
+		}
+
+		// Send response
+		int len (pRespPkt ? int(sizeof(NTV2NubPktHeader) + pRespPkt->hdr.dataLength) : 0);
+		if (pRespPkt)
+		{
+			if (NBOifyNTV2NubPkt(pRespPkt)) 
+			{
+				if (::sendall(fd, (char *)pRespPkt, &len) == -1) 
+					NBFAIL("'sendall' failed: " << ::strerror(errno));
+				else
+					NBDBG("'sendall' " << len << " bytes on fd " << fd);
+			}
+			delete pRespPkt;
+		}
+	}
+	else
+	{
+		AJAAutoLock autoLock(&sConnectionFDsLock);
+		for (ConnectionFDs::const_iterator it(sConnectionFDs.begin());  it != sConnectionFDs.end();  ++it) // send to everyone!  They love us!
+			if (*it != fd)	//	except ourselves
+			{
+				if (::send(*it, buf, nbytes, 0) == -1) 
+					NBFAIL("'send' failed on fd " << *it << ": " << ::strerror(errno));
+				else
+					NBDBG("'send' " << nbytes << " bytes on fd " << *it);
+			}
+	}
+}	//	HandleLegacyPacket
+
+// Serves one client until it hangs up, or its stream can't be trusted any more.  Every connection
+// has its own thread, so a long DMA transfer or WaitForInterrupt doesn't hold up the other clients.
+static void ServeConnection (const int fd)
+{
+	char buf[sizeof(NTV2NubPkt)];	//	buffer for one legacy packet
+	while (true)
+	{
+		// Protocol version 4 frames start with NTV2_NUB_FRAME_MAGIC, legacy packets with their protocol version.
+		// Wait for the whole first word -- deciding on a partial one would desync the stream.
+		ULWord firstWord (0);
+		int nbytes (int(sizeof(firstWord)));
+		if (::recvall(fd, reinterpret_cast<char*>(&firstWord), &nbytes) == -1)
+		{
+			if (nbytes == 0)
+				NBFAIL("socket " << fd << " hung up");	// connection closed
+			else
+				NBFAIL("'recv' error after " << nbytes << " bytes on fd " << fd << ": " << ::strerror(errno));
+			break;
+		}
+		if (ntohl(firstWord) == NTV2_NUB_FRAME_MAGIC)
+		{
+			if (HandleNubFrame(fd, firstWord))
+				continue;
+			NBFAIL("Closing socket " << fd << " after framing error");
+			break;
+		}
+
+		::memcpy(buf, &firstWord, sizeof(firstWord));
+		const int moreBytes (int(::recv(fd, buf + nbytes, sizeof(buf) - size_t(nbytes), 0)));
+		if (moreBytes <= 0) 
+		{
+			// got error or connection closed by client
+			if (moreBytes == 0) 
+				NBFAIL("socket " << fd << " hung up");	// connection closed
+			else 
+				NBFAIL("'recv' error: " << ::strerror(errno));
+			break;
+		}
+		HandleLegacyPacket(fd, buf, nbytes + moreBytes);
+	}
+
+	{
+		AJAAutoLock autoLock(&sConnectionFDsLock);
+		sConnectionFDs.erase(fd);
+	}
+	CloseBoard(fd);
+	close(fd); // bye!
+}	//	ServeConnection
+
+#ifdef MSWindows
+DWORD WINAPI ServeConnectionThread (LPVOID lpParameter)
+{
+	ServeConnection(int(reinterpret_cast<intptr_t>(lpParameter)));
+	return 0;
+}
+#else
+static void * ServeConnectionThread (void * pParameter)
+{
+	ServeConnection(int(reinterpret_cast<intptr_t>(pParameter)));
+	return AJA_NULL;
+}
+#endif
+
+// Hands a newly accepted connection to its own detached thread.
+static bool StartConnectionThread (const int fd)
+{
+	{
+		AJAAutoLock autoLock(&sConnectionFDsLock);
+		sConnectionFDs.insert(fd);
+	}
+#ifdef MSWindows
+	HANDLE hThread (::CreateThread(NULL, 0, ServeConnectionThread, reinterpret_cast<LPVOID>(intptr_t(fd)), 0, NULL));
+	if (hThread)
+		{::CloseHandle(hThread);  return true;}
+	NBFAIL("'CreateThread' failed for fd " << fd);
+#else
+	pthread_t thread;
+	pthread_attr_t attr;
+	pthread_attr_init(&attr);
+	pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+	const int ptrc (::pthread_create(&thread, &attr, &ServeConnectionThread, reinterpret_cast<void*>(intptr_t(fd))));
+	pthread_attr_destroy(&attr);
+	if (!ptrc)
+		return true;
+	NBFAIL("Connection thread creation failed for fd " << fd << ": " << ptrc);
+#endif
+	AJAAutoLock autoLock(&sConnectionFDsLock);
+	sConnectionFDs.erase(fd);
+	return false;
+}
+
 /**
 	@brief	Nub server implementation that uses rpclib as the transport.
 **/
@@ -948,15 +1535,10 @@ class NTV2LegacyNubServer : public NTV2RPCServerAPI
 
 void NTV2LegacyNubServer::RunServer (void)
 {
-    fd_set master;					//	master file descriptor list
-    fd_set read_fds;				//	temp file descriptor list for select()
     struct sockaddr_in myaddr;		//	server address
     struct sockaddr_in remoteaddr;	//	client address
-    int fdmax;						//	maximum file descriptor number
     int listener;					//	listening socket descriptor
     int newfd;						//	newly accept()ed socket descriptor
-    char buf[8192];					//	8K buffer for client data
-    int nbytes;
     int yes(1);						//	for setsockopt() SO_REUSEADDR, below
     socklen_t addrlen;
 
@@ -1008,9 +1590,6 @@ void NTV2LegacyNubServer::RunServer (void)
 	::CreateThread(NULL,  NULL, handleDiscoveryQueriesThread, NULL,   0,   NULL);
 #endif	//	else ifndef MSWindows
 
-    FD_ZERO(&master);    // clear the master and temp sets
-    FD_ZERO(&read_fds);
-
 	// get the listener
 	if ((listener = int(::socket(AF_INET, SOCK_STREAM, 0))) == -1)
 		{cerr << "'socket' failed: " << ::strerror(errno) << endl;  exit(1);}
@@ -1034,296 +1613,18 @@ void NTV2LegacyNubServer::RunServer (void)
 		{NBFAIL("'listen' failed: " << ::strerror(errno));  exit(1);}
 	NBDBG("Listening on socket " << listener);
 
-    // add the listener to the master set
-    FD_SET(listener, &master);
-
-    // keep track of the biggest file descriptor
-    fdmax = listener; // so far, it's this one
-
-	//	Main loop
+	//	Main loop:  each client is served by its own thread
 	while (true)
 	{
-		read_fds = master; // copy it
-		if (::select(fdmax+1, &read_fds, NULL, NULL, NULL) == -1) 
-			{NBFAIL("'select' failed: " << ::strerror(errno));  exit(1);}
-		NBDBG("'select' " << (fdmax+1) << " OK");
-
-        // run through the existing connections looking for data to read
-        for (int ifd = 0;  ifd <= fdmax;  ifd++) 
-		{
-            if (!FD_ISSET(ifd, &read_fds))
-				continue;
-			// we got one!!
-			if (ifd == listener) 
-			{	// handle new connections
-				addrlen = sizeof(remoteaddr);
-				if ((newfd = int(accept(listener, (struct sockaddr *)&remoteaddr, &addrlen))) == -1) 
-					NBFAIL("'accept' failed: " << ::strerror(errno));
-				else
-				{
-					FD_SET(newfd, &master); // add to master set
-					if (newfd > fdmax) 
-						fdmax = newfd;    // keep track of the maximum
-					cout << "New connection from " << inet_ntoa(remoteaddr.sin_addr) << " on socket " << newfd << endl;
-					NBINFO("New connection from " << inet_ntoa(remoteaddr.sin_addr) << " on socket " << newfd);
-				}
-			} 
-			else // handle data from a client
-			{
-				// TODO: if nbytes < pktsize, do multiple recvs 
-				// to reassemble fragmented packets.
-				// one buf, size of two maxpackets, per connection?
-				if ((nbytes = recv(ifd, buf, sizeof(buf), 0)) <= 0) 
-				{
-					// got error or connection closed by client
-					if (nbytes == 0) 
-						NBFAIL("socket " << ifd << " hung up");	// connection closed
-					else 
-						NBFAIL("'recv' error: " << ::strerror(errno));
-					// printf("Closing board on fd %d\n", i);
-					CloseBoard(ifd);
-					close(ifd); // bye!
-					FD_CLR(ifd, &master); // remove from master set
-				}
-				else // we got some data from a client
-				{
-					// NTV2NubPacket?  (Except discovery packets handed in child on another port)
-					if (deNBOifyNTV2NubPkt((NTV2NubPkt *)buf, nbytes))
-					{
-						NTV2NubPkt *recvdNubPkt = (NTV2NubPkt *)buf;
-						NTV2NubProtocolVersion recvdProtoVer = recvdNubPkt->hdr.protocolVersion;
-						NTV2NubPkt *pRespPkt = AJA_NULL;
-						if (isNubOpenQueryPacket(recvdNubPkt))
-						{
-							ULWord boardNumber(0), cookie(0);
-							ParseNubOpenQueryPacket(recvdNubPkt, boardNumber);
-							// printf("Opening board on fd %d\n", i);
-							cookie = OpenBoard(boardNumber, ifd);
-							pRespPkt = BuildNubOpenRespPacket(	recvdProtoVer,  boardNumber,  cookie);
-							// printf("Got open for boardNumber %d, boardType %d.  cookie = 0x%08x\n", boardNumber, boardType, cookie);
-						}
-						else if (isNubReadSingleRegisterQueryPacket(recvdNubPkt))
-						{
-							LWord cookie	(0);
-							ULWord registerNumber(0), registerValue(0), registerMask(0), registerShift(0);
-							ULWord result	(0);
-	
-							ParseNubReadRegisterSingleQueryPacket (recvdNubPkt, &cookie, &registerNumber, &registerMask, &registerShift);
-							// 	printf("Got register read for cookie = 0x%08x, register number %d, registerMask 0x%X, registerShift %d\n", cookie, registerNumber, registerMask, registerShift);
-	
-							CNTV2Card * card =  FindOpenBoard(cookie);
-							if (card)
-								result = card->ReadRegister(registerNumber, registerValue, registerMask, registerShift);
-							else // Card not found, return failure.
-								cookie = INVALID_NUB_HANDLE;
-							pRespPkt = BuildNubReadSingleRegisterRespPacket(recvdProtoVer, cookie, registerNumber, registerValue, result);
-						}
-						else if (isNubWriteRegisterQueryPacket(recvdNubPkt))
-						{
-							LWord cookie;
-							ULWord registerNumber, registerValue, registerMask, registerShift;
-							ULWord result = 0;
-	
-							ParseNubWriteRegisterQueryPacket (recvdNubPkt, &cookie, &registerNumber, &registerValue, &registerMask, &registerShift);
-							// printf("Got register write for cookie = 0x%08x, register number %d, register value %d, registerMask 0x%X, registerShift %d\n", cookie, registerNumber, registerValue, registerMask, registerShift);
-	
-							CNTV2Card *card =  FindOpenBoard(cookie);
-							if (card)
-								result = card->WriteRegister(registerNumber, registerValue, registerMask, registerShift);
-							else // Card not found, return failure.
-								cookie = INVALID_NUB_HANDLE;
-							pRespPkt = BuildNubWriteRegisterRespPacket(recvdProtoVer, cookie, registerNumber, registerValue, result);
-						}
-						else if (isNubGetAutocirculateQueryPacket(recvdNubPkt))
-						{
-							LWord cookie;
-							NTV2Crosspoint		channelSpec;
-							ULWord result = 0;
-	
-							ParseNubGetAutoCirculateQueryPacket (recvdNubPkt, &cookie, &channelSpec);
-							// printf("Received autocirculate get for cookie = 0x%08x, channel spec %d\n", cookie, (ULWord)channelSpec);
-	
-							CNTV2Card *card =  FindOpenBoard(cookie);
-							AUTOCIRCULATE_STATUS	acStatus;
-							if (card)
-								result = card->AutoCirculateGetStatus(::NTV2CrosspointToNTV2Channel(channelSpec), acStatus);
-							else // Card not found, return failure.
-								cookie = INVALID_NUB_HANDLE;
-							AUTOCIRCULATE_STATUS_STRUCT oldStatus;
-							memset(&oldStatus, 0, sizeof(oldStatus));
-							acStatus.CopyTo(oldStatus);
-							pRespPkt = BuildNubGetAutoCirculateRespPacket (recvdProtoVer, cookie, channelSpec, &oldStatus, result);
-						}
-						else if (isNubControlAutocirculateQueryPacket(recvdNubPkt))
-						{
-							LWord cookie;
-							AUTO_CIRC_COMMAND eCommand;
-							NTV2Crosspoint channelSpec;
-							bool bPlayToPause = true;
-							ULWord result = 0;
-	
-							ParseNubControlAutoCirculateQueryPacket (recvdNubPkt, &cookie, &eCommand, &channelSpec, &bPlayToPause);
-							// printf("Received control autocirculate for cookie = 0x%08x, command %d, channel spec %d\n", cookie, (ULWord)eCommand, (ULWord)channelSpec);
-	
-							CNTV2Card *card =  FindOpenBoard(cookie);
-							if (card)
-							{
-								const NTV2Channel chan (::NTV2CrosspointToNTV2Channel (channelSpec));
-								switch (eCommand)
-								{
-									case eStartAutoCirc:		result = card->AutoCirculateStart(chan);					break;
-									case eStopAutoCirc:			result = card->AutoCirculateStop(chan);						break;
-									case eAbortAutoCirc:		result = card->AutoCirculateStop(chan, true);				break;
-									case ePauseAutoCirc:		result = bPlayToPause	? card->AutoCirculateResume(chan)
-																						: card->AutoCirculatePause(chan);	break;
-									case eFlushAutoCirculate:	result = card->AutoCirculateFlush(chan);					break;
-									default:					result = false;												break;	// Others not supported yet
-								}
-							}
-							else // Card not found, return failure.
-								cookie = INVALID_NUB_HANDLE;
-							pRespPkt = BuildNubControlAutoCirculateRespPacket(recvdProtoVer, cookie, channelSpec, result);
-						}
-						else if (isNubWaitForInterruptQueryPacket(recvdNubPkt))
-						{
-							LWord cookie;
-							INTERRUPT_ENUMS eInterrupt;
-							ULWord timeOutMs;
-							ULWord result = 0;
-
-							ParseNubWaitForInterruptQueryPacket(recvdNubPkt, &cookie, &eInterrupt, &timeOutMs);
-							// printf("Received wait for interrupt %d, timeout %d msec, for cookie = 0x%08x\n", eInterrupt, timeOutMs, cookie);
-	
-							CNTV2Card *card =  FindOpenBoard(cookie);
-							if (card)
-								result = card->WaitForInterrupt(eInterrupt, timeOutMs);
-							else // Card not found, return failure.
-								cookie = INVALID_NUB_HANDLE;
-							pRespPkt = BuildNubWaitForInterruptRespPacket(recvdProtoVer, cookie, result);
-						}
-						else if (isNubDriverGetBitFileInformationQueryPacket(recvdNubPkt))
-						{
-							LWord cookie;
-							NTV2BitFileType bitFileType;
-							BITFILE_INFO_STRUCT bitFileInfo;
-							NTV2XilinxFPGA whichFPGA;
-							ULWord result = 0;
-	
-							memset(&bitFileInfo, 0, sizeof(BITFILE_INFO_STRUCT));
-							ParseNubDriverGetBitFileInformationQueryPacket(recvdNubPkt, &cookie, &bitFileType, &whichFPGA);
-							// printf("Received driver get bitfile info for type %d\n", bitFileType);
-	
-							CNTV2Card *card =  FindOpenBoard(cookie);
-							if (card)
-							{
-								bitFileInfo.whichFPGA = whichFPGA;
-								result = card->DriverGetBitFileInformation(bitFileInfo, bitFileType);
-							}
-							else // Card not found, return failure.
-								cookie = INVALID_NUB_HANDLE;
-							pRespPkt = BuildNubDriverGetBitFileInformationRespPacket(recvdProtoVer, cookie, bitFileInfo, bitFileType, result);
-						}
-						else if (isNubDownloadTestPatternQueryPacket(recvdNubPkt))
-						{
-							LWord cookie;
-							ULWord result = 0;
-							NTV2Channel channel;
-							NTV2FrameBufferFormat testPatternFrameBufferFormat;
-							UWord signalMask;
-							bool testPatternDMAEnable;
-							ULWord testPatternNumber;
-	
-							ParseNubDownloadTestPatternQueryPacket(recvdNubPkt, &cookie, &channel, &testPatternFrameBufferFormat, &signalMask, &testPatternDMAEnable, &testPatternNumber);
-							// printf("Received download test pattern msg\n");
-	
-							CNTV2Card *card =  FindOpenBoard(cookie);
-							if (card)
-							{
-								cerr << "Obsolete" << endl;
-							}
-							else // Card not found, return failure.
-								cookie = INVALID_NUB_HANDLE;
-							pRespPkt = BuildNubDownloadTestPatternRespPacket(recvdProtoVer, cookie, result);
-						}
-						else if (isNubReadMultiRegisterQueryPacket(recvdNubPkt))
-						{
-							LWord cookie;
-							ULWord numRegs;
-							ULWord result = 0;
-							NTV2RegInfo aRegs[NTV2_NUB_NUM_MULTI_REGS];
-	
-							ParseNubReadRegisterMultiQueryPacket(recvdNubPkt, &cookie, &numRegs, aRegs);
-							// printf("Got multi register read for cookie = 0x%08x, %d registers,\n", cookie, numRegs);
-	
-							CNTV2Card *card =  FindOpenBoard(cookie);
-							ULWord whichRegisterFailed=999;
-							if (card)
-							{
-#if defined(NTV2_DEPRECATE_16_0)
-								NTV2RegisterReads regs;
-								for (ULWord n(0);  n < numRegs;  n++)
-									regs.push_back(aRegs[n]);
-								result = card->ReadRegisters(regs);
-								if (result)
-									for (ULWord n(0);  n < numRegs;  n++)
-										aRegs[n] = regs.at(n);
-#else
-								result = card->ReadRegisterMulti(numRegs, &whichRegisterFailed, aRegs);
-#endif
-								// printf("ReadRegister multi %s, whichRegisterFailed = %d\n", result ? "succeeded" : "failed", whichRegisterFailed); 
-							}
-							else // Card not found, return failure.
-								cookie = INVALID_NUB_HANDLE;
-							pRespPkt = BuildNubReadMultiRegisterRespPacket(recvdProtoVer, cookie, numRegs, aRegs, result, whichRegisterFailed);
-						}
-						else if (isNubDriverGetBuildInformationQueryPacket(recvdNubPkt))
-						{
-							LWord cookie;
-							ULWord result = 0;
-	
-							BUILD_INFO_STRUCT buildInfo;
-							ParseNubDriverGetBuildInformationQueryPacket(recvdNubPkt, &cookie, &buildInfo);
-							// printf("Got driver get buildinfo for cookie = 0x%08x\n", cookie);
-	
-							CNTV2Card *card =  FindOpenBoard(cookie);
-							if (card)
-							{
-								result = card->DriverGetBuildInformation(buildInfo);
-								// printf("GetBuildInfo %s, buildInfo = %s\n", result ? "succeeded" : "failed", buildInfo.buildStr); 
-							}
-							else // Card not found, return failure.
-								cookie = INVALID_NUB_HANDLE;
-							pRespPkt = BuildNubDriverGetBuildInfoRespPacket(recvdProtoVer, cookie, result, &buildInfo);
-						}
-	
-						// Send response
-						int len (pRespPkt ? int(sizeof(NTV2NubPktHeader) + pRespPkt->hdr.dataLength) : 0);
-						if (pRespPkt)
-						{
-							if (NBOifyNTV2NubPkt(pRespPkt)) 
-							{
-								if (::sendall(ifd, (char *)pRespPkt, &len) == -1) 
-									NBFAIL("'sendall' failed: " << ::strerror(errno));
-								else
-									NBDBG("'sendall' " << len << " bytes on fd " << ifd);
-							}
-							delete pRespPkt;
-						}
-					}
-					else
-						for (int jfd(0);  jfd <= fdmax;  jfd++) // send to everyone!  They love us!
-							if (FD_ISSET(jfd, &master)) 
-								if (jfd != listener  &&  jfd != ifd)	//	except the listener and ourselves
-								{
-									if (::send(jfd, buf, nbytes, 0) == -1) 
-										NBFAIL("'send' failed on fd " << jfd << ": " << ::strerror(errno));
-									else
-										NBDBG("'send' " << nbytes << " bytes on fd " << jfd);
-								}
-				}
-			}	//	else handle data from a client
-        }	//	for each existing connection (looking for data to read)
-    }	//	loop forever
+		addrlen = sizeof(remoteaddr);
+		if ((newfd = int(accept(listener, (struct sockaddr *)&remoteaddr, &addrlen))) == -1) 
+			{NBFAIL("'accept' failed: " << ::strerror(errno));  continue;}
+		::setnodelay(newfd);
+		cout << "New connection from " << inet_ntoa(remoteaddr.sin_addr) << " on socket " << newfd << endl;
+		NBINFO("New connection from " << inet_ntoa(remoteaddr.sin_addr) << " on socket " << newfd);
+		if (!StartConnectionThread(newfd))
+			close(newfd);
+	}	//	loop forever
 }	//	RunServer
 
 
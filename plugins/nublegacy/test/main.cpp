@@ -0,0 +1,220 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		main.cpp
+	@brief		Unittests for the legacy nub plug-in's protocol version 4 frame codec (using doctest).
+	@copyright	(C) 2022 AJA Video Systems, Inc. All rights reserved.
+**/
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#define DOCTEST_THREAD_LOCAL
+#include "doctest.h"
+#include "ntv2legacycommon.h"
+#include <string.h>
+#if !defined(MSWindows)
+	#include <unistd.h>
+	#include <arpa/inet.h>
+	#include <pthread.h>
+#endif
+
+using namespace std;
+
+
+static NTV2NubFrameHeader MakeHeader (const ULWord inOpcode, const ULWord inRequestID, const ULWord inPayloadLength)
+{
+	NTV2NubFrameHeader hdr;
+	hdr.magic			= NTV2_NUB_FRAME_MAGIC;
+	hdr.opcode			= inOpcode;
+	hdr.requestID		= inRequestID;
+	hdr.handle			= 0x12345678;
+	hdr.status			= NTV2_REMOTE_ACCESS_WRITE_REG_FAILED;
+	hdr.payloadLength	= inPayloadLength;
+	return hdr;
+}
+
+static void CheckSameHeader (const NTV2NubFrameHeader & inActual, const NTV2NubFrameHeader & inExpected)
+{
+	CHECK_EQ(inActual.magic, inExpected.magic);
+	CHECK_EQ(inActual.opcode, inExpected.opcode);
+	CHECK_EQ(inActual.requestID, inExpected.requestID);
+	CHECK_EQ(inActual.handle, inExpected.handle);
+	CHECK_EQ(inActual.status, inExpected.status);
+	CHECK_EQ(inActual.payloadLength, inExpected.payloadLength);
+}
+
+
+TEST_SUITE("nubframe" * doctest::description("legacy nub protocol version 4 frame codec")) {
+
+	TEST_CASE("NubFrameHeader")
+	{
+		const NTV2NubFrameHeader expected (MakeHeader(eNubFrameDMATransfer, 0xFEDCBA98, 1024));
+		NTV2NubFrameHeader hdr (expected);
+		::NBOifyNTV2NubFrameHeader(hdr);
+		const UByte * pBytes (reinterpret_cast<const UByte*>(&hdr));
+		CHECK_EQ(string(reinterpret_cast<const char*>(pBytes), 4), string("nub4"));	//	Magic goes first, big-endian
+		CHECK_EQ(pBytes[sizeof(hdr) - 1], 0x00);	//	payloadLength 1024 == 0x00000400
+		CHECK_EQ(pBytes[sizeof(hdr) - 2], 0x04);
+		::deNBOifyNTV2NubFrameHeader(hdr);
+		CheckSameHeader(hdr, expected);
+	}	//	TEST_CASE("NubFrameHeader")
+
+	TEST_CASE("NubRegistersPayload")
+	{
+		NTV2RegisterWrites regs;
+		for (ULWord n(0);  n < 300;  n++)
+			regs.push_back(NTV2RegInfo(n * 4 + 1, 0xA5A50000 | n, 0xFFFF0000 >> (n % 16), n % 32));
+
+		vector<char> payload;
+		NTV2RegisterReads decoded;
+		ULWord whichFailed (0);
+
+		SUBCASE("with values")
+		{
+			::EncodeNubRegistersPayload(payload, &regs[0], ULWord(regs.size()), /*withValues*/true, 17);
+			CHECK_EQ(payload.size(), sizeof(NTV2NubRegistersPayloadHeader) + regs.size() * sizeof(NTV2RegInfo));
+			CHECK_EQ(ntohl(reinterpret_cast<const NTV2NubRegistersPayloadHeader*>(&payload[0])->numRegs), ULWord(regs.size()));
+			REQUIRE(::DecodeNubRegistersPayload(payload, decoded, whichFailed));
+			CHECK_EQ(whichFailed, 17);
+			REQUIRE_EQ(decoded.size(), regs.size());
+			for (size_t n(0);  n < regs.size();  n++)
+				CHECK_EQ(decoded[n], regs[n]);
+		}
+		SUBCASE("without values")
+		{
+			::EncodeNubRegistersPayload(payload, &regs[0], ULWord(regs.size()), /*withValues*/false);
+			REQUIRE(::DecodeNubRegistersPayload(payload, decoded, whichFailed));
+			CHECK_EQ(whichFailed, 0);
+			REQUIRE_EQ(decoded.size(), regs.size());
+			for (size_t n(0);  n < regs.size();  n++)
+			{
+				CHECK_EQ(decoded[n].registerNumber, regs[n].registerNumber);
+				CHECK_EQ(decoded[n].registerValue, 0);
+				CHECK_EQ(decoded[n].registerMask, regs[n].registerMask);
+				CHECK_EQ(decoded[n].registerShift, regs[n].registerShift);
+			}
+		}
+		SUBCASE("empty")
+		{
+			::EncodeNubRegistersPayload(payload, AJA_NULL, 0, /*withValues*/true, 5);
+			CHECK_EQ(payload.size(), sizeof(NTV2NubRegistersPayloadHeader));
+			REQUIRE(::DecodeNubRegistersPayload(payload, decoded, whichFailed));
+			CHECK(decoded.empty());
+			CHECK_EQ(whichFailed, 5);
+		}
+		SUBCASE("malformed")
+		{
+			::EncodeNubRegistersPayload(payload, &regs[0], ULWord(regs.size()), /*withValues*/true);
+			payload.pop_back();		//	Truncated register
+			CHECK_FALSE(::DecodeNubRegistersPayload(payload, decoded, whichFailed));
+			CHECK(decoded.empty());
+			payload.resize(sizeof(NTV2NubRegistersPayloadHeader) - 1);	//	Truncated header
+			CHECK_FALSE(::DecodeNubRegistersPayload(payload, decoded, whichFailed));
+		}
+	}	//	TEST_CASE("NubRegistersPayload")
+
+#if !defined(MSWindows)
+	struct TrickleParams
+	{
+		int				fd;
+		vector<char>	bytes;
+	};
+
+	//	Writes one byte at a time, so the reader sees every possible short read
+	static void * TrickleBytes (void * pParams)
+	{
+		const TrickleParams & params (*reinterpret_cast<TrickleParams*>(pParams));
+		for (size_t n(0);  n < params.bytes.size();  n++)
+		{
+			if (::write(params.fd, &params.bytes[n], 1) != 1)
+				break;
+			::usleep(200);
+		}
+		return AJA_NULL;
+	}
+
+	TEST_CASE("NubFrameSocket")
+	{
+		int fds[2] = {-1, -1};
+		REQUIRE_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+		vector<char> payload(5000), received;
+		for (size_t n(0);  n < payload.size();  n++)
+			payload[n] = char(n * 7);
+		NTV2NubFrameHeader expected (MakeHeader(eNubFrameDMAData, 42, ULWord(payload.size())));
+		NTV2NubFrameHeader hdr;
+		::memset(&hdr, 0, sizeof(hdr));
+
+		SUBCASE("round trip")
+		{
+			REQUIRE_EQ(::sendframe(fds[0], expected, &payload[0]), 0);
+			REQUIRE_EQ(::recvframeheader(fds[1], hdr), 0);
+			CheckSameHeader(hdr, expected);
+			received.resize(hdr.payloadLength);
+			int len (int(hdr.payloadLength));
+			REQUIRE_EQ(::recvall(fds[1], &received[0], &len), 0);
+			CHECK(received == payload);
+		}
+		SUBCASE("empty payload")
+		{
+			expected.payloadLength = 0;
+			REQUIRE_EQ(::sendframe(fds[0], expected, AJA_NULL), 0);
+			REQUIRE_EQ(::recvframeheader(fds[1], hdr), 0);
+			CheckSameHeader(hdr, expected);
+			CHECK_EQ(::sendframe(fds[0], MakeHeader(eNubFrameDMAData, 43, 8), AJA_NULL), -1);	//	Payload missing
+		}
+		SUBCASE("trickled, first word read separately")
+		{	//	As the server does it:  it reads the first word to tell frames from legacy packets
+			expected.payloadLength = 16;
+			NTV2NubFrameHeader wire (expected);
+			::NBOifyNTV2NubFrameHeader(wire);
+			TrickleParams params;
+			params.fd = fds[0];
+			params.bytes.assign(reinterpret_cast<char*>(&wire), reinterpret_cast<char*>(&wire) + sizeof(wire));
+			params.bytes.insert(params.bytes.end(), payload.begin(), payload.begin() + 16);
+			pthread_t writer;
+			REQUIRE_EQ(::pthread_create(&writer, AJA_NULL, TrickleBytes, &params), 0);
+
+			ULWord firstWord (0);
+			int len (int(sizeof(firstWord)));
+			CHECK_EQ(::recvall(fds[1], reinterpret_cast<char*>(&firstWord), &len), 0);
+			CHECK_EQ(len, int(sizeof(firstWord)));
+			CHECK_EQ(ntohl(firstWord), ULWord(NTV2_NUB_FRAME_MAGIC));
+			hdr.magic = firstWord;
+			CHECK_EQ(::recvframeheader(fds[1], hdr, int(sizeof(firstWord))), 0);
+			CheckSameHeader(hdr, expected);
+			received.resize(hdr.payloadLength);
+			len = int(hdr.payloadLength);
+			CHECK_EQ(::recvall(fds[1], &received[0], &len), 0);
+			CHECK(equal(received.begin(), received.end(), payload.begin()));
+			::pthread_join(writer, AJA_NULL);
+		}
+		SUBCASE("bad magic")
+		{
+			expected.magic = ntv2NubProtocolVersion3;	//	A legacy packet
+			expected.payloadLength = 0;
+			REQUIRE_EQ(::sendframe(fds[0], expected, AJA_NULL), 0);
+			CHECK_EQ(::recvframeheader(fds[1], hdr), RECVFRAME_BAD_FRAME);
+		}
+		SUBCASE("oversized payload")
+		{
+			expected.payloadLength = NTV2_NUB_FRAME_MAX_PAYLOAD + 1;
+			NTV2NubFrameHeader wire (expected);
+			::NBOifyNTV2NubFrameHeader(wire);
+			int len (int(sizeof(wire)));
+			REQUIRE_EQ(::sendall(fds[0], reinterpret_cast<char*>(&wire), &len), 0);
+			CHECK_EQ(::recvframeheader(fds[1], hdr), RECVFRAME_BAD_FRAME);
+		}
+		SUBCASE("hang-up mid-header")
+		{
+			NTV2NubFrameHeader wire (expected);
+			::NBOifyNTV2NubFrameHeader(wire);
+			int len (int(sizeof(wire)) - 3);
+			REQUIRE_EQ(::sendall(fds[0], reinterpret_cast<char*>(&wire), &len), 0);
+			::close(fds[0]);
+			fds[0] = -1;
+			CHECK_EQ(::recvframeheader(fds[1], hdr), -1);
+		}
+		if (fds[0] != -1)
+			::close(fds[0]);
+		::close(fds[1]);
+	}	//	TEST_CASE("NubFrameSocket")
+#endif	//	!defined(MSWindows)
+
+} //nubframe
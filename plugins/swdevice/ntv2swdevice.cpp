@@ -8,13 +8,17 @@
 #include "ntv2publicinterface.h"
 #include "ntv2utils.h"
 #include "ntv2version.h"
-//#include "../../../ajadriver/ntv2autocirc.h"		//	<== TBD TBD TBD		Use user-space driver code
 #include "ajabase/system/debug.h"
 #include "ajabase/common/common.h"
 #include "ajabase/system/memory.h"
 #include "ajabase/system/lock.h"
+#include "ajabase/system/thread.h"
+#include "ajabase/system/systemtime.h"
 #include <fstream>
 #include <iomanip>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
 #if defined(AJAMac)
 	#include <CoreFoundation/CoreFoundation.h>
 	#include <dlfcn.h>
@@ -97,7 +101,20 @@ using namespace std;
 
 
 	SHARED MEMORY LAYOUT:
-	[1K Hdr][---- 128MB Reg Memory ----][---------------------------- FB Memory ----------------------------][2MB InternalAC]
+	[1K Hdr][---- 128MB Reg Memory ----][---------------------------- FB Memory ----------------------------][96MB AC State]
+
+
+	AUTOCIRCULATE SIMULATION:
+		A VBI thread (one per client process) ticks at the frame rate in kRegGlobalControl. Each tick bumps the VBI count
+		that every vertical interrupt (output & input) waiter is waiting to see change, and advances the frame ring of every AutoCirculating crosspoint:
+		-	Capture:	The frame being "captured" becomes available for transfer, and the next frame in the ring starts.
+						If the next frame hasn't yet been transferred, the current one is recaptured, and counted as dropped.
+		-	Playout:	The frame on-air has its repeat count decremented. When it reaches zero, the next transferred frame
+						goes on-air. If there isn't one, the current frame repeats, and is counted as dropped.
+		AUTOCIRCULATE_TRANSFER copies video between the host buffer and the ring frame in FB memory, using the frame
+		size from kRegCh1Control (and quad/quad-quad mode). Audio, anc and timecode aren't simulated, and each
+		interlaced frame is treated as one VBI. The AC state lives in device memory, so other processes can query
+		AC status, but only one process at a time should AutoCirculate.
 
 *****************************************************************************************************************************************************/
 
@@ -122,6 +139,49 @@ static AJANTV2FakeDevice *	spFakeDevice		(AJA_NULL);
 static AJALock				sLock;
 
 
+typedef struct _SWAutoCirculate		//	Per-crosspoint AutoCirculate state
+{
+	NTV2AutoCirculateState	fState;
+	LWord					fStartFrame;
+	LWord					fEndFrame;
+	LWord					fActiveFrame;						//	Frame being captured or on-air (-1 if none)
+	ULWord					fFramesProcessed;
+	ULWord					fFramesDropped;
+	ULWord					fOptionFlags;						//	AUTOCIRCULATE_WITH_xxx
+	NTV2AudioSystem			fAudioSystem;
+	ULWord64				fStartAtTime;						//	eStartAutoCircAtTime start time
+	ULWord64				fStartTime;							//	Host time of first VBI after start
+	ULWord64				fVBITime;							//	Host time of most recent VBI
+	ULWord					fValidCount[MAX_FRAMEBUFFERS];		//	Capture: 1 if captured & not yet transferred;  Playout: # VBIs left to play
+	UByte					fPending[MAX_FRAMEBUFFERS];			//	Non-zero while frame is being transferred
+	ULWord64				fFrameTime[MAX_FRAMEBUFFERS];		//	Host time frame went on-air or started capture
+	ULWord64				fUserCookie[MAX_FRAMEBUFFERS];		//	Playout: AUTOCIRCULATE_TRANSFER::acInUserCookie
+} SWAutoCirculate;
+
+typedef struct _SWAutoCirculateState	//	Lives at the start of the AC region of device memory
+{
+	SWAutoCirculate			fChannels[NTV2_NUM_CROSSPOINTS];
+} SWAutoCirculateState;
+
+static const ULWord			sChannelToGlobalControlReg[]	= {	kRegGlobalControl, kRegGlobalControlCh2, kRegGlobalControlCh3, kRegGlobalControlCh4,
+																kRegGlobalControlCh5, kRegGlobalControlCh6, kRegGlobalControlCh7, kRegGlobalControlCh8, 0};
+static const ULWord			sChannelToOutputFrameReg[]		= {	kRegCh1OutputFrame, kRegCh2OutputFrame, kRegCh3OutputFrame, kRegCh4OutputFrame,
+																kRegCh5OutputFrame, kRegCh6OutputFrame, kRegCh7OutputFrame, kRegCh8OutputFrame, 0};
+static const ULWord			sChannelToInputFrameReg[]		= {	kRegCh1InputFrame, kRegCh2InputFrame, kRegCh3InputFrame, kRegCh4InputFrame,
+																kRegCh5InputFrame, kRegCh6InputFrame, kRegCh7InputFrame, kRegCh8InputFrame, 0};
+
+//	VBI generator (one per client process)
+static AJAThread			sVBIThread;
+static bool					sVBIQuit			(false);
+static ULWord				sVBIClients			(0);
+static std::mutex			sVBICountMutex;		//	Guards sVBICount
+static std::condition_variable	sVBICountChanged;	//	Notified each time sVBICount changes
+static ULWord64				sVBICount			(0);	//	Number of VBIs so far -- waiters wait for it to change
+
+static inline ULWord64 SWHostTime (void)	{return ULWord64(AJATime::GetSystemMicroseconds()) * 10ULL;}	//	100ns units, like the drivers
+static inline LWord NextFrame (const SWAutoCirculate & inAC, const LWord inFrame)	{return inFrame >= inAC.fEndFrame ? inAC.fStartFrame : inFrame + 1;}
+
+
 typedef map<string, string>				AJADictionary;
 typedef AJADictionary::const_iterator	AJADictionaryConstIter;
 
@@ -162,7 +222,23 @@ class NTV2SoftwareDevice : public NTV2RPCAPI
 		virtual bool					InitRegsFromSupportLog		(const string & inLogFilePath);
 		static uint32_t					GetSDRAMDumpFileSize		(const string & inFilePath);
 		virtual bool					InitSDRAMFromFile			(const string & inFilePath);
-//		virtual NTV2AutoCirc *			ACContext (void)			{return mpContext;}
+		virtual SWAutoCirculate *		ACChannel					(const NTV2Crosspoint inCrosspoint);
+		virtual bool					AutoCirculateGetStatus		(AUTOCIRCULATE_STATUS & outStatus);
+		virtual bool					AutoCirculateTransfer		(AUTOCIRCULATE_TRANSFER & inOutXfer);
+		virtual bool					AutoCirculateGetFrameStamp	(FRAME_STAMP & inOutFrameStamp);
+		virtual bool					StartVBIThread				(void);
+		virtual void					StopVBIThread				(void);
+
+	//	Class Methods
+	private:
+		static void						VBIThreadStatic				(AJAThread * pThread, void * pContext);
+		static void						ProcessVBI					(const ULWord64 inHostTime);
+		static ULWord					GetVBIPeriodMicroseconds	(void);
+		static ULWord					GetFrameBufferBytes			(const NTV2Channel inChannel);
+		static ULWord					GetBufferLevel				(const SWAutoCirculate & inAC, const bool inIsInput);
+		static inline ULWord *			Registers					(void)	{return reinterpret_cast<ULWord*>(reinterpret_cast<UByte*>(spFakeDevice) + kOffsetToRegBytes);}
+		static inline SWAutoCirculateState *	ACState				(void)	{return reinterpret_cast<SWAutoCirculateState*>(reinterpret_cast<UByte*>(spFakeDevice) + kOffsetToRegBytes
+																											+ spFakeDevice->fNumRegBytes + spFakeDevice->fNumFBBytes);}
 
 	//	Instance Data
 	private:
@@ -177,7 +253,7 @@ class NTV2SoftwareDevice : public NTV2RPCAPI
 		NTV2DeviceID	mDeviceID;			///< @brief	My device ID, if known
 		uint64_t		mSerialNum;			///< @brief	My serial number, if known
 		string			mHostname;			///< @brief	My "host" name
-//		NTV2AutoCirc*	mpContext;			//	<== TBD TBD TBD		Use user-space driver code
+		bool			mIsVBIClient;		///< @brief	True if I'm keeping the VBI thread running
 };	//	NTV2SoftwareDevice
 
 extern "C"
@@ -213,8 +289,8 @@ NTV2SoftwareDevice::NTV2SoftwareDevice (void * pInDLLHandle, const NTV2ConnectPa
 		mFBReqBytes		(kDefaultNumFBBytes),
 		mDeviceID		(DEVICE_ID_NOTFOUND),
 		mSerialNum		(0),
-        mHostname		(FAKE_DEVICE_SHARE_NAME)
-//		,mpContext		(AJA_NULL)		//	<== TBD TBD TBD		Use user-space driver code
+        mHostname		(FAKE_DEVICE_SHARE_NAME),
+		mIsVBIClient	(false)
 {
 	string queryStr(ConnectParam(kConnectParamQuery));
 	if (!queryStr.empty())
@@ -396,7 +472,7 @@ bool NTV2SoftwareDevice::NTV2Connect (void)
 			mAllMemory.Set(spFakeDevice, fakeDevTotalBytes);
 			mRegMemory.Set(mAllMemory.GetHostAddress(kOffsetToRegBytes),   spFakeDevice->fNumRegBytes);
 			mFBMemory.Set(mAllMemory.GetHostAddress(kOffsetToRegBytes + spFakeDevice->fNumRegBytes),	spFakeDevice->fNumFBBytes);
-			mACMemory.Set(mAllMemory.GetHostAddress(kOffsetToRegBytes + spFakeDevice->fNumFBBytes),		spFakeDevice->fNumACBytes);
+			mACMemory.Set(mAllMemory.GetHostAddress(kOffsetToRegBytes + spFakeDevice->fNumRegBytes + spFakeDevice->fNumFBBytes),	spFakeDevice->fNumACBytes);
 
             spFakeDevice->fClientRefCount++;
 		}	//	if spFakeDevice is NULL
@@ -405,17 +481,15 @@ bool NTV2SoftwareDevice::NTV2Connect (void)
 			mAllMemory.Set(spFakeDevice, fakeDevTotalBytes);
 			mRegMemory.Set(mAllMemory.GetHostAddress(kOffsetToRegBytes),   spFakeDevice->fNumRegBytes);
 			mFBMemory.Set(mAllMemory.GetHostAddress(kOffsetToRegBytes + spFakeDevice->fNumRegBytes),	spFakeDevice->fNumFBBytes);
-			mACMemory.Set(mAllMemory.GetHostAddress(kOffsetToRegBytes + spFakeDevice->fNumFBBytes),		spFakeDevice->fNumACBytes);
+			mACMemory.Set(mAllMemory.GetHostAddress(kOffsetToRegBytes + spFakeDevice->fNumRegBytes + spFakeDevice->fNumFBBytes),	spFakeDevice->fNumACBytes);
 		}
-/*
-		if (mACMemory.GetByteCount() < sizeof(NTV2AutoCirc))
+		if (mACMemory.GetByteCount() < sizeof(SWAutoCirculateState))
 		{
-			NBFAIL(DEC(mACMemory.GetByteCount()) << "-byte AC state memory too small to accommodate " << DEC(sizeof(NTV2AutoCirc)) << "-byte NTV2AutoCirc struct");
+			NBFAIL(DEC(mACMemory.GetByteCount()) << "-byte AC state memory too small to accommodate " << DEC(sizeof(SWAutoCirculateState)) << "-byte SWAutoCirculateState struct");
 			spFakeDevice = AJA_NULL;
 			NTV2Disconnect();
 			return false;
 		}
-		mpContext = mACMemory;*/
 		//	Set registers...
 		if (supportLogPath.empty())	//	supportLogPath specified?
 			InitRegs();	//	Initialize registers to some reasonable default state
@@ -450,6 +524,8 @@ bool NTV2SoftwareDevice::NTV2Connect (void)
 		return false;
 	}
 
+	if (!StartVBIThread())
+		{NTV2Disconnect();  return false;}
 	NBINFO(Description() << " is ready, vers=" << spFakeDevice->fVersion
 			<< " refCnt=" << spFakeDevice->fClientRefCount
 			<< " reg=" << spFakeDevice->fNumRegBytes << " fb=" << spFakeDevice->fNumFBBytes
@@ -459,6 +535,7 @@ bool NTV2SoftwareDevice::NTV2Connect (void)
 
 bool NTV2SoftwareDevice::NTV2Disconnect (void)
 {
+	StopVBIThread();
 	NBINFO("");
 	return true;
 }
@@ -515,7 +592,7 @@ bool NTV2SoftwareDevice::NTV2ReadRegisterRemote (const ULWord inRegNum, ULWord &
 	AJAAutoLock lock(&sLock);
 	if (!mRegMemory)
 		return false;
-	if (inRegNum * sizeof(ULWord) > mRegMemory.GetByteCount())
+	if (inRegNum * sizeof(ULWord) >= mRegMemory.GetByteCount())
 		return false;	//	Bad reg num
 
 	ULWord value(mRegMemory.U32(int(inRegNum)) & inRegMask);
@@ -535,42 +612,176 @@ bool NTV2SoftwareDevice::NTV2WriteRegisterRemote (const ULWord inRegNum, const U
 	AJAAutoLock lock(&sLock);
 	if (!mRegMemory)
 		return false;
-	if (inRegNum * sizeof(ULWord) > mRegMemory.GetByteCount())
+	if (inRegNum * sizeof(ULWord) >= mRegMemory.GetByteCount())
 		return false;	//	Bad reg num
 	uint32_t & reg(mRegMemory.U32(int(inRegNum)));
-//	ULWord oldValue(reg & inRegMask);
-	ULWord newValue(inRegVal & inRegMask);
-	if (inRegShift)
-		newValue <<= inRegShift;
-	reg = newValue;
+	reg = (reg & ~inRegMask)  |  ((inRegVal << inRegShift) & inRegMask);	//	Read-modify-write, like the hardware
 	return true;
 }
 
 
 bool NTV2SoftwareDevice::NTV2AutoCirculateRemote (AUTOCIRCULATE_DATA & autoCircData)
 {
-	autoCircData = AUTOCIRCULATE_DATA();
 	AJAAutoLock lock(&sLock);
-	if (!spFakeDevice)
-		return false;
-	if (spFakeDevice->fVersion != 1)
-		return false;
-	if (!mACMemory)
-		return false;
-	//	INTERNAL_AUTOCIRCULATE_STRUCT * pACStruct = reinterpret_cast<INTERNAL_AUTOCIRCULATE_STRUCT*>(mACMemory.GetHostPointer());
-	//	TBD
-	return true;
+	SWAutoCirculate * pAC (ACChannel(autoCircData.channelSpec));
+	if (!pAC)
+		{NBFAIL("Bad crosspoint " << DEC(autoCircData.channelSpec) << " or not connected");  return false;}
+
+	SWAutoCirculate &	ac			(*pAC);
+	const NTV2Channel	channel		(::NTV2CrosspointToNTV2Channel(autoCircData.channelSpec));
+	const bool			isInput		(NTV2_IS_INPUT_CROSSPOINT(autoCircData.channelSpec));
+	ULWord &			frameReg	(Registers()[isInput ? sChannelToInputFrameReg[channel] : sChannelToOutputFrameReg[channel]]);
+	switch (autoCircData.eCommand)
+	{
+		case eInitAutoCirc:
+		{
+			const LWord startFrame(autoCircData.lVal1), endFrame(autoCircData.lVal2);
+			if (ac.fState != NTV2_AUTOCIRCULATE_DISABLED)
+				{NBFAIL("Ch" << DEC(channel+1) << " already circulating");  return false;}
+			if (startFrame < 0  ||  endFrame < startFrame  ||  endFrame >= LWord(MAX_FRAMEBUFFERS))
+				{NBFAIL("Ch" << DEC(channel+1) << " bad frame range " << DEC(startFrame) << "-" << DEC(endFrame));  return false;}
+			if (ULWord64(endFrame + 1) * ULWord64(GetFrameBufferBytes(channel)) > ULWord64(spFakeDevice->fNumFBBytes))
+				{NBFAIL("Ch" << DEC(channel+1) << " frame " << DEC(endFrame) << " exceeds " << DEC(spFakeDevice->fNumFBBytes) << "-byte FB memory");  return false;}
+			::memset(&ac, 0, sizeof(ac));
+			ac.fStartFrame	= startFrame;
+			ac.fEndFrame	= endFrame;
+			ac.fActiveFrame	= -1;
+			ac.fAudioSystem	= autoCircData.bVal1 ? NTV2AudioSystem(autoCircData.lVal3 & NTV2AudioSystemRemoveValues) : NTV2_AUDIOSYSTEM_INVALID;
+			ac.fOptionFlags	= ULWord(autoCircData.lVal6)
+							| (autoCircData.bVal2 ? AUTOCIRCULATE_WITH_RP188 : 0)			| (autoCircData.bVal3 ? AUTOCIRCULATE_WITH_FBFCHANGE : 0)
+							| (autoCircData.bVal4 ? AUTOCIRCULATE_WITH_FBOCHANGE : 0)		| (autoCircData.bVal5 ? AUTOCIRCULATE_WITH_COLORCORRECT : 0)
+							| (autoCircData.bVal6 ? AUTOCIRCULATE_WITH_VIDPROC : 0)			| (autoCircData.bVal7 ? AUTOCIRCULATE_WITH_ANC : 0)
+							| (autoCircData.bVal8 ? AUTOCIRCULATE_WITH_LTC : 0);
+			ac.fState		= NTV2_AUTOCIRCULATE_INIT;
+			frameReg = ULWord(startFrame);
+			NBINFO("Ch" << DEC(channel+1) << (isInput ? " input" : " output") << " frames " << DEC(startFrame) << "-" << DEC(endFrame));
+			return true;
+		}
+
+		case eStartAutoCirc:
+		case eStartAutoCircAtTime:
+			if (ac.fState != NTV2_AUTOCIRCULATE_INIT)
+				{NBFAIL("Ch" << DEC(channel+1) << " not initialized");  return false;}
+			ac.fStartAtTime = autoCircData.eCommand == eStartAutoCircAtTime  ?  (ULWord64(ULWord(autoCircData.lVal1)) << 32) | ULWord64(ULWord(autoCircData.lVal2))  :  0;
+			ac.fState = ac.fStartAtTime ? NTV2_AUTOCIRCULATE_STARTING_AT_TIME : NTV2_AUTOCIRCULATE_STARTING;
+			return true;
+
+		case eStopAutoCirc:
+			if (ac.fState == NTV2_AUTOCIRCULATE_DISABLED)
+				return false;
+			ac.fState = NTV2_AUTOCIRCULATE_STOPPING;	//	VBI thread will disable it
+			return true;
+
+		case eAbortAutoCirc:
+			if (ac.fState == NTV2_AUTOCIRCULATE_DISABLED)
+				return false;
+			ac.fState = NTV2_AUTOCIRCULATE_DISABLED;
+			return true;
+
+		case ePauseAutoCirc:
+			if (autoCircData.bVal1)	//	Resume?
+			{
+				if (ac.fState != NTV2_AUTOCIRCULATE_PAUSED)
+					return false;
+				if (autoCircData.bVal2)
+					ac.fFramesDropped = 0;
+				ac.fState = NTV2_AUTOCIRCULATE_RUNNING;
+			}
+			else
+			{
+				if (ac.fState != NTV2_AUTOCIRCULATE_RUNNING  &&  ac.fState != NTV2_AUTOCIRCULATE_STARTING)
+					return false;
+				ac.fState = NTV2_AUTOCIRCULATE_PAUSED;
+			}
+			return true;
+
+		case eFlushAutoCirculate:
+			if (ac.fState == NTV2_AUTOCIRCULATE_DISABLED)
+				return false;
+			for (LWord frame(ac.fStartFrame);  frame <= ac.fEndFrame;  frame++)
+				if (isInput  ||  frame != ac.fActiveFrame)	//	Playout:  leave the on-air frame alone
+					ac.fValidCount[frame] = 0;
+			if (autoCircData.bVal1)
+				ac.fFramesDropped = 0;
+			return true;
+
+		case ePrerollAutoCirculate:
+		{	//	Add the preroll count to the most recently transferred playout frame...
+			if (isInput  ||  ac.fState == NTV2_AUTOCIRCULATE_DISABLED)
+				return false;
+			LWord frame (ac.fActiveFrame < 0 ? ac.fStartFrame : ac.fActiveFrame),  lastFrame(-1);
+			for (LWord num(0);  num <= ac.fEndFrame - ac.fStartFrame  &&  ac.fValidCount[frame];  num++)
+				{lastFrame = frame;  frame = NextFrame(ac, frame);}
+			if (lastFrame < 0)
+				return false;
+			const LWord newCount (LWord(ac.fValidCount[lastFrame]) + autoCircData.lVal1);
+			ac.fValidCount[lastFrame] = ULWord(newCount > 0 ? newCount : 1);
+			return true;
+		}
+
+		case eSetActiveFrame:
+			if (ac.fState == NTV2_AUTOCIRCULATE_DISABLED  ||  autoCircData.lVal1 < ac.fStartFrame  ||  autoCircData.lVal1 > ac.fEndFrame)
+				return false;
+			ac.fActiveFrame = autoCircData.lVal1;
+			frameReg = ULWord(ac.fActiveFrame);
+			return true;
+
+		case eGetAutoCirc:
+		{
+			AUTOCIRCULATE_STATUS_STRUCT * pStatus (reinterpret_cast<AUTOCIRCULATE_STATUS_STRUCT*>(autoCircData.pvVal1));
+			if (!pStatus)
+				return false;
+			pStatus->state					= ac.fState;
+			pStatus->startFrame				= ac.fStartFrame;
+			pStatus->endFrame				= ac.fEndFrame;
+			pStatus->activeFrame			= ac.fActiveFrame;
+			pStatus->rdtscStartTime			= ac.fStartTime;
+			pStatus->audioClockStartTime	= ac.fStartTime;
+			pStatus->rdtscCurrentTime		= SWHostTime();
+			pStatus->audioClockCurrentTime	= pStatus->rdtscCurrentTime;
+			pStatus->framesProcessed		= ac.fFramesProcessed;
+			pStatus->framesDropped			= ac.fFramesDropped;
+			pStatus->bufferLevel			= GetBufferLevel(ac, isInput);
+			pStatus->bWithAudio				= NTV2_IS_VALID_AUDIO_SYSTEM(ac.fAudioSystem);
+			pStatus->bWithRP188				= (ac.fOptionFlags & AUTOCIRCULATE_WITH_RP188) ? true : false;
+			pStatus->bFbfChange				= (ac.fOptionFlags & AUTOCIRCULATE_WITH_FBFCHANGE) ? true : false;
+			pStatus->bFboChange				= (ac.fOptionFlags & AUTOCIRCULATE_WITH_FBOCHANGE) ? true : false;
+			pStatus->bWithColorCorrection	= (ac.fOptionFlags & AUTOCIRCULATE_WITH_COLORCORRECT) ? true : false;
+			pStatus->bWithVidProc			= (ac.fOptionFlags & AUTOCIRCULATE_WITH_VIDPROC) ? true : false;
+			pStatus->bWithCustomAncData		= (ac.fOptionFlags & AUTOCIRCULATE_WITH_ANC) ? true : false;
+			return true;
+		}
+
+		default:
+			break;
+	}
+	NBFAIL("Unsupported AutoCirculate command " << DEC(autoCircData.eCommand));
+	return false;
 }
 
 bool NTV2SoftwareDevice::NTV2WaitForInterruptRemote (const INTERRUPT_ENUMS eInterrupt, const ULWord timeOutMs)
-{	(void)eInterrupt; (void)timeOutMs;
-	AJAAutoLock lock(&sLock);
-	if (!spFakeDevice)
-		return false;
-	if (spFakeDevice->fVersion != 1)
-		return false;
-	//	TBD
-	return true;
+{
+	switch (eInterrupt)
+	{	//	Only vertical interrupts are simulated, and they all happen at once
+		case eVerticalInterrupt:	case eOutput2:	case eOutput3:	case eOutput4:	case eOutput5:	case eOutput6:	case eOutput7:	case eOutput8:
+		case eInput1:	case eInput2:	case eInput3:	case eInput4:	case eInput5:	case eInput6:	case eInput7:	case eInput8:
+			break;
+		default:
+			NBDBG("Interrupt " << DEC(eInterrupt) << " not simulated");
+			return false;
+	}
+
+	{
+		AJAAutoLock lock(&sLock);
+		if (!spFakeDevice  ||  !mIsVBIClient)
+			return false;
+	}
+	//	Wait for the VBI count to change. The count is sampled and tested under the same mutex the VBI thread
+	//	bumps it under, so a VBI that happens between sampling and waiting can't be missed...
+	std::unique_lock<std::mutex> countLock(sVBICountMutex);
+	const ULWord64 startCount (sVBICount);
+	return sVBICountChanged.wait_for (countLock, std::chrono::milliseconds(timeOutMs),
+										[startCount]{return sVBICount != startCount;});
 }
 
 bool NTV2SoftwareDevice::NTV2DMATransferRemote (const NTV2DMAEngine inDMAEngine,	const bool inIsRead,
@@ -586,26 +797,31 @@ bool NTV2SoftwareDevice::NTV2DMATransferRemote (const NTV2DMAEngine inDMAEngine,
 	if (!inSynchronous)
 		return false;	//	Must be synchronous
 
+	const ULWord64 cardOffset (ULWord64(inFrameNumber) * ULWord64(GetFrameBufferBytes(NTV2_CHANNEL1)) + ULWord64(inCardOffsetBytes));
+	if (cardOffset >= ULWord64(mFBMemory.GetByteCount()))
+		{NBFAIL("Frame " << DEC(inFrameNumber) << " offset " << xHEX0N(inCardOffsetBytes,8) << " past end of FB memory");  return false;}
+
 	if (inNumSegments)
 	{
 		NTV2SegmentedXferInfo	xferInfo;
-		xferInfo.setDestOffset(inCardOffsetBytes).setSegmentCount(inNumSegments);
+		xferInfo.setSegmentCount(inNumSegments);
 		xferInfo.setSegmentLength(inOutBuffer.GetByteCount() / inNumSegments);
-		xferInfo.setSourceOffset(0);
-		xferInfo.setSourcePitch(inSegmentHostPitch);
-		xferInfo.setDestOffset(inFrameNumber * 8ULL*1024ULL*1024ULL + inCardOffsetBytes);	//	!!! ASSUMES 8MB FRAMES!
-		xferInfo.setDestPitch(inSegmentCardPitch);
 		if (inIsRead)
+		{
+			xferInfo.setSourceOffset(ULWord(cardOffset)).setSourcePitch(inSegmentCardPitch);
+			xferInfo.setDestOffset(0).setDestPitch(inSegmentHostPitch);
 			return inOutBuffer.CopyFrom(mFBMemory, xferInfo);
-		else
-			return mFBMemory.CopyFrom(inOutBuffer, xferInfo);
+		}
+		xferInfo.setSourceOffset(0).setSourcePitch(inSegmentHostPitch);
+		xferInfo.setDestOffset(ULWord(cardOffset)).setDestPitch(inSegmentCardPitch);
+		return mFBMemory.CopyFrom(inOutBuffer, xferInfo);
 	}
 	else
 	{
 		if (inIsRead)
-			return inOutBuffer.CopyFrom(mFBMemory, inFrameNumber * 8UL*1024ULL*1024ULL,  0,  inOutBuffer.GetByteCount());
+			return inOutBuffer.CopyFrom(mFBMemory, ULWord(cardOffset),  0,  inOutBuffer.GetByteCount());
 		else
-			return mFBMemory.CopyFrom(inOutBuffer, inFrameNumber * 8UL*1024ULL*1024ULL,  0,  inOutBuffer.GetByteCount());
+			return mFBMemory.CopyFrom(inOutBuffer, 0,  ULWord(cardOffset),  inOutBuffer.GetByteCount());
 	}
 }
 
@@ -622,39 +838,414 @@ bool NTV2SoftwareDevice::NTV2MessageRemote (NTV2_HEADER * pInMessage)
 		{NBFAIL("Struct size smaller than NTV2_HEADER and NTV2_TRAILER size");  return false;}
 	if (pInMessage->GetPointerSize() != 4  &&  pInMessage->GetPointerSize() != 8)
 		{NBFAIL("Host pointer size " << DEC(pInMessage->GetPointerSize()) << " must be 4 or 8");  return false;}
-	const NTV2_TRAILER * pTrailer = reinterpret_cast<const NTV2_TRAILER*>(reinterpret_cast<const UByte*>(pInMessage) + pInMessage->GetSizeInBytes() - sizeof(NTV2_TRAILER));
-	if (!NTV2_IS_VALID_TRAILER_TAG(pTrailer->fTrailerTag))
-		{NBFAIL("Bad NTV2_TRAILER tag");  return false;}
 
-	//	Dispatch...
-/**	switch (pInMessage->GetType())
+	//	Dispatch...	(the struct may be padded past its trailer, so each is checked via its own acTrailer)
+	switch (pInMessage->GetType())
 	{
-		case NTV2_TYPE_ACSTATUS:		return !AutoCirculateGetStatus (ACContext(), AsAUTOCIRCULATE_STATUS(pInMessage));
-		case NTV2_TYPE_ACXFER:			return !AutoCirculateTransfer (ACContext(), AsAUTOCIRCULATE_TRANSFER(pInMessage));
-//		case NTV2_TYPE_GETREGS:			return GetRegistersImmediate (ACContext(), AsNTV2GetRegisters(pInMessage));
-//		case NTV2_TYPE_SETREGS:			return SetRegistersImmediate (AsNTV2SetRegisters(pInMessage));
-		case NTV2_TYPE_ACFRAMESTAMP:	return AutoCirculateFrameStampImmediate (AsFRAME_STAMP(pInMessage), pClientTask);
-		case NTV2_TYPE_AJABUFFERLOCK:	return BufferLockImmediate (AsNTV2BufferLock(pInMessage), pClientTask);
-		case NTV2_TYPE_AJABITSTREAM:	return BitstreamImmediate (AsNTV2Bitstream(pInMessage), pClientTask);
-
-		case NTV2_TYPE_BANKGETSET:
-			if (AsNTV2BankSelGetSetRegs(pInOutStruct)->mIsWriting)
-				return BankSelSetRegistersImmediate (AsNTV2BankSelGetSetRegs (pInOutStruct));
-			else
-				return BankSelGetRegistersImmediate (AsNTV2BankSelGetSetRegs (pInOutStruct));
-
-		case NTV2_TYPE_VIRTUAL_DATA_RW:
-			if (AsNTV2NTV2VirtualData (pInOutStruct)->mIsWriting)
-				return VirtualDataSetImmediate (AsNTV2NTV2VirtualData (pInOutStruct));
-			else
-				return VirtualDataGetImmediate (AsNTV2NTV2VirtualData (pInOutStruct));
+		case NTV2_TYPE_ACSTATUS:
+		{	AUTOCIRCULATE_STATUS & status (*AsAUTOCIRCULATE_STATUS(pInMessage));
+			if (!status.acTrailer.IsValid())
+				{NBFAIL("Bad NTV2_TRAILER tag");  return false;}
+			return AutoCirculateGetStatus(status);
+		}
+		case NTV2_TYPE_ACXFER:
+		{	AUTOCIRCULATE_TRANSFER & xfer (*AsAUTOCIRCULATE_TRANSFER(pInMessage));
+			if (!xfer.acTrailer.IsValid())
+				{NBFAIL("Bad NTV2_TRAILER tag");  return false;}
+			return AutoCirculateTransfer(xfer);
+		}
+		case NTV2_TYPE_ACFRAMESTAMP:
+		{	FRAME_STAMP & frameStamp (*AsFRAME_STAMP(pInMessage));
+			if (!frameStamp.acTrailer.IsValid())
+				{NBFAIL("Bad NTV2_TRAILER tag");  return false;}
+			return AutoCirculateGetFrameStamp(frameStamp);
+		}
 		default:	break;
 	}
-**/
-	NBFAIL("Unhandled message type " << xHEX0N(pInMessage->GetType(),8));
+	//	Others (e.g. GETREGS/SETREGS) are unhandled -- the SDK falls back to individual register reads/writes
+	NBDBG("Unhandled message type " << xHEX0N(pInMessage->GetType(),8));
 	return false;
 }
 
+
+SWAutoCirculate * NTV2SoftwareDevice::ACChannel (const NTV2Crosspoint inCrosspoint)
+{
+	if (!spFakeDevice  ||  !mACMemory)
+		return AJA_NULL;
+	if (!NTV2_IS_VALID_NTV2CROSSPOINT(inCrosspoint))
+		return AJA_NULL;
+	return &ACState()->fChannels[inCrosspoint];
+}
+
+bool NTV2SoftwareDevice::AutoCirculateGetStatus (AUTOCIRCULATE_STATUS & outStatus)
+{
+	AJAAutoLock lock(&sLock);
+	const SWAutoCirculate * pAC (ACChannel(outStatus.acCrosspoint));
+	if (!pAC)
+		{NBFAIL("Bad crosspoint " << DEC(outStatus.acCrosspoint));  return false;}
+	const SWAutoCirculate & ac(*pAC);
+	outStatus.acState					= ac.fState;
+	outStatus.acStartFrame				= ac.fStartFrame;
+	outStatus.acEndFrame				= ac.fEndFrame;
+	outStatus.acActiveFrame				= ac.fActiveFrame;
+	outStatus.acRDTSCStartTime			= ac.fStartTime;
+	outStatus.acAudioClockStartTime		= ac.fStartTime;
+	outStatus.acRDTSCCurrentTime		= SWHostTime();
+	outStatus.acAudioClockCurrentTime	= outStatus.acRDTSCCurrentTime;
+	outStatus.acFramesProcessed			= ac.fFramesProcessed;
+	outStatus.acFramesDropped			= ac.fFramesDropped;
+	outStatus.acBufferLevel				= GetBufferLevel(ac, NTV2_IS_INPUT_CROSSPOINT(outStatus.acCrosspoint));
+	outStatus.acOptionFlags				= ac.fOptionFlags;
+	outStatus.acAudioSystem				= ac.fAudioSystem;
+	return true;
+}
+
+bool NTV2SoftwareDevice::AutoCirculateTransfer (AUTOCIRCULATE_TRANSFER & inOutXfer)
+{
+	const NTV2Crosspoint	crosspoint	(inOutXfer.acCrosspoint);
+	const bool				isInput		(NTV2_IS_INPUT_CROSSPOINT(crosspoint));
+	AUTOCIRCULATE_TRANSFER_STATUS &	xferStatus	(inOutXfer.acTransferStatus);
+	xferStatus.acTransferFrame = -1;
+	xferStatus.acAudioTransferSize = xferStatus.acAncTransferSize = xferStatus.acAncField2TransferSize = 0;
+
+	//	Pick the frame to transfer, and mark it pending...
+	LWord	frame		(-1);
+	ULWord	frameBytes	(0);
+	{
+		AJAAutoLock lock(&sLock);
+		SWAutoCirculate * pAC (ACChannel(crosspoint));
+		if (!pAC)
+			{NBFAIL("Bad crosspoint " << DEC(crosspoint));  return false;}
+		SWAutoCirculate & ac(*pAC);
+		xferStatus.acState = ac.fState;
+		if (ac.fState == NTV2_AUTOCIRCULATE_DISABLED  ||  ac.fState == NTV2_AUTOCIRCULATE_STOPPING)
+			{NBFAIL("Crosspoint " << DEC(crosspoint) << " not circulating");  return false;}
+
+		const LWord numFrames (ac.fEndFrame - ac.fStartFrame + 1);
+		if (inOutXfer.acDesiredFrame >= ac.fStartFrame  &&  inOutXfer.acDesiredFrame <= ac.fEndFrame)
+		{
+			if (!ac.fPending[inOutXfer.acDesiredFrame]  &&  inOutXfer.acDesiredFrame != ac.fActiveFrame)
+				if ((isInput && ac.fValidCount[inOutXfer.acDesiredFrame])  ||  (!isInput && !ac.fValidCount[inOutXfer.acDesiredFrame]))
+					frame = inOutXfer.acDesiredFrame;
+		}
+		else if (isInput)
+		{	//	Oldest captured frame is the first valid one after the frame being captured...
+			if (ac.fState == NTV2_AUTOCIRCULATE_RUNNING  ||  ac.fState == NTV2_AUTOCIRCULATE_PAUSED)
+				for (LWord num(0), f(NextFrame(ac, ac.fActiveFrame));  num < numFrames - 1  &&  frame < 0;  num++, f = NextFrame(ac, f))
+					if (ac.fValidCount[f]  &&  !ac.fPending[f])
+						frame = f;
+		}
+		else
+		{	//	First empty frame, starting after the on-air frame (or at the start frame if not yet started)...
+			const bool notStarted (ac.fActiveFrame < 0);
+			LWord f (notStarted ? ac.fStartFrame : NextFrame(ac, ac.fActiveFrame));
+			for (LWord num(notStarted ? 0 : 1);  num < numFrames  &&  frame < 0;  num++, f = NextFrame(ac, f))
+				if (!ac.fValidCount[f]  &&  !ac.fPending[f])
+					frame = f;
+		}
+		if (frame < 0)
+		{
+			xferStatus.acBufferLevel = GetBufferLevel(ac, isInput);
+			NBDBG("Crosspoint " << DEC(crosspoint) << " has no frame available");
+			return false;
+		}
+		ac.fPending[frame] = 1;
+		frameBytes = GetFrameBufferBytes(::NTV2CrosspointToNTV2Channel(crosspoint));
+	}
+
+	//	Copy the video without holding the lock, so other channels & the VBI thread can run...
+	bool ok(true);
+	NTV2Buffer & hostBuffer (inOutXfer.acVideoBuffer);
+	const ULWord64 frameOffset (ULWord64(frame) * ULWord64(frameBytes) + ULWord64(inOutXfer.acInVideoDMAOffset));
+	if (hostBuffer  &&  inOutXfer.acInVideoDMAOffset < frameBytes  &&  frameOffset < ULWord64(mFBMemory.GetByteCount()))
+	{
+		const NTV2SegmentedDMAInfo & segInfo (inOutXfer.acInSegmentedDMAInfo);
+		if (segInfo.acNumSegments > 1)
+		{
+			NTV2SegmentedXferInfo xferInfo;
+			xferInfo.setSegmentCount(segInfo.acNumSegments).setSegmentLength(segInfo.acNumActiveBytesPerRow);
+			if (isInput)
+			{
+				xferInfo.setSourceOffset(ULWord(frameOffset)).setSourcePitch(segInfo.acSegmentDevicePitch);
+				xferInfo.setDestOffset(0).setDestPitch(segInfo.acSegmentHostPitch);
+				ok = hostBuffer.CopyFrom(mFBMemory, xferInfo);
+			}
+			else
+			{
+				xferInfo.setSourceOffset(0).setSourcePitch(segInfo.acSegmentHostPitch);
+				xferInfo.setDestOffset(ULWord(frameOffset)).setDestPitch(segInfo.acSegmentDevicePitch);
+				ok = mFBMemory.CopyFrom(hostBuffer, xferInfo);
+			}
+		}
+		else
+		{
+			ULWord byteCount (hostBuffer.GetByteCount());
+			if (byteCount > frameBytes - inOutXfer.acInVideoDMAOffset)
+				byteCount = frameBytes - inOutXfer.acInVideoDMAOffset;	//	Don't spill into the next frame
+			if (isInput)
+				ok = hostBuffer.CopyFrom(mFBMemory, ULWord(frameOffset), 0, byteCount);
+			else
+				ok = mFBMemory.CopyFrom(hostBuffer, 0, ULWord(frameOffset), byteCount);
+		}
+	}
+
+	//	Update the ring...
+	AJAAutoLock lock(&sLock);
+	SWAutoCirculate * pAC (ACChannel(crosspoint));
+	if (!pAC)
+		return false;
+	SWAutoCirculate & ac(*pAC);
+	ac.fPending[frame] = 0;
+	if (ok)
+	{
+		if (isInput)
+			ac.fValidCount[frame] = 0;	//	Free for capture
+		else
+		{
+			ac.fValidCount[frame] = inOutXfer.acFrameRepeatCount ? inOutXfer.acFrameRepeatCount : 1;
+			ac.fUserCookie[frame] = inOutXfer.acInUserCookie;
+		}
+		ac.fFramesProcessed++;
+	}
+	else
+		NBFAIL("Crosspoint " << DEC(crosspoint) << " frame " << DEC(frame) << " video copy failed");
+
+	FRAME_STAMP & stamp (xferStatus.acFrameStamp);
+	xferStatus.acState				= ac.fState;
+	xferStatus.acTransferFrame		= ok ? frame : -1;
+	xferStatus.acBufferLevel		= GetBufferLevel(ac, isInput);
+	xferStatus.acFramesProcessed	= ac.fFramesProcessed;
+	xferStatus.acFramesDropped		= ac.fFramesDropped;
+	stamp.acFrameTime				= LWord64(ac.fFrameTime[frame]);
+	stamp.acRequestedFrame			= ULWord(frame);
+	stamp.acAudioClockTimeStamp		= ac.fFrameTime[frame];
+	stamp.acCurrentTime				= LWord64(SWHostTime());
+	stamp.acCurrentFrame			= ULWord(ac.fActiveFrame);
+	stamp.acCurrentFrameTime		= ac.fActiveFrame >= 0  ?  LWord64(ac.fFrameTime[ac.fActiveFrame])  :  0;
+	stamp.acAudioClockCurrentTime	= ULWord64(stamp.acCurrentTime);
+	stamp.acCurrentReps				= ac.fActiveFrame >= 0  ?  ac.fValidCount[ac.fActiveFrame]  :  0;
+	stamp.acCurrentUserCookie		= ac.fActiveFrame >= 0  ?  ac.fUserCookie[ac.fActiveFrame]  :  0;
+	stamp.acFrame					= ULWord(frame);
+	return ok;
+}
+
+bool NTV2SoftwareDevice::AutoCirculateGetFrameStamp (FRAME_STAMP & inOutFrameStamp)
+{
+	//	On entry, acFrameTime has the NTV2Channel of interest
+	const NTV2Channel channel (NTV2Channel(inOutFrameStamp.acFrameTime));
+	if (!NTV2_IS_VALID_CHANNEL(channel))
+		return false;
+	AJAAutoLock lock(&sLock);
+	SWAutoCirculate * pAC (ACChannel(::NTV2ChannelToInputCrosspoint(channel)));
+	if (pAC  &&  pAC->fState == NTV2_AUTOCIRCULATE_DISABLED)
+		pAC = ACChannel(::NTV2ChannelToOutputCrosspoint(channel));
+	if (!pAC  ||  pAC->fState == NTV2_AUTOCIRCULATE_DISABLED)
+		return false;
+	const SWAutoCirculate & ac(*pAC);
+	const LWord frame (LWord(inOutFrameStamp.acRequestedFrame));
+	if (frame < ac.fStartFrame  ||  frame > ac.fEndFrame)
+		return false;
+	inOutFrameStamp.acFrameTime				= LWord64(ac.fFrameTime[frame]);
+	inOutFrameStamp.acAudioClockTimeStamp	= ac.fFrameTime[frame];
+	inOutFrameStamp.acCurrentTime			= LWord64(SWHostTime());
+	inOutFrameStamp.acCurrentFrame			= ULWord(ac.fActiveFrame);
+	inOutFrameStamp.acCurrentFrameTime		= ac.fActiveFrame >= 0  ?  LWord64(ac.fFrameTime[ac.fActiveFrame])  :  0;
+	inOutFrameStamp.acAudioClockCurrentTime	= ULWord64(inOutFrameStamp.acCurrentTime);
+	inOutFrameStamp.acCurrentReps			= ac.fActiveFrame >= 0  ?  ac.fValidCount[ac.fActiveFrame]  :  0;
+	inOutFrameStamp.acCurrentUserCookie		= ac.fActiveFrame >= 0  ?  ac.fUserCookie[ac.fActiveFrame]  :  0;
+	inOutFrameStamp.acFrame					= ULWord(frame);
+	return true;
+}
+
+
+bool NTV2SoftwareDevice::StartVBIThread (void)
+{
+	AJAAutoLock lock(&sLock);
+	if (mIsVBIClient)
+		return true;
+	if (!sVBIClients)
+	{
+		sVBIQuit = false;
+		if (AJA_FAILURE(sVBIThread.Attach(VBIThreadStatic, AJA_NULL)))
+			{NBFAIL("VBI thread attach failed");  return false;}
+		sVBIThread.SetPriority(AJA_ThreadPriority_TimeCritical);
+		if (AJA_FAILURE(sVBIThread.Start()))
+			{NBFAIL("VBI thread start failed");  return false;}
+		NBINFO("VBI thread started, period " << DEC(GetVBIPeriodMicroseconds()) << "us");
+	}
+	sVBIClients++;
+	mIsVBIClient = true;
+	return true;
+}
+
+void NTV2SoftwareDevice::StopVBIThread (void)
+{
+	{
+		AJAAutoLock lock(&sLock);
+		if (!mIsVBIClient)
+			return;
+		mIsVBIClient = false;
+		if (--sVBIClients)
+			return;	//	Others still using it
+		sVBIQuit = true;
+	}
+	sVBIThread.Stop();	//	Without the lock, so the thread can finish its last tick
+	NBINFO("VBI thread stopped");
+}
+
+void NTV2SoftwareDevice::VBIThreadStatic (AJAThread * pThread, void * pContext)
+{	(void) pThread;  (void) pContext;
+	uint64_t nextVBI (AJATime::GetSystemMicroseconds());
+	while (true)
+	{
+		ULWord periodUS(0);
+		{
+			AJAAutoLock lock(&sLock);
+			if (sVBIQuit  ||  !spFakeDevice)
+				break;
+			periodUS = GetVBIPeriodMicroseconds();
+			ProcessVBI(SWHostTime());
+		}
+		{
+			std::lock_guard<std::mutex> countLock(sVBICountMutex);
+			sVBICount++;
+		}
+		sVBICountChanged.notify_all();	//	Wake every waiter -- each returns once it sees the count change
+
+		nextVBI += periodUS;
+		const uint64_t now (AJATime::GetSystemMicroseconds());
+		if (nextVBI > now)
+			AJATime::SleepInMicroseconds(int32_t(nextVBI - now));
+		else if (now - nextVBI > periodUS)
+			nextVBI = now;	//	Fell more than a frame behind (e.g. stopped in debugger) -- resync instead of bursting
+	}
+}
+
+void NTV2SoftwareDevice::ProcessVBI (const ULWord64 inHostTime)
+{
+	ULWord * pRegs (Registers());
+	SWAutoCirculateState & state (*ACState());
+	for (unsigned xpt(0);  xpt < NTV2_NUM_CROSSPOINTS;  xpt++)
+	{
+		const NTV2Crosspoint crosspoint = NTV2Crosspoint(xpt);
+		if (!NTV2_IS_VALID_NTV2CROSSPOINT(crosspoint))
+			continue;
+		SWAutoCirculate & ac (state.fChannels[xpt]);
+		const NTV2Channel	channel		(::NTV2CrosspointToNTV2Channel(crosspoint));
+		const bool			isInput		(NTV2_IS_INPUT_CROSSPOINT(crosspoint));
+		ULWord &			frameReg	(pRegs[isInput ? sChannelToInputFrameReg[channel] : sChannelToOutputFrameReg[channel]]);
+		switch (ac.fState)
+		{
+			case NTV2_AUTOCIRCULATE_STOPPING:
+				ac.fState = NTV2_AUTOCIRCULATE_DISABLED;
+				ac.fActiveFrame = -1;
+				break;
+
+			case NTV2_AUTOCIRCULATE_STARTING_AT_TIME:
+				if (inHostTime < ac.fStartAtTime)
+					break;
+				//	Fall thru
+			case NTV2_AUTOCIRCULATE_STARTING:
+				ac.fActiveFrame = ac.fStartFrame;
+				ac.fStartTime = ac.fVBITime = inHostTime;
+				ac.fFrameTime[ac.fActiveFrame] = inHostTime;
+				if (isInput)
+					ac.fValidCount[ac.fActiveFrame] = 0;	//	Now capturing into it
+				frameReg = ULWord(ac.fActiveFrame);
+				ac.fState = NTV2_AUTOCIRCULATE_RUNNING;
+				break;
+
+			case NTV2_AUTOCIRCULATE_RUNNING:
+			{
+				ac.fVBITime = inHostTime;
+				const LWord nextFrame (NextFrame(ac, ac.fActiveFrame));
+				if (isInput)
+				{	//	Capture of active frame is done -- start the next one, unless it's still waiting to be transferred...
+					ac.fValidCount[ac.fActiveFrame] = 1;
+					if (nextFrame == ac.fActiveFrame  ||  ac.fValidCount[nextFrame]  ||  ac.fPending[nextFrame])
+					{
+						ac.fValidCount[ac.fActiveFrame] = 0;	//	Recapture into the same frame
+						ac.fFramesDropped++;
+					}
+					else
+						ac.fActiveFrame = nextFrame;
+					ac.fFrameTime[ac.fActiveFrame] = inHostTime;
+				}
+				else
+				{	//	Play the on-air frame once more, then move to the next one, if it's been transferred...
+					if (ac.fValidCount[ac.fActiveFrame])
+						ac.fValidCount[ac.fActiveFrame]--;
+					if (ac.fValidCount[ac.fActiveFrame])
+						break;	//	Repeating
+					if (nextFrame != ac.fActiveFrame  &&  ac.fValidCount[nextFrame]  &&  !ac.fPending[nextFrame])
+					{
+						ac.fActiveFrame = nextFrame;
+						ac.fFrameTime[ac.fActiveFrame] = inHostTime;
+					}
+					else
+						ac.fFramesDropped++;	//	Underrun -- active frame repeats
+				}
+				frameReg = ULWord(ac.fActiveFrame);
+				break;
+			}
+
+			default:	//	Disabled, Init, Paused
+				break;
+		}
+	}
+}
+
+ULWord NTV2SoftwareDevice::GetVBIPeriodMicroseconds (void)
+{
+	const ULWord	globalControl	(Registers()[kRegGlobalControl]);
+	const NTV2FrameRate	frameRate	(NTV2FrameRate(((globalControl & kRegMaskFrameRate) >> kRegShiftFrameRate)
+												| (((globalControl & kRegMaskFrameRateHiBit) >> kRegShiftFrameRateHiBit) << 3)));
+	const double	framesPerSec	(NTV2_IS_VALID_NTV2FrameRate(frameRate) ? ::GetFramesPerSecond(frameRate) : 0.0);
+	return framesPerSec > 1.0  ?  ULWord(1000000.0 / framesPerSec)  :  ULWord(1000000.0 / ::GetFramesPerSecond(NTV2_FRAMERATE_5994));
+}
+
+ULWord NTV2SoftwareDevice::GetFrameBufferBytes (const NTV2Channel inChannel)
+{
+	//	Same calculation the driver uses for devices that report their frame size
+	const ULWord *	pRegs			(Registers());
+	const bool		isLowChannel	(inChannel < NTV2_CHANNEL5);
+	ULWord			quadMultiplier	(1);
+	if ((pRegs[kRegGlobalControl2] & (isLowChannel ? kRegMaskQuadMode : kRegMaskQuadMode2))
+		||  (NTV2_IS_VALID_CHANNEL(inChannel)  &&  (pRegs[sChannelToGlobalControlReg[inChannel]] & kRegMaskQuadTsiEnable)))
+			quadMultiplier = 4;
+	if (pRegs[kRegGlobalControl3] & (isLowChannel ? kRegMaskQuadQuadMode : kRegMaskQuadQuadMode2))
+		quadMultiplier = 16;
+	const NTV2Framesize frameSize (NTV2Framesize((pRegs[kRegCh1Control] & kK2RegMaskFrameSize) >> kK2RegShiftFrameSize));
+	return ::NTV2FramesizeToByteCount(frameSize) * quadMultiplier;
+}
+
+ULWord NTV2SoftwareDevice::GetBufferLevel (const SWAutoCirculate & inAC, const bool inIsInput)
+{
+	ULWord level(0);
+	switch (inAC.fState)
+	{
+		case NTV2_AUTOCIRCULATE_DISABLED:
+		case NTV2_AUTOCIRCULATE_STOPPING:
+			return 0;
+		case NTV2_AUTOCIRCULATE_INIT:
+		case NTV2_AUTOCIRCULATE_STARTING:
+		case NTV2_AUTOCIRCULATE_STARTING_AT_TIME:
+			if (inIsInput)
+				return 0;	//	Nothing captured yet
+			break;
+		default:
+			if (inIsInput)
+				level++;	//	Include the frame being captured, like the driver
+			break;
+	}
+	for (LWord frame(inAC.fStartFrame);  frame <= inAC.fEndFrame;  frame++)
+		if (inIsInput)
+			level += inAC.fValidCount[frame] ? 1 : 0;
+		else
+			level += inAC.fValidCount[frame];
+	return level;
+}
+
 void NTV2SoftwareDevice::InitRegs (void)
 {
 	NTV2WriteRegisterRemote (kRegGlobalControl, 0x30000202);  // Reg 0  // Frame Rate: 59.94, Frame Geometry: 1920x1080, Standard: 1080p, Reference Source: Reference In, Ch 2 link B 1080p 50/60: Off, LEDs ...., Register Clocking: Sync To Field, Ch 1 RP-188 output: Enabled, Ch 2 RP-188 output: Enabled, Color Correction: Channel: 1 Bank 0
@@ -0,0 +1,544 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		crossplatform/ntv2metrics/main.cpp
+	@brief		Command-line tool that serves NTV2 device health, AutoCirculate and AJADebug stats
+				in OpenMetrics text format over HTTP, for scraping by Prometheus-compatible monitors.
+	@copyright	(C) 2022 AJA Video Systems, Inc.  All rights reserved.
+**/
+
+//	Includes
+#include "ajabase/common/options_popt.h"
+#include "ajabase/common/common.h"
+#include "ajabase/network/tcp_socket.h"
+#include "ajabase/system/debug.h"
+#include "ajabase/system/lock.h"
+#include "ajabase/system/systemtime.h"
+#include "ajabase/system/thread.h"
+#include "ntv2devicescanner.h"
+#include "ntv2utils.h"
+#include <signal.h>
+#include <iomanip>
+#include <sstream>
+#if !defined(AJA_WINDOWS)
+	#include <sys/select.h>
+	#include <unistd.h>
+#endif
+
+using namespace std;
+
+
+//	Globals
+static bool			gGlobalQuit	(false);	//	Set this "true" to exit gracefully
+static AJALock		gSnapshotLock;			//	Guards gSnapshot
+static string		gSnapshot;				//	The latest rendered metrics, served to every scrape
+
+
+static void SignalHandler (int inSignal)
+{
+	(void) inSignal;
+	gGlobalQuit = true;
+}
+
+
+/**
+	@return		The given label value, escaped as OpenMetrics requires.
+	@param[in]	inValue		Specifies the raw label value.
+**/
+static string EscapeLabel (const string & inValue)
+{
+	string result;
+	for (size_t ndx(0);  ndx < inValue.size();  ndx++)
+		switch (inValue[ndx])
+		{
+			case '\\':	result += "\\\\";			break;
+			case '"':	result += "\\\"";			break;
+			case '\n':	result += "\\n";			break;
+			default:	result += inValue[ndx];		break;
+		}
+	return result;
+}
+
+
+/**
+	@return		The given label set with another label appended to it.
+	@param[in]	inLabels	Specifies the existing labels, if any (e.g. 'device="0"').
+	@param[in]	inName		Specifies the name of the label to append.
+	@param[in]	inValue		Specifies its (unescaped) value.
+**/
+static string AddLabel (const string & inLabels, const string & inName, const string & inValue)
+{
+	return inLabels + (inLabels.empty() ? "" : ",") + inName + "=\"" + EscapeLabel(inValue) + "\"";
+}
+
+
+/**
+	@brief	Accumulates one scrape's worth of samples, grouped into metric families as OpenMetrics requires,
+			and renders them as text.
+**/
+class MetricSet
+{
+	public:
+		/**
+			@brief		Declares a metric family. Families are rendered in the order they're declared.
+			@param[in]	inName		Specifies the family name (without any "_total" suffix).
+			@param[in]	inType		Specifies the family type ("gauge" or "counter").
+			@param[in]	inHelp		Specifies the family's help text.
+		**/
+		void Declare (const string & inName, const string & inType, const string & inHelp)
+		{
+			mIndexes[inName] = mFamilies.size();
+			Family family;
+			family.name = inName;  family.type = inType;  family.help = inHelp;
+			mFamilies.push_back(family);
+		}
+
+		/**
+			@brief		Adds a sample to a previously declared family.
+			@param[in]	inName		Specifies the family name.
+			@param[in]	inLabels	Specifies the sample's labels (e.g. 'device="0",channel="1"').
+			@param[in]	inValue		Specifies the sample value.
+		**/
+		void Add (const string & inName, const string & inLabels, const double inValue)
+		{
+			map<string,size_t>::const_iterator it (mIndexes.find(inName));
+			if (it == mIndexes.end())
+				return;
+			Family & family (mFamilies.at(it->second));
+			ostringstream oss;
+			oss << family.name << (family.type == "counter" ? "_total" : "");
+			if (!inLabels.empty())
+				oss << "{" << inLabels << "}";
+			oss << " " << setprecision(12) << inValue << "\n";
+			family.samples += oss.str();
+		}
+
+		/**
+			@return		All families that have samples, in OpenMetrics text format, ending with "# EOF".
+		**/
+		string Render (void) const
+		{
+			ostringstream oss;
+			for (size_t ndx(0);  ndx < mFamilies.size();  ndx++)
+			{
+				const Family & family (mFamilies.at(ndx));
+				if (family.samples.empty())
+					continue;
+				oss << "# TYPE " << family.name << " " << family.type << "\n"
+					<< "# HELP " << family.name << " " << family.help << "\n"
+					<< family.samples;
+			}
+			oss << "# EOF\n";
+			return oss.str();
+		}
+
+	private:
+		struct Family
+		{
+			string	name, type, help, samples;
+		};
+		vector<Family>		mFamilies;
+		map<string,size_t>	mIndexes;
+};	//	MetricSet
+
+
+/**
+	@brief	Declares every metric family this tool can emit.
+	@param[out]	outMetrics	Receives the family declarations.
+**/
+static void DeclareFamilies (MetricSet & outMetrics)
+{
+	outMetrics.Declare("ntv2_device_up",						"gauge",	"1 if the device's registers could be read in the last poll, otherwise 0.");
+	outMetrics.Declare("ntv2_die_temperature_celsius",			"gauge",	"FPGA die temperature.");
+	outMetrics.Declare("ntv2_die_core_voltage_volts",			"gauge",	"FPGA core voltage.");
+	outMetrics.Declare("ntv2_fan_speed_percent",				"gauge",	"Fan speed (0 if off).");
+	outMetrics.Declare("ntv2_sdi_input_locked",					"gauge",	"1 if the SDI input is locked to a signal.");
+	outMetrics.Declare("ntv2_sdi_input_trs_error",				"gauge",	"1 if the SDI input has a TRS error.");
+	outMetrics.Declare("ntv2_sdi_input_unlocks",				"counter",	"Number of times the SDI input lost lock (16-bit hardware counter).");
+	outMetrics.Declare("ntv2_sdi_input_crc_errors",				"counter",	"SDI input CRC errors, per link (16-bit hardware counter).");
+	outMetrics.Declare("ntv2_autocirculate_running",			"gauge",	"1 if AutoCirculate is running on the channel, 0 if it's starting, paused or stopping.");
+	outMetrics.Declare("ntv2_autocirculate_frames_processed",	"counter",	"Frames processed by AutoCirculate since it was started.");
+	outMetrics.Declare("ntv2_autocirculate_frames_dropped",		"counter",	"Frames dropped by AutoCirculate since it was started.");
+	outMetrics.Declare("ntv2_autocirculate_buffer_level",		"gauge",	"Frames currently buffered by AutoCirculate.");
+	outMetrics.Declare("ntv2_autocirculate_buffer_frames",		"gauge",	"Frames in the AutoCirculate ring.");
+	outMetrics.Declare("ntv2_autocirculate_latency_microseconds","gauge",	"AutoCirculate stage latency percentiles published by CNTV2Card::AutoCirculatePublishLatencyStats, for the device that owns them.");
+	outMetrics.Declare("ajadebug_stat_updates",					"counter",	"Update count of an AJADebug stat (the value of a simple counter).");
+	outMetrics.Declare("ajadebug_stat_last",					"gauge",	"Latest value of an AJADebug timer or value stat (timers are in microseconds).");
+	outMetrics.Declare("ajadebug_stat_average",					"gauge",	"Average of the last 11 values of an AJADebug timer or value stat.");
+	outMetrics.Declare("ajadebug_stat_min",						"gauge",	"Smallest value of an AJADebug timer or value stat.");
+	outMetrics.Declare("ajadebug_stat_max",						"gauge",	"Largest value of an AJADebug timer or value stat.");
+	outMetrics.Declare("ntv2metrics_poll_duration_seconds",		"gauge",	"Time taken by the exporter's last poll of all devices and stats.");
+	outMetrics.Declare("ntv2metrics_polls",						"counter",	"Polls made by the exporter.");
+}
+
+
+/**
+	@brief	Polls one device. The register-based metrics for the device are read with a single batched
+			ReadRegisters call. AutoCirculate state lives in the driver, not in registers, so it's
+			queried per FrameStore.
+**/
+class DeviceMonitor
+{
+	public:
+		DeviceMonitor (const ULWord inIndex)
+			:	mTempNdx	(-1),
+				mFanNdx		(-1),
+				mSDINdx		(-1),
+				mNumSDIIns	(0),
+				mNumChannels(0)
+		{
+			if (!CNTV2DeviceScanner::GetDeviceAtIndex(inIndex, mDevice))
+				return;
+			string serial;
+			mDevice.GetSerialNumberString(serial);
+			mLabels = AddLabel(AddLabel(AddLabel("", "device", aja::to_string(int(inIndex))),
+										"model", ::NTV2DeviceIDToString(mDevice.GetDeviceID())),
+								"serial", serial);
+			mNumChannels = mDevice.features().GetNumFrameStores();
+
+			//	Build the register list once -- it only depends on the device's features...
+			if (mDevice.features().CanMeasureTemperature())
+			{
+				mTempNdx = int(mRegs.size());
+				mRegs.push_back(NTV2RegInfo(kRegSysmonVccIntDieTemp));
+				mFanNdx = int(mRegs.size());
+				if (mDevice.features().CanThermostat())
+					mRegs.push_back(NTV2RegInfo(kVRegFanSpeed));	//	Holds the NTV2FanSpeed percentage as-is
+				else
+					mRegs.push_back(NTV2RegInfo(kRegSysmonConfig2, 0, BIT(16), 16));
+			}
+			if (mDevice.features().CanDoSDIErrorChecks())
+			{
+				mNumSDIIns = mDevice.features().GetNumVideoInputs();
+				if (mNumSDIIns > 8)
+					mNumSDIIns = 8;		//	Only 8 RXSDI register blocks
+				mSDINdx = int(mRegs.size());
+				for (UWord input(0);  input < mNumSDIIns;  input++)
+				{	//	Each RXSDI block is 8 registers:  status, CRC error counts, ...
+					mRegs.push_back(NTV2RegInfo(kRegRXSDI1Status + input * 8));
+					mRegs.push_back(NTV2RegInfo(kRegRXSDI1CRCErrorCount + input * 8));
+				}
+			}
+		}
+
+		inline bool IsOpen (void)	{return mDevice.IsOpen();}
+
+		void Poll (MetricSet & ioMetrics)
+		{
+			NTV2RegisterReads regs (mRegs);
+			const bool regsOK (mDevice.ReadRegisters(regs));
+			ioMetrics.Add("ntv2_device_up", mLabels, regsOK ? 1 : 0);
+			if (regsOK  &&  mTempNdx >= 0)
+			{	//	Same conversions as CNTV2Card::GetDieTemperature and CNTV2Card::GetDieVoltage...
+				const ULWord raw (regs.at(size_t(mTempNdx)).registerValue);
+				ioMetrics.Add("ntv2_die_temperature_celsius", mLabels, double((raw & 0x0000FFFF) >> 6) * 503.975 / 1024.0 - 273.15);
+				ioMetrics.Add("ntv2_die_core_voltage_volts", mLabels, double((raw >> 22) & 0x000003FF) / 1024.0 * 3.0);
+				const NTV2RegInfo & fan (regs.at(size_t(mFanNdx)));
+				const ULWord fanValue ((fan.registerValue & fan.registerMask) >> fan.registerShift);
+				ioMetrics.Add("ntv2_fan_speed_percent", mLabels, mDevice.features().CanThermostat() ? fanValue : (fanValue ? 100 : 0));
+			}
+			if (regsOK  &&  mSDINdx >= 0)
+				for (UWord input(0);  input < mNumSDIIns;  input++)
+				{
+					const ULWord status	(regs.at(size_t(mSDINdx) + input * 2).registerValue);
+					const ULWord crc	(regs.at(size_t(mSDINdx) + input * 2 + 1).registerValue);
+					const string labels	(AddLabel(mLabels, "input", aja::to_string(int(input) + 1)));
+					ioMetrics.Add("ntv2_sdi_input_locked", labels, (status & kRegMaskSDIInLocked) ? 1 : 0);
+					ioMetrics.Add("ntv2_sdi_input_trs_error", labels, (status & kRegMaskSDIInTRSError) ? 1 : 0);
+					ioMetrics.Add("ntv2_sdi_input_unlocks", labels, (status & kRegMaskSDIInUnlockCount) >> kRegShiftSDIInUnlockCount);
+					ioMetrics.Add("ntv2_sdi_input_crc_errors", AddLabel(labels, "link", "a"), (crc & kRegMaskSDIInCRCErrorCountA) >> kRegShiftSDIInCRCErrorCountA);
+					ioMetrics.Add("ntv2_sdi_input_crc_errors", AddLabel(labels, "link", "b"), (crc & kRegMaskSDIInCRCErrorCountB) >> kRegShiftSDIInCRCErrorCountB);
+				}
+
+			for (UWord chan(0);  chan < mNumChannels;  chan++)
+			{
+				AUTOCIRCULATE_STATUS acStatus;
+				if (!mDevice.AutoCirculateGetStatus(NTV2Channel(chan), acStatus)  ||  acStatus.IsStopped())
+					continue;
+				const string labels (AddLabel(AddLabel(mLabels, "channel", aja::to_string(int(chan) + 1)),
+												"mode", acStatus.IsInput() ? "input" : "output"));
+				ioMetrics.Add("ntv2_autocirculate_running", labels, acStatus.IsRunning() ? 1 : 0);
+				ioMetrics.Add("ntv2_autocirculate_frames_processed", labels, acStatus.GetProcessedFrameCount());
+				ioMetrics.Add("ntv2_autocirculate_frames_dropped", labels, acStatus.GetDroppedFrameCount());
+				ioMetrics.Add("ntv2_autocirculate_buffer_level", labels, acStatus.GetBufferLevel());
+				ioMetrics.Add("ntv2_autocirculate_buffer_frames", labels, acStatus.GetFrameCount());
+			}
+		}
+
+	private:
+		CNTV2Card			mDevice;
+		string				mLabels;		//	Identifies the device in every sample
+		NTV2RegisterReads	mRegs;			//	Everything read per poll, in one ReadRegisters call
+		int					mTempNdx;		//	Index of kRegSysmonVccIntDieTemp in mRegs, or -1
+		int					mFanNdx;		//	Index of the fan register in mRegs, or -1
+		int					mSDINdx;		//	Index of the first RXSDI register in mRegs, or -1
+		UWord				mNumSDIIns;
+		UWord				mNumChannels;
+};	//	DeviceMonitor
+
+
+/**
+	@brief		Adds the stats in the AJADebug shared stats area to the given metrics.
+	@param[out]	ioMetrics	Receives the stats.
+**/
+static void PollDebugStats (MetricSet & ioMetrics)
+{
+	static const char * sPercentiles[] = {"50", "99", "99.9"};
+	vector<uint32_t> keys;
+	uint32_t seqNum(0);
+	if (!AJADebug::HasStats()  ||  AJA_FAILURE(AJADebug::StatGetKeys(keys, seqNum)))
+		return;
+	//	The latency keys are shared by all devices -- the one that owns them is published alongside...
+	AJADebugStat owner;
+	const bool hasOwner (AJA_SUCCESS(AJADebug::StatGetInfo(AJA_DebugStat_ACLatencyDevice, owner))  &&  owner.fCount);
+	const string ownerLabels (hasOwner ? AddLabel("", "device", aja::to_string(int(owner.GetCurrentValue()))) : string());
+	for (size_t ndx(0);  ndx < keys.size();  ndx++)
+	{
+		const uint32_t key (keys.at(ndx));
+		AJADebugStat stat;
+		if (key == AJA_DebugStat_ACLatencyDevice  ||  AJA_FAILURE(AJADebug::StatGetInfo(key, stat)))
+			continue;
+		if (key >= AJA_DebugStat_ACLatencyFirst  &&  key < AJA_DebugStat_ACLatencyFirst + AJA_DebugStat_ACLatencyCount)
+		{	//	See CNTV2Card::AutoCirculatePublishLatencyStats for the key layout...
+			const uint32_t offset (key - AJA_DebugStat_ACLatencyFirst);
+			const uint32_t stage (offset / 3 % NTV2_AC_LATENCY_NUM_STAGES);
+			if (!stat.fCount  ||  !hasOwner)
+				continue;
+			string labels (AddLabel(ownerLabels, "channel", aja::to_string(int(offset / 3 / NTV2_AC_LATENCY_NUM_STAGES) + 1)));
+			labels = AddLabel(labels, "stage", ::NTV2ACLatencyStageToString(NTV2ACLatencyStage(stage), true));
+			labels = AddLabel(labels, "percentile", sPercentiles[offset % 3]);
+			ioMetrics.Add("ntv2_autocirculate_latency_microseconds", labels, stat.GetCurrentValue());
+			continue;
+		}
+		string labels (AddLabel("", "key", aja::to_string(int(key))));
+		const string name (AJADebugStat::StatKeyName(int(key)));
+		if (!name.empty())
+			labels = AddLabel(labels, "name", name);
+		ioMetrics.Add("ajadebug_stat_updates", labels, stat.fCount);
+		if (stat.IsSimpleCounter()  ||  !stat.fCount)
+			continue;
+		ioMetrics.Add("ajadebug_stat_last", labels, stat.GetCurrentValue());
+		ioMetrics.Add("ajadebug_stat_average", labels, stat.Average());
+		ioMetrics.Add("ajadebug_stat_min", labels, stat.fMin);
+		ioMetrics.Add("ajadebug_stat_max", labels, stat.fMax);
+	}
+}
+
+
+/**
+	@brief	A listening socket whose Accept can time out, so the serving thread can notice it's being stopped.
+**/
+class MetricsListener : public AJATCPSocket
+{
+	public:
+		/**
+			@return		The accepted client socket, or -1 if no client connected within the given time.
+			@param[in]	inTimeoutMs		Specifies how long to wait for a client, in milliseconds.
+		**/
+		int AcceptWithTimeout (const uint32_t inTimeoutMs)
+		{
+			if (mSocket == -1)
+				return -1;
+			fd_set readSet;
+			FD_ZERO(&readSet);
+			FD_SET(mSocket, &readSet);
+			struct timeval timeout;
+			timeout.tv_sec = long(inTimeoutMs / 1000);
+			timeout.tv_usec = long(inTimeoutMs % 1000) * 1000;
+			if (::select(mSocket + 1, &readSet, AJA_NULL, AJA_NULL, &timeout) <= 0)
+				return -1;
+			return int(::accept(mSocket, AJA_NULL, AJA_NULL));	//	Quietly -- Accept logs every connection
+		}
+};	//	MetricsListener
+
+
+static void CloseClient (const int inSocket)
+{
+	#if defined(AJA_WINDOWS)
+		::closesocket(inSocket);
+	#else
+		::close(inSocket);
+	#endif
+}
+
+
+/**
+	@brief		Reads one HTTP request from the given client, and answers it.
+	@param[in]	inSocket	Specifies the accepted client socket, which is closed on return.
+**/
+static void ServeClient (const int inSocket)
+{
+	#if defined(AJA_WINDOWS)
+		const DWORD timeout (2000);
+	#else
+		struct timeval timeout;
+		timeout.tv_sec = 2;  timeout.tv_usec = 0;
+	#endif
+	::setsockopt(inSocket, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char*>(&timeout), sizeof(timeout));
+
+	//	Read the request head -- there's never a body worth reading...
+	string request;
+	char buffer[1024];
+	while (request.find("\r\n\r\n") == string::npos  &&  request.size() < 8192)
+	{
+		const int bytesRead (int(::recv(inSocket, buffer, sizeof(buffer), 0)));
+		if (bytesRead <= 0)
+			break;
+		request.append(buffer, size_t(bytesRead));
+	}
+
+	istringstream requestLine (request.substr(0, request.find("\r\n")));
+	string method, target;
+	requestLine >> method >> target;
+	target = target.substr(0, target.find('?'));
+
+	string status ("200 OK"), contentType ("application/openmetrics-text; version=1.0.0; charset=utf-8"), body;
+	if (method != "GET"  &&  method != "HEAD")
+		{status = "405 Method Not Allowed";  contentType = "text/plain";  body = "Only GET is supported\n";}
+	else if (target == "/metrics")
+		{AJAAutoLock locker(&gSnapshotLock);  body = gSnapshot;}
+	else if (target == "/")
+		{contentType = "text/plain";  body = "ntv2metrics:  scrape /metrics\n";}
+	else
+		{status = "404 Not Found";  contentType = "text/plain";  body = "Not found\n";}
+
+	ostringstream response;
+	response << "HTTP/1.1 " << status << "\r\n"
+			 << "Content-Type: " << contentType << "\r\n"
+			 << "Content-Length: " << body.size() << "\r\n"
+			 << "Connection: close\r\n\r\n";
+	if (method != "HEAD")
+		response << body;
+	const string text (response.str());
+	for (size_t sent(0);  sent < text.size();  )
+	{
+		const int bytesSent (int(::send(inSocket, text.data() + sent, int(text.size() - sent), 0)));
+		if (bytesSent <= 0)
+			break;
+		sent += size_t(bytesSent);
+	}
+	CloseClient(inSocket);
+}
+
+
+static void ServeThread (AJAThread * pThread, void * pContext)
+{
+	MetricsListener & listener (*reinterpret_cast<MetricsListener*>(pContext));
+	while (!pThread->Terminate()  &&  !gGlobalQuit)
+	{
+		const int client (listener.AcceptWithTimeout(250));
+		if (client >= 0)
+			ServeClient(client);
+	}
+}
+
+
+/**
+	@brief		Main entry point for 'ntv2metrics'.
+	@param[in]	argc	Number arguments specified on the command line, including the path to the executable.
+	@param[in]	argv	Array of 'const char' pointers, one for each argument.
+	@return		Result code, which must be zero if successful, or non-zero for failure.
+**/
+int main (int argc, const char ** argv)
+{
+	char *		pDeviceSpec		(AJA_NULL);	//	Which device?
+	char *		pBindAddress	(AJA_NULL);	//	Which interface to listen on?
+	int			port			(9750);		//	Which TCP port to listen on?
+	int			intervalMs		(1000);		//	How often to poll?
+	poptContext	optionsContext;				//	Context for parsing command line arguments
+
+	//	Command line option descriptions:
+	const struct poptOption userOptionsTable [] =
+	{
+		{"board",		'b',	POPT_ARG_STRING,	&pDeviceSpec,	0,	"which device to use",			"index#|serial#|model (default: all)"	},
+		{"device",		'd',	POPT_ARG_STRING,	&pDeviceSpec,	0,	"which device to use",			"index#|serial#|model (default: all)"	},
+		{"bind",		0,		POPT_ARG_STRING,	&pBindAddress,	0,	"address to listen on",			"IPv4 address (default: 127.0.0.1)"		},
+		{"port",		'p',	POPT_ARG_INT,		&port,			0,	"TCP port to listen on",		"port (default: 9750)"					},
+		{"interval",	'i',	POPT_ARG_INT,		&intervalMs,	0,	"polling interval",				"milliseconds (default: 1000)"			},
+		POPT_AUTOHELP
+		POPT_TABLEEND
+	};
+
+	//	Read command line arguments...
+	optionsContext = ::poptGetContext (AJA_NULL, argc, argv, userOptionsTable, 0);
+	if (::poptGetNextOpt (optionsContext) < -1)
+		{cerr << "## ERROR:  Bad command line argument(s)" << endl;		return 1;}
+	optionsContext = ::poptFreeContext (optionsContext);
+
+	const string	deviceSpec	(pDeviceSpec ? pDeviceSpec : "");
+	const string	bindAddress	(pBindAddress ? pBindAddress : "127.0.0.1");
+	if (port <= 0  ||  port > 65535)
+		{cerr << "## ERROR:  Bad '--port' value " << port << endl;  return 1;}
+	if (intervalMs < 10)
+		{cerr << "## ERROR:  Bad '--interval' value " << intervalMs << ", must be at least 10" << endl;  return 1;}
+
+	//	Find the device(s) to monitor...
+	vector<DeviceMonitor*> monitors;
+	if (deviceSpec.empty())
+	{
+		for (ULWord ndx(0);  ;  ndx++)
+		{
+			DeviceMonitor * pMonitor (new DeviceMonitor(ndx));
+			if (!pMonitor->IsOpen())
+				{delete pMonitor;  break;}
+			monitors.push_back(pMonitor);
+		}
+	}
+	else
+	{
+		CNTV2Card device;
+		if (!CNTV2DeviceScanner::GetFirstDeviceFromArgument (deviceSpec, device))
+			{cerr << "## ERROR:  Device '" << deviceSpec << "' not found" << endl;  return 2;}
+		monitors.push_back(new DeviceMonitor(device.GetIndexNumber()));
+	}
+	AJADebug::Open();
+
+	//	Listen for scrapes...
+	MetricsListener listener;
+	if (AJA_FAILURE(listener.Open(bindAddress, uint16_t(port)))  ||  AJA_FAILURE(listener.Listen()))
+		{cerr << "## ERROR:  Cannot listen on " << bindAddress << ":" << port << endl;  return 3;}
+	AJAThread serveThread;
+	serveThread.Attach(ServeThread, &listener);
+	serveThread.Start();
+	cout << "Serving OpenMetrics for " << monitors.size() << " device(s) at http://" << bindAddress << ":" << port
+		 << "/metrics, polling every " << intervalMs << "ms" << endl;
+
+	::signal (SIGINT, SignalHandler);
+	#if !defined(AJA_WINDOWS)
+		::signal (SIGPIPE, SIG_IGN);	//	Scrapers that hang up early mustn't kill us
+	#endif
+	#if defined(AJAMac)
+		::signal (SIGHUP, SignalHandler);
+		::signal (SIGQUIT, SignalHandler);
+	#endif
+
+	uint64_t numPolls(0);
+	while (!gGlobalQuit)
+	{
+		const uint64_t startUs (AJATime::GetSystemMicroseconds());
+		MetricSet metrics;
+		::DeclareFamilies(metrics);
+		for (size_t ndx(0);  ndx < monitors.size();  ndx++)
+			if (monitors.at(ndx)->IsOpen())
+				monitors.at(ndx)->Poll(metrics);
+		::PollDebugStats(metrics);
+		const uint64_t elapsedUs (AJATime::GetSystemMicroseconds() - startUs);
+		metrics.Add("ntv2metrics_poll_duration_seconds", "", double(elapsedUs) / 1000000.0);
+		metrics.Add("ntv2metrics_polls", "", double(++numPolls));
+		const string text (metrics.Render());
+		{
+			AJAAutoLock locker(&gSnapshotLock);
+			gSnapshot = text;
+		}
+
+		//	Sleep until the next poll, waking often enough to notice Ctrl-C...
+		for (uint64_t sleptUs(elapsedUs);  !gGlobalQuit  &&  sleptUs < uint64_t(intervalMs) * 1000;  sleptUs += 50000)
+			AJATime::Sleep(50);
+	}
+
+	serveThread.Stop();
+	listener.Close();
+	for (size_t ndx(0);  ndx < monitors.size();  ndx++)
+		delete monitors.at(ndx);
+	AJADebug::Close();
+	return 0;
+}	//	main